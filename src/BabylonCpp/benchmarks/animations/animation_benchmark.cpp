@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace BenchmarkAnimation {
+
+/**
+ * @brief Creates a cycling animation of keyCount keys, one per frame, the value of the keys being
+ * built from 16 random floats.
+ */
+template <typename F>
+BABYLON::AnimationPtr createAnimation(unsigned int dataType, size_t keyCount, F&& value)
+{
+  using namespace BABYLON;
+
+  const auto values = randomFloats(keyCount * 16, -1.f, 1.f);
+  auto animation
+    = Animation::New("animation", "property", 60, dataType, Animation::ANIMATIONLOOPMODE_CYCLE);
+  std::vector<IAnimationKey> keys;
+  keys.reserve(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) {
+    keys.emplace_back(IAnimationKey(static_cast<float>(i), value(&values[i * 16])));
+  }
+  animation->setKeys(keys);
+  return animation;
+}
+
+/**
+ * @brief Interpolates the animation at frameCount frames spread over its whole range.
+ */
+void measureInterpolate(const std::string& name, const BABYLON::AnimationPtr& animation,
+                        size_t keyCount, size_t frameCount)
+{
+  using namespace BABYLON;
+
+  const auto frames = randomFloats(frameCount, 0.f, static_cast<float>(keyCount - 1));
+  _IAnimationState state;
+  state.key         = 0;
+  state.repeatCount = 0;
+  state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+  measure(name, frameCount, [&]() {
+    for (const auto frame : frames) {
+      doNotOptimize(animation->_interpolate(frame, state));
+    }
+  });
+}
+
+} // end of namespace BenchmarkAnimation
+
+TEST(BenchmarkAnimation, interpolate)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkAnimation;
+
+  const size_t keyCount = 120;
+  const auto floats     = createAnimation(Animation::ANIMATIONTYPE_FLOAT, keyCount,
+                                      [](const float* v) { return AnimationValue(v[0]); });
+  const auto vectors
+    = createAnimation(Animation::ANIMATIONTYPE_VECTOR3, keyCount,
+                      [](const float* v) { return AnimationValue(Vector3(v[0], v[1], v[2])); });
+  const auto quaternions
+    = createAnimation(Animation::ANIMATIONTYPE_QUATERNION, keyCount, [](const float* v) {
+        auto rotation = Quaternion(v[0], v[1], v[2], v[3]);
+        rotation.normalize();
+        return AnimationValue(rotation);
+      });
+  const auto matrices
+    = createAnimation(Animation::ANIMATIONTYPE_MATRIX, keyCount, [](const float* v) {
+        return AnimationValue(Matrix::FromArray(Float32Array(v, v + 16)));
+      });
+
+  for (const auto scale : BenchmarkScales) {
+    measureInterpolate("Animation::_interpolate (float)", floats, keyCount, scale);
+    measureInterpolate("Animation::_interpolate (Vector3)", vectors, keyCount, scale);
+    measureInterpolate("Animation::_interpolate (Quaternion)", quaternions, keyCount, scale);
+    measureInterpolate("Animation::_interpolate (Matrix)", matrices, keyCount, scale);
+  }
+}
+
+TEST(BenchmarkSkeleton, prepare)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  // Scale is the number of bones, organized as chains of 8 bones
+  for (const auto scale : {size_t(100), size_t(1000), size_t(10000)}) {
+    auto skeleton     = Skeleton::New("skeleton", "skeleton", scene.get());
+    const auto values = randomFloats(scale * 6, -1.f, 1.f);
+    Bone* parent      = nullptr;
+    for (size_t i = 0; i < scale; ++i) {
+      const auto v = &values[i * 6];
+      const auto local = Matrix::RotationYawPitchRoll(v[0], v[1], v[2])
+                           .multiply(Matrix::Translation(v[3], v[4], v[5]));
+      auto bone        = Bone::New("bone" + std::to_string(i), skeleton.get(),
+                                   i % 8 == 0 ? nullptr : parent, local, std::nullopt,
+                                   std::nullopt, static_cast<int>(i));
+      parent           = bone.get();
+    }
+    skeleton->useTextureToStoreBoneMatrices = false;
+
+    measure("Skeleton::prepare", scale, [&]() {
+      skeleton->_markAsDirty();
+      skeleton->prepare();
+      doNotOptimize(skeleton);
+    });
+
+    skeleton->dispose();
+  }
+}
@@ -0,0 +1,269 @@
+#ifndef BABYLON_BENCHMARK_UTILS_H
+#define BABYLON_BENCHMARK_UTILS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/culling/culling_store.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/maths/matrix_kernels.h>
+#include <babylon/particles/particle_store.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Data set scales shared by the benchmarks (number of elements processed per run).
+ */
+static const std::vector<size_t> BenchmarkScales{1000, 10000, 100000};
+
+/**
+ * @brief Seed used to generate the data sets, fixed so that runs can be compared.
+ */
+static constexpr uint32_t BenchmarkSeed = 0x42a5u;
+
+/**
+ * @brief Measurement of one benchmark at one scale.
+ */
+struct BenchmarkResult {
+  std::string name;
+  size_t scale;
+  size_t iterations;
+  size_t samples;
+  double minNs;
+  double medianNs;
+  double meanNs;
+}; // end of struct BenchmarkResult
+
+/**
+ * @brief Measurement of the frames rendered for one synthetic scene.
+ */
+struct FrameBenchmarkResult {
+  std::string name;
+  nlohmann::json parameters;
+  size_t frames;
+  double meanMs;
+  double p50Ms;
+  double p99Ms;
+  double drawCalls;
+  std::vector<std::pair<std::string, double>> phasesMs;
+}; // end of struct FrameBenchmarkResult
+
+/**
+ * @brief Collects the benchmark results and writes them as JSON.
+ */
+class BenchmarkReporter {
+
+public:
+  static BenchmarkReporter& Instance()
+  {
+    static BenchmarkReporter reporter;
+    return reporter;
+  }
+
+  void add(const BenchmarkResult& result)
+  {
+    std::cout << std::left << std::setw(48) << result.name << std::right << std::setw(8)
+              << result.scale << std::setw(14) << std::fixed << std::setprecision(1)
+              << result.medianNs << " ns/run" << std::setw(12) << std::setprecision(3)
+              << result.medianNs / static_cast<double>(result.scale) << " ns/element"
+              << std::endl;
+    results.emplace_back(result);
+  }
+
+  void add(const FrameBenchmarkResult& result)
+  {
+    std::cout << std::left << std::setw(48) << ("Scene::render (" + result.name + ")")
+              << std::right << std::setw(8) << result.frames << std::setw(14) << std::fixed
+              << std::setprecision(3) << result.meanMs << " ms/frame" << std::setw(10)
+              << result.p99Ms << " ms p99" << std::setw(10) << std::setprecision(1)
+              << result.drawCalls << " draws" << std::endl;
+    for (const auto& [phase, durationMs] : result.phasesMs) {
+      std::cout << "  " << std::left << std::setw(46) << phase << std::right << std::setw(22)
+                << std::setprecision(3) << durationMs << " ms/frame" << std::endl;
+    }
+    frameResults.emplace_back(result);
+  }
+
+  [[nodiscard]] nlohmann::json toJson() const
+  {
+    nlohmann::json context{
+      {"seed", BenchmarkSeed},
+      {"hardwareConcurrency", std::thread::hardware_concurrency()},
+      {"matrixKernels", MatrixKernels::Get().name},
+      {"cullingKernel", CullingStore::KernelName()},
+      {"particleKernel", ParticleStore::KernelName()},
+#if defined(NDEBUG)
+      {"buildType", "release"},
+#else
+      {"buildType", "debug"},
+#endif
+    };
+    auto benchmarks = nlohmann::json::array();
+    for (const auto& result : results) {
+      benchmarks.push_back({{"name", result.name},
+                            {"scale", result.scale},
+                            {"iterations", result.iterations},
+                            {"samples", result.samples},
+                            {"minNs", result.minNs},
+                            {"medianNs", result.medianNs},
+                            {"meanNs", result.meanNs}});
+    }
+    auto frames = nlohmann::json::array();
+    for (const auto& result : frameResults) {
+      nlohmann::json phases;
+      for (const auto& [phase, durationMs] : result.phasesMs) {
+        phases[phase] = durationMs;
+      }
+      frames.push_back({{"name", result.name},
+                        {"parameters", result.parameters},
+                        {"frames", result.frames},
+                        {"meanMs", result.meanMs},
+                        {"p50Ms", result.p50Ms},
+                        {"p99Ms", result.p99Ms},
+                        {"drawCalls", result.drawCalls},
+                        {"phasesMs", phases}});
+    }
+    return {{"context", context}, {"benchmarks", benchmarks}, {"frames", frames}};
+  }
+
+  bool writeJson(const std::string& path) const
+  {
+    std::ofstream file(path);
+    if (!file) {
+      return false;
+    }
+    file << toJson().dump(2) << std::endl;
+    return static_cast<bool>(file);
+  }
+
+public:
+  /**
+   * Number of frames rendered by the frame benchmarks, after the warm up frames
+   */
+  size_t frameCount = 300;
+
+private:
+  BenchmarkReporter() = default;
+
+private:
+  std::vector<BenchmarkResult> results;
+  std::vector<FrameBenchmarkResult> frameResults;
+
+}; // end of class BenchmarkReporter
+
+/**
+ * @brief Measures the duration of a function. The function is called enough times per sample for
+ * the sample to last about 5ms, the minimum, median and mean durations of one call are reported.
+ * @param name defines the name of the benchmark
+ * @param scale defines the number of elements processed by one call
+ * @param func defines the function to measure
+ * @param samples defines the number of samples to take
+ */
+template <typename F>
+void measure(const std::string& name, size_t scale, F&& func, size_t samples = 15)
+{
+  using Clock = std::chrono::steady_clock;
+  const auto run = [&func](size_t iterations) {
+    const auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      func();
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  };
+
+  // Warm up and calibration
+  size_t iterations = 1;
+  while (run(iterations) < 5e6 && iterations < (size_t(1) << 24)) {
+    iterations *= 2;
+  }
+
+  std::vector<double> durations(samples);
+  for (auto& duration : durations) {
+    duration = run(iterations) / static_cast<double>(iterations);
+  }
+  std::sort(durations.begin(), durations.end());
+
+  double total = 0.0;
+  for (const auto duration : durations) {
+    total += duration;
+  }
+
+  BenchmarkReporter::Instance().add(BenchmarkResult{name, scale, iterations, samples,
+                                                    durations.front(),
+                                                    durations[durations.size() / 2],
+                                                    total / static_cast<double>(samples)});
+}
+
+/**
+ * @brief Returns the nearest-rank percentile (in [0, 100]) of a set of values.
+ */
+inline double percentile(std::vector<double> values, double rank)
+{
+  if (values.empty()) {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  const auto index = static_cast<size_t>(std::ceil(rank / 100.0 * values.size()));
+  return values[std::clamp<size_t>(index, 1, values.size()) - 1];
+}
+
+/**
+ * @brief Prevents the compiler from optimizing away a computed value.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+  // No inline assembly: the address escapes through a volatile store read back
+  static const void* volatile sink;
+  sink = &value;
+  static_cast<void>(sink);
+#else
+  // The value may be read through its address, and memory may have been modified
+  asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+/**
+ * @brief Returns count floats uniformly distributed in [min, max), generated from a fixed seed.
+ */
+inline std::vector<float> randomFloats(size_t count, float min, float max,
+                                       uint32_t seed = BenchmarkSeed)
+{
+  // The standard distributions are implementation defined, only the engine output is portable
+  std::mt19937 generator(seed);
+  std::vector<float> values(count);
+  for (auto& value : values) {
+    value = min + (max - min) * static_cast<float>(generator() >> 8) * (1.f / 16777216.f);
+  }
+  return values;
+}
+
+/**
+ * @brief Creates the headless engine used by the benchmarks needing a scene.
+ */
+inline std::unique_ptr<Engine> createBenchmarkEngine()
+{
+  NullEngineOptions options;
+  options.renderHeight          = 256;
+  options.renderWidth           = 256;
+  options.textureSize           = 256;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  return NullEngine::New(options);
+}
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARK_UTILS_H
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/culling_store.h>
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/plane.h>
+#include <babylon/meshes/mesh.h>
+
+namespace BenchmarkCulling {
+
+/**
+ * @brief Returns the frustum planes of a camera looking at the center of the data sets.
+ */
+std::array<BABYLON::Plane, 6> frustumPlanes()
+{
+  using namespace BABYLON;
+
+  auto target     = Vector3::Zero();
+  auto view       = Matrix::LookAtLH(Vector3(0.f, 20.f, -150.f), target, Vector3::Up());
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.5f, 1.f, 250.f);
+  return Frustum::GetPlanes(view.multiply(projection));
+}
+
+/**
+ * @brief Returns count randomly oriented bounding infos spread over a 200 units wide cube.
+ */
+std::vector<BABYLON::BoundingInfo> randomBoundingInfos(size_t count)
+{
+  using namespace BABYLON;
+
+  const auto values = randomFloats(count * 9, 0.f, 1.f);
+  std::vector<BoundingInfo> boundingInfos;
+  boundingInfos.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const auto v = &values[i * 9];
+    const Vector3 halfSize(0.1f + v[0] * 4.f, 0.1f + v[1] * 4.f, 0.1f + v[2] * 4.f);
+    BoundingInfo boundingInfo(halfSize.negate(), halfSize);
+    boundingInfo.update(
+      Matrix::RotationYawPitchRoll(v[3] * 3.14f, v[4] * 3.14f, v[5] * 3.14f)
+        .multiply(Matrix::Translation(v[6] * 200.f - 100.f, v[7] * 200.f - 100.f,
+                                      v[8] * 200.f - 100.f)));
+    boundingInfos.emplace_back(boundingInfo);
+  }
+  return boundingInfos;
+}
+
+} // end of namespace BenchmarkCulling
+
+TEST(BenchmarkBoundingInfo, isInFrustum)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkCulling;
+
+  const auto planes = frustumPlanes();
+  for (const auto scale : BenchmarkScales) {
+    auto boundingInfos = randomBoundingInfos(scale);
+    std::vector<uint8_t> results(scale);
+    for (const auto strategy : {Constants::MESHES_CULLINGSTRATEGY_STANDARD,
+                                Constants::MESHES_CULLINGSTRATEGY_BOUNDINGSPHERE_ONLY}) {
+      const auto suffix
+        = strategy == Constants::MESHES_CULLINGSTRATEGY_STANDARD ? "" : " (sphere only)";
+      measure(std::string("BoundingInfo::isInFrustum") + suffix, scale, [&]() {
+        for (size_t i = 0; i < scale; ++i) {
+          results[i] = boundingInfos[i].isInFrustum(planes, strategy) ? 1 : 0;
+        }
+        doNotOptimize(results);
+      });
+
+      CullingStore store;
+      store.resize(scale);
+      for (size_t i = 0; i < scale; ++i) {
+        store.set(i, boundingInfos[i], strategy);
+      }
+      measure(std::string("CullingStore::isInFrustum") + suffix, scale, [&]() {
+        store.isInFrustum(planes, results.data());
+        doNotOptimize(results);
+      });
+    }
+  }
+}
+
+TEST(BenchmarkOctree, select)
+{
+  using namespace BABYLON;
+
+  const auto planes = BenchmarkCulling::frustumPlanes();
+  for (const auto scale : {size_t(1000), size_t(10000)}) {
+    auto engine       = createBenchmarkEngine();
+    auto scene        = Scene::New(engine.get());
+    const auto values = randomFloats(scale * 3, -100.f, 100.f);
+    for (size_t i = 0; i < scale; ++i) {
+      auto box = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+      box->position().set(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+      box->computeWorldMatrix(true);
+    }
+
+    auto octree = scene->createOrUpdateSelectionOctree(64, 2);
+    measure("Octree::select", scale, [&]() { doNotOptimize(octree->select(planes, false)); });
+
+    measure("Scene::createOrUpdateSelectionOctree", scale,
+            [&]() { doNotOptimize(scene->createOrUpdateSelectionOctree(64, 2)); }, 5);
+  }
+}
@@ -1,7 +1,37 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "benchmark_utils.h"
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleMock(&argc, argv);
-  return RUN_ALL_TESTS();
+
+  // --benchmark_out=<file> writes the results as JSON
+  // --benchmark_frames=<count> sets the number of frames rendered by the frame benchmarks
+  std::string outputPath;
+  static constexpr const char* OutputFlag = "--benchmark_out=";
+  static constexpr const char* FramesFlag = "--benchmark_frames=";
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], OutputFlag, std::strlen(OutputFlag)) == 0) {
+      outputPath = argv[i] + std::strlen(OutputFlag);
+    }
+    else if (std::strncmp(argv[i], FramesFlag, std::strlen(FramesFlag)) == 0) {
+      BABYLON::BenchmarkReporter::Instance().frameCount
+        = std::max<unsigned long>(1, std::strtoul(argv[i] + std::strlen(FramesFlag), nullptr, 10));
+    }
+  }
+
+  const auto result = RUN_ALL_TESTS();
+
+  if (!outputPath.empty() && !BABYLON::BenchmarkReporter::Instance().writeJson(outputPath)) {
+    std::cerr << "Could not write the benchmark results to " << outputPath << std::endl;
+    return 1;
+  }
+
+  return result;
 }
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace BenchmarkMatrix {
+
+/**
+ * @brief Returns count random scale / rotation / translation matrices.
+ */
+std::vector<BABYLON::Matrix> randomMatrices(size_t count, uint32_t seed)
+{
+  using namespace BABYLON;
+
+  const auto values = randomFloats(count * 9, -1.f, 1.f, seed);
+  std::vector<Matrix> matrices(count);
+  for (size_t i = 0; i < count; ++i) {
+    const auto v = &values[i * 9];
+    matrices[i]  = Matrix::Compose(Vector3(1.5f + v[0], 1.5f + v[1], 1.5f + v[2]),
+                                  Quaternion::RotationYawPitchRoll(v[3] * 3.14f, v[4] * 3.14f,
+                                                                   v[5] * 3.14f),
+                                  Vector3(v[6] * 100.f, v[7] * 100.f, v[8] * 100.f));
+  }
+  return matrices;
+}
+
+} // end of namespace BenchmarkMatrix
+
+TEST(BenchmarkMatrix, multiply)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkMatrix;
+
+  for (const auto scale : BenchmarkScales) {
+    auto left        = randomMatrices(scale, BenchmarkSeed);
+    const auto right = randomMatrices(scale, BenchmarkSeed + 1);
+    std::vector<Matrix> results(scale);
+    measure("Matrix::multiplyToRef", scale, [&]() {
+      for (size_t i = 0; i < scale; ++i) {
+        left[i].multiplyToRef(right[i], results[i]);
+      }
+      doNotOptimize(results);
+    });
+
+    Float32Array array(scale * 16);
+    for (size_t i = 0; i < scale; ++i) {
+      left[i].copyToArray(array, static_cast<unsigned int>(i * 16));
+    }
+    Float32Array arrayResult(scale * 16);
+    measure("Matrix::MultiplyArrayToRef", scale, [&]() {
+      Matrix::MultiplyArrayToRef(array, right[0], arrayResult, scale);
+      doNotOptimize(arrayResult);
+    });
+  }
+}
+
+TEST(BenchmarkMatrix, invert)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkMatrix;
+
+  for (const auto scale : BenchmarkScales) {
+    const auto matrices = randomMatrices(scale, BenchmarkSeed);
+    std::vector<Matrix> results(scale);
+    measure("Matrix::invertToRef", scale, [&]() {
+      for (size_t i = 0; i < scale; ++i) {
+        matrices[i].invertToRef(results[i]);
+      }
+      doNotOptimize(results);
+    });
+  }
+}
+
+TEST(BenchmarkMatrix, decompose)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkMatrix;
+
+  for (const auto scale : BenchmarkScales) {
+    const auto matrices = randomMatrices(scale, BenchmarkSeed);
+    std::optional<Vector3> scaling = Vector3::Zero(), translation = Vector3::Zero();
+    std::optional<Quaternion> rotation = Quaternion::Identity();
+    measure("Matrix::decompose", scale, [&]() {
+      for (size_t i = 0; i < scale; ++i) {
+        matrices[i].decompose(scaling, rotation, translation);
+      }
+      doNotOptimize(rotation);
+    });
+
+    std::vector<Matrix> results(scale);
+    measure("Matrix::ComposeToRef", scale, [&]() {
+      for (size_t i = 0; i < scale; ++i) {
+        Matrix::ComposeToRef(*scaling, *rotation, *translation, results[i]);
+      }
+      doNotOptimize(results);
+    });
+  }
+}
+
+TEST(BenchmarkVector3, transformCoordinates)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkMatrix;
+
+  const auto transformation = randomMatrices(1, BenchmarkSeed).front();
+  for (const auto scale : BenchmarkScales) {
+    const auto positions = randomFloats(scale * 3, -100.f, 100.f);
+    Float32Array results(scale * 3);
+    Vector3 result;
+    measure("Vector3::TransformCoordinatesFromFloatsToRef", scale, [&]() {
+      for (size_t i = 0; i < scale * 3; i += 3) {
+        Vector3::TransformCoordinatesFromFloatsToRef(positions[i], positions[i + 1],
+                                                     positions[i + 2], transformation, result);
+        results[i] = result.x;
+      }
+      doNotOptimize(results);
+    });
+
+    measure("Vector3::TransformCoordinatesArrayToRef", scale, [&]() {
+      Vector3::TransformCoordinatesArrayToRef(positions, transformation, results);
+      doNotOptimize(results);
+    });
+
+    measure("Vector3::TransformNormalToRef", scale, [&]() {
+      for (size_t i = 0; i < scale * 3; i += 3) {
+        Vector3::TransformNormalToRef(Vector3(positions[i], positions[i + 1], positions[i + 2]),
+                                      transformation, result);
+        results[i] = result.x;
+      }
+      doNotOptimize(results);
+    });
+  }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/indices_optimizer.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/meshes/vertex_welder.h>
+
+namespace BenchmarkMesh {
+
+/**
+ * @brief Returns a grid of at least vertexCount vertices with randomly jittered heights.
+ */
+void jitteredGrid(size_t vertexCount, BABYLON::Float32Array& positions,
+                  BABYLON::Uint32Array& indices)
+{
+  const auto side
+    = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(vertexCount))));
+  const auto heights = BABYLON::randomFloats(side * side, -0.5f, 0.5f);
+
+  positions.clear();
+  positions.reserve(side * side * 3);
+  for (uint32_t row = 0; row < side; ++row) {
+    for (uint32_t col = 0; col < side; ++col) {
+      positions.insert(positions.end(), {static_cast<float>(col), heights[row * side + col],
+                                         static_cast<float>(row)});
+    }
+  }
+
+  indices.clear();
+  indices.reserve((side - 1) * (side - 1) * 6);
+  for (uint32_t row = 0; row + 1 < side; ++row) {
+    for (uint32_t col = 0; col + 1 < side; ++col) {
+      const auto i = row * side + col;
+      indices.insert(indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+    }
+  }
+}
+
+} // end of namespace BenchmarkMesh
+
+TEST(BenchmarkVertexData, ComputeNormals)
+{
+  using namespace BABYLON;
+
+  for (const auto scale : BenchmarkScales) {
+    Float32Array positions;
+    Uint32Array indices;
+    BenchmarkMesh::jitteredGrid(scale, positions, indices);
+    Float32Array normals(positions.size());
+    measure("VertexData::ComputeNormals", scale, [&]() {
+      VertexData::ComputeNormals(positions, indices, normals);
+      doNotOptimize(normals);
+    });
+  }
+}
+
+TEST(BenchmarkVertexWelder, Weld)
+{
+  using namespace BABYLON;
+
+  for (const auto scale : BenchmarkScales) {
+    // Flat shaded grid: each vertex is shared by up to 6 triangles
+    Float32Array gridPositions, positions;
+    Uint32Array indices;
+    BenchmarkMesh::jitteredGrid(scale / 6, gridPositions, indices);
+    positions.reserve(indices.size() * 3);
+    for (const auto index : indices) {
+      positions.insert(positions.end(), &gridPositions[index * 3], &gridPositions[index * 3 + 3]);
+    }
+    const auto vertexCount = positions.size() / 3;
+    for (const auto parallel : {false, true}) {
+      VertexWelderOptions options;
+      options.parallel = parallel;
+      measure(parallel ? "VertexWelder::Weld (parallel)" : "VertexWelder::Weld", vertexCount,
+              [&]() { doNotOptimize(VertexWelder::Weld(positions, options)); });
+    }
+  }
+}
+
+TEST(BenchmarkIndicesOptimizer, Optimize)
+{
+  using namespace BABYLON;
+
+  for (const auto scale : BenchmarkScales) {
+    Float32Array positions;
+    Uint32Array indices;
+    BenchmarkMesh::jitteredGrid(scale, positions, indices);
+    const auto trianglesCount = indices.size() / 3;
+    measure("IndicesOptimizer::OptimizeVertexCache", trianglesCount, [&]() {
+      auto optimized = indices;
+      IndicesOptimizer::OptimizeVertexCache(optimized, 0, optimized.size());
+      doNotOptimize(optimized);
+    });
+    measure("IndicesOptimizer::OptimizeOverdraw", trianglesCount, [&]() {
+      auto optimized = indices;
+      IndicesOptimizer::OptimizeOverdraw(optimized, 0, optimized.size(), positions);
+      doNotOptimize(optimized);
+    });
+  }
+}
+
+TEST(BenchmarkMesh, MergeMeshes)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  // Scale is the number of merged meshes, each one made of 24 vertices
+  for (const auto scale : {size_t(100), size_t(1000)}) {
+    const auto values = randomFloats(scale * 3, -100.f, 100.f);
+    std::vector<MeshPtr> meshes;
+    meshes.reserve(scale);
+    for (size_t i = 0; i < scale; ++i) {
+      auto box = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+      box->position().set(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+      meshes.emplace_back(box);
+    }
+
+    measure("Mesh::MergeMeshes", scale, [&]() {
+      auto merged = Mesh::MergeMeshes(meshes, false);
+      doNotOptimize(merged);
+      merged->dispose();
+    }, 5);
+
+    for (const auto& mesh : meshes) {
+      mesh->dispose();
+    }
+  }
+}
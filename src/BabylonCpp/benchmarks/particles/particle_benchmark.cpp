@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_store.h>
+#include <babylon/particles/particle_system.h>
+
+namespace BenchmarkParticles {
+
+/**
+ * @brief Fills a store with count particles moving in random directions, living long enough to
+ * survive all the runs.
+ */
+void fillStore(BABYLON::ParticleStore& store, BABYLON::ParticleSystem& particleSystem,
+               size_t count)
+{
+  using namespace BABYLON;
+
+  const auto values = randomFloats(count * 4, -1.f, 1.f);
+  store.setCapacity(count);
+  store.clear();
+  Particle particle(&particleSystem);
+  particle.lifeTime  = 1e9f;
+  particle.size      = 1.f;
+  particle.colorStep = Color4(-1e-9f, -1e-9f, -1e-9f, -1e-9f);
+  for (size_t i = 0; i < count; ++i) {
+    const auto v = &values[i * 4];
+    particle.direction.copyFromFloats(v[0], v[1], v[2]);
+    particle.color        = Color4(1.f, 1.f, 1.f, 1.f);
+    particle.angularSpeed = v[3];
+    store.add(particle, v[3] * 0.5f + 0.5f);
+  }
+}
+
+} // end of namespace BenchmarkParticles
+
+TEST(BenchmarkParticleStore, update)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkParticles;
+
+  auto engine = createBenchmarkEngine();
+  ParticleSystem particleSystem("particles", 1, static_cast<ThinEngine*>(engine.get()));
+
+  ParticleStoreUpdate update;
+  update.updateSpeed = 0.01f;
+  update.gravity     = Vector3(0.f, -9.81f, 0.f);
+
+  auto scales = BenchmarkScales;
+  scales.emplace_back(1000000);
+  for (const auto scale : scales) {
+    ParticleStore store;
+    fillStore(store, particleSystem, scale);
+
+    measure("ParticleStore::update", scale, [&]() {
+      store.update(update);
+      doNotOptimize(store.removeDeadParticles());
+    });
+
+    // Chunks of the size used by ParticleSystem::_simulateAnimate
+    auto& threadPool = ThreadPool::Default();
+    measure("ParticleStore::update (threads)", scale, [&]() {
+      threadPool.parallelFor(store.size(), 16384,
+                             [&](size_t begin, size_t end) { store.update(update, begin, end); });
+      doNotOptimize(store.removeDeadParticles());
+    });
+
+    store.setColorGradients({ColorGradient(0.f, Color4(1.f, 0.f, 0.f, 1.f)),
+                             ColorGradient(1.f, Color4(0.f, 0.f, 1.f, 0.f))});
+    store.setSizeGradients({FactorGradient(0.f, 1.f, 2.f), FactorGradient(1.f, 0.f)});
+    store.setDragGradients({FactorGradient(0.f, 0.f), FactorGradient(1.f, 0.5f)});
+    measure("ParticleStore::update (gradients)", scale, [&]() {
+      store.update(update);
+      doNotOptimize(store.removeDeadParticles());
+    });
+
+    ParticleStoreVertexLayout layout;
+    layout.vertexSize    = 10;
+    layout.useInstancing = true;
+    Float32Array vertexData(scale * layout.vertexSize);
+    measure("ParticleStore::fillVertexData", scale, [&]() {
+      store.fillVertexData(vertexData.data(), layout);
+      doNotOptimize(vertexData);
+    });
+  }
+}
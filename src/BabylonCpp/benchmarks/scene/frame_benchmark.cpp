@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/engine_instrumentation.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/iparticle_system.h>
+#include <babylon/particles/particle_helper.h>
+
+namespace BenchmarkFrame {
+
+/**
+ * @brief Parameters of a synthetic scene.
+ */
+struct SceneParameters {
+  std::string name;
+  size_t meshCount;
+  size_t instanceCount;
+  size_t skeletonCount;
+  size_t particleCount;
+  size_t materialCount;
+  size_t renderTargetCount;
+}; // end of struct SceneParameters
+
+static const std::vector<SceneParameters> Scenes{
+  // name, meshes, instances, skeletons, particles, materials, render targets
+  {"meshes", 1000, 0, 0, 0, 4, 0},
+  {"instances", 50, 5000, 0, 0, 4, 0},
+  {"skeletons", 20, 0, 50, 0, 4, 0},
+  {"particles", 20, 0, 0, 10000, 4, 0},
+  {"materials", 1000, 0, 0, 0, 64, 0},
+  {"renderTargets", 200, 0, 0, 0, 4, 2},
+  {"mixed", 500, 2000, 20, 5000, 16, 1},
+};
+
+/**
+ * Number of frames rendered before the measurements, so that the effects are compiled
+ */
+static constexpr size_t WarmUpFrameCount = 10;
+
+/**
+ * Number of bones of each skeleton, organized as a chain
+ */
+static constexpr size_t BoneCount = 16;
+
+/**
+ * @brief Creates materialCount standard materials covering different sets of defines.
+ */
+std::vector<BABYLON::MaterialPtr> createMaterials(BABYLON::Scene* scene, size_t materialCount)
+{
+  using namespace BABYLON;
+
+  const auto colors = randomFloats(materialCount * 3, 0.f, 1.f);
+  std::vector<MaterialPtr> materials;
+  for (size_t i = 0; i < materialCount; ++i) {
+    auto material             = StandardMaterial::New("material" + std::to_string(i), scene);
+    material->diffuseColor    = Color3(colors[i * 3], colors[i * 3 + 1], colors[i * 3 + 2]);
+    material->specularPower   = 16.f + static_cast<float>(i % 8) * 16.f;
+    material->disableLighting = (i % 3 == 2);
+    material->backFaceCulling = (i % 5 != 4);
+    if (i % 4 == 3) {
+      material->alpha = 0.5f;
+    }
+    materials.emplace_back(material);
+  }
+  return materials;
+}
+
+/**
+ * @brief Creates a skeleton made of a chain of bones, each bone swinging back and forth.
+ */
+BABYLON::SkeletonPtr createSkeleton(BABYLON::Scene* scene, size_t index)
+{
+  using namespace BABYLON;
+
+  auto skeleton = Skeleton::New("skeleton" + std::to_string(index),
+                                "skeleton" + std::to_string(index), scene);
+  auto local    = Matrix::Translation(0.f, 0.5f, 0.f);
+  Bone* parent  = nullptr;
+  for (size_t i = 0; i < BoneCount; ++i) {
+    auto bone      = Bone::New("bone" + std::to_string(i), skeleton.get(), parent, local, local,
+                               local, static_cast<int>(i));
+    auto animation = Animation::New("swing", "_matrix", 30, Animation::ANIMATIONTYPE_MATRIX,
+                                    Animation::ANIMATIONLOOPMODE_CYCLE);
+    animation->setKeys({
+      IAnimationKey(0.f, AnimationValue(local)),
+      IAnimationKey(15.f, AnimationValue(Matrix::RotationZ(0.3f).multiply(local))),
+      IAnimationKey(30.f, AnimationValue(local)),
+    });
+    bone->animations.emplace_back(animation);
+    parent = bone.get();
+  }
+  return skeleton;
+}
+
+/**
+ * @brief Creates a cylinder skinned on a skeleton, each ring of vertices following one bone.
+ */
+BABYLON::MeshPtr createSkinnedMesh(BABYLON::Scene* scene, const BABYLON::SkeletonPtr& skeleton,
+                                   size_t index)
+{
+  using namespace BABYLON;
+
+  const auto height = static_cast<float>(BoneCount) * 0.5f;
+  CylinderOptions options;
+  options.height       = height;
+  options.subdivisions = static_cast<unsigned int>(BoneCount);
+
+  auto mesh = MeshBuilder::CreateCylinder("skinned" + std::to_string(index), options, scene);
+
+  const auto positions   = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto vertexCount = positions.size() / 3;
+  Float32Array matricesIndices(vertexCount * 4, 0.f);
+  Float32Array matricesWeights(vertexCount * 4, 0.f);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto boneIndex = std::min(
+      static_cast<size_t>((positions[i * 3 + 1] / height + 0.5f) * static_cast<float>(BoneCount)),
+      BoneCount - 1);
+    matricesIndices[i * 4] = static_cast<float>(boneIndex);
+    matricesWeights[i * 4] = 1.f;
+  }
+  mesh->setVerticesData(VertexBuffer::MatricesIndicesKind, matricesIndices, false);
+  mesh->setVerticesData(VertexBuffer::MatricesWeightsKind, matricesWeights, false);
+  mesh->skeleton = skeleton;
+  return mesh;
+}
+
+/**
+ * @brief Builds the synthetic scene described by the parameters. Every mesh and skeleton is
+ * animated, the particle systems emit enough particles to reach the requested count.
+ */
+void createScene(BABYLON::Scene* scene, const SceneParameters& parameters)
+{
+  using namespace BABYLON;
+
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 40.f, -160.f), scene);
+  camera->setTarget(Vector3::Zero());
+  scene->activeCamera = camera;
+  HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f), scene);
+
+  const auto materials = createMaterials(scene, std::max<size_t>(parameters.materialCount, 1));
+  const auto values    = randomFloats((parameters.meshCount + parameters.instanceCount) * 3,
+                                   -100.f, 100.f);
+
+  auto spin = Animation::New("spin", "rotation.y", 30, Animation::ANIMATIONTYPE_FLOAT,
+                             Animation::ANIMATIONLOOPMODE_CYCLE);
+  spin->setKeys({
+    IAnimationKey(0.f, AnimationValue(0.f)),
+    IAnimationKey(60.f, AnimationValue(Math::PI2)),
+  });
+
+  std::vector<MeshPtr> meshes;
+  for (size_t i = 0; i < parameters.meshCount; ++i) {
+    const auto name = "mesh" + std::to_string(i);
+    MeshPtr mesh    = nullptr;
+    if (i % 2 == 0) {
+      mesh = Mesh::CreateBox(name, 2.f, scene);
+    }
+    else {
+      SphereOptions options;
+      options.diameter = 2.f;
+      options.segments = 8;
+      mesh             = MeshBuilder::CreateSphere(name, options, scene);
+    }
+    mesh->position().set(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+    mesh->material = materials[i % materials.size()];
+    mesh->animations.emplace_back(spin);
+    scene->beginAnimation(mesh, 0.f, 60.f, true);
+    meshes.emplace_back(mesh);
+  }
+
+  for (size_t i = 0; i < parameters.instanceCount && !meshes.empty(); ++i) {
+    auto instance = meshes[i % meshes.size()]->createInstance("instance" + std::to_string(i));
+    const auto v  = &values[(parameters.meshCount + i) * 3];
+    instance->position().set(v[0], v[1], v[2]);
+  }
+
+  for (size_t i = 0; i < parameters.skeletonCount; ++i) {
+    auto skeleton = createSkeleton(scene, i);
+    auto mesh     = createSkinnedMesh(scene, skeleton, i);
+    mesh->position().set(static_cast<float>(i % 10) * 6.f - 30.f, -10.f,
+                         static_cast<float>(i / 10) * 6.f);
+    mesh->material = materials[i % materials.size()];
+    scene->beginAnimation(skeleton, 0.f, 30.f, true);
+  }
+
+  if (parameters.particleCount > 0) {
+    auto particleSystem
+      = ParticleHelper::CreateDefault(Vector3::Zero(), parameters.particleCount, scene);
+    // The default life time is one second
+    particleSystem->emitRate = static_cast<int>(parameters.particleCount);
+    scene->addParticleSystem(particleSystem);
+    particleSystem->start();
+  }
+
+  for (size_t i = 0; i < parameters.renderTargetCount; ++i) {
+    auto renderTarget = RenderTargetTexture::New("renderTarget" + std::to_string(i), 256, scene);
+    for (size_t j = i; j < meshes.size(); j += parameters.renderTargetCount) {
+      renderTarget->renderList().emplace_back(meshes[j].get());
+    }
+    scene->customRenderTargets.emplace_back(renderTarget);
+  }
+}
+
+} // end of namespace BenchmarkFrame
+
+TEST(BenchmarkScene, render)
+{
+  using namespace BABYLON;
+  using namespace BenchmarkFrame;
+
+  const auto frameCount = BenchmarkReporter::Instance().frameCount;
+  for (const auto& parameters : Scenes) {
+    auto engine = createBenchmarkEngine();
+    auto scene  = Scene::New(engine.get());
+    createScene(scene.get(), parameters);
+
+    SceneInstrumentation sceneInstrumentation(scene.get());
+    sceneInstrumentation.captureActiveMeshesEvaluationTime = true;
+    sceneInstrumentation.captureAnimationsTime             = true;
+    sceneInstrumentation.captureRenderTargetsRenderTime    = true;
+    sceneInstrumentation.captureParticlesRenderTime        = true;
+    sceneInstrumentation.captureRenderTime                 = true;
+    sceneInstrumentation.captureCameraRenderTime           = true;
+    sceneInstrumentation.captureFrameTime                  = true;
+    EngineInstrumentation engineInstrumentation(engine.get());
+    engineInstrumentation.captureShaderCompilationTime = true;
+
+    for (size_t i = 0; i < WarmUpFrameCount; ++i) {
+      scene->render();
+    }
+
+    // Per frame values of each phase, the draw submission is the main draw phase
+    const std::vector<std::pair<std::string, PerfCounter*>> phases{
+      {"activeMeshesEvaluation", &sceneInstrumentation.activeMeshesEvaluationTimeCounter()},
+      {"animations", &sceneInstrumentation.animationsTimeCounter()},
+      {"renderTargets", &sceneInstrumentation.renderTargetsRenderTimeCounter()},
+      {"particles", &sceneInstrumentation.particlesRenderTimeCounter()},
+      {"drawSubmission", &sceneInstrumentation.renderTimeCounter()},
+      {"cameraRender", &sceneInstrumentation.cameraRenderTimeCounter()},
+      {"instrumentedFrame", &sceneInstrumentation.frameTimeCounter()},
+    };
+    std::vector<double> frameTimes(frameCount), phaseTotals(phases.size(), 0.0);
+    double drawCalls = 0.0;
+    for (auto& frameTime : frameTimes) {
+      using Clock      = std::chrono::steady_clock;
+      const auto start = Clock::now();
+      scene->render();
+      frameTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      for (size_t i = 0; i < phases.size(); ++i) {
+        phaseTotals[i] += phases[i].second->current();
+      }
+      drawCalls += sceneInstrumentation.drawCallsCounter().current();
+    }
+
+    const auto frames = static_cast<double>(frameCount);
+    FrameBenchmarkResult result;
+    result.name       = parameters.name;
+    result.parameters = {{"meshes", parameters.meshCount},
+                         {"instances", parameters.instanceCount},
+                         {"skeletons", parameters.skeletonCount},
+                         {"particles", parameters.particleCount},
+                         {"materials", parameters.materialCount},
+                         {"renderTargets", parameters.renderTargetCount}};
+    result.frames     = frameCount;
+    result.meanMs     = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0) / frames;
+    result.p50Ms      = percentile(frameTimes, 50.0);
+    result.p99Ms      = percentile(frameTimes, 99.0);
+    result.drawCalls  = drawCalls / frames;
+    for (size_t i = 0; i < phases.size(); ++i) {
+      result.phasesMs.emplace_back(phases[i].first, phaseTotals[i] / frames);
+    }
+    result.phasesMs.emplace_back("shaderCompilationTotal",
+                                 engineInstrumentation.shaderCompilationTimeCounter().total());
+    BenchmarkReporter::Instance().add(result);
+
+    EXPECT_GT(result.drawCalls, 0.0) << parameters.name;
+
+    sceneInstrumentation.dispose();
+    engineInstrumentation.dispose();
+    scene->dispose();
+  }
+}
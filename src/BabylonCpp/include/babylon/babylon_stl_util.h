@@ -1,6 +1,7 @@
 #ifndef BABYLON_STL_UTIL_H
 #define BABYLON_STL_UTIL_H
 
+#include <algorithm>
 #include <bitset>
 #include <cstring>
 #include <functional>
@@ -719,10 +720,11 @@ inline void remove_vector_elements_equal_ptr_wrapped(SharePtrVectorWrapper& wrap
 //////////////////////////////////////////
 
 template <typename Container, typename JsStyleSortFunction>
-void sort_js_style(Container container, JsStyleSortFunction fn)
+void sort_js_style(Container& container, JsStyleSortFunction fn)
 {
-  auto predicateFunction = [fn](auto a, auto b) { return fn(a, b) < 0; };
-  std::sort(container.begin(), container.end(), predicateFunction);
+  // Array.prototype.sort is stable: the elements comparing equal keep their order
+  auto predicateFunction = [&fn](const auto& a, const auto& b) { return fn(a, b) < 0; };
+  std::stable_sort(container.begin(), container.end(), predicateFunction);
 }
 
 template <typename C, typename T>
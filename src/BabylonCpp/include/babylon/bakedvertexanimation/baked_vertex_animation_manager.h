@@ -0,0 +1,166 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/interfaces/idisposable.h>
+#include <babylon/maths/vector4.h>
+
+namespace BABYLON {
+
+class Effect;
+class InstancedMesh;
+class Mesh;
+class Scene;
+FWD_CLASS_SPTR(BakedVertexAnimationManager)
+FWD_CLASS_SPTR(BaseTexture)
+
+/**
+ * @brief This class is used to animate meshes using a baked vertex animation texture.
+ *
+ * The texture holds the skin matrices of the skeleton of the mesh for each baked frame (see
+ * VertexAnimationBaker), one row per frame. The frames played are selected with a vec4 (start
+ * frame, end frame, frame offset, frames per second) in texture rows: animationParameters for the
+ * mesh itself, or the "bakedVertexAnimationSettingsInstanced" instanced attribute for instances
+ * and thin instances, so that each instance plays its own animation without any per instance
+ * skeleton evaluation on the CPU.
+ * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+ */
+class BABYLON_SHARED_EXPORT BakedVertexAnimationManager : public IDisposable {
+
+public:
+  /**
+   * The name of the instanced attribute holding the animation parameters of each instance.
+   */
+  static constexpr const char* AnimationSettingsInstancedKind
+    = "bakedVertexAnimationSettingsInstanced";
+
+public:
+  template <typename... Ts>
+  static BakedVertexAnimationManagerPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<BakedVertexAnimationManager>(
+      new BakedVertexAnimationManager(std::forward<Ts>(args)...));
+  }
+  ~BakedVertexAnimationManager() override; // = default
+
+  /**
+   * @brief Sets animation parameters.
+   * @param startFrame The first frame of the animation.
+   * @param endFrame The last frame of the animation.
+   * @param offset The offset when starting the animation.
+   * @param speedFramesPerSecond The frame rate.
+   */
+  void setAnimationParameters(float startFrame, float endFrame, float offset = 0.f,
+                              float speedFramesPerSecond = 30.f);
+
+  /**
+   * @brief Binds to the effect.
+   * @param effect The effect to bind to.
+   * @param useInstances True when it's an instance.
+   */
+  void bind(Effect* effect, bool useInstances = false);
+
+  /**
+   * @brief Clone the current manager.
+   * @returns a new BakedVertexAnimationManager
+   */
+  [[nodiscard]] BakedVertexAnimationManagerPtr clone() const;
+
+  /**
+   * @brief Disposes the resources of the manager.
+   * @param doNotRecurse unused
+   * @param forceDisposeTextures defines if the texture must be disposed as well
+   */
+  void dispose(bool doNotRecurse = false, bool forceDisposeTextures = false) override;
+
+  /**
+   * @brief Get the current class name useful for serialization or dynamic coding.
+   * @returns "BakedVertexAnimationManager"
+   */
+  [[nodiscard]] std::string getClassName() const;
+
+  /**
+   * @brief Registers the instanced attribute holding the animation parameters of each instance on
+   * a mesh, for its instances (InstancedMesh) and, when it has some, its thin instances.
+   * @param mesh defines the mesh to register the attribute on
+   */
+  static void RegisterInstancedAttributes(Mesh& mesh);
+
+  /**
+   * @brief Sets the animation parameters of an instance.
+   * @param instance defines the instance of a mesh on which RegisterInstancedAttributes was called
+   * @param startFrame The first frame of the animation.
+   * @param endFrame The last frame of the animation.
+   * @param offset The offset when starting the animation.
+   * @param speedFramesPerSecond The frame rate.
+   */
+  static void SetInstanceAnimationParameters(InstancedMesh& instance, float startFrame,
+                                             float endFrame, float offset = 0.f,
+                                             float speedFramesPerSecond = 30.f);
+
+  /**
+   * @brief Sets the animation parameters of a thin instance.
+   * @param mesh defines the mesh on which RegisterInstancedAttributes was called
+   * @param index defines the index of the thin instance
+   * @param startFrame The first frame of the animation.
+   * @param endFrame The last frame of the animation.
+   * @param offset The offset when starting the animation.
+   * @param speedFramesPerSecond The frame rate.
+   * @param refresh true to refresh the underlying gpu buffer (default: true)
+   * @returns true if the parameters were set
+   */
+  static bool SetThinInstanceAnimationParameters(Mesh& mesh, size_t index, float startFrame,
+                                                 float endFrame, float offset = 0.f,
+                                                 float speedFramesPerSecond = 30.f,
+                                                 bool refresh = true);
+
+protected:
+  /**
+   * @brief Creates a new BakedVertexAnimationManager.
+   * @param scene defines the current scene
+   */
+  BakedVertexAnimationManager(Scene* scene = nullptr);
+
+  BaseTexturePtr& get_texture();
+  void set_texture(const BaseTexturePtr& value);
+  bool get_isEnabled() const;
+  void set_isEnabled(bool value);
+
+private:
+  void _markSubMeshesAsAttributesDirty();
+
+public:
+  /**
+   * The vertex animation texture
+   */
+  Property<BakedVertexAnimationManager, BaseTexturePtr> texture;
+
+  /**
+   * Enable or disable the vertex animation manager
+   */
+  Property<BakedVertexAnimationManager, bool> isEnabled;
+
+  /**
+   * The animation parameters for the mesh. See setAnimationParameters()
+   */
+  Vector4 animationParameters;
+
+  /**
+   * The time counter, to pick the correct animation frame.
+   */
+  float time;
+
+private:
+  Scene* _scene;
+  BaseTexturePtr _texture;
+  bool _isEnabled;
+
+}; // end of class BakedVertexAnimationManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
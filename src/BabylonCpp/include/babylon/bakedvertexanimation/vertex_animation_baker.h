@@ -0,0 +1,84 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/maths/isize.h>
+
+namespace BABYLON {
+
+class AnimationRange;
+class Mesh;
+class Scene;
+FWD_CLASS_SPTR(RawTexture)
+
+/**
+ * @brief Class to bake vertex animation textures.
+ *
+ * Each frame of the given animation ranges is sampled from the skeleton of the mesh and its skin
+ * matrices are stored in one row of a float RGBA texture, 4 texels per matrix and (bones + 1)
+ * matrices per row. The ranges are stored one after the other: the first frame of a range is the
+ * sum of the frame counts of the ranges before it, which is the start frame to use in the
+ * BakedVertexAnimationManager parameters.
+ * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+ */
+class BABYLON_SHARED_EXPORT VertexAnimationBaker {
+
+public:
+  /**
+   * @brief Create a new VertexAnimationBaker object which can help baking animations into a
+   * texture.
+   * @param scene Defines the scene the VAT belongs to
+   * @param mesh Defines the mesh the VAT belongs to
+   */
+  VertexAnimationBaker(Scene* scene, Mesh* mesh);
+  VertexAnimationBaker(const VertexAnimationBaker& other) = delete;
+  VertexAnimationBaker& operator=(const VertexAnimationBaker& other) = delete;
+  ~VertexAnimationBaker(); // = default
+
+  /**
+   * @brief Bakes the animation into the texture. This should be called once, when the scene
+   * starts, so the VAT is generated and associated to the mesh.
+   * @param ranges Defines the ranges in the animation that will be baked.
+   * @returns the vertex data (skin matrices of all the frames)
+   * @throws std::runtime_error if the mesh has no skeleton or if a range is invalid
+   */
+  Float32Array bakeVertexData(const std::vector<AnimationRange>& ranges);
+
+  /**
+   * @brief Builds a vertex animation texture given the vertexData in an array.
+   * @param vertexData The vertex animation data. You can generate it with bakeVertexData().
+   * @returns The vertex animation texture to be used with BakedVertexAnimationManager.
+   */
+  RawTexturePtr textureFromBakedVertexData(const Float32Array& vertexData);
+
+  /**
+   * @brief Gets the number of frames stored for the given ranges, which is the height of the
+   * vertex animation texture.
+   * @param ranges Defines the ranges in the animation.
+   * @returns the number of frames
+   */
+  static size_t FrameCount(const std::vector<AnimationRange>& ranges);
+
+  /**
+   * @brief Gets the size of the vertex animation texture storing the given vertex data: 4 texels
+   * per matrix and (bones + 1) matrices per row, one row per frame.
+   * @param boneCount Defines the number of bones of the skeleton.
+   * @param vertexDataSize Defines the size of the vertex data. You can generate it with
+   * bakeVertexData().
+   * @returns the width and the height of the texture
+   */
+  static ISize TextureSize(size_t boneCount, size_t vertexDataSize);
+
+private:
+  Scene* _scene;
+  Mesh* _mesh;
+
+}; // end of class VertexAnimationBaker
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
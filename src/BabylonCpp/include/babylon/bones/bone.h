@@ -607,9 +607,9 @@ public:
   Property<Bone, std::optional<Vector3>> scaling;
 
 private:
-  static std::array<Vector3, 2> _tmpVecs;
-  static Quaternion _tmpQuat;
-  static std::array<Matrix, 5> _tmpMats;
+  static thread_local std::array<Vector3, 2> _tmpVecs;
+  static thread_local Quaternion _tmpQuat;
+  static thread_local std::array<Matrix, 5> _tmpMats;
 
 private:
   Skeleton* _skeleton;
@@ -0,0 +1,84 @@
+#ifndef BABYLON_BONES_BONE_MATRIX_STORE_H
+#define BABYLON_BONES_BONE_MATRIX_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+
+namespace BABYLON {
+
+class Matrix;
+FWD_CLASS_SPTR(Bone)
+
+/**
+ * @brief Flat copy of the bones of a skeleton, sorted so that parents come before their children,
+ * used to compute the bone matrices in batches.
+ *
+ * Each frame, the local matrices and inverted absolute transforms of the bones are gathered in
+ * contiguous arrays, the world matrices are computed with MatrixKernels::multiplyHierarchy and the
+ * skin matrices (inverted absolute transform * world matrix) with MatrixKernels::multiplyPairs,
+ * straight into the target array when the bones are not remapped. The world matrices are written
+ * back to the bones. The layout is rebuilt when the bones or their parents change.
+ */
+class BABYLON_SHARED_EXPORT BoneMatrixStore {
+
+public:
+  BoneMatrixStore();
+  BoneMatrixStore(const BoneMatrixStore& other) = delete;
+  BoneMatrixStore& operator=(const BoneMatrixStore& other) = delete;
+  ~BoneMatrixStore(); // = default
+
+  /**
+   * @brief Gets the number of bones in the store.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Gets the index of the parent of each bone in the sorted order (-1 for the roots).
+   */
+  [[nodiscard]] const std::vector<int32_t>& parentIndices() const;
+
+  /**
+   * @brief Gets the index in the skeleton bones of each bone in the sorted order.
+   */
+  [[nodiscard]] const std::vector<size_t>& boneIndices() const;
+
+  /**
+   * @brief Computes the world matrices of the bones and writes the skin matrices in the target
+   * array, same as the loop over the Bone objects it replaces (see Skeleton::prepare).
+   * @param bones defines the bones of the skeleton
+   * @param targetMatrix defines the array receiving the skin matrices (16 * (bones + 1) floats)
+   * @param initialSkinMatrix defines the matrix applied to the root bones, if any
+   */
+  void computeTransformMatrices(const std::vector<BonePtr>& bones, Float32Array& targetMatrix,
+                                const std::optional<Matrix>& initialSkinMatrix);
+
+private:
+  bool _gather(const std::vector<BonePtr>& bones);
+  void _build(const std::vector<BonePtr>& bones);
+
+private:
+  // Sorted layout
+  std::vector<Bone*> _bones;
+  std::vector<Bone*> _parents;
+  std::vector<int32_t> _parentIndices;
+  std::vector<size_t> _boneIndices;
+  // Index of the skin matrix of each bone in the target array (-1 for none)
+  std::vector<int32_t> _targetIndices;
+  bool _identityTarget;
+  // Matrices, 16 floats per bone
+  std::vector<float> _localMatrices;
+  std::vector<float> _worldMatrices;
+  std::vector<float> _inverseMatrices;
+
+}; // end of class BoneMatrixStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_BONE_MATRIX_STORE_H
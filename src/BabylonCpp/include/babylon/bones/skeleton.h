@@ -18,6 +18,7 @@ using json = nlohmann::json;
 namespace BABYLON {
 
 class Animatable;
+class BoneMatrixStore;
 struct AnimationPropertiesOverride;
 class Scene;
 FWD_CLASS_SPTR(AbstractMesh)
@@ -174,6 +175,27 @@ public:
    */
   void prepare();
 
+  /**
+   * @brief Hidden
+   * First step of prepare, run on the render thread: updates the bones linked to transform nodes,
+   * allocates the matrices and textures and notifies onBeforeComputeObservable.
+   * @returns true if the matrices have to be computed (see _computePrepared)
+   */
+  bool _beginPrepare();
+
+  /**
+   * @brief Hidden
+   * Second step of prepare: computes the bone matrices. Different skeletons can be computed
+   * concurrently.
+   */
+  void _computePrepared();
+
+  /**
+   * @brief Hidden
+   * Last step of prepare, run on the render thread: uploads the matrix textures.
+   */
+  void _endPrepare();
+
   /**
    * @brief Gets the list of animatables currently running for this skeleton.
    * @returns an array of animatables
@@ -384,6 +406,8 @@ private:
   size_t _uniqueId;
   bool _useTextureToStoreBoneMatrices;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
+  // Hierarchy sorted copy of the bones used to compute the matrices
+  std::unique_ptr<BoneMatrixStore> _boneMatrixStore;
 
 }; // end of class Bone
 
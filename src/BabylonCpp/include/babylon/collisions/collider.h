@@ -8,6 +8,7 @@
 
 namespace BABYLON {
 
+class Plane;
 FWD_CLASS_SPTR(AbstractMesh)
 
 /**
@@ -46,16 +47,25 @@ public:
                      const Vector3& p2, const Vector3& p3, bool hasMaterial,
                      const AbstractMeshPtr& hostMesh);
   /** Hidden */
+  void _testTriangle(const Vector3& p1, const Vector3& p2, const Vector3& p3, bool hasMaterial,
+                     const AbstractMeshPtr& hostMesh);
+  /** Hidden */
   void _collide(std::vector<Plane>& trianglePlaneArray, const std::vector<Vector3>& pts,
                 const IndicesArray& indices, size_t indexStart, size_t indexEnd, unsigned int decal,
                 bool hasMaterial, const AbstractMeshPtr& hostMesh);
   /** Hidden */
   void _getResponse(Vector3& pos, Vector3& vel);
+  /** Hidden */
+  void _getSweptBoundsToRef(Vector3& minimum, Vector3& maximum) const;
 
 protected:
   [[nodiscard]] int get_collisionMask() const;
   void set_collisionMask(int mask);
 
+private:
+  void _testTriangle(const Plane& trianglePlane, const Vector3& p1, const Vector3& p2,
+                     const Vector3& p3, bool hasMaterial, const AbstractMeshPtr& hostMesh);
+
 public:
   /**
    * Define if a collision was found
@@ -3,15 +3,21 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/culling/bvh.h>
 #include <babylon/maths/vector3.h>
 
 namespace BABYLON {
 
 /**
  * @brief Hidden
+ * The meshes tested against the collider are selected with a bounding volume hierarchy over the
+ * world bounding boxes of all the collidable meshes of the scene, refitted when the meshes move.
+ * The excluded mesh and the collision mask, which change from one call to the next, only filter
+ * the candidates.
  */
 class BABYLON_SHARED_EXPORT DefaultCollisionCoordinator : public ICollisionCoordinator {
 
@@ -31,12 +37,22 @@ private:
   void _collideWithWorld(Vector3& position, Vector3& velocity, const ColliderPtr& collider,
                          unsigned int maximumRetry, Vector3& finalPosition,
                          const AbstractMeshPtr& excludedMesh = nullptr);
+  void _updateBroadphase();
 
 private:
   Scene* _scene;
   Vector3 _scaledPosition;
   Vector3 _scaledVelocity;
   Vector3 _finalPosition;
+  // Broadphase: collidable meshes in scene order, their world bounds and their hierarchy
+  std::vector<AbstractMesh*> _collidableMeshes;
+  std::vector<BVH::Bounds> _collidableBounds;
+  BVH _broadphase;
+  size_t _refitCount;
+  // Scratch lists
+  std::vector<AbstractMesh*> _newCollidableMeshes;
+  std::vector<BVH::Bounds> _newCollidableBounds;
+  std::vector<uint32_t> _candidates;
 
 }; // end of class DefaultCollisionCoordinator
 
@@ -0,0 +1,68 @@
+#ifndef BABYLON_CORE_MEMORY_MAPPED_FILE_H
+#define BABYLON_CORE_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class MemoryMappedFile;
+using MemoryMappedFilePtr = std::shared_ptr<MemoryMappedFile>;
+
+/**
+ * @brief Read-only view of a file mapped in memory. The pages are loaded on demand by the OS and
+ * are shared with the page cache, which means that large assets can be parsed in place without
+ * being copied to the heap first.
+ *
+ * On platforms without memory mapping support, the file is read in a heap buffer instead.
+ */
+class BABYLON_SHARED_EXPORT MemoryMappedFile {
+
+public:
+  /**
+   * @brief Maps the given file read-only in memory.
+   * @param path defines the path of the file to map
+   * @returns the mapped file or nullptr if the file can not be opened
+   */
+  static MemoryMappedFilePtr Open(const std::string& path);
+
+  MemoryMappedFile(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+  ~MemoryMappedFile(); // = default
+
+  /**
+   * @brief Returns the first byte of the file.
+   */
+  [[nodiscard]] const uint8_t* data() const;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Returns whether the file is memory mapped (or was read in a heap buffer).
+   */
+  [[nodiscard]] bool isMapped() const;
+
+private:
+  MemoryMappedFile();
+  bool _map(const std::string& path);
+  bool _read(const std::string& path);
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  void* _mapping;
+  ArrayBuffer _buffer;
+
+}; // end of class MemoryMappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MEMORY_MAPPED_FILE_H
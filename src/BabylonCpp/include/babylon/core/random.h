@@ -1,6 +1,7 @@
 #ifndef BABYLON_CORE_RANDOM_H
 #define BABYLON_CORE_RANDOM_H
 
+#include <cstdint>
 #include <limits>
 #include <random>
 #include <vector>
@@ -36,8 +37,92 @@ inline std::vector<T> randomList(T min, T max, size_t nbrOfElements = 1)
   return result;
 }
 
+/**
+ * @brief Deterministic stream of random numbers (PCG32 generator).
+ *
+ * While a stream is current on a thread (see RandomStreamScope), Math::random() draws its values
+ * from it instead of the nondeterministic generator. Jobs split in chunks over worker threads can
+ * then give each chunk its own stream and produce the same results whatever the number of threads.
+ */
+class RandomStream {
+
+public:
+  /**
+   * @brief Creates a random stream.
+   * @param seed defines the initial state of the generator
+   * @param sequence defines the sequence of the generator, streams with the same seed and different
+   * sequences are independent
+   */
+  RandomStream(std::uint64_t seed, std::uint64_t sequence = 0)
+      : _state{0}, _increment{(sequence << 1u) | 1u}
+  {
+    nextUint32();
+    _state += seed;
+    nextUint32();
+  }
+
+  /**
+   * @brief Returns the next 32 bits random integer.
+   */
+  std::uint32_t nextUint32()
+  {
+    const auto oldState   = _state;
+    _state                = oldState * 6364136223846793005ULL + _increment;
+    const auto xorShifted = static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+    const auto rot        = static_cast<std::uint32_t>(oldState >> 59u);
+    return (xorShifted >> rot) | (xorShifted << ((32u - rot) & 31u));
+  }
+
+  /**
+   * @brief Returns the next random number in [0, 1).
+   */
+  float nextFloat()
+  {
+    return static_cast<float>(nextUint32() >> 8u) * (1.f / 16777216.f);
+  }
+
+  /**
+   * @brief Returns the stream used by Math::random() on the calling thread, if any.
+   */
+  static RandomStream*& Current()
+  {
+    thread_local RandomStream* current = nullptr;
+    return current;
+  }
+
+private:
+  std::uint64_t _state;
+  std::uint64_t _increment;
+
+}; // end of class RandomStream
+
+/**
+ * @brief Makes a random stream current on the calling thread for the lifetime of the scope.
+ */
+class RandomStreamScope {
+
+public:
+  explicit RandomStreamScope(RandomStream& stream) : _previous{RandomStream::Current()}
+  {
+    RandomStream::Current() = &stream;
+  }
+  RandomStreamScope(const RandomStreamScope& other) = delete;
+  RandomStreamScope& operator=(const RandomStreamScope& other) = delete;
+  ~RandomStreamScope()
+  {
+    RandomStream::Current() = _previous;
+  }
+
+private:
+  RandomStream* _previous;
+
+}; // end of class RandomStreamScope
+
 inline float random()
 {
+  if (auto stream = RandomStream::Current()) {
+    return stream->nextFloat();
+  }
   return randomNumber(0.f, 1.f);
 }
 
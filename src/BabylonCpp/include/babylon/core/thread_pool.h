@@ -0,0 +1,111 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed size pool of worker threads used by the engine to run CPU bound jobs (active meshes
+ * evaluation, particles, skeletons, ...) in parallel.
+ *
+ * The calling thread always takes part in the work submitted through parallelFor, which means that
+ * a pool without workers (e.g. on platforms without thread support) simply runs everything inline,
+ * and that nested parallelFor calls issued from a worker can not deadlock.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  /**
+   * @brief Creates a new thread pool.
+   * @param numWorkers defines the number of worker threads to spawn (0 means run everything on the
+   * calling thread)
+   */
+  explicit ThreadPool(size_t numWorkers);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ~ThreadPool(); // = default
+
+  /**
+   * @brief Returns the process wide pool shared by the engine. The pool is lazily created with
+   * one worker less than the number of hardware threads, as the calling thread participates in the
+   * work.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Returns the number of worker threads owned by the pool.
+   */
+  [[nodiscard]] size_t numWorkers() const;
+
+  /**
+   * @brief Returns the maximum number of threads that can work on a parallelFor call (the workers
+   * plus the calling thread).
+   */
+  [[nodiscard]] size_t concurrency() const;
+
+  /**
+   * @brief Splits the range [0, count) in chunks of at most grainSize elements and calls func on
+   * each chunk, in parallel, then waits for all chunks to complete. Chunk boundaries only depend on
+   * count and grainSize (and not on the number of threads) so that per chunk state can be made
+   * deterministic. The first exception thrown by func is rethrown on the calling thread.
+   * @param count defines the number of elements to process
+   * @param grainSize defines the maximum number of elements per chunk
+   * @param func defines the function called with the chunk index and the [begin, end) range
+   */
+  void parallelFor(size_t count, size_t grainSize,
+                   const std::function<void(size_t chunkIndex, size_t begin, size_t end)>& func);
+
+  /**
+   * @brief Splits the range [0, count) in chunks of at most grainSize elements and calls func on
+   * each chunk, in parallel, then waits for all chunks to complete.
+   * @param count defines the number of elements to process
+   * @param grainSize defines the maximum number of elements per chunk
+   * @param func defines the function called with the [begin, end) range
+   */
+  void parallelFor(size_t count, size_t grainSize,
+                   const std::function<void(size_t begin, size_t end)>& func);
+
+  /**
+   * @brief Queues a job to be run asynchronously on a worker thread. When the pool has no worker,
+   * the job is run immediately on the calling thread.
+   * @param func defines the job to run
+   * @returns a future holding the result of the job
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<F>> enqueue(F&& func)
+  {
+    using R   = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+    auto res  = task->get_future();
+    _push([task]() { (*task)(); });
+    return res;
+  }
+
+private:
+  void _push(std::function<void()>&& job);
+  void _workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void()>> _jobs;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
@@ -203,7 +203,6 @@ public:
 
 private:
   Matrix _worldMatrix;
-  static std::array<Vector3, 3> TmpVector3;
 
 }; // end of class BoundingBox
 
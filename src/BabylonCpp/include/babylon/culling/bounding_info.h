@@ -162,7 +162,6 @@ public:
 
 private:
   bool _isLocked;
-  static std::array<Vector3, 2> TmpVector3;
 
 }; // end of class BoundingInfo
 
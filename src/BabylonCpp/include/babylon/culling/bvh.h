@@ -0,0 +1,194 @@
+#ifndef BABYLON_CULLING_BVH_H
+#define BABYLON_CULLING_BVH_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class Vector3;
+
+/**
+ * @brief Flattened bounding volume hierarchy over axis aligned boxes, built with the binned surface
+ * area heuristic (SAH).
+ *
+ * The nodes are stored in a single array: the root is the first node, the two children of an inner
+ * node are stored next to each other and always after their parent. The primitives of a leaf are
+ * the range [leftFirst, leftFirst + count) of primitiveIndices.
+ */
+class BABYLON_SHARED_EXPORT BVH {
+
+public:
+  /**
+   * Maximum depth of the hierarchy, deeper nodes are turned into leaves.
+   */
+  static constexpr size_t MaxDepth = 64;
+
+  /**
+   * Axis aligned bounds of a primitive or of a node.
+   */
+  struct Bounds {
+    std::array<float, 3> minimum;
+    std::array<float, 3> maximum;
+  }; // end of struct Bounds
+
+  /**
+   * Node of the hierarchy (32 bytes).
+   */
+  struct Node {
+    std::array<float, 3> minimum;
+    // Index of the left child for an inner node, index of the first primitive for a leaf
+    uint32_t leftFirst;
+    std::array<float, 3> maximum;
+    // Number of primitives of a leaf, 0 for an inner node
+    uint32_t count;
+
+    [[nodiscard]] bool isLeaf() const
+    {
+      return count > 0;
+    }
+  }; // end of struct Node
+
+  /**
+   * Ray prepared for the node tests.
+   */
+  struct RayData {
+    RayData(const Vector3& origin, const Vector3& direction);
+
+    std::array<float, 3> origin;
+    std::array<float, 3> inverseDirection;
+  }; // end of struct RayData
+
+public:
+  BVH();
+  BVH(const BVH& other);
+  BVH(BVH&& other);
+  BVH& operator=(const BVH& other);
+  BVH& operator=(BVH&& other);
+  ~BVH(); // = default
+
+  /**
+   * @brief Builds the hierarchy over the given primitive bounds.
+   * @param primitives defines the bounds of the primitives
+   * @param maxLeafSize defines the number of primitives under which a node is never split
+   */
+  void build(const std::vector<Bounds>& primitives, size_t maxLeafSize = 4);
+
+  /**
+   * @brief Updates the node bounds after the primitives moved, without changing the topology.
+   * @param primitives defines the new bounds of the primitives (same count and order as in build)
+   */
+  void refit(const std::vector<Bounds>& primitives);
+
+  /**
+   * @brief Removes all the nodes.
+   */
+  void clear();
+
+  /**
+   * @brief Gets a boolean indicating if the hierarchy has no node.
+   */
+  [[nodiscard]] bool empty() const;
+
+  /**
+   * @brief Tests a node against a ray segment.
+   * @param node defines the node to test
+   * @param ray defines the prepared ray
+   * @param maxDistance defines the end of the segment (the segment starts at the ray origin)
+   * @param distance defines the distance along the ray where the segment enters the node
+   * @returns true if the segment crosses the node
+   */
+  static bool IntersectsNode(const Node& node, const RayData& ray, float maxDistance,
+                             float& distance)
+  {
+    auto tMin = 0.f;
+    auto tMax = maxDistance;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      auto t0 = (node.minimum[axis] - ray.origin[axis]) * ray.inverseDirection[axis];
+      auto t1 = (node.maximum[axis] - ray.origin[axis]) * ray.inverseDirection[axis];
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+    }
+    distance = tMin;
+    return tMin <= tMax;
+  }
+
+  /**
+   * @brief Tests a node against an axis aligned box.
+   * @param node defines the node to test
+   * @param bounds defines the box to test
+   * @returns true if the node and the box overlap
+   */
+  static bool OverlapsNode(const Node& node, const Bounds& bounds)
+  {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      if (node.minimum[axis] > bounds.maximum[axis] || node.maximum[axis] < bounds.minimum[axis]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Calls a function for each primitive of the leaves overlapping an axis aligned box.
+   * @param bounds defines the box to test
+   * @param callback defines the function called with the index of each primitive
+   */
+  template <typename Callback>
+  void forEachOverlap(const Bounds& bounds, Callback&& callback) const
+  {
+    if (nodes.empty()) {
+      return;
+    }
+
+    std::array<uint32_t, 2 * MaxDepth> stack;
+    size_t stackSize   = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+      const auto& node = nodes[stack[--stackSize]];
+      if (!OverlapsNode(node, bounds)) {
+        continue;
+      }
+
+      if (node.isLeaf()) {
+        for (auto i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+          callback(primitiveIndices[i]);
+        }
+      }
+      else {
+        stack[stackSize++] = node.leftFirst + 1;
+        stack[stackSize++] = node.leftFirst;
+      }
+    }
+  }
+
+private:
+  void _updateNodeBounds(Node& node, const std::vector<Bounds>& primitives) const;
+  void _subdivide(uint32_t nodeIndex, size_t depth, const std::vector<Bounds>& primitives,
+                  const std::vector<std::array<float, 3>>& centroids, size_t maxLeafSize,
+                  std::vector<std::pair<uint32_t, size_t>>& stack);
+
+public:
+  /**
+   * The nodes of the hierarchy, the root first
+   */
+  std::vector<Node> nodes;
+
+  /**
+   * The primitive indices, in leaf order
+   */
+  std::vector<uint32_t> primitiveIndices;
+
+}; // end of class BVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_BVH_H
@@ -0,0 +1,109 @@
+#ifndef BABYLON_CULLING_CULLING_STORE_H
+#define BABYLON_CULLING_CULLING_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class BoundingInfo;
+class Plane;
+class Vector3;
+
+/**
+ * @brief Structure of arrays holding world space bounding spheres and boxes, tested against the
+ * frustum planes several volumes at a time (8 with AVX, 4 with SSE2 / NEON).
+ *
+ * Boxes are stored as a center and three half axes, the result of the box test is therefore the
+ * same as BoundingBox::IsInFrustum up to float rounding. Sphere tests are exact. The culling
+ * strategy of each volume (Constants::MESHES_CULLINGSTRATEGY_XXX) is honored the same way
+ * BoundingInfo::isInFrustum does.
+ */
+class BABYLON_SHARED_EXPORT CullingStore {
+
+public:
+  CullingStore();
+  CullingStore(const CullingStore& other);
+  CullingStore(CullingStore&& other);
+  CullingStore& operator=(const CullingStore& other);
+  CullingStore& operator=(CullingStore&& other);
+  ~CullingStore(); // = default
+
+  /**
+   * @brief Gets the number of volumes in the store.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Resizes the store, new volumes are left uninitialized.
+   * @param count defines the new number of volumes
+   */
+  void resize(size_t count);
+
+  /**
+   * @brief Removes all the volumes from the store.
+   */
+  void clear();
+
+  /**
+   * @brief Packs the world space bounding sphere and box of a bounding info. Different indices can
+   * be set concurrently.
+   * @param index defines the index of the volume to set
+   * @param boundingInfo defines the bounding info to pack (must be up to date)
+   * @param strategy defines the culling strategy to use for this volume
+   */
+  void set(size_t index, const BoundingInfo& boundingInfo, unsigned int strategy = 0);
+
+  /**
+   * @brief Packs an axis aligned box (and its circumscribed sphere).
+   * @param index defines the index of the volume to set
+   * @param minimum defines the minimum corner of the box
+   * @param maximum defines the maximum corner of the box
+   */
+  void setBox(size_t index, const Vector3& minimum, const Vector3& maximum);
+
+  /**
+   * @brief Tests the volumes in the range [begin, end) against the frustum planes. Different
+   * ranges can be tested concurrently.
+   * @param frustumPlanes defines the frustum planes to test
+   * @param result defines the output buffer receiving 1 for each visible volume and 0 for each
+   * culled one (indexed from begin)
+   * @param begin defines the index of the first volume to test
+   * @param end defines the index after the last volume to test
+   */
+  void isInFrustum(const std::array<Plane, 6>& frustumPlanes, uint8_t* result, size_t begin,
+                   size_t end) const;
+
+  /**
+   * @brief Tests all the volumes against the frustum planes.
+   * @param frustumPlanes defines the frustum planes to test
+   * @param result defines the output buffer receiving 1 for each visible volume and 0 for each
+   * culled one (must hold size() elements)
+   */
+  void isInFrustum(const std::array<Plane, 6>& frustumPlanes, uint8_t* result) const;
+
+  /**
+   * @brief Returns the name of the instruction set used by the culling kernel.
+   */
+  static const char* KernelName();
+
+private:
+  // Bounding spheres
+  std::vector<float> _sphereCenterX, _sphereCenterY, _sphereCenterZ, _sphereRadius;
+  // Bounding boxes
+  std::vector<float> _boxCenterX, _boxCenterY, _boxCenterZ;
+  std::vector<float> _boxAxis0X, _boxAxis0Y, _boxAxis0Z;
+  std::vector<float> _boxAxis1X, _boxAxis1Y, _boxAxis1Z;
+  std::vector<float> _boxAxis2X, _boxAxis2Y, _boxAxis2Z;
+  // Culling strategies
+  std::vector<uint8_t> _strategies;
+
+}; // end of class CullingStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_CULLING_STORE_H
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/culling/culling_store.h>
 
 namespace BABYLON {
 
@@ -18,11 +19,13 @@ struct BABYLON_SHARED_EXPORT IOctreeContainer {
   /**
    * Blocks within the octree
    */
-  static std::vector<OctreeBlock<T>> blocks;
-}; // end of struct IOctreeContainer<T>
+  std::vector<OctreeBlock<T>> blocks;
 
-template <class T>
-std::vector<OctreeBlock<T>> IOctreeContainer<T>::blocks;
+  /**
+   * Hidden (Bounding boxes of the blocks, tested against the frustum in one batch)
+   */
+  CullingStore _blocksCullingStore;
+}; // end of struct IOctreeContainer<T>
 
 } // end of namespace BABYLON
 
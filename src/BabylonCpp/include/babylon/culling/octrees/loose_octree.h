@@ -0,0 +1,200 @@
+#ifndef BABYLON_CULLING_OCTREES_LOOSE_OCTREE_H
+#define BABYLON_CULLING_OCTREES_LOOSE_OCTREE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Plane;
+class Ray;
+class SubMesh;
+
+/**
+ * @brief Loose octree whose content can move: each entry is stored once, in the cell containing
+ * its center at most as deep as its size allows (leaves are only split once full), and cells
+ * are tested with bounds twice as large as the cell. An entry whose bounds change is only moved to
+ * another cell when it leaves the loose bounds of its cell (or grows too large for it), so updating
+ * a moving entry is O(depth) and rebuilding the tree is never needed.
+ *
+ * The queries test the entries against their stored world bounds, every entry is returned at most
+ * once and the selection is merged with the dynamic content using a per-query stamp.
+ * @see Octree
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT LooseOctree {
+
+public:
+  /**
+   * Function returning the world space axis aligned bounds of an entry, or false if the entry must
+   * not be selected by the queries
+   */
+  using BoundsFunc = std::function<bool(const T& entry, Vector3& minimum, Vector3& maximum)>;
+
+public:
+  /**
+   * @brief Creates a loose octree.
+   * @param boundsFunc defines the function used to get the world bounds of the entries
+   * @param maxBlockCapacity defines the maximum number of entries of the leaves (if capacity is
+   * reached the leaf is split)
+   * @param maxDepth defines the maximum depth (sub-levels) of the octree
+   */
+  LooseOctree(const BoundsFunc& boundsFunc, size_t maxBlockCapacity = 32, size_t maxDepth = 8);
+  ~LooseOctree(); // = default
+
+  /** Properties **/
+
+  /**
+   * @brief Gets the number of entries stored in the octree.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Gets the number of cells currently allocated.
+   */
+  [[nodiscard]] size_t nodeCount() const;
+
+  /** Methods **/
+
+  /**
+   * @brief Rebuilds the octree for the given world extends, with the given entries.
+   * @param worldMin defines the minimum vector of the world (entries may lie outside)
+   * @param worldMax defines the maximum vector of the world (entries may lie outside)
+   * @param entries defines the entries to add to the octree
+   */
+  void update(const Vector3& worldMin, const Vector3& worldMax, const std::vector<T>& entries);
+
+  /**
+   * @brief Reads the bounds of all the entries and moves the ones whose bounds changed.
+   * @returns the number of entries that moved to another cell
+   */
+  size_t refresh();
+
+  /**
+   * @brief Adds an entry to the octree (nothing is done if the entry is already stored).
+   * @param entry defines the entry to add
+   */
+  void addEntry(const T& entry);
+
+  /**
+   * @brief Removes an entry from the octree.
+   * @param entry defines the entry to remove
+   */
+  void removeEntry(const T& entry);
+
+  /**
+   * @brief Reads the bounds of an entry and moves it to another cell if needed.
+   * @param entry defines the entry to update
+   * @returns true if the entry moved to another cell
+   */
+  bool updateEntry(const T& entry);
+
+  /**
+   * @brief Selects the entries whose bounds intersect the frustum.
+   * @param frustumPlanes defines the frustum planes to test
+   * @returns the selected entries followed by the dynamic content (without duplicates)
+   */
+  std::vector<T>& select(const std::array<Plane, 6>& frustumPlanes);
+
+  /**
+   * @brief Selects the entries whose bounds intersect the given sphere.
+   * @param sphereCenter defines the sphere center
+   * @param sphereRadius defines the sphere radius
+   * @returns the selected entries followed by the dynamic content (without duplicates)
+   */
+  std::vector<T>& intersects(const Vector3& sphereCenter, float sphereRadius);
+
+  /**
+   * @brief Selects the entries whose bounds intersect the given ray.
+   * @param ray defines the ray to test with
+   * @returns the selected entries followed by the dynamic content (without duplicates)
+   */
+  std::vector<T>& intersectsRay(const Ray& ray);
+
+  /** Statics **/
+
+  /**
+   * @brief Gets the world bounds of a mesh (blocked meshes and meshes without bounding info are
+   * not selected).
+   */
+  static bool BoundsFuncForMeshes(AbstractMesh* const& entry, Vector3& minimum, Vector3& maximum);
+
+  /**
+   * @brief Gets the world bounds of a submesh.
+   */
+  static bool BoundsFuncForSubMeshes(SubMesh* const& entry, Vector3& minimum, Vector3& maximum);
+
+public:
+  /**
+   * Content always added to the selections
+   */
+  std::vector<T> dynamicContent;
+
+  /**
+   * Defines the maximum depth (sub-levels) of the octree, changes are applied by update()
+   */
+  size_t maxDepth;
+
+private:
+  static constexpr uint32_t NoNode = 0xFFFFFFFF;
+
+  struct Node {
+    Vector3 center;
+    float halfSize    = 0.f;
+    uint32_t parent   = NoNode;
+    uint32_t depth    = 0;
+    size_t entryCount = 0; // in the subtree
+    std::array<uint32_t, 8> children{};
+    std::vector<uint32_t> entries;
+  }; // end of struct Node
+
+  struct Entry {
+    T value;
+    Vector3 minimum;
+    Vector3 maximum;
+    uint32_t node  = NoNode; // NoNode if not selectable
+    uint32_t slot  = 0;      // in the entries of the node (or in _unselectables)
+    uint32_t stamp = 0;
+  }; // end of struct Entry
+
+  void _reset(const Vector3& worldMin, const Vector3& worldMax);
+  uint32_t _createNode(uint32_t parent, size_t childIndex);
+  void _releaseNode(uint32_t index);
+  [[nodiscard]] uint32_t _depthFor(const Vector3& minimum, const Vector3& maximum) const;
+  [[nodiscard]] bool _isInCell(uint32_t index, const Vector3& center) const;
+  [[nodiscard]] bool _isLeaf(uint32_t index) const;
+  uint32_t _childFor(uint32_t index, const Vector3& center);
+  uint32_t _targetNode(const Vector3& minimum, const Vector3& maximum);
+  [[nodiscard]] bool _fitsIn(uint32_t index, const Vector3& minimum, const Vector3& maximum) const;
+  bool _refreshEntry(uint32_t index);
+  void _link(uint32_t index, uint32_t node);
+  void _unlink(uint32_t index);
+  void _split(uint32_t index);
+  template <typename NodeTest, typename EntryTest>
+  void _query(const NodeTest& nodeTest, const EntryTest& entryTest);
+  void _selectSubtree(uint32_t index);
+
+private:
+  size_t _maxBlockCapacity;
+  BoundsFunc _boundsFunc;
+  std::vector<Node> _nodes;
+  std::vector<uint32_t> _freeNodes;
+  std::vector<Entry> _entries;
+  std::vector<uint32_t> _unselectables;
+  std::unordered_map<T, uint32_t> _indices;
+  std::vector<uint32_t> _stack;
+  uint32_t _stamp;
+  std::vector<T> _selectionContent;
+
+}; // end of class LooseOctree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_OCTREES_LOOSE_OCTREE_H
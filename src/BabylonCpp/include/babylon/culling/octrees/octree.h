@@ -2,6 +2,7 @@
 #define BABYLON_CULLING_OCTREES_OCTREE_H
 
 #include <functional>
+#include <unordered_set>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -112,10 +113,14 @@ public:
    */
   std::size_t maxDepth;
 
+private:
+  void _removeDuplicates();
+
 private:
   std::size_t _maxBlockCapacity;
 
   std::vector<T> _selectionContent;
+  std::unordered_set<T> _selectedEntries;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
 
 }; // end of class Octree
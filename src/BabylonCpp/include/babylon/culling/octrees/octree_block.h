@@ -94,7 +94,7 @@ public:
 
   /**
    * @brief Test if the current block intersect with the given ray and if yes, then add its content
-   * to the selection array.
+   * to the selection array (the selection array can contain duplicated entries).
    * @param ray defines the ray to test with
    * @param selection defines the array to store current content if selection is positive
    */
@@ -105,6 +105,13 @@ public:
    */
   void createInnerBlocks();
 
+  /**
+   * @brief Hidden
+   */
+  static void _SelectBlocks(IOctreeContainer<T>& container,
+                            const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+                            bool allowDuplicate);
+
   /**
    * @brief Hidden
    */
@@ -119,6 +126,10 @@ public:
    */
   std::vector<T> entries;
 
+private:
+  void _selectContent(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+                      bool allowDuplicate);
+
 private:
   size_t _depth;
   size_t _maxDepth;
@@ -0,0 +1,77 @@
+#ifndef BABYLON_CULLING_PICKING_BVH_H
+#define BABYLON_CULLING_PICKING_BVH_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/culling/bvh.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Ray;
+FWD_CLASS_SPTR(AbstractMesh)
+
+/**
+ * @brief Bounding volume hierarchy over the world bounding boxes of the meshes of a scene, used to
+ * select the meshes a picking ray may hit.
+ *
+ * The meshes whose world bounding box does not enclose what Scene::pick tests are never culled:
+ * meshes without bounding info or not synchronizing it, meshes using the world matrix of another
+ * mesh (skeleton override mesh, LOD levels), meshes with thin instances and lines meshes.
+ */
+class BABYLON_SHARED_EXPORT PickingBVH {
+
+public:
+  PickingBVH();
+  PickingBVH(const PickingBVH& other) = delete;
+  PickingBVH& operator=(const PickingBVH& other) = delete;
+  ~PickingBVH(); // = default
+
+  /**
+   * @brief Synchronizes the hierarchy with a list of meshes. The world matrices of the meshes are
+   * computed, the hierarchy is rebuilt when the list of culled meshes changed and refitted when
+   * only their bounds changed.
+   * @param meshes defines the meshes to pick from
+   */
+  void update(const std::vector<AbstractMeshPtr>& meshes);
+
+  /**
+   * @brief Collects the meshes a ray may hit. Can be called concurrently.
+   * @param ray defines the ray to test, in world space
+   * @param candidates defines the list receiving the sorted indices (in the list given to update)
+   * of the meshes which may be hit
+   */
+  void collectCandidates(const Ray& ray, std::vector<size_t>& candidates) const;
+
+  /**
+   * @brief Gets the number of meshes culled with the hierarchy.
+   */
+  [[nodiscard]] size_t culledMeshesCount() const;
+
+  /**
+   * @brief Returns true if the world bounding box of the mesh encloses what picking tests.
+   * @param mesh defines the mesh to check
+   */
+  static bool IsCullable(AbstractMesh& mesh);
+
+private:
+  // Meshes of the last update
+  std::vector<AbstractMesh*> _meshes;
+  // Index in _meshes of each primitive of the hierarchy and its world bounds
+  std::vector<size_t> _culledMeshes;
+  std::vector<BVH::Bounds> _bounds;
+  // Index in _meshes of the meshes always tested
+  std::vector<size_t> _uncullableMeshes;
+  // Scratch lists
+  std::vector<size_t> _newCulledMeshes;
+  std::vector<BVH::Bounds> _newBounds;
+  BVH _bvh;
+  size_t _refitCount;
+
+}; // end of class PickingBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_PICKING_BVH_H
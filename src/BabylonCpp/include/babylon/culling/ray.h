@@ -237,7 +237,8 @@ public:
   float length;
 
 private:
-  static std::array<Vector3, 6> _TmpVector3;
+  // Thread local so that rays can be tested concurrently (see Scene::pickWithRays)
+  static thread_local std::array<Vector3, 6> _TmpVector3;
   std::unique_ptr<Ray> _tmpRay;
 
 }; // end of class Ray
@@ -0,0 +1,102 @@
+#ifndef BABYLON_CULLING_TRIANGLE_BVH_H
+#define BABYLON_CULLING_TRIANGLE_BVH_H
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/culling/bvh.h>
+
+namespace BABYLON {
+
+class IntersectionInfo;
+class Ray;
+class Vector3;
+FWD_CLASS_SPTR(TriangleBVH)
+
+/**
+ * @brief Bounding volume hierarchy over the triangles of a range of indices (or of vertices for
+ * unindexed geometries), used to accelerate the picking of large meshes.
+ *
+ * The ray tests give the same result as SubMesh::_intersectTriangles and
+ * SubMesh::_intersectUnIndexedTriangles for triangle lists: the closest hit is returned (the lowest
+ * face id when several faces are hit at the same distance) and with fastCheck the hit with the
+ * lowest face id is returned, which is the first one found by the linear scans. The triangle
+ * predicate is only called for the triangles whose bounds are crossed by the ray.
+ *
+ * The hierarchy is also used by the collisions to select the triangles near the collider.
+ */
+class BABYLON_SHARED_EXPORT TriangleBVH {
+
+public:
+  using TrianglePickingPredicate
+    = std::function<bool(const Vector3& p0, const Vector3& p1, const Vector3& p2, const Ray& ray)>;
+
+  /**
+   * Number of triangles under which a linear scan is preferred to a hierarchy.
+   */
+  static constexpr size_t MinTriangleCount = 64;
+
+  /**
+   * Vertex indices and face id of a triangle.
+   */
+  struct Triangle {
+    uint32_t indexA;
+    uint32_t indexB;
+    uint32_t indexC;
+    uint32_t faceId;
+  }; // end of struct Triangle
+
+public:
+  /**
+   * @brief Builds the hierarchy of the triangles of a range of indices.
+   * @param positions defines the vertex positions
+   * @param indices defines the indices (empty for an unindexed geometry)
+   * @param indexStart defines the start of the range of indices (of vertices when unindexed)
+   * @param indexCount defines the number of indices (of vertices when unindexed) of the range
+   */
+  TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices, size_t indexStart,
+              size_t indexCount);
+  TriangleBVH(const TriangleBVH& other) = delete;
+  TriangleBVH& operator=(const TriangleBVH& other) = delete;
+  ~TriangleBVH(); // = default
+
+  /**
+   * @brief Gets the number of triangles in the hierarchy.
+   */
+  [[nodiscard]] size_t triangleCount() const;
+
+  /**
+   * @brief Intersects the triangles with a ray.
+   * @param ray defines the ray to test (in the space of the positions)
+   * @param positions defines the vertex positions the hierarchy was built with
+   * @param fastCheck defines if the first hit in face order is returned instead of the closest
+   * @param trianglePredicate defines an optional predicate used to select faces
+   * @returns the intersection info of the hit, with the face id set
+   */
+  std::optional<IntersectionInfo> intersects(Ray& ray, const std::vector<Vector3>& positions,
+                                             bool fastCheck,
+                                             const TrianglePickingPredicate& trianglePredicate
+                                             = nullptr) const;
+
+  /**
+   * @brief Collects the triangles of the leaves overlapping an axis aligned box.
+   * @param minimum defines the minimum of the box (in the space of the positions)
+   * @param maximum defines the maximum of the box (in the space of the positions)
+   * @param triangles defines the list receiving the triangles, sorted by face id
+   */
+  void collectTriangles(const Vector3& minimum, const Vector3& maximum,
+                        std::vector<Triangle>& triangles) const;
+
+private:
+  BVH _bvh;
+  std::vector<Triangle> _triangles;
+
+}; // end of class TriangleBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_TRIANGLE_BVH_H
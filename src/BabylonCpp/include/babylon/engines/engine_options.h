@@ -2,6 +2,7 @@
 #define BABYLON_ENGINES_ENGINE_OPTIONS_H
 
 #include <optional>
+#include <string>
 
 #include <babylon/babylon_api.h>
 
@@ -88,6 +89,19 @@ struct BABYLON_SHARED_EXPORT EngineOptions {
    * cannot be created
    */
   bool failIfMajorPerformanceCaveat = false;
+
+  /**
+   * Defines that texture files must be read and decoded on worker threads, the decoded images being
+   * uploaded at the beginning of the following frames. False by default
+   */
+  bool asyncTextureDecoding = false;
+
+  /**
+   * Defines the directory where the linked shader programs are stored, so that the next runs load
+   * them instead of compiling the shaders again (requires program binaries support). Disabled when
+   * empty (default)
+   */
+  std::string programBinaryCacheDirectory = "";
 }; // end of struct EngineOptions
 
 } // end of namespace BABYLON
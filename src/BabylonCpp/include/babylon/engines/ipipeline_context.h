@@ -285,6 +285,69 @@ public:
    */
   virtual void setDirectColor4(const std::string& uniformName, const Color4& color4) = 0;
 
+  /**
+   * @brief Returns the handle of a uniform variable. The handle is the index of the uniform in the
+   * list of uniform names of the effect and stays valid for the lifetime of the effect.
+   * @param uniformName Name of the variable.
+   * @returns the handle of the uniform or -1 if the uniform is unknown.
+   */
+  [[nodiscard]] virtual int getUniformHandle(const std::string& uniformName) const = 0;
+
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param value Value to be set.
+   */
+  virtual void setInt(int uniformHandle, int value) = 0;
+
+  /**
+   * @brief Sets matrices on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param matrices matrices to be set.
+   */
+  virtual void setMatrices(int uniformHandle, const Float32Array& matrices) = 0;
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param matrix matrix to be set.
+   */
+  virtual void setMatrix(int uniformHandle, const Matrix& matrix) = 0;
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param value value to be set.
+   */
+  virtual void setFloat(int uniformHandle, float value) = 0;
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   */
+  virtual void setFloat2(int uniformHandle, float x, float y) = 0;
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   */
+  virtual void setFloat3(int uniformHandle, float x, float y, float z) = 0;
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   */
+  virtual void setFloat4(int uniformHandle, float x, float y, float z, float w) = 0;
+
 public:
   /** @hidden */
   std::string _name;
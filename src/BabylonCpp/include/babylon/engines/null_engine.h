@@ -252,6 +252,14 @@ public:
    */
   bool setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices) override;
 
+  /**
+   * @brief Set the value of an uniform to a matrix (4x4), directly from the matrix storage.
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the matrix to store
+   * @returns true if the value was set
+   */
+  bool setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix) override;
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -528,6 +536,28 @@ public:
   void updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer, const Float32Array& data,
                                  int byteOffset = -1, int byteLength = -1) override;
 
+  /**
+   * @brief Resizes the data store of a dynamic vertex buffer. The WebGL buffer is kept so that the
+   * vertex array objects referencing it stay valid, the previous content is discarded.
+   * @param vertexBuffer the vertex buffer to resize
+   * @param byteLength the new byte length of the data store
+   */
+  void resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                 size_t byteLength) override;
+
+  /**
+   * @brief Updates a range of a dynamic vertex buffer in place, without copying the data.
+   * @param vertexBuffer the vertex buffer to update
+   * @param data the data to upload, starting at byteOffset in the vertex buffer
+   * @param byteOffset the byte offset of the range in the vertex buffer
+   * @param byteLength the byte length of the range
+   * @param discard defines whether the content outside of the range can be discarded. The data
+   * store is then orphaned first, so the upload does not wait for the pending draws using it
+   */
+  void updateDynamicVertexBufferRange(const WebGLDataBufferPtr& vertexBuffer, const float* data,
+                                      size_t byteOffset, size_t byteLength,
+                                      bool discard = false) override;
+
   /**
    * @brief Hidden
    */
@@ -588,7 +618,7 @@ public:
 protected:
   NullEngine(const NullEngineOptions& options = NullEngineOptions{});
 
-  void _deleteBuffer(GL::IGLBuffer* buffer);
+  void _deleteBuffer(const WebGLDataBufferPtr& buffer) override;
 
 private:
   NullEngineOptions _options;
@@ -49,7 +49,7 @@ private:
   std::string _removeComments(const std::string& block);
   bool _replaceFunctionCallsByCode();
   int _findBackward(const std::string& s, int index, char c) const;
-  std::string _escapeRegExp(const std::string& s) const;
+  bool _findFunctionTypeAndName(const std::string& s, std::string& type, std::string& name) const;
   std::string _replaceNames(std::string code, const std::vector<std::string>& sources,
                             const std::vector<std::string>& destinations) const;
 
@@ -70,8 +70,6 @@ public:
   ReadOnlyProperty<ShaderCodeInliner, std::string> code;
 
 private:
-  static constexpr const char* _RegexpFindFunctionNameAndType = R"(((\s+?)(\w+)\s+(\w+)\s*?))";
-
   std::string _sourceCode;
   std::vector<IInlineFunctionDescr> _functionDescr;
   size_t _numMaxIterations;
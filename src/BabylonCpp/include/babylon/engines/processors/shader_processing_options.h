@@ -41,6 +41,8 @@ struct BABYLON_SHARED_EXPORT ProcessingOptions {
   std::string platformName{""};
   std::optional<bool> lookForClosingBracketForUniformBuffer{std::nullopt};
   ShaderProcessingContextPtr processingContext{nullptr};
+  // Includes used while processing the shader code
+  std::vector<std::string> includedFiles{};
 }; // end of struct ProcessingOptions
 
 } // end of namespace BABYLON
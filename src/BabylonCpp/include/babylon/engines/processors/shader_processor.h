@@ -34,7 +34,18 @@ public:
   static constexpr const char* regexSE       = R"(defined\s*?\((.+?)\))";
   static constexpr const char* regexSERevert = R"(defined\s*?\[(.+?)\])";
 
+  /**
+   * Maximum number of processed shader codes kept in memory, so that the effects sharing the same
+   * source code, defines and includes are only processed once (0 disables the cache)
+   */
+  static size_t ProcessedCodeCacheMaxSize;
+
 public:
+  /**
+   * @brief Clears the processed shader codes kept in memory.
+   */
+  static void ClearProcessedCodeCache();
+
   static void Initialize(ProcessingOptions& options);
   static void Process(const std::string& sourceCode, ProcessingOptions& options,
                       const std::function<void(const std::string& migratedCode)>& callback,
@@ -65,6 +76,12 @@ public:
 
 private:
   static std::string _ProcessPrecision(std::string source, const ProcessingOptions& options);
+  static std::string _GetProcessedCodeKey(const std::string& sourceCode,
+                                          const ProcessingOptions& options, ThinEngine* engine);
+  static bool _GetProcessedCode(const std::string& key, ProcessingOptions& options,
+                                std::string& processedCode);
+  static void _AddProcessedCode(const std::string& key, const ProcessingOptions& options,
+                                const std::string& processedCode);
   static ShaderDefineExpressionPtr _ExtractOperation(const std::string& expression);
   static ShaderDefineExpressionPtr _BuildSubExpression(std::string expression);
   static ShaderCodeTestNodePtr _BuildExpression(const std::string& line, size_t start);
@@ -72,6 +89,7 @@ private:
                                   const ShaderCodeConditionNodePtr& rootNode,
                                   ShaderCodeNodePtr ifNode);
   static bool _MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNodePtr& rootNode);
+  static std::string _FindKeyword(const std::string& line);
   static std::vector<std::string>
   _removeCommentsAndEmptyLines(const std::vector<std::string>& sourceCodeLines);
   static std::string
@@ -0,0 +1,113 @@
+#ifndef BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
+#define BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Counters reported by the program binary cache.
+ */
+struct BABYLON_SHARED_EXPORT ProgramBinaryCacheStatistics {
+  /** Number of programs loaded from the cache */
+  size_t hits = 0;
+  /** Number of programs which had to be compiled */
+  size_t misses = 0;
+  /** Number of cached programs discarded because they were invalid or rejected by the driver */
+  size_t rejections = 0;
+}; // end of struct ProgramBinaryCacheStatistics
+
+/**
+ * @brief On-disk cache of linked shader programs (see EngineOptions::programBinaryCacheDirectory).
+ *
+ * Programs are keyed by a hash of their final vertex and fragment sources and of the driver
+ * description, and stored as the binaries returned by glGetProgramBinary, so that the next runs can
+ * load them with glProgramBinary instead of compiling and linking the shaders again. The whole
+ * cache is discarded when the driver changes and an entry is discarded when the driver refuses to
+ * link it.
+ */
+class BABYLON_SHARED_EXPORT ProgramBinaryCache {
+
+public:
+  /**
+   * @brief Creates a program binary cache.
+   * @param directory defines the directory where the binaries are stored (created if needed)
+   * @param driverInfo defines the description of the driver (vendor, renderer and version)
+   */
+  ProgramBinaryCache(const std::string& directory, const std::string& driverInfo);
+  ProgramBinaryCache(const ProgramBinaryCache& other) = delete;
+  ProgramBinaryCache& operator=(const ProgramBinaryCache& other) = delete;
+  ~ProgramBinaryCache(); // = default
+
+  /**
+   * @brief Computes the cache key of a program.
+   * @param vertexSource defines the final source of the vertex shader
+   * @param fragmentSource defines the final source of the fragment shader
+   * @returns the cache key
+   */
+  [[nodiscard]] std::string computeKey(const std::string& vertexSource,
+                                       const std::string& fragmentSource) const;
+
+  /**
+   * @brief Loads a program binary from the cache.
+   * @param key defines the cache key (see computeKey)
+   * @param binaryFormat receives the driver specific format of the binary
+   * @param binary receives the program binary
+   * @returns true if the program was found
+   */
+  bool load(const std::string& key, unsigned int& binaryFormat, Uint8Array& binary);
+
+  /**
+   * @brief Stores a program binary in the cache.
+   * @param key defines the cache key (see computeKey)
+   * @param binaryFormat defines the driver specific format of the binary
+   * @param binary defines the program binary
+   * @returns true if the program was written to the disk
+   */
+  bool save(const std::string& key, unsigned int binaryFormat, const Uint8Array& binary);
+
+  /**
+   * @brief Removes a program from the cache, e.g. when the driver could not link its binary.
+   * @param key defines the cache key (see computeKey)
+   */
+  void remove(const std::string& key);
+
+  /**
+   * @brief Removes all the programs from the cache.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the directory where the binaries are stored.
+   */
+  [[nodiscard]] const std::string& directory() const;
+
+  /**
+   * @brief Returns the counters of the cache.
+   */
+  [[nodiscard]] const ProgramBinaryCacheStatistics& statistics() const;
+
+private:
+  [[nodiscard]] std::string _getFilePath(const std::string& key) const;
+  [[nodiscard]] std::string _getIndexPath() const;
+  [[nodiscard]] std::string _getDriverPath() const;
+  void _writeIndex() const;
+
+private:
+  std::string _directory;
+  std::string _driverInfo;
+  uint64_t _driverHash;
+  // Keys of the programs stored in the directory
+  std::unordered_set<std::string> _keys;
+  ProgramBinaryCacheStatistics _statistics;
+
+}; // end of class ProgramBinaryCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_PROGRAM_BINARY_CACHE_H
@@ -10,6 +10,7 @@
 #include <babylon/babylon_fwd.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/structs.h>
+#include <babylon/culling/octrees/loose_octree.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engines/abstract_scene.h>
 #include <babylon/engines/scene_options.h>
@@ -34,6 +35,7 @@ namespace BABYLON {
 struct AnimationPropertiesOverride;
 class ClickInfo;
 class Collider;
+class CullingStore;
 class DebugLayer;
 class Engine;
 class EnvironmentHelper;
@@ -44,6 +46,8 @@ struct IPhysicsEnginePlugin;
 struct IRenderingManagerAutoClearSetup;
 class KeyboardInfo;
 class KeyboardInfoPre;
+class ParticleSimulationScheduler;
+class PickingBVH;
 class PostProcessManager;
 class PostProcessRenderPipelineManager;
 struct RenderingGroupInfo;
@@ -1384,6 +1388,18 @@ public:
   Octree<AbstractMesh*>* createOrUpdateSelectionOctree(size_t maxCapacity = 64,
                                                        size_t maxDepth    = 2);
 
+  /**
+   * @brief Creates or updates the loose octree used to select the active meshes of scenes whose
+   * meshes move. The bounds of the meshes are read again before each selection and only the meshes
+   * that left their cell are moved, the octree is never rebuilt. When created, it is used instead
+   * of the selection octree.
+   * @param maxCapacity defines the maximum capacity per leaf
+   * @param maxDepth defines the maximum depth of the octree
+   * @returns a loose octree of AbstractMesh
+   */
+  LooseOctree<AbstractMesh*>* createOrUpdateDynamicSelectionOctree(size_t maxCapacity = 32,
+                                                                   size_t maxDepth    = 8);
+
   /** Picking **/
 
   /**
@@ -1533,6 +1549,24 @@ public:
               const std::function<bool(const AbstractMeshPtr& mesh)>& predicate = nullptr,
               bool fastCheck = false, const TrianglePickingPredicate& trianglePredicate = nullptr);
 
+  /**
+   * @brief Use the given rays to pick meshes in the scene, each ray giving the same result as
+   * pickWithRay. The rays are traced concurrently on the threads of the default thread pool: the
+   * scene must not be modified during the call and the predicates (as well as a custom
+   * getIntersectingSubMeshCandidates) must be thread safe.
+   * @param rays The rays (in world space) to use to pick meshes
+   * @param predicate Predicate function used to determine eligible meshes. Can be set to null. In
+   * this case, a mesh must be enabled, visible and with isPickable set to true
+   * @param fastCheck defines if the first intersection will be used (and not the closest)
+   * @param trianglePredicate defines an optional predicate used to select faces when a mesh
+   * intersection is detected
+   * @returns a PickingInfo per ray
+   */
+  std::vector<PickingInfo>
+  pickWithRays(const std::vector<Ray>& rays,
+               const std::function<bool(const AbstractMeshPtr& mesh)>& predicate = nullptr,
+               bool fastCheck = false, const TrianglePickingPredicate& trianglePredicate = nullptr);
+
   /**
    * @brief Launch a ray to try to pick a mesh in the scene.
    * @param x X position on screen
@@ -1863,6 +1897,13 @@ private:
   GeometryPtr _getGeometryByUniqueID(size_t uniqueId);
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh);
   void _evaluateActiveMeshes();
+  void _evaluateActiveMeshesInBatches(const std::vector<AbstractMesh*>& meshes);
+  bool _isActiveMeshCandidateEligible(AbstractMesh* mesh);
+  void _prepareActiveSkeletons();
+  void _animateParticleSystems();
+  bool _canEvaluateActiveMeshInBatch(AbstractMesh* mesh) const;
+  void _evaluateActiveMesh(AbstractMesh* mesh,
+                           const std::optional<bool>& precomputedIsInFrustum = std::nullopt);
   void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
   void _renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent = nullptr);
   void _bindFrameBuffer();
@@ -1881,6 +1922,14 @@ private:
                 const std::optional<bool>& fastCheck              = std::nullopt,
                 const std::optional<bool>& onlyBoundingInfo       = std::nullopt,
                 const TrianglePickingPredicate& trianglePredicate = nullptr);
+  std::optional<PickingInfo>
+  _internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
+                const std::function<bool(const AbstractMeshPtr& mesh)>& predicate,
+                const std::optional<bool>& fastCheck, const std::optional<bool>& onlyBoundingInfo,
+                const TrianglePickingPredicate& trianglePredicate,
+                const std::vector<size_t>* candidates);
+  const std::vector<size_t>*
+  _getPickingCandidates(const std::function<Ray(Matrix& world)>& rayFunction);
   std::vector<std::optional<PickingInfo>>
   _internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
                      const std::function<bool(AbstractMesh* mesh)>& predicate,
@@ -2217,6 +2266,11 @@ protected:
    */
   Octree<AbstractMesh*>*& get_selectionOctree();
 
+  /**
+   * @brief Gets the loose octree used to select the active meshes of scenes whose meshes move.
+   */
+  std::unique_ptr<LooseOctree<AbstractMesh*>>& get_dynamicSelectionOctree();
+
   /**
    * @brief Gets the mesh that is currently under the pointer.
    */
@@ -2705,6 +2759,54 @@ public:
    */
   std::function<AbstractMesh*(AbstractMesh* mesh, Camera* camera)> customLODSelector;
 
+  /**
+   * Gets or sets a boolean indicating if the active meshes evaluation (world matrices and frustum
+   * tests) should be spread over the threads of the default thread pool. Meshes are merged back
+   * in candidate order, so the active meshes and the rendering groups are the same as with the
+   * serial evaluation. Only root meshes without billboard, infinite distance or world matrix
+   * observers are evaluated on the worker threads. The LOD selection, which calls the
+   * onLODLevelSelection callbacks, stays on the calling thread.
+   * Default is false.
+   */
+  bool parallelActiveMeshesEvaluation;
+
+  /**
+   * Gets or sets a boolean indicating if the frustum tests of the active meshes evaluation should
+   * be done in batches over a structure of arrays of bounding volumes, several meshes at a time.
+   * It applies to the same meshes as parallelActiveMeshesEvaluation (with or without threads).
+   * Default is false.
+   */
+  bool batchedFrustumCulling;
+
+  /**
+   * Gets or sets a boolean indicating if the active particle systems should be animated on the
+   * threads of the default thread pool (see ParticleSimulationScheduler). The independent systems
+   * are simulated in parallel and the large systems split their update and vertex fill passes in
+   * chunks, sub-emitters and vertex buffer uploads stay on the render thread. The emission of each
+   * system is deterministic (see ParticleSystem::randomSeed).
+   * Default is false.
+   */
+  bool parallelParticlesAnimation;
+
+  /**
+   * Gets or sets a boolean indicating if the skeletons of the active meshes should be prepared on
+   * the threads of the default thread pool, once all the active meshes are evaluated. Each
+   * skeleton computes its bone matrices in batches over a hierarchy sorted copy of its bones (see
+   * BoneMatrixStore), texture uploads and onBeforeComputeObservable stay on the render thread.
+   * Default is false.
+   */
+  bool parallelSkeletonsEvaluation;
+
+  /**
+   * Gets or sets a boolean indicating if picking should use bounding volume hierarchies: one over
+   * the world bounding boxes of the meshes (see PickingBVH), rebuilt or refitted when the meshes
+   * change, and one per large triangle list of each geometry (see TriangleBVH), built on first use
+   * and reset when the positions or the indices of the geometry are updated. The picking results
+   * are the same as without hierarchies.
+   * Default is false.
+   */
+  bool bvhAcceleratedPicking;
+
   // Pointers
 
   /**
@@ -3287,6 +3389,11 @@ public:
    */
   ReadOnlyProperty<Scene, Octree<AbstractMesh*>*> selectionOctree;
 
+  /**
+   * Gets the loose octree used to select the active meshes of scenes whose meshes move
+   */
+  ReadOnlyProperty<Scene, std::unique_ptr<LooseOctree<AbstractMesh*>>> dynamicSelectionOctree;
+
   /**
    * Gets the mesh that is currently under the pointer
    */
@@ -3659,6 +3766,8 @@ private:
   bool _texturesEnabled;
   // Skeletons
   bool _skeletonsEnabled;
+  // Skeletons of the active meshes are prepared after the evaluation (parallelSkeletonsEvaluation)
+  bool _deferSkeletonsPreparation;
   // Postprocesses
   std::unique_ptr<PostProcessRenderPipelineManager> _postProcessRenderPipelineManager;
   // Collisions
@@ -3727,9 +3836,12 @@ private:
   bool _alternateRendering;
   bool _frustumPlanesSet;
   std::array<Plane, 6> _frustumPlanes;
+  std::unique_ptr<CullingStore> _cullingStore;
+  std::unique_ptr<ParticleSimulationScheduler> _particleSimulationScheduler;
 
   /** Hidden (Backing field) */
   Octree<AbstractMesh*>* _selectionOctree;
+  std::unique_ptr<LooseOctree<AbstractMesh*>> _dynamicSelectionOctree;
 
   Vector2 _unTranslatedPointer;
   AbstractMeshPtr _pointerOverMesh;
@@ -3750,9 +3862,11 @@ private:
 
   std::unique_ptr<Ray> _tempPickingRay;
   std::unique_ptr<Ray> _cachedRayForTransform;
+  // Picking hierarchy over the meshes (bvhAcceleratedPicking) and candidates of the last pick
+  std::unique_ptr<PickingBVH> _pickingBVH;
+  std::vector<size_t> _pickingCandidates;
 
   std::vector<AbstractMesh*> _defaultMeshCandidates;
-  std::vector<SubMesh*> _defaultSubMeshCandidates;
 
   std::optional<bool> _audioEnabled;
   std::optional<bool> _headphone;
@@ -0,0 +1,177 @@
+#ifndef BABYLON_ENGINES_TEXTURE_CACHE_H
+#define BABYLON_ENGINES_TEXTURE_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+class ThinEngine;
+FWD_CLASS_SPTR(InternalTexture)
+
+/**
+ * @brief Counters reported by the texture cache.
+ */
+struct BABYLON_SHARED_EXPORT TextureCacheStatistics {
+  /** Number of lookups which returned an existing texture */
+  size_t hits = 0;
+  /** Number of lookups which did not find any texture */
+  size_t misses = 0;
+  /** Number of hits on a released texture which was kept alive by the cache */
+  size_t revivals = 0;
+  /** Number of released textures whose GPU resources were freed to respect the budget */
+  size_t evictions = 0;
+}; // end of struct TextureCacheStatistics
+
+/**
+ * @brief Index of the textures loaded by an engine, used to share a single internal texture between
+ * all the textures referencing the same image.
+ *
+ * Textures are keyed by their normalized url, or by a hash of their content when they are created
+ * from an embedded buffer (data urls, glTF images, ...), and then matched on their sampling
+ * parameters. When the last reference to a cached texture is released, its GPU resources are kept
+ * in a LRU list, up to releasedTexturesMemoryBudget bytes, so that textures unloaded and loaded
+ * again (e.g. when switching between assets) do not need to be decoded and uploaded again.
+ */
+class BABYLON_SHARED_EXPORT TextureCache {
+
+public:
+  using TextureBuffer = std::variant<std::string, ArrayBuffer, ArrayBufferView, Image>;
+
+public:
+  explicit TextureCache(ThinEngine* engine);
+  TextureCache(const TextureCache& other) = delete;
+  TextureCache& operator=(const TextureCache& other) = delete;
+  ~TextureCache(); // = default
+
+  /**
+   * @brief Normalizes an url so that the different spellings of the same path share the same key.
+   * @param url defines the url to normalize
+   * @returns the normalized url
+   */
+  static std::string NormalizeUrl(const std::string& url);
+
+  /**
+   * @brief Computes the cache key of a texture.
+   * @param url defines the url of the texture
+   * @param buffer defines the buffer the texture is created from, if any
+   * @param hashContent defines whether the content of the buffer should be used as key (the url is
+   * used otherwise)
+   * @returns the cache key, empty when the texture can not be cached
+   */
+  static std::string ComputeKey(const std::string& url,
+                                const std::optional<TextureBuffer>& buffer = std::nullopt,
+                                bool hashContent                          = true);
+
+  /**
+   * @brief Returns the estimated GPU memory used by a texture, in bytes.
+   */
+  static size_t EstimateMemory(const InternalTexture& texture);
+
+  /**
+   * @brief Looks for a cached texture, increments its reference count and returns it.
+   * @param key defines the cache key (see ComputeKey)
+   * @param noMipmap defines whether the texture has no mipmaps
+   * @param samplingMode defines the sampling mode (0 matches any sampling mode)
+   * @param invertY defines whether the texture is flipped vertically (nullopt matches both)
+   * @param format defines the requested format (nullopt matches any format)
+   * @returns the cached texture or nullptr
+   */
+  InternalTexturePtr find(const std::string& key, bool noMipmap, unsigned int samplingMode = 0,
+                          const std::optional<bool>& invertY         = std::nullopt,
+                          const std::optional<unsigned int>& format = std::nullopt);
+
+  /**
+   * @brief Registers a texture in the cache.
+   * @param key defines the cache key (see ComputeKey), nothing is registered when empty
+   * @param texture defines the texture to register
+   * @param format defines the format requested when creating the texture
+   */
+  void add(const std::string& key, const InternalTexturePtr& texture,
+           const std::optional<unsigned int>& format = std::nullopt);
+
+  /**
+   * @brief Removes a texture from the cache (called when its GPU resources are released).
+   */
+  void remove(const InternalTexture* texture);
+
+  /**
+   * @brief Makes a texture take the place of another one in the cache (used when rebuilding).
+   */
+  void replace(const InternalTexture* texture, const InternalTexturePtr& target);
+
+  /**
+   * @brief Called when the last reference to a texture is released.
+   * @returns true if the texture is kept alive by the cache, false if its GPU resources must be
+   * released
+   */
+  bool _onTextureReleased(const InternalTexturePtr& texture);
+
+  /**
+   * @brief Frees the GPU resources of the released textures kept by the cache.
+   */
+  void clearReleasedTextures();
+
+  /**
+   * @brief Returns the estimated GPU memory used by the released textures kept by the cache.
+   */
+  [[nodiscard]] size_t releasedTexturesMemory() const;
+
+  /**
+   * @brief Returns the counters of the cache.
+   */
+  [[nodiscard]] const TextureCacheStatistics& statistics() const;
+
+  /**
+   * @brief Resets the counters of the cache.
+   */
+  void resetStatistics();
+
+public:
+  /**
+   * Maximum GPU memory (in bytes) used by the released textures kept alive, 0 to release the
+   * textures as soon as they are not referenced anymore
+   */
+  size_t releasedTexturesMemoryBudget = 64 * 1024 * 1024;
+
+  /**
+   * Whether the textures created from a buffer are keyed by a hash of their content, which allows
+   * sharing the images embedded in several files
+   */
+  bool hashEmbeddedBuffers = true;
+
+private:
+  struct Entry {
+    InternalTexturePtr texture;
+    std::optional<unsigned int> format;
+  };
+
+  void _evict(size_t budget);
+
+private:
+  ThinEngine* _engine;
+  std::unordered_map<std::string, std::vector<Entry>> _entries;
+  std::unordered_map<const InternalTexture*, std::string> _keys;
+  // Released textures, least recently released first
+  std::list<InternalTexturePtr> _releasedTextures;
+  std::unordered_map<const InternalTexture*, std::list<InternalTexturePtr>::iterator> _released;
+  size_t _releasedTexturesMemory;
+  TextureCacheStatistics _statistics;
+
+}; // end of class TextureCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_TEXTURE_CACHE_H
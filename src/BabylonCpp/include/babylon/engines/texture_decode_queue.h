@@ -0,0 +1,110 @@
+#ifndef BABYLON_ENGINES_TEXTURE_DECODE_QUEUE_H
+#define BABYLON_ENGINES_TEXTURE_DECODE_QUEUE_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+struct Image;
+
+/**
+ * @brief Reads and decodes texture files on worker threads and hands the results back to the
+ * render thread.
+ *
+ * File reads and image decoding run on the thread pool, while the callbacks (which upload the data
+ * to the GPU) are only ever invoked from processUploads on the render thread. Decoded images are
+ * kept in a bounded queue: at most maxPendingJobs files are being read, decoded or waiting for
+ * their upload at any time, further requests wait in submission order until a slot is freed.
+ */
+class BABYLON_SHARED_EXPORT TextureDecodeQueue {
+
+public:
+  using OnImageLoadedFunction = std::function<void(const Image& img)>;
+  using OnFileLoadedFunction  = std::function<void(const ArrayBuffer& data)>;
+  using OnErrorFunction
+    = std::function<void(const std::string& message, const std::string& exception)>;
+
+public:
+  /**
+   * @brief Creates a new texture decode queue.
+   * @param threadPool defines the pool running the file reads and decoding
+   * @param maxPendingJobs defines the maximum number of files being loaded or waiting for their
+   * upload
+   */
+  explicit TextureDecodeQueue(ThreadPool& threadPool, size_t maxPendingJobs = 8);
+  TextureDecodeQueue(const TextureDecodeQueue& other) = delete;
+  TextureDecodeQueue& operator=(const TextureDecodeQueue& other) = delete;
+  ~TextureDecodeQueue(); // = default
+
+  /**
+   * @brief Loads and decodes an image file (PNG, JPG, TGA, HDR, ...) in the background.
+   * @param url defines the url of the image to load
+   * @param flipVertically defines whether to flip the rows of the decoded image
+   * @param onLoad defines the callback called on the render thread with the decoded image
+   * @param onError defines the callback called on the render thread when the file can not be read
+   */
+  void loadImage(const std::string& url, bool flipVertically, const OnImageLoadedFunction& onLoad,
+                 const OnErrorFunction& onError);
+
+  /**
+   * @brief Reads a file (DDS, KTX, ENV, ...) in the background.
+   * @param url defines the url of the file to load
+   * @param onLoad defines the callback called on the render thread with the content of the file
+   * @param onError defines the callback called on the render thread when the file can not be read
+   */
+  void loadFile(const std::string& url, const OnFileLoadedFunction& onLoad,
+                const OnErrorFunction& onError);
+
+  /**
+   * @brief Invokes the callbacks of the completed jobs, in completion order, until the time budget
+   * is exhausted. At least one completed job is processed per call so that loading always makes
+   * progress. Must be called from the render thread.
+   * @param timeBudgetInMs defines the time budget in milliseconds (0 means no limit)
+   * @returns the number of jobs processed
+   */
+  size_t processUploads(float timeBudgetInMs);
+
+  /**
+   * @brief Waits for all the submitted jobs and invokes their callbacks. Must be called from the
+   * render thread.
+   */
+  void flush();
+
+  /**
+   * @brief Returns the number of submitted jobs whose callbacks were not invoked yet.
+   */
+  [[nodiscard]] size_t pendingCount() const;
+
+  /**
+   * @brief Returns the number of jobs being read, decoded or waiting for their upload, which never
+   * exceeds maxPendingJobs.
+   */
+  [[nodiscard]] size_t inFlightCount() const;
+
+private:
+  struct State;
+  using Job = std::function<std::function<void()>()>;
+
+  void _submit(Job&& job);
+  void _dispatch();
+
+private:
+  ThreadPool& _threadPool;
+  size_t _maxPendingJobs;
+  std::shared_ptr<State> _state;
+  // Jobs waiting for a free slot, only accessed from the render thread
+  std::deque<Job> _waitingJobs;
+
+}; // end of class TextureDecodeQueue
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_TEXTURE_DECODE_QUEUE_H
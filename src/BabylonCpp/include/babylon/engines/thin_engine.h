@@ -39,7 +39,9 @@ struct InstancingAttributeInfo;
 struct RenderTargetCreationOptions;
 struct IRenderTargetOptions;
 struct ISize;
+class Matrix;
 class MultiRenderExtension;
+class ProgramBinaryCache;
 class ProgressEvent;
 class RawTextureExtension;
 class ReadTextureExtension;
@@ -48,6 +50,8 @@ class RenderTargetExtension;
 class Scene;
 class StencilState;
 class Texture;
+class TextureCache;
+class TextureDecodeQueue;
 class UniformBuffer;
 class UniformBufferExtension;
 using ArrayBufferViewArray = std::vector<ArrayBufferView>;
@@ -226,6 +230,20 @@ public:
    */
   std::vector<InternalTexturePtr>& getLoadedTexturesCache();
 
+  /**
+   * @brief Gets the cache used to share the internal textures loaded from the same url or from the
+   * same embedded buffer.
+   * @returns the texture cache
+   */
+  TextureCache& getTextureCache();
+
+  /**
+   * @brief Gets the on-disk cache of the linked shader programs (see
+   * EngineOptions::programBinaryCacheDirectory).
+   * @returns the program binary cache or nullptr if disabled or not supported
+   */
+  ProgramBinaryCache* getProgramBinaryCache();
+
   /**
    * @brief Gets the object containing all engine capabilities.
    * @returns the EngineCapabilities object
@@ -318,6 +336,12 @@ public:
    */
   virtual void endFrame();
 
+  /**
+   * @brief Waits for all the textures being decoded in the background (see
+   * EngineOptions::asyncTextureDecoding) and uploads them.
+   */
+  void flushTextureDecodeQueue();
+
   /**
    * @brief Resize the view according to the canvas' size.
    */
@@ -795,6 +819,14 @@ public:
    */
   virtual bool setMatrices(const WebGLUniformLocationPtr& uniform, const Float32Array& matrices);
 
+  /**
+   * @brief Set the value of an uniform to a matrix (4x4), directly from the matrix storage.
+   * @param uniform defines the webGL uniform location where to store the value
+   * @param matrix defines the matrix to store
+   * @returns true if the value was set
+   */
+  virtual bool setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix);
+
   /**
    * @brief Set the value of an uniform to a matrix (3x3).
    * @param uniform defines the webGL uniform location where to store the value
@@ -1389,6 +1421,28 @@ public:
                                          const Float32Array& data, int byteOffset = -1,
                                          int byteLength = -1);
 
+  /**
+   * @brief Resizes the data store of a dynamic vertex buffer. The WebGL buffer is kept so that the
+   * vertex array objects referencing it stay valid, the previous content is discarded.
+   * @param vertexBuffer the vertex buffer to resize
+   * @param byteLength the new byte length of the data store
+   */
+  virtual void resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                         size_t byteLength);
+
+  /**
+   * @brief Updates a range of a dynamic vertex buffer in place, without copying the data.
+   * @param vertexBuffer the vertex buffer to update
+   * @param data the data to upload, starting at byteOffset in the vertex buffer
+   * @param byteOffset the byte offset of the range in the vertex buffer
+   * @param byteLength the byte length of the range
+   * @param discard defines whether the content outside of the range can be discarded. The data
+   * store is then orphaned first, so the upload does not wait for the pending draws using it
+   */
+  virtual void updateDynamicVertexBufferRange(const WebGLDataBufferPtr& vertexBuffer,
+                                              const float* data, size_t byteOffset,
+                                              size_t byteLength, bool discard = false);
+
   //------------------------------------------------------------------------------------------------
   //                              Dynamic Texture Extension
   //------------------------------------------------------------------------------------------------
@@ -1915,7 +1969,7 @@ protected:
   void _normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                            Uint32Array& uint32ArrayResult);
   void bindIndexBuffer(const WebGLDataBufferPtr& buffer);
-  void _deleteBuffer(const WebGLDataBufferPtr& buffer);
+  virtual void _deleteBuffer(const WebGLDataBufferPtr& buffer);
   /** @hidden */
   virtual void _reportDrawCall();
   static std::string _ConcatenateShader(const std::string& source, const std::string& defines,
@@ -1943,12 +1997,18 @@ private:
   void _vertexAttribPointer(const WebGLDataBufferPtr& buffer, unsigned int indx, int size,
                             unsigned int type, bool normalized, int stride, int offset);
   void _bindVertexBuffersAttributes(
-    const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect);
+    const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect,
+    const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers = {});
   void _unbindVertexArrayObject();
   unsigned int _drawMode(unsigned int fillMode) const;
   WebGLShaderPtr _compileShader(const std::string& source, const std::string& type,
                                 const std::string& defines, const std::string& shaderVersion);
   WebGLShaderPtr _compileRawShader(const std::string& source, const std::string& type);
+  WebGLProgramPtr _loadProgramBinary(const WebGLPipelineContextPtr& pipelineContext,
+                                     const std::string& vertexSource,
+                                     const std::string& fragmentSource,
+                                     WebGLRenderingContext* context,
+                                     const std::vector<std::string>& transformFeedbackVaryings);
   unsigned int _getTextureTarget(const InternalTexturePtr& texture) const;
   void _prepareWebGLTexture(
     const InternalTexturePtr& texture, Scene* scene, int width, int height,
@@ -2023,6 +2083,12 @@ public:
    */
   bool disableUniformBuffers = false;
 
+  /**
+   * Gets or sets the time (in milliseconds) that can be spent each frame uploading the textures
+   * decoded in the background (0 means no limit). At least one texture is uploaded per frame
+   */
+  float textureUploadTimeBudget = 4.f;
+
   /** @hidden */
   std::vector<UniformBuffer*> _uniformBuffers;
 
@@ -2319,6 +2385,15 @@ private:
   std::unique_ptr<RenderTargetCubeExtension> _renderTargetCubeExtension;
   std::unique_ptr<UniformBufferExtension> _uniformBufferExtension;
 
+  // Textures read and decoded on worker threads, null when decoding synchronously
+  std::unique_ptr<TextureDecodeQueue> _textureDecodeQueue;
+
+  // Index of the loaded textures and LRU of the released ones
+  std::unique_ptr<TextureCache> _textureCache;
+
+  // Linked programs stored on disk, null when disabled
+  std::unique_ptr<ProgramBinaryCache> _programBinaryCache;
+
   // Friend classes
   friend class DynamicBufferExtension;
   friend class ReadTextureExtension;
@@ -1,6 +1,7 @@
 #ifndef BABYLON_ENGINES_WEBGL_WEBGL_PIPELINE_CONTEXT_H
 #define BABYLON_ENGINES_WEBGL_WEBGL_PIPELINE_CONTEXT_H
 
+#include <array>
 #include <functional>
 
 #include <babylon/babylon_api.h>
@@ -23,6 +24,18 @@ using WebGLRenderingContext     = GL::IGLRenderingContext;
 using WebGLShaderPtr            = std::shared_ptr<GL::IGLShader>;
 using WebGLTransformFeedbackPtr = std::shared_ptr<GL::IGLTransformFeedback>;
 
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT UniformValueCache {
+  /** Last uploaded values (scalars and vectors) */
+  std::array<float, 4> values{};
+  /** Number of cached values, 0 when the value is unknown, 16 for a matrix */
+  unsigned int size = 0;
+  /** Update flag of the last uploaded matrix */
+  int updateFlag = 0;
+}; // end of struct UniformValueCache
+
 /**
  * @brief Hidden
  */
@@ -72,25 +85,37 @@ public:
    */
   WebGLUniformLocationPtr getUniform(const std::string& uniformName);
 
+  /**
+   * @brief Returns the handle of a uniform variable.
+   * @param uniformName Name of the variable.
+   * @returns the handle of the uniform or -1 if the uniform is unknown.
+   */
+  [[nodiscard]] int getUniformHandle(const std::string& uniformName) const override;
+
   /**
    * @brief Hidden
    **/
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
+  bool _cacheMatrix(int uniformHandle, const Matrix& matrix);
 
   /**
    * @brief Hidden
    **/
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
+  bool _cacheFloat(int uniformHandle, float x);
 
   /**
    * @brief Hidden
    **/
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
+  bool _cacheFloat2(int uniformHandle, float x, float y);
 
   /**
    * @brief Hidden
    **/
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z, float w);
+  bool _cacheFloat3(int uniformHandle, float x, float y, float z);
+
+  /**
+   * @brief Hidden
+   **/
+  bool _cacheFloat4(int uniformHandle, float x, float y, float z, float w);
 
   /**
    * @brief Sets an integer value on a uniform variable.
@@ -298,6 +323,61 @@ public:
    */
   void setDirectColor4(const std::string& uniformName, const Color4& color4) override;
 
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param value Value to be set.
+   */
+  void setInt(int uniformHandle, int value) override;
+
+  /**
+   * @brief Sets matrices on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param matrices matrices to be set.
+   */
+  void setMatrices(int uniformHandle, const Float32Array& matrices) override;
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param matrix matrix to be set.
+   */
+  void setMatrix(int uniformHandle, const Matrix& matrix) override;
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param value value to be set.
+   */
+  void setFloat(int uniformHandle, float value) override;
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   */
+  void setFloat2(int uniformHandle, float x, float y) override;
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   */
+  void setFloat3(int uniformHandle, float x, float y, float z) override;
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable.
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   */
+  void setFloat4(int uniformHandle, float x, float y, float z, float w) override;
+
   /**
    * @brief Hidden
    */
@@ -308,9 +388,16 @@ public:
    */
   std::string _getFragmentShaderCode() const override;
 
+private:
+  [[nodiscard]] bool _isValidHandle(int uniformHandle) const;
+  bool _cacheValues(int uniformHandle, const float* values, unsigned int size);
+  void _resetCache(int uniformHandle);
+
 public:
-  std::unordered_map<std::string, Float32Array> _valueCache;
-  std::unordered_map<std::string, WebGLUniformLocationPtr> _uniforms;
+  // Flat caches indexed by uniform handle
+  std::vector<UniformValueCache> _valueCache;
+  std::vector<WebGLUniformLocationPtr> _uniformLocations;
+  std::unordered_map<std::string, int> _uniformHandles;
   ThinEngine* engine;
   WebGLProgramPtr program;
   WebGLRenderingContext* context;
@@ -325,6 +412,9 @@ public:
   std::string programLinkError;
   std::string programValidationError;
 
+  // Key under which the program binary is stored once linked, empty if not cached
+  std::string programBinaryKey;
+
 }; // end of class WebGLPipelineContext
 
 } // end of namespace BABYLON
@@ -64,6 +64,26 @@ protected:
    */
   void set_captureShaderCompilationTime(bool value);
 
+  /**
+   * @brief Gets the perf counter used for the texture cache hits.
+   */
+  PerfCounter& get_textureCacheHitsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the texture cache misses.
+   */
+  PerfCounter& get_textureCacheMissesCounter();
+
+  /**
+   * @brief Gets the texture cache statistics capture status.
+   */
+  [[nodiscard]] bool get_captureTextureCacheStatistics() const;
+
+  /**
+   * @brief Enable or disable the texture cache statistics capture.
+   */
+  void set_captureTextureCacheStatistics(bool value);
+
 public:
   // Properties
   /**
@@ -86,6 +106,21 @@ public:
    */
   Property<EngineInstrumentation, bool> captureShaderCompilationTime;
 
+  /**
+   * Perf counter used for the number of texture cache hits per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> textureCacheHitsCounter;
+
+  /**
+   * Perf counter used for the number of texture cache misses per frame.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> textureCacheMissesCounter;
+
+  /**
+   * Enable or disable the texture cache statistics capture.
+   */
+  Property<EngineInstrumentation, bool> captureTextureCacheStatistics;
+
 private:
   /**
    * Define the instrumented engine.
@@ -99,11 +134,18 @@ private:
   bool _captureShaderCompilationTime;
   PerfCounter _shaderCompilationTime;
 
+  bool _captureTextureCacheStatistics;
+  PerfCounter _textureCacheHits;
+  PerfCounter _textureCacheMisses;
+  size_t _lastTextureCacheHits;
+  size_t _lastTextureCacheMisses;
+
   // Observers
   Observer<Engine>::Ptr _onBeginFrameObserver;
   Observer<Engine>::Ptr _onEndFrameObserver;
   Observer<Engine>::Ptr _onBeforeShaderCompilationObserver;
   Observer<Engine>::Ptr _onAfterShaderCompilationObserver;
+  Observer<Engine>::Ptr _onEndFrameTextureCacheObserver;
 
 }; // end of class EngineInstrumentation
 
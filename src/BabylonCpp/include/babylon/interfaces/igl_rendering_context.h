@@ -506,6 +506,10 @@ enum GLEnums : GLenum {
   BROWSER_DEFAULT_WEBGL              = 0x9244,
   /* KHR_parallel_shader_compile */
   COMPLETION_STATUS_KHR = 0x91B1,
+  /* ARB_get_program_binary */
+  PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257,
+  PROGRAM_BINARY_LENGTH           = 0x8741,
+  NUM_PROGRAM_BINARY_FORMATS      = 0x87FE,
   // IGL_EXT_texture_filter_anisotropic
   TEXTURE_MAX_ANISOTROPY_EXT     = 0x84FE,
   MAX_TEXTURE_MAX_ANISOTROPY_EXT = 0x84FF,
@@ -991,6 +995,17 @@ public:
    */
   virtual void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) = 0;
 
+  /**
+   * @brief Updates a subset of a buffer object's data store.
+   * @param target A GLenum specifying the binding point (target).
+   * @param offset A GLintptr specifying an offset in bytes where the data
+   * replacement will start.
+   * @param size A GLsizeiptr specifying the number of bytes to copy.
+   * @param data A pointer to the data that will be copied into the data store.
+   */
+  virtual void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+    = 0;
+
   /**
    * @brief Binds a passed IGLVertexArrayObject object to the buffer.
    * @param vao A IGLVertexArrayObject (VAO) object to bind.
@@ -1634,6 +1649,14 @@ public:
    */
   virtual GLint getProgramParameter(IGLProgram* program, GLenum pname) = 0;
 
+  /**
+   * @brief Returns the binary representation of a linked program.
+   * @param program A linked IGLProgram.
+   * @param binaryFormat Receives the driver specific format of the binary.
+   * @return The program binary, empty if not supported.
+   */
+  virtual Uint8Array getProgramBinary(IGLProgram* program, GLenum& binaryFormat) = 0;
+
   /**
    * @brief Returns the information log for the specified IGLProgram object.
    * It contains errors that occurred during failed linking or validation of
@@ -1800,6 +1823,26 @@ public:
    */
   virtual void polygonOffset(GLfloat factor, GLfloat units) = 0;
 
+  /**
+   * @brief Loads a program object with a program binary previously returned by getProgramBinary.
+   * The link status of the program must be checked afterwards, as the driver rejects the binaries
+   * it can not load (e.g. after a driver update).
+   * @param program An IGLProgram to load the binary into.
+   * @param binaryFormat A GLenum specifying the format of the binary.
+   * @param binary The program binary.
+   */
+  virtual void programBinary(IGLProgram* program, GLenum binaryFormat, const Uint8Array& binary)
+    = 0;
+
+  /**
+   * @brief Sets a parameter of a program object.
+   * @param program An IGLProgram.
+   * @param pname A GLenum specifying the parameter to set (e.g.
+   * PROGRAM_BINARY_RETRIEVABLE_HINT).
+   * @param value A GLint specifying the value of the parameter.
+   */
+  virtual void programParameteri(IGLProgram* program, GLenum pname, GLint value) = 0;
+
   /**
    * @brief Selects a color buffer as the source for pixels for subsequent calls
    * to copyTexImage2D, copyTexSubImage2D, copyTexSubImage3D or readPixels.
@@ -0,0 +1,52 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_EXT_MESH_GPU_INSTANCING_H
+#define BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_EXT_MESH_GPU_INSTANCING_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/loading/plugins/gltf/2.0/gltf_loader_extension.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+class GLTFLoader;
+
+/**
+ * @brief Loader extension for EXT_mesh_gpu_instancing: the meshes of a node using the extension
+ * are loaded once and drawn as thin instances, with one world matrix per instance built from the
+ * TRANSLATION, ROTATION and SCALE accessors of the extension.
+ */
+class BABYLON_SHARED_EXPORT EXT_mesh_gpu_instancing : public IGLTFLoaderExtension {
+
+public:
+  /**
+   * The name of this extension.
+   */
+  static constexpr const char* NAME = "EXT_mesh_gpu_instancing";
+
+  /**
+   * @brief Hidden
+   */
+  EXT_mesh_gpu_instancing(GLTFLoader& loader);
+  ~EXT_mesh_gpu_instancing() override = default;
+
+  /**
+   * @brief Hidden
+   */
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+  /**
+   * @brief Hidden
+   */
+  TransformNodePtr
+  loadNodeAsync(const std::string& context, INode& node,
+                const std::function<void(const TransformNodePtr& babylonTransformNode)>& assign)
+    override;
+
+private:
+  GLTFLoader& _loader;
+
+}; // end of class EXT_mesh_gpu_instancing
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_EXT_MESH_GPU_INSTANCING_H
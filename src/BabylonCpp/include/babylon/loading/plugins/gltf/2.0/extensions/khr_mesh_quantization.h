@@ -0,0 +1,41 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
+#define BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/loading/plugins/gltf/2.0/gltf_loader_extension.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+class GLTFLoader;
+
+/**
+ * @brief Loader extension for KHR_mesh_quantization: the (normalized) byte and short vertex
+ * attributes are uploaded as they are stored in the buffer views, the loader already creates the
+ * vertex buffers with the component type and the normalized flag of the accessors.
+ */
+class BABYLON_SHARED_EXPORT KHR_mesh_quantization : public IGLTFLoaderExtension {
+
+public:
+  /**
+   * The name of this extension.
+   */
+  static constexpr const char* NAME = "KHR_mesh_quantization";
+
+  /**
+   * @brief Hidden
+   */
+  KHR_mesh_quantization(GLTFLoader& loader);
+  ~KHR_mesh_quantization() override = default;
+
+  /**
+   * @brief Hidden
+   */
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+}; // end of class KHR_mesh_quantization
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <nlohmann/json.hpp>
 
@@ -162,6 +163,13 @@ public:
    */
   MeshPtr rootBabylonMesh();
 
+  /**
+   * @brief Gets whether the given extension is listed in the extensions used by the asset.
+   * @param name The name of the extension
+   * @returns A boolean indicating whether the extension is used by the asset
+   */
+  [[nodiscard]] bool isExtensionUsed(const std::string& name) const;
+
   /** Hidden */
   void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
 
@@ -218,6 +226,11 @@ public:
                           const IMesh& mesh, IMeshPrimitive& primitive,
                           const std::function<void(const AbstractMeshPtr& babylonMesh)>& assign);
 
+  /**
+   * @brief Hidden
+   */
+  const Float32Array& _loadFloatAccessorAsync(const std::string& context, IAccessor& accessor);
+
   /**
    * @brief Loads a glTF camera.
    * @param context The context when loading the asset
@@ -414,6 +427,8 @@ private:
   void _loadAsync(const std::vector<size_t>& nodes, const std::function<void()>& resultFunc);
   void _loadData(const IGLTFLoaderData& data);
   void _setupData();
+  void _decodeAccessorsAsync();
+  void _decodeImagesAsync();
   void _loadExtensions();
   void _checkExtensions();
   void _setState(const GLTFLoaderState& state);
@@ -452,14 +467,11 @@ private:
   void _loadAnimationsAsync();
   _IAnimationSamplerData _loadAnimationSamplerAsync(const std::string& context,
                                                     IAnimationSampler& sampler);
-  ArrayBufferView& _loadBufferAsync(const std::string& context, IBuffer& buffer);
-  template <typename T>
-  ArrayBufferView& _loadAccessorAsync(const std::string& context, IAccessor& accessor);
-  Float32Array _loadFloatAccessorAsync(const std::string& context, IAccessor& accessor);
-  IndicesArray _getConverted32bitIndices(IAccessor& accessor);
-  IndicesArray _castIndicesTo32bit(const IGLTF2::AccessorComponentType& type,
-                                   const ArrayBufferView& buffer);
-  IndicesArray _loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor);
+  const BinaryChunk& _loadBufferAsync(const std::string& context, IBuffer& buffer);
+  BinaryChunk _loadBufferViewChunkAsync(const std::string& context, IBufferView& bufferView);
+  Float32Array _decodeFloatAccessor(const std::string& context, const IAccessor& accessor);
+  IndicesArray _decodeIndicesAccessor(const std::string& context, const IAccessor& accessor);
+  const IndicesArray& _loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor);
   BufferPtr _loadVertexBufferViewAsync(IBufferView& bufferView, const std::string& kind);
   VertexBufferPtr& _loadVertexAccessorAsync(const std::string& context, IAccessor& accessor,
                                             const std::string& kind);
@@ -477,11 +489,6 @@ private:
                                           std::optional<IGLTF2::TextureWrapMode> mode
                                           = std::nullopt);
   static unsigned int _GetTextureSamplingMode(const std::string& context, const ISampler& sampler);
-  static ArrayBufferView _GetTypedArray(const std::string& context,
-                                        IGLTF2::AccessorComponentType componentType,
-                                        const ArrayBufferView& bufferView,
-                                        std::optional<size_t> byteOffset = std::nullopt,
-                                        size_t length                    = 0);
   static unsigned int _GetNumComponents(const std::string& context, IGLTF2::AccessorType type);
   static unsigned int _GetNumComponents(const std::string& context, const std::string& type);
   static bool _ValidateUri(const std::string& uri);
@@ -490,11 +497,14 @@ private:
   void _compileMaterialsAsync();
   void _compileShadowGeneratorsAsync();
   void _forEachExtensions(const std::function<void(const IGLTFLoaderExtension& extension)>& action);
+  template <typename T>
+  T _applyExtensions(const void* property, const std::string& functionName,
+                     const std::function<T(IGLTFLoaderExtension& extension)>& actionAsync);
   void _extensionsOnLoading();
   void _extensionsOnReady();
   bool _extensionsLoadSceneAsync(const std::string& context, const IScene& scene);
   TransformNodePtr _extensionsLoadNodeAsync(
-    const std::string& context, const INode& node,
+    const std::string& context, INode& node,
     const std::function<void(const TransformNodePtr& babylonTransformNode)>& assign);
   CameraPtr
   _extensionsLoadCameraAsync(const std::string& context, const ICamera& camera,
@@ -533,11 +543,12 @@ private:
   GLTFFileLoader& _parent;
   GLTFLoaderState _state;
   std::unordered_map<std::string, IGLTFLoaderExtensionPtr> _extensions;
+  std::unordered_map<const void*, std::unordered_set<std::string>> _activeLoaderExtensionFunctions;
   std::string _rootUrl;
   std::string _fileName;
   std::string _uniqueRootUrl;
   std::unique_ptr<IGLTF> _gltf;
-  std::optional<ArrayBufferView> _bin;
+  std::optional<BinaryChunk> _bin;
   Scene* _babylonScene;
   MeshPtr _rootBabylonMesh;
   std::unordered_map<unsigned int, MaterialPtr> _defaultBabylonMaterialData;
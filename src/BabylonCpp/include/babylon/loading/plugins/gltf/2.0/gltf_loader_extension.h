@@ -64,8 +64,8 @@ struct BABYLON_SHARED_EXPORT IGLTFLoaderExtension : public IGLTFBaseLoaderExtens
    * complete or null if not handled
    */
   virtual TransformNodePtr
-  loadNodeAsync(const std::string& context, const INode& node,
-                const std::function<void(const TransformNode& babylonMesh)>& assign);
+  loadNodeAsync(const std::string& context, INode& node,
+                const std::function<void(const TransformNodePtr& babylonTransformNode)>& assign);
 
   /**
    * @brief Define this method to modify the default behavior when loading cameras.
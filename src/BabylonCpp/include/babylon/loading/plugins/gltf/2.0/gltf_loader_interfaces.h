@@ -1,11 +1,14 @@
 #ifndef BABYLON_LOADING_PLUGINS_GLTF_2_0_GLTF_LOADER_INTERFACES_H
 #define BABYLON_LOADING_PLUGINS_GLTF_2_0_GLTF_LOADER_INTERFACES_H
 
+#include <future>
 #include <optional>
 
 #include <nlohmann/json.hpp>
 
 #include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
+#include <babylon/loading/plugins/gltf/binary_reader.h>
 #include <babylon/meshes/vertex_buffer.h>
 
 using json = nlohmann::json;
@@ -1368,7 +1371,10 @@ struct IArrayItem {
  */
 struct IAccessor : public IGLTF2::IAccessor, IArrayItem {
   /** @hidden */
-  std::optional<ArrayBufferView> _data = std::nullopt;
+  std::optional<Float32Array> _data = std::nullopt;
+
+  /** @hidden */
+  std::optional<IndicesArray> _indicesData = std::nullopt;
 
   /** @hidden */
   VertexBufferPtr _babylonVertexBuffer = nullptr;
@@ -1420,7 +1426,7 @@ struct IAnimation : public IGLTF2::IAnimation, IArrayItem {
  */
 struct IBuffer : public IGLTF2::IBuffer, IArrayItem {
   /** @hidden */
-  ArrayBufferView _data;
+  BinaryChunk _data;
 
   static IBuffer Parse(const json& parsedBuffer);
 
@@ -1454,6 +1460,9 @@ struct IImage : public IGLTF2::IImage, IArrayItem {
   /** @hidden */
   ArrayBufferView _data;
 
+  /** @hidden */
+  std::shared_future<Image> _decodedImage;
+
   static IImage Parse(const json& parsedImage);
 
 }; // end of struct IImage
@@ -1,28 +1,59 @@
 #ifndef BABYLON_LOADING_PLUGINS_GLTF_BINARY_READER_H
 #define BABYLON_LOADING_PLUGINS_GLTF_BINARY_READER_H
 
+#include <memory>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
-#include <babylon/core/data_view.h>
 
 namespace BABYLON {
 namespace GLTF2 {
 
+/**
+ * @brief Read-only range of bytes of a binary glTF (e.g. its BIN chunk). The chunk shares the
+ * ownership of the storage it points into (memory mapped file or array buffer), so slicing it does
+ * not copy any byte.
+ */
+struct BABYLON_SHARED_EXPORT BinaryChunk {
+  /**
+   * First byte of the chunk, aliasing the storage owning the bytes.
+   */
+  std::shared_ptr<const uint8_t> data = nullptr;
+  /**
+   * The length of the chunk in bytes.
+   */
+  size_t byteLength = 0;
+
+  /**
+   * @brief Creates a chunk owning the given array buffer.
+   */
+  static BinaryChunk FromArrayBuffer(ArrayBuffer&& arrayBuffer);
+
+  /**
+   * @brief Returns the sub range [byteOffset, byteOffset + length) of the chunk, sharing the same
+   * storage.
+   * @throws std::runtime_error if the range is out of bounds
+   */
+  [[nodiscard]] BinaryChunk slice(size_t byteOffset, size_t length) const;
+
+  operator bool() const;
+}; // end of struct BinaryChunk
+
 class BABYLON_SHARED_EXPORT BinaryReader {
 
 public:
-  BinaryReader(const ArrayBuffer& arrayBuffer);
+  BinaryReader(const BinaryChunk& chunk);
   ~BinaryReader(); // = default
 
   [[nodiscard]] size_t getPosition() const;
   [[nodiscard]] size_t getLength() const;
   uint32_t readUint32();
   Uint8Array readUint8Array(size_t length);
+  BinaryChunk readChunk(size_t length);
   void skipBytes(size_t length);
 
 private:
-  ArrayBuffer _arrayBuffer;
-  DataView _dataView;
+  BinaryChunk _chunk;
   size_t _byteOffset;
 
 }; // end of class BinaryReader
@@ -23,15 +23,14 @@ FWD_CLASS_SPTR(Material)
 
 namespace GLTF2 {
 
-class BinaryReader;
 struct IGLTFLoaderData;
 struct IGLTFLoaderExtension;
 struct IGLTFValidationResults;
 FWD_STRUCT_SPTR(IGLTFLoader)
 
 struct UnpackedBinary {
-  std::string json                   = "";
-  std::optional<ArrayBufferView> bin = std::nullopt;
+  std::string json               = "";
+  std::optional<BinaryChunk> bin = std::nullopt;
 }; // end of struct UnpackedBinary
 
 struct Version {
@@ -114,6 +113,33 @@ public:
     const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress = nullptr,
     const std::string& fileName                                                  = "") override;
 
+  /**
+   * @brief Imports one or more meshes from a glTF file on disk and adds them to the scene. The file
+   * is memory mapped: for binary glTF (.glb) files, the accessors and embedded images are decoded
+   * straight from the mapped BIN chunk, without copying it to the heap first.
+   * @param meshesNames a string or array of strings of the mesh names that should be loaded from
+   * the file
+   * @param scene the scene the meshes should be added to
+   * @param filePath the path of the .gltf or .glb file to load
+   * @param onProgress event that fires when loading progress has occured
+   * @returns the loaded meshes, particles, skeletons and animations
+   */
+  ISceneLoaderAsyncResult importMeshFromFileAsync(
+    const std::vector<std::string>& meshesNames, Scene* scene, const std::string& filePath,
+    const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress = nullptr);
+
+  /**
+   * @brief Imports all objects from a glTF file on disk and adds them to the scene. The file is
+   * memory mapped (see importMeshFromFileAsync).
+   * @param scene the scene the objects should be added to
+   * @param filePath the path of the .gltf or .glb file to load
+   * @param onProgress event that fires when loading progress has occured
+   */
+  void loadFromFileAsync(Scene* scene, const std::string& filePath,
+                         const std::function<void(const SceneLoaderProgressEvent& event)>&
+                           onProgress
+                         = nullptr);
+
   /**
    * @brief Instantiates a glTF file loader plugin.
    * @returns the created plugin
@@ -233,12 +259,14 @@ protected:
     const std::function<void(IGLTFValidationResults* results, EventState& es)>& callback);
 
 private:
-  IGLTFLoaderData _parseAsync(Scene* scene, const std::variant<std::string, ArrayBuffer>& data,
+  IGLTFLoaderData _parseFileAsync(Scene* scene, const std::string& filePath, std::string& rootUrl,
+                                  std::string& fileName);
+  IGLTFLoaderData _parseAsync(Scene* scene, const std::variant<std::string, BinaryChunk>& data,
                               const std::string& rootUrl, const std::string& fileName = "");
   void _validateAsync(Scene* scene, const std::string& json, const std::string& rootUrl,
                       const std::string& fileName = "");
   IGLTFLoaderPtr _getLoader(const IGLTFLoaderData& loaderData);
-  UnpackedBinary _unpackBinary(const ArrayBuffer& data);
+  UnpackedBinary _unpackBinary(const BinaryChunk& data);
   UnpackedBinary _unpackBinaryV1(BinaryReader& binaryReader) const;
   UnpackedBinary _unpackBinaryV2(BinaryReader& binaryReader) const;
   static std::optional<Version> _parseVersion(const std::string& version);
@@ -351,6 +379,13 @@ public:
    */
   bool alwaysComputeBoundingBox;
 
+  /**
+   * Defines if the loader should optimize the indices and the vertices of the triangle meshes for
+   * the vertex cache, the overdraw and the vertex fetch (see Mesh::optimizeIndices).
+   * Defaults to false.
+   */
+  bool optimizeIndices;
+
   /**
    * If true, load all materials defined in the file, even if not used by any mesh.
    * Defaults to false.
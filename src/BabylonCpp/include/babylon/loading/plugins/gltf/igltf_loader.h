@@ -10,6 +10,7 @@
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/loading/iscene_loader_async_result.h>
+#include <babylon/loading/plugins/gltf/binary_reader.h>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -83,9 +84,9 @@ struct IGLTFLoaderData {
   json jsonObject;
 
   /**
-   * The BIN chunk of a binary glTF.
+   * The BIN chunk of a binary glTF, pointing into the loaded (or memory mapped) file.
    */
-  std::optional<ArrayBufferView> bin = std::nullopt;
+  std::optional<BinaryChunk> bin = std::nullopt;
 }; // end of struct IGLTFLoaderData
 
 /**
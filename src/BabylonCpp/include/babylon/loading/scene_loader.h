@@ -111,6 +111,18 @@ public:
    */
   static void setCleanBoneMatrixWeights(bool value);
 
+  /**
+   * @brief Gets a boolean indicating if the indices and the vertices of the loaded meshes must be
+   * optimized for the GPU.
+   */
+  static bool OptimizeIndices();
+
+  /**
+   * @brief Sets a boolean indicating if the indices and the vertices of the loaded meshes must be
+   * optimized for the GPU.
+   */
+  static void setOptimizeIndices(bool value);
+
   /**
    * @brief Gets the default plugin (used to load Babylon files).
    * @returns the .babylon plugin
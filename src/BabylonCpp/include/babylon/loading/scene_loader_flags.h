@@ -15,6 +15,7 @@ private:
   static bool _ForceFullSceneLoadingForIncremental;
   static bool _ShowLoadingScreen;
   static bool _CleanBoneMatrixWeights;
+  static bool _OptimizeIndices;
   static unsigned int _loggingLevel;
 
 public:
@@ -64,6 +65,18 @@ public:
    */
   static void setCleanBoneMatrixWeights(bool value);
 
+  /**
+   * @brief Gets a boolean indicating if the indices and the vertices of the loaded meshes must be
+   * optimized for the GPU (see Mesh::optimizeIndices).
+   */
+  static bool OptimizeIndices();
+
+  /**
+   * @brief Sets a boolean indicating if the indices and the vertices of the loaded meshes must be
+   * optimized for the GPU (see Mesh::optimizeIndices).
+   */
+  static void setOptimizeIndices(bool value);
+
 }; // end of struct SceneLoaderFlags
 
 } // end of namespace BABYLON
@@ -133,6 +133,14 @@ public:
    */
   int getUniformIndex(const std::string& uniformName);
 
+  /**
+   * @brief Gets the handle of a uniform variable. Handles are resolved once and can be used with the
+   * handle based setters to bind the uniform without looking up its name.
+   * @param uniformName of the uniform to look up.
+   * @returns the handle of the uniform or -1 if the uniform is unknown.
+   */
+  [[nodiscard]] int getUniformHandle(const std::string& uniformName) const;
+
   /**
    * @brief Returns the attribute based on the name of the variable.
    * @param uniformName of the uniform to look up.
@@ -551,6 +559,117 @@ public:
    */
   Effect& setDirectColor4(const std::string& uniformName, const Color4& color4);
 
+  /**
+   * @brief Sets an integer value on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param value Value to be set.
+   * @returns this effect.
+   */
+  Effect& setInt(int uniformHandle, int value);
+
+  /**
+   * @brief Sets matrices on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param matrices matrices to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrices(int uniformHandle, const Float32Array& matrices);
+
+  /**
+   * @brief Sets matrix on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param matrix matrix to be set.
+   * @returns this effect.
+   */
+  Effect& setMatrix(int uniformHandle, const Matrix& matrix);
+
+  /**
+   * @brief Sets a float on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param value value to be set.
+   * @returns this effect.
+   */
+  Effect& setFloat(int uniformHandle, float value);
+
+  /**
+   * @brief Sets a Vector2 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param vector2 vector2 to be set.
+   * @returns this effect.
+   */
+  Effect& setVector2(int uniformHandle, const Vector2& vector2);
+
+  /**
+   * @brief Sets a float2 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param x First float in float2.
+   * @param y Second float in float2.
+   * @returns this effect.
+   */
+  Effect& setFloat2(int uniformHandle, float x, float y);
+
+  /**
+   * @brief Sets a Vector3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param vector3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector3(int uniformHandle, const Vector3& vector3);
+
+  /**
+   * @brief Sets a float3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param x First float in float3.
+   * @param y Second float in float3.
+   * @param z Third float in float3.
+   * @returns this effect.
+   */
+  Effect& setFloat3(int uniformHandle, float x, float y, float z);
+
+  /**
+   * @brief Sets a Vector4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param vector4 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setVector4(int uniformHandle, const Vector4& vector4);
+
+  /**
+   * @brief Sets a float4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param x First float in float4.
+   * @param y Second float in float4.
+   * @param z Third float in float4.
+   * @param w Fourth float in float4.
+   * @returns this effect.
+   */
+  Effect& setFloat4(int uniformHandle, float x, float y, float z, float w);
+
+  /**
+   * @brief Sets a Color3 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param color3 Value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor3(int uniformHandle, const Color3& color3);
+
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param color3 Value to be set.
+   * @param alpha Alpha value to be set.
+   * @returns this effect.
+   */
+  Effect& setColor4(int uniformHandle, const Color3& color3, float alpha);
+
+  /**
+   * @brief Sets a Color4 on a uniform variable.
+   * @param uniformHandle Handle of the variable (see getUniformHandle).
+   * @param color4 defines the value to be set
+   * @returns this effect.
+   */
+  Effect& setDirectColor4(int uniformHandle, const Color4& color4);
+
   /**
    * @brief Release all associated resources.
    */
@@ -739,6 +858,7 @@ private:
   static std::size_t _uniqueIdSeed;
   ThinEngine* _engine;
   std::vector<std::string> _uniformsNames;
+  std::unordered_map<std::string, int> _uniformHandles;
   std::vector<std::string> _samplerList;
   std::unordered_map<std::string, int> _samplers;
   bool _isReady;
@@ -1,6 +1,7 @@
 #ifndef BABYLON_MATERIALS_IIMAGE_PROCESSING_CONFIGURATION_DEFINES_H
 #define BABYLON_MATERIALS_IIMAGE_PROCESSING_CONFIGURATION_DEFINES_H
 
+#include <cstdint>
 #include <ostream>
 
 #include <babylon/babylon_api.h>
@@ -38,6 +39,12 @@ struct BABYLON_SHARED_EXPORT IImageProcessingConfigurationDefines {
    */
   [[nodiscard]] std::string convertToString() const;
 
+  /**
+   * @brief Converts the material define values to a 64-bit hash.
+   * @returns Hash of the material define values.
+   */
+  [[nodiscard]] uint64_t convertToHash() const;
+
 }; // end of struct IImageProcessingConfigurationDefines
 
 } // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #ifndef BABYLON_MATERIALS_IMATERIAL_DEFINES_H
 #define BABYLON_MATERIALS_IMATERIAL_DEFINES_H
 
+#include <cstdint>
 #include <string>
 
 #include <babylon/babylon_api.h>
@@ -27,6 +28,7 @@ struct BABYLON_SHARED_EXPORT IMaterialDefines {
   virtual void cloneTo(MaterialDefines& other)                           = 0;
   virtual void reset()                                                   = 0;
   [[nodiscard]] virtual std::string toString() const                     = 0;
+  [[nodiscard]] virtual uint64_t hash() const                            = 0;
 }; // end of struct IMaterialDefines
 
 } // end of namespace BABYLON
@@ -5,6 +5,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_defines_schema.h>
 
 namespace BABYLON {
 
@@ -20,7 +21,8 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   MaterialDefines& operator=(MaterialDefines&& other);
   ~MaterialDefines() override; // = default
 
-  bool operator[](const std::string& define) const;
+  bool operator[](std::string_view define) const;
+  bool operator[](size_t defineIndex) const;
   bool operator==(const MaterialDefines& rhs) const;
   bool operator!=(const MaterialDefines& rhs) const;
   friend std::ostream& operator<<(std::ostream& os, const MaterialDefines& materialDefines);
@@ -113,9 +115,23 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
    */
   std::string toString() const override;
 
+  /**
+   * @brief Returns a 64-bit hash of the material define values, equal for two instances whose
+   * toString() are equal. It is maintained incrementally and does not allocate, so it can be
+   * used as a cache key on every frame.
+   * @returns the hash of the material define values.
+   */
+  uint64_t hash() const override;
+
+  /**
+   * @brief Hidden
+   * Resets the boolean and numeric defines to the ones declared by a schema.
+   */
+  void _useSchema(MaterialDefinesSchema& schema);
+
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
-  std::unordered_map<std::string, int> intDef;
+  MaterialBoolDefines boolDef;
+  MaterialIntDefines intDef;
   std::unordered_map<std::string, float> floatDef;
   std::unordered_map<std::string, std::string> stringDef;
 
@@ -150,6 +166,11 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   /** Hidden */
   bool _needUVs;
 
+  /** Hidden */
+  uint64_t _effectHash;
+  /** Hidden */
+  std::string _effectDefines;
+
 }; // end of struct MaterialDefines
 
 } // end of namespace BABYLON
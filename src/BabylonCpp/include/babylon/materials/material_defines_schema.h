@@ -0,0 +1,316 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINES_SCHEMA_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINES_SCHEMA_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Declares once, for a type of material defines, the boolean and numeric defines with
+ * their default values.
+ *
+ * Each define gets a stable index used to store its value in a bitset (boolean defines) or in a
+ * small array (numeric defines), and a 64-bit key used to maintain the hash of the defines
+ * incrementally. Defines which are not declared (e.g. "LIGHT0", "SHADOW1") are registered on
+ * first use. The schemas are shared by all the materials: the registration is synchronized and
+ * the registered defines are never moved, so the defines can be read by index from any thread.
+ * The defines used on the hot paths of the materials are looked up once, when the program starts
+ * (e.g. StandardMaterialDefines::Index).
+ */
+class BABYLON_SHARED_EXPORT MaterialDefinesSchema {
+
+public:
+  template <typename T>
+  struct Table {
+    struct Define {
+      std::string name;
+      uint64_t key = 0;
+      T defaultValue{};
+    }; // end of struct Define
+
+    static constexpr size_t BlockSize = 64;
+    static constexpr size_t MaxBlocks = 64;
+
+    [[nodiscard]] const Define& operator[](size_t index) const
+    {
+      return (*blocks[index / BlockSize])[index % BlockSize];
+    }
+
+    /**
+     * @brief Returns the number of registered defines, all readable by index.
+     */
+    [[nodiscard]] size_t size() const
+    {
+      return count.load(std::memory_order_acquire);
+    }
+
+    std::array<std::unique_ptr<std::array<Define, BlockSize>>, MaxBlocks> blocks;
+    std::atomic<size_t> count{0};
+    std::unordered_map<std::string_view, size_t> indices;
+  }; // end of struct Table
+
+public:
+  MaterialDefinesSchema(std::initializer_list<std::pair<const char*, bool>> boolDefines = {},
+                        std::initializer_list<std::pair<const char*, int>> intDefines   = {});
+  MaterialDefinesSchema(const MaterialDefinesSchema& other) = delete;
+  MaterialDefinesSchema& operator=(const MaterialDefinesSchema& other) = delete;
+  ~MaterialDefinesSchema(); // = default
+
+  /**
+   * @brief Returns the schema used by the defines not declaring their own schema.
+   */
+  static MaterialDefinesSchema& Default();
+
+  /**
+   * @brief Returns the index of a boolean define, registering it if it is not declared yet.
+   */
+  size_t boolIndex(std::string_view name);
+
+  /**
+   * @brief Returns the index of a numeric define, registering it if it is not declared yet.
+   */
+  size_t intIndex(std::string_view name);
+
+  /**
+   * @brief Returns the index of a boolean define or -1 if it is not declared.
+   */
+  [[nodiscard]] int findBoolIndex(std::string_view name) const;
+
+  /**
+   * @brief Returns the index of a numeric define or -1 if it is not declared.
+   */
+  [[nodiscard]] int findIntIndex(std::string_view name) const;
+
+  /**
+   * @brief Returns the 64-bit key of a define name, the same on every run.
+   */
+  static uint64_t Key(std::string_view name, uint64_t seed);
+
+public:
+  Table<bool> boolDefines;
+  Table<int> intDefines;
+
+private:
+  mutable std::mutex _mutex;
+
+}; // end of class MaterialDefinesSchema
+
+/**
+ * @brief Boolean defines of a material, stored in a bitset following the order of the schema.
+ *
+ * Reading or writing a define through operator[] adds it to the set, like a map does. The hash
+ * is the xor of the keys of the defines set to true, updated on every change.
+ */
+class BABYLON_SHARED_EXPORT MaterialBoolDefines {
+
+public:
+  class Reference {
+
+  public:
+    Reference(MaterialBoolDefines& defines, size_t index) : _defines{defines}, _index{index}
+    {
+    }
+    Reference(const Reference& other) = default;
+
+    operator bool() const
+    {
+      return _defines.get(_index);
+    }
+
+    Reference& operator=(bool value)
+    {
+      _defines.set(_index, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+      return operator=(static_cast<bool>(other));
+    }
+
+  private:
+    MaterialBoolDefines& _defines;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  MaterialBoolDefines(MaterialDefinesSchema& schema = MaterialDefinesSchema::Default());
+
+  bool operator==(const MaterialBoolDefines& rhs) const;
+  bool operator!=(const MaterialBoolDefines& rhs) const;
+  Reference operator[](std::string_view name);
+
+  /**
+   * @brief Returns the define with the given index in the schema, without looking its name up.
+   */
+  Reference operator[](size_t index);
+
+  /**
+   * @brief Resets the defines to the declared ones, with their default values.
+   */
+  void reset(MaterialDefinesSchema& schema);
+
+  [[nodiscard]] bool contains(std::string_view name) const;
+  [[nodiscard]] bool at(std::string_view name) const;
+  size_t erase(std::string_view name);
+  [[nodiscard]] size_t size() const;
+
+  [[nodiscard]] bool get(size_t index) const
+  {
+    const auto word = index >> 6;
+    return word < _values.size() && ((_values[word] >> (index & 63)) & 1u);
+  }
+  void set(size_t index, bool value);
+
+  [[nodiscard]] uint64_t hash() const
+  {
+    return _hash;
+  }
+
+  [[nodiscard]] MaterialDefinesSchema& schema() const
+  {
+    return *_schema;
+  }
+
+  /**
+   * @brief Calls func(name, value) for each define of the set, in the order of the schema.
+   */
+  template <typename F>
+  void forEach(F&& func) const
+  {
+    for (size_t index = 0; index < (_present.size() << 6); ++index) {
+      if ((_present[index >> 6] >> (index & 63)) & 1u) {
+        func(std::string_view{_schema->boolDefines[index].name}, get(index));
+      }
+    }
+  }
+
+private:
+  void _reserve(size_t index);
+
+private:
+  MaterialDefinesSchema* _schema;
+  std::vector<uint64_t> _values;
+  std::vector<uint64_t> _present;
+  uint64_t _hash;
+
+}; // end of class MaterialBoolDefines
+
+/**
+ * @brief Numeric defines of a material, stored in an array following the order of the schema.
+ *
+ * Reading or writing a define through operator[] adds it to the set, like a map does. The hash
+ * is the xor of the (key, value) pairs of the defines of the set, updated on every change.
+ */
+class BABYLON_SHARED_EXPORT MaterialIntDefines {
+
+public:
+  class Reference {
+
+  public:
+    Reference(MaterialIntDefines& defines, size_t index) : _defines{defines}, _index{index}
+    {
+    }
+    Reference(const Reference& other) = default;
+
+    operator int() const
+    {
+      return _defines.get(_index);
+    }
+
+    Reference& operator=(int value)
+    {
+      _defines.set(_index, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+      return operator=(static_cast<int>(other));
+    }
+
+  private:
+    MaterialIntDefines& _defines;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  MaterialIntDefines(MaterialDefinesSchema& schema = MaterialDefinesSchema::Default());
+
+  bool operator==(const MaterialIntDefines& rhs) const;
+  bool operator!=(const MaterialIntDefines& rhs) const;
+  Reference operator[](std::string_view name);
+
+  /**
+   * @brief Returns the define with the given index in the schema, without looking its name up.
+   */
+  Reference operator[](size_t index);
+
+  /**
+   * @brief Resets the defines to the declared ones, with their default values.
+   */
+  void reset(MaterialDefinesSchema& schema);
+
+  [[nodiscard]] bool contains(std::string_view name) const;
+  [[nodiscard]] int at(std::string_view name) const;
+  size_t erase(std::string_view name);
+  [[nodiscard]] size_t size() const;
+
+  [[nodiscard]] int get(size_t index) const
+  {
+    return index < _values.size() ? _values[index] : 0;
+  }
+  void set(size_t index, int value);
+
+  [[nodiscard]] uint64_t hash() const
+  {
+    return _hash;
+  }
+
+  [[nodiscard]] MaterialDefinesSchema& schema() const
+  {
+    return *_schema;
+  }
+
+  /**
+   * @brief Calls func(name, value) for each define of the set, in the order of the schema.
+   */
+  template <typename F>
+  void forEach(F&& func) const
+  {
+    for (size_t index = 0; index < _values.size(); ++index) {
+      if (_present[index]) {
+        func(std::string_view{_schema->intDefines[index].name}, _values[index]);
+      }
+    }
+  }
+
+private:
+  void _reserve(size_t index);
+  uint64_t _contribution(size_t index) const;
+
+private:
+  MaterialDefinesSchema* _schema;
+  std::vector<int> _values;
+  std::vector<bool> _present;
+  uint64_t _hash;
+
+}; // end of class MaterialIntDefines
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINES_SCHEMA_H
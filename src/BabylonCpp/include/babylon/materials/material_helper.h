@@ -91,6 +91,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
                                 const std::string& key);
 
+  /**
+   * @brief Binds a texture matrix value to its corresponding uniform.
+   * @param texture The texture to bind the matrix for
+   * @param uniformBuffer The uniform buffer receiving the data
+   * @param uniformHandle The handle of the "<key>Matrix" uniform in the uniform buffer
+   */
+  static void BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
+                                int uniformHandle);
+
   /**
    * @brief Gets the current status of the fog (should it be enabled?).
    * @param mesh defines the mesh to evaluate for fog support
@@ -144,6 +153,14 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    */
   static void PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialDefines& defines);
 
+  /**
+   * @brief Prepares the defines for baked vertex animation, for the materials declaring the
+   * BAKED_VERTEX_ANIMATION_TEXTURE define.
+   * @param mesh The mesh containing the geometry data we will draw
+   * @param defines The defines to update
+   */
+  static void PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh, MaterialDefines& defines);
+
   /**
    * @brief Prepares the defines used in the shader depending on the attributes data available in
    * the mesh
@@ -304,6 +321,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void PrepareAttributesForBones(std::vector<std::string>& attribs, AbstractMesh* mesh,
                                         MaterialDefines& defines, EffectFallbacks& fallbacks);
 
+  /**
+   * @brief Prepares the list of attributes required for baked vertex animations according to the
+   * effect defines.
+   * @param attribs The current list of supported attribs
+   * @param defines The current Defines of the effect
+   */
+  static void PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                       MaterialDefines& defines);
+
   /**
    * @brief Check and prepare the list of attributes required for instances according to the effect
    * defines.
@@ -382,6 +408,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void BindBonesParameters(AbstractMesh* mesh, Effect* effect,
                                   const PrePassConfigurationPtr& prePassConfiguration = nullptr);
 
+  /**
+   * @brief Binds the baked vertex animation information from the mesh to the effect.
+   * @param mesh The mesh we are binding the information to render
+   * @param effect The effect we are binding the data to
+   * @param defines The current Defines of the effect
+   */
+  static void BindBakedVertexAnimationParameters(AbstractMesh* mesh, Effect* effect,
+                                                 MaterialDefines& defines);
+
   /**
    * @brief Copies the bones transformation matrices into the target array and returns the target's
    * reference.
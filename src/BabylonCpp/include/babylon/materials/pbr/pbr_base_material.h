@@ -274,6 +274,8 @@ private:
    */
   BaseTexturePtr _getReflectionTexture() const;
 
+  void _resolveEffectUniformHandles();
+
 public:
   /**
    * Enables realtime filtering on the texture.
@@ -774,6 +776,75 @@ private:
    */
   float debugFactor;
 
+  /**
+   * Handles of the uniforms of the material uniform buffer, resolved once in buildUniformLayout.
+   */
+  struct UniformBufferHandles {
+    int vAlbedoInfos                 = -1;
+    int vAmbientInfos                = -1;
+    int vOpacityInfos                = -1;
+    int vEmissiveInfos               = -1;
+    int vLightmapInfos               = -1;
+    int vReflectivityInfos           = -1;
+    int vMicroSurfaceSamplerInfos    = -1;
+    int vReflectionInfos             = -1;
+    int vReflectionFilteringInfo     = -1;
+    int vReflectionPosition          = -1;
+    int vReflectionSize              = -1;
+    int vBumpInfos                   = -1;
+    int albedoMatrix                 = -1;
+    int ambientMatrix                = -1;
+    int opacityMatrix                = -1;
+    int emissiveMatrix               = -1;
+    int lightmapMatrix               = -1;
+    int reflectivityMatrix           = -1;
+    int microSurfaceSamplerMatrix    = -1;
+    int bumpMatrix                   = -1;
+    int vTangentSpaceParams          = -1;
+    int reflectionMatrix             = -1;
+    int vReflectionColor             = -1;
+    int vAlbedoColor                 = -1;
+    int vLightingIntensity           = -1;
+    int vReflectionMicrosurfaceInfos = -1;
+    int pointSize                    = -1;
+    int vReflectivityColor           = -1;
+    int vEmissiveColor               = -1;
+    int visibility                   = -1;
+    int vMetallicReflectanceFactors  = -1;
+    int vMetallicReflectanceInfos    = -1;
+    int metallicReflectanceMatrix    = -1;
+  }; // end of struct UniformBufferHandles
+  UniformBufferHandles _uboHandles;
+
+  /**
+   * Handles of the effect uniforms bound on every draw, resolved once per active effect.
+   */
+  struct EffectUniformHandles {
+    int vEyePosition    = -1;
+    int vAmbientColor   = -1;
+    int vDebugMode      = -1;
+    int vSphericalL00   = -1;
+    int vSphericalL1_1  = -1;
+    int vSphericalL10   = -1;
+    int vSphericalL11   = -1;
+    int vSphericalL2_2  = -1;
+    int vSphericalL2_1  = -1;
+    int vSphericalL20   = -1;
+    int vSphericalL21   = -1;
+    int vSphericalL22   = -1;
+    int vSphericalX     = -1;
+    int vSphericalY     = -1;
+    int vSphericalZ     = -1;
+    int vSphericalXX_ZZ = -1;
+    int vSphericalYY_ZZ = -1;
+    int vSphericalZZ    = -1;
+    int vSphericalXY    = -1;
+    int vSphericalYZ    = -1;
+    int vSphericalZX    = -1;
+  }; // end of struct EffectUniformHandles
+  std::optional<size_t> _effectHandlesId;
+  EffectUniformHandles _effectHandles;
+
 }; // end of class PBRBaseMaterial
 
 } // end of namespace BABYLON
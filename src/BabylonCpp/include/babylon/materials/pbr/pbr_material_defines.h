@@ -30,6 +30,105 @@ struct BABYLON_SHARED_EXPORT PBRMaterialDefines : public IImageProcessingConfigu
    */
   [[nodiscard]] std::string toString() const override;
 
+  /**
+   * @brief Returns a 64-bit hash of the material define values.
+   * @returns - Hash of the material define values.
+   */
+  [[nodiscard]] uint64_t hash() const override;
+
+  /**
+   * @brief Indices of the defines used by the PBR materials on every frame, looked up once
+   * in the schema of the PBR material defines when the program starts.
+   */
+  struct BABYLON_SHARED_EXPORT Index {
+    // Boolean defines
+    static const size_t ALBEDO;
+    static const size_t ALPHABLEND;
+    static const size_t ALPHAFRESNEL;
+    static const size_t ALPHAFROMALBEDO;
+    static const size_t AMBIENT;
+    static const size_t AMBIENTINGRAYSCALE;
+    static const size_t AOSTOREINMETALMAPRED;
+    static const size_t BUMP;
+    static const size_t EMISSIVE;
+    static const size_t ENVIRONMENTBRDF;
+    static const size_t ENVIRONMENTBRDF_RGBD;
+    static const size_t FOG;
+    static const size_t FORCENORMALFORWARD;
+    static const size_t GAMMAALBEDO;
+    static const size_t GAMMALIGHTMAP;
+    static const size_t GAMMAREFLECTION;
+    static const size_t HORIZONOCCLUSION;
+    static const size_t INSTANCES;
+    static const size_t INVERTCUBICMAP;
+    static const size_t LIGHTMAP;
+    static const size_t LINEARALPHAFRESNEL;
+    static const size_t LINEARSPECULARREFLECTION;
+    static const size_t LODBASEDMICROSFURACE;
+    static const size_t LODINREFLECTIONALPHA;
+    static const size_t LOGARITHMICDEPTH;
+    static const size_t METALLICWORKFLOW;
+    static const size_t METALLIC_REFLECTANCE;
+    static const size_t METALLNESSSTOREINMETALMAPBLUE;
+    static const size_t MICROSURFACEAUTOMATIC;
+    static const size_t MICROSURFACEFROMREFLECTIVITYMAP;
+    static const size_t MICROSURFACEMAP;
+    static const size_t MORPHTARGETS;
+    static const size_t MULTIVIEW;
+    static const size_t NORMAL;
+    static const size_t OBJECTSPACE_NORMALMAP;
+    static const size_t OPACITY;
+    static const size_t OPACITYRGB;
+    static const size_t PARALLAX;
+    static const size_t PARALLAXOCCLUSION;
+    static const size_t POINTSIZE;
+    static const size_t PREMULTIPLYALPHA;
+    static const size_t PREPASS;
+    static const size_t RADIANCEOCCLUSION;
+    static const size_t RADIANCEOVERALPHA;
+    static const size_t REALTIME_FILTERING;
+    static const size_t REFLECTION;
+    static const size_t REFLECTIONMAP_3D;
+    static const size_t REFLECTIONMAP_CUBIC;
+    static const size_t REFLECTIONMAP_EQUIRECTANGULAR;
+    static const size_t REFLECTIONMAP_EQUIRECTANGULAR_FIXED;
+    static const size_t REFLECTIONMAP_EXPLICIT;
+    static const size_t REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED;
+    static const size_t REFLECTIONMAP_OPPOSITEZ;
+    static const size_t REFLECTIONMAP_PLANAR;
+    static const size_t REFLECTIONMAP_PROJECTION;
+    static const size_t REFLECTIONMAP_SKYBOX;
+    static const size_t REFLECTIONMAP_SPHERICAL;
+    static const size_t REFLECTIVITY;
+    static const size_t RGBDLIGHTMAP;
+    static const size_t RGBDREFLECTION;
+    static const size_t ROUGHNESSSTOREINMETALMAPALPHA;
+    static const size_t ROUGHNESSSTOREINMETALMAPGREEN;
+    static const size_t SPECULARAA;
+    static const size_t SPECULAROVERALPHA;
+    static const size_t SPECULARTERM;
+    static const size_t SPHERICAL_HARMONICS;
+    static const size_t SS_REFRACTION;
+    static const size_t TANGENT;
+    static const size_t THIN_INSTANCES;
+    static const size_t TWOSIDEDLIGHTING;
+    static const size_t UNLIT;
+    static const size_t USEGLTFLIGHTFALLOFF;
+    static const size_t USEIRRADIANCEMAP;
+    static const size_t USELIGHTMAPASSHADOWMAP;
+    static const size_t USEPHYSICALLIGHTFALLOFF;
+    static const size_t USESPHERICALFROMREFLECTIONMAP;
+    static const size_t USESPHERICALINVERTEX;
+    static const size_t USE_LOCAL_REFLECTIONMAP_CUBIC;
+    static const size_t UV1;
+    static const size_t UV2;
+    static const size_t VERTEXCOLOR;
+    // Numeric defines
+    static const size_t DEBUGMODE;
+    static const size_t NUM_MORPH_INFLUENCERS;
+    static const size_t NUM_SAMPLES;
+  }; // end of struct Index
+
 }; // end of struct PBRMaterialDefines
 
 } // end of namespace BABYLON
@@ -65,10 +65,19 @@ protected:
   void _afterBind(Mesh* mesh, const EffectPtr& effect = nullptr) override;
   bool _mustRebind(Scene* scene, const EffectPtr& effect, float visibility = 1.f);
 
+private:
+  void _resolveUniformHandles();
+
 protected:
   EffectPtr _activeEffect;
   Matrix _normalMatrix;
 
+private:
+  // Handles of the per mesh uniforms, resolved once per active effect
+  size_t _uniformHandlesEffectId;
+  int _worldHandle;
+  int _normalMatrixHandle;
+
 }; // end of class PushMaterial
 
 } // end of namespace BABYLON
@@ -768,6 +768,9 @@ protected:
    */
   ImageProcessingConfiguration* _imageProcessingConfiguration;
 
+private:
+  void _resolveEffectUniformHandles();
+
 private:
   OnCreatedEffectParameters onCreatedEffectParameters;
   BaseTexturePtr _diffuseTexture;
@@ -819,6 +822,54 @@ private:
    */
   Observer<ImageProcessingConfiguration>::Ptr _imageProcessingObserver;
 
+  /**
+   * Handles of the uniforms of the material uniform buffer, resolved once in buildUniformLayout.
+   */
+  struct UniformBufferHandles {
+    int diffuseLeftColor     = -1;
+    int diffuseRightColor    = -1;
+    int opacityParts         = -1;
+    int reflectionLeftColor  = -1;
+    int reflectionRightColor = -1;
+    int refractionLeftColor  = -1;
+    int refractionRightColor = -1;
+    int emissiveLeftColor    = -1;
+    int emissiveRightColor   = -1;
+    int vDiffuseInfos        = -1;
+    int vAmbientInfos        = -1;
+    int vOpacityInfos        = -1;
+    int vReflectionInfos     = -1;
+    int vReflectionPosition  = -1;
+    int vReflectionSize      = -1;
+    int vEmissiveInfos       = -1;
+    int vLightmapInfos       = -1;
+    int vSpecularInfos       = -1;
+    int vBumpInfos           = -1;
+    int diffuseMatrix        = -1;
+    int ambientMatrix        = -1;
+    int opacityMatrix        = -1;
+    int reflectionMatrix     = -1;
+    int emissiveMatrix       = -1;
+    int lightmapMatrix       = -1;
+    int specularMatrix       = -1;
+    int bumpMatrix           = -1;
+    int vTangentSpaceParams  = -1;
+    int pointSize            = -1;
+    int refractionMatrix     = -1;
+    int vRefractionInfos     = -1;
+    int vSpecularColor       = -1;
+    int vEmissiveColor       = -1;
+    int vDiffuseColor        = -1;
+  }; // end of struct UniformBufferHandles
+  UniformBufferHandles _uboHandles;
+
+  /**
+   * Handles of the effect uniforms bound on every draw, resolved once per active effect.
+   */
+  std::optional<size_t> _effectHandlesId;
+  int _alphaCutOffHandle;
+  int _ambientColorHandle;
+
 }; // end of class StandardMaterial
 
 } // end of namespace BABYLON
@@ -22,6 +22,76 @@ struct BABYLON_SHARED_EXPORT StandardMaterialDefines : public IImageProcessingCo
    */
   std::string toString() const override;
 
+  /**
+   * @brief Returns a 64-bit hash of the material define values.
+   * @returns - Hash of the material define values.
+   */
+  uint64_t hash() const override;
+
+  /**
+   * @brief Indices of the defines used by the standard material on every frame, looked up once
+   * in the schema of the standard material defines when the program starts.
+   */
+  struct BABYLON_SHARED_EXPORT Index {
+    // Boolean defines
+    static const size_t ALPHABLEND;
+    static const size_t ALPHAFROMDIFFUSE;
+    static const size_t ALPHATEST_AFTERALLALPHACOMPUTATIONS;
+    static const size_t AMBIENT;
+    static const size_t BUMP;
+    static const size_t DIFFUSE;
+    static const size_t DIFFUSEFRESNEL;
+    static const size_t EMISSIVE;
+    static const size_t EMISSIVEASILLUMINATION;
+    static const size_t EMISSIVEFRESNEL;
+    static const size_t FOG;
+    static const size_t FRESNEL;
+    static const size_t GLOSSINESS;
+    static const size_t INVERTCUBICMAP;
+    static const size_t IS_REFLECTION_LINEAR;
+    static const size_t IS_REFRACTION_LINEAR;
+    static const size_t LIGHTMAP;
+    static const size_t LINKEMISSIVEWITHDIFFUSE;
+    static const size_t LOGARITHMICDEPTH;
+    static const size_t MAINUV1;
+    static const size_t MAINUV2;
+    static const size_t MULTIVIEW;
+    static const size_t NORMAL;
+    static const size_t OBJECTSPACE_NORMALMAP;
+    static const size_t OPACITY;
+    static const size_t OPACITYFRESNEL;
+    static const size_t OPACITYRGB;
+    static const size_t PARALLAX;
+    static const size_t PARALLAXOCCLUSION;
+    static const size_t POINTSIZE;
+    static const size_t PREMULTIPLYALPHA;
+    static const size_t PREPASS;
+    static const size_t REFLECTION;
+    static const size_t REFLECTIONFRESNEL;
+    static const size_t REFLECTIONFRESNELFROMSPECULAR;
+    static const size_t REFLECTIONMAP_3D;
+    static const size_t REFLECTIONMAP_OPPOSITEZ;
+    static const size_t REFLECTIONOVERALPHA;
+    static const size_t REFRACTION;
+    static const size_t REFRACTIONFRESNEL;
+    static const size_t REFRACTIONMAP_3D;
+    static const size_t RGBDLIGHTMAP;
+    static const size_t RGBDREFLECTION;
+    static const size_t RGBDREFRACTION;
+    static const size_t ROUGHNESS;
+    static const size_t SPECULAR;
+    static const size_t SPECULAROVERALPHA;
+    static const size_t SPECULARTERM;
+    static const size_t TWOSIDEDLIGHTING;
+    static const size_t USELIGHTMAPASSHADOWMAP;
+    static const size_t USE_LOCAL_REFLECTIONMAP_CUBIC;
+    static const size_t UV1;
+    static const size_t UV2;
+    static const size_t VERTEXCOLOR;
+    // Numeric defines
+    static const size_t NUM_MORPH_INFLUENCERS;
+  }; // end of struct Index
+
 }; // end of struct StandardMaterialDefines
 
 } // end of namespace BABYLON
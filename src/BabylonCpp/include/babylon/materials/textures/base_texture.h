@@ -111,8 +111,12 @@ public:
   /**
    * @brief Hidden
    */
-  InternalTexturePtr _getFromCache(const std::string& url, bool noMipmap, unsigned int sampling = 0,
-                                   const std::optional<bool>& invertY = std::nullopt);
+  InternalTexturePtr _getFromCache(
+    const std::string& url, bool noMipmap, unsigned int sampling = 0,
+    const std::optional<bool>& invertY = std::nullopt,
+    const std::optional<std::variant<std::string, ArrayBuffer, ArrayBufferView, Image>>& buffer
+    = std::nullopt,
+    const std::optional<unsigned int>& format = std::nullopt);
   /**
    * @brief Hidden
    */
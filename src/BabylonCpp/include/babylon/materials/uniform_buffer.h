@@ -1,10 +1,11 @@
 #ifndef BABYLON_MATERIALS_UNIFORM_BUFFER_H
 #define BABYLON_MATERIALS_UNIFORM_BUFFER_H
 
-#include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
@@ -92,8 +93,17 @@ public:
    * shader for the layout to be correct !
    * @param name Name of the uniform, as used in the uniform block in the shader.
    * @param size Data size, or data directly.
+   * @returns the handle of the uniform, to use with the handle based update methods
    */
-  void addUniform(const std::string& name, const std::variant<int, Float32Array>& size);
+  int addUniform(const std::string& name, const std::variant<int, Float32Array>& size);
+
+  /**
+   * @brief Gets the handle of an uniform added to the buffer. The handle gives access to the
+   * uniform without looking up its name, its offset in the buffer is resolved once in `addUniform`.
+   * @param name Name of the uniform, as used in the uniform block in the shader.
+   * @returns the handle of the uniform or -1 if the uniform was not added
+   */
+  [[nodiscard]] int getUniformHandle(const std::string& name) const;
 
   /**
    * @brief Adds a Matrix 4x4 to the uniform buffer.
@@ -180,6 +190,15 @@ public:
    */
   void updateUniform(const std::string& uniformName, const Float32Array& data, size_t size);
 
+  /**
+   * @brief Updates the value of an uniform. The `update` method must be called afterwards to make
+   * it effective in the GPU.
+   * @param uniformHandle Define the handle of the uniform (see getUniformHandle).
+   * @param data Define the flattened data
+   * @param size Define the size of the data.
+   */
+  void updateUniform(int uniformHandle, const Float32Array& data, size_t size);
+
   /**
    * @brief Sets a sampler uniform on the effect.
    * @param name Define the name of the sampler.
@@ -213,37 +232,14 @@ private:
    */
   void _fillAlignment(size_t size);
 
+  // Adds the uniform on first use, as long as the buffer is not created
+  int _getOrAddUniform(const std::string& name, size_t size);
+
+  // Handle of the uniform in the current effect, when falling back on setUniformXXX calls
+  int _getEffectUniformHandle(int uniformHandle);
+
   // Matrix cache
-  bool _cacheMatrix(const std::string& name, const Matrix& matrix);
-
-  // Update methods
-  void _updateMatrix3x3ForUniform(const std::string& name, const Float32Array& matrix);
-  void _updateMatrix3x3ForEffect(const std::string& name, const Float32Array& matrix);
-  void _updateMatrix2x2ForEffect(const std::string& name, const Float32Array& matrix);
-  void _updateMatrix2x2ForUniform(const std::string& name, const Float32Array& matrix);
-  void _updateFloatForEffect(const std::string& name, float x);
-  void _updateFloatForUniform(const std::string& name, float x);
-  void _updateFloat2ForEffect(const std::string& name, float x, float y,
-                              const std::string& suffix = "");
-  void _updateFloat2ForUniform(const std::string& name, float x, float y);
-  void _updateFloat3ForEffect(const std::string& name, float x, float y, float z,
-                              const std::string& suffix = "");
-  void _updateFloat3ForUniform(const std::string& name, float x, float y, float z);
-  void _updateFloat4ForEffect(const std::string& name, float x, float y, float z, float w,
-                              const std::string& suffix = "");
-  void _updateFloat4ForUniform(const std::string& name, float x, float y, float z, float w);
-  void _updateMatrixForEffect(const std::string& name, const Matrix& mat);
-  void _updateMatrixForUniform(const std::string& name, const Matrix& mat);
-  void _updateVector3ForEffect(const std::string& name, const Vector3& vector);
-  void _updateVector3ForUniform(const std::string& name, const Vector3& vector);
-  void _updateVector4ForEffect(const std::string& name, const Vector4& vector);
-  void _updateVector4ForUniform(const std::string& name, const Vector4& vector);
-  void _updateColor3ForEffect(const std::string& name, const Color3& color,
-                              const std::string& suffix = "");
-  void _updateColor3ForUniform(const std::string& name, const Color3& color);
-  void _updateColor4ForEffect(const std::string& name, const Color3& color, float alpha,
-                              const std::string& suffix = "");
-  void _updateColor4ForUniform(const std::string& name, const Color3& color, float alpha);
+  bool _cacheMatrix(int uniformHandle, const Matrix& matrix);
 
 public:
   /**
@@ -252,88 +248,116 @@ public:
   bool _alreadyBound;
 
   /**
-   * Lambda to Update a 3x3 Matrix in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a 3x3 Matrix in the uniform buffer, or on the current effect when falling back
+   * on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader.
+   * @param matrix Define the flattened 3x3 matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)> updateMatrix3x3;
+  void updateMatrix3x3(const std::string& name, const Float32Array& matrix);
 
   /**
-   * Lambda to Update a 2x2 Matrix in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a 2x2 Matrix in the uniform buffer, or on the current effect when falling back
+   * on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader.
+   * @param matrix Define the flattened 2x2 matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)> updateMatrix2x2;
+  void updateMatrix2x2(const std::string& name, const Float32Array& matrix);
 
   /**
-   * Lambda to Update a single float in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a single float in the uniform buffer, or on the current effect when falling
+   * back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param x Define the value
    */
-  std::function<void(const std::string& name, float x)> updateFloat;
+  void updateFloat(const std::string& name, float x);
+  void updateFloat(int uniformHandle, float x);
 
   /**
-   * Lambda to Update a vec2 of float in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec2 of float in the uniform buffer, or on the current effect when falling
+   * back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param suffix Suffix of the effect uniform name, when falling back on setUniformXXX calls
    */
-  std::function<void(const std::string& name, float x, float y, const std::string& suffix)>
-    updateFloat2;
+  void updateFloat2(const std::string& name, float x, float y, const std::string& suffix = "");
+  void updateFloat2(int uniformHandle, float x, float y);
 
   /**
-   * Lambda to Update a vec3 of float in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec3 of float in the uniform buffer, or on the current effect when falling
+   * back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param suffix Suffix of the effect uniform name, when falling back on setUniformXXX calls
    */
-  std::function<void(const std::string& name, float x, float y, float z, const std::string& suffix)>
-    updateFloat3;
+  void updateFloat3(const std::string& name, float x, float y, float z,
+                    const std::string& suffix = "");
+  void updateFloat3(int uniformHandle, float x, float y, float z);
 
   /**
-   * Lambda to Update a vec4 of float in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec4 of float in the uniform buffer, or on the current effect when falling
+   * back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param suffix Suffix of the effect uniform name, when falling back on setUniformXXX calls
    */
-  std::function<void(const std::string& name, float x, float y, float z, float w,
-                     const std::string& suffix)>
-    updateFloat4;
+  void updateFloat4(const std::string& name, float x, float y, float z, float w,
+                    const std::string& suffix = "");
+  void updateFloat4(int uniformHandle, float x, float y, float z, float w);
 
   /**
-   * Lambda to Update a 4x4 Matrix in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a 4x4 Matrix in the uniform buffer, or on the current effect when falling back
+   * on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param mat Define the matrix
    */
-  std::function<void(const std::string& name, const Matrix& mat)> updateMatrix;
+  void updateMatrix(const std::string& name, const Matrix& mat);
+  void updateMatrix(int uniformHandle, const Matrix& mat);
 
   /**
-   * Lambda to Update vec3 of float from a Vector in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec3 of float from a Vector in the uniform buffer, or on the current effect
+   * when falling back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param vector Define the vector
    */
-  std::function<void(const std::string& name, const Vector3& vector)> updateVector3;
+  void updateVector3(const std::string& name, const Vector3& vector);
+  void updateVector3(int uniformHandle, const Vector3& vector);
 
   /**
-   * Lambda to Update vec4 of float from a Vector in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec4 of float from a Vector in the uniform buffer, or on the current effect
+   * when falling back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param vector Define the vector
    */
-  std::function<void(const std::string& name, const Vector4& vector)> updateVector4;
+  void updateVector4(const std::string& name, const Vector4& vector);
+  void updateVector4(int uniformHandle, const Vector4& vector);
 
   /**
-   * Lambda to Update vec3 of float from a Color in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec3 of float from a Color in the uniform buffer, or on the current effect
+   * when falling back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param color Define the color
+   * @param suffix Suffix of the effect uniform name, when falling back on setUniformXXX calls
    */
-  std::function<void(const std::string& name, const Color3& color, const std::string& suffix)>
-    updateColor3;
+  void updateColor3(const std::string& name, const Color3& color, const std::string& suffix = "");
+  void updateColor3(int uniformHandle, const Color3& color);
 
   /**
-   * Lambda to Update vec4 of float from a Color in a uniform buffer.
-   * This is dynamic to allow compat with webgl 1 and 2.
-   * You will need to pass the name of the uniform as well as the value.
+   * @brief Updates a vec4 of float from a Color in the uniform buffer, or on the current effect
+   * when falling back on setUniformXXX calls.
+   * @param name Name of the uniform, as used in the uniform block in the shader (or its handle, see
+   * getUniformHandle).
+   * @param color Define the rgb components
+   * @param alpha Define the a component
+   * @param suffix Suffix of the effect uniform name, when falling back on setUniformXXX calls
    */
-  std::function<void(const std::string& name, const Color3& color, float alpha,
-                     const std::string& suffix)>
-    updateColor4;
+  void updateColor4(const std::string& name, const Color3& color, float alpha,
+                    const std::string& suffix = "");
+  void updateColor4(int uniformHandle, const Color3& color, float alpha);
 
 private:
   Engine* _engine;
@@ -341,17 +365,25 @@ private:
   Float32Array _data;
   Float32Array _bufferData;
   bool _dynamic;
-  std::unordered_map<std::string, size_t> _uniformLocations;
-  std::unordered_map<std::string, size_t> _uniformSizes;
+  struct Uniform {
+    std::string name;
+    size_t location = 0;
+    size_t size     = 0;
+    // Matrix cache
+    std::optional<int> updateFlag = std::nullopt;
+    // Handle in the current effect, when falling back on setUniformXXX calls
+    std::optional<size_t> effectId = std::nullopt;
+    int effectHandle               = -1;
+  };
+  // Uniforms indexed by handle
+  std::vector<Uniform> _uniforms;
+  std::unordered_map<std::string, int> _uniformHandles;
   size_t _uniformLocationPointer;
   bool _needSync;
   bool _noUBO;
   Effect* _currentEffect;
   std::string _name;
 
-  // Matrix cache
-  std::unordered_map<std::string, int> _valueCache;
-
   // Pool for avoiding memory leaks
   static constexpr unsigned int _MAX_UNIFORM_SIZE = 256;
   static Float32Array _tempBuffer;
@@ -2,6 +2,7 @@
 #define BABYLON_MATHS_MATRIX_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -528,6 +529,17 @@ public:
   static void ComposeToRef(const Vector3& scale, const Quaternion& rotation,
                            const Vector3& translation, Matrix& result);
 
+  /**
+   * @brief Multiplies several matrices stored in an array by the same matrix, in one call.
+   * @param matrices defines the source array (16 floats per matrix)
+   * @param other defines the matrix to multiply each source matrix with (right operand)
+   * @param result defines the target array (can be the source array)
+   * @param count defines the number of matrices to multiply
+   * @param offset defines the offset of the first matrix in both arrays
+   */
+  static void MultiplyArrayToRef(const Float32Array& matrices, const Matrix& other,
+                                 Float32Array& result, size_t count, size_t offset = 0);
+
   /**
    * @brief Creates a new identity matrix.
    * @returns a new identity matrix
@@ -1037,7 +1049,7 @@ public:
   int updateFlag;
 
 private:
-  static int _updateFlagSeed;
+  static std::atomic<int> _updateFlagSeed;
   static Matrix _identityReadOnly;
   bool _isIdentity;
   bool _isIdentityDirty;
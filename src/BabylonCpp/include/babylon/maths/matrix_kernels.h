@@ -0,0 +1,88 @@
+#ifndef BABYLON_MATHS_MATRIX_KERNELS_H
+#define BABYLON_MATHS_MATRIX_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Set of low level kernels used by the Matrix and Vector3 hot paths. The matrices are
+ * arrays of 16 floats, stored in the same (row major) order as Matrix::m().
+ *
+ * The implementation is selected once at runtime from the capabilities of the CPU (AVX, SSE2,
+ * NEON or scalar). The vectorized kernels perform the same floating point operations in the same
+ * order as the scalar ones (no fused multiply-add), so all the implementations give bit identical
+ * results. The destination of every kernel can alias its sources.
+ */
+struct BABYLON_SHARED_EXPORT MatrixKernels {
+
+  /**
+   * Name of the instruction set used by the kernels
+   */
+  const char* name;
+
+  /**
+   * Computes result = a * b
+   */
+  void (*multiply)(const float* a, const float* b, float* result);
+
+  /**
+   * Computes result[i] = matrices[i] * other for count contiguous matrices
+   */
+  void (*multiplyArray)(const float* matrices, const float* other, float* result, size_t count);
+
+  /**
+   * Computes result[i] = a[i] * b[i] for count contiguous pairs of matrices
+   */
+  void (*multiplyPairs)(const float* a, const float* b, float* result, size_t count);
+
+  /**
+   * Computes the world matrices of a hierarchy sorted so that parents come before their children:
+   * worlds[i] = locals[i] * worlds[parents[i]], or locals[i] * root for the roots (parents[i] < 0,
+   * root may be null for identity). worlds can not alias locals.
+   */
+  void (*multiplyHierarchy)(const float* locals, const int32_t* parents, const float* root,
+                            float* worlds, size_t count);
+
+  /**
+   * Computes the inverse of m into result, returns false (result untouched) when m is not
+   * invertible
+   */
+  bool (*invert)(const float* m, float* result);
+
+  /**
+   * Composes a scale, a rotation quaternion (x, y, z, w) and a translation into result
+   */
+  void (*compose)(const float* scale, const float* rotation, const float* translation,
+                  float* result);
+
+  /**
+   * Transforms count contiguous (x, y, z) positions by m, including the perspective divide
+   */
+  void (*transformCoordinates)(const float* positions, const float* m, float* result,
+                               size_t count);
+
+  /**
+   * @brief Returns the best kernels supported by the current CPU.
+   */
+  static const MatrixKernels& Get();
+
+  /**
+   * @brief Returns the scalar (reference) kernels.
+   */
+  static const MatrixKernels& Scalar();
+
+  /**
+   * @brief Returns all the kernels supported by the current CPU, scalar first.
+   */
+  static std::vector<const MatrixKernels*> Supported();
+
+}; // end of struct MatrixKernels
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATHS_MATRIX_KERNELS_H
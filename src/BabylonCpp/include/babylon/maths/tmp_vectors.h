@@ -3,8 +3,6 @@
 
 #include <array>
 
-#include <babylon/babylon_api.h>
-
 namespace BABYLON {
 
 class Color3;
@@ -17,21 +15,22 @@ class Vector4;
 
 /**
  * @brief Temporary pre-allocated objects for engine internal use.
+ * The objects are thread local so that engine code running on worker threads can use them.
  * Hidden
  */
-struct BABYLON_SHARED_EXPORT TmpVectors {
-  static std::array<Color3, 3> Color3Array;
-  static std::array<Color4, 3> Color4Array;
+struct TmpVectors {
+  static thread_local std::array<Color3, 3> Color3Array;
+  static thread_local std::array<Color4, 3> Color4Array;
   // 3 temp Vector2 at once should be enough
-  static std::array<Vector2, 3> Vector2Array;
+  static thread_local std::array<Vector2, 3> Vector2Array;
   // 13 temp Vector3 at once should be enough
-  static std::array<Vector3, 13> Vector3Array;
+  static thread_local std::array<Vector3, 13> Vector3Array;
   // 3 temp Vector4 at once should be enough
-  static std::array<Vector4, 3> Vector4Array;
+  static thread_local std::array<Vector4, 3> Vector4Array;
   // 2 temp Quaternion at once should be enough
-  static std::array<Quaternion, 2> QuaternionArray;
+  static thread_local std::array<Quaternion, 2> QuaternionArray;
   // 8 temp Matrices at once should be enough
-  static std::array<Matrix, 8> MatrixArray;
+  static thread_local std::array<Matrix, 8> MatrixArray;
 }; // end of struct TmpVectors
 
 } // end of namespace BABYLON
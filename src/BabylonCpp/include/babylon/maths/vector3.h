@@ -734,6 +734,17 @@ public:
   static void TransformCoordinatesFromFloatsToRef(float x, float y, float z,
                                                   const Matrix& transformation, Vector3& result);
 
+  /**
+   * @brief Transforms all the (x, y, z) coordinates of an array by the given matrix, in one call.
+   * This method computes tranformed coordinates only, not transformed direction vectors.
+   * @param positions defines the source coordinates (3 floats per vector)
+   * @param transformation defines the transformation matrix
+   * @param result defines the array where to store the result (can be the source array, resized if
+   * smaller than the source array)
+   */
+  static void TransformCoordinatesArrayToRef(const Float32Array& positions,
+                                             const Matrix& transformation, Float32Array& result);
+
   /**
    * @brief Returns a new Vector3 set with the result of the normal transformation by the given
    * matrix of the given vector. This methods computes transformed normalized direction vectors only
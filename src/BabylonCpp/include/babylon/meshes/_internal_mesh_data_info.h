@@ -10,11 +10,13 @@
 
 namespace BABYLON {
 
+class BakedVertexAnimationManager;
 class Mesh;
 class MeshLODLevel;
 class MorphTargetManager;
-using MeshLODLevelPtr       = std::shared_ptr<MeshLODLevel>;
-using MorphTargetManagerPtr = std::shared_ptr<MorphTargetManager>;
+using BakedVertexAnimationManagerPtr = std::shared_ptr<BakedVertexAnimationManager>;
+using MeshLODLevelPtr                = std::shared_ptr<MeshLODLevel>;
+using MorphTargetManagerPtr          = std::shared_ptr<MorphTargetManager>;
 
 /**
  * @brief Hidden
@@ -43,6 +45,9 @@ struct BABYLON_SHARED_EXPORT _InternalMeshDataInfo {
 
   // Morph
   MorphTargetManagerPtr _morphTargetManager = nullptr;
+
+  // Baked vertex animation
+  BakedVertexAnimationManagerPtr _bakedVertexAnimationManager = nullptr;
 }; // end of struct _InternalMeshDataInfo
 
 } // end of namespace BABYLON
@@ -1,6 +1,8 @@
 #ifndef BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
 #define BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +16,21 @@ namespace BABYLON {
 class Buffer;
 using BufferPtr = std::shared_ptr<Buffer>;
 
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT _ThinInstanceDirtyRange {
+  // Range of floats modified since the last upload, empty when start >= end
+  size_t start = std::numeric_limits<size_t>::max();
+  size_t end   = 0;
+
+  void add(size_t offset, size_t count)
+  {
+    start = std::min(start, offset);
+    end   = std::max(end, offset + count);
+  }
+}; // end of struct _ThinInstanceDirtyRange
+
 /**
  * @brief Hidden
  */
@@ -24,6 +41,7 @@ struct BABYLON_SHARED_EXPORT _ThinInstanceDataStorage {
   Float32Array matrixData              = {};
   std::vector<Vector3> boundingVectors = {};
   std::optional<std::vector<Matrix>> worldMatrices = std::nullopt;
+  _ThinInstanceDirtyRange matrixDirtyRange         = {};
 }; // end of struct _ThinInstanceDataStorage
 
 } // end of namespace BABYLON
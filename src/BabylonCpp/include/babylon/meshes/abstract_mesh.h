@@ -67,7 +67,7 @@ using WebGLVertexArrayObjectPtr = std::shared_ptr<WebGLVertexArrayObject>;
 struct UserInstancedBuffersStorage {
   std::unordered_map<std::string, Float32Array> data;
   std::unordered_map<std::string, size_t> sizes;
-  std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> vertexBuffers;
+  std::unordered_map<std::string, std::shared_ptr<VertexBuffer>> vertexBuffers;
   std::unordered_map<std::string, size_t> strides;
   std::optional<std::unordered_map<std::string, WebGLVertexArrayObjectPtr>> vertexArrayObjects
     = std::nullopt;
@@ -683,8 +683,11 @@ public:
 
   /**
    * @brief Hidden
+   * Only the triangles overlapping the volume swept by the collider (given in the local space of
+   * the mesh) are transformed and tested.
    */
   AbstractMesh& _collideForSubMesh(SubMesh* subMesh, const Matrix& transformMatrix,
+                                   const Vector3& localMinimum, const Vector3& localMaximum,
                                    Collider& collider);
 
   /**
@@ -704,6 +707,17 @@ public:
    */
   virtual bool _generatePointsArray();
 
+  /**
+   * @brief Hidden
+   * Gets the indices used for picking, without copying them.
+   */
+  virtual const IndicesArray& _getPickingIndices();
+
+  /**
+   * @brief Hidden
+   */
+  virtual void _resetTriangleBVHs();
+
   /**
    * @brief Checks if the passed Ray intersects with the mesh.
    * @param ray defines the ray to use
@@ -1957,10 +1971,11 @@ public:
   ReadOnlyProperty<AbstractMesh, ColliderPtr> collider;
 
   /**
-   * Object used to store instanced buffers defined by user
+   * Object used to store instanced buffers defined by user, the value of each registered kind
+   * (stride floats) for this mesh or instance
    * @see https://doc.babylonjs.com/how_to/how_to_use_instances#custom-buffers
    */
-  std::unordered_map<std::string, UserInstancedBuffersStoragePtr> instancedBuffers;
+  std::unordered_map<std::string, Float32Array> instancedBuffers;
 
 private:
   // Collisions
@@ -133,6 +133,26 @@ public:
                                     const std::optional<size_t>& vertexCount = std::nullopt,
                                     bool useBytes                            = false);
 
+  /**
+   * @brief Grows the data store of an updatable buffer to at least the given size. The underlying
+   * WebGL buffer is kept, so that the vertex buffers and the vertex array objects using it stay
+   * valid. The previous content is discarded when the data store grows.
+   * @param byteLength defines the minimum byte length of the data store
+   * @returns true if the data store was reallocated
+   */
+  bool reserve(size_t byteLength);
+
+  /**
+   * @brief Updates a range of the buffer in place, without copying the data.
+   * @param data defines the data to upload, starting at byteOffset in the buffer
+   * @param byteOffset defines the byte offset of the range in the buffer
+   * @param byteLength defines the byte length of the range
+   * @param discard defines whether the content outside of the range can be discarded
+   * @returns the underlying WebGL buffer
+   */
+  WebGLDataBufferPtr updateRange(const float* data, size_t byteOffset, size_t byteLength,
+                                 bool discard = false);
+
   /**
    * @brief Hidden
    */
@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <map>
+#include <mutex>
 #include <nlohmann/json_fwd.hpp>
 
 #include <babylon/babylon_api.h>
@@ -25,6 +26,7 @@ class VertexData;
 FWD_CLASS_SPTR(Effect)
 FWD_CLASS_SPTR(Geometry)
 FWD_CLASS_SPTR(Mesh)
+FWD_CLASS_SPTR(TriangleBVH)
 FWD_CLASS_SPTR(VertexBuffer)
 FWD_CLASS_SPTR(WebGLDataBuffer)
 using WebGLVertexArrayObjectPtr = std::shared_ptr<GL::IGLVertexArrayObject>;
@@ -155,11 +157,13 @@ public:
 
   /**
    * @brief Hidden
+   * @param overrideVertexArrayObjects defines the vertex array objects to use instead of the ones
+   * of the geometry (nullptr to use the ones of the geometry)
    */
   void
   _bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind,
         const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers,
-        std::unordered_map<std::string, WebGLVertexArrayObjectPtr>& overrideVertexArrayObjects);
+        std::unordered_map<std::string, WebGLVertexArrayObjectPtr>* overrideVertexArrayObjects);
 
   /**
    * @brief Gets total number of vertices.
@@ -297,6 +301,18 @@ public:
    */
   bool _generatePointsArray();
 
+  /**
+   * @brief Hidden
+   * Gets the triangle hierarchy used to pick a range of indices (of vertices when the geometry is
+   * unindexed), built from the points array on first use. Can be called concurrently.
+   */
+  TriangleBVHPtr _getTriangleBVH(size_t indexStart, size_t indexCount);
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVHs();
+
   /**
    * @brief Gets a value indicating if the geometry is disposed.
    * @returns true if the geometry was disposed
@@ -510,6 +526,9 @@ private:
   WebGLDataBufferPtr _indexBuffer;
   bool _indexBufferIsUpdatable;
   std::vector<Vector3> _positionsCache;
+  // Picking hierarchies, per range of indices
+  std::map<std::pair<size_t, size_t>, TriangleBVHPtr> _triangleBVHs;
+  std::mutex _triangleBVHsMutex;
 
 }; // end of class Geometry
 
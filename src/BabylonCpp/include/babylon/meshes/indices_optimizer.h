@@ -0,0 +1,99 @@
+#ifndef BABYLON_MESHES_INDICES_OPTIMIZER_H
+#define BABYLON_MESHES_INDICES_OPTIMIZER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Options of the indices optimization.
+ */
+struct BABYLON_SHARED_EXPORT IndicesOptimizerOptions {
+
+  /**
+   * Size of the simulated post transform vertex cache
+   */
+  size_t cacheSize = 32;
+
+  /**
+   * Whether the triangles are reordered to reduce the overdraw once optimized for the vertex
+   * cache
+   */
+  bool optimizeOverdraw = true;
+
+  /**
+   * Maximum degradation of the cache miss ratio accepted by the overdraw optimization (1.05
+   * means that the clusters of triangles may have 5% more cache misses)
+   */
+  float overdrawThreshold = 1.05f;
+
+  /**
+   * Whether the vertices are reordered in the order of their first use by the indices
+   */
+  bool optimizeVertexFetch = true;
+
+}; // end of struct IndicesOptimizerOptions
+
+/**
+ * @brief Reorders the triangles of a range of indices for the post transform vertex cache
+ * (Forsyth, "Linear-Speed Vertex Cache Optimisation"), then by clusters to reduce the overdraw
+ * (Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw"), and
+ * computes the vertex remap which makes the attribute fetches sequential.
+ *
+ * The triangles themselves are never changed, only their order (and the vertices they reference
+ * when remapped).
+ */
+struct BABYLON_SHARED_EXPORT IndicesOptimizer {
+
+  /**
+   * @brief Reorders the triangles for the post transform vertex cache.
+   * @param indices defines the indices to update
+   * @param indexStart defines the first index of the range to optimize
+   * @param indexCount defines the number of indices of the range (multiple of 3)
+   * @param cacheSize defines the size of the simulated cache
+   */
+  static void OptimizeVertexCache(IndicesArray& indices, size_t indexStart, size_t indexCount,
+                                  size_t cacheSize = 32);
+
+  /**
+   * @brief Reorders the clusters of triangles so that the ones facing outwards are drawn first.
+   * The range is expected to be optimized for the vertex cache.
+   * @param indices defines the indices to update
+   * @param indexStart defines the first index of the range to optimize
+   * @param indexCount defines the number of indices of the range (multiple of 3)
+   * @param positions defines the positions of the vertices (3 floats per vertex)
+   * @param cacheSize defines the size of the simulated cache
+   * @param threshold defines the maximum degradation of the cache miss ratio of a cluster
+   */
+  static void OptimizeOverdraw(IndicesArray& indices, size_t indexStart, size_t indexCount,
+                               const Float32Array& positions, size_t cacheSize = 32,
+                               float threshold = 1.05f);
+
+  /**
+   * @brief Computes the order of the vertices of a range in the order of their first use.
+   * @param indices defines the indices referencing the vertices
+   * @param indexStart defines the first index of the range
+   * @param indexCount defines the number of indices of the range
+   * @param verticesStart defines the first vertex of the range
+   * @param verticesCount defines the number of vertices of the range
+   * @returns for each new vertex of the range, the old vertex (the vertices of the range which
+   * are not referenced are kept at the end, in their order)
+   */
+  static Uint32Array OptimizeVertexFetch(const IndicesArray& indices, size_t indexStart,
+                                         size_t indexCount, size_t verticesStart,
+                                         size_t verticesCount);
+
+  /**
+   * @brief Returns the average number of vertex shader invocations per triangle with a FIFO
+   * cache (between 0.5 for a regular grid and 3).
+   * @param indices defines the indices
+   * @param cacheSize defines the size of the simulated cache
+   */
+  static float AverageCacheMissRatio(const IndicesArray& indices, size_t cacheSize = 32);
+
+}; // end of struct IndicesOptimizer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_INDICES_OPTIMIZER_H
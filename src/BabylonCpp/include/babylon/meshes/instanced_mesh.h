@@ -164,8 +164,9 @@ public:
 
   /**
    * @brief Hidden
+   * The points array of the source mesh, used by picking and collisions.
    */
-  std::vector<Vector3>& _positions();
+  std::vector<Vector3>& get__positions() override;
 
   /**
    * @brief This method recomputes and sets a new BoundingInfo to the mesh unless it is locked.
@@ -214,6 +215,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  const IndicesArray& _getPickingIndices() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVHs() override;
+
   /**
    * @brief Hidden
    */
@@ -5,13 +5,16 @@
 #include <babylon/babylon_fwd.h>
 #include <babylon/maths/isize.h>
 #include <babylon/maths/path3d.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
+#include <babylon/meshes/indices_optimizer.h>
 #include <babylon/meshes/vertex_data_constants.h>
 
 namespace BABYLON {
 
 struct _InstanceDataStorage;
+struct ISimplificationSettings;
 struct _InternalMeshDataInfo;
 struct _ThinInstanceDataStorage;
 struct _VisibleInstances;
@@ -21,6 +24,7 @@ class ICreateCapsuleOptions;
 class PolyhedronOptions;
 FWD_STRUCT_SPTR(_CreationDataStorage)
 FWD_STRUCT_SPTR(_InstancesBatch)
+FWD_CLASS_SPTR(BakedVertexAnimationManager)
 FWD_CLASS_SPTR(Buffer)
 FWD_CLASS_SPTR(Effect)
 FWD_CLASS_SPTR(Geometry)
@@ -43,6 +47,7 @@ struct _UserThinInstanceBuffersStorage {
   std::unordered_map<std::string, size_t> sizes;
   std::unordered_map<std::string, VertexBufferPtr> vertexBuffers;
   std::unordered_map<std::string, size_t> strides;
+  std::unordered_map<std::string, _ThinInstanceDirtyRange> dirtyRanges;
 }; // end of struct UserThinInstanceBuffersStorage
 
 struct SkinningValidationResult {
@@ -803,6 +808,12 @@ public:
    */
   void _thinInstanceUpdateBufferSize(const std::string& kind, size_t numInstances);
 
+  /**
+   * @brief Hidden
+   */
+  void _thinInstanceUploadBuffer(Buffer* buffer, const Float32Array& data, size_t usedSize,
+                                 _ThinInstanceDirtyRange& dirtyRange);
+
   /**
    * @brief Hidden
    */
@@ -969,6 +980,16 @@ public:
    */
   bool _generatePointsArray() override;
 
+  /**
+   * @brief Hidden
+   */
+  const IndicesArray& _getPickingIndices() override;
+
+  /**
+   * @brief Hidden
+   */
+  void _resetTriangleBVHs() override;
+
   /** Clone **/
 
   /**
@@ -1131,15 +1152,36 @@ public:
   Mesh& synchronizeInstances();
 
   /**
-   * @brief Optimization of the mesh's indices, in case a mesh has duplicated
-   * vertices. The function will only reorder the indices and will not remove
-   * unused vertices to avoid problems with submeshes. This should be used
-   * together with the simplification to avoid disappearing triangles.
+   * @brief Simplify the mesh according to the given array of settings.
+   * Function will return immediately and will simplify on the worker threads, the simplified
+   * meshes being added as LOD levels on the render thread.
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the simplification
+   * finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing                      = true,
+                 SimplificationType simplificationType        = SimplificationType::QUADRATIC,
+                 const std::function<void()>& successCallback = nullptr);
+
+  /**
+   * @brief Optimization of the mesh's indices for the GPU. The triangles of each submesh are
+   * reordered for the post transform vertex cache, then by clusters to reduce the overdraw, and
+   * the vertices are reordered in the order of their first use so that the attribute fetches stay
+   * sequential. The triangles themselves and the submeshes are unchanged.
+   *
+   * The vertices are only reordered when the submeshes use distinct ranges of vertices and the
+   * mesh has no morph targets. The other meshes sharing the geometry are expected to use the same
+   * submeshes.
    * @param successCallback an optional success callback to be called after the
    * optimization finished.
-   * @returns the current mesh
+   * @param options defines the steps of the optimization
    */
-  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
+  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback = nullptr,
+                       const IndicesOptimizerOptions& options = IndicesOptimizerOptions{});
 
   /**
    * @brief This function will remove some indices and vertices from a mesh. It
@@ -1914,6 +1956,18 @@ protected:
    */
   void set_morphTargetManager(const MorphTargetManagerPtr& value);
 
+  /**
+   * @brief Gets the baked vertex animation manager.
+   * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+   */
+  BakedVertexAnimationManagerPtr& get_bakedVertexAnimationManager();
+
+  /**
+   * @brief Sets the baked vertex animation manager.
+   * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+   */
+  void set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value);
+
   /**
    * @brief Gets the source mesh (the one used to clone this one from).
    */
@@ -2095,6 +2149,12 @@ public:
    */
   Property<Mesh, MorphTargetManagerPtr> morphTargetManager;
 
+  /**
+   * Gets or sets the baked vertex animation manager
+   * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+   */
+  Property<Mesh, BakedVertexAnimationManagerPtr> bakedVertexAnimationManager;
+
   /**
    * Hidden
    */
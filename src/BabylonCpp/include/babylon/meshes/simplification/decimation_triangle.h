@@ -7,21 +7,26 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Triangle of the mesh being decimated.
+ */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<DecimationVertex*, 3>& vertices);
   ~DecimationTriangle(); // = default
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  /** Errors of the collapse of the 3 edges, and their minimum */
+  std::array<double, 4> error;
   bool deleted;
   bool isDirty;
   float borderFactor;
   bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  /** First index of the triangle in the original mesh */
+  size_t originalOffset;
+  std::array<DecimationVertex*, 3> vertices;
 
 }; // end of class DecimationTriangle
 
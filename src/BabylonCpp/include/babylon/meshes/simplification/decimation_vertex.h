@@ -7,6 +7,10 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Vertex of the mesh being decimated, i.e. the vertices of the original mesh sharing the
+ * same position.
+ */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
 public:
@@ -22,7 +26,8 @@ public:
   bool isBorder;
   int triangleStart;
   int triangleCount;
-  Float32Array originalOffsets;
+  /** Vertices of the original mesh */
+  Uint32Array originalOffsets;
 
 }; // end of class DecimationVertex
 
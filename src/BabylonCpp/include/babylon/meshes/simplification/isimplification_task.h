@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFICATION_TASK_H
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -25,9 +26,9 @@ struct BABYLON_SHARED_EXPORT ISimplificationTask {
    */
   SimplificationType simplificationType;
   /**
-   * Mesh to simplify
+   * Mesh to simplify, the task is dropped when the mesh is disposed before it is done
    */
-  Mesh* mesh = nullptr;
+  std::weak_ptr<Mesh> mesh;
   /**
    * Callback called on success
    */
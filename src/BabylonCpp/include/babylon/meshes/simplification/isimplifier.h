@@ -1,10 +1,16 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 
+#include <functional>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
 
 namespace BABYLON {
 
+struct ISimplificationSettings;
+FWD_CLASS_SPTR(Mesh)
+
 /**
  * @brief A simplifier interface for future simplification implementations
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
@@ -12,14 +18,17 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
   /**
    * @brief Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs async.
+   * Since this requires computation, the simplification does not access the scene so that it can
+   * run on a worker thread, and the simplified mesh is created by the returned function, which
+   * must be called on the render thread.
    * @param settings The settings of the simplification, including quality and distance
-   * @param successCallback A callback that will be called after the mesh was simplified.
-   * @param errorCallback in case of an error, this callback will be called. optional.
+   * @returns the function creating the simplified mesh
    */
-  virtual void simplify() = 0;
+  virtual std::function<MeshPtr()> simplify(const ISimplificationSettings& settings) = 0;
 
 }; // end of class ISimplifier
 
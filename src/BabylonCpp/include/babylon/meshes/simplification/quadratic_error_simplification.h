@@ -1,11 +1,17 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <memory>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
 #include <babylon/meshes/simplification/isimplifier.h>
 
 namespace BABYLON {
 
+class Mesh;
+class VertexData;
+
 /**
  * @brief An implementation of the Quadratic Error simplification algorithm.
  * Original paper : http://www1.cs.columbia.edu/~cs4162/html05s/garland97.pdf
@@ -17,8 +23,66 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * @brief Range of a submesh of the simplified mesh.
+   */
+  struct SubMeshRange {
+    unsigned int materialIndex = 0;
+    unsigned int verticesStart = 0;
+    size_t verticesCount       = 0;
+    unsigned int indexStart    = 0;
+    size_t indexCount          = 0;
+  }; // end of struct SubMeshRange
+
+public:
+  /**
+   * @brief Creates a new simplifier for the given mesh. The vertex data of the mesh is copied, so
+   * that the simplifications do not access the mesh.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplification of the mesh according to the given settings.
+   * @param settings The settings of the simplification, including quality and distance
+   * @returns the function creating the simplified mesh (to call on the render thread)
+   */
+  std::function<MeshPtr()> simplify(const ISimplificationSettings& settings) override;
+
+  /**
+   * @brief Decimates each submesh of the mesh until the expected quality is reached.
+   * @param settings The settings of the simplification, including quality and distance
+   * @param subMeshes receives the submeshes of the decimated data
+   * @returns the decimated vertex data
+   */
+  std::unique_ptr<VertexData> decimate(const ISimplificationSettings& settings,
+                                       std::vector<SubMeshRange>& subMeshes) const;
+
+public:
+  /**
+   * Number of collapse iterations (in each one, the error threshold increases)
+   */
+  size_t decimationIterations;
+
+  /**
+   * Growth of the error threshold between the iterations
+   */
+  float aggressiveness;
+
+  /**
+   * Distance under which the positions are welded when the mesh is optimized
+   */
+  float weldingEpsilon;
+
+private:
+  Mesh* _mesh;
+  Float32Array _positions;
+  Float32Array _normals;
+  Float32Array _uvs;
+  Float32Array _colors;
+  IndicesArray _indices;
+  std::vector<SubMeshRange> _subMeshes;
 
 }; // end of class QuadraticErrorSimplification
 
@@ -7,30 +7,34 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Symmetric 4x4 matrix of the quadric error of a vertex (the 10 coefficients of the upper
+ * triangle), stored in double precision as the error is a difference of large values.
+ */
 class BABYLON_SHARED_EXPORT QuadraticMatrix {
 
 public:
   QuadraticMatrix();
-  QuadraticMatrix(const std::array<float, 10>& data);
+  QuadraticMatrix(const std::array<double, 10>& data);
   QuadraticMatrix(const QuadraticMatrix& other);
   QuadraticMatrix(QuadraticMatrix&& other);
   QuadraticMatrix& operator=(const QuadraticMatrix& other);
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
-  float det(unsigned int a11, unsigned int a12, unsigned int a13, //
-            unsigned int a21, unsigned int a22, int unsigned a23, //
-            int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  [[nodiscard]] double det(unsigned int a11, unsigned int a12, unsigned int a13, //
+                           unsigned int a21, unsigned int a22, unsigned int a23, //
+                           unsigned int a31, unsigned int a32, unsigned int a33  //
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
-  void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  void addArrayInPlace(const std::array<double, 10>& data);
+  [[nodiscard]] QuadraticMatrix add(const QuadraticMatrix& matrix) const;
 
-  static QuadraticMatrix FromData(float a, float b, float c, float d);
-  static std::array<float, 10> DataFromNumbers(float a, float b, float c, float d);
+  static QuadraticMatrix FromData(double a, double b, double c, double d);
+  static std::array<double, 10> DataFromNumbers(double a, double b, double c, double d);
 
-private:
-  std::array<float, 10> data;
+public:
+  std::array<double, 10> data;
 
 }; // end of class QuadraticMatrix
 
@@ -1,17 +1,25 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
 #include <queue>
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_fwd.h>
 #include <babylon/meshes/simplification/isimplification_task.h>
 
 namespace BABYLON {
 
 class ISimplifier;
+FWD_CLASS_SPTR(Mesh)
 
 /**
  * @brief Queue used to order the simplification tasks.
+ * The simplifications run on the worker threads of the default thread pool, and the simplified
+ * meshes are added as LOD levels of their mesh on the render thread, before the camera update.
  * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
@@ -40,8 +48,16 @@ public:
    */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the simplified meshes computed by the worker threads as LOD levels of the mesh of
+   * the running task, and executes the next task once all of them are added. Must be called on
+   * the render thread. The simplified meshes of a disposed mesh are dropped, and the failures of
+   * the simplifications are logged.
+   */
+  void publishSimplifiedMeshes();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  std::shared_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task, Mesh* mesh);
 
 public:
   /**
@@ -51,6 +67,13 @@ public:
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  // Running task, and the functions creating its simplified meshes not published yet (one per
+  // setting, or a single one for all the settings when they are processed one after the other)
+  std::optional<ISimplificationTask> _runningTask;
+  std::deque<std::future<std::vector<std::function<MeshPtr()>>>> _simplifications;
+  size_t _publishedSettings;
+  // Whether a simplification of the running task failed or its mesh was disposed
+  bool _runningTaskFailed;
 
 }; // end of class SimplificationQueue
 
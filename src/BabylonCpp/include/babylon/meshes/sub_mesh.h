@@ -14,6 +14,7 @@ class IntersectionInfo;
 class WebGLDataBuffer;
 FWD_STRUCT_SPTR(MaterialDefines)
 FWD_CLASS_SPTR(SubMesh)
+FWD_CLASS_SPTR(TriangleBVH)
 FWD_CLASS_SPTR(WebGLDataBuffer)
 
 /** @hidden */
@@ -116,6 +117,14 @@ public:
    */
   bool _checkCollision(const Collider& collider);
 
+  /**
+   * @brief Hidden
+   * Returns the triangle hierarchy of the submesh if the positions and indices are the ones of the
+   * geometry and the submesh is a large enough triangle list.
+   */
+  TriangleBVHPtr _getTriangleBVH(const std::vector<Vector3>& positions,
+                                 const IndicesArray& indices);
+
   /**
    * @brief Updates the submesh BoundingInfo.
    * @returns The Submesh.
@@ -302,12 +311,6 @@ public:
   bool createBoundingBox;
   size_t _linesIndexCount;
   /** @hidden */
-  std::vector<Vector3> _lastColliderWorldVertices;
-  /** @hidden */
-  std::vector<Plane> _trianglePlanes;
-  /** @hidden */
-  std::unique_ptr<Matrix> _lastColliderTransformMatrix;
-  /** @hidden */
   int _renderId;
   /** @hidden */
   int _alphaIndex;
@@ -423,6 +423,12 @@ public:
   TransformNode& unregisterAfterWorldMatrixUpdate(
     const std::function<void(TransformNode* mesh, EventState& es)>& func);
 
+  /**
+   * @brief Returns whether callbacks are registered to be called after the world matrix update.
+   * Hidden
+   */
+  [[nodiscard]] bool _hasAfterWorldMatrixUpdateObservers() const;
+
   /**
    * @brief Gets the position of the current mesh in camera space.
    * @param camera defines the camera to use
@@ -12,6 +12,7 @@
 namespace BABYLON {
 
 class DataView;
+class Mesh;
 class Scene;
 class ThinEngine;
 FWD_CLASS_SPTR(Buffer)
@@ -22,6 +23,7 @@ FWD_CLASS_SPTR(WebGLDataBuffer)
  */
 class BABYLON_SHARED_EXPORT VertexBuffer {
 
+  friend Mesh;
   friend Scene;
 
 public:
@@ -0,0 +1,77 @@
+#ifndef BABYLON_MESHES_VERTEX_WELDER_H
+#define BABYLON_MESHES_VERTEX_WELDER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Options of the vertex welding.
+ */
+struct BABYLON_SHARED_EXPORT VertexWelderOptions {
+
+  /**
+   * Two positions are equal if they differ by at most epsilon on each axis (0 means exact
+   * equality)
+   */
+  float epsilon = 1e-6f;
+
+  /**
+   * Optional normals (3 floats per vertex) which must also be equal for vertices to be welded
+   */
+  const Float32Array* normals = nullptr;
+  float normalEpsilon         = 1e-6f;
+
+  /**
+   * Optional uvs (2 floats per vertex) which must also be equal for vertices to be welded
+   */
+  const Float32Array* uvs = nullptr;
+  float uvEpsilon         = 1e-6f;
+
+  /**
+   * Optional colors (4 floats per vertex) which must also be equal for vertices to be welded
+   */
+  const Float32Array* colors = nullptr;
+  float colorEpsilon         = 1e-6f;
+
+  /**
+   * Whether the search of the equal vertices runs on the default thread pool
+   */
+  bool parallel = true;
+
+}; // end of struct VertexWelderOptions
+
+/**
+ * @brief Finds the vertices which are equal within a tolerance, using a spatial hash grid whose
+ * cells are 4 epsilon wide: a vertex is only compared to the vertices of its cell, and of the
+ * neighbouring cells when it is at less than epsilon of a border.
+ *
+ * Each vertex is welded to a vertex before it which is equal to it: the first one of its own
+ * cell, otherwise the first one of the neighbouring cells (which is not necessarily the lowest
+ * index among all the equal vertices). The welding is transitive. The result only depends on the
+ * data (not on the number of threads), and the time is roughly linear in the number of vertices.
+ */
+struct BABYLON_SHARED_EXPORT VertexWelder {
+
+  /**
+   * @brief Welds the vertices.
+   * @param positions defines the positions of the vertices (3 floats per vertex)
+   * @param options defines the tolerance and the attributes to compare
+   * @returns for each vertex, the index of the vertex kept for its group (i.e. remap[i] == i for
+   * the vertices to keep, and remap[i] < i for the ones to weld)
+   */
+  static Uint32Array Weld(const Float32Array& positions,
+                          const VertexWelderOptions& options = VertexWelderOptions{});
+
+  /**
+   * @brief Returns the indices of the vertices to keep (remap[i] == i), in increasing order.
+   * @param remap defines the result of Weld
+   */
+  static Uint32Array UniqueVertices(const Uint32Array& remap);
+
+}; // end of struct VertexWelder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_VERTEX_WELDER_H
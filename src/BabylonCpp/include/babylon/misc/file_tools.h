@@ -105,6 +105,17 @@ public:
    */
   static Image ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically = false);
 
+  /**
+   * @brief Converts a range of bytes to an image. The decoding does not depend on any global state
+   * and can run concurrently on worker threads.
+   * @param buffer the first byte of the image data
+   * @param byteLength the length of the image data in bytes
+   * @param flipVertically whether to flip the rows of the decoded image
+   * @return the decoded image
+   */
+  static Image ArrayBufferToImage(const uint8_t* buffer, size_t byteLength,
+                                  bool flipVertically = false);
+
   /**
    * @brief Converts an string to an image.
    * @param buffer the string holding the image data
@@ -33,14 +33,14 @@ public:
    */
   PerfCounter()
       : _startMonitoringTime{Time::highresTimepointNow()}
-      , _min{0}
-      , _max{0}
+      , _min{0.0}
+      , _max{0.0}
       , _average{0.0}
-      , _current{0}
+      , _current{0.0}
       , _totalValueCount{0}
-      , _totalAccumulated{0}
-      , _lastSecAverage{0}
-      , _lastSecAccumulated{0}
+      , _totalAccumulated{0.0}
+      , _lastSecAverage{0.0}
+      , _lastSecAccumulated{0.0}
       , _lastSecTime{Time::highresTimepointNow()}
       , _lastSecValueCount{0}
   {
@@ -55,7 +55,7 @@ public:
   /**
    * @brief Returns the smallest value ever.
    */
-  size_t min() const
+  double min() const
   {
     return _min;
   }
@@ -63,7 +63,7 @@ public:
   /**
    * @brief Returns the biggest value ever.
    */
-  size_t max() const
+  double max() const
   {
     return _max;
   }
@@ -85,9 +85,9 @@ public:
   }
 
   /**
-   * @brief Returns the current value.
+   * @brief Returns the current value (milliseconds for the time counters).
    */
-  size_t current() const
+  double current() const
   {
     return _current;
   }
@@ -95,7 +95,7 @@ public:
   /**
    * @brief Gets the accumulated total.
    */
-  size_t total() const
+  double total() const
   {
     return _totalAccumulated;
   }
@@ -134,7 +134,7 @@ public:
     if (!PerfCounter::Enabled) {
       return;
     }
-    _current += newCount;
+    _current += static_cast<double>(newCount);
     if (fetchResult) {
       _fetchResult();
     }
@@ -167,7 +167,7 @@ public:
     }
 
     auto currentTime = Time::highresTimepointNow();
-    _current         = Time::fpTimeDiff<size_t, std::milli>(_startMonitoringTime, currentTime);
+    _current         = Time::fpTimeDiff<double, std::milli>(_startMonitoringTime, currentTime);
 
     if (newFrame) {
       _fetchResult();
@@ -183,13 +183,12 @@ private:
     // Min/Max update
     _min     = std::min(_min, _current);
     _max     = std::max(_max, _current);
-    _average = static_cast<double>(_totalAccumulated) / static_cast<double>(_totalValueCount);
+    _average = _totalAccumulated / static_cast<double>(_totalValueCount);
 
     // Reset last sec?
     const auto now = Time::highresTimepointNow();
     if (Time::fpTimeDiff<double, std::milli>(_lastSecTime, now) > 1000.0) {
-      _lastSecAverage
-        = static_cast<double>(_lastSecAccumulated) / static_cast<double>(_lastSecValueCount);
+      _lastSecAverage     = _lastSecAccumulated / _lastSecValueCount;
       _lastSecTime        = now;
       _lastSecAccumulated = 0;
       _lastSecValueCount  = 0;
@@ -198,14 +197,14 @@ private:
 
 private:
   high_res_time_point_t _startMonitoringTime;
-  size_t _min;
-  size_t _max;
+  double _min;
+  double _max;
   double _average;
-  size_t _current;
+  double _current;
   size_t _totalValueCount;
-  size_t _totalAccumulated;
+  double _totalAccumulated;
   double _lastSecAverage;
-  size_t _lastSecAccumulated;
+  double _lastSecAccumulated;
   high_res_time_point_t _lastSecTime;
   double _lastSecValueCount;
 
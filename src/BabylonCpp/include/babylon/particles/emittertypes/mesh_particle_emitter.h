@@ -120,6 +120,8 @@ private:
   IndicesArray _indices;
   Float32Array _positions;
   Float32Array _normals;
+  // Only used when no particle is given, the normal is otherwise stored in the particle so that
+  // particles can be emitted concurrently
   Vector3 _storedNormal;
   AbstractMeshPtr _mesh;
 
@@ -1,6 +1,8 @@
 #ifndef BABYLON_PARTICLES_PARTICLE_H
 #define BABYLON_PARTICLES_PARTICLE_H
 
+#include <atomic>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_fwd.h>
 #include <babylon/maths/color4.h>
@@ -22,7 +24,7 @@ FWD_CLASS_SPTR(SubEmitter)
 class BABYLON_SHARED_EXPORT Particle {
 
 private:
-  static size_t _Count;
+  static std::atomic<size_t> _Count;
 
 public:
   /**
@@ -196,6 +198,9 @@ public:
   /** @hidden */
   std::optional<Vector3> _localPosition;
 
+  /** @hidden */
+  Vector3 _emitterNormal;
+
   /**
    * The particle system the particle belongs to.
    */
@@ -0,0 +1,53 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_SIMULATION_SCHEDULER_H
+#define BABYLON_PARTICLES_PARTICLE_SIMULATION_SCHEDULER_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class IParticleSystem;
+class ParticleSystem;
+class ThreadPool;
+
+/**
+ * @brief Animates a set of particle systems on the worker threads of a thread pool.
+ *
+ * The CPU particle systems are animated in three steps: the systems are checked and their emission
+ * is computed on the calling thread (ParticleSystem::_beginAnimate), then the particles of the
+ * independent systems are simulated in parallel, the update and vertex fill passes of the large
+ * systems being split in chunks (ParticleSystem::_simulateAnimate), and finally the sub-emitters
+ * are processed and the vertex buffers uploaded back on the calling thread
+ * (ParticleSystem::_endAnimate). The other systems (GPU particles, noise textures) are animated on
+ * the calling thread.
+ */
+class BABYLON_SHARED_EXPORT ParticleSimulationScheduler {
+
+public:
+  /**
+   * @brief Creates a particle simulation scheduler.
+   * @param threadPool defines the pool running the simulation
+   */
+  explicit ParticleSimulationScheduler(ThreadPool& threadPool);
+  ParticleSimulationScheduler(const ParticleSimulationScheduler& other) = delete;
+  ParticleSimulationScheduler& operator=(const ParticleSimulationScheduler& other) = delete;
+  ~ParticleSimulationScheduler(); // = default
+
+  /**
+   * @brief Animates the particle systems for the current frame, equivalent to calling
+   * IParticleSystem::animate on each of them.
+   * @param particleSystems defines the particle systems to animate
+   */
+  void animate(const std::vector<IParticleSystem*>& particleSystems);
+
+private:
+  ThreadPool& _threadPool;
+  // Systems simulated during the current call to animate
+  std::vector<ParticleSystem*> _simulatedSystems;
+
+}; // end of class ParticleSimulationScheduler
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_SIMULATION_SCHEDULER_H
@@ -0,0 +1,275 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_STORE_H
+#define BABYLON_PARTICLES_PARTICLE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class ColorGradient;
+class Particle;
+struct FactorGradient;
+
+/**
+ * @brief Parameters shared by all the particles during one update of a ParticleStore.
+ */
+struct BABYLON_SHARED_EXPORT ParticleStoreUpdate {
+  /** Time elapsed since the last update, in particle system units (ParticleSystem::updateSpeed) */
+  float updateSpeed = 0.01f;
+  /** Gravity applied to the direction of the particles */
+  Vector3 gravity;
+}; // end of struct ParticleStoreUpdate
+
+/**
+ * @brief Layout of the vertices written by ParticleStore::fillVertexData, matching the vertex
+ * buffer of ParticleSystem.
+ */
+struct BABYLON_SHARED_EXPORT ParticleStoreVertexLayout {
+  /** Number of floats per vertex */
+  size_t vertexSize = 10;
+  /** Whether a particle is a single instanced vertex (4 vertices with their offsets otherwise) */
+  bool useInstancing = true;
+  /** Whether the direction is written (non billboard and stretched billboard particles) */
+  bool direction = false;
+  /** Whether the initial direction of the particle is preferred, for non billboard particles */
+  bool initialDirection = false;
+  /** Offset added to the positions */
+  Vector3 worldOffset;
+}; // end of struct ParticleStoreVertexLayout
+
+/**
+ * @brief Structure of arrays holding the particles of a ParticleSystem, updated several particles
+ * at a time (4 with SSE2 / NEON).
+ *
+ * The update kernel implements the same steps as the default ParticleSystem::updateFunction: age,
+ * color step or color gradients, angular speed, velocity, limit velocity and drag gradients,
+ * gravity and size gradients. The gradients are sampled in lookup tables rebuilt by the
+ * set*Gradients methods; gradients defining a range of values ([factor1, factor2] or [color1,
+ * color2]) are evaluated with a random value picked once per particle.
+ */
+class BABYLON_SHARED_EXPORT ParticleStore {
+
+public:
+  /**
+   * Number of samples of the gradient lookup tables
+   */
+  static constexpr size_t GradientTableSize = 256;
+
+public:
+  ParticleStore();
+  ParticleStore(const ParticleStore& other);
+  ParticleStore(ParticleStore&& other);
+  ParticleStore& operator=(const ParticleStore& other);
+  ParticleStore& operator=(ParticleStore&& other);
+  ~ParticleStore(); // = default
+
+  /**
+   * @brief Gets the number of particles in the store.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Gets the maximum number of particles of the store.
+   */
+  [[nodiscard]] size_t capacity() const;
+
+  /**
+   * @brief Sets the maximum number of particles of the store, the particles above the new capacity
+   * are removed.
+   */
+  void setCapacity(size_t capacity);
+
+  /**
+   * @brief Removes all the particles from the store.
+   */
+  void clear();
+
+  /**
+   * @brief Adds a particle to the store.
+   * @param particle defines the initial state of the particle
+   * @param random defines the random value in [0, 1] used to evaluate the gradient ranges
+   * @returns the index of the particle, or capacity() if the store is full
+   */
+  size_t add(const Particle& particle, float random);
+
+  /**
+   * @brief Appends particles to the store, to be initialized with set. Different particles can be
+   * set concurrently.
+   * @param count defines the number of particles to append
+   * @returns the number of appended particles, limited by the capacity
+   */
+  size_t grow(size_t count);
+
+  /**
+   * @brief Sets the state of a particle of the store.
+   * @param index defines the index of the particle
+   * @param particle defines the state of the particle
+   * @param random defines the random value in [0, 1] used to evaluate the gradient ranges
+   */
+  void set(size_t index, const Particle& particle, float random);
+
+  /**
+   * @brief Sets the color gradients, an empty list uses the color step of the particles.
+   */
+  void setColorGradients(const std::vector<ColorGradient>& gradients);
+
+  /**
+   * @brief Sets the size gradients, an empty list keeps the initial size of the particles.
+   */
+  void setSizeGradients(const std::vector<FactorGradient>& gradients);
+
+  /**
+   * @brief Sets the angular speed gradients, an empty list keeps the initial angular speed of the
+   * particles.
+   */
+  void setAngularSpeedGradients(const std::vector<FactorGradient>& gradients);
+
+  /**
+   * @brief Sets the velocity gradients (factors applied to the direction of the particles).
+   */
+  void setVelocityGradients(const std::vector<FactorGradient>& gradients);
+
+  /**
+   * @brief Sets the limit velocity gradients.
+   * @param gradients defines the maximum velocity of the particles over their life time
+   * @param damping defines the factor applied to the direction of the particles faster than the
+   * limit
+   */
+  void setLimitVelocityGradients(const std::vector<FactorGradient>& gradients, float damping);
+
+  /**
+   * @brief Sets the drag gradients (fraction of the motion removed at each update).
+   */
+  void setDragGradients(const std::vector<FactorGradient>& gradients);
+
+  /**
+   * @brief Updates the particles in the range [begin, end). The particles reaching their life time
+   * are kept in the store until removeDeadParticles is called. Different ranges can be updated
+   * concurrently.
+   * @param update defines the parameters of the update
+   * @param begin defines the index of the first particle to update
+   * @param end defines the index after the last particle to update
+   */
+  void update(const ParticleStoreUpdate& update, size_t begin, size_t end);
+
+  /**
+   * @brief Updates all the particles.
+   * @param update defines the parameters of the update
+   */
+  void update(const ParticleStoreUpdate& update);
+
+  /**
+   * @brief Removes the particles which reached their life time, by moving the last particles in
+   * their place.
+   * @returns the number of removed particles
+   */
+  size_t removeDeadParticles();
+
+  /**
+   * @brief Writes the vertices of the particles in the range [begin, end). Different ranges can
+   * be written concurrently.
+   * @param vertexData defines the vertex buffer data, the vertices of the particle at index i start
+   * at i * layout.vertexSize (times 4 without instancing)
+   * @param layout defines the layout of the vertices
+   * @param begin defines the index of the first particle to write
+   * @param end defines the index after the last particle to write
+   */
+  void fillVertexData(float* vertexData, const ParticleStoreVertexLayout& layout, size_t begin,
+                      size_t end) const;
+
+  /**
+   * @brief Writes the vertices of all the particles.
+   * @param vertexData defines the vertex buffer data
+   * @param layout defines the layout of the vertices
+   */
+  void fillVertexData(float* vertexData, const ParticleStoreVertexLayout& layout) const;
+
+  /**
+   * @brief Gets the position of a particle.
+   */
+  [[nodiscard]] Vector3 position(size_t index) const;
+
+  /**
+   * @brief Gets the direction of a particle.
+   */
+  [[nodiscard]] Vector3 direction(size_t index) const;
+
+  /**
+   * @brief Gets the color of a particle.
+   */
+  [[nodiscard]] Color4 color(size_t index) const;
+
+  /**
+   * @brief Gets the age of a particle.
+   */
+  [[nodiscard]] float age(size_t index) const;
+
+  /**
+   * @brief Gets the life time of a particle.
+   */
+  [[nodiscard]] float lifeTime(size_t index) const;
+
+  /**
+   * @brief Gets the size of a particle.
+   */
+  [[nodiscard]] float particleSize(size_t index) const;
+
+  /**
+   * @brief Gets the angle of a particle.
+   */
+  [[nodiscard]] float angle(size_t index) const;
+
+  /**
+   * @brief Returns the name of the instruction set used by the update kernel.
+   */
+  static const char* KernelName();
+
+private:
+  /**
+   * Samples of a gradient over the life time of the particles (GradientTableSize + 1 values, the
+   * last sample is repeated). The second table is only filled for the gradients defining ranges.
+   */
+  struct GradientTable {
+    bool enabled = false;
+    bool range   = false;
+    std::vector<float> values1;
+    std::vector<float> values2;
+  };
+
+  static void _BuildFactorTable(const std::vector<FactorGradient>& gradients,
+                                GradientTable& table);
+  void _move(size_t from, size_t to);
+
+private:
+  size_t _count;
+  size_t _capacity;
+  // Motion
+  std::vector<float> _positionX, _positionY, _positionZ;
+  std::vector<float> _directionX, _directionY, _directionZ;
+  std::vector<float> _initialDirectionX, _initialDirectionY, _initialDirectionZ;
+  std::vector<uint8_t> _hasInitialDirection;
+  // Color
+  std::vector<float> _colorR, _colorG, _colorB, _colorA;
+  std::vector<float> _colorStepR, _colorStepG, _colorStepB, _colorStepA;
+  // Life
+  std::vector<float> _age, _lifeTime;
+  // Shape
+  std::vector<float> _sizes, _scaleX, _scaleY, _angle, _angularSpeed;
+  // Random value used to evaluate the gradient ranges
+  std::vector<float> _random;
+  // Gradients
+  GradientTable _colorGradientsR, _colorGradientsG, _colorGradientsB, _colorGradientsA;
+  GradientTable _sizeGradients, _angularSpeedGradients, _velocityGradients;
+  GradientTable _limitVelocityGradients, _dragGradients;
+  float _limitVelocityDamping;
+
+}; // end of class ParticleStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_STORE_H
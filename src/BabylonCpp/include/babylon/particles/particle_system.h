@@ -17,11 +17,13 @@ namespace GL {
 class IGLVertexArrayObject;
 }
 
-class Buffer;
 class Mesh;
 class Particle;
+class ParticleStore;
 class Scene;
 class ThinEngine;
+class ThreadPool;
+FWD_CLASS_SPTR(Buffer)
 FWD_CLASS_SPTR(Effect)
 FWD_CLASS_SPTR(VertexBuffer)
 FWD_CLASS_SPTR(WebGLDataBuffer)
@@ -446,6 +448,48 @@ public:
    */
   void animate(bool preWarmOnly = false) override;
 
+  /**
+   * @brief Hidden
+   * First step of animate, run on the render thread: checks the system and computes the number
+   * of particles to emit for the current frame.
+   * @returns true if the particles have to be simulated (see _simulateAnimate)
+   */
+  bool _beginAnimate(bool preWarmOnly = false);
+
+  /**
+   * @brief Hidden
+   * Second step of animate: updates and emits the particles and fills the vertex data. Different
+   * systems can be simulated concurrently. When a thread pool is given, the update and vertex fill
+   * passes of large systems are split in chunks processed by the pool.
+   */
+  void _simulateAnimate(ThreadPool* threadPool = nullptr);
+
+  /**
+   * @brief Hidden
+   * Last step of animate, run on the render thread: sub-emitters, stop notifications and upload of
+   * the vertex buffer.
+   */
+  void _endAnimate();
+
+  /**
+   * @brief Hidden
+   * Returns whether _simulateAnimate can run on a worker thread (noise textures are read back
+   * from the GPU during the update).
+   */
+  [[nodiscard]] bool _canSimulateOnWorkerThread();
+
+  /**
+   * @brief Hidden
+   * Vertex data filled by the last simulation step.
+   */
+  [[nodiscard]] const Float32Array& _getVertexData() const;
+
+  /**
+   * @brief Hidden
+   * Particles of the structure of arrays backend (nullptr if the store is not used).
+   */
+  [[nodiscard]] const ParticleStore* _getParticleStore() const;
+
   /**
    * @brief Rebuilds the particle system.
    */
@@ -557,10 +601,15 @@ private:
   // Start of sub system methods
   void _stopSubEmitters();
   Particle* _createParticle();
+  void _initializeParticle(Particle* particle);
   void _removeFromRoot();
   void _emitFromParticle(Particle* particle);
   // End of sub system methods
-  void _update(int newParticles);
+  void _updateEmitterWorldMatrix();
+  void _update(int newParticles, ThreadPool* threadPool);
+  bool _canUseParticleStore();
+  [[nodiscard]] bool _canEmitInParallel() const;
+  void _updateParticleStore(int newParticles, ThreadPool* threadPool);
   /** @hidden */
   EffectPtr _getEffect(unsigned int blendMode);
   void _appendParticleVertices(unsigned int offset, Particle* particle);
@@ -581,6 +630,25 @@ public:
    */
   std::function<void(std::vector<Particle*>& particles)> updateFunction;
 
+  /**
+   * Whether the particles are stored in a structure of arrays and updated by the vectorized kernel
+   * of ParticleStore instead of one Particle object at a time. In that mode updateFunction is not
+   * called and particles() stays empty. Noise textures, local emitters, animation sheets and ramp
+   * gradients are not supported by the store, the Particle objects are used when one of them is
+   * enabled. Switching between the two modes removes the active particles. (false by default)
+   */
+  bool useParticleStore;
+
+  /**
+   * Seed of the random streams used to emit the particles. Each frame, the new particles are
+   * emitted in chunks with their own random stream derived from the seed, so that the emission is
+   * deterministic whether the chunks are processed on one thread or several (see
+   * Scene::parallelParticlesAnimation). Defaults to the unique id of the system.
+   * Note: updateFunction, startDirectionFunction and startPositionFunction must be thread safe
+   * when the particle systems are animated in parallel.
+   */
+  uint32_t randomSeed;
+
   /**
    * This function can be defined to specify initial direction for every new
    * particle. It by default use the emitterType defined function
@@ -660,18 +728,17 @@ private:
   float _epsilon;
   size_t _capacity;
   std::vector<Particle*> _stockParticles;
-  int _newPartsExcess;
+  float _newPartsExcess;
   Float32Array _vertexData;
-  std::unique_ptr<Buffer> _vertexBuffer;
+  BufferPtr _vertexBuffer;
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
-  std::unique_ptr<Buffer> _spriteBuffer;
+  BufferPtr _spriteBuffer;
   WebGLDataBufferPtr _indexBuffer;
   EffectPtr _effect;
   std::unordered_map<unsigned int, EffectPtr> _customEffect;
   std::string _cachedDefines;
 
   Color4 _scaledColorStep;
-  Color4 _colorDiff;
   Vector3 _scaledDirection;
   Vector3 _scaledGravity;
   int _currentRenderId;
@@ -681,8 +748,8 @@ private:
 
   bool _started;
   bool _stopped;
-  int _actualFrame;
-  int _scaledUpdateSpeed;
+  float _actualFrame;
+  float _scaledUpdateSpeed;
   unsigned int _vertexBufferSize;
   int _rawTextureWidth;
   RawTexturePtr _rampGradientsTexture;
@@ -699,6 +766,18 @@ private:
   /** @hidden */
   Observable<Effect> _onBeforeDrawParticlesObservable;
 
+  // Structure of arrays backend (see useParticleStore)
+  bool _usingParticleStore;
+  std::unique_ptr<ParticleStore> _particleStore;
+
+  // State carried between _beginAnimate, _simulateAnimate and _endAnimate
+  bool _animatePreWarmOnly;
+  int _animateNewParticles;
+  uint64_t _emissionCounter;
+  // Copies of the particles which died with sub-emitters during the update, processed on the
+  // render thread
+  std::vector<Particle> _deadParticlesWithSubEmitters;
+
 }; // end of class ParticleSystem
 
 } // end of namespace BABYLON
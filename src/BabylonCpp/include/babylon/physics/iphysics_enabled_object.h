@@ -15,6 +15,11 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnabledObject : public AbstractMesh {
   Scene* getScene() const override          = 0;
   virtual bool hasBoundingInfo()            = 0;
   std::string getClassName() const override = 0;
+
+protected:
+  IPhysicsEnabledObject(const std::string& name, Scene* scene) : AbstractMesh{name, scene}
+  {
+  }
 }; // end of struct IPhysicsEnabledObject
 
 } // end of namespace BABYLON
@@ -31,8 +31,7 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnginePlugin {
   virtual void setGravity(const Vector3& gravity) = 0;
   virtual void setTimeStep(float timeStep)        = 0;
   [[nodiscard]] virtual float getTimeStep() const = 0;
-  virtual void executeStep(float delta,
-                           const std::vector<std::unique_ptr<PhysicsImpostor>>& impostors)
+  virtual void executeStep(float delta, const std::vector<PhysicsImpostorPtr>& impostors)
     = 0; // not forgetting pre and post events
   virtual void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
                             const Vector3& contactPoint)
@@ -0,0 +1,177 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_fwd.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/plugins/native/matrix3x3.h>
+
+namespace BABYLON {
+
+class TriangleBVH;
+FWD_CLASS_SPTR(CollisionShape)
+
+/**
+ * @brief Collision shape of a rigid body of the native physics plugin, in the space of the shape.
+ *
+ * The convex shapes are described by a core inflated by a radius: a sphere is a point with a
+ * radius, a capsule a segment with a radius, and the boxes, cylinders and convex hulls are convex
+ * polyhedra without radius. Triangle meshes are concave and can only be used by static bodies.
+ */
+class BABYLON_SHARED_EXPORT CollisionShape {
+
+public:
+  enum class Type {
+    Sphere,
+    Capsule,
+    Polyhedron,
+    TriangleMesh,
+  }; // end of enum class Type
+
+  /**
+   * Face of a polyhedron: the indices of its vertices, counter clockwise around its outward normal,
+   * and its plane (dot(normal, p) = offset).
+   */
+  struct Face {
+    std::vector<uint32_t> vertices;
+    Vector3 normal;
+    float offset;
+  }; // end of struct Face
+
+  /**
+   * Edge of a core with the index of its direction in edgeDirections.
+   */
+  struct Edge {
+    uint32_t a;
+    uint32_t b;
+    uint32_t direction;
+  }; // end of struct Edge
+
+  /**
+   * Mass properties of a shape for a density of 1.
+   */
+  struct MassProperties {
+    float volume;
+    Vector3 centerOfMass;
+    // Inertia tensor around the center of mass
+    Matrix3x3 inertia;
+  }; // end of struct MassProperties
+
+  /**
+   * Maximum number of vertices of a convex hull, larger hulls are simplified.
+   */
+  static constexpr size_t MaxHullVertices = 64;
+
+public:
+  /**
+   * @brief Creates a sphere centered on the origin.
+   */
+  static CollisionShapePtr CreateSphere(float radius);
+
+  /**
+   * @brief Creates a capsule centered on the origin, along the Y axis.
+   * @param radius defines the radius of the capsule
+   * @param halfHeight defines the half length of the segment between the two hemispheres
+   */
+  static CollisionShapePtr CreateCapsule(float radius, float halfHeight);
+
+  /**
+   * @brief Creates a box centered on the origin.
+   */
+  static CollisionShapePtr CreateBox(const Vector3& halfExtents);
+
+  /**
+   * @brief Creates a cylinder centered on the origin, along the Y axis, approximated by a prism.
+   */
+  static CollisionShapePtr CreateCylinder(float radius, float halfHeight, size_t segments = 16);
+
+  /**
+   * @brief Creates the convex hull of a point cloud. Returns nullptr when the points are
+   * coplanar.
+   */
+  static CollisionShapePtr CreateConvexHull(const std::vector<Vector3>& points);
+
+  /**
+   * @brief Creates a triangle mesh.
+   * @param positions defines the vertex positions
+   * @param indices defines the triangle list (empty for an unindexed list)
+   */
+  static CollisionShapePtr CreateTriangleMesh(std::vector<Vector3> positions,
+                                              IndicesArray indices);
+
+  CollisionShape(const CollisionShape& other) = delete;
+  CollisionShape& operator=(const CollisionShape& other) = delete;
+  ~CollisionShape(); // = default
+
+  /**
+   * @brief Computes the mass properties of the shape for a density of 1 (triangle meshes have no
+   * volume).
+   */
+  [[nodiscard]] MassProperties computeMassProperties() const;
+
+  /**
+   * @brief Computes the axis aligned bounds of the shape in its own space.
+   */
+  void computeBounds(Vector3& minimum, Vector3& maximum) const;
+
+  /**
+   * @brief Gets the radius of the sphere centered on the origin enclosing the shape.
+   */
+  [[nodiscard]] float boundingRadius() const;
+
+  /**
+   * @brief Intersects the shape with a ray, in the space of the shape.
+   * @param origin defines the origin of the ray
+   * @param direction defines the normalized direction of the ray
+   * @param maxDistance defines the length of the ray
+   * @param normal defines the normal of the surface at the hit
+   * @returns the distance of the hit, if any. Rays starting inside convex shapes do not hit them
+   */
+  std::optional<float> intersectsRay(const Vector3& origin, const Vector3& direction,
+                                     float maxDistance, Vector3& normal) const;
+
+protected:
+  CollisionShape(Type type, float radius);
+
+private:
+  void _finalizeCore();
+
+public:
+  /**
+   * Type of the shape
+   */
+  const Type type;
+
+  /**
+   * Radius inflating the core
+   */
+  const float radius;
+
+  /**
+   * Vertices of the core (or of the triangle mesh)
+   */
+  std::vector<Vector3> vertices;
+
+  /**
+   * Faces, edges and unique edge directions of the core
+   */
+  std::vector<Face> faces;
+  std::vector<Edge> edges;
+  std::vector<Vector3> edgeDirections;
+
+  /**
+   * Triangle list and hierarchy of a triangle mesh
+   */
+  IndicesArray indices;
+  std::unique_ptr<TriangleBVH> triangleBVH;
+
+}; // end of class CollisionShape
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
@@ -0,0 +1,170 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_MATRIX3X3_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_MATRIX3X3_H
+
+#include <array>
+#include <cmath>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Row major 3x3 matrix used by the native physics plugin for the rotations and the inertia
+ * tensors of the rigid bodies. Vectors are column vectors: transform computes M * v.
+ */
+struct BABYLON_SHARED_EXPORT Matrix3x3 {
+
+  std::array<float, 9> m{};
+
+  /**
+   * @brief Returns the zero matrix.
+   */
+  static Matrix3x3 Zero()
+  {
+    return Matrix3x3{};
+  }
+
+  /**
+   * @brief Returns a diagonal matrix.
+   */
+  static Matrix3x3 Diagonal(float x, float y, float z)
+  {
+    Matrix3x3 result;
+    result.m[0] = x;
+    result.m[4] = y;
+    result.m[8] = z;
+    return result;
+  }
+
+  /**
+   * @brief Returns the identity matrix.
+   */
+  static Matrix3x3 Identity()
+  {
+    return Diagonal(1.f, 1.f, 1.f);
+  }
+
+  /**
+   * @brief Returns the rotation matrix of a unit quaternion (same rotation as
+   * Quaternion::toRotationMatrix).
+   */
+  static Matrix3x3 FromQuaternion(const Quaternion& q)
+  {
+    const auto xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const auto xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const auto wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    Matrix3x3 result;
+    result.m = {{1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy),       //
+                 2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx),       //
+                 2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy)}};
+    return result;
+  }
+
+  /**
+   * @brief Returns the skew symmetric matrix of the cross product with v ([v]x * u = v x u).
+   */
+  static Matrix3x3 Skew(const Vector3& v)
+  {
+    Matrix3x3 result;
+    result.m = {{0.f, -v.z, v.y, v.z, 0.f, -v.x, -v.y, v.x, 0.f}};
+    return result;
+  }
+
+  /**
+   * @brief Returns M * v.
+   */
+  [[nodiscard]] Vector3 transform(const Vector3& v) const
+  {
+    return Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z, //
+                   m[3] * v.x + m[4] * v.y + m[5] * v.z, //
+                   m[6] * v.x + m[7] * v.y + m[8] * v.z);
+  }
+
+  /**
+   * @brief Returns transpose(M) * v (the inverse rotation for a rotation matrix).
+   */
+  [[nodiscard]] Vector3 transposeTransform(const Vector3& v) const
+  {
+    return Vector3(m[0] * v.x + m[3] * v.y + m[6] * v.z, //
+                   m[1] * v.x + m[4] * v.y + m[7] * v.z, //
+                   m[2] * v.x + m[5] * v.y + m[8] * v.z);
+  }
+
+  /**
+   * @brief Returns M * other.
+   */
+  [[nodiscard]] Matrix3x3 multiply(const Matrix3x3& other) const
+  {
+    Matrix3x3 result;
+    for (size_t row = 0; row < 3; ++row) {
+      for (size_t column = 0; column < 3; ++column) {
+        result.m[row * 3 + column] = m[row * 3] * other.m[column]
+                                     + m[row * 3 + 1] * other.m[3 + column]
+                                     + m[row * 3 + 2] * other.m[6 + column];
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the transpose of M.
+   */
+  [[nodiscard]] Matrix3x3 transpose() const
+  {
+    Matrix3x3 result;
+    result.m = {{m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]}};
+    return result;
+  }
+
+  /**
+   * @brief Returns M + other.
+   */
+  [[nodiscard]] Matrix3x3 add(const Matrix3x3& other) const
+  {
+    Matrix3x3 result;
+    for (size_t i = 0; i < 9; ++i) {
+      result.m[i] = m[i] + other.m[i];
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns M * scale.
+   */
+  [[nodiscard]] Matrix3x3 scale(float scale) const
+  {
+    Matrix3x3 result;
+    for (size_t i = 0; i < 9; ++i) {
+      result.m[i] = m[i] * scale;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Computes the inverse of M, returns false (result untouched) when M is not invertible.
+   */
+  bool invert(Matrix3x3& result) const
+  {
+    const auto c0  = m[4] * m[8] - m[5] * m[7];
+    const auto c1  = m[5] * m[6] - m[3] * m[8];
+    const auto c2  = m[3] * m[7] - m[4] * m[6];
+    const auto det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+    if (std::abs(det) <= 1e-20f) {
+      return false;
+    }
+    const auto invDet = 1.f / det;
+    result.m = {{c0 * invDet, (m[2] * m[7] - m[1] * m[8]) * invDet,
+                 (m[1] * m[5] - m[2] * m[4]) * invDet, c1 * invDet,
+                 (m[0] * m[8] - m[2] * m[6]) * invDet, (m[2] * m[3] - m[0] * m[5]) * invDet,
+                 c2 * invDet, (m[1] * m[6] - m[0] * m[7]) * invDet,
+                 (m[0] * m[4] - m[1] * m[3]) * invDet}};
+    return true;
+  }
+
+}; // end of struct Matrix3x3
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_MATRIX3X3_H
@@ -0,0 +1,109 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_NARROW_PHASE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_NARROW_PHASE_H
+
+#include <array>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/plugins/native/collision_shape.h>
+
+namespace BABYLON {
+
+/**
+ * @brief World space view of the core of a convex shape (or of a triangle), as used by the
+ * contact generation.
+ */
+struct BABYLON_SHARED_EXPORT ConvexPolytope {
+
+  /**
+   * @brief Returns the index of the vertex of the core farthest along a direction.
+   */
+  [[nodiscard]] size_t support(const Vector3& direction) const;
+
+  const Vector3* vertices = nullptr;
+  size_t vertexCount      = 0;
+  // Faces (the vertex loops) and their world planes
+  const CollisionShape::Face* faces = nullptr;
+  const Vector3* faceNormals        = nullptr;
+  const float* faceOffsets          = nullptr;
+  size_t faceCount                  = 0;
+  const CollisionShape::Edge* edges = nullptr;
+  size_t edgeCount                  = 0;
+  const Vector3* edgeDirections     = nullptr;
+  size_t edgeDirectionCount         = 0;
+  float radius                      = 0.f;
+  // Point inside the core
+  Vector3 center;
+
+}; // end of struct ConvexPolytope
+
+/**
+ * @brief Contact generation between convex shapes.
+ *
+ * Shapes with a radius are first tested with the distance between their cores (GJK), which gives
+ * exact contacts for spheres and capsules. Overlapping cores, and polyhedra, are tested with the
+ * separating axis theorem: a face axis gives the contacts of the incident feature clipped by the
+ * reference face, an edge axis the closest points of the two edges.
+ */
+class BABYLON_SHARED_EXPORT NarrowPhase {
+
+public:
+  /**
+   * Contact between two shapes A and B, in world space.
+   */
+  struct Contact {
+    // Points on the surfaces of A and B
+    Vector3 pointA;
+    Vector3 pointB;
+    // Normal pointing from A to B
+    Vector3 normal;
+    // Penetration depth, negative when the shapes are separated (by less than the margin)
+    float depth;
+  }; // end of struct Contact
+
+public:
+  /**
+   * @brief Computes the closest points of the cores of two convex shapes (GJK).
+   * @param a defines the first shape
+   * @param b defines the second shape
+   * @param pointA defines the closest point of the core of a
+   * @param pointB defines the closest point of the core of b
+   * @returns the distance between the cores, 0 when they overlap (the points are then undefined)
+   */
+  static float ClosestPoints(const ConvexPolytope& a, const ConvexPolytope& b, Vector3& pointA,
+                             Vector3& pointB);
+
+  /**
+   * @brief Generates the contacts between two convex shapes.
+   * @param a defines the first shape
+   * @param b defines the second shape
+   * @param margin defines the distance under which separated shapes get (speculative) contacts
+   * @param contacts defines the list the contacts are appended to
+   */
+  static void Collide(const ConvexPolytope& a, const ConvexPolytope& b, float margin,
+                      std::vector<Contact>& contacts);
+
+  /**
+   * @brief Generates the contacts between a convex shape and a triangle. The triangle is one sided,
+   * its normal facing the center of the convex shape.
+   * @param a defines the convex shape
+   * @param triangle defines the vertices of the triangle, in world space
+   * @param margin defines the distance under which separated shapes get (speculative) contacts
+   * @param contacts defines the list the contacts are appended to
+   */
+  static void CollideTriangle(const ConvexPolytope& a, const std::array<Vector3, 3>& triangle,
+                              float margin, std::vector<Contact>& contacts);
+
+  /**
+   * @brief Reduces a list of contacts to the deepest one and the ones spanning the largest area.
+   * @param contacts defines the list to reduce
+   * @param maxCount defines the maximum number of contacts to keep
+   */
+  static void ReduceContacts(std::vector<Contact>& contacts, size_t maxCount);
+
+}; // end of class NarrowPhase
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_NARROW_PHASE_H
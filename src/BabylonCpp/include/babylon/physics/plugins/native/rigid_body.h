@@ -0,0 +1,214 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/iphysics_body.h>
+#include <babylon/physics/plugins/native/collision_shape.h>
+#include <babylon/physics/plugins/native/matrix3x3.h>
+#include <babylon/physics/plugins/native/narrow_phase.h>
+
+namespace BABYLON {
+
+class PhysicsImpostor;
+
+/**
+ * @brief Rigid body of the native physics plugin.
+ *
+ * The state of the body (position, orientation and velocities) is the state of its center of
+ * mass. The origin of the body is the origin of the object it simulates (e.g. a mesh), located at
+ * originOffset in the space of the body. Bodies without mass are static.
+ */
+class BABYLON_SHARED_EXPORT RigidBody : public IPhysicsBody {
+
+public:
+  /**
+   * Collision shape of a body, and its cached world space data.
+   */
+  struct Shape {
+    CollisionShapePtr shape;
+    // Transformation of the shape in the space of the body
+    Vector3 localPosition;
+    Quaternion localRotation;
+    // Bounds of the shape in its own space
+    Vector3 localMinimum;
+    Vector3 localMaximum;
+    // World transformation of the shape
+    Vector3 worldPosition;
+    Quaternion worldRotation;
+    Matrix3x3 worldRotationMatrix;
+    // World space core (unused by triangle meshes)
+    std::vector<Vector3> worldVertices;
+    std::vector<Vector3> worldFaceNormals;
+    std::vector<float> worldFaceOffsets;
+    std::vector<Vector3> worldEdgeDirections;
+    // World space bounds
+    Vector3 minimum;
+    Vector3 maximum;
+
+    /**
+     * @brief Returns the world space view of the core of a convex shape.
+     */
+    [[nodiscard]] ConvexPolytope polytope() const;
+  }; // end of struct Shape
+
+public:
+  /**
+   * @brief Creates a new rigid body.
+   * @param id defines the stable identifier of the body, used to order the collision pairs
+   */
+  explicit RigidBody(size_t id);
+  RigidBody(const RigidBody& other) = delete;
+  RigidBody& operator=(const RigidBody& other) = delete;
+  virtual ~RigidBody(); // = default
+
+  /**
+   * @brief Adds a shape to the body. The mass properties are computed by setMass.
+   * @param shape defines the shape to add
+   * @param position defines the position of the shape relative to the origin of the body
+   * @param rotation defines the rotation of the shape relative to the origin of the body
+   */
+  void addShape(const CollisionShapePtr& shape, const Vector3& position,
+                const Quaternion& rotation);
+
+  /**
+   * @brief Sets the mass of the body, distributed on the volume of its shapes, and moves the center
+   * of mass of the body accordingly. A mass of 0 makes the body static.
+   */
+  void setMass(float mass);
+
+  /**
+   * @brief Sets the world transformation of the origin of the body.
+   */
+  void setOriginTransformation(const Vector3& originPosition, const Quaternion& originRotation);
+
+  /**
+   * @brief Gets the world position of the origin of the body.
+   */
+  [[nodiscard]] Vector3 originPosition() const;
+
+  /**
+   * @brief Updates the rotation matrix, world inertia, shapes and bounds from the position and
+   * orientation of the body.
+   */
+  void updateWorldData();
+
+  /**
+   * @brief Applies an impulse at a world space point.
+   */
+  void applyImpulseAt(const Vector3& impulse, const Vector3& point);
+
+  /**
+   * @brief Returns the velocity of a world space point of the body.
+   */
+  [[nodiscard]] Vector3 velocityAt(const Vector3& point) const;
+
+  /**
+   * @brief Returns whether the body is static (no mass).
+   */
+  [[nodiscard]] bool isStatic() const
+  {
+    return invMass == 0.f;
+  }
+
+  /**
+   * @brief Returns whether the body takes part in the simulation step (dynamic and awake).
+   */
+  [[nodiscard]] bool isActive() const
+  {
+    return invMass != 0.f && !isSleeping;
+  }
+
+  /** IPhysicsBody */
+  void setPosition(const Vector3& newPosition) override;
+  void setOrientation(const Quaternion& newRotation) override;
+  void setShapesDensity(float density) override;
+  void setupMass(int mass) override;
+  float mass() override;
+  void applyImpulse(const Vector3& position, const Vector3& force) override;
+  Vector3 angularVelocity() override;
+  void setAngularVelocity(const Vector3& velocity) override;
+  Vector3 linearVelocity() override;
+  void setLinearVelocity(const Vector3& velocity) override;
+  void sleep() override;
+  bool sleeping() override;
+  void awake() override;
+  void syncShapes() override;
+
+public:
+  /**
+   * Stable identifier of the body
+   */
+  const size_t id;
+
+  /**
+   * Index of the body in its world
+   */
+  size_t index;
+
+  /**
+   * Impostor simulated by the body, if any
+   */
+  PhysicsImpostor* impostor;
+
+  /**
+   * Shapes of the body
+   */
+  std::vector<Shape> shapes;
+
+  /**
+   * State of the center of mass
+   */
+  Vector3 position;
+  Quaternion orientation;
+  Matrix3x3 rotation;
+  Vector3 linearVel;
+  Vector3 angularVel;
+
+  /**
+   * Forces and torques accumulated until the next step
+   */
+  Vector3 force;
+  Vector3 torque;
+
+  /**
+   * Mass properties
+   */
+  float massValue;
+  float invMass;
+  Matrix3x3 invInertiaLocal;
+  Matrix3x3 invInertiaWorld;
+
+  /**
+   * Material and damping
+   */
+  float friction;
+  float restitution;
+  float linearDamping;
+  float angularDamping;
+
+  /**
+   * Position of the origin of the body in the space of the body
+   */
+  Vector3 originOffset;
+
+  /**
+   * Sleeping state
+   */
+  bool isSleeping;
+  float sleepTime;
+
+  /**
+   * World space bounds of the shapes
+   */
+  Vector3 minimum;
+  Vector3 maximum;
+
+}; // end of class RigidBody
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_H
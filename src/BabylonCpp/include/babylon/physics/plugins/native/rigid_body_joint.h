@@ -0,0 +1,176 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_JOINT_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_JOINT_H
+
+#include <array>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class RigidBody;
+
+/**
+ * @brief Joint between two rigid bodies of the native physics plugin.
+ *
+ * A joint is made of one dimensional velocity constraints (rows) rebuilt from the state of the
+ * bodies before each solve, and solved with sequential impulses together with the contacts. The
+ * position drift is corrected with a Baumgarte bias. The springs are soft, their force is applied
+ * as an impulse before the solve.
+ */
+class BABYLON_SHARED_EXPORT RigidBodyJoint {
+
+public:
+  enum class Type {
+    // Maximum (and minimum) distance between the pivots
+    Distance,
+    // Damped spring between the pivots
+    Spring,
+    // Common pivot
+    BallAndSocket,
+    // Common pivot and axis, free rotation around the axis
+    Hinge,
+    // Common pivot, constant angle between the axes, free rotations around the axes
+    Hinge2,
+    // Common pivot, constant angle between the axes
+    Universal,
+    // Common axis, free translation along and rotation around the axis
+    Slider,
+    // Common axis, free translation along the axis
+    Prismatic,
+    // No relative motion
+    Lock,
+  }; // end of enum class Type
+
+public:
+  /**
+   * @brief Creates a new joint between two bodies, in their current configuration.
+   * @param type defines the type of the joint
+   * @param bodyA defines the main body
+   * @param bodyB defines the connected body
+   * @param pivotA defines the pivot in the space of the origin of the main body
+   * @param pivotB defines the pivot in the space of the origin of the connected body
+   * @param axisA defines the axis in the space of the main body
+   * @param axisB defines the axis in the space of the connected body
+   * @param collision defines whether the two bodies keep colliding with each other
+   */
+  RigidBodyJoint(Type type, RigidBody* bodyA, RigidBody* bodyB, const Vector3& pivotA,
+                 const Vector3& pivotB, const Vector3& axisA, const Vector3& axisB,
+                 bool collision);
+  RigidBodyJoint(const RigidBodyJoint& other) = delete;
+  RigidBodyJoint& operator=(const RigidBodyJoint& other) = delete;
+  ~RigidBodyJoint(); // = default
+
+  /**
+   * @brief Sets a motor driving the joint.
+   * @param speed defines the target angular (or linear for the sliders) speed
+   * @param maxForce defines the maximum force (or torque) of the motor, 0 for unlimited
+   * @param motorIndex defines the motor to set (1 is the connected axis of the hinge2 joints)
+   */
+  void setMotor(float speed, float maxForce, unsigned int motorIndex);
+
+  /**
+   * @brief Sets the limits of the angle (of the translation for the sliders) of the joint.
+   * @param upperLimit defines the upper limit
+   * @param lowerLimit defines the lower limit
+   * @param motorIndex defines the degree of freedom to limit
+   */
+  void setLimit(float upperLimit, float lowerLimit, unsigned int motorIndex);
+
+  /**
+   * @brief Sets the distance limits of a distance joint, or the rest length of a spring.
+   */
+  void setDistanceLimits(float maxDistance, float minDistance);
+
+  /**
+   * @brief Sets the stiffness and the damping of a spring.
+   */
+  void setSpring(float stiffness, float damping);
+
+  /**
+   * @brief Returns the distance between the pivots of the bodies.
+   */
+  [[nodiscard]] float pivotDistance() const;
+
+  /**
+   * @brief Builds the rows of the joint and applies the impulses of the previous step.
+   */
+  void prepare(float dt);
+
+  /**
+   * @brief Runs one solver iteration on the rows of the joint.
+   */
+  void solve();
+
+private:
+  struct Row {
+    unsigned int slot;
+    Vector3 linearA;
+    Vector3 angularA;
+    Vector3 linearB;
+    Vector3 angularB;
+    // Inverse inertia times the angular jacobians
+    Vector3 inertiaAngularA;
+    Vector3 inertiaAngularB;
+    float effectiveMass;
+    float bias;
+    float lowerImpulse;
+    float upperImpulse;
+  }; // end of struct Row
+
+  struct Motor {
+    bool enabled   = false;
+    float speed    = 0.f;
+    float maxForce = 0.f;
+    bool limited   = false;
+    float lower    = 0.f;
+    float upper    = 0.f;
+  }; // end of struct Motor
+
+  static constexpr unsigned int MaxSlots = 12;
+
+  void _addRow(unsigned int slot, const Vector3& linearA, const Vector3& angularA,
+               const Vector3& linearB, const Vector3& angularB, float bias, float lowerImpulse,
+               float upperImpulse);
+  void _addLimitRows(unsigned int slot, float value, const Vector3& linearA,
+                     const Vector3& angularA, const Vector3& linearB, const Vector3& angularB,
+                     float lower, float upper, float dt);
+  void _applyImpulse(const Row& row, float impulse);
+
+public:
+  const Type type;
+  RigidBody* const bodyA;
+  RigidBody* const bodyB;
+  const bool collisionEnabled;
+
+private:
+  // Pivots in the space of the origins, and axes and reference vectors in the space of the bodies
+  Vector3 _pivotA;
+  Vector3 _pivotB;
+  Vector3 _axisA;
+  Vector3 _axisB;
+  Vector3 _referenceA;
+  Vector3 _referenceB;
+  // Initial relative rotation, position of the center of mass of B in the space of A, and angle
+  // between the axes
+  Quaternion _relativeRotation;
+  Vector3 _relativePosition;
+  float _axesDot;
+  // Distance limits, and spring parameters
+  float _maxDistance;
+  float _minDistance;
+  float _stiffness;
+  float _damping;
+  std::array<Motor, 2> _motors;
+  // Rows of the current step and accumulated impulses of each slot
+  std::array<Row, MaxSlots> _rows;
+  size_t _rowCount;
+  std::array<float, MaxSlots> _impulses;
+  std::array<bool, MaxSlots> _activeSlots;
+
+}; // end of class RigidBodyJoint
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_JOINT_H
@@ -0,0 +1,179 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_WORLD_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_WORLD_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/plugins/native/rigid_body_joint.h>
+#include <babylon/physics/plugins/native/sweep_and_prune.h>
+
+namespace BABYLON {
+
+class RigidBody;
+
+/**
+ * @brief Rigid body world of the native physics plugin.
+ *
+ * A step finds the overlapping bodies with a sweep and prune broadphase, generates their contacts
+ * in parallel, and groups the dynamic bodies connected by contacts or joints in islands. The
+ * islands are solved in parallel with sequential impulses, and put to sleep when all their bodies
+ * come to rest. Sleeping islands are skipped until an awake body touches them.
+ */
+class BABYLON_SHARED_EXPORT RigidBodyWorld {
+
+public:
+  /**
+   * Closest hit of a ray.
+   */
+  struct RaycastHit {
+    RigidBody* body = nullptr;
+    Vector3 point;
+    Vector3 normal;
+    float distance = 0.f;
+  }; // end of struct RaycastHit
+
+  /**
+   * Distance under which separated shapes get speculative contacts
+   */
+  static constexpr float ContactMargin = 0.02f;
+
+  /**
+   * Maximum number of contacts between two bodies
+   */
+  static constexpr size_t MaxManifoldPoints = 4;
+
+public:
+  RigidBodyWorld();
+  RigidBodyWorld(const RigidBodyWorld& other) = delete;
+  RigidBodyWorld& operator=(const RigidBodyWorld& other) = delete;
+  ~RigidBodyWorld(); // = default
+
+  /**
+   * @brief Sets the gravity and wakes up the bodies.
+   */
+  void setGravity(const Vector3& gravity);
+
+  /**
+   * @brief Gets the gravity.
+   */
+  [[nodiscard]] const Vector3& gravity() const;
+
+  /**
+   * @brief Sets the number of velocity iterations of the solver.
+   */
+  void setSolverIterations(size_t iterations);
+
+  /**
+   * @brief Gets the number of velocity iterations of the solver.
+   */
+  [[nodiscard]] size_t solverIterations() const;
+
+  /**
+   * @brief Creates a new (static and shapeless) body.
+   */
+  RigidBody* createBody();
+
+  /**
+   * @brief Removes a body, its joints, and wakes up the bodies it touched.
+   */
+  void removeBody(RigidBody* body);
+
+  /**
+   * @brief Creates a joint between two bodies.
+   * @see RigidBodyJoint
+   */
+  RigidBodyJoint* createJoint(RigidBodyJoint::Type type, RigidBody* bodyA, RigidBody* bodyB,
+                              const Vector3& pivotA, const Vector3& pivotB, const Vector3& axisA,
+                              const Vector3& axisB, bool collision);
+
+  /**
+   * @brief Removes a joint and wakes up its bodies.
+   */
+  void removeJoint(RigidBodyJoint* joint);
+
+  /**
+   * @brief Wakes up a body and the sleeping bodies it touches.
+   */
+  void wakeUpBody(RigidBody* body);
+
+  /**
+   * @brief Advances the simulation.
+   * @param dt defines the duration of the step in seconds
+   */
+  void step(float dt);
+
+  /**
+   * @brief Finds the closest hit of a segment.
+   * @param from defines the start of the segment
+   * @param to defines the end of the segment
+   * @param hit defines the closest hit, if any
+   * @returns whether the segment hits a body
+   */
+  bool raycast(const Vector3& from, const Vector3& to, RaycastHit& hit) const;
+
+  /**
+   * @brief Gets the bodies of the world.
+   */
+  [[nodiscard]] const std::vector<std::unique_ptr<RigidBody>>& bodies() const;
+
+private:
+  struct ContactPoint {
+    // Contact point in the space of body A, used to match the contacts of consecutive steps
+    Vector3 localPointA;
+    Vector3 rA;
+    Vector3 rB;
+    Vector3 normal;
+    Vector3 tangent0;
+    Vector3 tangent1;
+    float depth;
+    float normalMass;
+    float tangentMass0;
+    float tangentMass1;
+    float bias;
+    float normalImpulse;
+    float tangentImpulse0;
+    float tangentImpulse1;
+  }; // end of struct ContactPoint
+
+  struct Manifold {
+    RigidBody* bodyA = nullptr;
+    RigidBody* bodyB = nullptr;
+    std::array<ContactPoint, MaxManifoldPoints> points;
+    size_t pointCount = 0;
+    float friction    = 0.f;
+    float restitution = 0.f;
+  }; // end of struct Manifold
+
+  struct Island {
+    std::vector<RigidBody*> bodies;
+    std::vector<Manifold*> manifolds;
+    std::vector<RigidBodyJoint*> joints;
+  }; // end of struct Island
+
+  static uint64_t _PairKey(const RigidBody* bodyA, const RigidBody* bodyB);
+  void _collide(RigidBody* bodyA, RigidBody* bodyB, float dt, Manifold& manifold) const;
+  void _buildIslands();
+  void _solveIsland(Island& island, float dt) const;
+
+private:
+  Vector3 _gravity;
+  size_t _solverIterations;
+  size_t _nextBodyId;
+  std::vector<std::unique_ptr<RigidBody>> _bodies;
+  std::vector<std::unique_ptr<RigidBodyJoint>> _joints;
+  SweepAndPrune _broadphase;
+  std::vector<SweepAndPrune::Pair> _pairs;
+  std::unordered_map<uint64_t, Manifold> _manifolds;
+  std::vector<Island> _islands;
+  size_t _islandCount;
+
+}; // end of class RigidBodyWorld
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_RIGID_BODY_WORLD_H
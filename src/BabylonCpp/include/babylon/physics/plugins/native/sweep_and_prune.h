@@ -0,0 +1,60 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_SWEEP_AND_PRUNE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_SWEEP_AND_PRUNE_H
+
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class RigidBody;
+
+/**
+ * @brief Sweep and prune broadphase of the native physics plugin.
+ *
+ * The bodies are kept sorted by the minimum of their bounds along the axis of largest spread of
+ * their centers. As the bodies move little from one step to the next, the order is restored with
+ * an insertion sort in nearly linear time.
+ */
+class BABYLON_SHARED_EXPORT SweepAndPrune {
+
+public:
+  using Pair = std::pair<RigidBody*, RigidBody*>;
+
+public:
+  SweepAndPrune();
+  SweepAndPrune(const SweepAndPrune& other) = delete;
+  SweepAndPrune& operator=(const SweepAndPrune& other) = delete;
+  ~SweepAndPrune(); // = default
+
+  /**
+   * @brief Adds a body to the broadphase.
+   */
+  void addBody(RigidBody* body);
+
+  /**
+   * @brief Removes a body from the broadphase.
+   */
+  void removeBody(RigidBody* body);
+
+  /**
+   * @brief Finds the pairs of bodies whose bounds, inflated by a margin, overlap. Pairs of static
+   * bodies are skipped.
+   * @param margin defines the margin added to the bounds of the bodies
+   * @param pairs defines the list receiving the pairs, ordered by body identifier within a pair
+   */
+  void computePairs(float margin, std::vector<Pair>& pairs);
+
+private:
+  void _updateAxis();
+
+private:
+  std::vector<RigidBody*> _bodies;
+  unsigned int _axis;
+
+}; // end of class SweepAndPrune
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_SWEEP_AND_PRUNE_H
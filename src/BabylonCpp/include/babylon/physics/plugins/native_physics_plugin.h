@@ -0,0 +1,122 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+
+#include <memory>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/iphysics_engine_plugin.h>
+
+namespace BABYLON {
+
+class PhysicsJoint;
+class RigidBody;
+class RigidBodyJoint;
+class RigidBodyWorld;
+
+/**
+ * @brief Self-contained rigid body physics plugin.
+ *
+ * Supports the sphere, box, capsule, cylinder, plane, particle, convex hull, mesh and heightmap
+ * impostors (meshes and heightmaps are concave for static impostors, and approximated by their
+ * convex hull otherwise), compound impostors made of the impostors of the child meshes, and the
+ * joints of the physics engine. Soft bodies are not supported.
+ * @see RigidBodyWorld
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsPlugin : public IPhysicsEnginePlugin {
+
+public:
+  /**
+   * @brief Creates a new native physics plugin.
+   * @param solverIterations defines the number of velocity iterations of the solver
+   */
+  NativePhysicsPlugin(size_t solverIterations = 10);
+  NativePhysicsPlugin(const NativePhysicsPlugin& other) = delete;
+  NativePhysicsPlugin& operator=(const NativePhysicsPlugin& other) = delete;
+  ~NativePhysicsPlugin() override; // = default
+
+  void setGravity(const Vector3& gravity) override;
+  void setTimeStep(float timeStep) override;
+  [[nodiscard]] float getTimeStep() const override;
+
+  /**
+   * @brief Advances the simulation by sub-steps of at most the time step.
+   */
+  void executeStep(float delta, const std::vector<PhysicsImpostorPtr>& impostors) override;
+
+  void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                    const Vector3& contactPoint) override;
+  void applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                  const Vector3& contactPoint) override;
+  void generatePhysicsBody(const PhysicsImpostor& impostor) override;
+  void removePhysicsBody(const PhysicsImpostor& impostor) override;
+  void generateJoint(PhysicsImpostorJoint* impostorJoint) override;
+  void removeJoint(PhysicsImpostorJoint* impostorJoint) override;
+  bool isSupported() override;
+  void setTransformationFromPhysicsBody(const PhysicsImpostor& impostor) override;
+  void setPhysicsBodyTransformation(const PhysicsImpostor& impostor, const Vector3& newPosition,
+                                    const Quaternion& newRotation) override;
+  void setLinearVelocity(const PhysicsImpostor& impostor,
+                         const std::optional<Vector3>& velocity) override;
+  void setAngularVelocity(const PhysicsImpostor& impostor,
+                          const std::optional<Vector3>& velocity) override;
+  Vector3 getLinearVelocity(const PhysicsImpostor& impostor) override;
+  Vector3 getAngularVelocity(const PhysicsImpostor& impostor) override;
+  void setBodyMass(const PhysicsImpostor& impostor, float mass) override;
+  float getBodyMass(const PhysicsImpostor& impostor) override;
+  float getBodyFriction(const PhysicsImpostor& impostor) override;
+  void setBodyFriction(const PhysicsImpostor& impostor, float friction) override;
+  float getBodyRestitution(const PhysicsImpostor& impostor) override;
+  void setBodyRestitution(const PhysicsImpostor& impostor, float restitution) override;
+  float getBodyPressure(const PhysicsImpostor& impostor) override;
+  void setBodyPressure(const PhysicsImpostor& impostor, float pressure) override;
+  float getBodyStiffness(const PhysicsImpostor& impostor) override;
+  void setBodyStiffness(const PhysicsImpostor& impostor, float stiffness) override;
+  size_t getBodyVelocityIterations(const PhysicsImpostor& impostor) override;
+  void setBodyVelocityIterations(const PhysicsImpostor& impostor,
+                                 size_t velocityIterations) override;
+  size_t getBodyPositionIterations(const PhysicsImpostor& impostor) override;
+  void setBodyPositionIterations(const PhysicsImpostor& impostor,
+                                 size_t positionIterations) override;
+  void appendAnchor(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                    int width, int height, float influence,
+                    bool noCollisionBetweenLinkedBodies) override;
+  void appendHook(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                  float length, float influence, bool noCollisionBetweenLinkedBodies) override;
+  void sleepBody(const PhysicsImpostor& impostor) override;
+  void wakeUpBody(const PhysicsImpostor& impostor) override;
+
+  /**
+   * @brief Casts a ray and returns the closest hit of the bodies.
+   */
+  PhysicsRaycastResult raycast(const Vector3& from, const Vector3& to) override;
+
+  void updateDistanceJoint(DistanceJoint* joint, float maxDistance, float minDistance) override;
+  void setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                unsigned int motorIndex = 0) override;
+  void setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                unsigned int motorIndex = 0) override;
+  float getRadius(const PhysicsImpostor& impostor) override;
+  void getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result) override;
+  void syncMeshWithImpostor(AbstractMesh* mesh, const PhysicsImpostor& impostor) override;
+  void dispose() override;
+
+private:
+  RigidBody* _getBody(const PhysicsImpostor& impostor) const;
+  RigidBodyJoint* _getJoint(const PhysicsJoint* joint) const;
+  void _addShapes(PhysicsImpostor& impostor, RigidBody* body, const Vector3& originPosition,
+                  const Quaternion& inverseOriginRotation, float& mass);
+
+private:
+  std::unique_ptr<RigidBodyWorld> _world;
+  float _timeStep;
+  std::unordered_map<const PhysicsImpostor*, RigidBody*> _bodies;
+  std::unordered_map<const PhysicsJoint*, RigidBodyJoint*> _joints;
+
+}; // end of class NativePhysicsPlugin
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
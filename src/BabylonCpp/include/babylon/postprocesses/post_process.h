@@ -533,6 +533,7 @@ private:
   unsigned int _textureType;
   unsigned int _textureFormat;
   EffectPtr _effect;
+  int _scaleHandle;
   std::vector<std::string> _samplers;
   std::string _fragmentUrl;
   std::string _vertexUrl;
@@ -21,9 +21,9 @@ struct BABYLON_SHARED_EXPORT IEdgesRendererOptions {
   /**
    * Gets or sets a boolean indicating that the vertex merger fast processing must be used.
    * If not defined, the default value is true.
-   * You should normally leave it undefined (or set it to true), except if you see some artifacts in
-   * the edges rendering (can happen with complex geometries) This option is used only if
-   * useAlternateEdgeFinder = true
+   * The vertices are merged with the VertexWelder, which runs on the thread pool when this option
+   * is true, and on the calling thread otherwise (both give the same result). This option is used
+   * only if useAlternateEdgeFinder = true
    */
   std::optional<bool> useFastVertexMerger = std::nullopt;
 
@@ -16,6 +16,7 @@ attribute vec3 position;
 #endif
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -55,6 +56,7 @@ vec3 positionUpdated = position;
 
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
 vec4 worldPos = finalWorld * vec4(positionUpdated, 1.0);
 
@@ -0,0 +1,148 @@
+#include <babylon/bakedvertexanimation/baked_vertex_animation_manager.h>
+
+#include <babylon/engines/engine_store.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/textures/base_texture.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+
+namespace BABYLON {
+
+BakedVertexAnimationManager::BakedVertexAnimationManager(Scene* scene)
+    : texture{this, &BakedVertexAnimationManager::get_texture,
+              &BakedVertexAnimationManager::set_texture}
+    , isEnabled{this, &BakedVertexAnimationManager::get_isEnabled,
+                &BakedVertexAnimationManager::set_isEnabled}
+    , animationParameters{0.f, 0.f, 0.f, 30.f}
+    , time{0.f}
+    , _scene{scene ? scene : EngineStore::LastCreatedScene()}
+    , _texture{nullptr}
+    , _isEnabled{true}
+{
+}
+
+BakedVertexAnimationManager::~BakedVertexAnimationManager() = default;
+
+BaseTexturePtr& BakedVertexAnimationManager::get_texture()
+{
+  return _texture;
+}
+
+void BakedVertexAnimationManager::set_texture(const BaseTexturePtr& value)
+{
+  if (_texture == value) {
+    return;
+  }
+
+  _texture = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+bool BakedVertexAnimationManager::get_isEnabled() const
+{
+  return _isEnabled;
+}
+
+void BakedVertexAnimationManager::set_isEnabled(bool value)
+{
+  if (_isEnabled == value) {
+    return;
+  }
+
+  _isEnabled = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+void BakedVertexAnimationManager::_markSubMeshesAsAttributesDirty()
+{
+  if (!_scene) {
+    return;
+  }
+
+  for (const auto& abstractMesh : _scene->meshes) {
+    auto mesh = std::dynamic_pointer_cast<Mesh>(abstractMesh);
+    if (mesh && mesh->bakedVertexAnimationManager().get() == this) {
+      mesh->_markSubMeshesAsAttributesDirty();
+    }
+  }
+}
+
+void BakedVertexAnimationManager::setAnimationParameters(float startFrame, float endFrame,
+                                                         float offset, float speedFramesPerSecond)
+{
+  animationParameters.copyFromFloats(startFrame, endFrame, offset, speedFramesPerSecond);
+}
+
+void BakedVertexAnimationManager::bind(Effect* effect, bool useInstances)
+{
+  if (!effect || !_texture || !_isEnabled) {
+    return;
+  }
+
+  const auto& size = _texture->getSize();
+  effect->setFloat2("bakedVertexAnimationTextureSizeInverted", 1.f / static_cast<float>(size.width),
+                    1.f / static_cast<float>(size.height));
+  effect->setFloat("bakedVertexAnimationTime", time);
+
+  if (!useInstances) {
+    effect->setVector4("bakedVertexAnimationSettings", animationParameters);
+  }
+
+  effect->setTexture("bakedVertexAnimationTexture", _texture);
+}
+
+BakedVertexAnimationManagerPtr BakedVertexAnimationManager::clone() const
+{
+  auto copy                 = BakedVertexAnimationManager::New(_scene);
+  copy->_texture            = _texture;
+  copy->_isEnabled          = _isEnabled;
+  copy->animationParameters = animationParameters;
+  copy->time                = time;
+
+  return copy;
+}
+
+void BakedVertexAnimationManager::dispose(bool /*doNotRecurse*/, bool forceDisposeTextures)
+{
+  if (forceDisposeTextures && _texture) {
+    _texture->dispose();
+  }
+
+  _texture = nullptr;
+  _markSubMeshesAsAttributesDirty();
+}
+
+std::string BakedVertexAnimationManager::getClassName() const
+{
+  return "BakedVertexAnimationManager";
+}
+
+void BakedVertexAnimationManager::RegisterInstancedAttributes(Mesh& mesh)
+{
+  mesh.registerInstancedBuffer(AnimationSettingsInstancedKind, 4);
+
+  if (mesh.hasThinInstances()) {
+    mesh.thinInstanceRegisterAttribute(AnimationSettingsInstancedKind, 4);
+  }
+}
+
+void BakedVertexAnimationManager::SetInstanceAnimationParameters(InstancedMesh& instance,
+                                                                 float startFrame, float endFrame,
+                                                                 float offset,
+                                                                 float speedFramesPerSecond)
+{
+  instance.instancedBuffers[AnimationSettingsInstancedKind]
+    = {startFrame, endFrame, offset, speedFramesPerSecond};
+}
+
+bool BakedVertexAnimationManager::SetThinInstanceAnimationParameters(
+  Mesh& mesh, size_t index, float startFrame, float endFrame, float offset,
+  float speedFramesPerSecond, bool refresh)
+{
+  return mesh.thinInstanceSetAttributeAt(AnimationSettingsInstancedKind, index,
+                                         {startFrame, endFrame, offset, speedFramesPerSecond},
+                                         refresh);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,100 @@
+#include <babylon/bakedvertexanimation/vertex_animation_baker.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/meshes/mesh.h>
+
+namespace BABYLON {
+
+VertexAnimationBaker::VertexAnimationBaker(Scene* scene, Mesh* mesh) : _scene{scene}, _mesh{mesh}
+{
+}
+
+VertexAnimationBaker::~VertexAnimationBaker() = default;
+
+size_t VertexAnimationBaker::FrameCount(const std::vector<AnimationRange>& ranges)
+{
+  size_t frameCount = 0;
+  for (const auto& range : ranges) {
+    if (!std::isfinite(range.from) || !std::isfinite(range.to) || range.to < range.from) {
+      throw std::runtime_error("Invalid animation ranges.");
+    }
+    frameCount += static_cast<size_t>(std::floor(range.to - range.from)) + 1;
+  }
+
+  return frameCount;
+}
+
+ISize VertexAnimationBaker::TextureSize(size_t boneCount, size_t vertexDataSize)
+{
+  const auto width  = (boneCount + 1) * 4;
+  const auto height = vertexDataSize / (width * 4);
+
+  return ISize(static_cast<int>(width), static_cast<int>(height));
+}
+
+Float32Array VertexAnimationBaker::bakeVertexData(const std::vector<AnimationRange>& ranges)
+{
+  const auto& skeleton = _mesh ? _mesh->skeleton() : nullptr;
+  if (!skeleton) {
+    throw std::runtime_error("No skeleton in this mesh.");
+  }
+
+  const auto frameCount   = FrameCount(ranges);
+  const auto matricesSize = (skeleton->bones.size() + 1) * 16;
+  Float32Array vertexData(matricesSize * frameCount);
+
+  _scene->stopAnimation(_mesh);
+  skeleton->returnToRest();
+
+  // The frames are sampled directly instead of being rendered: each frame is applied to the bones
+  // with Animatable::goToFrame and the skin matrices are computed by the skeleton
+  size_t textureIndex = 0;
+  for (const auto& range : ranges) {
+    auto animatable = _scene->beginAnimation(skeleton, range.from, range.to, false, 1.f);
+    for (auto frameIndex = range.from; frameIndex <= range.to; frameIndex += 1.f) {
+      if (animatable) {
+        animatable->goToFrame(frameIndex);
+      }
+      skeleton->_markAsDirty();
+      skeleton->prepare();
+
+      const auto& skeletonMatrices = skeleton->getTransformMatrices(_mesh);
+      std::copy_n(skeletonMatrices.begin(), std::min(matricesSize, skeletonMatrices.size()),
+                  vertexData.begin() + static_cast<std::ptrdiff_t>(textureIndex * matricesSize));
+      ++textureIndex;
+    }
+    _scene->stopAnimation(skeleton);
+  }
+
+  skeleton->returnToRest();
+
+  return vertexData;
+}
+
+RawTexturePtr VertexAnimationBaker::textureFromBakedVertexData(const Float32Array& vertexData)
+{
+  const auto& skeleton = _mesh ? _mesh->skeleton() : nullptr;
+  if (!skeleton) {
+    throw std::runtime_error("No skeleton in this mesh.");
+  }
+
+  const auto size = TextureSize(skeleton->bones.size(), vertexData.size());
+
+  RawTexturePtr texture = RawTexture::CreateRGBATexture(
+    ArrayBufferView(vertexData), size.width, size.height, _scene, false, false,
+    Constants::TEXTURE_NEAREST_NEAREST, Constants::TEXTURETYPE_FLOAT);
+  texture->name = "VAT" + skeleton->name;
+
+  return texture;
+}
+
+} // end of namespace BABYLON
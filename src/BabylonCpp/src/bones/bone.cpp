@@ -8,10 +8,11 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 2> Bone::_tmpVecs{{Vector3::Zero(), Vector3::Zero()}};
-Quaternion Bone::_tmpQuat{Quaternion::Identity()};
-std::array<Matrix, 5> Bone::_tmpMats{{Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
-                                      Matrix::Identity(), Matrix::Identity()}};
+thread_local std::array<Vector3, 2> Bone::_tmpVecs{{Vector3::Zero(), Vector3::Zero()}};
+thread_local Quaternion Bone::_tmpQuat{Quaternion::Identity()};
+thread_local std::array<Matrix, 5> Bone::_tmpMats{{Matrix::Identity(), Matrix::Identity(),
+                                                   Matrix::Identity(), Matrix::Identity(),
+                                                   Matrix::Identity()}};
 
 Bone::Bone(const std::string& iName, Skeleton* skeleton, Bone* /*parentBone*/,
            const std::optional<Matrix>& localMatrix, const std::optional<Matrix>& iRestPose,
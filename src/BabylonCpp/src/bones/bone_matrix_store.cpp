@@ -0,0 +1,141 @@
+#include <babylon/bones/bone_matrix_store.h>
+
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+#include <babylon/bones/bone.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/matrix_kernels.h>
+
+namespace BABYLON {
+
+BoneMatrixStore::BoneMatrixStore() : _identityTarget{false}
+{
+}
+
+BoneMatrixStore::~BoneMatrixStore() = default;
+
+size_t BoneMatrixStore::size() const
+{
+  return _bones.size();
+}
+
+const std::vector<int32_t>& BoneMatrixStore::parentIndices() const
+{
+  return _parentIndices;
+}
+
+const std::vector<size_t>& BoneMatrixStore::boneIndices() const
+{
+  return _boneIndices;
+}
+
+void BoneMatrixStore::computeTransformMatrices(const std::vector<BonePtr>& bones,
+                                               Float32Array& targetMatrix,
+                                               const std::optional<Matrix>& initialSkinMatrix)
+{
+  if (!_gather(bones)) {
+    _build(bones);
+    _gather(bones);
+  }
+
+  const auto& kernels = MatrixKernels::Get();
+  const auto count    = _bones.size();
+
+  // Local -> world
+  kernels.multiplyHierarchy(_localMatrices.data(), _parentIndices.data(),
+                            initialSkinMatrix ? initialSkinMatrix->m().data() : nullptr,
+                            _worldMatrices.data(), count);
+  for (size_t i = 0; i < count; ++i) {
+    Matrix::FromArrayToRef(_worldMatrices, static_cast<unsigned int>(i * 16),
+                           _bones[i]->getWorldMatrix());
+  }
+
+  // World -> skin
+  if (_identityTarget) {
+    kernels.multiplyPairs(_inverseMatrices.data(), _worldMatrices.data(), targetMatrix.data(),
+                          count);
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (_targetIndices[i] >= 0) {
+      kernels.multiply(&_inverseMatrices[i * 16], &_worldMatrices[i * 16],
+                       targetMatrix.data() + static_cast<size_t>(_targetIndices[i]) * 16);
+    }
+  }
+}
+
+bool BoneMatrixStore::_gather(const std::vector<BonePtr>& bones)
+{
+  if (_bones.size() != bones.size()) {
+    return false;
+  }
+
+  _identityTarget = true;
+  for (size_t i = 0; i < _bones.size(); ++i) {
+    auto bone = _bones[i];
+    if (bones[_boneIndices[i]].get() != bone || bone->getParent() != _parents[i]) {
+      return false;
+    }
+
+    ++bone->_childUpdateId;
+    std::memcpy(&_localMatrices[i * 16], bone->getLocalMatrix().m().data(), 16 * sizeof(float));
+    std::memcpy(&_inverseMatrices[i * 16], bone->getInvertedAbsoluteTransform().m().data(),
+                16 * sizeof(float));
+
+    const auto targetIndex = bone->_index.value_or(static_cast<int>(_boneIndices[i]));
+    _targetIndices[i]      = targetIndex;
+    _identityTarget        = _identityTarget && targetIndex == static_cast<int>(i);
+  }
+
+  return true;
+}
+
+void BoneMatrixStore::_build(const std::vector<BonePtr>& bones)
+{
+  const auto count = bones.size();
+  std::unordered_map<const Bone*, size_t> indices;
+  for (size_t i = 0; i < count; ++i) {
+    indices[bones[i].get()] = i;
+  }
+
+  _bones.clear();
+  _parents.clear();
+  _parentIndices.clear();
+  _boneIndices.clear();
+
+  // Depth first from each bone in order, so that the order of the bones is kept when they are
+  // already sorted. A parent which is not part of the skeleton is treated as a root.
+  std::vector<int32_t> sortedIndices(count, -1);
+  std::function<void(size_t)> visit = [&](size_t index) {
+    if (sortedIndices[index] != -1) {
+      return;
+    }
+    sortedIndices[index] = -2;
+    auto bone            = bones[index].get();
+    auto parent          = bone->getParent();
+    auto parentIt        = parent ? indices.find(parent) : indices.end();
+    int32_t parentIndex  = -1;
+    if (parentIt != indices.end()) {
+      visit(parentIt->second);
+      parentIndex = sortedIndices[parentIt->second];
+    }
+
+    sortedIndices[index] = static_cast<int32_t>(_bones.size());
+    _bones.emplace_back(bone);
+    _parents.emplace_back(parent);
+    _parentIndices.emplace_back(parentIndex);
+    _boneIndices.emplace_back(index);
+  };
+  for (size_t i = 0; i < count; ++i) {
+    visit(i);
+  }
+
+  _targetIndices.resize(count);
+  _localMatrices.resize(count * 16);
+  _worldMatrices.resize(count * 16);
+  _inverseMatrices.resize(count * 16);
+}
+
+} // end of namespace BABYLON
@@ -4,6 +4,7 @@
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/bone.h>
+#include <babylon/bones/bone_matrix_store.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
@@ -377,38 +378,23 @@ void Skeleton::_unregisterMeshWithPoseMatrix(AbstractMesh* mesh)
 void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
                                          const std::optional<Matrix>& initialSkinMatrix)
 {
-  onBeforeComputeObservable.notifyObservers(this);
-
-  unsigned int index = 0;
-  for (const auto& bone : bones) {
-    ++bone->_childUpdateId;
-    auto parentBone = bone->getParent();
-
-    if (parentBone) {
-      bone->getLocalMatrix().multiplyToRef(parentBone->getWorldMatrix(), bone->getWorldMatrix());
-    }
-    else {
-      if (initialSkinMatrix.has_value()) {
-        bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, bone->getWorldMatrix());
-      }
-      else {
-        bone->getWorldMatrix().copyFrom(bone->getLocalMatrix());
-      }
-    }
-
-    if (!bone->_index.has_value() || *bone->_index != -1) {
-      auto mappedIndex
-        = !bone->_index.has_value() ? index : static_cast<unsigned int>(*bone->_index);
-      bone->getInvertedAbsoluteTransform().multiplyToArray(bone->getWorldMatrix(), targetMatrix,
-                                                           mappedIndex * 16);
-    }
-    ++index;
+  if (!_boneMatrixStore) {
+    _boneMatrixStore = std::make_unique<BoneMatrixStore>();
   }
+  _boneMatrixStore->computeTransformMatrices(bones, targetMatrix, initialSkinMatrix);
 
   _identity.copyToArray(targetMatrix, static_cast<unsigned int>(bones.size()) * 16);
 }
 
 void Skeleton::prepare()
+{
+  if (_beginPrepare()) {
+    _computePrepared();
+    _endPrepare();
+  }
+}
+
+bool Skeleton::_beginPrepare()
 {
   // Update the local matrix of bones with linked transform nodes.
   if (_numBonesWithLinkedTransformNode > 0) {
@@ -423,17 +409,59 @@ void Skeleton::prepare()
   }
 
   if (!_isDirty) {
-    return;
+    return false;
   }
 
+  // Buffers and textures
+  const auto matricesSize = 16 * (bones.size() + 1);
+  const auto textureWidth = static_cast<int>((bones.size() + 1) * 4);
   if (needInitialSkinMatrix) {
     for (const auto& mesh : _meshesWithPoseMatrix) {
+      if (mesh->_bonesTransformMatrices.size() != matricesSize) {
+        mesh->_bonesTransformMatrices.resize(matricesSize);
+      }
 
-      auto poseMatrix = mesh->getPoseMatrix();
+      if (isUsingTextureForMatrices()
+          && (!mesh->_transformMatrixTexture
+              || mesh->_transformMatrixTexture->getSize().width != textureWidth)) {
+        if (mesh->_transformMatrixTexture) {
+          mesh->_transformMatrixTexture->dispose();
+        }
+
+        mesh->_transformMatrixTexture = RawTexture::CreateRGBATexture(
+          mesh->_bonesTransformMatrices, textureWidth, 1, _scene, false, false,
+          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+      }
+
+      onBeforeComputeObservable.notifyObservers(this);
+    }
+  }
+  else {
+    if (_transformMatrices.size() != matricesSize) {
+      _transformMatrices.resize(matricesSize);
+
+      if (isUsingTextureForMatrices) {
+        if (_transformMatrixTexture) {
+          _transformMatrixTexture->dispose();
+        }
 
-      if (mesh->_bonesTransformMatrices.size() != 16 * (bones.size() + 1)) {
-        mesh->_bonesTransformMatrices.resize(16 * (bones.size() + 1));
+        _transformMatrixTexture = RawTexture::CreateRGBATexture(
+          _transformMatrices, textureWidth, 1, _scene, false, false,
+          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
       }
+    }
+
+    onBeforeComputeObservable.notifyObservers(this);
+  }
+
+  return true;
+}
+
+void Skeleton::_computePrepared()
+{
+  if (needInitialSkinMatrix) {
+    for (const auto& mesh : _meshesWithPoseMatrix) {
+      auto poseMatrix = mesh->getPoseMatrix();
 
       if (_synchronizedWithMesh != mesh) {
         _synchronizedWithMesh = mesh;
@@ -446,51 +474,28 @@ void Skeleton::prepare()
             bone->_updateDifferenceMatrix(tmpMatrix);
           }
         }
-
-        if (isUsingTextureForMatrices()) {
-          const auto textureWidth = static_cast<int>((bones.size() + 1) * 4);
-          if (!mesh->_transformMatrixTexture
-              || mesh->_transformMatrixTexture->getSize().width != textureWidth) {
-
-            if (mesh->_transformMatrixTexture) {
-              mesh->_transformMatrixTexture->dispose();
-            }
-
-            mesh->_transformMatrixTexture = RawTexture::CreateRGBATexture(
-              mesh->_bonesTransformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene,
-              false, false, Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
-          }
-        }
       }
 
       _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
-
-      if (isUsingTextureForMatrices && mesh->_transformMatrixTexture) {
-        mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
-      }
     }
   }
   else {
-    if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
-      _transformMatrices.resize(16 * (bones.size() + 1));
-
-      if (isUsingTextureForMatrices) {
-        if (_transformMatrixTexture) {
-          _transformMatrixTexture->dispose();
-        }
-
-        _transformMatrixTexture = RawTexture::CreateRGBATexture(
-          _transformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene, false, false,
-          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
-      }
-    }
-
     _computeTransformMatrices(_transformMatrices);
+  }
+}
 
-    if (isUsingTextureForMatrices && _transformMatrixTexture) {
-      _transformMatrixTexture->update(_transformMatrices);
+void Skeleton::_endPrepare()
+{
+  if (needInitialSkinMatrix) {
+    for (const auto& mesh : _meshesWithPoseMatrix) {
+      if (isUsingTextureForMatrices && mesh->_transformMatrixTexture) {
+        mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
+      }
     }
   }
+  else if (isUsingTextureForMatrices && _transformMatrixTexture) {
+    _transformMatrixTexture->update(_transformMatrices);
+  }
 
   _isDirty = false;
 
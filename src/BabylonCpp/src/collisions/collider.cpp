@@ -1,5 +1,6 @@
 #include <babylon/collisions/collider.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <babylon/babylon_stl_util.h>
@@ -171,9 +172,6 @@ void Collider::_testTriangle(size_t faceIndex, std::vector<Plane>& trianglePlane
                              const Vector3& p1, const Vector3& p2, const Vector3& p3,
                              bool hasMaterial, const AbstractMeshPtr& hostMesh)
 {
-  auto f = 0.f, t0 = 0.f;
-  auto embeddedInPlane = false;
-
   if (faceIndex >= trianglePlaneArray.size()) {
     for (size_t i = trianglePlaneArray.size(); i <= faceIndex; ++i) {
       trianglePlaneArray.emplace_back(Plane(0.f, 0.f, 0.f, 0.f));
@@ -181,7 +179,20 @@ void Collider::_testTriangle(size_t faceIndex, std::vector<Plane>& trianglePlane
     trianglePlaneArray[faceIndex].copyFromPoints(p1, p2, p3);
   }
 
-  auto& trianglePlane = trianglePlaneArray[faceIndex];
+  _testTriangle(trianglePlaneArray[faceIndex], p1, p2, p3, hasMaterial, hostMesh);
+}
+
+void Collider::_testTriangle(const Vector3& p1, const Vector3& p2, const Vector3& p3,
+                             bool hasMaterial, const AbstractMeshPtr& hostMesh)
+{
+  _testTriangle(Plane::FromPoints(p1, p2, p3), p1, p2, p3, hasMaterial, hostMesh);
+}
+
+void Collider::_testTriangle(const Plane& trianglePlane, const Vector3& p1, const Vector3& p2,
+                             const Vector3& p3, bool hasMaterial, const AbstractMeshPtr& hostMesh)
+{
+  auto f = 0.f, t0 = 0.f;
+  auto embeddedInPlane = false;
 
   if ((!hasMaterial) && !trianglePlane.isFrontFacingTo(_normalizedVelocity, 0)) {
     return;
@@ -411,4 +422,16 @@ void Collider::_getResponse(Vector3& pos, Vector3& vel)
   _destinationPoint.subtractToRef(intersectionPoint, vel);
 }
 
+void Collider::_getSweptBoundsToRef(Vector3& minimum, Vector3& maximum) const
+{
+  // The unit sphere swept along the velocity, padded by the close distance
+  const auto extent = 1.f + _epsilon;
+  minimum.copyFromFloats(std::min(_basePoint.x, _basePoint.x + _velocity.x) - extent,
+                         std::min(_basePoint.y, _basePoint.y + _velocity.y) - extent,
+                         std::min(_basePoint.z, _basePoint.z + _velocity.z) - extent);
+  maximum.copyFromFloats(std::max(_basePoint.x, _basePoint.x + _velocity.x) + extent,
+                         std::max(_basePoint.y, _basePoint.y + _velocity.y) + extent,
+                         std::max(_basePoint.z, _basePoint.z + _velocity.z) + extent);
+}
+
 } // end of namespace BABYLON
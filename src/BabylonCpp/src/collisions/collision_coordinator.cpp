@@ -1,17 +1,48 @@
 #include <babylon/collisions/collision_coordinator.h>
 
+#include <algorithm>
+
+#include <babylon/babylon_stl_util.h>
 #include <babylon/collisions/collider.h>
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/abstract_mesh.h>
 
 namespace BABYLON {
 
+namespace {
+
+// Number of refits after which the broadphase is rebuilt to keep its quality
+constexpr size_t MaxRefitCount = 32;
+
+bool BoundsEqual(const std::vector<BVH::Bounds>& a, const std::vector<BVH::Bounds>& b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].minimum != b[i].minimum || a[i].maximum != b[i].maximum) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsCollidable(AbstractMesh& mesh)
+{
+  return mesh.isEnabled() && mesh.checkCollisions && !mesh.subMeshes.empty() && mesh._boundingInfo;
+}
+
+} // end of anonymous namespace
+
 DefaultCollisionCoordinator::DefaultCollisionCoordinator()
     : _scene{nullptr}
     , _scaledPosition{Vector3::Zero()}
     , _scaledVelocity{Vector3::Zero()}
     , _finalPosition{Vector3::Zero()}
+    , _refitCount{0}
 {
 }
 
@@ -30,6 +61,9 @@ void DefaultCollisionCoordinator::getNewPosition(
   collider->_retry           = 0;
   collider->_initialVelocity = _scaledVelocity;
   collider->_initialPosition = _scaledPosition;
+  if (!excludedMesh || excludedMesh->surroundingMeshes().empty()) {
+    _updateBroadphase();
+  }
   _collideWithWorld(_scaledPosition, _scaledVelocity, collider, maximumRetry, _finalPosition,
                     excludedMesh);
 
@@ -61,20 +95,44 @@ void DefaultCollisionCoordinator::_collideWithWorld(Vector3& position, Vector3&
     return;
   }
 
-  // Check if this is a mesh else camera or -1
-  auto collisionMask = (excludedMesh ? excludedMesh->collisionMask() : collider->collisionMask());
-
   collider->_initialize(position, velocity, closeDistance);
 
+  // Check if this is a mesh else camera or -1
+  const auto collisionMask
+    = (excludedMesh ? excludedMesh->collisionMask() : collider->collisionMask());
+  const auto canCollide = [&excludedMesh, collisionMask](const AbstractMesh* mesh) {
+    return mesh != excludedMesh.get() && ((collisionMask & mesh->collisionGroup) != 0);
+  };
+
   // Check if collision detection should happen against specified list of meshes or,
   // if not specified, against all meshes in the scene
-  const auto meshes = excludedMesh ? excludedMesh->surroundingMeshes() : _scene->meshes;
-
-  // Check all meshes
-  for (const auto& mesh : meshes) {
-    if (mesh->isEnabled() && mesh->checkCollisions && !mesh->subMeshes.empty()
-        && mesh != excludedMesh && ((collisionMask & mesh->collisionGroup) != 0)) {
-      mesh->_checkCollision(*collider);
+  if (excludedMesh && !excludedMesh->surroundingMeshes().empty()) {
+    for (const auto& mesh : excludedMesh->surroundingMeshes()) {
+      if (IsCollidable(*mesh) && canCollide(mesh.get())) {
+        mesh->_checkCollision(*collider);
+      }
+    }
+  }
+  else {
+    // Check the meshes whose world bounding box may overlap the sphere tested by
+    // Collider::_canDoCollision
+    const auto extent
+      = collider->_velocityWorldLength
+        + stl_util::max(collider->_radius.x, collider->_radius.y, collider->_radius.z);
+    const auto& center = collider->_basePointWorld;
+    const BVH::Bounds bounds{{center.x - extent, center.y - extent, center.z - extent},
+                             {center.x + extent, center.y + extent, center.z + extent}};
+    _candidates.clear();
+    _broadphase.forEachOverlap(
+      bounds, [this](uint32_t primitiveIndex) { _candidates.emplace_back(primitiveIndex); });
+
+    // The meshes are tested in the scene order
+    std::sort(_candidates.begin(), _candidates.end());
+    for (const auto candidate : _candidates) {
+      const auto mesh = _collidableMeshes[candidate];
+      if (canCollide(mesh)) {
+        mesh->_checkCollision(*collider);
+      }
     }
   }
 
@@ -96,4 +154,35 @@ void DefaultCollisionCoordinator::_collideWithWorld(Vector3& position, Vector3&
   _collideWithWorld(position, velocity, collider, maximumRetry, finalPosition, excludedMesh);
 }
 
+void DefaultCollisionCoordinator::_updateBroadphase()
+{
+  // All the collidable meshes of the scene, whatever the collider, so that the hierarchy is only
+  // rebuilt when meshes are added, removed, enabled or disabled
+  _newCollidableMeshes.clear();
+  _newCollidableBounds.clear();
+  for (const auto& mesh : _scene->meshes) {
+    if (IsCollidable(*mesh)) {
+      const auto& boundingBox = mesh->_boundingInfo->boundingBox;
+      const auto& minimum     = boundingBox.minimumWorld;
+      const auto& maximum     = boundingBox.maximumWorld;
+      _newCollidableMeshes.emplace_back(mesh.get());
+      _newCollidableBounds.emplace_back(
+        BVH::Bounds{{minimum.x, minimum.y, minimum.z}, {maximum.x, maximum.y, maximum.z}});
+    }
+  }
+
+  // Rebuilt when the collidable meshes changed, refitted when they only moved
+  if (_newCollidableMeshes != _collidableMeshes || _refitCount >= MaxRefitCount) {
+    _collidableMeshes.swap(_newCollidableMeshes);
+    _collidableBounds.swap(_newCollidableBounds);
+    _broadphase.build(_collidableBounds);
+    _refitCount = 0;
+  }
+  else if (!BoundsEqual(_collidableBounds, _newCollidableBounds)) {
+    _collidableBounds.swap(_newCollidableBounds);
+    _broadphase.refit(_collidableBounds);
+    ++_refitCount;
+  }
+}
+
 } // end of namespace BABYLON
@@ -0,0 +1,136 @@
+#include <babylon/core/memory_mapped_file.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include <fstream>
+
+namespace BABYLON {
+
+MemoryMappedFile::MemoryMappedFile() : _data{nullptr}, _size{0}, _mapping{nullptr}
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  if (!_mapping) {
+    return;
+  }
+
+#ifdef _WIN32
+  ::UnmapViewOfFile(_mapping);
+#else
+  ::munmap(_mapping, _size);
+#endif
+}
+
+MemoryMappedFilePtr MemoryMappedFile::Open(const std::string& path)
+{
+  // Can not use std::make_shared as the constructor is private
+  MemoryMappedFilePtr file(new MemoryMappedFile());
+  if (file->_map(path) || file->_read(path)) {
+    return file;
+  }
+
+  return nullptr;
+}
+
+const uint8_t* MemoryMappedFile::data() const
+{
+  return _data;
+}
+
+size_t MemoryMappedFile::size() const
+{
+  return _size;
+}
+
+bool MemoryMappedFile::isMapped() const
+{
+  return _mapping != nullptr;
+}
+
+bool MemoryMappedFile::_map(const std::string& path)
+{
+#ifdef _WIN32
+  auto file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    ::CloseHandle(file);
+    return false;
+  }
+
+  // The view stays valid once both handles are closed
+  auto mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  ::CloseHandle(file);
+  if (!mapping) {
+    return false;
+  }
+  auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  ::CloseHandle(mapping);
+  if (!view) {
+    return false;
+  }
+
+  _mapping = view;
+  _size    = static_cast<size_t>(fileSize.QuadPart);
+#else
+  const auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+
+  // The mapping stays valid once the file descriptor is closed
+  const auto size = static_cast<size_t>(fileStat.st_size);
+  auto view       = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return false;
+  }
+
+  _mapping = view;
+  _size    = size;
+#endif
+
+  _data = static_cast<const uint8_t*>(_mapping);
+  return true;
+}
+
+bool MemoryMappedFile::_read(const std::string& path)
+{
+  std::ifstream stream(path, std::ios::binary | std::ios::ate);
+  if (!stream) {
+    return false;
+  }
+
+  _buffer.resize(static_cast<size_t>(stream.tellg()));
+  stream.seekg(0, std::ios::beg);
+  if (!_buffer.empty()
+      && !stream.read(reinterpret_cast<char*>(_buffer.data()),
+                      static_cast<std::streamsize>(_buffer.size()))) {
+    return false;
+  }
+
+  _data = _buffer.data();
+  _size = _buffer.size();
+  return true;
+}
+
+} // end of namespace BABYLON
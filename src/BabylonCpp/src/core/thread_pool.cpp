@@ -0,0 +1,176 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * State shared between the thread issuing a parallelFor call and the workers helping it. It is
+ * reference counted as helpers may only get scheduled after the call has already returned.
+ */
+struct ParallelForState {
+  size_t count;
+  size_t grainSize;
+  size_t numChunks;
+  std::function<void(size_t, size_t, size_t)> func;
+  std::atomic<size_t> nextChunk{0};
+  std::atomic<size_t> completedChunks{0};
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::exception_ptr exception;
+
+  /**
+   * Claims and processes chunks until none are left.
+   */
+  void run()
+  {
+    size_t chunkIndex;
+    while ((chunkIndex = nextChunk.fetch_add(1)) < numChunks) {
+      const auto begin = chunkIndex * grainSize;
+      const auto end   = std::min(begin + grainSize, count);
+      try {
+        func(chunkIndex, begin, end);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+      if (completedChunks.fetch_add(1) + 1 == numChunks) {
+        std::lock_guard<std::mutex> lock(mutex);
+        condition.notify_all();
+      }
+    }
+  }
+};
+
+} // end of anonymous namespace
+
+ThreadPool::ThreadPool(size_t numWorkers) : _stopping{false}
+{
+  _workers.reserve(numWorkers);
+  for (size_t i = 0; i < numWorkers; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _condition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+ThreadPool& ThreadPool::Default()
+{
+#ifdef __EMSCRIPTEN__
+  static ThreadPool pool(0);
+#else
+  static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+#endif
+  return pool;
+}
+
+size_t ThreadPool::numWorkers() const
+{
+  return _workers.size();
+}
+
+size_t ThreadPool::concurrency() const
+{
+  return _workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(
+  size_t count, size_t grainSize,
+  const std::function<void(size_t chunkIndex, size_t begin, size_t end)>& func)
+{
+  if (count == 0) {
+    return;
+  }
+
+  grainSize             = std::max(grainSize, size_t(1));
+  const auto numChunks  = (count + grainSize - 1) / grainSize;
+  const auto numHelpers = std::min(_workers.size(), numChunks - 1);
+
+  // Nothing to share, run inline
+  if (numHelpers == 0) {
+    for (size_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex) {
+      const auto begin = chunkIndex * grainSize;
+      func(chunkIndex, begin, std::min(begin + grainSize, count));
+    }
+    return;
+  }
+
+  auto state       = std::make_shared<ParallelForState>();
+  state->count     = count;
+  state->grainSize = grainSize;
+  state->numChunks = numChunks;
+  state->func      = func;
+
+  for (size_t i = 0; i < numHelpers; ++i) {
+    _push([state]() { state->run(); });
+  }
+
+  // The calling thread participates
+  state->run();
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state]() { return state->completedChunks == state->numChunks; });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grainSize,
+                             const std::function<void(size_t begin, size_t end)>& func)
+{
+  parallelFor(count, grainSize,
+              [&func](size_t /*chunkIndex*/, size_t begin, size_t end) { func(begin, end); });
+}
+
+void ThreadPool::_push(std::function<void()>&& job)
+{
+  if (_workers.empty()) {
+    job();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs.emplace_back(std::move(job));
+  }
+  _condition.notify_one();
+}
+
+void ThreadPool::_workerLoop()
+{
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+      if (_stopping && _jobs.empty()) {
+        return;
+      }
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+    job();
+  }
+}
+
+} // end of namespace BABYLON
@@ -7,7 +7,10 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 2> BoundingInfo::TmpVector3{Vector3::Zero(), Vector3::Zero()};
+namespace {
+// Thread local so that bounding volumes can be updated from worker threads
+thread_local std::array<Vector3, 2> TmpVector3{Vector3::Zero(), Vector3::Zero()};
+} // end of anonymous namespace
 
 BoundingInfo::BoundingInfo(const Vector3& iMinimum, const Vector3& iMaximum,
                            const std::optional<Matrix>& worldMatrix)
@@ -102,8 +105,8 @@ void BoundingInfo::update(const Matrix& world)
 
 BoundingInfo& BoundingInfo::centerOn(const Vector3& center, const Vector3& extend)
 {
-  auto& iMinimum = BoundingInfo::TmpVector3[0].copyFrom(center).subtractInPlace(extend);
-  auto& iMaximum = BoundingInfo::TmpVector3[1].copyFrom(center).addInPlace(extend);
+  auto& iMinimum = TmpVector3[0].copyFrom(center).subtractInPlace(extend);
+  auto& iMaximum = TmpVector3[1].copyFrom(center).addInPlace(extend);
 
   boundingBox.reConstruct(iMinimum, iMaximum, boundingBox.getWorldMatrix());
   boundingSphere.reConstruct(iMinimum, iMaximum, boundingBox.getWorldMatrix());
@@ -165,7 +168,7 @@ bool BoundingInfo::isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsign
 float BoundingInfo::diagonalLength() const
 {
   const auto& diag
-    = boundingBox.maximumWorld.subtractToRef(boundingBox.minimumWorld, BoundingInfo::TmpVector3[0]);
+    = boundingBox.maximumWorld.subtractToRef(boundingBox.minimumWorld, TmpVector3[0]);
   return diag.length();
 }
 
@@ -0,0 +1,263 @@
+#include <babylon/culling/bvh.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr size_t BinCount = 16;
+
+BVH::Bounds EmptyBounds()
+{
+  const auto max    = std::numeric_limits<float>::max();
+  const auto lowest = std::numeric_limits<float>::lowest();
+  return BVH::Bounds{{max, max, max}, {lowest, lowest, lowest}};
+}
+
+void Grow(BVH::Bounds& bounds, const std::array<float, 3>& minimum,
+          const std::array<float, 3>& maximum)
+{
+  for (size_t axis = 0; axis < 3; ++axis) {
+    bounds.minimum[axis] = std::min(bounds.minimum[axis], minimum[axis]);
+    bounds.maximum[axis] = std::max(bounds.maximum[axis], maximum[axis]);
+  }
+}
+
+float HalfArea(const BVH::Bounds& bounds)
+{
+  const auto x = bounds.maximum[0] - bounds.minimum[0];
+  const auto y = bounds.maximum[1] - bounds.minimum[1];
+  const auto z = bounds.maximum[2] - bounds.minimum[2];
+  if (!(x >= 0.f && y >= 0.f && z >= 0.f)) {
+    return 0.f;
+  }
+  return x * y + y * z + z * x;
+}
+
+size_t BinIndex(float centroid, float minimum, float scale)
+{
+  const auto position = (centroid - minimum) * scale;
+  return position > 0.f ? std::min(BinCount - 1, static_cast<size_t>(position)) : 0;
+}
+
+float InverseDirection(float direction)
+{
+  // Very small components are clamped instead of being divided by, the slab test then never deals
+  // with infinities multiplied by 0
+  if (std::abs(direction) > 1e-20f) {
+    return 1.f / direction;
+  }
+  return direction < 0.f ? -1e20f : 1e20f;
+}
+
+} // end of anonymous namespace
+
+BVH::RayData::RayData(const Vector3& iOrigin, const Vector3& direction)
+    : origin{iOrigin.x, iOrigin.y, iOrigin.z}
+    , inverseDirection{InverseDirection(direction.x), InverseDirection(direction.y),
+                       InverseDirection(direction.z)}
+{
+}
+
+BVH::BVH() = default;
+
+BVH::BVH(const BVH& other) = default;
+
+BVH::BVH(BVH&& other) = default;
+
+BVH& BVH::operator=(const BVH& other) = default;
+
+BVH& BVH::operator=(BVH&& other) = default;
+
+BVH::~BVH() = default;
+
+void BVH::build(const std::vector<Bounds>& primitives, size_t maxLeafSize)
+{
+  clear();
+
+  const auto primitiveCount = primitives.size();
+  if (primitiveCount == 0) {
+    return;
+  }
+
+  primitiveIndices.resize(primitiveCount);
+  std::iota(primitiveIndices.begin(), primitiveIndices.end(), 0u);
+
+  std::vector<std::array<float, 3>> centroids(primitiveCount);
+  for (size_t i = 0; i < primitiveCount; ++i) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      centroids[i][axis] = (primitives[i].minimum[axis] + primitives[i].maximum[axis]) * 0.5f;
+    }
+  }
+
+  // The children are always allocated in pairs, a tree with n leaves has 2n - 1 nodes
+  nodes.reserve(2 * primitiveCount);
+  Node root{};
+  root.leftFirst = 0;
+  root.count     = static_cast<uint32_t>(primitiveCount);
+  _updateNodeBounds(root, primitives);
+  nodes.emplace_back(root);
+
+  std::vector<std::pair<uint32_t, size_t>> stack{{0, 0}};
+  while (!stack.empty()) {
+    const auto [nodeIndex, depth] = stack.back();
+    stack.pop_back();
+    _subdivide(nodeIndex, depth, primitives, centroids, std::max(maxLeafSize, size_t(1)), stack);
+  }
+}
+
+void BVH::_updateNodeBounds(Node& node, const std::vector<Bounds>& primitives) const
+{
+  auto bounds = EmptyBounds();
+  for (size_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+    const auto& primitive = primitives[primitiveIndices[i]];
+    Grow(bounds, primitive.minimum, primitive.maximum);
+  }
+  node.minimum = bounds.minimum;
+  node.maximum = bounds.maximum;
+}
+
+void BVH::_subdivide(uint32_t nodeIndex, size_t depth, const std::vector<Bounds>& primitives,
+                     const std::vector<std::array<float, 3>>& centroids, size_t maxLeafSize,
+                     std::vector<std::pair<uint32_t, size_t>>& stack)
+{
+  const auto first = nodes[nodeIndex].leftFirst;
+  const auto count = nodes[nodeIndex].count;
+  if (count <= maxLeafSize || depth + 1 >= MaxDepth) {
+    return;
+  }
+
+  auto centroidBounds = EmptyBounds();
+  for (auto i = first; i < first + count; ++i) {
+    const auto& centroid = centroids[primitiveIndices[i]];
+    Grow(centroidBounds, centroid, centroid);
+  }
+
+  struct Bin {
+    Bounds bounds = EmptyBounds();
+    uint32_t count  = 0;
+  };
+
+  // Binned SAH: the primitives are distributed in bins along each axis and all the splits between
+  // two bins are evaluated
+  auto bestCost    = std::numeric_limits<float>::max();
+  auto bestAxis    = -1;
+  size_t bestSplit = 0;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const auto extent = centroidBounds.maximum[axis] - centroidBounds.minimum[axis];
+    if (!(extent > 0.f)) {
+      continue;
+    }
+
+    const auto scale = static_cast<float>(BinCount) / extent;
+    std::array<Bin, BinCount> bins{};
+    for (auto i = first; i < first + count; ++i) {
+      const auto primitiveIndex = primitiveIndices[i];
+      auto& bin                 = bins[BinIndex(centroids[primitiveIndex][axis],
+                                                centroidBounds.minimum[axis], scale)];
+      Grow(bin.bounds, primitives[primitiveIndex].minimum, primitives[primitiveIndex].maximum);
+      ++bin.count;
+    }
+
+    std::array<float, BinCount - 1> leftAreas{};
+    std::array<uint32_t, BinCount - 1> leftCounts{};
+    auto leftBounds = EmptyBounds();
+    auto leftCount  = 0u;
+    for (size_t i = 0; i < BinCount - 1; ++i) {
+      Grow(leftBounds, bins[i].bounds.minimum, bins[i].bounds.maximum);
+      leftCount += bins[i].count;
+      leftAreas[i]  = HalfArea(leftBounds);
+      leftCounts[i] = leftCount;
+    }
+
+    auto rightBounds = EmptyBounds();
+    auto rightCount  = 0u;
+    for (size_t i = BinCount - 1; i > 0; --i) {
+      Grow(rightBounds, bins[i].bounds.minimum, bins[i].bounds.maximum);
+      rightCount += bins[i].count;
+      if (leftCounts[i - 1] == 0 || rightCount == 0) {
+        continue;
+      }
+      const auto cost = static_cast<float>(leftCounts[i - 1]) * leftAreas[i - 1]
+                        + static_cast<float>(rightCount) * HalfArea(rightBounds);
+      if (cost < bestCost) {
+        bestCost  = cost;
+        bestAxis  = static_cast<int>(axis);
+        bestSplit = i;
+      }
+    }
+  }
+
+  Bounds nodeBounds{nodes[nodeIndex].minimum, nodes[nodeIndex].maximum};
+  if (bestAxis < 0 || bestCost >= static_cast<float>(count) * HalfArea(nodeBounds)) {
+    return;
+  }
+
+  const auto axis   = static_cast<size_t>(bestAxis);
+  const auto scale  = static_cast<float>(BinCount)
+                     / (centroidBounds.maximum[axis] - centroidBounds.minimum[axis]);
+  const auto begin  = primitiveIndices.begin() + first;
+  const auto middle = std::partition(begin, begin + count, [&](uint32_t primitiveIndex) {
+    return BinIndex(centroids[primitiveIndex][axis], centroidBounds.minimum[axis], scale)
+           < bestSplit;
+  });
+  const auto leftCount = static_cast<uint32_t>(middle - begin);
+  if (leftCount == 0 || leftCount == count) {
+    return;
+  }
+
+  const auto leftIndex = static_cast<uint32_t>(nodes.size());
+  Node left{};
+  left.leftFirst = first;
+  left.count     = leftCount;
+  _updateNodeBounds(left, primitives);
+  Node right{};
+  right.leftFirst = first + leftCount;
+  right.count     = count - leftCount;
+  _updateNodeBounds(right, primitives);
+  nodes.emplace_back(left);
+  nodes.emplace_back(right);
+
+  nodes[nodeIndex].leftFirst = leftIndex;
+  nodes[nodeIndex].count     = 0;
+
+  stack.emplace_back(leftIndex, depth + 1);
+  stack.emplace_back(leftIndex + 1, depth + 1);
+}
+
+void BVH::refit(const std::vector<Bounds>& primitives)
+{
+  // Children are always stored after their parent
+  for (size_t i = nodes.size(); i-- > 0;) {
+    auto& node = nodes[i];
+    if (node.isLeaf()) {
+      _updateNodeBounds(node, primitives);
+    }
+    else {
+      const auto& left  = nodes[node.leftFirst];
+      const auto& right = nodes[node.leftFirst + 1];
+      for (size_t axis = 0; axis < 3; ++axis) {
+        node.minimum[axis] = std::min(left.minimum[axis], right.minimum[axis]);
+        node.maximum[axis] = std::max(left.maximum[axis], right.maximum[axis]);
+      }
+    }
+  }
+}
+
+void BVH::clear()
+{
+  nodes.clear();
+  primitiveIndices.clear();
+}
+
+bool BVH::empty() const
+{
+  return nodes.empty();
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,388 @@
+#include <babylon/culling/culling_store.h>
+
+#include <cmath>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/constants.h>
+#include <babylon/maths/plane.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BABYLON_CULLING_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BABYLON_CULLING_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BABYLON_CULLING_NEON
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Per volume test results
+constexpr uint8_t SphereOutside = 1;
+constexpr uint8_t CenterOutside = 2;
+constexpr uint8_t BoxOutside    = 4;
+
+/**
+ * Read only view over the arrays of the store, consumed by the kernels.
+ */
+struct Volumes {
+  const float *sx, *sy, *sz, *sr;
+  const float *bx, *by, *bz;
+  const float *a0x, *a0y, *a0z;
+  const float *a1x, *a1y, *a1z;
+  const float *a2x, *a2y, *a2z;
+};
+
+/**
+ * Combines the raw test results the same way BoundingInfo::isInFrustum does.
+ */
+inline uint8_t resolve(uint8_t bits, uint8_t strategy)
+{
+  const auto inclusionTest
+    = (strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION
+       || strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION_THEN_BSPHERE_ONLY);
+  if (inclusionTest && !(bits & CenterOutside)) {
+    return 1;
+  }
+
+  if (bits & SphereOutside) {
+    return 0;
+  }
+
+  const auto bSphereOnlyTest
+    = (strategy == Constants::MESHES_CULLINGSTRATEGY_BOUNDINGSPHERE_ONLY
+       || strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION_THEN_BSPHERE_ONLY);
+  if (bSphereOnlyTest) {
+    return 1;
+  }
+
+  return (bits & BoxOutside) ? 0 : 1;
+}
+
+inline uint8_t testScalar(const Volumes& v, const std::array<Plane, 6>& planes, size_t i)
+{
+  uint8_t bits = 0;
+  for (const auto& plane : planes) {
+    const auto nx = plane.normal.x, ny = plane.normal.y, nz = plane.normal.z, d = plane.d;
+    // Same operations order as Plane::dotCoordinate
+    const auto ds = (((nx * v.sx[i]) + (ny * v.sy[i])) + (nz * v.sz[i])) + d;
+    if (ds <= -v.sr[i]) {
+      bits |= SphereOutside;
+    }
+    if (ds < 0.f) {
+      bits |= CenterOutside;
+    }
+    const auto db = (((nx * v.bx[i]) + (ny * v.by[i])) + (nz * v.bz[i])) + d;
+    const auto e  = std::abs(nx * v.a0x[i] + ny * v.a0y[i] + nz * v.a0z[i])
+                   + std::abs(nx * v.a1x[i] + ny * v.a1y[i] + nz * v.a1z[i])
+                   + std::abs(nx * v.a2x[i] + ny * v.a2y[i] + nz * v.a2z[i]);
+    if (db + e < 0.f) {
+      bits |= BoxOutside;
+    }
+  }
+  return bits;
+}
+
+#if defined(BABYLON_CULLING_AVX)
+
+constexpr size_t Lanes = 8;
+
+/**
+ * Tests 8 volumes starting at index i, stores the raw results in bits.
+ */
+inline void testBatch(const Volumes& v, const std::array<Plane, 6>& planes, size_t i,
+                      uint8_t* bits)
+{
+  const auto zero     = _mm256_setzero_ps();
+  const auto signMask = _mm256_set1_ps(-0.f);
+  const auto sx = _mm256_loadu_ps(v.sx + i), sy = _mm256_loadu_ps(v.sy + i),
+             sz = _mm256_loadu_ps(v.sz + i);
+  const auto negR = _mm256_xor_ps(_mm256_loadu_ps(v.sr + i), signMask);
+  const auto bx = _mm256_loadu_ps(v.bx + i), by = _mm256_loadu_ps(v.by + i),
+             bz = _mm256_loadu_ps(v.bz + i);
+  const auto a0x = _mm256_loadu_ps(v.a0x + i), a0y = _mm256_loadu_ps(v.a0y + i),
+             a0z = _mm256_loadu_ps(v.a0z + i);
+  const auto a1x = _mm256_loadu_ps(v.a1x + i), a1y = _mm256_loadu_ps(v.a1y + i),
+             a1z = _mm256_loadu_ps(v.a1z + i);
+  const auto a2x = _mm256_loadu_ps(v.a2x + i), a2y = _mm256_loadu_ps(v.a2y + i),
+             a2z = _mm256_loadu_ps(v.a2z + i);
+
+  auto sphereOut = zero, centerOut = zero, boxOut = zero;
+  for (const auto& plane : planes) {
+    const auto nx = _mm256_set1_ps(plane.normal.x), ny = _mm256_set1_ps(plane.normal.y),
+               nz = _mm256_set1_ps(plane.normal.z), d = _mm256_set1_ps(plane.d);
+    const auto ds = _mm256_add_ps(
+      _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, sx), _mm256_mul_ps(ny, sy)),
+                    _mm256_mul_ps(nz, sz)),
+      d);
+    sphereOut = _mm256_or_ps(sphereOut, _mm256_cmp_ps(ds, negR, _CMP_LE_OQ));
+    centerOut = _mm256_or_ps(centerOut, _mm256_cmp_ps(ds, zero, _CMP_LT_OQ));
+    const auto db = _mm256_add_ps(
+      _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, bx), _mm256_mul_ps(ny, by)),
+                    _mm256_mul_ps(nz, bz)),
+      d);
+    const auto e0 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, a0x), _mm256_mul_ps(ny, a0y)),
+                                  _mm256_mul_ps(nz, a0z));
+    const auto e1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, a1x), _mm256_mul_ps(ny, a1y)),
+                                  _mm256_mul_ps(nz, a1z));
+    const auto e2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, a2x), _mm256_mul_ps(ny, a2y)),
+                                  _mm256_mul_ps(nz, a2z));
+    const auto e = _mm256_add_ps(
+      _mm256_add_ps(_mm256_andnot_ps(signMask, e0), _mm256_andnot_ps(signMask, e1)),
+      _mm256_andnot_ps(signMask, e2));
+    boxOut = _mm256_or_ps(boxOut, _mm256_cmp_ps(_mm256_add_ps(db, e), zero, _CMP_LT_OQ));
+  }
+
+  const auto s = _mm256_movemask_ps(sphereOut), c = _mm256_movemask_ps(centerOut),
+             b = _mm256_movemask_ps(boxOut);
+  for (size_t lane = 0; lane < Lanes; ++lane) {
+    bits[lane] = static_cast<uint8_t>(((s >> lane) & 1) * SphereOutside
+                                      | ((c >> lane) & 1) * CenterOutside
+                                      | ((b >> lane) & 1) * BoxOutside);
+  }
+}
+
+#elif defined(BABYLON_CULLING_SSE2)
+
+constexpr size_t Lanes = 4;
+
+/**
+ * Tests 4 volumes starting at index i, stores the raw results in bits.
+ */
+inline void testBatch(const Volumes& v, const std::array<Plane, 6>& planes, size_t i,
+                      uint8_t* bits)
+{
+  const auto zero     = _mm_setzero_ps();
+  const auto signMask = _mm_set1_ps(-0.f);
+  const auto sx = _mm_loadu_ps(v.sx + i), sy = _mm_loadu_ps(v.sy + i), sz = _mm_loadu_ps(v.sz + i);
+  const auto negR = _mm_xor_ps(_mm_loadu_ps(v.sr + i), signMask);
+  const auto bx = _mm_loadu_ps(v.bx + i), by = _mm_loadu_ps(v.by + i), bz = _mm_loadu_ps(v.bz + i);
+  const auto a0x = _mm_loadu_ps(v.a0x + i), a0y = _mm_loadu_ps(v.a0y + i),
+             a0z = _mm_loadu_ps(v.a0z + i);
+  const auto a1x = _mm_loadu_ps(v.a1x + i), a1y = _mm_loadu_ps(v.a1y + i),
+             a1z = _mm_loadu_ps(v.a1z + i);
+  const auto a2x = _mm_loadu_ps(v.a2x + i), a2y = _mm_loadu_ps(v.a2y + i),
+             a2z = _mm_loadu_ps(v.a2z + i);
+
+  auto sphereOut = zero, centerOut = zero, boxOut = zero;
+  for (const auto& plane : planes) {
+    const auto nx = _mm_set1_ps(plane.normal.x), ny = _mm_set1_ps(plane.normal.y),
+               nz = _mm_set1_ps(plane.normal.z), d = _mm_set1_ps(plane.d);
+    const auto ds = _mm_add_ps(
+      _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, sx), _mm_mul_ps(ny, sy)), _mm_mul_ps(nz, sz)), d);
+    sphereOut     = _mm_or_ps(sphereOut, _mm_cmple_ps(ds, negR));
+    centerOut     = _mm_or_ps(centerOut, _mm_cmplt_ps(ds, zero));
+    const auto db = _mm_add_ps(
+      _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, bx), _mm_mul_ps(ny, by)), _mm_mul_ps(nz, bz)), d);
+    const auto e0
+      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, a0x), _mm_mul_ps(ny, a0y)), _mm_mul_ps(nz, a0z));
+    const auto e1
+      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, a1x), _mm_mul_ps(ny, a1y)), _mm_mul_ps(nz, a1z));
+    const auto e2
+      = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, a2x), _mm_mul_ps(ny, a2y)), _mm_mul_ps(nz, a2z));
+    const auto e = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, e0), _mm_andnot_ps(signMask, e1)),
+                              _mm_andnot_ps(signMask, e2));
+    boxOut       = _mm_or_ps(boxOut, _mm_cmplt_ps(_mm_add_ps(db, e), zero));
+  }
+
+  const auto s = _mm_movemask_ps(sphereOut), c = _mm_movemask_ps(centerOut),
+             b = _mm_movemask_ps(boxOut);
+  for (size_t lane = 0; lane < Lanes; ++lane) {
+    bits[lane] = static_cast<uint8_t>(((s >> lane) & 1) * SphereOutside
+                                      | ((c >> lane) & 1) * CenterOutside
+                                      | ((b >> lane) & 1) * BoxOutside);
+  }
+}
+
+#elif defined(BABYLON_CULLING_NEON)
+
+constexpr size_t Lanes = 4;
+
+/**
+ * Tests 4 volumes starting at index i, stores the raw results in bits.
+ */
+inline void testBatch(const Volumes& v, const std::array<Plane, 6>& planes, size_t i,
+                      uint8_t* bits)
+{
+  const auto zero = vdupq_n_f32(0.f);
+  const auto sx = vld1q_f32(v.sx + i), sy = vld1q_f32(v.sy + i), sz = vld1q_f32(v.sz + i);
+  const auto negR = vnegq_f32(vld1q_f32(v.sr + i));
+  const auto bx = vld1q_f32(v.bx + i), by = vld1q_f32(v.by + i), bz = vld1q_f32(v.bz + i);
+  const auto a0x = vld1q_f32(v.a0x + i), a0y = vld1q_f32(v.a0y + i), a0z = vld1q_f32(v.a0z + i);
+  const auto a1x = vld1q_f32(v.a1x + i), a1y = vld1q_f32(v.a1y + i), a1z = vld1q_f32(v.a1z + i);
+  const auto a2x = vld1q_f32(v.a2x + i), a2y = vld1q_f32(v.a2y + i), a2z = vld1q_f32(v.a2z + i);
+
+  auto sphereOut = vdupq_n_u32(0), centerOut = vdupq_n_u32(0), boxOut = vdupq_n_u32(0);
+  for (const auto& plane : planes) {
+    const auto nx = vdupq_n_f32(plane.normal.x), ny = vdupq_n_f32(plane.normal.y),
+               nz = vdupq_n_f32(plane.normal.z), d = vdupq_n_f32(plane.d);
+    const auto ds
+      = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(nx, sx), vmulq_f32(ny, sy)), vmulq_f32(nz, sz)), d);
+    sphereOut = vorrq_u32(sphereOut, vcleq_f32(ds, negR));
+    centerOut = vorrq_u32(centerOut, vcltq_f32(ds, zero));
+    const auto db
+      = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(nx, bx), vmulq_f32(ny, by)), vmulq_f32(nz, bz)), d);
+    const auto e0 = vaddq_f32(vaddq_f32(vmulq_f32(nx, a0x), vmulq_f32(ny, a0y)), vmulq_f32(nz, a0z));
+    const auto e1 = vaddq_f32(vaddq_f32(vmulq_f32(nx, a1x), vmulq_f32(ny, a1y)), vmulq_f32(nz, a1z));
+    const auto e2 = vaddq_f32(vaddq_f32(vmulq_f32(nx, a2x), vmulq_f32(ny, a2y)), vmulq_f32(nz, a2z));
+    const auto e  = vaddq_f32(vaddq_f32(vabsq_f32(e0), vabsq_f32(e1)), vabsq_f32(e2));
+    boxOut        = vorrq_u32(boxOut, vcltq_f32(vaddq_f32(db, e), zero));
+  }
+
+  uint32_t s[4], c[4], b[4];
+  vst1q_u32(s, sphereOut);
+  vst1q_u32(c, centerOut);
+  vst1q_u32(b, boxOut);
+  for (size_t lane = 0; lane < Lanes; ++lane) {
+    bits[lane] = static_cast<uint8_t>((s[lane] ? SphereOutside : 0) | (c[lane] ? CenterOutside : 0)
+                                      | (b[lane] ? BoxOutside : 0));
+  }
+}
+
+#else
+
+constexpr size_t Lanes = 1;
+
+inline void testBatch(const Volumes& v, const std::array<Plane, 6>& planes, size_t i,
+                      uint8_t* bits)
+{
+  bits[0] = testScalar(v, planes, i);
+}
+
+#endif
+
+} // end of anonymous namespace
+
+CullingStore::CullingStore() = default;
+
+CullingStore::CullingStore(const CullingStore& other) = default;
+
+CullingStore::CullingStore(CullingStore&& other) = default;
+
+CullingStore& CullingStore::operator=(const CullingStore& other) = default;
+
+CullingStore& CullingStore::operator=(CullingStore&& other) = default;
+
+CullingStore::~CullingStore() = default;
+
+size_t CullingStore::size() const
+{
+  return _strategies.size();
+}
+
+void CullingStore::resize(size_t count)
+{
+  for (auto array : {&_sphereCenterX, &_sphereCenterY, &_sphereCenterZ, &_sphereRadius,
+                     &_boxCenterX, &_boxCenterY, &_boxCenterZ, &_boxAxis0X, &_boxAxis0Y,
+                     &_boxAxis0Z, &_boxAxis1X, &_boxAxis1Y, &_boxAxis1Z, &_boxAxis2X, &_boxAxis2Y,
+                     &_boxAxis2Z}) {
+    array->resize(count);
+  }
+  _strategies.resize(count);
+}
+
+void CullingStore::clear()
+{
+  resize(0);
+}
+
+void CullingStore::set(size_t index, const BoundingInfo& boundingInfo, unsigned int strategy)
+{
+  const auto& sphere = boundingInfo.boundingSphere;
+  _sphereCenterX[index] = sphere.centerWorld.x;
+  _sphereCenterY[index] = sphere.centerWorld.y;
+  _sphereCenterZ[index] = sphere.centerWorld.z;
+  _sphereRadius[index]  = sphere.radiusWorld;
+
+  // World corners: 0 = min, 1 = max, 2 = +x, 3 = +y, 4 = +z (see BoundingBox::reConstruct)
+  const auto& v      = boundingInfo.boundingBox.vectorsWorld;
+  _boxCenterX[index] = (v[0].x + v[1].x) * 0.5f;
+  _boxCenterY[index] = (v[0].y + v[1].y) * 0.5f;
+  _boxCenterZ[index] = (v[0].z + v[1].z) * 0.5f;
+  _boxAxis0X[index]  = (v[2].x - v[0].x) * 0.5f;
+  _boxAxis0Y[index]  = (v[2].y - v[0].y) * 0.5f;
+  _boxAxis0Z[index]  = (v[2].z - v[0].z) * 0.5f;
+  _boxAxis1X[index]  = (v[3].x - v[0].x) * 0.5f;
+  _boxAxis1Y[index]  = (v[3].y - v[0].y) * 0.5f;
+  _boxAxis1Z[index]  = (v[3].z - v[0].z) * 0.5f;
+  _boxAxis2X[index]  = (v[4].x - v[0].x) * 0.5f;
+  _boxAxis2Y[index]  = (v[4].y - v[0].y) * 0.5f;
+  _boxAxis2Z[index]  = (v[4].z - v[0].z) * 0.5f;
+
+  _strategies[index] = static_cast<uint8_t>(strategy);
+}
+
+void CullingStore::setBox(size_t index, const Vector3& minimum, const Vector3& maximum)
+{
+  const auto ex = (maximum.x - minimum.x) * 0.5f, ey = (maximum.y - minimum.y) * 0.5f,
+             ez = (maximum.z - minimum.z) * 0.5f;
+  const auto cx = minimum.x + ex, cy = minimum.y + ey, cz = minimum.z + ez;
+
+  // The circumscribed sphere never culls more than the box itself
+  _sphereCenterX[index] = cx;
+  _sphereCenterY[index] = cy;
+  _sphereCenterZ[index] = cz;
+  _sphereRadius[index]  = std::sqrt(ex * ex + ey * ey + ez * ez);
+
+  _boxCenterX[index] = cx;
+  _boxCenterY[index] = cy;
+  _boxCenterZ[index] = cz;
+  _boxAxis0X[index]  = ex;
+  _boxAxis0Y[index]  = 0.f;
+  _boxAxis0Z[index]  = 0.f;
+  _boxAxis1X[index]  = 0.f;
+  _boxAxis1Y[index]  = ey;
+  _boxAxis1Z[index]  = 0.f;
+  _boxAxis2X[index]  = 0.f;
+  _boxAxis2Y[index]  = 0.f;
+  _boxAxis2Z[index]  = ez;
+
+  _strategies[index] = static_cast<uint8_t>(Constants::MESHES_CULLINGSTRATEGY_STANDARD);
+}
+
+void CullingStore::isInFrustum(const std::array<Plane, 6>& frustumPlanes, uint8_t* result,
+                               size_t begin, size_t end) const
+{
+  const Volumes v{_sphereCenterX.data(), _sphereCenterY.data(), _sphereCenterZ.data(),
+                  _sphereRadius.data(),  _boxCenterX.data(),    _boxCenterY.data(),
+                  _boxCenterZ.data(),    _boxAxis0X.data(),     _boxAxis0Y.data(),
+                  _boxAxis0Z.data(),     _boxAxis1X.data(),     _boxAxis1Y.data(),
+                  _boxAxis1Z.data(),     _boxAxis2X.data(),     _boxAxis2Y.data(),
+                  _boxAxis2Z.data()};
+
+  uint8_t bits[Lanes];
+  auto i = begin;
+  for (; i + Lanes <= end; i += Lanes) {
+    testBatch(v, frustumPlanes, i, bits);
+    for (size_t lane = 0; lane < Lanes; ++lane) {
+      result[i - begin + lane] = resolve(bits[lane], _strategies[i + lane]);
+    }
+  }
+  for (; i < end; ++i) {
+    result[i - begin] = resolve(testScalar(v, frustumPlanes, i), _strategies[i]);
+  }
+}
+
+void CullingStore::isInFrustum(const std::array<Plane, 6>& frustumPlanes, uint8_t* result) const
+{
+  isInFrustum(frustumPlanes, result, 0, size());
+}
+
+const char* CullingStore::KernelName()
+{
+#if defined(BABYLON_CULLING_AVX)
+  return "AVX";
+#elif defined(BABYLON_CULLING_SSE2)
+  return "SSE2";
+#elif defined(BABYLON_CULLING_NEON)
+  return "NEON";
+#else
+  return "Scalar";
+#endif
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,549 @@
+#include <babylon/culling/octrees/loose_octree.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/plane.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+
+namespace BABYLON {
+
+namespace {
+
+enum class Containment { Outside, Intersecting, Inside };
+
+// Classifies an axis aligned box against the frustum planes
+Containment ClassifyBox(const std::array<Plane, 6>& frustumPlanes, const Vector3& minimum,
+                        const Vector3& maximum)
+{
+  const Vector3 center((minimum.x + maximum.x) * 0.5f, (minimum.y + maximum.y) * 0.5f,
+                       (minimum.z + maximum.z) * 0.5f);
+  const Vector3 extent((maximum.x - minimum.x) * 0.5f, (maximum.y - minimum.y) * 0.5f,
+                       (maximum.z - minimum.z) * 0.5f);
+  auto result = Containment::Inside;
+  for (const auto& plane : frustumPlanes) {
+    const auto distance = plane.dotCoordinate(center);
+    const auto radius   = std::abs(plane.normal.x) * extent.x + std::abs(plane.normal.y) * extent.y
+                        + std::abs(plane.normal.z) * extent.z;
+    if (distance < -radius) {
+      return Containment::Outside;
+    }
+    if (distance < radius) {
+      result = Containment::Intersecting;
+    }
+  }
+  return result;
+}
+
+} // end of anonymous namespace
+
+template <class T>
+LooseOctree<T>::LooseOctree(const BoundsFunc& boundsFunc, size_t maxBlockCapacity,
+                            size_t iMaxDepth)
+    : maxDepth{iMaxDepth}, _maxBlockCapacity{maxBlockCapacity}, _boundsFunc{boundsFunc}, _stamp{0}
+{
+  _reset(Vector3(-1.f, -1.f, -1.f), Vector3(1.f, 1.f, 1.f));
+}
+
+template <class T>
+LooseOctree<T>::~LooseOctree() = default;
+
+template <class T>
+size_t LooseOctree<T>::size() const
+{
+  return _entries.size();
+}
+
+template <class T>
+size_t LooseOctree<T>::nodeCount() const
+{
+  return _nodes.size() - _freeNodes.size();
+}
+
+template <class T>
+void LooseOctree<T>::update(const Vector3& worldMin, const Vector3& worldMax,
+                            const std::vector<T>& entries)
+{
+  _entries.clear();
+  _indices.clear();
+  _reset(worldMin, worldMax);
+
+  _entries.reserve(entries.size());
+  for (const auto& entry : entries) {
+    addEntry(entry);
+  }
+}
+
+template <class T>
+size_t LooseOctree<T>::refresh()
+{
+  size_t moved = 0;
+  for (uint32_t index = 0; index < _entries.size(); ++index) {
+    if (_refreshEntry(index)) {
+      ++moved;
+    }
+  }
+  return moved;
+}
+
+template <class T>
+void LooseOctree<T>::addEntry(const T& entry)
+{
+  if (_indices.find(entry) != _indices.end()) {
+    return;
+  }
+
+  const auto index = static_cast<uint32_t>(_entries.size());
+  _indices[entry]  = index;
+  _entries.emplace_back(Entry{entry, Vector3::Zero(), Vector3::Zero()});
+
+  auto& newEntry = _entries.back();
+  if (_boundsFunc(entry, newEntry.minimum, newEntry.maximum)) {
+    _link(index, _targetNode(newEntry.minimum, newEntry.maximum));
+  }
+  else {
+    newEntry.slot = static_cast<uint32_t>(_unselectables.size());
+    _unselectables.emplace_back(index);
+  }
+}
+
+template <class T>
+void LooseOctree<T>::removeEntry(const T& entry)
+{
+  const auto it = _indices.find(entry);
+  if (it == _indices.end()) {
+    return;
+  }
+
+  const auto index = it->second;
+  _indices.erase(it);
+  _unlink(index);
+
+  // Swap with the last entry
+  const auto last = static_cast<uint32_t>(_entries.size() - 1);
+  if (index != last) {
+    _entries[index]       = std::move(_entries[last]);
+    const auto& moved     = _entries[index];
+    _indices[moved.value] = index;
+    auto& slots           = moved.node == NoNode ? _unselectables : _nodes[moved.node].entries;
+    slots[moved.slot]     = index;
+  }
+  _entries.pop_back();
+}
+
+template <class T>
+bool LooseOctree<T>::updateEntry(const T& entry)
+{
+  const auto it = _indices.find(entry);
+  return it != _indices.end() && _refreshEntry(it->second);
+}
+
+template <class T>
+std::vector<T>& LooseOctree<T>::select(const std::array<Plane, 6>& frustumPlanes)
+{
+  _query(
+    [&frustumPlanes](const Vector3& minimum, const Vector3& maximum) {
+      switch (ClassifyBox(frustumPlanes, minimum, maximum)) {
+        case Containment::Outside:
+          return 0;
+        case Containment::Intersecting:
+          return 1;
+        default:
+          return 2;
+      }
+    },
+    [&frustumPlanes](const Vector3& minimum, const Vector3& maximum) {
+      return ClassifyBox(frustumPlanes, minimum, maximum) != Containment::Outside;
+    });
+  return _selectionContent;
+}
+
+template <class T>
+std::vector<T>& LooseOctree<T>::intersects(const Vector3& sphereCenter, float sphereRadius)
+{
+  const auto test = [&sphereCenter, sphereRadius](const Vector3& minimum, const Vector3& maximum) {
+    return BoundingBox::IntersectsSphere(minimum, maximum, sphereCenter, sphereRadius);
+  };
+  _query([&test](const Vector3& minimum,
+                 const Vector3& maximum) { return test(minimum, maximum) ? 1 : 0; },
+         test);
+  return _selectionContent;
+}
+
+template <class T>
+std::vector<T>& LooseOctree<T>::intersectsRay(const Ray& ray)
+{
+  const auto test = [&ray](const Vector3& minimum, const Vector3& maximum) {
+    return ray.intersectsBoxMinMax(minimum, maximum);
+  };
+  _query([&test](const Vector3& minimum,
+                 const Vector3& maximum) { return test(minimum, maximum) ? 1 : 0; },
+         test);
+  return _selectionContent;
+}
+
+template <class T>
+bool LooseOctree<T>::BoundsFuncForMeshes(AbstractMesh* const& entry, Vector3& minimum,
+                                         Vector3& maximum)
+{
+  if (entry->isBlocked()) {
+    return false;
+  }
+
+  entry->computeWorldMatrix();
+  const auto& boundingInfo = entry->getBoundingInfo();
+  if (!boundingInfo) {
+    return false;
+  }
+
+  minimum = boundingInfo->boundingBox.minimumWorld;
+  maximum = boundingInfo->boundingBox.maximumWorld;
+  return true;
+}
+
+template <class T>
+bool LooseOctree<T>::BoundsFuncForSubMeshes(SubMesh* const& entry, Vector3& minimum,
+                                            Vector3& maximum)
+{
+  const auto& boundingInfo = entry->getBoundingInfo();
+  if (!boundingInfo) {
+    return false;
+  }
+
+  minimum = boundingInfo->boundingBox.minimumWorld;
+  maximum = boundingInfo->boundingBox.maximumWorld;
+  return true;
+}
+
+template <class T>
+void LooseOctree<T>::_reset(const Vector3& worldMin, const Vector3& worldMax)
+{
+  Node root;
+  root.center   = worldMin.add(worldMax).scale(0.5f);
+  root.halfSize = std::max({worldMax.x - worldMin.x, worldMax.y - worldMin.y,
+                            worldMax.z - worldMin.z})
+                  * 0.5f;
+  // Empty or invalid extends
+  if (!(root.halfSize > 0.f) || !std::isfinite(root.halfSize)) {
+    root.center   = Vector3::Zero();
+    root.halfSize = 1.f;
+  }
+  root.children.fill(NoNode);
+
+  _nodes.clear();
+  _freeNodes.clear();
+  _nodes.emplace_back(std::move(root));
+  _unselectables.clear();
+}
+
+template <class T>
+uint32_t LooseOctree<T>::_createNode(uint32_t parent, size_t childIndex)
+{
+  const auto parentCenter   = _nodes[parent].center;
+  const auto parentHalfSize = _nodes[parent].halfSize;
+  const auto parentDepth    = _nodes[parent].depth;
+
+  uint32_t index = 0;
+  if (!_freeNodes.empty()) {
+    index = _freeNodes.back();
+    _freeNodes.pop_back();
+  }
+  else {
+    index = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+  }
+
+  auto& node      = _nodes[index];
+  const auto q    = parentHalfSize * 0.5f;
+  node.center     = Vector3(parentCenter.x + ((childIndex & 1) ? q : -q),
+                            parentCenter.y + ((childIndex & 2) ? q : -q),
+                            parentCenter.z + ((childIndex & 4) ? q : -q));
+  node.halfSize   = q;
+  node.parent     = parent;
+  node.depth      = parentDepth + 1;
+  node.entryCount = 0;
+  node.children.fill(NoNode);
+  node.entries.clear();
+
+  _nodes[parent].children[childIndex] = index;
+  return index;
+}
+
+template <class T>
+void LooseOctree<T>::_releaseNode(uint32_t index)
+{
+  auto& node = _nodes[index];
+  for (auto& child : node.children) {
+    if (child != NoNode) {
+      _releaseNode(child);
+      child = NoNode;
+    }
+  }
+
+  auto& siblings = _nodes[node.parent].children;
+  std::replace(siblings.begin(), siblings.end(), index, NoNode);
+  node.parent = NoNode;
+  _freeNodes.emplace_back(index);
+}
+
+template <class T>
+uint32_t LooseOctree<T>::_depthFor(const Vector3& minimum, const Vector3& maximum) const
+{
+  // The deepest level whose cells are at least as large as the entry
+  const auto extent
+    = std::max({maximum.x - minimum.x, maximum.y - minimum.y, maximum.z - minimum.z}) * 0.5f;
+  if (!(extent > 0.f)) {
+    return static_cast<uint32_t>(maxDepth);
+  }
+  const auto level = std::ilogb(_nodes[0].halfSize / extent);
+  return level <= 0 ? 0 : static_cast<uint32_t>(std::min(static_cast<size_t>(level), maxDepth));
+}
+
+template <class T>
+bool LooseOctree<T>::_isInCell(uint32_t index, const Vector3& center) const
+{
+  const auto& node = _nodes[index];
+  return std::abs(center.x - node.center.x) <= node.halfSize
+         && std::abs(center.y - node.center.y) <= node.halfSize
+         && std::abs(center.z - node.center.z) <= node.halfSize;
+}
+
+template <class T>
+uint32_t LooseOctree<T>::_childFor(uint32_t index, const Vector3& center)
+{
+  const auto& nodeCenter = _nodes[index].center;
+  const size_t childIndex
+    = (center.x >= nodeCenter.x ? 1 : 0) | (center.y >= nodeCenter.y ? 2 : 0)
+      | (center.z >= nodeCenter.z ? 4 : 0);
+  const auto child = _nodes[index].children[childIndex];
+  return child != NoNode ? child : _createNode(index, childIndex);
+}
+
+template <class T>
+uint32_t LooseOctree<T>::_targetNode(const Vector3& minimum, const Vector3& maximum)
+{
+  // Entries outside of the world are kept in the root
+  const auto center = minimum.add(maximum).scale(0.5f);
+  if (!_isInCell(0, center)) {
+    return 0;
+  }
+
+  // The entries added to a leaf stay in it until it is full
+  const auto depth = _depthFor(minimum, maximum);
+  uint32_t index   = 0;
+  while (_nodes[index].depth < depth && !_isLeaf(index)) {
+    index = _childFor(index, center);
+  }
+  return index;
+}
+
+template <class T>
+bool LooseOctree<T>::_fitsIn(uint32_t index, const Vector3& minimum, const Vector3& maximum) const
+{
+  // Entries grown too large for their cell move up
+  const auto& node = _nodes[index];
+  if (node.depth > _depthFor(minimum, maximum)) {
+    return false;
+  }
+  if (index == 0) {
+    return true;
+  }
+
+  // Entries stay in their cell as long as they are inside of its loose bounds
+  const auto looseSize = node.halfSize * 2.f;
+  return minimum.x >= node.center.x - looseSize
+         && minimum.y >= node.center.y - looseSize && minimum.z >= node.center.z - looseSize
+         && maximum.x <= node.center.x + looseSize && maximum.y <= node.center.y + looseSize
+         && maximum.z <= node.center.z + looseSize;
+}
+
+template <class T>
+bool LooseOctree<T>::_refreshEntry(uint32_t index)
+{
+  auto& entry = _entries[index];
+  Vector3 minimum, maximum;
+  if (!_boundsFunc(entry.value, minimum, maximum)) {
+    if (entry.node != NoNode) {
+      _unlink(index);
+      entry.slot = static_cast<uint32_t>(_unselectables.size());
+      _unselectables.emplace_back(index);
+      return true;
+    }
+    return false;
+  }
+
+  if (entry.node != NoNode && minimum.x == entry.minimum.x && minimum.y == entry.minimum.y
+      && minimum.z == entry.minimum.z && maximum.x == entry.maximum.x
+      && maximum.y == entry.maximum.y && maximum.z == entry.maximum.z) {
+    return false;
+  }
+
+  entry.minimum = minimum;
+  entry.maximum = maximum;
+  if (entry.node != NoNode && _fitsIn(entry.node, minimum, maximum)) {
+    return false;
+  }
+
+  // Unlinked first, the cells released by the removal can be reused by the target
+  const auto previousNode = entry.node;
+  _unlink(index);
+  const auto target = _targetNode(minimum, maximum);
+  _link(index, target);
+  return target != previousNode;
+}
+
+template <class T>
+void LooseOctree<T>::_link(uint32_t index, uint32_t node)
+{
+  auto& entry = _entries[index];
+  entry.node  = node;
+  entry.slot  = static_cast<uint32_t>(_nodes[node].entries.size());
+  _nodes[node].entries.emplace_back(index);
+  for (auto n = node; n != NoNode; n = _nodes[n].parent) {
+    ++_nodes[n].entryCount;
+  }
+
+  // Full leaves are split, leaves holding entries too large for their children are only checked
+  // again each time their count doubles
+  const auto count = _nodes[node].entries.size();
+  if (count > _maxBlockCapacity && _nodes[node].depth < maxDepth && _isLeaf(node)
+      && (count == _maxBlockCapacity + 1 || (count & (count - 1)) == 0)) {
+    _split(node);
+  }
+}
+
+template <class T>
+void LooseOctree<T>::_split(uint32_t index)
+{
+  const auto depth = _nodes[index].depth;
+  std::vector<std::pair<uint32_t, Vector3>> movingEntries;
+  for (const auto entryIndex : _nodes[index].entries) {
+    const auto& entry = _entries[entryIndex];
+    const auto center = entry.minimum.add(entry.maximum).scale(0.5f);
+    if (_depthFor(entry.minimum, entry.maximum) > depth && _isInCell(index, center)) {
+      movingEntries.emplace_back(entryIndex, center);
+    }
+  }
+
+  for (const auto& [entryIndex, center] : movingEntries) {
+    _unlink(entryIndex);
+    _link(entryIndex, _childFor(index, center));
+  }
+}
+
+template <class T>
+bool LooseOctree<T>::_isLeaf(uint32_t index) const
+{
+  // Empty cells are released, so only the leaves hold all the entries of their subtree
+  return _nodes[index].entryCount == _nodes[index].entries.size();
+}
+
+template <class T>
+void LooseOctree<T>::_unlink(uint32_t index)
+{
+  const auto& entry    = _entries[index];
+  auto& slots          = entry.node == NoNode ? _unselectables : _nodes[entry.node].entries;
+  const auto moved     = slots.back();
+  slots[entry.slot]    = moved;
+  _entries[moved].slot = entry.slot;
+  slots.pop_back();
+
+  if (entry.node == NoNode) {
+    return;
+  }
+
+  // Releases the topmost cell left empty
+  auto emptyNode = NoNode;
+  for (auto n = entry.node; n != NoNode; n = _nodes[n].parent) {
+    if (--_nodes[n].entryCount == 0 && n != 0) {
+      emptyNode = n;
+    }
+  }
+  if (emptyNode != NoNode) {
+    _releaseNode(emptyNode);
+  }
+  _entries[index].node = NoNode;
+}
+
+template <class T>
+template <typename NodeTest, typename EntryTest>
+void LooseOctree<T>::_query(const NodeTest& nodeTest, const EntryTest& entryTest)
+{
+  _selectionContent.clear();
+  if (++_stamp == 0) {
+    for (auto& entry : _entries) {
+      entry.stamp = 0;
+    }
+    _stamp = 1;
+  }
+
+  // The root is not culled, it holds the entries outside of the world
+  _stack.assign(1, 0);
+  while (!_stack.empty()) {
+    const auto& node = _nodes[_stack.back()];
+    _stack.pop_back();
+
+    for (const auto index : node.entries) {
+      auto& entry = _entries[index];
+      if (entryTest(entry.minimum, entry.maximum)) {
+        entry.stamp = _stamp;
+        _selectionContent.emplace_back(entry.value);
+      }
+    }
+
+    for (const auto child : node.children) {
+      if (child == NoNode) {
+        continue;
+      }
+      const auto& childNode = _nodes[child];
+      const auto looseSize  = childNode.halfSize * 2.f;
+      const Vector3 looseExtent(looseSize, looseSize, looseSize);
+      const auto result = nodeTest(childNode.center.subtract(looseExtent),
+                                   childNode.center.add(looseExtent));
+      if (result == 2) {
+        _selectSubtree(child);
+      }
+      else if (result == 1) {
+        _stack.emplace_back(child);
+      }
+    }
+  }
+
+  // Dynamic content, the entries already selected are skipped
+  for (const auto& value : dynamicContent) {
+    const auto it = _indices.find(value);
+    if (it != _indices.end()) {
+      auto& entry = _entries[it->second];
+      if (entry.stamp == _stamp) {
+        continue;
+      }
+      entry.stamp = _stamp;
+    }
+    _selectionContent.emplace_back(value);
+  }
+}
+
+template <class T>
+void LooseOctree<T>::_selectSubtree(uint32_t index)
+{
+  const auto& node = _nodes[index];
+  for (const auto entryIndex : node.entries) {
+    auto& entry = _entries[entryIndex];
+    entry.stamp = _stamp;
+    _selectionContent.emplace_back(entry.value);
+  }
+  for (const auto child : node.children) {
+    if (child != NoNode) {
+      _selectSubtree(child);
+    }
+  }
+}
+
+template class LooseOctree<AbstractMesh*>;
+template class LooseOctree<SubMesh*>;
+
+} // end of namespace BABYLON
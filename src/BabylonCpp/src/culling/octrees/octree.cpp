@@ -52,15 +52,11 @@ std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes, boo
 {
   _selectionContent.clear();
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
-  }
+  OctreeBlock<T>::_SelectBlocks(*this, frustumPlanes, _selectionContent, true);
+  stl_util::concat(_selectionContent, dynamicContent);
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  if (!allowDuplicate) {
+    _removeDuplicates();
   }
 
   return _selectionContent;
@@ -73,14 +69,12 @@ std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter, float sphereR
   _selectionContent.clear();
 
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent, allowDuplicate);
+    block.intersects(sphereCenter, sphereRadius, _selectionContent, true);
   }
+  stl_util::concat(_selectionContent, dynamicContent);
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  if (!allowDuplicate) {
+    _removeDuplicates();
   }
 
   return _selectionContent;
@@ -94,12 +88,27 @@ std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
   for (auto& block : IOctreeContainer<T>::blocks) {
     block.intersectsRay(ray, _selectionContent);
   }
+  stl_util::concat(_selectionContent, dynamicContent);
 
-  stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  _removeDuplicates();
 
   return _selectionContent;
 }
 
+template <class T>
+void Octree<T>::_removeDuplicates()
+{
+  // The entries overlapping several blocks are only kept once, in selection order
+  _selectedEntries.clear();
+  size_t count = 0;
+  for (const auto& entry : _selectionContent) {
+    if (_selectedEntries.insert(entry).second) {
+      _selectionContent[count++] = entry;
+    }
+  }
+  _selectionContent.resize(count);
+}
+
 template <class T>
 void Octree<T>::CreationFuncForMeshes(AbstractMesh* entry, OctreeBlock<AbstractMesh*>& block)
 {
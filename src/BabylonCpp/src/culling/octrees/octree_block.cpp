@@ -112,18 +112,38 @@ void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes, std::vect
                             bool allowDuplicate)
 {
   if (BoundingBox::IsInFrustum(_boundingVectors, frustumPlanes)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.select(frustumPlanes, selection, allowDuplicate);
-      }
-      return;
-    }
+    _selectContent(frustumPlanes, selection, allowDuplicate);
+  }
+}
 
-    if (allowDuplicate) {
-      stl_util::concat(selection, entries);
-    }
-    else {
-      stl_util::concat_with_no_duplicates(selection, entries);
+template <class T>
+void OctreeBlock<T>::_selectContent(const std::array<Plane, 6>& frustumPlanes,
+                                    std::vector<T>& selection, bool allowDuplicate)
+{
+  if (!IOctreeContainer<T>::blocks.empty()) {
+    _SelectBlocks(*this, frustumPlanes, selection, allowDuplicate);
+    return;
+  }
+
+  if (allowDuplicate) {
+    stl_util::concat(selection, entries);
+  }
+  else {
+    stl_util::concat_with_no_duplicates(selection, entries);
+  }
+}
+
+template <class T>
+void OctreeBlock<T>::_SelectBlocks(IOctreeContainer<T>& container,
+                                   const std::array<Plane, 6>& frustumPlanes,
+                                   std::vector<T>& selection, bool allowDuplicate)
+{
+  // The 8 child blocks are tested against the frustum at once
+  std::array<uint8_t, 8> visibilities{};
+  container._blocksCullingStore.isInFrustum(frustumPlanes, visibilities.data());
+  for (size_t i = 0; i < container.blocks.size(); ++i) {
+    if (visibilities[i]) {
+      container.blocks[i]._selectContent(frustumPlanes, selection, allowDuplicate);
     }
   }
 }
@@ -159,7 +179,7 @@ void OctreeBlock<T>::intersectsRay(const Ray& ray, std::vector<T>& selection)
       }
       return;
     }
-    stl_util::concat_with_no_duplicates(selection, entries);
+    stl_util::concat(selection, entries);
   }
 }
 
@@ -178,6 +198,7 @@ void OctreeBlock<T>::_CreateBlocks(const Vector3& worldMin, const Vector3& world
                                    const std::function<void(T&, OctreeBlock<T>&)>& creationFunc)
 {
   target.blocks.clear();
+  target._blocksCullingStore.clear();
   Vector3 blockSize((worldMax.x - worldMin.x) / 2.f, (worldMax.y - worldMin.y) / 2.f,
                     (worldMax.z - worldMin.z) / 2.f);
 
@@ -193,10 +214,15 @@ void OctreeBlock<T>::_CreateBlocks(const Vector3& worldMin, const Vector3& world
         OctreeBlock<T> block(localMin, localMax, maxBlockCapacity, currentDepth + 1, maxDepth,
                              creationFunc);
         block.addEntries(entries);
-        target.blocks.emplace_back(block);
+        target.blocks.emplace_back(std::move(block));
       }
     }
   }
+
+  target._blocksCullingStore.resize(target.blocks.size());
+  for (size_t i = 0; i < target.blocks.size(); ++i) {
+    target._blocksCullingStore.setBox(i, target.blocks[i].minPoint(), target.blocks[i].maxPoint());
+  }
 }
 
 template class OctreeBlock<AbstractMesh*>;
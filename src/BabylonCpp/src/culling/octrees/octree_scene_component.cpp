@@ -43,6 +43,18 @@ void OctreeSceneComponent::_register()
         std::remove(sceneOctree->dynamicContent.begin(), sceneOctree->dynamicContent.end(), mesh),
         sceneOctree->dynamicContent.end());
     }
+    auto& dynamicOctree = scene->dynamicSelectionOctree();
+    if (dynamicOctree) {
+      dynamicOctree->removeEntry(mesh);
+      stl_util::remove_vector_elements_equal(dynamicOctree->dynamicContent, mesh);
+    }
+  });
+
+  scene->onNewMeshAddedObservable.add([this](AbstractMesh* mesh, EventState& /*es*/) {
+    auto& dynamicOctree = scene->dynamicSelectionOctree();
+    if (dynamicOctree) {
+      dynamicOctree->addEntry(mesh);
+    }
   });
 
   scene->onMeshImportedObservable.add([this](AbstractMesh* mesh, EventState& /*es*/) {
@@ -55,6 +67,12 @@ void OctreeSceneComponent::_register()
 
 std::vector<AbstractMesh*> OctreeSceneComponent::getActiveMeshCandidates()
 {
+  auto& dynamicOctree = scene->dynamicSelectionOctree();
+  if (dynamicOctree) {
+    // The meshes that moved since the last selection are moved to their new cells first
+    dynamicOctree->refresh();
+    return dynamicOctree->select(scene->frustumPlanes());
+  }
   if (scene->selectionOctree()) {
     auto selection = scene->selectionOctree()->select(scene->frustumPlanes());
     return selection;
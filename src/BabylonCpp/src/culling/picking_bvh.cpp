@@ -0,0 +1,161 @@
+#include <babylon/culling/picking_bvh.h>
+
+#include <cmath>
+
+#include <babylon/bones/skeleton.h>
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/instanced_lines_mesh.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/lines_mesh.h>
+#include <babylon/meshes/mesh.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Number of refits after which the hierarchy is rebuilt to keep its quality
+constexpr size_t MaxRefitCount = 32;
+
+bool BoundsEqual(const std::vector<BVH::Bounds>& a, const std::vector<BVH::Bounds>& b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].minimum != b[i].minimum || a[i].maximum != b[i].maximum) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
+PickingBVH::PickingBVH() : _refitCount{0}
+{
+}
+
+PickingBVH::~PickingBVH() = default;
+
+bool PickingBVH::IsCullable(AbstractMesh& mesh)
+{
+  if (!mesh._boundingInfo || mesh.doNotSyncBoundingInfo || mesh._masterMesh
+      || mesh.hasThinInstances()) {
+    return false;
+  }
+
+  if (mesh.skeleton() && mesh.skeleton()->overrideMesh) {
+    return false;
+  }
+
+  // The intersection threshold of lines meshes is not part of their bounding box
+  if (dynamic_cast<LinesMesh*>(&mesh) || dynamic_cast<InstancedLinesMesh*>(&mesh)) {
+    return false;
+  }
+
+  // Instances of meshes with LOD levels may be picked with the world matrix of a level
+  if (auto instance = dynamic_cast<InstancedMesh*>(&mesh)) {
+    return !instance->sourceMesh() || !instance->sourceMesh()->hasLODLevels();
+  }
+
+  return true;
+}
+
+void PickingBVH::update(const std::vector<AbstractMeshPtr>& meshes)
+{
+  auto rebuild = meshes.size() != _meshes.size();
+  _meshes.resize(meshes.size());
+  _newCulledMeshes.clear();
+  _newBounds.clear();
+  _uncullableMeshes.clear();
+
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    auto& mesh = *meshes[i];
+    if (_meshes[i] != &mesh) {
+      _meshes[i] = &mesh;
+      rebuild    = true;
+    }
+
+    // Same world matrix (and world bounding box) as the one used by Scene::pick
+    mesh.getWorldMatrix();
+
+    if (!IsCullable(mesh)) {
+      _uncullableMeshes.emplace_back(i);
+      continue;
+    }
+
+    const auto& boundingBox = mesh._boundingInfo->boundingBox;
+    const auto& minimum     = boundingBox.minimumWorld;
+    const auto& maximum     = boundingBox.maximumWorld;
+
+    // The bounds are enlarged to cover the rounding errors of the ray transformation in the mesh
+    // local space
+    const auto padding
+      = 1e-4f
+        * (1.f
+           + std::max({std::abs(minimum.x), std::abs(minimum.y), std::abs(minimum.z),
+                       std::abs(maximum.x), std::abs(maximum.y), std::abs(maximum.z)}));
+    _newCulledMeshes.emplace_back(i);
+    _newBounds.emplace_back(
+      BVH::Bounds{{minimum.x - padding, minimum.y - padding, minimum.z - padding},
+                  {maximum.x + padding, maximum.y + padding, maximum.z + padding}});
+  }
+
+  rebuild = rebuild || _newCulledMeshes != _culledMeshes || _refitCount >= MaxRefitCount;
+  if (rebuild) {
+    _culledMeshes.swap(_newCulledMeshes);
+    _bounds.swap(_newBounds);
+    _bvh.build(_bounds);
+    _refitCount = 0;
+  }
+  else if (!BoundsEqual(_bounds, _newBounds)) {
+    _bounds.swap(_newBounds);
+    _bvh.refit(_bounds);
+    ++_refitCount;
+  }
+}
+
+void PickingBVH::collectCandidates(const Ray& ray, std::vector<size_t>& candidates) const
+{
+  candidates.clear();
+
+  if (!_bvh.empty()) {
+    // The mesh tests (Ray::intersectsSphere / Ray::intersectsBox) ignore the length of the ray
+    const BVH::RayData rayData(ray.origin, ray.direction);
+    const auto maxDistance = std::numeric_limits<float>::max();
+    std::array<uint32_t, 2 * BVH::MaxDepth> stack;
+    size_t stackSize   = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+      const auto& node = _bvh.nodes[stack[--stackSize]];
+      auto distance    = 0.f;
+      if (!BVH::IntersectsNode(node, rayData, maxDistance, distance)) {
+        continue;
+      }
+
+      if (node.isLeaf()) {
+        for (auto i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+          candidates.emplace_back(_culledMeshes[_bvh.primitiveIndices[i]]);
+        }
+      }
+      else {
+        stack[stackSize++] = node.leftFirst + 1;
+        stack[stackSize++] = node.leftFirst;
+      }
+    }
+  }
+
+  // The meshes are picked in the scene order
+  candidates.insert(candidates.end(), _uncullableMeshes.begin(), _uncullableMeshes.end());
+  std::sort(candidates.begin(), candidates.end());
+}
+
+size_t PickingBVH::culledMeshesCount() const
+{
+  return _culledMeshes.size();
+}
+
+} // end of namespace BABYLON
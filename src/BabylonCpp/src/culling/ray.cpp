@@ -11,8 +11,9 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 6> Ray::_TmpVector3{Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-                                        Vector3::Zero(), Vector3::Zero(), Vector3::Zero()};
+thread_local std::array<Vector3, 6> Ray::_TmpVector3{Vector3::Zero(), Vector3::Zero(),
+                                                     Vector3::Zero(), Vector3::Zero(),
+                                                     Vector3::Zero(), Vector3::Zero()};
 
 const float Ray::smallnum = 0.00000001f;
 const float Ray::rayl     = 10e8f;
@@ -0,0 +1,184 @@
+#include <babylon/culling/triangle_bvh.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+TriangleBVH::TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices,
+                         size_t indexStart, size_t indexCount)
+{
+  const auto unIndexed   = indices.empty();
+  const auto indexEnd    = indexStart + indexCount;
+  const auto vertexCount = positions.size();
+
+  // The face ids are the ones of the linear scans: local to the range for indexed geometries,
+  // index / 3 for unindexed ones
+  _triangles.reserve(indexCount / 3);
+  auto faceId = 0u;
+  for (auto index = indexStart; index + 2 < indexEnd; index += 3, ++faceId) {
+    Triangle triangle{};
+    if (unIndexed) {
+      triangle = Triangle{static_cast<uint32_t>(index), static_cast<uint32_t>(index + 1),
+                          static_cast<uint32_t>(index + 2), static_cast<uint32_t>(index / 3)};
+    }
+    else {
+      if (index + 2 >= indices.size()) {
+        break;
+      }
+      triangle = Triangle{indices[index], indices[index + 1], indices[index + 2], faceId};
+    }
+    if (triangle.indexA < vertexCount && triangle.indexB < vertexCount
+        && triangle.indexC < vertexCount) {
+      _triangles.emplace_back(triangle);
+    }
+  }
+
+  auto maxAbs = 0.f;
+  std::vector<BVH::Bounds> bounds(_triangles.size());
+  for (size_t i = 0; i < _triangles.size(); ++i) {
+    const auto& triangle = _triangles[i];
+    const auto& p0       = positions[triangle.indexA];
+    const auto& p1       = positions[triangle.indexB];
+    const auto& p2       = positions[triangle.indexC];
+    bounds[i]            = BVH::Bounds{
+      {std::min({p0.x, p1.x, p2.x}), std::min({p0.y, p1.y, p2.y}), std::min({p0.z, p1.z, p2.z})},
+      {std::max({p0.x, p1.x, p2.x}), std::max({p0.y, p1.y, p2.y}), std::max({p0.z, p1.z, p2.z})}};
+    for (size_t axis = 0; axis < 3; ++axis) {
+      maxAbs = std::max({maxAbs, std::abs(bounds[i].minimum[axis]),
+                         std::abs(bounds[i].maximum[axis])});
+    }
+  }
+
+  // The bounds are slightly enlarged so that the rounding errors of the slab tests never reject a
+  // triangle accepted by Ray::intersectsTriangle
+  const auto padding = 1e-5f * (1.f + maxAbs);
+  for (auto& triangleBounds : bounds) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      triangleBounds.minimum[axis] -= padding;
+      triangleBounds.maximum[axis] += padding;
+    }
+  }
+
+  _bvh.build(bounds);
+}
+
+TriangleBVH::~TriangleBVH() = default;
+
+size_t TriangleBVH::triangleCount() const
+{
+  return _triangles.size();
+}
+
+std::optional<IntersectionInfo>
+TriangleBVH::intersects(Ray& ray, const std::vector<Vector3>& positions, bool fastCheck,
+                        const TrianglePickingPredicate& trianglePredicate) const
+{
+  std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+
+  if (_bvh.empty()) {
+    return intersectInfo;
+  }
+
+  const BVH::RayData rayData(ray.origin, ray.direction);
+  auto distance = 0.f;
+  if (!BVH::IntersectsNode(_bvh.nodes[0], rayData, ray.length, distance)) {
+    return intersectInfo;
+  }
+
+  // Nodes are visited front to back. Looking for the closest hit, the nodes starting after the
+  // current hit are skipped, with fastCheck the whole hierarchy is traversed but only the faces
+  // preceding the current hit are tested
+  std::array<std::pair<uint32_t, float>, 2 * BVH::MaxDepth> stack;
+  size_t stackSize   = 0;
+  stack[stackSize++] = {0u, distance};
+  while (stackSize > 0) {
+    const auto [nodeIndex, nodeDistance] = stack[--stackSize];
+    if (!fastCheck && intersectInfo && nodeDistance > intersectInfo->distance) {
+      continue;
+    }
+
+    const auto& node = _bvh.nodes[nodeIndex];
+    if (node.isLeaf()) {
+      for (auto i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+        const auto& triangle = _triangles[_bvh.primitiveIndices[i]];
+        if (fastCheck && intersectInfo && triangle.faceId > intersectInfo->faceId) {
+          continue;
+        }
+
+        const auto& p0 = positions[triangle.indexA];
+        const auto& p1 = positions[triangle.indexB];
+        const auto& p2 = positions[triangle.indexC];
+
+        if (trianglePredicate && !trianglePredicate(p0, p1, p2, ray)) {
+          continue;
+        }
+
+        const auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+        if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+          continue;
+        }
+
+        const auto isBetter
+          = !intersectInfo
+            || (fastCheck ? triangle.faceId < intersectInfo->faceId :
+                            currentIntersectInfo->distance < intersectInfo->distance
+                              || (currentIntersectInfo->distance == intersectInfo->distance
+                                  && triangle.faceId < intersectInfo->faceId));
+        if (isBetter) {
+          intersectInfo         = currentIntersectInfo;
+          intersectInfo->faceId = triangle.faceId;
+        }
+      }
+      continue;
+    }
+
+    const auto maxDistance = !fastCheck && intersectInfo ? intersectInfo->distance : ray.length;
+    auto leftDistance      = 0.f;
+    auto rightDistance     = 0.f;
+    const auto hitLeft
+      = BVH::IntersectsNode(_bvh.nodes[node.leftFirst], rayData, maxDistance, leftDistance);
+    const auto hitRight
+      = BVH::IntersectsNode(_bvh.nodes[node.leftFirst + 1], rayData, maxDistance, rightDistance);
+    if (hitLeft && hitRight) {
+      // The nearest child is pushed last to be visited first
+      if (leftDistance <= rightDistance) {
+        stack[stackSize++] = {node.leftFirst + 1, rightDistance};
+        stack[stackSize++] = {node.leftFirst, leftDistance};
+      }
+      else {
+        stack[stackSize++] = {node.leftFirst, leftDistance};
+        stack[stackSize++] = {node.leftFirst + 1, rightDistance};
+      }
+    }
+    else if (hitLeft) {
+      stack[stackSize++] = {node.leftFirst, leftDistance};
+    }
+    else if (hitRight) {
+      stack[stackSize++] = {node.leftFirst + 1, rightDistance};
+    }
+  }
+
+  return intersectInfo;
+}
+
+void TriangleBVH::collectTriangles(const Vector3& minimum, const Vector3& maximum,
+                                   std::vector<Triangle>& triangles) const
+{
+  triangles.clear();
+
+  const BVH::Bounds bounds{{minimum.x, minimum.y, minimum.z}, {maximum.x, maximum.y, maximum.z}};
+  _bvh.forEachOverlap(bounds, [this, &triangles](uint32_t primitiveIndex) {
+    triangles.emplace_back(_triangles[primitiveIndex]);
+  });
+
+  // Same order as the linear scans
+  std::sort(triangles.begin(), triangles.end(),
+            [](const Triangle& a, const Triangle& b) { return a.faceId < b.faceId; });
+}
+
+} // end of namespace BABYLON
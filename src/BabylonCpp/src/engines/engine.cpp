@@ -706,6 +706,10 @@ Engine::_createShaderProgram(const WebGLPipelineContextPtr& pipelineContext,
     pipelineContext->transformFeedback = transformFeedback;
   }
 
+  if (!pipelineContext->programBinaryKey.empty()) {
+    context->programParameteri(shaderProgram.get(), GL::PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+  }
+
   context->linkProgram(shaderProgram.get());
 
   if (webGLVersion() > 1.f && !transformFeedbackVaryings.empty()) {
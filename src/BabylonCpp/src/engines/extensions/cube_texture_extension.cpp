@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/depth_texture_creation_options.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/engines/thin_engine.h>
 #include <babylon/materials/textures/iinternal_texture_loader.h>
 #include <babylon/materials/textures/internal_texture.h>
@@ -199,6 +200,7 @@ InternalTexturePtr CubeTextureExtension::createCubeTexture(
   }
 
   _this->_internalTexturesCache.emplace_back(texture);
+  _this->getTextureCache().add(TextureCache::ComputeKey(originalRootUrl), texture);
 
   return texture;
 }
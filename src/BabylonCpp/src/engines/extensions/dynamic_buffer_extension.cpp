@@ -1,7 +1,10 @@
 #include <babylon/engines/extensions/dynamic_buffer_extension.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <algorithm>
+
 #include <babylon/engines/thin_engine.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
 
 namespace BABYLON {
 
@@ -39,13 +42,49 @@ void DynamicBufferExtension::updateDynamicVertexBuffer(const WebGLDataBufferPtr&
   if (byteLength == -1 || (byteLength >= dataLength && byteOffset == 0)) {
     _this->_gl->bufferSubData(GL::ARRAY_BUFFER, byteOffset, data);
   }
-  else {
-    auto byteArray = stl_util::to_array<uint8_t>(data, static_cast<size_t>(byteOffset),
-                                                 static_cast<size_t>(byteLength));
-    _this->_gl->bufferSubData(GL::ARRAY_BUFFER, 0, byteArray);
+  else if (byteOffset < dataLength) {
+    // Upload the byte range straight from the source array, nothing is left past its end
+    const auto bytes = reinterpret_cast<const uint8_t*>(data.data()) + byteOffset;
+    byteLength       = std::min(byteLength, dataLength - byteOffset);
+    _this->_gl->bufferSubData(GL::ARRAY_BUFFER, 0, byteLength, bytes);
   }
 
   _this->_resetVertexBufferBinding();
 }
 
+void DynamicBufferExtension::resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                                       size_t byteLength)
+{
+  _this->bindArrayBuffer(vertexBuffer);
+
+  _this->_gl->bufferData(GL::ARRAY_BUFFER, static_cast<GL::GLsizeiptr>(byteLength),
+                         GL::DYNAMIC_DRAW);
+  vertexBuffer->capacity = byteLength;
+
+  _this->_resetVertexBufferBinding();
+}
+
+void DynamicBufferExtension::updateDynamicVertexBufferRange(const WebGLDataBufferPtr& vertexBuffer,
+                                                            const float* data, size_t byteOffset,
+                                                            size_t byteLength, bool discard)
+{
+  if (byteLength == 0) {
+    return;
+  }
+
+  _this->bindArrayBuffer(vertexBuffer);
+
+  // Orphan the data store: the driver hands out fresh storage instead of synchronizing with the
+  // draws still reading the previous content
+  if (discard && vertexBuffer->capacity > 0) {
+    _this->_gl->bufferData(GL::ARRAY_BUFFER, static_cast<GL::GLsizeiptr>(vertexBuffer->capacity),
+                           GL::DYNAMIC_DRAW);
+  }
+
+  _this->_gl->bufferSubData(GL::ARRAY_BUFFER, static_cast<GL::GLintptr>(byteOffset),
+                            static_cast<GL::GLsizeiptr>(byteLength), data);
+
+  _this->_resetVertexBufferBinding();
+}
+
 } // end of namespace BABYLON
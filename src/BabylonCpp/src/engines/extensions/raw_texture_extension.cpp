@@ -2,6 +2,7 @@
 
 #include <babylon/core/logging.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/engines/thin_engine.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/misc/tools.h>
@@ -277,6 +278,7 @@ InternalTexturePtr RawTextureExtension::createRawCubeTextureFromUrl(
   scene->_addPendingData(texture);
   texture->url = url;
   _this->_internalTexturesCache.emplace_back(texture);
+  _this->getTextureCache().add(TextureCache::ComputeKey(url), texture);
 
   const auto onerror = [=](const std::string& message, const std::string& exception) -> void {
     scene->_removePendingData(texture);
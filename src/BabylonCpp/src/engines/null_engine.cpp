@@ -2,11 +2,13 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/materials/effect.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/materials/textures/irender_target_options.h>
 #include <babylon/materials/textures/render_target_creation_options.h>
 #include <babylon/maths/isize.h>
+#include <babylon/maths/matrix.h>
 #include <babylon/meshes/webgl/webgl_data_buffer.h>
 #include <babylon/states/alpha_state.h>
 #include <babylon/states/depth_culling_state.h>
@@ -248,6 +250,11 @@ bool NullEngine::setMatrices(const WebGLUniformLocationPtr& /*uniform*/,
   return true;
 }
 
+bool NullEngine::setMatrix(const WebGLUniformLocationPtr& /*uniform*/, const Matrix& /*matrix*/)
+{
+  return true;
+}
+
 bool NullEngine::setMatrix3x3(const WebGLUniformLocationPtr& /*uniform*/,
                               const Float32Array& /*matrix*/)
 {
@@ -332,16 +339,19 @@ void NullEngine::wipeCaches(bool bruteForce)
 void NullEngine::draw(bool /*useTriangles*/, int /*indexStart*/, int /*indexCount*/,
                       int /*instancesCount*/)
 {
+  _reportDrawCall();
 }
 
 void NullEngine::drawElementsType(unsigned int /*fillMode*/, int /*indexStart*/,
                                   int /*verticesCount*/, int /*instancesCount*/)
 {
+  _reportDrawCall();
 }
 
 void NullEngine::drawArraysType(unsigned int /*fillMode*/, int /*verticesStart*/,
                                 int /*verticesCount*/, int /*instancesCount*/)
 {
+  _reportDrawCall();
 }
 
 WebGLTexturePtr NullEngine::_createTexture()
@@ -349,15 +359,16 @@ WebGLTexturePtr NullEngine::_createTexture()
   return std::make_shared<GL::IGLTexture>(0);
 }
 
-void NullEngine::_releaseTexture(const InternalTexturePtr& /*texture*/)
+void NullEngine::_releaseTexture(const InternalTexturePtr& texture)
 {
+  getTextureCache().remove(texture.get());
 }
 
 InternalTexturePtr NullEngine::createTexture(
   std::string url, bool noMipmap, bool invertY, Scene* /*scene*/, unsigned int samplingMode,
   const std::function<void(InternalTexture*, EventState&)>& onLoad,
   const std::function<void(const std::string& message, const std::string& exception)>& /*onError*/,
-  const std::optional<std::variant<std::string, ArrayBuffer, ArrayBufferView, Image>>& /*buffer*/,
+  const std::optional<std::variant<std::string, ArrayBuffer, ArrayBufferView, Image>>& buffer,
   const InternalTexturePtr& /*fallBack*/, const std::optional<unsigned int>& format,
   const std::string& /*forcedExtension*/, const std::string& /*mimeType*/,
   const LoaderOptionsPtr& /*loaderOptions*/)
@@ -384,6 +395,9 @@ InternalTexturePtr NullEngine::createTexture(
   }
 
   _internalTexturesCache.emplace_back(texture);
+  auto& textureCache = getTextureCache();
+  textureCache.add(TextureCache::ComputeKey(url, buffer, textureCache.hashEmbeddedBuffers), texture,
+                   format);
 
   return texture;
 }
@@ -481,11 +495,11 @@ void NullEngine::unBindFramebuffer(const InternalTexturePtr& texture,
   _currentFramebuffer = nullptr;
 }
 
-WebGLDataBufferPtr NullEngine::createDynamicVertexBuffer(const Float32Array& /*vertices*/)
+WebGLDataBufferPtr NullEngine::createDynamicVertexBuffer(const Float32Array& vertices)
 {
   auto buffer        = std::make_shared<WebGLDataBuffer>(nullptr);
   buffer->references = 1;
-  buffer->capacity   = 1;
+  buffer->capacity   = vertices.size() * sizeof(float);
   return buffer;
 }
 
@@ -526,6 +540,18 @@ void NullEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& /*vertexBuf
 {
 }
 
+void NullEngine::resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                           size_t byteLength)
+{
+  vertexBuffer->capacity = byteLength;
+}
+
+void NullEngine::updateDynamicVertexBufferRange(const WebGLDataBufferPtr& /*vertexBuffer*/,
+                                                const float* /*data*/, size_t /*byteOffset*/,
+                                                size_t /*byteLength*/, bool /*discard*/)
+{
+}
+
 bool NullEngine::_bindTextureDirectly(unsigned int /*target*/, const InternalTexturePtr& texture,
                                       bool /*forTextureDataUpdate*/, bool /*force*/)
 {
@@ -547,7 +573,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture,
   _bindTextureDirectly(0, texture);
 }
 
-void NullEngine::_deleteBuffer(GL::IGLBuffer* /*buffer*/)
+void NullEngine::_deleteBuffer(const WebGLDataBufferPtr& /*buffer*/)
 {
 }
 
@@ -3,6 +3,8 @@
 #include <babylon/core/logging.h>
 #include <babylon/misc/string_tools.h>
 
+#include <cctype>
+
 namespace BABYLON {
 
 static std::string toString(const IInlineFunctionDescr& descr)
@@ -89,10 +91,10 @@ void ShaderCodeInliner::_collectFunctions()
       continue;
     }
 
-    const auto funcNameMatch = StringTools::regexMatch(
-      _sourceCode.substr(inlineTokenIndex + inlineToken.size(), funcParamsStartIndex),
-      std::regex(ShaderCodeInliner::_RegexpFindFunctionNameAndType, std::regex::optimize));
-    if (funcNameMatch.empty()) {
+    std::string funcType, funcName;
+    if (!_findFunctionTypeAndName(
+          _sourceCode.substr(inlineTokenIndex + inlineToken.size(), funcParamsStartIndex),
+          funcType, funcName)) {
       if (debug) {
         BABYLON_LOGF_WARN(
           "ShaderCodeInliner", "Could not extract the name/type of the function from: %s",
@@ -101,9 +103,6 @@ void ShaderCodeInliner::_collectFunctions()
       startIndex = inlineTokenIndex + inlineToken.size();
       continue;
     }
-    const auto funcType = funcNameMatch.size() > 3 ? funcNameMatch[3] : "";
-    const auto funcName = funcNameMatch.size() > 4 ? funcNameMatch[4] : "";
-
     // extract the parameters of the function as a whole string (without the leading / trailing
     // parenthesis)
     const auto funcParamsEndIndex
@@ -543,9 +542,49 @@ int ShaderCodeInliner::_findBackward(const std::string& s, int index, char c) co
   return index;
 }
 
-std::string ShaderCodeInliner::_escapeRegExp(const std::string& s) const
+bool ShaderCodeInliner::_findFunctionTypeAndName(const std::string& s, std::string& type,
+                                                 std::string& name) const
 {
-  return StringTools::regexReplace(s, R"([.*+?^%s()|[\]\\])", R"(\\$&)");
+  const auto isWhitespace = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+  const auto isWordChar
+    = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_'; };
+
+  // First "<whitespaces><type><whitespaces><name>" sequence
+  for (size_t start = 0; start < s.size(); ++start) {
+    if (!isWhitespace(s[start])) {
+      continue;
+    }
+
+    auto typeStart = start;
+    while (typeStart < s.size() && isWhitespace(s[typeStart])) {
+      ++typeStart;
+    }
+    auto typeEnd = typeStart;
+    while (typeEnd < s.size() && isWordChar(s[typeEnd])) {
+      ++typeEnd;
+    }
+    if (typeEnd == typeStart || typeEnd == s.size() || !isWhitespace(s[typeEnd])) {
+      continue;
+    }
+
+    auto nameStart = typeEnd;
+    while (nameStart < s.size() && isWhitespace(s[nameStart])) {
+      ++nameStart;
+    }
+    auto nameEnd = nameStart;
+    while (nameEnd < s.size() && isWordChar(s[nameEnd])) {
+      ++nameEnd;
+    }
+    if (nameEnd == nameStart) {
+      continue;
+    }
+
+    type = s.substr(typeStart, typeEnd - typeStart);
+    name = s.substr(nameStart, nameEnd - nameStart);
+    return true;
+  }
+
+  return false;
 }
 
 std::string ShaderCodeInliner::_replaceNames(std::string iCode,
@@ -555,10 +594,9 @@ std::string ShaderCodeInliner::_replaceNames(std::string iCode,
   // TODO: Make sure "source" is not part of a bigger identifier (for eg, if source=view and we
   // matched it with viewDirection)
   for (size_t i = 0; i < sources.size(); ++i) {
-    const auto source       = _escapeRegExp(sources[i]);
-    const auto& destination = destinations[i];
-
-    iCode = StringTools::regexReplace(iCode, source, destination);
+    if (!sources[i].empty()) {
+      iCode = StringTools::replace(iCode, sources[i], destinations[i]);
+    }
   }
 
   return iCode;
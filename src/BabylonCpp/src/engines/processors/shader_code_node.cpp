@@ -6,6 +6,81 @@
 
 namespace BABYLON {
 
+namespace {
+
+bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+size_t SkipWhitespaces(const std::string& line, size_t index)
+{
+  while (index < line.size() && IsWhitespace(line[index])) {
+    ++index;
+  }
+  return index;
+}
+
+size_t SkipNonWhitespaces(const std::string& line, size_t index)
+{
+  while (index < line.size() && !IsWhitespace(line[index])) {
+    ++index;
+  }
+  return index;
+}
+
+/**
+ * Returns whether the line declares a single uniform, i.e. whether it matches
+ * "uniform\s+(?:(?:highp)?|(?:lowp)?)\s*(\S+)\s+(\S+)\s*;" (a uniform block does not).
+ */
+bool IsUniformDeclaration(const std::string& line)
+{
+  for (auto position = line.find("uniform"); position != std::string::npos;
+       position      = line.find("uniform", position + 1)) {
+    const auto declaration = position + 7;
+    if (declaration >= line.size() || !IsWhitespace(line[declaration])) {
+      continue;
+    }
+
+    // The optional precision is either part of the type or skipped
+    const auto precision = SkipWhitespaces(line, declaration);
+    for (const auto typeStart : {precision, line.compare(precision, 5, "highp") == 0 ?
+                                              precision + 5 :
+                                              std::string::npos,
+                                 line.compare(precision, 4, "lowp") == 0 ? precision + 4 :
+                                                                           std::string::npos}) {
+      if (typeStart == std::string::npos) {
+        continue;
+      }
+
+      // Type
+      const auto type    = SkipWhitespaces(line, typeStart);
+      const auto typeEnd = SkipNonWhitespaces(line, type);
+      if (typeEnd == type || typeEnd >= line.size()) {
+        continue;
+      }
+
+      // Name followed by ';', possibly within the same word
+      const auto name    = SkipWhitespaces(line, typeEnd);
+      const auto nameEnd = SkipNonWhitespaces(line, name);
+      if (nameEnd == name) {
+        continue;
+      }
+      if (line.find(';', name + 1) < nameEnd) {
+        return true;
+      }
+      const auto semicolon = SkipWhitespaces(line, nameEnd);
+      if (semicolon < line.size() && line[semicolon] == ';') {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+} // end of anonymous namespace
+
 bool ShaderCodeNode::isValid(
   const std::unordered_map<std::string, std::string>& /*preprocessors*/) const
 {
@@ -36,10 +111,7 @@ std::string ShaderCodeNode::process(std::unordered_map<std::string, std::string>
       else if ((processor->uniformProcessor || processor->uniformBufferProcessor)
                && StringTools::startsWith(line, "uniform")
                && !options.lookForClosingBracketForUniformBuffer) {
-        auto reSearch = R"(uniform\s+(?:(?:highp)?|(?:lowp)?)\s*(\S+)\s+(\S+)\s*;)";
-        std::regex regex(reSearch, std::regex::optimize);
-
-        if (std::regex_search(line, regex)) { // uniform
+        if (IsUniformDeclaration(line)) { // uniform
           if (processor->uniformProcessor) {
             value = processor->uniformProcessor(line, options.isFragment, preprocessors,
                                                 options.processingContext);
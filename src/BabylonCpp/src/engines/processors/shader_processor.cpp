@@ -15,8 +15,193 @@
 #include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
 
+#include <array>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <typeinfo>
+
 namespace BABYLON {
 
+namespace {
+
+bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+/**
+ * 64-bit FNV-1a variant consuming 8 bytes per step, used to identify the source codes and includes.
+ */
+uint64_t HashString(const std::string& str)
+{
+  constexpr uint64_t prime = 0x100000001b3ull;
+
+  uint64_t hash = 0xcbf29ce484222325ull;
+  size_t i      = 0;
+  for (; i + sizeof(uint64_t) <= str.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, str.data() + i, sizeof(uint64_t));
+    hash = (hash ^ word) * prime;
+  }
+  for (; i < str.size(); ++i) {
+    hash = (hash ^ static_cast<uint8_t>(str[i])) * prime;
+  }
+
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * Match of the include directive "#include\s?<(.+)>(\((.*)\))*(\[(.*)\])*".
+ */
+struct IncludeMatch {
+  size_t position = 0;
+  size_t length   = 0;
+  std::string file;
+  std::optional<std::string> parameters;
+  std::optional<std::string> indexes;
+};
+
+/**
+ * Finds the next include directive, with the same semantics as the former regular expression: the
+ * groups are greedy and stop at the end of the line.
+ */
+bool FindNextInclude(const std::string& source, size_t from, IncludeMatch& match)
+{
+  static const std::string directive = "#include";
+
+  for (auto position = source.find(directive, from); position != std::string::npos;
+       position      = source.find(directive, position + 1)) {
+    auto index = position + directive.size();
+    if (index < source.size() && IsWhitespace(source[index])) {
+      ++index;
+    }
+    if (index >= source.size() || source[index] != '<') {
+      continue;
+    }
+
+    auto lineEnd = source.find_first_of("\r\n", index);
+    if (lineEnd == std::string::npos) {
+      lineEnd = source.size();
+    }
+
+    // File name, up to the last '>' of the line
+    const auto fileEnd = source.rfind('>', lineEnd - 1);
+    if (fileEnd == std::string::npos || fileEnd < index + 2) {
+      continue;
+    }
+
+    match.position = position;
+    match.file     = source.substr(index + 1, fileEnd - index - 1);
+    match.parameters.reset();
+    match.indexes.reset();
+    index = fileEnd + 1;
+
+    // Parameters, up to the last ')' of the line
+    if (index < lineEnd && source[index] == '(') {
+      const auto parametersEnd = source.rfind(')', lineEnd - 1);
+      if (parametersEnd != std::string::npos && parametersEnd > index) {
+        match.parameters = source.substr(index + 1, parametersEnd - index - 1);
+        index            = parametersEnd + 1;
+      }
+    }
+
+    // Indexes, up to the last ']' of the line
+    if (index < lineEnd && source[index] == '[') {
+      const auto indexesEnd = source.rfind(']', lineEnd - 1);
+      if (indexesEnd != std::string::npos && indexesEnd > index) {
+        match.indexes = source.substr(index + 1, indexesEnd - index - 1);
+        index         = indexesEnd + 1;
+      }
+    }
+
+    match.length = index - position;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Returns the string matched by a regular expression made of plain characters and escaped
+ * punctuation only, std::nullopt otherwise.
+ */
+std::optional<std::string> LiteralPattern(const std::string& pattern)
+{
+  static const std::string metacharacters = "\\^$.|?*+()[]{}";
+
+  std::string literal;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    auto c = pattern[i];
+    if (c == '\\') {
+      if (i + 1 == pattern.size() || metacharacters.find(pattern[i + 1]) == std::string::npos) {
+        return std::nullopt;
+      }
+      c = pattern[++i];
+    }
+    else if (metacharacters.find(c) != std::string::npos) {
+      return std::nullopt;
+    }
+    literal += c;
+  }
+
+  return literal;
+}
+
+/**
+ * Same as StringTools::regexReplace, without compiling a regular expression when the pattern is a
+ * plain string, which is always the case for the include parameters.
+ */
+std::string ReplaceAll(const std::string& source, const std::string& pattern,
+                       const std::string& replacement)
+{
+  const auto literal = LiteralPattern(pattern);
+  if (!literal || literal->empty() || replacement.find('$') != std::string::npos) {
+    return StringTools::regexReplace(source, pattern, replacement);
+  }
+
+  return StringTools::replace(source, *literal, replacement);
+}
+
+/**
+ * Processed shader code, valid as long as the includes it was built from are not modified.
+ */
+struct ProcessedCode {
+  std::string code;
+  std::vector<std::pair<std::string, uint64_t>> includes;
+  std::optional<bool> lookForClosingBracketForUniformBuffer;
+  std::list<std::string>::iterator order;
+};
+
+struct ProcessedCodeCache {
+  std::mutex mutex;
+  std::unordered_map<std::string, ProcessedCode> entries;
+  // Keys, least recently added first
+  std::list<std::string> order;
+};
+
+ProcessedCodeCache& GetProcessedCodeCache()
+{
+  static ProcessedCodeCache cache;
+  return cache;
+}
+
+} // end of anonymous namespace
+
+size_t ShaderProcessor::ProcessedCodeCacheMaxSize = 512;
+
+void ShaderProcessor::ClearProcessedCodeCache()
+{
+  auto& cache = GetProcessedCodeCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
+  cache.order.clear();
+}
+
 void ShaderProcessor::Initialize(ProcessingOptions& options)
 {
   if (options.processor && options.processor->initializeShaders) {
@@ -28,14 +213,115 @@ void ShaderProcessor::Process(const std::string& sourceCode, ProcessingOptions&
                               const std::function<void(const std::string& migratedCode)>& callback,
                               ThinEngine* engine)
 {
+  const auto key = _GetProcessedCodeKey(sourceCode, options, engine);
+
+  std::string processedCode;
+  if (_GetProcessedCode(key, options, processedCode)) {
+    callback(processedCode);
+    return;
+  }
+
+  options.includedFiles.clear();
   _ProcessIncludes(sourceCode, options,
-                   [&options, callback, &engine](const std::string& codeWithIncludes) -> void {
+                   [&options, callback, &engine, key](const std::string& codeWithIncludes) -> void {
                      const auto migratedCode
                        = _ProcessShaderConversion(codeWithIncludes, options, engine);
+                     _AddProcessedCode(key, options, migratedCode);
                      callback(migratedCode);
                    });
 }
 
+std::string ShaderProcessor::_GetProcessedCodeKey(const std::string& sourceCode,
+                                                  const ProcessingOptions& options,
+                                                  ThinEngine* engine)
+{
+  // Processing contexts are filled while processing, the shaders using them are not cached
+  if (ProcessedCodeCacheMaxSize == 0 || options.processingContext) {
+    return "";
+  }
+
+  std::ostringstream key;
+  key << std::hex << HashString(sourceCode) << ':' << std::dec << sourceCode.size() << '|'
+      << options.isFragment << options.shouldUseHighPrecisionShader
+      << options.supportsUniformBuffers << '|' << options.version << '|' << options.platformName
+      << '|' << options.lookForClosingBracketForUniformBuffer.value_or(false) << '|'
+      << options.indexParameters.dump() << '|' << engine << '|' << options.processor.get();
+  if (options.processor) {
+    key << typeid(*options.processor).name();
+  }
+  for (const auto& define : options.defines) {
+    key << '\n' << define;
+  }
+
+  return key.str();
+}
+
+bool ShaderProcessor::_GetProcessedCode(const std::string& key, ProcessingOptions& options,
+                                        std::string& processedCode)
+{
+  if (key.empty()) {
+    return false;
+  }
+
+  auto& cache = GetProcessedCodeCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  auto it = cache.entries.find(key);
+  if (it == cache.entries.end()) {
+    return false;
+  }
+
+  // The includes must be the same as the ones used to build the entry
+  auto& entry = it->second;
+  for (const auto& [includeFile, hash] : entry.includes) {
+    auto include = options.includesShadersStore.find(includeFile);
+    if (include == options.includesShadersStore.end() || HashString(include->second) != hash) {
+      cache.order.erase(entry.order);
+      cache.entries.erase(it);
+      return false;
+    }
+  }
+
+  options.lookForClosingBracketForUniformBuffer = entry.lookForClosingBracketForUniformBuffer;
+  processedCode                                 = entry.code;
+  return true;
+}
+
+void ShaderProcessor::_AddProcessedCode(const std::string& key, const ProcessingOptions& options,
+                                        const std::string& processedCode)
+{
+  if (key.empty()) {
+    return;
+  }
+
+  ProcessedCode entry;
+  entry.code                                  = processedCode;
+  entry.lookForClosingBracketForUniformBuffer = options.lookForClosingBracketForUniformBuffer;
+  for (const auto& includeFile : options.includedFiles) {
+    auto include = options.includesShadersStore.find(includeFile);
+    if (include != options.includesShadersStore.end()) {
+      entry.includes.emplace_back(includeFile, HashString(include->second));
+    }
+  }
+
+  auto& cache = GetProcessedCodeCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  auto it = cache.entries.find(key);
+  if (it != cache.entries.end()) {
+    cache.order.erase(it->second.order);
+    cache.entries.erase(it);
+  }
+
+  while (!cache.order.empty() && cache.entries.size() >= ProcessedCodeCacheMaxSize) {
+    cache.entries.erase(cache.order.front());
+    cache.order.pop_front();
+  }
+
+  entry.order = cache.order.insert(cache.order.end(), key);
+  cache.entries.emplace(key, std::move(entry));
+}
+
 std::unordered_map<std::string, std::string>
 ShaderProcessor::Finalize(const std::string& vertexCode, const std::string& fragmentCode,
                           ProcessingOptions& options)
@@ -70,13 +356,15 @@ std::string ShaderProcessor::_ProcessPrecision(std::string source, const Process
 
 ShaderDefineExpressionPtr ShaderProcessor::_ExtractOperation(const std::string& expression)
 {
-  auto reStr = R"(defined\((.+)\))";
-  std::regex regex(reStr, std::regex::optimize);
-  std::smatch match;
-
-  if (std::regex_search(expression, match, regex) && !match.empty()) {
-    return std::make_shared<ShaderDefineIsDefinedOperator>(StringTools::trimCopy(match[1]),
-                                                           expression[0] == '!');
+  // defined(...), up to the last closing parenthesis
+  const auto definedIndex = expression.find("defined(");
+  if (definedIndex != std::string::npos) {
+    const auto start = definedIndex + 8;
+    const auto end   = expression.rfind(')');
+    if (end != std::string::npos && end > start) {
+      return std::make_shared<ShaderDefineIsDefinedOperator>(
+        StringTools::trimCopy(expression.substr(start, end - start)), expression[0] == '!');
+    }
   }
 
   const std::vector<std::string> operators{"==", ">=", "<=", "<", ">"};
@@ -262,14 +550,10 @@ bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNode
 {
   while (cursor.canRead()) {
     ++cursor.lineIndex;
-    const auto& line      = cursor.currentLine();
-    const auto reKeywords = R"((#ifdef)|(#else)|(#elif)|(#endif)|(#ifndef)|(#if))";
-    std::regex regex(reKeywords, std::regex::optimize);
-    std::smatch matches;
-
-    if (std::regex_search(line, matches, regex) && !matches.empty()) {
-      auto keyword = matches[0].str();
+    const auto& line   = cursor.currentLine();
+    const auto keyword = _FindKeyword(line);
 
+    if (!keyword.empty()) {
       if (keyword == "#ifdef") {
         auto newRootNode = std::make_shared<ShaderCodeConditionNode>();
         rootNode->children.emplace_back(newRootNode);
@@ -320,6 +604,24 @@ bool ShaderProcessor::_MoveCursor(ShaderCodeCursor& cursor, const ShaderCodeNode
   return false;
 }
 
+std::string ShaderProcessor::_FindKeyword(const std::string& line)
+{
+  static const std::array<std::string, 6> keywords{"#ifdef", "#else",   "#elif",
+                                                   "#endif", "#ifndef", "#if"};
+
+  // First keyword of the line, the keywords being tested in order at each position
+  for (auto position = line.find('#'); position != std::string::npos;
+       position      = line.find('#', position + 1)) {
+    for (const auto& keyword : keywords) {
+      if (line.compare(position, keyword.size(), keyword) == 0) {
+        return keyword;
+      }
+    }
+  }
+
+  return "";
+}
+
 std::vector<std::string>
 ShaderProcessor::_removeCommentsAndEmptyLines(const std::vector<std::string>& sourceCodeLines)
 {
@@ -413,17 +715,13 @@ std::string ShaderProcessor::_ProcessShaderConversion(const std::string& sourceC
 void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, ProcessingOptions& options,
                                        const std::function<void(const std::string& data)>& callback)
 {
-  static const auto regexShaderIncludeStr = R"(#include\s?<(.+)>(\((.*)\))*(\[(.*)\])*)";
-  static std::regex regexShaderInclude(regexShaderIncludeStr, std::regex::optimize);
-  auto regexBegin = std::sregex_iterator(sourceCode.begin(), sourceCode.end(), regexShaderInclude);
-  auto regexEnd   = std::sregex_iterator();
-
   auto returnValue    = sourceCode;
   auto keepProcessing = false;
 
-  for (std::sregex_iterator regexIt = regexBegin; regexIt != regexEnd; ++regexIt) {
-    auto match       = *regexIt;
-    auto includeFile = match[1].str();
+  IncludeMatch match;
+  for (size_t from = 0; FindNextInclude(sourceCode, from, match);
+       from        = match.position + match.length) {
+    auto includeFile = match.file;
 
     // Uniform declaration
     if (StringTools::indexOf(includeFile, "__decl__") != -1) {
@@ -437,20 +735,22 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
 
     if (stl_util::contains(options.includesShadersStore, includeFile)
         && !options.includesShadersStore[includeFile].empty()) {
+      options.includedFiles.emplace_back(includeFile);
+
       // Substitution
       auto includeContent = options.includesShadersStore[includeFile];
-      if (match.size() > 2 && !match[2].str().empty()) {
-        auto splits = StringTools::split(match[3].str(), ',');
+      if (match.parameters) {
+        auto splits = StringTools::split(*match.parameters, ',');
 
         for (size_t index = 0; index < splits.size(); index += 2) {
           auto dest = splits[index + 1];
 
-          includeContent = StringTools::regexReplace(includeContent, splits[index], dest);
+          includeContent = ReplaceAll(includeContent, splits[index], dest);
         }
       }
 
-      if (match.size() > 4 && !match[4].str().empty()) {
-        auto indexString = match[5].str();
+      if (match.indexes) {
+        auto indexString = *match.indexes;
 
         if (StringTools::indexOf(indexString, "..") != -1) {
           StringTools::replaceInPlace(indexString, "..", "@");
@@ -474,8 +774,7 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
              });*/
             }
             includeContent
-              += StringTools::regexReplace(sourceIncludeContent, R"(\{X\})", std::to_string(i))
-                 + "\n";
+              += ReplaceAll(sourceIncludeContent, R"(\{X\})", std::to_string(i)) + "\n";
           }
         }
         else {
@@ -485,12 +784,13 @@ void ShaderProcessor::_ProcessIncludes(const std::string& sourceCode, Processing
             => { return p1 + "{X}";
             });*/
           }
-          includeContent = StringTools::regexReplace(includeContent, R"(\{X\})", indexString);
+          includeContent = ReplaceAll(includeContent, R"(\{X\})", indexString);
         }
       }
 
       // Replace
-      returnValue = StringTools::replace(returnValue, match[0].str(), includeContent);
+      returnValue = StringTools::replace(
+        returnValue, sourceCode.substr(match.position, match.length), includeContent);
 
       keepProcessing = keepProcessing                                            //
                        || StringTools::indexOf(includeContent, "#include<") >= 0 //
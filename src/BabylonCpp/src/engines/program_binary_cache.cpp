@@ -0,0 +1,208 @@
+#include <babylon/engines/program_binary_cache.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+#include <babylon/misc/string_tools.h>
+
+#include <cstring>
+#include <fstream>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t ProgramBinaryMagic   = 0x43425042; // "BPBC"
+constexpr uint32_t ProgramBinaryVersion = 1;
+
+/**
+ * Header of the files storing the program binaries.
+ */
+struct ProgramBinaryHeader {
+  uint32_t magic        = ProgramBinaryMagic;
+  uint32_t version      = ProgramBinaryVersion;
+  uint64_t driverHash   = 0;
+  uint32_t binaryFormat = 0;
+  uint32_t reserved     = 0;
+  uint64_t size         = 0;
+  uint64_t checksum     = 0;
+};
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+{
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+uint64_t HashString(const std::string& str, uint64_t hash = 0xcbf29ce484222325ull)
+{
+  // The size is hashed as well so that the concatenation of two strings is not ambiguous
+  const uint64_t size = str.size();
+  return HashBytes(str.data(), str.size(), HashBytes(&size, sizeof(size), hash));
+}
+
+} // end of anonymous namespace
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string& directory, const std::string& driverInfo)
+    : _directory{directory}, _driverInfo{driverInfo}, _driverHash{HashString(driverInfo)}
+{
+  if (!Filesystem::isDirectory(_directory) && !Filesystem::createDirectory(_directory)) {
+    BABYLON_LOGF_WARN("ProgramBinaryCache", "Unable to create the program binary cache directory %s",
+                      _directory.c_str())
+    return;
+  }
+
+  for (auto key : Filesystem::readFileLines(_getIndexPath().c_str())) {
+    StringTools::trim(key);
+    if (!key.empty()) {
+      _keys.insert(key);
+    }
+  }
+
+  // The binaries are only valid for the driver which produced them
+  auto cachedDriverInfo = Filesystem::readFileContents(_getDriverPath().c_str());
+  StringTools::trim(cachedDriverInfo);
+  if (cachedDriverInfo != _driverInfo) {
+    if (!_keys.empty()) {
+      BABYLON_LOG_INFO("ProgramBinaryCache", "Driver changed, discarding the program binary cache")
+    }
+    clear();
+    Filesystem::writeFileContents(_getDriverPath().c_str(), _driverInfo);
+  }
+}
+
+ProgramBinaryCache::~ProgramBinaryCache() = default;
+
+std::string ProgramBinaryCache::computeKey(const std::string& vertexSource,
+                                           const std::string& fragmentSource) const
+{
+  // Two hashes with different seeds, a collision would silently use the wrong program
+  const auto hash0 = HashString(fragmentSource, HashString(vertexSource, _driverHash));
+  const auto hash1 = HashString(fragmentSource, HashString(vertexSource, ~_driverHash));
+  return StringTools::printf("%016llx%016llx", static_cast<unsigned long long>(hash0),
+                             static_cast<unsigned long long>(hash1));
+}
+
+bool ProgramBinaryCache::load(const std::string& key, unsigned int& binaryFormat,
+                              Uint8Array& binary)
+{
+  if (_keys.find(key) == _keys.end()) {
+    ++_statistics.misses;
+    return false;
+  }
+
+  std::ifstream in(_getFilePath(key), std::ios::in | std::ios::binary);
+  ProgramBinaryHeader header;
+  if (in) {
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  }
+
+  bool valid = in && header.magic == ProgramBinaryMagic && header.version == ProgramBinaryVersion
+               && header.driverHash == _driverHash && header.size > 0;
+  if (valid) {
+    binary.resize(static_cast<size_t>(header.size));
+    in.read(reinterpret_cast<char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+    valid = in && HashBytes(binary.data(), binary.size()) == header.checksum;
+  }
+
+  if (!valid) {
+    // Truncated or outdated file
+    binary.clear();
+    remove(key);
+    ++_statistics.misses;
+    return false;
+  }
+
+  binaryFormat = header.binaryFormat;
+  ++_statistics.hits;
+  return true;
+}
+
+bool ProgramBinaryCache::save(const std::string& key, unsigned int binaryFormat,
+                              const Uint8Array& binary)
+{
+  if (binary.empty()) {
+    return false;
+  }
+
+  ProgramBinaryHeader header;
+  header.driverHash   = _driverHash;
+  header.binaryFormat = binaryFormat;
+  header.size         = binary.size();
+  header.checksum     = HashBytes(binary.data(), binary.size());
+
+  std::ofstream out(_getFilePath(key), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(binary.data()),
+            static_cast<std::streamsize>(binary.size()));
+  out.close();
+  if (!out) {
+    Filesystem::removeFile(_getFilePath(key));
+    return false;
+  }
+
+  if (_keys.insert(key).second) {
+    std::ofstream index(_getIndexPath(), std::ios::out | std::ios::app);
+    index << key << "\n";
+  }
+
+  return true;
+}
+
+void ProgramBinaryCache::remove(const std::string& key)
+{
+  if (_keys.erase(key) == 0) {
+    return;
+  }
+
+  ++_statistics.rejections;
+  Filesystem::removeFile(_getFilePath(key));
+  _writeIndex();
+}
+
+void ProgramBinaryCache::clear()
+{
+  for (const auto& key : _keys) {
+    Filesystem::removeFile(_getFilePath(key));
+  }
+  _keys.clear();
+  _writeIndex();
+}
+
+const std::string& ProgramBinaryCache::directory() const
+{
+  return _directory;
+}
+
+const ProgramBinaryCacheStatistics& ProgramBinaryCache::statistics() const
+{
+  return _statistics;
+}
+
+std::string ProgramBinaryCache::_getFilePath(const std::string& key) const
+{
+  return Filesystem::joinPath(_directory, key + ".bin");
+}
+
+std::string ProgramBinaryCache::_getIndexPath() const
+{
+  return Filesystem::joinPath(_directory, std::string("index.txt"));
+}
+
+std::string ProgramBinaryCache::_getDriverPath() const
+{
+  return Filesystem::joinPath(_directory, std::string("driver.txt"));
+}
+
+void ProgramBinaryCache::_writeIndex() const
+{
+  Filesystem::writeFileLines(_getIndexPath().c_str(),
+                             std::vector<std::string>(_keys.begin(), _keys.end()));
+}
+
+} // end of namespace BABYLON
@@ -19,9 +19,12 @@
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/culling_store.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
+#include <babylon/culling/picking_bvh.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engines/constants.h>
@@ -51,6 +54,7 @@
 #include <babylon/materials/pbr/pbr_material.h>
 #include <babylon/materials/standard_material.h>
 #include <babylon/materials/textures/base_texture.h>
+#include <babylon/materials/textures/internal_texture.h>
 #include <babylon/materials/textures/multi_render_target.h>
 #include <babylon/materials/textures/procedurals/procedural_texture.h>
 #include <babylon/materials/textures/render_target_texture.h>
@@ -67,6 +71,7 @@
 #include <babylon/misc/guid.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
+#include <babylon/particles/particle_simulation_scheduler.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/physics/physics_engine.h>
 #include <babylon/physics/physics_engine_component.h>
@@ -113,6 +118,11 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , beforeCameraRender{this, &Scene::set_beforeCameraRender}
     , afterCameraRender{this, &Scene::set_afterCameraRender}
     , customLODSelector{nullptr}
+    , parallelActiveMeshesEvaluation{false}
+    , batchedFrustumCulling{false}
+    , parallelParticlesAnimation{false}
+    , parallelSkeletonsEvaluation{false}
+    , bvhAcceleratedPicking{false}
     , pointerDownPredicate{nullptr}
     , pointerUpPredicate{nullptr}
     , pointerMovePredicate{nullptr}
@@ -187,6 +197,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _edgeRenderLineShader{nullptr}
     , debugLayer{this, &Scene::get_debugLayer}
     , selectionOctree{this, &Scene::get_selectionOctree}
+    , dynamicSelectionOctree{this, &Scene::get_dynamicSelectionOctree}
     , meshUnderPointer{this, &Scene::get_meshUnderPointer}
     , pointerX{this, &Scene::get_pointerX, &Scene::set_pointerX}
     , pointerY{this, &Scene::get_pointerY, &Scene::set_pointerY}
@@ -257,6 +268,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _defaultMaterial{nullptr}
     , _texturesEnabled{true}
     , _skeletonsEnabled{true}
+    , _deferSkeletonsPreparation{false}
     , _postProcessRenderPipelineManager{nullptr}
     , _collisionCoordinator{nullptr}
     , _hasAudioEngine{false}
@@ -290,7 +302,9 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _alternateRendering{false}
     , _frustumPlanesSet{false}
     , _frustumPlanes{}
+    , _cullingStore{nullptr}
     , _selectionOctree{nullptr}
+    , _dynamicSelectionOctree{nullptr}
     , _pointerOverMesh{nullptr}
     , _debugLayer{nullptr}
     , _geometryBufferRenderer{nullptr}
@@ -301,6 +315,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _prePassRenderer{nullptr}
     , _tempPickingRay{std::make_unique<Ray>(Ray::Zero())}
     , _cachedRayForTransform{nullptr}
+    , _pickingBVH{nullptr}
     , _audioEnabled{std::nullopt}
     , _headphone{std::nullopt}
     , _multiviewSceneUbo{nullptr}
@@ -851,6 +866,11 @@ Octree<AbstractMesh*>*& Scene::get_selectionOctree()
   return _selectionOctree;
 }
 
+std::unique_ptr<LooseOctree<AbstractMesh*>>& Scene::get_dynamicSelectionOctree()
+{
+  return _dynamicSelectionOctree;
+}
+
 AbstractMeshPtr& Scene::get_meshUnderPointer()
 {
   return _pointerOverMesh;
@@ -889,8 +909,9 @@ std::vector<AbstractMesh*> Scene::_getDefaultMeshCandidates()
 
 std::vector<SubMesh*> Scene::_getDefaultSubMeshCandidates(AbstractMesh* mesh)
 {
-  _defaultSubMeshCandidates = stl_util::to_raw_ptr_vector(mesh->subMeshes);
-  return _defaultSubMeshCandidates;
+  // No shared state: the intersecting sub meshes candidates are queried concurrently by
+  // pickWithRays
+  return stl_util::to_raw_ptr_vector(mesh->subMeshes);
 }
 
 void Scene::setDefaultCandidateProviders()
@@ -952,7 +973,7 @@ Engine* Scene::getEngine()
 
 size_t Scene::getTotalVertices() const
 {
-  return _totalVertices.current();
+  return static_cast<size_t>(_totalVertices.current());
 }
 
 PerfCounter& Scene::get_totalVerticesPerfCounter()
@@ -962,7 +983,7 @@ PerfCounter& Scene::get_totalVerticesPerfCounter()
 
 size_t Scene::getActiveIndices() const
 {
-  return _activeIndices.current();
+  return static_cast<size_t>(_activeIndices.current());
 }
 
 PerfCounter& Scene::get_totalActiveIndicesPerfCounter()
@@ -972,7 +993,7 @@ PerfCounter& Scene::get_totalActiveIndicesPerfCounter()
 
 size_t Scene::getActiveParticles() const
 {
-  return _activeParticles.current();
+  return static_cast<size_t>(_activeParticles.current());
 }
 
 PerfCounter& Scene::get_activeParticlesPerfCounter()
@@ -982,7 +1003,7 @@ PerfCounter& Scene::get_activeParticlesPerfCounter()
 
 size_t Scene::getActiveBones() const
 {
-  return _activeBones.current();
+  return static_cast<size_t>(_activeBones.current());
 }
 
 PerfCounter& Scene::get_activeBonesPerfCounter()
@@ -1918,8 +1939,9 @@ void Scene::_addPendingData(Mesh* /*mesh*/)
 {
 }
 
-void Scene::_addPendingData(const InternalTexturePtr& /*texure*/)
+void Scene::_addPendingData(const InternalTexturePtr& texture)
 {
+  _pendingData.emplace_back("texture_" + std::to_string(texture->uniqueId()));
 }
 
 void Scene::_removePendingData(Mesh* /*mesh*/)
@@ -1931,10 +1953,16 @@ void Scene::_removePendingData(Mesh* /*mesh*/)
   }
 }
 
-void Scene::_removePendingData(const InternalTexturePtr& /*texture*/)
+void Scene::_removePendingData(const InternalTexturePtr& texture)
 {
   const auto wasLoading = isLoading();
 
+  const auto key = "texture_" + std::to_string(texture->uniqueId());
+  const auto it  = std::find(_pendingData.begin(), _pendingData.end(), key);
+  if (it != _pendingData.end()) {
+    _pendingData.erase(it);
+  }
+
   if (wasLoading && !isLoading()) {
     onDataLoadedObservable.notifyObservers(this);
   }
@@ -3638,9 +3666,7 @@ void Scene::_evaluateActiveMeshes()
     }
 
     if (!_activeParticleSystems.empty()) {
-      for (const auto& particleSystem : _activeParticleSystems) {
-        particleSystem->animate();
-      }
+      _animateParticleSystems();
     }
 
     return;
@@ -3666,99 +3692,285 @@ void Scene::_evaluateActiveMeshes()
   // Determine mesh candidates
   auto _meshes = getActiveMeshCandidates();
 
-  // Check each mesh
-  for (const auto& mesh : _meshes) {
-    mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = false;
-    if (mesh->isBlocked()) {
-      continue;
-    }
+  // The skeletons of the active meshes are prepared together once all the meshes are evaluated
+  _deferSkeletonsPreparation
+    = parallelSkeletonsEvaluation && _skeletonsEnabled && ThreadPool::Default().numWorkers() > 0;
 
-    _totalVertices.addCount(mesh->getTotalVertices(), false);
+  if ((parallelActiveMeshesEvaluation && ThreadPool::Default().numWorkers() > 0)
+      || batchedFrustumCulling) {
+    _evaluateActiveMeshesInBatches(_meshes);
+  }
+  else {
+    // Check each mesh
+    for (const auto& mesh : _meshes) {
+      if (!_isActiveMeshCandidateEligible(mesh)) {
+        continue;
+      }
 
-    if (!mesh->isReady() || !mesh->isEnabled() || mesh->scaling().lengthSquared() == 0.f) {
-      continue;
+      mesh->computeWorldMatrix();
+      _evaluateActiveMesh(mesh);
     }
+  }
 
-    mesh->computeWorldMatrix();
+  if (_deferSkeletonsPreparation) {
+    _prepareActiveSkeletons();
+    _deferSkeletonsPreparation = false;
+  }
+
+  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+
+  // Particle systems
+  if (particlesEnabled) {
+    onBeforeParticlesRenderingObservable.notifyObservers(this);
+    for (const auto& particleSystem : particleSystems) {
+      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
+        continue;
+      }
 
-    // Intersections
-    if (mesh->actionManager
-        && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
-                                                     ActionManager::OnIntersectionExitTrigger)) {
-      if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
-          == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh);
+      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
+          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
+        _activeParticleSystems.emplace_back(particleSystem.get());
       }
     }
+    _animateParticleSystems();
+    for (const auto& particleSystem : _activeParticleSystems) {
+      _renderingManager->dispatchParticles(particleSystem);
+    }
+    onAfterParticlesRenderingObservable.notifyObservers(this);
+  }
+}
 
-    // Switch to current LOD
-    auto meshToRender = customLODSelector ? customLODSelector(mesh, activeCamera().get()) :
-                                            mesh->getLOD(activeCamera);
-    mesh->_internalAbstractMeshDataInfo._currentLOD           = meshToRender;
-    mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = true;
-    if (!meshToRender) {
-      continue;
+void Scene::_prepareActiveSkeletons()
+{
+  static constexpr size_t GrainSize = 4;
+
+  std::vector<Skeleton*> skeletons;
+  skeletons.reserve(_activeSkeletons.size());
+  for (const auto& skeleton : _activeSkeletons) {
+    if (skeleton->_beginPrepare()) {
+      skeletons.emplace_back(skeleton.get());
+    }
+  }
+
+  ThreadPool::Default().parallelFor(skeletons.size(), GrainSize,
+                                    [&skeletons](size_t begin, size_t end) {
+                                      for (auto index = begin; index < end; ++index) {
+                                        skeletons[index]->_computePrepared();
+                                      }
+                                    });
+
+  for (const auto& skeleton : skeletons) {
+    skeleton->_endPrepare();
+  }
+}
+
+void Scene::_animateParticleSystems()
+{
+  if (parallelParticlesAnimation && ThreadPool::Default().numWorkers() > 0) {
+    if (!_particleSimulationScheduler) {
+      _particleSimulationScheduler
+        = std::make_unique<ParticleSimulationScheduler>(ThreadPool::Default());
     }
+    _particleSimulationScheduler->animate(_activeParticleSystems);
+    return;
+  }
+
+  for (const auto& particleSystem : _activeParticleSystems) {
+    particleSystem->animate();
+  }
+}
+
+bool Scene::_isActiveMeshCandidateEligible(AbstractMesh* mesh)
+{
+  mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = false;
+  if (mesh->isBlocked()) {
+    return false;
+  }
+
+  _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+  if (!mesh->isReady() || !mesh->isEnabled() || mesh->scaling().lengthSquared() == 0.f) {
+    return false;
+  }
+
+  return true;
+}
+
+bool Scene::_canEvaluateActiveMeshInBatch(AbstractMesh* mesh) const
+{
+  // Children depend on the world matrix of their parent and billboards on the active camera, they
+  // keep being evaluated in candidate order on the calling thread
+  if (mesh->parent() || mesh->billboardMode() != TransformNode::BILLBOARDMODE_NONE
+      || mesh->infiniteDistance() || mesh->_hasAfterWorldMatrixUpdateObservers()) {
+    return false;
+  }
+
+  // Delay loaded meshes can trigger a load while being tested against the frustum
+  if (auto _mesh = dynamic_cast<Mesh*>(mesh)) {
+    if (_mesh->delayLoadState != Constants::DELAYLOADSTATE_NONE
+        || (_mesh->geometry() && !_mesh->geometry()->isReady())) {
+      return false;
+    }
+  }
+
+  return true;
+}
 
-    // Compute world matrix if LOD is billboard
-    if (meshToRender != mesh
-        && meshToRender->billboardMode() != TransformNode::BILLBOARDMODE_NONE) {
-      meshToRender->computeWorldMatrix();
+void Scene::_evaluateActiveMesh(AbstractMesh* mesh,
+                                const std::optional<bool>& precomputedIsInFrustum)
+{
+  // Intersections
+  if (mesh->actionManager
+      && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
+                                                   ActionManager::OnIntersectionExitTrigger)) {
+    if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
+        == _meshesForIntersections.end()) {
+      _meshesForIntersections.emplace_back(mesh);
     }
+  }
 
-    mesh->_preActivate();
+  // Switch to current LOD
+  auto meshToRender = customLODSelector ? customLODSelector(mesh, activeCamera().get()) :
+                                          mesh->getLOD(activeCamera);
+  mesh->_internalAbstractMeshDataInfo._currentLOD           = meshToRender;
+  mesh->_internalAbstractMeshDataInfo._currentLODIsUpToDate = true;
+  if (!meshToRender) {
+    return;
+  }
 
-    if (mesh->isVisible && mesh->visibility() > 0.f
-        && (mesh->alwaysSelectAsActiveMesh
-            || ((mesh->layerMask & _activeCamera->layerMask) != 0
-                && (_skipFrustumClipping || mesh->alwaysSelectAsActiveMesh
-                    || mesh->isInFrustum(_frustumPlanes))))) {
-      _activeMeshes.emplace_back(mesh);
-      _activeCamera->_activeMeshes.emplace_back(mesh);
+  // Compute world matrix if LOD is billboard
+  if (meshToRender != mesh && meshToRender->billboardMode() != TransformNode::BILLBOARDMODE_NONE) {
+    meshToRender->computeWorldMatrix();
+  }
 
-      if (meshToRender != mesh) {
-        mesh->_activate(_renderId, false);
-      }
+  mesh->_preActivate();
 
-      for (const auto& step : _preActiveMeshStage) {
-        step.action(mesh);
-      }
+  if (mesh->isVisible && mesh->visibility() > 0.f
+      && (mesh->alwaysSelectAsActiveMesh
+          || ((mesh->layerMask & _activeCamera->layerMask) != 0
+              && (_skipFrustumClipping || mesh->alwaysSelectAsActiveMesh
+                  || (precomputedIsInFrustum.has_value() ? *precomputedIsInFrustum :
+                                                           mesh->isInFrustum(_frustumPlanes)))))) {
+    _activeMeshes.emplace_back(mesh);
+    _activeCamera->_activeMeshes.emplace_back(mesh);
 
-      if (mesh->_activate(_renderId, false)) {
-        if (!mesh->isAnInstance()) {
-          meshToRender->_internalAbstractMeshDataInfo._onlyForInstances = false;
-        }
-        else {
-          if (mesh->_internalAbstractMeshDataInfo._actAsRegularMesh) {
-            meshToRender = mesh;
-          }
+    if (meshToRender != mesh) {
+      mesh->_activate(_renderId, false);
+    }
+
+    for (const auto& step : _preActiveMeshStage) {
+      step.action(mesh);
+    }
+
+    if (mesh->_activate(_renderId, false)) {
+      if (!mesh->isAnInstance()) {
+        meshToRender->_internalAbstractMeshDataInfo._onlyForInstances = false;
+      }
+      else {
+        if (mesh->_internalAbstractMeshDataInfo._actAsRegularMesh) {
+          meshToRender = mesh;
         }
-        meshToRender->_internalAbstractMeshDataInfo._isActive = true;
-        _activeMesh(mesh, meshToRender);
       }
+      meshToRender->_internalAbstractMeshDataInfo._isActive = true;
+      _activeMesh(mesh, meshToRender);
+    }
 
-      mesh->_postActivate();
+    mesh->_postActivate();
+  }
+}
+
+void Scene::_evaluateActiveMeshesInBatches(const std::vector<AbstractMesh*>& meshes)
+{
+  // Readiness checks can compile effects or trigger loads, they are done on the calling thread
+  std::vector<AbstractMesh*> eligibleMeshes;
+  std::vector<size_t> batchIndices;
+  eligibleMeshes.reserve(meshes.size());
+  batchIndices.reserve(meshes.size());
+  for (const auto& mesh : meshes) {
+    if (!_isActiveMeshCandidateEligible(mesh)) {
+      continue;
     }
+    if (_canEvaluateActiveMeshInBatch(mesh)) {
+      batchIndices.emplace_back(eligibleMeshes.size());
+    }
+    eligibleMeshes.emplace_back(mesh);
   }
 
-  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+  static constexpr uint8_t Evaluated      = 1;
+  static constexpr uint8_t InFrustum      = 2;
+  static constexpr uint8_t HasBoundingBox = 4;
+  static constexpr size_t GrainSize       = 256;
 
-  // Particle systems
-  if (particlesEnabled) {
-    onBeforeParticlesRenderingObservable.notifyObservers(this);
-    for (const auto& particleSystem : particleSystems) {
-      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
-        continue;
+  auto& threadPool        = ThreadPool::Default();
+  const auto useThreads   = parallelActiveMeshesEvaluation && threadPool.numWorkers() > 0;
+  const auto forEachRange = [&](size_t count, const std::function<void(size_t, size_t)>& func) {
+    if (useThreads) {
+      threadPool.parallelFor(count, GrainSize, func);
+    }
+    else if (count > 0) {
+      func(0, count);
+    }
+  };
+  const auto skipFrustum  = _skipFrustumClipping;
+  const auto batchCulling = batchedFrustumCulling && !skipFrustum;
+  const auto& planes      = _frustumPlanes;
+  if (batchCulling) {
+    if (!_cullingStore) {
+      _cullingStore = std::make_unique<CullingStore>();
+    }
+    _cullingStore->resize(batchIndices.size());
+  }
+
+  // World matrices and frustum tests (or packing of the bounding volumes) of the independent
+  // meshes. The LOD selection calls the user callbacks and prepares the LOD meshes, which can be
+  // shared between meshes, so it is done on the calling thread during the merge
+  std::vector<uint8_t> states(eligibleMeshes.size(), 0);
+  forEachRange(batchIndices.size(), [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      const auto index = batchIndices[i];
+      auto mesh        = eligibleMeshes[index];
+      uint8_t state    = Evaluated;
+      mesh->computeWorldMatrix();
+      if (batchCulling) {
+        if (mesh->_boundingInfo) {
+          _cullingStore->set(i, *mesh->_boundingInfo, mesh->cullingStrategy);
+          state |= HasBoundingBox;
+        }
+        else {
+          _cullingStore->setBox(i, Vector3::Zero(), Vector3::Zero());
+        }
       }
+      else if (!skipFrustum && mesh->isInFrustum(planes)) {
+        state |= InFrustum;
+      }
+      states[index] = state;
+    }
+  });
 
-      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
-          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
-        _activeParticleSystems.emplace_back(particleSystem.get());
-        particleSystem->animate();
-        _renderingManager->dispatchParticles(particleSystem.get());
+  // Batched frustum tests
+  if (batchCulling) {
+    std::vector<uint8_t> visibilities(batchIndices.size(), 0);
+    forEachRange(batchIndices.size(), [&](size_t begin, size_t end) {
+      _cullingStore->isInFrustum(planes, visibilities.data() + begin, begin, end);
+    });
+    for (size_t i = 0; i < batchIndices.size(); ++i) {
+      auto& state = states[batchIndices[i]];
+      if (visibilities[i] && (state & HasBoundingBox)) {
+        state |= InFrustum;
       }
     }
-    onAfterParticlesRenderingObservable.notifyObservers(this);
+  }
+
+  // Deterministic merge in candidate order
+  for (size_t index = 0; index < eligibleMeshes.size(); ++index) {
+    auto mesh        = eligibleMeshes[index];
+    const auto state = states[index];
+    if (!(state & Evaluated)) {
+      mesh->computeWorldMatrix();
+      _evaluateActiveMesh(mesh);
+      continue;
+    }
+    _evaluateActiveMesh(mesh, (state & InFrustum) != 0);
   }
 }
 
@@ -3768,7 +3980,9 @@ void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
     if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(), mesh->skeleton())
         == _activeSkeletons.end()) {
       _activeSkeletons.emplace_back(mesh->skeleton());
-      mesh->skeleton()->prepare();
+      if (!_deferSkeletonsPreparation) {
+        mesh->skeleton()->prepare();
+      }
     }
 
     if (!mesh->computeBonesUsingShaders()) {
@@ -4636,6 +4850,7 @@ void Scene::clearCachedVertexData()
 
       if (geometry) {
         geometry->_indices.clear();
+        geometry->_resetTriangleBVHs();
 
         for (const auto& vb : geometry->_vertexBuffers) {
           if (!stl_util::contains(geometry->_vertexBuffers, vb.first)) {
@@ -4682,7 +4897,7 @@ Scene::getWorldExtends(const std::function<bool(const AbstractMeshPtr& mesh)>& f
     }
   }
 
-  for (const auto& mesh : filteredMeshes) {
+  for (const auto& mesh : filterPredicate ? filteredMeshes : meshes) {
     mesh->computeWorldMatrix(true);
 
     if (mesh->subMeshes.empty() || mesh->infiniteDistance()) {
@@ -4726,6 +4941,30 @@ Octree<AbstractMesh*>* Scene::createOrUpdateSelectionOctree(size_t maxCapacity,
   return _selectionOctree;
 }
 
+LooseOctree<AbstractMesh*>* Scene::createOrUpdateDynamicSelectionOctree(size_t maxCapacity,
+                                                                        size_t maxDepth)
+{
+  auto component = _getComponent(SceneComponentConstants::NAME_OCTREE);
+  if (!component) {
+    component = OctreeSceneComponent::New(this);
+    _addComponent(component);
+  }
+
+  if (!_dynamicSelectionOctree) {
+    _dynamicSelectionOctree = std::make_unique<LooseOctree<AbstractMesh*>>(
+      LooseOctree<AbstractMesh*>::BoundsFuncForMeshes, maxCapacity, maxDepth);
+  }
+
+  auto worldExtends = getWorldExtends();
+
+  // Update octree
+  _dynamicSelectionOctree->maxDepth = maxDepth;
+  _dynamicSelectionOctree->update(worldExtends.min, worldExtends.max,
+                                  stl_util::to_raw_ptr_vector(meshes));
+
+  return _dynamicSelectionOctree.get();
+}
+
 /** Picking **/
 Ray Scene::createPickingRay(int x, int y, Matrix& world, const CameraPtr& camera,
                             bool cameraViewSpace)
@@ -4820,7 +5059,7 @@ std::optional<PickingInfo> Scene::_internalPickForMesh(
     return std::nullopt;
   }
 
-  if (!fastCheck && /*pickingInfo != null && */ result.distance >= pickingInfo->distance) {
+  if (!fastCheck.value_or(false) && pickingInfo && result.distance >= pickingInfo->distance) {
     return std::nullopt;
   }
 
@@ -4833,10 +5072,42 @@ Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
                      const std::optional<bool>& iFastCheck,
                      const std::optional<bool>& onlyBoundingInfo,
                      const TrianglePickingPredicate& trianglePredicate)
+{
+  return _internalPick(rayFunction, predicate, iFastCheck, onlyBoundingInfo, trianglePredicate,
+                       _getPickingCandidates(rayFunction));
+}
+
+const std::vector<size_t>*
+Scene::_getPickingCandidates(const std::function<Ray(Matrix& world)>& rayFunction)
+{
+  if (!bvhAcceleratedPicking) {
+    return nullptr;
+  }
+
+  if (!_pickingBVH) {
+    _pickingBVH = std::make_unique<PickingBVH>();
+  }
+  _pickingBVH->update(meshes);
+
+  auto identity = Matrix::Identity();
+  _pickingBVH->collectCandidates(rayFunction(identity), _pickingCandidates);
+  return &_pickingCandidates;
+}
+
+std::optional<PickingInfo>
+Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
+                     const std::function<bool(const AbstractMeshPtr& mesh)>& predicate,
+                     const std::optional<bool>& iFastCheck,
+                     const std::optional<bool>& onlyBoundingInfo,
+                     const TrianglePickingPredicate& trianglePredicate,
+                     const std::vector<size_t>* candidates)
 {
   std::optional<PickingInfo> pickingInfo = std::nullopt;
 
-  for (const auto& mesh : meshes) {
+  // Without candidates, all the meshes are tested
+  const auto count = candidates ? candidates->size() : meshes.size();
+  for (size_t i = 0; i < count; ++i) {
+    const auto& mesh = meshes[candidates ? (*candidates)[i] : i];
     if (predicate) {
       if (!predicate(mesh)) {
         continue;
@@ -4904,7 +5175,10 @@ Scene::_internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
 {
   std::vector<std::optional<PickingInfo>> pickingInfos;
 
-  for (const auto& mesh : meshes) {
+  const auto candidates = _getPickingCandidates(rayFunction);
+  const auto count      = candidates ? candidates->size() : meshes.size();
+  for (size_t i = 0; i < count; ++i) {
+    const auto& mesh = meshes[candidates ? (*candidates)[i] : i];
     if (predicate) {
       if (!predicate(mesh.get())) {
         continue;
@@ -5154,6 +5428,58 @@ Scene::pickWithRay(const Ray& ray,
   return result;
 }
 
+std::vector<PickingInfo>
+Scene::pickWithRays(const std::vector<Ray>& rays,
+                    const std::function<bool(const AbstractMeshPtr& mesh)>& predicate,
+                    bool fastCheck, const TrianglePickingPredicate& trianglePredicate)
+{
+  std::vector<PickingInfo> pickingInfos(rays.size());
+
+  // What the meshes compute lazily when they are picked is computed first, the rays are then traced
+  // without modifying the scene
+  for (const auto& mesh : meshes) {
+    if (mesh->skeleton() && mesh->skeleton()->overrideMesh) {
+      mesh->skeleton()->overrideMesh->getWorldMatrix();
+    }
+    mesh->getWorldMatrix();
+    mesh->_generatePointsArray();
+    if (mesh->hasThinInstances()) {
+      std::static_pointer_cast<Mesh>(mesh)->thinInstanceGetWorldMatrices();
+    }
+  }
+
+  if (bvhAcceleratedPicking) {
+    if (!_pickingBVH) {
+      _pickingBVH = std::make_unique<PickingBVH>();
+    }
+    _pickingBVH->update(meshes);
+  }
+
+  ThreadPool::Default().parallelFor(rays.size(), 4, [&](size_t begin, size_t end) {
+    std::vector<size_t> candidates;
+    for (auto i = begin; i < end; ++i) {
+      const auto& ray = rays[i];
+      if (bvhAcceleratedPicking) {
+        _pickingBVH->collectCandidates(ray, candidates);
+      }
+
+      const auto result = _internalPick(
+        [&ray](Matrix& world) -> Ray {
+          Matrix inverseWorld;
+          world.invertToRef(inverseWorld);
+          return Ray::Transform(ray, inverseWorld);
+        },
+        predicate, fastCheck, false, trianglePredicate,
+        bvhAcceleratedPicking ? &candidates : nullptr);
+
+      pickingInfos[i]     = result.value_or(PickingInfo());
+      pickingInfos[i].ray = ray;
+    }
+  });
+
+  return pickingInfos;
+}
+
 std::vector<std::optional<PickingInfo>>
 Scene::multiPick(int x, int y, const std::function<bool(AbstractMesh* mesh)>& predicate,
                  const CameraPtr& camera)
@@ -0,0 +1,313 @@
+#include <babylon/engines/texture_cache.h>
+
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/thin_engine.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/misc/string_tools.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * 64-bit FNV-1a variant consuming 8 bytes per step, content hashing has to be fast as it runs on
+ * images of several megabytes.
+ */
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+{
+  constexpr uint64_t prime = 0x100000001b3ull;
+
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(uint64_t));
+    hash = (hash ^ word) * prime;
+  }
+  for (; i < size; ++i) {
+    hash = (hash ^ data[i]) * prime;
+  }
+
+  // Final avalanche so that the low bits depend on all the words
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+std::string ContentKey(const uint8_t* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull)
+{
+  return StringTools::printf("content:%016llx:%zu",
+                             static_cast<unsigned long long>(HashBytes(data, size, seed)), size);
+}
+
+} // end of anonymous namespace
+
+TextureCache::TextureCache(ThinEngine* engine) : _engine{engine}, _releasedTexturesMemory{0}
+{
+}
+
+TextureCache::~TextureCache() = default;
+
+std::string TextureCache::NormalizeUrl(const std::string& url)
+{
+  auto path = url;
+  std::replace(path.begin(), path.end(), '\\', '/');
+
+  // Keep the query string untouched
+  std::string query;
+  const auto queryIndex = path.find('?');
+  if (queryIndex != std::string::npos) {
+    query = path.substr(queryIndex);
+    path  = path.substr(0, queryIndex);
+  }
+
+  const auto isAbsolute = StringTools::startsWith(path, "/");
+  std::vector<std::string> segments;
+  for (const auto& segment : StringTools::split(path, '/')) {
+    if (segment.empty() || segment == ".") {
+      continue;
+    }
+    if (segment == ".." && !segments.empty() && segments.back() != "..") {
+      segments.pop_back();
+      continue;
+    }
+    segments.emplace_back(segment);
+  }
+
+  std::string normalized = isAbsolute ? "/" : "";
+  for (size_t i = 0; i < segments.size(); ++i) {
+    if (i > 0) {
+      normalized += "/";
+    }
+    normalized += segments[i];
+  }
+
+  return normalized + query;
+}
+
+std::string TextureCache::ComputeKey(const std::string& url,
+                                     const std::optional<TextureBuffer>& buffer, bool hashContent)
+{
+  if (buffer.has_value() && hashContent) {
+    if (std::holds_alternative<std::string>(*buffer)) {
+      const auto& data = std::get<std::string>(*buffer);
+      if (!data.empty()) {
+        return ContentKey(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+      }
+    }
+    else if (std::holds_alternative<ArrayBuffer>(*buffer)) {
+      const auto& data = std::get<ArrayBuffer>(*buffer);
+      if (!data.empty()) {
+        return ContentKey(data.data(), data.size());
+      }
+    }
+    else if (std::holds_alternative<ArrayBufferView>(*buffer)) {
+      const auto& data = std::get<ArrayBufferView>(*buffer).uint8Array();
+      if (!data.empty()) {
+        return ContentKey(data.data(), data.size());
+      }
+    }
+    else if (std::holds_alternative<Image>(*buffer)) {
+      // Decoded pixels, the dimensions are part of the key as well
+      const auto& image = std::get<Image>(*buffer);
+      if (image.valid()) {
+        const int dimensions[] = {image.width, image.height, image.depth};
+        const auto seed        = HashBytes(reinterpret_cast<const uint8_t*>(dimensions),
+                                           sizeof(dimensions));
+        return ContentKey(image.data.data(), image.data.size(), seed);
+      }
+    }
+  }
+
+  if (url.empty()) {
+    return "";
+  }
+
+  // The content of data urls is part of the url
+  if (StringTools::startsWith(url, "data:")) {
+    return ContentKey(reinterpret_cast<const uint8_t*>(url.data()), url.size());
+  }
+
+  return "url:" + NormalizeUrl(url);
+}
+
+size_t TextureCache::EstimateMemory(const InternalTexture& texture)
+{
+  size_t bytesPerPixel = 4;
+  if (texture.type == Constants::TEXTURETYPE_FLOAT) {
+    bytesPerPixel = 16;
+  }
+  else if (texture.type == Constants::TEXTURETYPE_HALF_FLOAT) {
+    bytesPerPixel = 8;
+  }
+
+  auto size = static_cast<size_t>(std::max(texture.width, 0))
+              * static_cast<size_t>(std::max(texture.height, 0)) * bytesPerPixel;
+  if (texture.isCube) {
+    size *= 6;
+  }
+  else if (texture.is3D) {
+    size *= static_cast<size_t>(std::max(texture.depth, 1));
+  }
+
+  // A full mip chain adds a third of the base level
+  return texture.generateMipMaps ? size + size / 3 : size;
+}
+
+InternalTexturePtr TextureCache::find(const std::string& key, bool noMipmap,
+                                      unsigned int samplingMode,
+                                      const std::optional<bool>& invertY,
+                                      const std::optional<unsigned int>& format)
+{
+  const auto it = key.empty() ? _entries.end() : _entries.find(key);
+  if (it != _entries.end()) {
+    for (const auto& entry : it->second) {
+      const auto& texture = entry.texture;
+      if ((!invertY.has_value() || *invertY == texture->invertY)
+          && texture->generateMipMaps != noMipmap
+          && (!samplingMode || samplingMode == texture->samplingMode)
+          && (!format.has_value() || !entry.format.has_value() || *format == *entry.format)) {
+        // Bring the texture back from the released list
+        const auto released = _released.find(texture.get());
+        if (released != _released.end()) {
+          _releasedTexturesMemory -= EstimateMemory(*texture);
+          _releasedTextures.erase(released->second);
+          _released.erase(released);
+          ++_statistics.revivals;
+        }
+
+        ++_statistics.hits;
+        texture->incrementReferences();
+        return texture;
+      }
+    }
+  }
+
+  ++_statistics.misses;
+  return nullptr;
+}
+
+void TextureCache::add(const std::string& key, const InternalTexturePtr& texture,
+                       const std::optional<unsigned int>& format)
+{
+  if (key.empty() || !texture) {
+    return;
+  }
+
+  remove(texture.get());
+
+  _entries[key].emplace_back(Entry{texture, format});
+  _keys[texture.get()] = key;
+}
+
+void TextureCache::remove(const InternalTexture* texture)
+{
+  const auto released = _released.find(texture);
+  if (released != _released.end()) {
+    _releasedTexturesMemory -= EstimateMemory(**released->second);
+    _releasedTextures.erase(released->second);
+    _released.erase(released);
+  }
+
+  const auto key = _keys.find(texture);
+  if (key == _keys.end()) {
+    return;
+  }
+
+  auto it = _entries.find(key->second);
+  if (it != _entries.end()) {
+    auto& entries = it->second;
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [texture](const Entry& entry) {
+                                   return entry.texture.get() == texture;
+                                 }),
+                  entries.end());
+    if (entries.empty()) {
+      _entries.erase(it);
+    }
+  }
+
+  _keys.erase(key);
+}
+
+void TextureCache::replace(const InternalTexture* texture, const InternalTexturePtr& target)
+{
+  const auto key = _keys.find(texture);
+  if (key == _keys.end() || !target) {
+    return;
+  }
+
+  std::optional<unsigned int> format = std::nullopt;
+  for (const auto& entry : _entries[key->second]) {
+    if (entry.texture.get() == texture) {
+      format = entry.format;
+    }
+  }
+
+  const auto keyValue = key->second;
+  remove(texture);
+  add(keyValue, target, format);
+}
+
+bool TextureCache::_onTextureReleased(const InternalTexturePtr& texture)
+{
+  if (!texture || releasedTexturesMemoryBudget == 0 || !texture->isReady
+      || !texture->_hardwareTexture || _keys.find(texture.get()) == _keys.end()
+      || _released.find(texture.get()) != _released.end()) {
+    return false;
+  }
+
+  const auto memory = EstimateMemory(*texture);
+  if (memory > releasedTexturesMemoryBudget) {
+    return false;
+  }
+
+  _released[texture.get()] = _releasedTextures.insert(_releasedTextures.end(), texture);
+  _releasedTexturesMemory += memory;
+
+  _evict(releasedTexturesMemoryBudget);
+
+  return true;
+}
+
+void TextureCache::clearReleasedTextures()
+{
+  _evict(0);
+}
+
+size_t TextureCache::releasedTexturesMemory() const
+{
+  return _releasedTexturesMemory;
+}
+
+const TextureCacheStatistics& TextureCache::statistics() const
+{
+  return _statistics;
+}
+
+void TextureCache::resetStatistics()
+{
+  _statistics = {};
+}
+
+void TextureCache::_evict(size_t budget)
+{
+  while (!_releasedTextures.empty() && (budget == 0 || _releasedTexturesMemory > budget)) {
+    auto texture = _releasedTextures.front();
+    _releasedTextures.pop_front();
+    _released.erase(texture.get());
+    _releasedTexturesMemory -= EstimateMemory(*texture);
+    ++_statistics.evictions;
+
+    // Same as InternalTexture::dispose
+    _engine->_releaseTexture(texture);
+    texture->_hardwareTexture = nullptr;
+  }
+}
+
+} // end of namespace BABYLON
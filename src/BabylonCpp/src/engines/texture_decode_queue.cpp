@@ -0,0 +1,198 @@
+#include <babylon/engines/texture_decode_queue.h>
+
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/core/time.h>
+#include <babylon/misc/file_tools.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace BABYLON {
+
+namespace {
+
+std::function<void()> MakeErrorCompletion(const TextureDecodeQueue::OnErrorFunction& onError,
+                                          const std::string& message, const std::string& exception)
+{
+  return [onError, message, exception]() {
+    if (onError) {
+      onError(message, exception);
+    }
+  };
+}
+
+} // end of anonymous namespace
+
+/**
+ * State shared with the jobs running on the thread pool. It is reference counted so that the queue
+ * can be destroyed while jobs are still running, their results are then simply dropped.
+ */
+struct TextureDecodeQueue::State {
+  std::mutex mutex;
+  std::condition_variable condition;
+  // Callbacks of the completed jobs, waiting to be invoked on the render thread
+  std::deque<std::function<void()>> completedJobs;
+  // Number of jobs running on the thread pool or waiting in completedJobs
+  size_t pendingJobs = 0;
+};
+
+TextureDecodeQueue::TextureDecodeQueue(ThreadPool& threadPool, size_t maxPendingJobs)
+    : _threadPool{threadPool}
+    , _maxPendingJobs{std::max(maxPendingJobs, size_t(1))}
+    , _state{std::make_shared<State>()}
+{
+}
+
+TextureDecodeQueue::~TextureDecodeQueue() = default;
+
+void TextureDecodeQueue::loadImage(const std::string& url, bool flipVertically,
+                                   const OnImageLoadedFunction& onLoad,
+                                   const OnErrorFunction& onError)
+{
+  _submit([url, flipVertically, onLoad, onError]() -> std::function<void()> {
+    std::function<void()> completion = nullptr;
+    try {
+      FileTools::LoadImageFromUrl(
+        url,
+        [&completion, onLoad](const Image& img) {
+          completion = [onLoad, img]() {
+            if (onLoad) {
+              onLoad(img);
+            }
+          };
+        },
+        [&completion, onError](const std::string& message, const std::string& exception) {
+          completion = MakeErrorCompletion(onError, message, exception);
+        },
+        flipVertically);
+    }
+    catch (const std::exception& e) {
+      completion = MakeErrorCompletion(onError, "Unable to load image " + url, e.what());
+    }
+    return completion;
+  });
+}
+
+void TextureDecodeQueue::loadFile(const std::string& url, const OnFileLoadedFunction& onLoad,
+                                  const OnErrorFunction& onError)
+{
+  _submit([url, onLoad, onError]() -> std::function<void()> {
+    std::function<void()> completion = nullptr;
+    try {
+      FileTools::LoadFile(
+        url,
+        [&completion, onLoad](const std::variant<std::string, ArrayBufferView>& data,
+                              const std::string& /*responseURL*/) {
+          auto buffer = std::holds_alternative<ArrayBufferView>(data) ?
+                          std::get<ArrayBufferView>(data).uint8Array() :
+                          ArrayBuffer{};
+          completion = [onLoad, buffer{std::move(buffer)}]() {
+            if (onLoad) {
+              onLoad(buffer);
+            }
+          };
+        },
+        nullptr, true,
+        [&completion, onError](const std::string& message, const std::string& exception) {
+          completion = MakeErrorCompletion(onError, message, exception);
+        });
+    }
+    catch (const std::exception& e) {
+      completion = MakeErrorCompletion(onError, "Unable to load file " + url, e.what());
+    }
+    return completion;
+  });
+}
+
+size_t TextureDecodeQueue::processUploads(float timeBudgetInMs)
+{
+  const auto start = Time::highresTimepointNow();
+  size_t processed = 0;
+
+  for (;;) {
+    std::function<void()> completion = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(_state->mutex);
+      if (_state->completedJobs.empty()) {
+        break;
+      }
+      completion = std::move(_state->completedJobs.front());
+      _state->completedJobs.pop_front();
+      --_state->pendingJobs;
+    }
+
+    // Free the slot before running the callback so that the next file is decoded while uploading
+    _dispatch();
+
+    if (completion) {
+      completion();
+    }
+    ++processed;
+
+    if (timeBudgetInMs > 0.f && Time::fpTimeSince<float, std::milli>(start) >= timeBudgetInMs) {
+      break;
+    }
+  }
+
+  return processed;
+}
+
+void TextureDecodeQueue::flush()
+{
+  while (pendingCount() > 0) {
+    {
+      std::unique_lock<std::mutex> lock(_state->mutex);
+      _state->condition.wait(lock, [this]() { return !_state->completedJobs.empty(); });
+    }
+    processUploads(0.f);
+  }
+}
+
+size_t TextureDecodeQueue::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  return _state->pendingJobs + _waitingJobs.size();
+}
+
+size_t TextureDecodeQueue::inFlightCount() const
+{
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  return _state->pendingJobs;
+}
+
+void TextureDecodeQueue::_submit(Job&& job)
+{
+  _waitingJobs.emplace_back(std::move(job));
+  _dispatch();
+}
+
+void TextureDecodeQueue::_dispatch()
+{
+  while (!_waitingJobs.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(_state->mutex);
+      if (_state->pendingJobs >= _maxPendingJobs) {
+        return;
+      }
+      ++_state->pendingJobs;
+    }
+
+    auto job = std::move(_waitingJobs.front());
+    _waitingJobs.pop_front();
+
+    // Without worker, the job runs inline and its completion is still deferred to processUploads
+    _threadPool.enqueue([state = _state, job = std::move(job)]() {
+      auto completion = job();
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->completedJobs.emplace_back(std::move(completion));
+      }
+      state->condition.notify_all();
+    });
+  }
+}
+
+} // end of namespace BABYLON
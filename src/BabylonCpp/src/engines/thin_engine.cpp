@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/babylon_version.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/engines/extensions/alpha_extension.h>
 #include <babylon/engines/extensions/cube_texture_extension.h>
@@ -15,7 +16,10 @@
 #include <babylon/engines/extensions/render_target_extension.h>
 #include <babylon/engines/extensions/uniform_buffer_extension.h>
 #include <babylon/engines/instancing_attribute_info.h>
+#include <babylon/engines/program_binary_cache.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/texture_cache.h>
+#include <babylon/engines/texture_decode_queue.h>
 #include <babylon/engines/webgl/webgl2_shader_processor.h>
 #include <babylon/engines/webgl/webgl_hardware_texture.h>
 #include <babylon/engines/webgl/webgl_pipeline_context.h>
@@ -34,6 +38,7 @@
 #include <babylon/materials/textures/loaders/tga_texture_loader.h>
 #include <babylon/materials/textures/render_target_texture.h>
 #include <babylon/materials/uniform_buffer.h>
+#include <babylon/maths/matrix.h>
 #include <babylon/maths/scalar.h>
 #include <babylon/maths/viewport.h>
 #include <babylon/meshes/vertex_buffer.h>
@@ -128,7 +133,12 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
     , _renderTargetExtension{std::make_unique<RenderTargetExtension>(this)}
     , _renderTargetCubeExtension{std::make_unique<RenderTargetCubeExtension>(this)}
     , _uniformBufferExtension{std::make_unique<UniformBufferExtension>(this)}
+    , _textureCache{std::make_unique<TextureCache>(this)}
 {
+  if (options.asyncTextureDecoding) {
+    _textureDecodeQueue = std::make_unique<TextureDecodeQueue>(ThreadPool::Default());
+  }
+
   if (!canvas) {
     return;
   }
@@ -178,6 +188,13 @@ ThinEngine::ThinEngine(ICanvas* canvas, const EngineOptions& options)
     _shaderProcessor = std::make_shared<WebGLShaderProcessor>();
   }
 
+  // Program binaries
+  if (!options.programBinaryCacheDirectory.empty()
+      && _gl->getParameteri(GL::NUM_PROGRAM_BINARY_FORMATS) > 0) {
+    _programBinaryCache = std::make_unique<ProgramBinaryCache>(
+      options.programBinaryCacheDirectory, _glVendor + " | " + _glRenderer + " | " + _glVersion);
+  }
+
   // Detect if we are running on a faulty buggy OS.
   _badOS = false;
 
@@ -655,6 +672,16 @@ std::vector<InternalTexturePtr>& ThinEngine::getLoadedTexturesCache()
   return _internalTexturesCache;
 }
 
+TextureCache& ThinEngine::getTextureCache()
+{
+  return *_textureCache;
+}
+
+ProgramBinaryCache* ThinEngine::getProgramBinaryCache()
+{
+  return _programBinaryCache.get();
+}
+
 EngineCapabilities& ThinEngine::getCaps()
 {
   return _caps;
@@ -819,6 +846,10 @@ void ThinEngine::setViewport(const Viewport& viewport, const std::optional<int>&
 
 void ThinEngine::beginFrame()
 {
+  // Upload the textures decoded in the background since the previous frame
+  if (_textureDecodeQueue) {
+    _textureDecodeQueue->processUploads(textureUploadTimeBudget);
+  }
 }
 
 void ThinEngine::endFrame()
@@ -829,6 +860,13 @@ void ThinEngine::endFrame()
   }
 }
 
+void ThinEngine::flushTextureDecodeQueue()
+{
+  if (_textureDecodeQueue) {
+    _textureDecodeQueue->flush();
+  }
+}
+
 void ThinEngine::resize()
 {
   const auto width  = _renderingCanvas ? _renderingCanvas->clientWidth : 0;
@@ -1056,6 +1094,7 @@ WebGLDataBufferPtr ThinEngine::_createVertexBuffer(const Float32Array& data, uns
   _resetVertexBufferBinding();
 
   dataBuffer->references = 1;
+  dataBuffer->capacity   = data.size() * sizeof(float);
   return dataBuffer;
 }
 
@@ -1218,7 +1257,8 @@ void ThinEngine::_bindIndexBufferWithCache(const WebGLDataBufferPtr& indexBuffer
 }
 
 void ThinEngine::_bindVertexBuffersAttributes(
-  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect)
+  const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers, const EffectPtr& effect,
+  const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers)
 {
   auto attributes = effect->getAttributesNames();
 
@@ -1235,11 +1275,15 @@ void ThinEngine::_bindVertexBuffersAttributes(
     if (order >= 0) {
       _order = static_cast<unsigned int>(order);
 
-      if (!stl_util::contains(vertexBuffers, attributes[index])) {
-        continue;
+      auto it = overrideVertexBuffers.find(attributes[index]);
+      if (it == overrideVertexBuffers.end() || !it->second) {
+        it = vertexBuffers.find(attributes[index]);
+        if (it == vertexBuffers.end()) {
+          continue;
+        }
       }
 
-      const auto& vertexBuffer = vertexBuffers.at(attributes[index]);
+      const auto& vertexBuffer = it->second;
       if (!vertexBuffer) {
         continue;
       }
@@ -1271,7 +1315,7 @@ void ThinEngine::_bindVertexBuffersAttributes(
 WebGLVertexArrayObjectPtr ThinEngine::recordVertexArrayObject(
   const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
   const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect,
-  const std::unordered_map<std::string, VertexBufferPtr>& /*overrideVertexBuffers*/)
+  const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers)
 {
   auto vao = _gl->createVertexArray();
 
@@ -1280,7 +1324,7 @@ WebGLVertexArrayObjectPtr ThinEngine::recordVertexArrayObject(
   _gl->bindVertexArray(vao.get());
 
   _mustWipeVertexAttributes = true;
-  _bindVertexBuffersAttributes(vertexBuffers, effect);
+  _bindVertexBuffersAttributes(vertexBuffers, effect, overrideVertexBuffers);
 
   bindIndexBuffer(indexBuffer);
 
@@ -1362,13 +1406,15 @@ void ThinEngine::_unbindVertexArrayObject()
 void ThinEngine::bindBuffers(
   const std::unordered_map<std::string, VertexBufferPtr>& vertexBuffers,
   const WebGLDataBufferPtr& indexBuffer, const EffectPtr& effect,
-  const std::unordered_map<std::string, VertexBufferPtr>& /*overrideVertexBuffers*/)
+  const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers)
 {
-  if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect) {
+  // The override buffers are not part of the cache key, the attributes are always bound with them
+  if (_cachedVertexBuffersMap != vertexBuffers || _cachedEffectForVertexBuffers != effect
+      || !overrideVertexBuffers.empty()) {
     _cachedVertexBuffersMap       = vertexBuffers;
-    _cachedEffectForVertexBuffers = effect;
+    _cachedEffectForVertexBuffers = overrideVertexBuffers.empty() ? effect : nullptr;
 
-    _bindVertexBuffersAttributes(vertexBuffers, effect);
+    _bindVertexBuffersAttributes(vertexBuffers, effect, overrideVertexBuffers);
   }
 
   _bindIndexBufferWithCache(indexBuffer);
@@ -1713,11 +1759,17 @@ ThinEngine::createRawShaderProgram(const IPipelineContextPtr& pipelineContext,
 {
   context = context ? context : _gl;
 
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+  if (auto program = _loadProgramBinary(webGLPipelineContext, vertexCode, fragmentCode, context,
+                                        transformFeedbackVaryings)) {
+    return program;
+  }
+
   auto vertexShader   = _compileRawShader(vertexCode, "vertex");
   auto fragmentShader = _compileRawShader(fragmentCode, "fragment");
 
-  return _createShaderProgram(std::static_pointer_cast<WebGLPipelineContext>(pipelineContext),
-                              vertexShader, fragmentShader, context, transformFeedbackVaryings);
+  return _createShaderProgram(webGLPipelineContext, vertexShader, fragmentShader, context,
+                              transformFeedbackVaryings);
 }
 
 WebGLProgramPtr
@@ -1734,11 +1786,61 @@ ThinEngine::createShaderProgram(const IPipelineContextPtr& pipelineContext,
 #else
   auto shaderVersion = (_webGLVersion > 1.f) ? "#version 330\n#define WEBGL2 \n" : "";
 #endif
-  auto vertexShader   = _compileShader(vertexCode, "vertex", defines, shaderVersion);
-  auto fragmentShader = _compileShader(fragmentCode, "fragment", defines, shaderVersion);
+  const auto vertexSource   = ThinEngine::_ConcatenateShader(vertexCode, defines, shaderVersion);
+  const auto fragmentSource = ThinEngine::_ConcatenateShader(fragmentCode, defines, shaderVersion);
+
+  auto webGLPipelineContext = std::static_pointer_cast<WebGLPipelineContext>(pipelineContext);
+  if (auto program = _loadProgramBinary(webGLPipelineContext, vertexSource, fragmentSource, context,
+                                        transformFeedbackVaryings)) {
+    return program;
+  }
+
+  auto vertexShader   = _compileRawShader(vertexSource, "vertex");
+  auto fragmentShader = _compileRawShader(fragmentSource, "fragment");
 
-  return _createShaderProgram(std::static_pointer_cast<WebGLPipelineContext>(pipelineContext),
-                              vertexShader, fragmentShader, context, transformFeedbackVaryings);
+  return _createShaderProgram(webGLPipelineContext, vertexShader, fragmentShader, context,
+                              transformFeedbackVaryings);
+}
+
+WebGLProgramPtr
+ThinEngine::_loadProgramBinary(const WebGLPipelineContextPtr& pipelineContext,
+                               const std::string& vertexSource, const std::string& fragmentSource,
+                               WebGLRenderingContext* context,
+                               const std::vector<std::string>& transformFeedbackVaryings)
+{
+  pipelineContext->programBinaryKey.clear();
+
+  // Transform feedback objects are created while linking, these programs are always compiled
+  if (!_programBinaryCache || context != _gl || !transformFeedbackVaryings.empty()) {
+    return nullptr;
+  }
+
+  const auto key = _programBinaryCache->computeKey(vertexSource, fragmentSource);
+
+  unsigned int binaryFormat = 0;
+  Uint8Array binary;
+  if (_programBinaryCache->load(key, binaryFormat, binary)) {
+    auto program = context->createProgram();
+    if (program) {
+      context->programBinary(program.get(), binaryFormat, binary);
+      if (context->getProgramParameter(program.get(), GL::LINK_STATUS)) {
+        // The binary is already linked, nothing left to compile
+        pipelineContext->program            = program;
+        pipelineContext->context            = context;
+        pipelineContext->vertexShader       = nullptr;
+        pipelineContext->fragmentShader     = nullptr;
+        pipelineContext->isParallelCompiled = false;
+        return program;
+      }
+      context->deleteProgram(program.get());
+    }
+
+    // Rejected by the driver, the program is compiled and stored again
+    _programBinaryCache->remove(key);
+  }
+
+  pipelineContext->programBinaryKey = key;
+  return nullptr;
 }
 
 IPipelineContextPtr
@@ -1769,6 +1871,10 @@ WebGLProgramPtr ThinEngine::_createShaderProgram(
   context->attachShader(shaderProgram.get(), vertexShader.get());
   context->attachShader(shaderProgram.get(), fragmentShader.get());
 
+  if (!pipelineContext->programBinaryKey.empty()) {
+    context->programParameteri(shaderProgram.get(), GL::PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+  }
+
   context->linkProgram(shaderProgram.get());
 
   pipelineContext->context        = context;
@@ -1829,6 +1935,13 @@ void ThinEngine::_finalizePipelineContext(WebGLPipelineContext* pipelineContext)
     }
   }
 
+  if (_programBinaryCache && !pipelineContext->programBinaryKey.empty()) {
+    GL::GLenum binaryFormat = 0;
+    const auto binary       = context->getProgramBinary(program.get(), binaryFormat);
+    _programBinaryCache->save(pipelineContext->programBinaryKey, binaryFormat, binary);
+    pipelineContext->programBinaryKey.clear();
+  }
+
   context->deleteShader(vertexShader.get());
   context->deleteShader(fragmentShader.get());
 
@@ -2086,6 +2199,16 @@ bool ThinEngine::setMatrices(const WebGLUniformLocationPtr& uniform, const Float
   return true;
 }
 
+bool ThinEngine::setMatrix(const WebGLUniformLocationPtr& uniform, const Matrix& matrix)
+{
+  if (!uniform) {
+    return false;
+  }
+
+  _gl->uniformMatrix4fv(uniform.get(), false, matrix.m());
+  return true;
+}
+
 bool ThinEngine::setMatrix3x3(const WebGLUniformLocationPtr& uniform, const Float32Array& matrix)
 {
   if (!uniform) {
@@ -2428,6 +2551,9 @@ InternalTexturePtr ThinEngine::createTexture(
 
   if (!fallback) {
     _internalTexturesCache.emplace_back(texture);
+    _textureCache->add(
+      TextureCache::ComputeKey(originalUrl, buffer, _textureCache->hashEmbeddedBuffers), texture,
+      format);
   }
 
   const auto onInternalError = [=](const std::string& message, const std::string& exception) {
@@ -2481,7 +2607,14 @@ InternalTexturePtr ThinEngine::createTexture(
     };
 
     if (!buffer.has_value()) {
-      _loadFile(url, callback, nullptr, true, onInternalError);
+      if (_textureDecodeQueue) {
+        _textureDecodeQueue->loadFile(
+          url, [callback](const ArrayBuffer& data) { callback(ArrayBufferView(data), ""); },
+          onInternalError);
+      }
+      else {
+        _loadFile(url, callback, nullptr, true, onInternalError);
+      }
     }
     else {
       // callback(buffer as ArrayBuffer);
@@ -2489,9 +2622,7 @@ InternalTexturePtr ThinEngine::createTexture(
         callback(std::get<ArrayBuffer>(*buffer), "");
       }
       else {
-        if (onError) {
-          onError("Unable to load: only ArrayBuffer or ArrayBufferView is supported", "");
-        }
+        onInternalError("Unable to load: only ArrayBuffer or ArrayBufferView is supported", "");
       }
     }
   }
@@ -2565,6 +2696,9 @@ InternalTexturePtr ThinEngine::createTexture(
       if (url.empty() && buffer.has_value() && std::holds_alternative<Image>(*buffer)) {
         onload(std::get<Image>(*buffer));
       }
+      else if (_textureDecodeQueue) {
+        _textureDecodeQueue->loadImage(url, invertY, onload, onInternalError);
+      }
       else {
         ThinEngine::_FileToolsLoadImageFromUrl(url, onload, onInternalError, invertY, mimeType);
       }
@@ -2575,6 +2709,9 @@ InternalTexturePtr ThinEngine::createTexture(
                  || std::holds_alternative<Image>(*buffer))) {
       ThinEngine::_FileToolsLoadImage(*buffer, invertY, onload, onInternalError, mimeType);
     }
+    else {
+      onInternalError("Unable to load: missing or unsupported texture buffer", "");
+    }
   }
 
   return texture;
@@ -2960,11 +3097,7 @@ void ThinEngine::_prepareWebGLTexture(
     = std::min(maxTextureSize,
                needPOTTextures() ? ThinEngine::GetExponentOfTwo(height, maxTextureSize) : height);
 
-  if (!_gl) {
-    return;
-  }
-
-  if (!texture->_hardwareTexture) {
+  if (!_gl || !texture->_hardwareTexture) {
     // resetTextureCache();
     if (scene) {
       scene->_removePendingData(texture);
@@ -3081,6 +3214,7 @@ void ThinEngine::_releaseTexture(const InternalTexturePtr& texture)
   unbindAllTextures();
 
   stl_util::remove_vector_elements_equal_sharedptr(_internalTexturesCache, texture.get());
+  _textureCache->remove(texture.get());
 
   // Integrated fixed lod samplers.
   if (texture->_lodTextureHigh) {
@@ -3469,6 +3603,9 @@ void ThinEngine::dispose()
 {
   stopRenderLoop();
 
+  // Release the textures kept alive by the cache
+  _textureCache->clearReleasedTextures();
+
   // Clear observables
   /* if (onBeforeTextureInitObservable) */ {
     onBeforeTextureInitObservable.clear();
@@ -3495,6 +3632,9 @@ void ThinEngine::dispose()
   unbindAllAttributes();
   _boundUniforms = {};
 
+  // Drop the textures still being decoded
+  _textureDecodeQueue = nullptr;
+
   _workingCanvas         = nullptr;
   _workingContext        = nullptr;
   _currentBufferPointers = {};
@@ -4028,6 +4168,20 @@ void ThinEngine::updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffe
   _dynamicBufferExtension->updateDynamicVertexBuffer(vertexBuffer, data, byteOffset, byteLength);
 }
 
+void ThinEngine::resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                           size_t byteLength)
+{
+  _dynamicBufferExtension->resizeDynamicVertexBuffer(vertexBuffer, byteLength);
+}
+
+void ThinEngine::updateDynamicVertexBufferRange(const WebGLDataBufferPtr& vertexBuffer,
+                                                const float* data, size_t byteOffset,
+                                                size_t byteLength, bool discard)
+{
+  _dynamicBufferExtension->updateDynamicVertexBufferRange(vertexBuffer, data, byteOffset,
+                                                          byteLength, discard);
+}
+
 //--------------------------------------------------------------------------------------------------
 //                              Dynamic Texture Extension
 //--------------------------------------------------------------------------------------------------
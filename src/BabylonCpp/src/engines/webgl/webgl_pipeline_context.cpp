@@ -61,11 +61,15 @@ void WebGLPipelineContext::_fillEffectInformation(
     }
   }
 
-  const auto effectAvailableUniforms = engine->getUniforms(this, uniformsNames);
-  for (size_t index = 0; index < effectAvailableUniforms.size(); ++index) {
-    uniforms[uniformsNames[index]] = effectAvailableUniforms[index];
+  // Resolve the uniform locations once, the setters then index them by handle
+  _uniformLocations = engine->getUniforms(this, uniformsNames);
+  _valueCache.assign(_uniformLocations.size(), UniformValueCache{});
+  _uniformHandles.clear();
+  _uniformHandles.reserve(_uniformLocations.size());
+  for (size_t index = 0; index < _uniformLocations.size(); ++index) {
+    uniforms[uniformsNames[index]] = _uniformLocations[index];
+    _uniformHandles.emplace(uniformsNames[index], static_cast<int>(index));
   }
-  _uniforms = uniforms;
 
   stl_util::erase_remove_if(samplerList, [&effect](const std::string& uniformName) {
     return effect->getUniform(uniformName) == nullptr;
@@ -82,323 +86,349 @@ void WebGLPipelineContext::_fillEffectInformation(
 
 void WebGLPipelineContext::dispose()
 {
-  _uniforms = {};
+  _uniformLocations = {};
+  _uniformHandles   = {};
+  _valueCache       = {};
 }
 
 WebGLUniformLocationPtr WebGLPipelineContext::getUniform(const std::string& uniformName)
 {
-  if (stl_util::contains(_uniforms, uniformName)) {
-    return _uniforms[uniformName];
-  }
-
-  return nullptr;
+  const auto uniformHandle = getUniformHandle(uniformName);
+  return _isValidHandle(uniformHandle) ? _uniformLocations[uniformHandle] : nullptr;
 }
 
-bool WebGLPipelineContext::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+int WebGLPipelineContext::getUniformHandle(const std::string& uniformName) const
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName) && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
-    return false;
-  }
-
-  if (_valueCache[uniformName].empty()) {
-    _valueCache[uniformName].emplace_back(static_cast<float>(flag));
-  }
-  else {
-    _valueCache[uniformName][0] = static_cast<float>(flag);
-  }
+  const auto it = _uniformHandles.find(uniformName);
+  return (it != _uniformHandles.end()) ? it->second : -1;
+}
 
-  return true;
+bool WebGLPipelineContext::_isValidHandle(int uniformHandle) const
+{
+  return uniformHandle >= 0 && static_cast<size_t>(uniformHandle) < _uniformLocations.size();
 }
 
-bool WebGLPipelineContext::_cacheFloat2(const std::string& uniformName, float x, float y)
+bool WebGLPipelineContext::_cacheValues(int uniformHandle, const float* values, unsigned int size)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 2) {
-    _valueCache[uniformName] = {x, y};
+  if (!_isValidHandle(uniformHandle)) {
+    return false;
+  }
+
+  auto& cache = _valueCache[uniformHandle];
+  if (cache.size != size) {
+    std::copy(values, values + size, cache.values.begin());
+    cache.size = size;
     return true;
   }
 
   auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  for (unsigned int i = 0; i < size; ++i) {
+    if (!stl_util::almost_equal(cache.values[i], values[i])) {
+      cache.values[i] = values[i];
+      changed         = true;
+    }
   }
 
   return changed;
 }
 
-bool WebGLPipelineContext::_cacheFloat3(const std::string& uniformName, float x, float y, float z)
+void WebGLPipelineContext::_resetCache(int uniformHandle)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 3) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
+  if (_isValidHandle(uniformHandle)) {
+    _valueCache[uniformHandle].size = 0;
   }
+}
 
-  auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+bool WebGLPipelineContext::_cacheMatrix(int uniformHandle, const Matrix& matrix)
+{
+  if (!_isValidHandle(uniformHandle)) {
+    return false;
   }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+
+  auto& cache     = _valueCache[uniformHandle];
+  const auto flag = matrix.updateFlag;
+  if (cache.size == 16 && cache.updateFlag == flag) {
+    return false;
   }
 
-  return changed;
+  cache.size       = 16;
+  cache.updateFlag = flag;
+
+  return true;
 }
 
-bool WebGLPipelineContext::_cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                                        float w)
+bool WebGLPipelineContext::_cacheFloat(int uniformHandle, float x)
 {
-  if (!stl_util::contains(_valueCache, uniformName) || _valueCache[uniformName].size() != 4) {
-    _valueCache[uniformName] = {x, y, z, w};
-    return true;
-  }
+  return _cacheValues(uniformHandle, &x, 1);
+}
 
-  auto changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
-  }
+bool WebGLPipelineContext::_cacheFloat2(int uniformHandle, float x, float y)
+{
+  const std::array<float, 2> values{x, y};
+  return _cacheValues(uniformHandle, values.data(), 2);
+}
 
-  return changed;
+bool WebGLPipelineContext::_cacheFloat3(int uniformHandle, float x, float y, float z)
+{
+  const std::array<float, 3> values{x, y, z};
+  return _cacheValues(uniformHandle, values.data(), 3);
 }
 
-void WebGLPipelineContext::setInt(const std::string& uniformName, int value)
+bool WebGLPipelineContext::_cacheFloat4(int uniformHandle, float x, float y, float z, float w)
 {
-  Float32Array _value{static_cast<float>(value)};
-  if (stl_util::contains(_valueCache, uniformName) && (_valueCache[uniformName] == _value)) {
-    return;
-  }
+  const std::array<float, 4> values{x, y, z, w};
+  return _cacheValues(uniformHandle, values.data(), 4);
+}
 
-  if (engine->setInt(getUniform(uniformName), value)) {
-    _valueCache[uniformName] = _value;
-  }
+void WebGLPipelineContext::setInt(const std::string& uniformName, int value)
+{
+  setInt(getUniformHandle(uniformName), value);
 }
 
 void WebGLPipelineContext::setInt2(const std::string& uniformName, int x, int y)
 {
-  if (_cacheFloat2(uniformName, static_cast<float>(x), static_cast<float>(y))) {
-    if (!engine->setInt2(getUniform(uniformName), x, y)) {
-      _valueCache.erase(uniformName);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_cacheFloat2(uniformHandle, static_cast<float>(x), static_cast<float>(y))) {
+    if (!engine->setInt2(_uniformLocations[uniformHandle], x, y)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
 void WebGLPipelineContext::setInt3(const std::string& uniformName, int x, int y, int z)
 {
-  if (_cacheFloat3(uniformName, static_cast<float>(x), static_cast<float>(y),
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_cacheFloat3(uniformHandle, static_cast<float>(x), static_cast<float>(y),
                    static_cast<float>(z))) {
-    if (!engine->setInt3(getUniform(uniformName), x, y, z)) {
-      _valueCache.erase(uniformName);
+    if (!engine->setInt3(_uniformLocations[uniformHandle], x, y, z)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
 void WebGLPipelineContext::setInt4(const std::string& uniformName, int x, int y, int z, int w)
 {
-  if (_cacheFloat4(uniformName, static_cast<float>(x), static_cast<float>(y), static_cast<float>(z),
-                   static_cast<float>(w))) {
-    if (!engine->setInt4(getUniform(uniformName), x, y, z, w)) {
-      _valueCache.erase(uniformName);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_cacheFloat4(uniformHandle, static_cast<float>(x), static_cast<float>(y),
+                   static_cast<float>(z), static_cast<float>(w))) {
+    if (!engine->setInt4(_uniformLocations[uniformHandle], x, y, z, w)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
 void WebGLPipelineContext::setIntArray(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setIntArray(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setIntArray2(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray2(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setIntArray2(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setIntArray3(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray3(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setIntArray3(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setIntArray4(const std::string& uniformName, const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setIntArray4(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setIntArray4(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setArray(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setArray(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setArray2(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray2(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setArray2(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setArray3(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray3(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setArray3(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setArray4(const std::string& uniformName, const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  engine->setArray4(getUniform(uniformName), array);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setArray4(_uniformLocations[uniformHandle], array);
+  }
 }
 
 void WebGLPipelineContext::setMatrices(const std::string& uniformName, const Float32Array& matrices)
 {
-  if (matrices.empty()) {
-    return;
-  }
-
-  _valueCache.erase(uniformName);
-  engine->setMatrices(getUniform(uniformName), matrices);
+  setMatrices(getUniformHandle(uniformName), matrices);
 }
 
 void WebGLPipelineContext::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    if (!engine->setMatrices(getUniform(uniformName), matrix.toArray())) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  setMatrix(getUniformHandle(uniformName), matrix);
 }
 
 void WebGLPipelineContext::setMatrix3x3(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  engine->setMatrix3x3(getUniform(uniformName), matrix);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setMatrix3x3(_uniformLocations[uniformHandle], matrix);
+  }
 }
 
 void WebGLPipelineContext::setMatrix2x2(const std::string& uniformName, const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  engine->setMatrix2x2(getUniform(uniformName), matrix);
+  const auto uniformHandle = getUniformHandle(uniformName);
+  if (_isValidHandle(uniformHandle)) {
+    _resetCache(uniformHandle);
+    engine->setMatrix2x2(_uniformLocations[uniformHandle], matrix);
+  }
 }
 
 void WebGLPipelineContext::setFloat(const std::string& uniformName, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return;
-  }
-
-  if (engine->setFloat(getUniform(uniformName), value)) {
-    _valueCache[uniformName] = {value};
-  }
+  setFloat(getUniformHandle(uniformName), value);
 }
 
 void WebGLPipelineContext::setVector2(const std::string& uniformName, const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    if (!engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  setFloat2(getUniformHandle(uniformName), vector2.x, vector2.y);
 }
 
 void WebGLPipelineContext::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    if (!engine->setFloat2(getUniform(uniformName), x, y)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  setFloat2(getUniformHandle(uniformName), x, y);
 }
 
 void WebGLPipelineContext::setVector3(const std::string& uniformName, const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    if (!engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y, vector3.z)) {
-      _valueCache.erase(uniformName);
-    }
-  }
+  setFloat3(getUniformHandle(uniformName), vector3.x, vector3.y, vector3.z);
 }
 
 void WebGLPipelineContext::setFloat3(const std::string& uniformName, float x, float y, float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    if (!engine->setFloat3(getUniform(uniformName), x, y, z)) {
-      _valueCache.erase(uniformName);
+  setFloat3(getUniformHandle(uniformName), x, y, z);
+}
+
+void WebGLPipelineContext::setVector4(const std::string& uniformName, const Vector4& vector4)
+{
+  setFloat4(getUniformHandle(uniformName), vector4.x, vector4.y, vector4.z, vector4.w);
+}
+
+void WebGLPipelineContext::setFloat4(const std::string& uniformName, float x, float y, float z,
+                                     float w)
+{
+  setFloat4(getUniformHandle(uniformName), x, y, z, w);
+}
+
+void WebGLPipelineContext::setColor3(const std::string& uniformName, const Color3& color3)
+{
+  setFloat3(getUniformHandle(uniformName), color3.r, color3.g, color3.b);
+}
+
+void WebGLPipelineContext::setColor4(const std::string& uniformName, const Color3& color3,
+                                     float alpha)
+{
+  setFloat4(getUniformHandle(uniformName), color3.r, color3.g, color3.b, alpha);
+}
+
+void WebGLPipelineContext::setDirectColor4(const std::string& uniformName, const Color4& color4)
+{
+  setFloat4(getUniformHandle(uniformName), color4.r, color4.g, color4.b, color4.a);
+}
+
+void WebGLPipelineContext::setInt(int uniformHandle, int value)
+{
+  if (_cacheFloat(uniformHandle, static_cast<float>(value))) {
+    if (!engine->setInt(_uniformLocations[uniformHandle], value)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
-void WebGLPipelineContext::setVector4(const std::string& uniformName, const Vector4& vector4)
+void WebGLPipelineContext::setMatrices(int uniformHandle, const Float32Array& matrices)
+{
+  if (matrices.empty() || !_isValidHandle(uniformHandle)) {
+    return;
+  }
+
+  _resetCache(uniformHandle);
+  engine->setMatrices(_uniformLocations[uniformHandle], matrices);
+}
+
+void WebGLPipelineContext::setMatrix(int uniformHandle, const Matrix& matrix)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    if (!engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z, vector4.w)) {
-      _valueCache.erase(uniformName);
+  if (_cacheMatrix(uniformHandle, matrix)) {
+    if (!engine->setMatrix(_uniformLocations[uniformHandle], matrix)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
-void WebGLPipelineContext::setFloat4(const std::string& uniformName, float x, float y, float z,
-                                     float w)
+void WebGLPipelineContext::setFloat(int uniformHandle, float value)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    if (!engine->setFloat4(getUniform(uniformName), x, y, z, w)) {
-      _valueCache.erase(uniformName);
+  if (_cacheFloat(uniformHandle, value)) {
+    if (!engine->setFloat(_uniformLocations[uniformHandle], value)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
-void WebGLPipelineContext::setColor3(const std::string& uniformName, const Color3& color3)
+void WebGLPipelineContext::setFloat2(int uniformHandle, float x, float y)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    if (!engine->setFloat3(getUniform(uniformName), color3.r, color3.g, color3.b)) {
-      _valueCache.erase(uniformName);
+  if (_cacheFloat2(uniformHandle, x, y)) {
+    if (!engine->setFloat2(_uniformLocations[uniformHandle], x, y)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
-void WebGLPipelineContext::setColor4(const std::string& uniformName, const Color3& color3,
-                                     float alpha)
+void WebGLPipelineContext::setFloat3(int uniformHandle, float x, float y, float z)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    if (!engine->setFloat4(getUniform(uniformName), color3.r, color3.g, color3.b, alpha)) {
-      _valueCache.erase(uniformName);
+  if (_cacheFloat3(uniformHandle, x, y, z)) {
+    if (!engine->setFloat3(_uniformLocations[uniformHandle], x, y, z)) {
+      _resetCache(uniformHandle);
     }
   }
 }
 
-void WebGLPipelineContext::setDirectColor4(const std::string& uniformName, const Color4& color4)
+void WebGLPipelineContext::setFloat4(int uniformHandle, float x, float y, float z, float w)
 {
-  if (_cacheFloat4(uniformName, color4.r, color4.g, color4.b, color4.a)) {
-    if (!engine->setFloat4(getUniform(uniformName), color4.r, color4.g, color4.b, color4.a)) {
-      _valueCache.erase(uniformName);
+  if (_cacheFloat4(uniformHandle, x, y, z, w)) {
+    if (!engine->setFloat4(_uniformLocations[uniformHandle], x, y, z, w)) {
+      _resetCache(uniformHandle);
     }
   }
 }
@@ -1,6 +1,7 @@
 #include <babylon/instrumentation/engine_instrumentation.h>
 
 #include <babylon/engines/engine.h>
+#include <babylon/engines/texture_cache.h>
 
 namespace BABYLON {
 
@@ -11,14 +12,22 @@ EngineInstrumentation::EngineInstrumentation(Engine* engine)
     , shaderCompilationTimeCounter{this, &EngineInstrumentation::get_shaderCompilationTimeCounter}
     , captureShaderCompilationTime{this, &EngineInstrumentation::get_captureShaderCompilationTime,
                                    &EngineInstrumentation::set_captureShaderCompilationTime}
+    , textureCacheHitsCounter{this, &EngineInstrumentation::get_textureCacheHitsCounter}
+    , textureCacheMissesCounter{this, &EngineInstrumentation::get_textureCacheMissesCounter}
+    , captureTextureCacheStatistics{this, &EngineInstrumentation::get_captureTextureCacheStatistics,
+                                    &EngineInstrumentation::set_captureTextureCacheStatistics}
     , _engine{engine}
     , _captureGPUFrameTime{false}
     , _gpuFrameTimeToken{std::nullopt}
     , _captureShaderCompilationTime{false}
+    , _captureTextureCacheStatistics{false}
+    , _lastTextureCacheHits{0}
+    , _lastTextureCacheMisses{0}
     , _onBeginFrameObserver{nullptr}
     , _onEndFrameObserver{nullptr}
     , _onBeforeShaderCompilationObserver{nullptr}
     , _onAfterShaderCompilationObserver{nullptr}
+    , _onEndFrameTextureCacheObserver{nullptr}
 {
 }
 
@@ -108,6 +117,57 @@ void EngineInstrumentation::set_captureShaderCompilationTime(bool value)
   }
 }
 
+PerfCounter& EngineInstrumentation::get_textureCacheHitsCounter()
+{
+  return _textureCacheHits;
+}
+
+PerfCounter& EngineInstrumentation::get_textureCacheMissesCounter()
+{
+  return _textureCacheMisses;
+}
+
+bool EngineInstrumentation::get_captureTextureCacheStatistics() const
+{
+  return _captureTextureCacheStatistics;
+}
+
+void EngineInstrumentation::set_captureTextureCacheStatistics(bool value)
+{
+  if (value == _captureTextureCacheStatistics) {
+    return;
+  }
+
+  _captureTextureCacheStatistics = value;
+
+  if (value) {
+    const auto& statistics  = _engine->getTextureCache().statistics();
+    _lastTextureCacheHits   = statistics.hits;
+    _lastTextureCacheMisses = statistics.misses;
+
+    _onEndFrameTextureCacheObserver
+      = _engine->onEndFrameObservable.add([this](Engine* /*engine*/, EventState& /*es*/) {
+          const auto& statistics = _engine->getTextureCache().statistics();
+          // The statistics can be reset by the user in the meantime
+          _textureCacheHits.fetchNewFrame();
+          _textureCacheHits.addCount(
+            statistics.hits >= _lastTextureCacheHits ? statistics.hits - _lastTextureCacheHits : 0,
+            true);
+          _textureCacheMisses.fetchNewFrame();
+          _textureCacheMisses.addCount(statistics.misses >= _lastTextureCacheMisses ?
+                                         statistics.misses - _lastTextureCacheMisses :
+                                         0,
+                                       true);
+          _lastTextureCacheHits   = statistics.hits;
+          _lastTextureCacheMisses = statistics.misses;
+        });
+  }
+  else {
+    _engine->onEndFrameObservable.remove(_onEndFrameTextureCacheObserver);
+    _onEndFrameTextureCacheObserver = nullptr;
+  }
+}
+
 void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _engine->onBeginFrameObservable.remove(_onBeginFrameObserver);
@@ -122,6 +182,9 @@ void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMateria
   _engine->onAfterShaderCompilationObservable.remove(_onAfterShaderCompilationObserver);
   _onAfterShaderCompilationObserver = nullptr;
 
+  _engine->onEndFrameObservable.remove(_onEndFrameTextureCacheObserver);
+  _onEndFrameTextureCacheObserver = nullptr;
+
   _engine = nullptr;
 }
 
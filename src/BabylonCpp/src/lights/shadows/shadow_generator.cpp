@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/bakedvertexanimation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -925,6 +926,12 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh, bool isTransp
         }
       }
 
+      // Baked vertex animations
+      const auto& bvaManager = renderingMesh->bakedVertexAnimationManager();
+      if (bvaManager && bvaManager->isEnabled()) {
+        bvaManager->bind(iEffect.get(), hardwareInstancedRendering);
+      }
+
       // Morph targets
       MaterialHelper::BindMorphTargetParameters(renderingMesh.get(), iEffect.get());
 
@@ -1162,6 +1169,16 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances, bool isTransp
         defines.emplace_back(StringTools::concat(
           "#define BonesPerMesh " + std::to_string(mesh->skeleton()->bones.size() + 1)));
       }
+
+      // Baked vertex animations
+      const auto& bvaManager = std::static_pointer_cast<Mesh>(mesh)->bakedVertexAnimationManager();
+      if (bvaManager && bvaManager->isEnabled() && bvaManager->texture()
+          && mesh->numBoneInfluencers() > 0) {
+        defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+        if (useInstances) {
+          attribs.emplace_back(BakedVertexAnimationManager::AnimationSettingsInstancedKind);
+        }
+      }
     }
     else {
       defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
@@ -1243,8 +1260,12 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances, bool isTransp
                                         "vClipPlane4",
                                         "vClipPlane5",
                                         "vClipPlane6",
-                                        "softTransparentShadowSM"};
-      std::vector<std::string> samplers{"diffuseSampler", "boneSampler"};
+                                        "softTransparentShadowSM",
+                                        "bakedVertexAnimationSettings",
+                                        "bakedVertexAnimationTextureSizeInverted",
+                                        "bakedVertexAnimationTime"};
+      std::vector<std::string> samplers{"diffuseSampler", "boneSampler",
+                                        "bakedVertexAnimationTexture"};
 
       // Custom shader?
       if (customShaderOptions) {
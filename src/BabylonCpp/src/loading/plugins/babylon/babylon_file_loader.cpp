@@ -273,6 +273,9 @@ bool BabylonFileLoader::importMesh(
         }
 
         auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
+        if (SceneLoader::OptimizeIndices()) {
+          mesh->optimizeIndices();
+        }
         meshes.emplace_back(mesh);
         log << "\n\tMesh " << mesh->toString(fullDetails);
       }
@@ -691,6 +694,9 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
     index = 0;
     for (const auto& parsedMesh : json_util::get_array<json>(parsedData, "meshes")) {
       auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
+      if (SceneLoader::OptimizeIndices()) {
+        mesh->optimizeIndices();
+      }
       container->meshes.emplace_back(mesh);
       if (mesh->hasInstances()) {
         for (const auto& instance : mesh->instances) {
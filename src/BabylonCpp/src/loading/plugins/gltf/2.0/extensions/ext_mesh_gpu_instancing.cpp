@@ -0,0 +1,109 @@
+#include <babylon/loading/plugins/gltf/2.0/extensions/ext_mesh_gpu_instancing.h>
+
+#include <stdexcept>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/core/json_util.h>
+#include <babylon/loading/plugins/gltf/2.0/gltf_loader.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/misc/string_tools.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+EXT_mesh_gpu_instancing::EXT_mesh_gpu_instancing(GLTFLoader& loader) : _loader{loader}
+{
+  name    = EXT_mesh_gpu_instancing::NAME;
+  enabled = _loader.isExtensionUsed(EXT_mesh_gpu_instancing::NAME);
+}
+
+void EXT_mesh_gpu_instancing::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
+{
+}
+
+TransformNodePtr EXT_mesh_gpu_instancing::loadNodeAsync(
+  const std::string& context, INode& node,
+  const std::function<void(const TransformNodePtr& babylonTransformNode)>& assign)
+{
+  if (!stl_util::contains(node.extensions, NAME)) {
+    return nullptr;
+  }
+
+  const auto extensionContext = StringTools::printf("%s/extensions/%s", context.c_str(), NAME);
+  const auto& extension       = node.extensions[NAME];
+  const auto attributes
+    = json_util::has_valid_key_value(extension, "attributes") ? extension["attributes"] : json();
+
+  // The meshes of the node are not instanced meshes, they hold the thin instances
+  ++_loader._disableInstancedMesh;
+  auto babylonTransformNode
+    = _loader.loadNodeAsync(StringTools::printf("/nodes/%ld", node.index), node, assign);
+  --_loader._disableInstancedMesh;
+
+  if (node._primitiveBabylonMeshes.empty()) {
+    return babylonTransformNode;
+  }
+
+  // All the attributes hold one value per instance
+  std::optional<size_t> instanceCount;
+  const auto loadAttribute = [&](const std::string& attribute) -> const Float32Array* {
+    if (!json_util::has_valid_key_value(attributes, attribute)) {
+      return nullptr;
+    }
+
+    const auto attributeContext
+      = StringTools::printf("%s/attributes/%s", extensionContext.c_str(), attribute.c_str());
+    auto& accessor = ArrayItem::Get(attributeContext, _loader.gltf()->accessors,
+                                    attributes[attribute].get<size_t>());
+    if (instanceCount && *instanceCount != accessor.count) {
+      throw std::runtime_error(StringTools::printf(
+        "%s: Accessor count (%ld) does not match the count of the other attributes (%ld)",
+        attributeContext.c_str(), accessor.count, *instanceCount));
+    }
+    instanceCount = accessor.count;
+    return &_loader._loadFloatAccessorAsync(StringTools::printf("/accessors/%ld", accessor.index),
+                                           accessor);
+  };
+
+  const auto translationBuffer = loadAttribute("TRANSLATION");
+  const auto rotationBuffer    = loadAttribute("ROTATION");
+  const auto scaleBuffer       = loadAttribute("SCALE");
+
+  if (!instanceCount || *instanceCount == 0) {
+    return babylonTransformNode;
+  }
+
+  // One world matrix per instance, relative to the node
+  Float32Array matrices(*instanceCount * 16);
+  auto translation = Vector3::Zero();
+  auto rotation    = Quaternion::Identity();
+  auto scale       = Vector3::One();
+  auto matrix      = Matrix::Identity();
+  for (unsigned int i = 0; i < *instanceCount; ++i) {
+    if (translationBuffer) {
+      Vector3::FromArrayToRef(*translationBuffer, i * 3, translation);
+    }
+    if (rotationBuffer) {
+      Quaternion::FromArrayToRef(*rotationBuffer, i * 4, rotation);
+    }
+    if (scaleBuffer) {
+      Vector3::FromArrayToRef(*scaleBuffer, i * 3, scale);
+    }
+    Matrix::ComposeToRef(scale, rotation, translation, matrix);
+    matrix.copyToArray(matrices, i * 16);
+  }
+
+  for (const auto& babylonAbstractMesh : node._primitiveBabylonMeshes) {
+    if (auto babylonMesh = std::dynamic_pointer_cast<Mesh>(babylonAbstractMesh)) {
+      babylonMesh->thinInstanceSetBuffer("matrix", matrices, 16, true);
+    }
+  }
+
+  return babylonTransformNode;
+}
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
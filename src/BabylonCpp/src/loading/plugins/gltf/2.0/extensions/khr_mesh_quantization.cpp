@@ -0,0 +1,19 @@
+#include <babylon/loading/plugins/gltf/2.0/extensions/khr_mesh_quantization.h>
+
+#include <babylon/loading/plugins/gltf/2.0/gltf_loader.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+KHR_mesh_quantization::KHR_mesh_quantization(GLTFLoader& loader)
+{
+  name    = KHR_mesh_quantization::NAME;
+  enabled = loader.isExtensionUsed(KHR_mesh_quantization::NAME);
+}
+
+void KHR_mesh_quantization::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
+{
+}
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
@@ -1,5 +1,10 @@
 #include <babylon/loading/plugins/gltf/2.0/gltf_loader.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
 #include <babylon/animations/animation_group.h>
 #include <babylon/animations/ianimatable.h>
 #include <babylon/animations/ianimation_key.h>
@@ -9,10 +14,14 @@
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/free_camera.h>
+#include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/core/time.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/gltf/2.0/extensions/ext_mesh_gpu_instancing.h>
+#include <babylon/loading/plugins/gltf/2.0/extensions/khr_mesh_quantization.h>
 #include <babylon/loading/plugins/gltf/2.0/gltf_loader_extension.h>
 #include <babylon/loading/plugins/gltf/gltf_file_loader.h>
 #include <babylon/materials/pbr/pbr_material.h>
@@ -32,9 +41,126 @@
 namespace BABYLON {
 namespace GLTF2 {
 
-std::vector<std::string> GLTFLoader::_RegisteredExtensions;
+namespace {
+
+/**
+ * Number of accessor elements decoded per job.
+ */
+constexpr size_t DecodeGrainSize = 16384;
+
+/**
+ * @brief Converts the elements [begin, end) of an accessor to floats, reading the components
+ * straight from the bytes of its buffer view.
+ */
+template <typename T>
+void decodeElements(const uint8_t* source, size_t byteStride, size_t numComponents,
+                    bool normalized, size_t begin, size_t end, float* target)
+{
+  // Normalized integers as specified by glTF 2.0 (signed values are clamped to -1)
+  const auto scale = std::is_integral_v<T> && normalized ?
+                       1.f / static_cast<float>(std::numeric_limits<T>::max()) :
+                       1.f;
+
+  if (std::is_same_v<T, float> && byteStride == numComponents * sizeof(T)) {
+    std::memcpy(target + begin * numComponents, source + begin * byteStride,
+                (end - begin) * byteStride);
+    return;
+  }
+
+  for (size_t i = begin; i < end; ++i) {
+    const auto element = source + i * byteStride;
+    auto output        = target + i * numComponents;
+    for (size_t c = 0; c < numComponents; ++c) {
+      T value;
+      std::memcpy(&value, element + c * sizeof(T), sizeof(T));
+      output[c] = static_cast<float>(value) * scale;
+      if (std::is_integral_v<T> && std::is_signed_v<T> && normalized) {
+        output[c] = std::max(output[c], -1.f);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Converts count elements of an accessor to floats, in parallel for large accessors.
+ */
+void decodeFloatElements(IGLTF2::AccessorComponentType componentType, const uint8_t* source,
+                         size_t byteStride, size_t numComponents, bool normalized, size_t count,
+                         float* target)
+{
+  ThreadPool::Default().parallelFor(count, DecodeGrainSize, [&](size_t begin, size_t end) {
+    switch (componentType) {
+      case IGLTF2::AccessorComponentType::BYTE:
+        decodeElements<int8_t>(source, byteStride, numComponents, normalized, begin, end, target);
+        break;
+      case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
+        decodeElements<uint8_t>(source, byteStride, numComponents, normalized, begin, end, target);
+        break;
+      case IGLTF2::AccessorComponentType::SHORT:
+        decodeElements<int16_t>(source, byteStride, numComponents, normalized, begin, end, target);
+        break;
+      case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
+        decodeElements<uint16_t>(source, byteStride, numComponents, normalized, begin, end,
+                                 target);
+        break;
+      case IGLTF2::AccessorComponentType::UNSIGNED_INT:
+        decodeElements<uint32_t>(source, byteStride, numComponents, normalized, begin, end,
+                                 target);
+        break;
+      case IGLTF2::AccessorComponentType::FLOAT:
+        decodeElements<float>(source, byteStride, numComponents, normalized, begin, end, target);
+        break;
+      default:
+        break;
+    }
+  });
+}
+
+/**
+ * @brief Widens count tightly packed indices to 32 bits, in parallel for large accessors.
+ */
+void decodeIndices(IGLTF2::AccessorComponentType componentType, const uint8_t* source,
+                   size_t count, uint32_t* target)
+{
+  ThreadPool::Default().parallelFor(count, DecodeGrainSize, [&](size_t begin, size_t end) {
+    switch (componentType) {
+      case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
+        std::copy(source + begin, source + end, target + begin);
+        break;
+      case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
+        for (size_t i = begin; i < end; ++i) {
+          uint16_t index;
+          std::memcpy(&index, source + i * sizeof(uint16_t), sizeof(uint16_t));
+          target[i] = index;
+        }
+        break;
+      default:
+        std::memcpy(target + begin, source + begin * sizeof(uint32_t),
+                    (end - begin) * sizeof(uint32_t));
+        break;
+    }
+  });
+}
+
+} // end of anonymous namespace
+
+// Extensions implemented by the loader, registered here to not depend on the static
+// initialization order of the translation units
+std::vector<std::string> GLTFLoader::_RegisteredExtensions{
+  EXT_mesh_gpu_instancing::NAME,
+  KHR_mesh_quantization::NAME,
+};
 std::unordered_map<std::string, std::function<IGLTFLoaderExtensionPtr(GLTFLoader& loader)>>
-  GLTFLoader::_RegisteredExtensionFactories;
+  GLTFLoader::_RegisteredExtensionFactories{
+    {EXT_mesh_gpu_instancing::NAME,
+     [](GLTFLoader& loader) -> IGLTFLoaderExtensionPtr {
+       return std::make_shared<EXT_mesh_gpu_instancing>(loader);
+     }},
+    {KHR_mesh_quantization::NAME,
+     [](GLTFLoader& loader) -> IGLTFLoaderExtensionPtr {
+       return std::make_shared<KHR_mesh_quantization>(loader);
+     }},
+};
 
 void GLTFLoader::RegisterExtension(
   const std::string& name,
@@ -97,6 +223,11 @@ MeshPtr GLTFLoader::rootBabylonMesh()
   return _rootBabylonMesh;
 }
 
+bool GLTFLoader::isExtensionUsed(const std::string& name) const
+{
+  return _gltf && stl_util::contains(_gltf->extensionsUsed, name);
+}
+
 void GLTFLoader::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   if (_disposed) {
@@ -110,6 +241,7 @@ void GLTFLoader::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTexture
     extension->dispose();
   }
   _extensions.clear();
+  _activeLoaderExtensionFunctions.clear();
 
   _gltf            = nullptr;
   _babylonScene    = nullptr;
@@ -191,6 +323,12 @@ void GLTFLoader::_loadAsync(const std::vector<size_t>& nodes,
   _loadExtensions();
   _checkExtensions();
 
+  // Decode the accessors (and the embedded images) on the thread pool, before creating the scene
+  _parent._startPerformanceCounter("Decode accessors");
+  _decodeImagesAsync();
+  _decodeAccessorsAsync();
+  _parent._endPerformanceCounter("Decode accessors");
+
   const std::string loadingToReadyCounterName    = "LOADING => READY";
   const std::string loadingToCompleteCounterName = "LOADING => COMPLETE";
 
@@ -281,14 +419,14 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
 
   if (data.bin.has_value()) {
     const auto& buffers = _gltf->buffers;
-    if (!buffers.empty() && !buffers[0].uri.empty()) {
+    if (!buffers.empty() && buffers[0].uri.empty()) {
       const auto& binaryBuffer = buffers[0];
-      if (binaryBuffer.byteLength < data.bin->byteLength() - 3
-          || binaryBuffer.byteLength > data.bin->byteLength()) {
+      if (binaryBuffer.byteLength + 3 < data.bin->byteLength
+          || binaryBuffer.byteLength > data.bin->byteLength) {
         BABYLON_LOGF_WARN("GLTFLoader",
                           "Binary buffer length (%ld) from JSON does not match "
                           "chunk length (%ld)",
-                          binaryBuffer.byteLength, data.bin->byteLength())
+                          binaryBuffer.byteLength, data.bin->byteLength)
       }
 
       _bin = data.bin;
@@ -717,7 +855,8 @@ AbstractMeshPtr GLTFLoader::_loadMeshPrimitiveAsync(
 {
   logOpen(context);
 
-  const auto canInstance = (!node.skin.has_value() && mesh.primitives[0].targets.empty());
+  const auto canInstance = (_disableInstancedMesh == 0 && !node.skin.has_value()
+                            && mesh.primitives[0].targets.empty());
 
   AbstractMeshPtr babylonAbstractMesh = nullptr;
 
@@ -739,6 +878,11 @@ AbstractMeshPtr GLTFLoader::_loadMeshPrimitiveAsync(
       auto babylonGeometry = _loadVertexDataAsync(context, primitive, babylonMesh);
       _loadMorphTargetsAsync(context, primitive, babylonMesh, babylonGeometry);
       babylonGeometry->applyToMesh(babylonMesh.get());
+      if (_parent.optimizeIndices
+          && (!primitive.mode.has_value()
+              || *primitive.mode == IGLTF2::MeshPrimitiveMode::TRIANGLES)) {
+        babylonMesh->optimizeIndices();
+      }
     });
 
     const auto babylonDrawMode = GLTFLoader::_GetDrawMode(context, primitive.mode);
@@ -813,8 +957,8 @@ GeometryPtr GLTFLoader::_loadVertexDataAsync(const std::string& context,
     auto& accessor = ArrayItem::Get(StringTools::printf("%s/indices", context.c_str()),
                                     _gltf->accessors, *primitive.indices);
     promises.emplace_back([this, &babylonGeometry, &accessor]() {
-      auto data = _loadIndicesAccessorAsync(StringTools::printf("/accessors/%ld", accessor.index),
-                                            accessor);
+      const auto& data = _loadIndicesAccessorAsync(
+        StringTools::printf("/accessors/%ld", accessor.index), accessor);
       babylonGeometry->setIndices(data);
     });
   }
@@ -1456,159 +1600,263 @@ _IAnimationSamplerData GLTFLoader::_loadAnimationSamplerAsync(const std::string&
   return sampler._data.value();
 }
 
-ArrayBufferView& GLTFLoader::_loadBufferAsync(const std::string& context, IBuffer& buffer)
+const BinaryChunk& GLTFLoader::_loadBufferAsync(const std::string& context, IBuffer& buffer)
 {
   if (buffer._data) {
     return buffer._data;
   }
 
   if (buffer.uri.empty()) {
-    throw std::runtime_error(StringTools::printf("%s/uri: Value is missing", context.c_str()));
+    if (!_bin) {
+      throw std::runtime_error(StringTools::printf(
+        "%s: Uri is missing or the binary glTF is missing its binary chunk", context.c_str()));
+    }
+
+    // The BIN chunk is referenced in place
+    buffer._data = *_bin;
+    return buffer._data;
   }
 
-  buffer._data = loadUriAsync(StringTools::printf("%s/uri", context.c_str()), buffer.uri);
+  auto data = loadUriAsync(StringTools::printf("%s/uri", context.c_str()), buffer.uri);
+  const auto byteOffset = data.byteOffset;
+  const auto byteLength = data.byteLength();
+  buffer._data
+    = BinaryChunk::FromArrayBuffer(std::move(data.uint8Array())).slice(byteOffset, byteLength);
 
   return buffer._data;
 }
 
-ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
-                                                 IBufferView& bufferView)
+BinaryChunk GLTFLoader::_loadBufferViewChunkAsync(const std::string& context,
+                                                  IBufferView& bufferView)
 {
-  if (bufferView._data) {
-    return bufferView._data;
-  }
-
   auto& buffer = ArrayItem::Get(StringTools::printf("%s/buffer", context.c_str()), _gltf->buffers,
                                 bufferView.buffer);
-  const auto data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+  const auto& data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
 
-  // ASYNC_FIXME: We cannot treat the data right now, it will be otained later!
   try {
-    bufferView._data = stl_util::to_array<uint8_t>(
-      data.uint8Array(), data.byteOffset + (bufferView.byteOffset.value_or(0)),
-      bufferView.byteLength);
+    return data.slice(bufferView.byteOffset.value_or(0), bufferView.byteLength);
   }
   catch (const std::exception& e) {
     throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
   }
+}
+
+ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
+                                                 IBufferView& bufferView)
+{
+  if (bufferView._data) {
+    return bufferView._data;
+  }
+
+  const auto data  = _loadBufferViewChunkAsync(context, bufferView);
+  bufferView._data = Uint8Array(data.data.get(), data.data.get() + data.byteLength);
 
   return bufferView._data;
 }
 
-template <typename T>
-ArrayBufferView& GLTFLoader::_loadAccessorAsync(const std::string& context, IAccessor& accessor)
+void GLTFLoader::_decodeAccessorsAsync()
 {
-  if (accessor._data.has_value()) {
-    return *accessor._data;
-  }
+  static constexpr uint8_t FloatData   = 1;
+  static constexpr uint8_t IndicesData = 2;
 
-  const auto numComponents = GLTFLoader::_GetNumComponents(context, accessor.type);
-  const auto byteStride
-    = numComponents
-      * VertexBuffer::GetTypeByteLength(static_cast<unsigned>(accessor.componentType));
-  const auto length = numComponents * accessor.count;
+  std::vector<uint8_t> usages(_gltf->accessors.size(), 0);
+  const auto use = [&usages](std::optional<size_t> accessorIndex, uint8_t usage) -> void {
+    if (accessorIndex.has_value() && *accessorIndex < usages.size()) {
+      usages[*accessorIndex] |= usage;
+    }
+  };
 
-  if (!accessor.bufferView.has_value()) {
-    accessor._data = std::vector<T>(length);
+  // Accessors converted on the CPU, the other vertex attributes are uploaded straight from their
+  // buffer view (same conditions as in _loadVertexAccessorAsync)
+  for (const auto& mesh : _gltf->meshes) {
+    for (const auto& primitive : mesh.primitives) {
+      use(primitive.indices, IndicesData);
+      for (const auto& [attribute, accessorIndex] : primitive.attributes) {
+        if (accessorIndex >= _gltf->accessors.size()) {
+          continue;
+        }
+        const auto& accessor  = _gltf->accessors[accessorIndex];
+        const auto misaligned = accessor.byteOffset
+                                && *accessor.byteOffset
+                                       % VertexBuffer::GetTypeByteLength(
+                                         static_cast<unsigned int>(accessor.componentType))
+                                     != 0;
+        if (accessor.sparse || misaligned || attribute == "JOINTS_0") {
+          use(accessorIndex, FloatData);
+        }
+      }
+      for (const auto& target : primitive.targets) {
+        for (const auto& [attribute, accessorIndex] : target) {
+          use(accessorIndex, FloatData);
+        }
+      }
+    }
   }
-  else {
-    auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
-                                      _gltf->bufferViews, *accessor.bufferView);
-    auto data
-      = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-    if (accessor.componentType == IGLTF2::AccessorComponentType::FLOAT && !accessor.normalized) {
-      data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data, accessor.byteOffset,
-                                        length);
+  for (const auto& skin : _gltf->skins) {
+    use(skin.inverseBindMatrices, FloatData);
+  }
+  for (const auto& node : _gltf->nodes) {
+    const auto extension = node->extensions.find(EXT_mesh_gpu_instancing::NAME);
+    if (extension != node->extensions.end()
+        && json_util::has_valid_key_value(extension->second, "attributes")) {
+      for (const auto& attribute : extension->second["attributes"].items()) {
+        if (attribute.value().is_number_unsigned()) {
+          use(attribute.value().get<size_t>(), FloatData);
+        }
+      }
     }
-    else {
-      auto typedArray             = Float32Array(length);
-      const auto dataFloat32Array = data.float32Array();
-      VertexBuffer::ForEach(
-        dataFloat32Array, accessor.byteOffset || 0, bufferView.byteStride || byteStride,
-        numComponents, static_cast<unsigned>(accessor.componentType), typedArray.size(),
-        accessor.normalized || false,
-        [&typedArray](float value, size_t index) -> void { typedArray[index] = value; });
-      data = typedArray;
+  }
+  for (const auto& animation : _gltf->animations) {
+    for (const auto& sampler : animation.samplers) {
+      use(sampler.input, FloatData);
+      use(sampler.output, FloatData);
     }
-
-    accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
-                                                accessor.byteOffset, length);
   }
 
-  if (accessor.sparse) {
-    const auto& sparse            = *accessor.sparse;
-    const auto accessor_data_then = [this, &context, &sparse, &numComponents,
-                                     &accessor](const ArrayBufferView& view) -> Float32Array {
-      auto data = view.float32Array();
-      auto& indicesBufferView
-        = ArrayItem::Get(StringTools::printf("%s/sparse/indices/bufferView", context.c_str()),
-                         _gltf->bufferViews, sparse.indices.bufferView);
-      auto& valuesBufferView
-        = ArrayItem::Get(StringTools::printf("%s/sparse/values/bufferView", context.c_str()),
-                         _gltf->bufferViews, sparse.values.bufferView);
-      const auto indicesData = loadBufferViewAsync(
-        StringTools::printf("/bufferViews/%ld", indicesBufferView.index), indicesBufferView);
-      const auto valuesData = loadBufferViewAsync(
-        StringTools::printf("/bufferViews/%ld", valuesBufferView.index), valuesBufferView);
-      const auto& indices = _castIndicesTo32bit(
-        sparse.indices.componentType,
-        GLTFLoader::_GetTypedArray(StringTools::printf("%s/sparse/indices", context.c_str()),
-                                   sparse.indices.componentType, indicesData,
-                                   sparse.indices.byteOffset, sparse.count));
-      const auto values
-        = GLTFLoader::_GetTypedArray(StringTools::printf("%s/sparse/values", context.c_str()),
-                                     accessor.componentType, valuesData, sparse.values.byteOffset,
-                                     numComponents * sparse.count)
-            .float32Array();
-      size_t valuesIndex = 0;
-      for (unsigned int indice : indices) {
-        auto dataIndex = indice * numComponents;
-        for (size_t componentIndex = 0; componentIndex < numComponents; componentIndex++) {
-          data[dataIndex++] = values[valuesIndex++];
+  // The buffers are loaded up front, the decoding jobs only read them
+  const auto loadBuffer = [this](std::optional<size_t> bufferViewIndex) -> void {
+    if (bufferViewIndex.has_value() && *bufferViewIndex < _gltf->bufferViews.size()) {
+      const auto& bufferView = _gltf->bufferViews[*bufferViewIndex];
+      auto& buffer
+        = ArrayItem::Get(StringTools::printf("/bufferViews/%ld/buffer", bufferView.index),
+                         _gltf->buffers, bufferView.buffer);
+      _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+    }
+  };
+
+  std::vector<std::pair<IAccessor*, uint8_t>> jobs;
+  for (size_t index = 0; index < usages.size(); ++index) {
+    auto& accessor = _gltf->accessors[index];
+    for (const auto usage : {FloatData, IndicesData}) {
+      const auto decoded
+        = (usage == FloatData) ? accessor._data.has_value() : accessor._indicesData.has_value();
+      if ((usages[index] & usage) && !decoded) {
+        loadBuffer(accessor.bufferView);
+        if (accessor.sparse) {
+          loadBuffer(accessor.sparse->indices.bufferView);
+          loadBuffer(accessor.sparse->values.bufferView);
         }
+        jobs.emplace_back(&accessor, usage);
       }
-      return data;
-    };
-    accessor._data = accessor_data_then(*accessor._data);
+    }
   }
 
-  return *accessor._data;
+  // Each job writes the data of a different accessor
+  ThreadPool::Default().parallelFor(jobs.size(), 1, [this, &jobs](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      auto& [accessor, usage] = jobs[i];
+      const auto context      = StringTools::printf("/accessors/%ld", accessor->index);
+      if (usage == FloatData) {
+        accessor->_data = _decodeFloatAccessor(context, *accessor);
+      }
+      else {
+        accessor->_indicesData = _decodeIndicesAccessor(context, *accessor);
+      }
+    }
+  });
 }
 
-Float32Array GLTFLoader::_loadFloatAccessorAsync(const std::string& context, IAccessor& accessor)
+void GLTFLoader::_decodeImagesAsync()
 {
-  return _loadAccessorAsync<float>(context, accessor).float32Array();
-}
+  // The embedded images used by textures are decoded on the thread pool while the scene is loaded
+  std::vector<bool> usedImages(_gltf->images.size(), false);
+  for (const auto& texture : _gltf->textures) {
+    if (texture.source < usedImages.size()) {
+      usedImages[texture.source] = true;
+    }
+  }
 
-IndicesArray GLTFLoader::_castIndicesTo32bit(const IGLTF2::AccessorComponentType& type,
-                                             const ArrayBufferView& buffer)
-{
-  switch (type) {
-    case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-      return stl_util::cast_array_elements<uint32_t, uint8_t>(buffer.uint8Array());
-    case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-      return stl_util::cast_array_elements<uint32_t, uint16_t>(buffer.uint16Array());
-    default:
-      return buffer.uint32Array();
+  for (auto& image : _gltf->images) {
+    if (!usedImages[image.index] || !image.uri.empty() || !image.bufferView.has_value()
+        || image._decodedImage.valid()) {
+      continue;
+    }
+
+    auto& bufferView = ArrayItem::Get(StringTools::printf("/images/%ld/bufferView", image.index),
+                                      _gltf->bufferViews, *image.bufferView);
+    const auto data  = _loadBufferViewChunkAsync(
+      StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+    image._decodedImage = ThreadPool::Default()
+                            .enqueue([data]() -> Image {
+                              return FileTools::ArrayBufferToImage(data.data.get(),
+                                                                   data.byteLength);
+                            })
+                            .share();
   }
 }
 
-IndicesArray GLTFLoader::_getConverted32bitIndices(IAccessor& accessor)
+Float32Array GLTFLoader::_decodeFloatAccessor(const std::string& context,
+                                              const IAccessor& accessor)
 {
-  switch (accessor.componentType) {
-    case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-    case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-      accessor._data
-        = ArrayBufferView(_castIndicesTo32bit(accessor.componentType, *accessor._data));
-      break;
-    default:
-      break;
+  const auto numComponents = GLTFLoader::_GetNumComponents(context, accessor.type);
+  const auto elementSize
+    = numComponents
+      * VertexBuffer::GetTypeByteLength(static_cast<unsigned>(accessor.componentType));
+  const auto normalized = accessor.normalized.value_or(false);
+
+  Float32Array data(numComponents * accessor.count, 0.f);
+
+  if (accessor.bufferView.has_value() && accessor.count > 0) {
+    auto& bufferView      = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
+                                      _gltf->bufferViews, *accessor.bufferView);
+    const auto source     = _loadBufferViewChunkAsync(
+      StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+    const auto byteOffset = accessor.byteOffset.value_or(0);
+    const auto byteStride = bufferView.byteStride.value_or(0) > 0 ? *bufferView.byteStride :
+                                                                     elementSize;
+    if (byteOffset + (accessor.count - 1) * byteStride + elementSize > source.byteLength) {
+      throw std::runtime_error(
+        StringTools::printf("%s: Accessor is out of bounds of its buffer view", context.c_str()));
+    }
+
+    decodeFloatElements(accessor.componentType, source.data.get() + byteOffset, byteStride,
+                        numComponents, normalized, accessor.count, data.data());
+  }
+
+  if (accessor.sparse) {
+    const auto& sparse = *accessor.sparse;
+    auto& indicesBufferView
+      = ArrayItem::Get(StringTools::printf("%s/sparse/indices/bufferView", context.c_str()),
+                       _gltf->bufferViews, sparse.indices.bufferView);
+    auto& valuesBufferView
+      = ArrayItem::Get(StringTools::printf("%s/sparse/values/bufferView", context.c_str()),
+                       _gltf->bufferViews, sparse.values.bufferView);
+    const auto indicesData   = _loadBufferViewChunkAsync(
+      StringTools::printf("/bufferViews/%ld", indicesBufferView.index), indicesBufferView);
+    const auto valuesData    = _loadBufferViewChunkAsync(
+      StringTools::printf("/bufferViews/%ld", valuesBufferView.index), valuesBufferView);
+    const auto indicesOffset = sparse.indices.byteOffset.value_or(0);
+    const auto valuesOffset  = sparse.values.byteOffset.value_or(0);
+    const auto indexSize
+      = VertexBuffer::GetTypeByteLength(static_cast<unsigned>(sparse.indices.componentType));
+    if (indicesOffset + sparse.count * indexSize > indicesData.byteLength
+        || valuesOffset + sparse.count * elementSize > valuesData.byteLength) {
+      throw std::runtime_error(StringTools::printf(
+        "%s/sparse: Accessor is out of bounds of its buffer view", context.c_str()));
+    }
+
+    IndicesArray indices(sparse.count);
+    decodeIndices(sparse.indices.componentType, indicesData.data.get() + indicesOffset,
+                  sparse.count, indices.data());
+    Float32Array values(numComponents * sparse.count);
+    decodeFloatElements(accessor.componentType, valuesData.data.get() + valuesOffset, elementSize,
+                        numComponents, normalized, sparse.count, values.data());
+
+    for (size_t i = 0; i < sparse.count; ++i) {
+      if (indices[i] >= accessor.count) {
+        throw std::runtime_error(
+          StringTools::printf("%s/sparse/indices: Invalid value", context.c_str()));
+      }
+      std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(i * numComponents), numComponents,
+                  data.begin() + static_cast<std::ptrdiff_t>(indices[i] * numComponents));
+    }
   }
 
-  return accessor._data->uint32Array();
+  return data;
 }
 
-IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor)
+IndicesArray GLTFLoader::_decodeIndicesAccessor(const std::string& context,
+                                                const IAccessor& accessor)
 {
   if (accessor.type != IGLTF2::AccessorType::SCALAR) {
     throw std::runtime_error(StringTools::printf("%s/type: Invalid value", context.c_str()));
@@ -1621,18 +1869,48 @@ IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, I
       StringTools::printf("%s/componentType: Invalid value", context.c_str()));
   }
 
-  if (accessor._data.has_value()) {
-    return _getConverted32bitIndices(accessor);
+  if (!accessor.bufferView.has_value()) {
+    throw std::runtime_error(
+      StringTools::printf("%s/bufferView: Value is missing", context.c_str()));
   }
 
-  auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
+  auto& bufferView      = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
                                     _gltf->bufferViews, *accessor.bufferView);
-  const auto data
-    = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-  accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
-                                              accessor.byteOffset, accessor.count);
+  const auto source     = _loadBufferViewChunkAsync(
+    StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+  const auto byteOffset = accessor.byteOffset.value_or(0);
+  const auto indexSize
+    = VertexBuffer::GetTypeByteLength(static_cast<unsigned>(accessor.componentType));
+  if (byteOffset + accessor.count * indexSize > source.byteLength) {
+    throw std::runtime_error(
+      StringTools::printf("%s: Accessor is out of bounds of its buffer view", context.c_str()));
+  }
+
+  IndicesArray indices(accessor.count);
+  decodeIndices(accessor.componentType, source.data.get() + byteOffset, accessor.count,
+                indices.data());
+
+  return indices;
+}
+
+const Float32Array& GLTFLoader::_loadFloatAccessorAsync(const std::string& context,
+                                                        IAccessor& accessor)
+{
+  if (!accessor._data.has_value()) {
+    accessor._data = _decodeFloatAccessor(context, accessor);
+  }
 
-  return _getConverted32bitIndices(accessor);
+  return *accessor._data;
+}
+
+const IndicesArray& GLTFLoader::_loadIndicesAccessorAsync(const std::string& context,
+                                                          IAccessor& accessor)
+{
+  if (!accessor._indicesData.has_value()) {
+    accessor._indicesData = _decodeIndicesAccessor(context, accessor);
+  }
+
+  return *accessor._indicesData;
 }
 
 BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
@@ -1642,10 +1920,13 @@ BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
     return bufferView._babylonBuffer;
   }
 
-  auto data
-    = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+  // Single copy, from the buffer (or the BIN chunk) to the vertex data
+  const auto data = _loadBufferViewChunkAsync(
+    StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+  Float32Array vertexData((data.byteLength + sizeof(float) - 1) / sizeof(float), 0.f);
+  std::memcpy(vertexData.data(), data.data.get(), data.byteLength);
   bufferView._babylonBuffer
-    = std::make_shared<Buffer>(_babylonScene->getEngine(), data.float32Array(), false);
+    = std::make_shared<Buffer>(_babylonScene->getEngine(), vertexData, false);
 
   return bufferView._babylonBuffer;
 }
@@ -2063,11 +2344,15 @@ BaseTexturePtr GLTFLoader::_loadTextureAsync(
 
   if (url.empty()) {
     promises.emplace_back([this, &image, &babylonTexture]() -> void {
-      const auto data    = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
       const auto name    = !image.uri.empty() ?
                              image.uri :
                              StringTools::printf("%s#image%ld", _fileName.c_str(), image.index);
       const auto dataUrl = StringTools::printf("data:%s%s", _uniqueRootUrl.c_str(), name.c_str());
+      if (image._decodedImage.valid() && image._decodedImage.get().valid()) {
+        babylonTexture->updateURL(dataUrl, image._decodedImage.get());
+        return;
+      }
+      const auto data = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
       babylonTexture->updateURL(dataUrl, data.uint8Array());
     });
   }
@@ -2262,38 +2547,6 @@ unsigned int GLTFLoader::_GetTextureSamplingMode(const std::string& context,
   }
 }
 
-ArrayBufferView GLTFLoader::_GetTypedArray(const std::string& context,
-                                           IGLTF2::AccessorComponentType componentType,
-                                           const ArrayBufferView& bufferView,
-                                           std::optional<size_t> byteOffset, size_t length)
-{
-  const auto& buffer = bufferView.uint8Array();
-  byteOffset         = bufferView.byteOffset + byteOffset.value_or(0);
-
-  try {
-    switch (componentType) {
-      case IGLTF2::AccessorComponentType::BYTE:
-        return stl_util::to_array<int8_t>(buffer, *byteOffset, length);
-      case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-        return stl_util::to_array<uint8_t>(buffer, *byteOffset, length);
-      case IGLTF2::AccessorComponentType::SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
-      case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
-      case IGLTF2::AccessorComponentType::UNSIGNED_INT:
-        return stl_util::to_array<uint32_t>(buffer, *byteOffset, length);
-      case IGLTF2::AccessorComponentType::FLOAT:
-        return stl_util::to_array<float_t>(buffer, *byteOffset, length);
-      default:
-        throw std::runtime_error(
-          StringTools::printf("Invalid component type %d", static_cast<int>(componentType)));
-    }
-  }
-  catch (const std::exception& e) {
-    throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
-  }
-}
-
 unsigned int GLTFLoader::_GetNumComponents(const std::string& context, IGLTF2::AccessorType type)
 {
   switch (type) {
@@ -2401,6 +2654,35 @@ void GLTFLoader::_forEachExtensions(
   }
 }
 
+template <typename T>
+T GLTFLoader::_applyExtensions(const void* property, const std::string& functionName,
+                               const std::function<T(IGLTFLoaderExtension& extension)>& actionAsync)
+{
+  // An extension function is not applied again to the property it is being applied to, so that the
+  // extension can call back into the loader to load the property
+  auto& activeLoaderExtensionFunctions = _activeLoaderExtensionFunctions[property];
+  for (const auto& name : GLTFLoader::_RegisteredExtensions) {
+    if (!stl_util::contains(_extensions, name) || !_extensions[name]->enabled) {
+      continue;
+    }
+
+    const auto id = name + "." + functionName;
+    if (activeLoaderExtensionFunctions.count(id)) {
+      continue;
+    }
+
+    activeLoaderExtensionFunctions.insert(id);
+    auto result = actionAsync(*_extensions[name]);
+    activeLoaderExtensionFunctions.erase(id);
+
+    if (result) {
+      return result;
+    }
+  }
+
+  return T{};
+}
+
 void GLTFLoader::_extensionsOnLoading()
 {
 }
@@ -2415,11 +2697,13 @@ bool GLTFLoader::_extensionsLoadSceneAsync(const std::string& /*context*/, const
 }
 
 TransformNodePtr GLTFLoader::_extensionsLoadNodeAsync(
-  const std::string& /*context*/, const INode& /*node*/,
-  const std::function<void(const TransformNodePtr& babylonTransformNode)>&
-  /*assign*/)
+  const std::string& context, INode& node,
+  const std::function<void(const TransformNodePtr& babylonTransformNode)>& assign)
 {
-  return nullptr;
+  return _applyExtensions<TransformNodePtr>(
+    &node, "loadNode", [&](IGLTFLoaderExtension& extension) -> TransformNodePtr {
+      return extension.loadNodeAsync(context, node, assign);
+    });
 }
 
 CameraPtr GLTFLoader::_extensionsLoadCameraAsync(
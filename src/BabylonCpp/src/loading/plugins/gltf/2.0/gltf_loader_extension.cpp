@@ -18,8 +18,8 @@ void IGLTFLoaderExtension::loadSceneAsync(const std::string& /*context*/, const
 }
 
 TransformNodePtr IGLTFLoaderExtension::loadNodeAsync(
-  const std::string& /*context*/, const INode& /*node*/,
-  const std::function<void(const TransformNode& babylonMesh)>& /*assign*/)
+  const std::string& /*context*/, INode& /*node*/,
+  const std::function<void(const TransformNodePtr& babylonTransformNode)>& /*assign*/)
 {
   return nullptr;
 }
@@ -546,6 +546,13 @@ INodePtr INode::Parse(const json& parsedNode)
     node->name = json_util::get_string(parsedNode, "name");
   }
 
+  // Extensions
+  if (json_util::has_valid_key_value(parsedNode, "extensions")) {
+    for (const auto& item : parsedNode["extensions"].items()) {
+      node->extensions[item.key()] = item.value();
+    }
+  }
+
   return node;
 }
 
@@ -680,6 +687,13 @@ std::unique_ptr<IGLTF> IGLTF::Parse(const json& parsedGLTFObject)
     glTFObject.cameras.emplace_back(ICamera::Parse(camera));
   }
 
+  // Extensions used
+  glTFObject.extensionsUsed = json_util::get_array<std::string>(parsedGLTFObject, "extensionsUsed");
+
+  // Extensions required
+  glTFObject.extensionsRequired
+    = json_util::get_array<std::string>(parsedGLTFObject, "extensionsRequired");
+
   // Images
   for (const auto& image : json_util::get_array<json>(parsedGLTFObject, "images")) {
     glTFObject.images.emplace_back(IImage::Parse(image));
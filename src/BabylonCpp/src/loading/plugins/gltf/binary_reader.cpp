@@ -1,12 +1,41 @@
 #include <babylon/loading/plugins/gltf/binary_reader.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <stdexcept>
+
+#include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
 namespace GLTF2 {
 
-BinaryReader::BinaryReader(const ArrayBuffer& arrayBuffer)
-    : _arrayBuffer{arrayBuffer}, _dataView{DataView(arrayBuffer)}, _byteOffset{0}
+BinaryChunk BinaryChunk::FromArrayBuffer(ArrayBuffer&& arrayBuffer)
+{
+  const auto owner = std::make_shared<ArrayBuffer>(std::move(arrayBuffer));
+  return BinaryChunk{
+    std::shared_ptr<const uint8_t>(owner, owner->data()), // data
+    owner->size()                                          // byteLength
+  };
+}
+
+BinaryChunk BinaryChunk::slice(size_t byteOffset, size_t length) const
+{
+  if (byteOffset > byteLength || length > byteLength - byteOffset) {
+    throw std::runtime_error(
+      StringTools::printf("Range [%ld, %ld) is out of bounds (byte length: %ld)", byteOffset,
+                          byteOffset + length, byteLength));
+  }
+
+  return BinaryChunk{
+    std::shared_ptr<const uint8_t>(data, data.get() + byteOffset), // data
+    length                                                         // byteLength
+  };
+}
+
+BinaryChunk::operator bool() const
+{
+  return data != nullptr;
+}
+
+BinaryReader::BinaryReader(const BinaryChunk& chunk) : _chunk{chunk}, _byteOffset{0}
 {
 }
 
@@ -19,21 +48,32 @@ size_t BinaryReader::getPosition() const
 
 size_t BinaryReader::getLength() const
 {
-  return _arrayBuffer.size();
+  return _chunk.byteLength;
 }
 
 uint32_t BinaryReader::readUint32()
 {
-  const auto value = _dataView.getUint32(_byteOffset, true);
+  // Little endian, regardless of the platform
+  const auto bytes = _chunk.slice(_byteOffset, 4).data.get();
+  const auto value = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8)
+                     | (static_cast<uint32_t>(bytes[2]) << 16)
+                     | (static_cast<uint32_t>(bytes[3]) << 24);
   _byteOffset += 4;
   return value;
 }
 
 Uint8Array BinaryReader::readUint8Array(size_t length)
 {
-  const auto value = stl_util::to_array<uint8_t>(_arrayBuffer, _byteOffset, length);
+  const auto bytes = _chunk.slice(_byteOffset, length).data.get();
   _byteOffset += length;
-  return value;
+  return Uint8Array(bytes, bytes + length);
+}
+
+BinaryChunk BinaryReader::readChunk(size_t length)
+{
+  auto chunk = _chunk.slice(_byteOffset, length);
+  _byteOffset += length;
+  return chunk;
 }
 
 void BinaryReader::skipBytes(size_t length)
@@ -1,8 +1,11 @@
 #include <babylon/loading/plugins/gltf/gltf_file_loader.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
 #include <babylon/engines/asset_container.h>
 #include <babylon/engines/scene.h>
 #include <babylon/loading/plugins/gltf/2.0/gltf_loader.h>
@@ -42,6 +45,7 @@ GLTFFileLoader::GLTFFileLoader()
     , useRangeRequests{false}
     , createInstances{true}
     , alwaysComputeBoundingBox{false}
+    , optimizeIndices{false}
     , loadAllMaterials{false}
     , preprocessUrlAsync{nullptr}
     , onMeshLoaded{this, &GLTFFileLoader::set_onMeshLoaded}
@@ -329,13 +333,67 @@ void GLTFFileLoader::whenCompleteAsync()
 {
 }
 
+ISceneLoaderAsyncResult GLTFFileLoader::importMeshFromFileAsync(
+  const std::vector<std::string>& meshesNames, Scene* scene, const std::string& filePath,
+  const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress)
+{
+  std::string rootUrl, fileName;
+  auto loaderData = _parseFileAsync(scene, filePath, rootUrl, fileName);
+  _log(StringTools::printf("Loading %s", fileName.c_str()));
+  _loader = _getLoader(loaderData);
+  return _loader->importMeshAsync(meshesNames, scene, loaderData, rootUrl, onProgress, fileName);
+}
+
+void GLTFFileLoader::loadFromFileAsync(
+  Scene* scene, const std::string& filePath,
+  const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress)
+{
+  std::string rootUrl, fileName;
+  auto loaderData = _parseFileAsync(scene, filePath, rootUrl, fileName);
+  _log(StringTools::printf("Loading %s", fileName.c_str()));
+  _loader = _getLoader(loaderData);
+  _loader->loadAsync(scene, loaderData, rootUrl, onProgress, fileName);
+}
+
+IGLTFLoaderData GLTFFileLoader::_parseFileAsync(Scene* scene, const std::string& filePath,
+                                                std::string& rootUrl, std::string& fileName)
+{
+  const auto separator = filePath.find_last_of("/\\");
+  rootUrl  = (separator == std::string::npos) ? "" : filePath.substr(0, separator + 1);
+  fileName = (separator == std::string::npos) ? filePath : filePath.substr(separator + 1);
+
+  _startPerformanceCounter("Map file");
+  const auto file = MemoryMappedFile::Open(filePath);
+  if (!file) {
+    throw std::runtime_error("Unable to open file: " + filePath);
+  }
+  _log(StringTools::printf("Mapped %s (%ld bytes)", fileName.c_str(), file->size()));
+  _endPerformanceCounter("Map file");
+
+  // The chunk shares the ownership of the mapping, which stays alive as long as the loader
+  // references the BIN chunk
+  const BinaryChunk data{
+    std::shared_ptr<const uint8_t>(file, file->data()), // data
+    file->size()                                        // byteLength
+  };
+
+  static const std::string Binary_Magic = "glTF";
+  if (data.byteLength >= Binary_Magic.size()
+      && std::equal(Binary_Magic.begin(), Binary_Magic.end(), data.data.get())) {
+    return _parseAsync(scene, data, rootUrl, fileName);
+  }
+
+  const auto json = reinterpret_cast<const char*>(data.data.get());
+  return _parseAsync(scene, std::string(json, json + data.byteLength), rootUrl, fileName);
+}
+
 IGLTFLoaderData GLTFFileLoader::_parseAsync(Scene* scene,
-                                            const std::variant<std::string, ArrayBuffer>& data,
+                                            const std::variant<std::string, BinaryChunk>& data,
                                             const std::string& rootUrl, const std::string& fileName)
 {
   UnpackedBinary unpacked;
-  if (std::holds_alternative<ArrayBuffer>(data)) {
-    unpacked = _unpackBinary(std::get<ArrayBuffer>(data));
+  if (std::holds_alternative<BinaryChunk>(data)) {
+    unpacked = _unpackBinary(std::get<BinaryChunk>(data));
   }
   else if (std::holds_alternative<std::string>(data)) {
     unpacked.json = std::get<std::string>(data);
@@ -415,10 +473,10 @@ IGLTFLoaderPtr GLTFFileLoader::_getLoader(const IGLTFLoaderData& loaderData)
   return createLoaders[version->major](*this);
 }
 
-UnpackedBinary GLTFFileLoader::_unpackBinary(const ArrayBuffer& data)
+UnpackedBinary GLTFFileLoader::_unpackBinary(const BinaryChunk& data)
 {
   _startPerformanceCounter("Unpack binary");
-  _log(StringTools::printf("Binary length: %ld", data.size()));
+  _log(StringTools::printf("Binary length: %ld", data.byteLength));
 
   static const unsigned int Binary_Magic = 0x46546C67;
 
@@ -481,7 +539,7 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV1(BinaryReader& binaryReader) const
   }
 
   const auto bytesRemaining = binaryReader.getLength() - binaryReader.getPosition();
-  const auto body           = binaryReader.readUint8Array(bytesRemaining);
+  const auto body           = binaryReader.readChunk(bytesRemaining);
 
   return UnpackedBinary{
     content, // json
@@ -510,8 +568,8 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV2(BinaryReader& binaryReader) const
   }
   const auto json = GLTFFileLoader::_decodeBufferToText(binaryReader.readUint8Array(chunkLength));
 
-  // Look for BIN chunk
-  Uint8Array bin;
+  // Look for BIN chunk, which is referenced in place (no copy)
+  std::optional<BinaryChunk> bin;
   while (binaryReader.getPosition() < binaryReader.getLength()) {
     const auto chunkLength2 = binaryReader.readUint32();
     const auto chunkFormat2 = binaryReader.readUint32();
@@ -520,7 +578,7 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV2(BinaryReader& binaryReader) const
         throw std::runtime_error("Unexpected JSON chunk");
       }
       case ChunkFormat_BIN: {
-        bin = binaryReader.readUint8Array(chunkLength2);
+        bin = binaryReader.readChunk(chunkLength2);
         break;
       }
       default: {
@@ -577,14 +635,7 @@ int GLTFFileLoader::_compareVersion(const Version& a, const Version& b)
 
 std::string GLTFFileLoader::_decodeBufferToText(const Uint8Array& buffer)
 {
-  std::ostringstream result;
-  const auto length = buffer.size();
-
-  for (size_t i = 0; i < length; ++i) {
-    result << StringTools::fromCharCode(buffer[i]);
-  }
-
-  return result.str();
+  return std::string(buffer.begin(), buffer.end());
 }
 
 void GLTFFileLoader::_logOpen(const std::string& message)
@@ -61,6 +61,16 @@ void SceneLoader::setCleanBoneMatrixWeights(bool value)
   SceneLoaderFlags::setCleanBoneMatrixWeights(value);
 }
 
+bool SceneLoader::OptimizeIndices()
+{
+  return SceneLoaderFlags::OptimizeIndices();
+}
+
+void SceneLoader::setOptimizeIndices(bool value)
+{
+  SceneLoaderFlags::setOptimizeIndices(value);
+}
+
 std::unordered_map<std::string, IRegisteredPlugin> SceneLoader::_registeredPlugins{};
 
 void SceneLoader::RegisterPlugins()
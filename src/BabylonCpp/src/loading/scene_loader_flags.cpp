@@ -8,6 +8,7 @@ namespace BABYLON {
 bool SceneLoaderFlags::_ForceFullSceneLoadingForIncremental = false;
 bool SceneLoaderFlags::_ShowLoadingScreen                   = true;
 bool SceneLoaderFlags::_CleanBoneMatrixWeights              = false;
+bool SceneLoaderFlags::_OptimizeIndices                     = false;
 unsigned int SceneLoaderFlags::_loggingLevel                = Constants::SCENELOADER_NO_LOGGING;
 
 bool SceneLoaderFlags::ForceFullSceneLoadingForIncremental()
@@ -50,4 +51,14 @@ void SceneLoaderFlags::setCleanBoneMatrixWeights(bool value)
   SceneLoaderFlags::_CleanBoneMatrixWeights = value;
 }
 
+bool SceneLoaderFlags::OptimizeIndices()
+{
+  return SceneLoaderFlags::_OptimizeIndices;
+}
+
+void SceneLoaderFlags::setOptimizeIndices(bool value)
+{
+  SceneLoaderFlags::_OptimizeIndices = value;
+}
+
 } // end of namespace BABYLON
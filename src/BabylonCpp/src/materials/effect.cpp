@@ -15,6 +15,7 @@
 #include <babylon/materials/ieffect_creation_options.h>
 #include <babylon/materials/material.h>
 #include <babylon/maths/color3.h>
+#include <babylon/maths/color4.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector4.h>
 #include <babylon/misc/string_tools.h>
@@ -81,6 +82,12 @@ Effect::Effect(
 
     stl_util::concat(_uniformsNames, options.samplers);
 
+    // The handle of a uniform is its index in the list of uniform names
+    _uniformHandles.reserve(_uniformsNames.size());
+    for (size_t index = 0; index < _uniformsNames.size(); ++index) {
+      _uniformHandles.emplace(_uniformsNames[index], static_cast<int>(index));
+    }
+
     if (!options.uniformBuffersNames.empty()) {
       _uniformBuffersNamesList = options.uniformBuffersNames;
       for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -294,7 +301,13 @@ size_t Effect::getAttributesCount()
 
 int Effect::getUniformIndex(const std::string& uniformName)
 {
-  return stl_util::index_of(_uniformsNames, uniformName);
+  return getUniformHandle(uniformName);
+}
+
+int Effect::getUniformHandle(const std::string& uniformName) const
+{
+  const auto it = _uniformHandles.find(uniformName);
+  return (it != _uniformHandles.end()) ? it->second : -1;
 }
 
 WebGLUniformLocationPtr Effect::getUniform(const std::string& uniformName)
@@ -745,10 +758,7 @@ void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
 
 Effect& Effect::setInt(const std::string& uniformName, int value)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setInt(uniformName, value);
-  }
-  return *this;
+  return setInt(getUniformHandle(uniformName), value);
 }
 
 Effect& Effect::setInt2(const std::string& uniformName, int x, int y)
@@ -873,18 +883,12 @@ Effect& Effect::setArray4(const std::string& uniformName, Float32Array array)
 
 Effect& Effect::setMatrices(const std::string& uniformName, Float32Array matrices)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setMatrices(uniformName, matrices);
-  }
-  return *this;
+  return setMatrices(getUniformHandle(uniformName), matrices);
 }
 
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setMatrix(uniformName, matrix);
-  }
-  return *this;
+  return setMatrix(getUniformHandle(uniformName), matrix);
 }
 
 Effect& Effect::setMatrix3x3(const std::string& uniformName, const Float32Array& matrix)
@@ -905,92 +909,145 @@ Effect& Effect::setMatrix2x2(const std::string& uniformName, const Float32Array&
 
 Effect& Effect::setFloat(const std::string& uniformName, float value)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setFloat(uniformName, value);
-  }
-  return *this;
+  return setFloat(getUniformHandle(uniformName), value);
 }
 
 Effect& Effect::setBool(const std::string& uniformName, bool _bool)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setInt(uniformName, _bool ? 1 : 0);
-  }
-  return *this;
+  return setInt(getUniformHandle(uniformName), _bool ? 1 : 0);
 }
 
 Effect& Effect::setVector2(const std::string& uniformName, const Vector2& vector2)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setVector2(uniformName, vector2);
-  }
-  return *this;
+  return setVector2(getUniformHandle(uniformName), vector2);
 }
 
 Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_pipelineContext) {
-    _pipelineContext->setFloat2(uniformName, x, y);
-  }
-  return *this;
+  return setFloat2(getUniformHandle(uniformName), x, y);
 }
 
 Effect& Effect::setVector3(const std::string& uniformName, const Vector3& vector3)
+{
+  return setVector3(getUniformHandle(uniformName), vector3);
+}
+
+Effect& Effect::setFloat3(const std::string& uniformName, float x, float y, float z)
+{
+  return setFloat3(getUniformHandle(uniformName), x, y, z);
+}
+
+Effect& Effect::setVector4(const std::string& uniformName, const Vector4& vector4)
+{
+  return setVector4(getUniformHandle(uniformName), vector4);
+}
+
+Effect& Effect::setFloat4(const std::string& uniformName, float x, float y, float z, float w)
+{
+  return setFloat4(getUniformHandle(uniformName), x, y, z, w);
+}
+
+Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
+{
+  return setColor3(getUniformHandle(uniformName), color3);
+}
+
+Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3, float alpha)
+{
+  return setColor4(getUniformHandle(uniformName), color3, alpha);
+}
+
+Effect& Effect::setDirectColor4(const std::string& uniformName, const Color4& color4)
+{
+  return setDirectColor4(getUniformHandle(uniformName), color4);
+}
+
+Effect& Effect::setInt(int uniformHandle, int value)
 {
   if (_pipelineContext) {
-    _pipelineContext->setVector3(uniformName, vector3);
+    _pipelineContext->setInt(uniformHandle, value);
   }
   return *this;
 }
 
-Effect& Effect::setFloat3(const std::string& uniformName, float x, float y, float z)
+Effect& Effect::setMatrices(int uniformHandle, const Float32Array& matrices)
 {
   if (_pipelineContext) {
-    _pipelineContext->setFloat3(uniformName, x, y, z);
+    _pipelineContext->setMatrices(uniformHandle, matrices);
   }
   return *this;
 }
 
-Effect& Effect::setVector4(const std::string& uniformName, const Vector4& vector4)
+Effect& Effect::setMatrix(int uniformHandle, const Matrix& matrix)
 {
   if (_pipelineContext) {
-    _pipelineContext->setVector4(uniformName, vector4);
+    _pipelineContext->setMatrix(uniformHandle, matrix);
   }
   return *this;
 }
 
-Effect& Effect::setFloat4(const std::string& uniformName, float x, float y, float z, float w)
+Effect& Effect::setFloat(int uniformHandle, float value)
 {
   if (_pipelineContext) {
-    _pipelineContext->setFloat4(uniformName, x, y, z, w);
+    _pipelineContext->setFloat(uniformHandle, value);
   }
   return *this;
 }
 
-Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
+Effect& Effect::setVector2(int uniformHandle, const Vector2& vector2)
+{
+  return setFloat2(uniformHandle, vector2.x, vector2.y);
+}
+
+Effect& Effect::setFloat2(int uniformHandle, float x, float y)
 {
   if (_pipelineContext) {
-    _pipelineContext->setColor3(uniformName, color3);
+    _pipelineContext->setFloat2(uniformHandle, x, y);
   }
   return *this;
 }
 
-Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3, float alpha)
+Effect& Effect::setVector3(int uniformHandle, const Vector3& vector3)
+{
+  return setFloat3(uniformHandle, vector3.x, vector3.y, vector3.z);
+}
+
+Effect& Effect::setFloat3(int uniformHandle, float x, float y, float z)
 {
   if (_pipelineContext) {
-    _pipelineContext->setColor4(uniformName, color3, alpha);
+    _pipelineContext->setFloat3(uniformHandle, x, y, z);
   }
   return *this;
 }
 
-Effect& Effect::setDirectColor4(const std::string& uniformName, const Color4& color4)
+Effect& Effect::setVector4(int uniformHandle, const Vector4& vector4)
+{
+  return setFloat4(uniformHandle, vector4.x, vector4.y, vector4.z, vector4.w);
+}
+
+Effect& Effect::setFloat4(int uniformHandle, float x, float y, float z, float w)
 {
   if (_pipelineContext) {
-    _pipelineContext->setDirectColor4(uniformName, color4);
+    _pipelineContext->setFloat4(uniformHandle, x, y, z, w);
   }
   return *this;
 }
 
+Effect& Effect::setColor3(int uniformHandle, const Color3& color3)
+{
+  return setFloat3(uniformHandle, color3.r, color3.g, color3.b);
+}
+
+Effect& Effect::setColor4(int uniformHandle, const Color3& color3, float alpha)
+{
+  return setFloat4(uniformHandle, color3.r, color3.g, color3.b, alpha);
+}
+
+Effect& Effect::setDirectColor4(int uniformHandle, const Color4& color4)
+{
+  return setFloat4(uniformHandle, color4.r, color4.g, color4.b, color4.a);
+}
+
 void Effect::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   if (_pipelineContext) {
@@ -3,6 +3,8 @@
 #include <babylon/shaders/shadersinclude/background_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_vertex_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/baked_vertex_animation_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/baked_vertex_animation_fx.h>
 #include <babylon/shaders/shadersinclude/bayer_dither_functions_fx.h>
 #include <babylon/shaders/shadersinclude/bones_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/bones_vertex_fx.h>
@@ -124,6 +126,8 @@ std::unordered_map<std::string, std::string>
   = {{"backgroundFragmentDeclaration", backgroundFragmentDeclaration},
      {"backgroundUboDeclaration", backgroundUboDeclaration},
      {"backgroundVertexDeclaration", backgroundVertexDeclaration},
+     {"bakedVertexAnimation", bakedVertexAnimation},
+     {"bakedVertexAnimationDeclaration", bakedVertexAnimationDeclaration},
      {"bayerDitherFunctions", bayerDitherFunctions},
      {"bonesDeclaration", bonesDeclaration},
      {"bonesVertex", bonesVertex},
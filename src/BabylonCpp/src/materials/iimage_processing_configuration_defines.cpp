@@ -64,4 +64,21 @@ std::string IImageProcessingConfigurationDefines::convertToString() const
   return oss.str();
 }
 
+uint64_t IImageProcessingConfigurationDefines::convertToHash() const
+{
+  const bool defines[] = {
+    IMAGEPROCESSING,     VIGNETTE,         VIGNETTEBLENDMODEMULTIPLY, VIGNETTEBLENDMODEOPAQUE,
+    TONEMAPPING,         TONEMAPPING_ACES, CONTRAST,                  EXPOSURE,
+    COLORCURVES,         COLORGRADING,     COLORGRADING3D,            FROMLINEARSPACE,
+    SAMPLER3DGREENDEPTH, SAMPLER3DBGRMAP,  IMAGEPROCESSINGPOSTPROCESS};
+
+  uint64_t bits = 0;
+  for (const auto define : defines) {
+    bits = (bits << 1) | (define ? 1u : 0u);
+  }
+
+  // Spreads the bits over the whole hash (odd multiplier, no collision)
+  return bits * 0x9e3779b97f4a7c15ull;
+}
+
 } // end of namespace BABYLON
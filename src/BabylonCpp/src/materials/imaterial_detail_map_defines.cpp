@@ -4,14 +4,17 @@ namespace BABYLON {
 
 IMaterialDetailMapDefines::IMaterialDetailMapDefines()
 {
-  boolDef = {
-    {"DETAIL", false}, //
-  };
-
-  intDef = {
-    {"DETAILDIRECTUV", 0},           //
-    {"DETAIL_NORMALBLENDMETHOD", 0}, //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"DETAIL", false}, //
+    },
+    // Numeric defines
+    {
+      {"DETAILDIRECTUV", 0},           //
+      {"DETAIL_NORMALBLENDMETHOD", 0}, //
+    });
+  _useSchema(schema);
 }
 
 IMaterialDetailMapDefines::~IMaterialDetailMapDefines() = default;
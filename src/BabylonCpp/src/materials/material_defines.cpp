@@ -1,5 +1,7 @@
 #include <babylon/materials/material_defines.h>
 
+#include <cstring>
+
 #include <babylon/babylon_stl_util.h>
 
 namespace BABYLON {
@@ -19,6 +21,8 @@ MaterialDefines::MaterialDefines()
     , _uvs{false}
     , _needNormals{false}
     , _needUVs{false}
+    , _effectHash{0}
+    , _effectDefines{}
 {
 }
 
@@ -41,6 +45,8 @@ MaterialDefines::MaterialDefines(const MaterialDefines& other)
     , _uvs{other._uvs}
     , _needNormals{other._needNormals}
     , _needUVs{other._needUVs}
+    , _effectHash{other._effectHash}
+    , _effectDefines{other._effectDefines}
 {
 }
 
@@ -63,6 +69,8 @@ MaterialDefines::MaterialDefines(MaterialDefines&& other)
     , _uvs{std::move(other._uvs)}
     , _needNormals{std::move(other._needNormals)}
     , _needUVs{std::move(other._needUVs)}
+    , _effectHash{std::move(other._effectHash)}
+    , _effectDefines{std::move(other._effectDefines)}
 {
 }
 
@@ -87,6 +95,8 @@ MaterialDefines& MaterialDefines::operator=(const MaterialDefines& other)
     _uvs                     = other._uvs;
     _needNormals             = other._needNormals;
     _needUVs                 = other._needUVs;
+    _effectHash              = other._effectHash;
+    _effectDefines           = other._effectDefines;
   }
 
   return *this;
@@ -113,6 +123,8 @@ MaterialDefines& MaterialDefines::operator=(MaterialDefines&& other)
     _uvs                     = std::move(other._uvs);
     _needNormals             = std::move(other._needNormals);
     _needUVs                 = std::move(other._needUVs);
+    _effectHash              = std::move(other._effectHash);
+    _effectDefines           = std::move(other._effectDefines);
   }
 
   return *this;
@@ -120,9 +132,15 @@ MaterialDefines& MaterialDefines::operator=(MaterialDefines&& other)
 
 MaterialDefines::~MaterialDefines() = default;
 
-bool MaterialDefines::operator[](const std::string& define) const
+bool MaterialDefines::operator[](std::string_view define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  const auto index = boolDef.schema().findBoolIndex(define);
+  return index >= 0 && boolDef.get(static_cast<size_t>(index));
+}
+
+bool MaterialDefines::operator[](size_t defineIndex) const
+{
+  return boolDef.get(defineIndex);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -137,15 +155,15 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 
 std::ostream& operator<<(std::ostream& os, const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
+  materialDefines.boolDef.forEach([&os](std::string_view name, bool value) {
+    if (value) {
+      os << "#define " << name << "\n";
     }
-  }
+  });
 
-  for (const auto& item : materialDefines.intDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  materialDefines.intDef.forEach([&os](std::string_view name, int value) {
+    os << "#define " << name << " " << value << "\n";
+  });
 
   for (const auto& item : materialDefines.floatDef) {
     os << "#define " << item.first << " " << item.second << "\n";
@@ -316,4 +334,28 @@ std::string MaterialDefines::toString() const
   return oss.str();
 }
 
+uint64_t MaterialDefines::hash() const
+{
+  auto hash = boolDef.hash() ^ intDef.hash();
+
+  // The float and string defines are seldom used, they are hashed on demand
+  for (const auto& [name, value] : floatDef) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    hash ^= MaterialDefinesSchema::Key(name, bits);
+  }
+
+  for (const auto& [name, value] : stringDef) {
+    hash ^= MaterialDefinesSchema::Key(value, MaterialDefinesSchema::Key(name, 0));
+  }
+
+  return hash;
+}
+
+void MaterialDefines::_useSchema(MaterialDefinesSchema& schema)
+{
+  boolDef.reset(schema);
+  intDef.reset(schema);
+}
+
 } // end of namespace BABYLON
@@ -0,0 +1,378 @@
+#include <babylon/materials/material_defines_schema.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint64_t BoolDefinesSeed = 0x9e3779b97f4a7c15ull;
+constexpr uint64_t IntDefinesSeed  = 0xc2b2ae3d27d4eb4full;
+
+uint64_t mix(uint64_t value)
+{
+  // splitmix64 finalizer
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31);
+}
+
+template <typename T>
+size_t registerDefine(MaterialDefinesSchema::Table<T>& table, std::string_view name,
+                      uint64_t seed, T defaultValue)
+{
+  using Table = MaterialDefinesSchema::Table<T>;
+
+  const auto it = table.indices.find(name);
+  if (it != table.indices.end()) {
+    return it->second;
+  }
+  // The defines are stored in blocks which are never moved, so that the names used as keys and
+  // the defines read by index from other threads are never invalidated
+  const auto index = table.count.load(std::memory_order_relaxed);
+  const auto block = index / Table::BlockSize;
+  if (block >= Table::MaxBlocks) {
+    throw std::runtime_error("Too many material defines, cannot register " + std::string{name});
+  }
+  if (!table.blocks[block]) {
+    table.blocks[block] = std::make_unique<std::array<typename Table::Define, Table::BlockSize>>();
+  }
+  auto& define        = (*table.blocks[block])[index % Table::BlockSize];
+  define.name         = std::string{name};
+  define.key          = MaterialDefinesSchema::Key(name, seed);
+  define.defaultValue = defaultValue;
+  table.indices.emplace(std::string_view{define.name}, index);
+  // Publishes the define to the threads reading the defines by index
+  table.count.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+template <typename T>
+int findDefine(const MaterialDefinesSchema::Table<T>& table, std::string_view name)
+{
+  const auto it = table.indices.find(name);
+  return it != table.indices.end() ? static_cast<int>(it->second) : -1;
+}
+
+} // end of anonymous namespace
+
+//--------------------------------------------------------------------------------------------------
+// MaterialDefinesSchema
+//--------------------------------------------------------------------------------------------------
+
+MaterialDefinesSchema::MaterialDefinesSchema(
+  std::initializer_list<std::pair<const char*, bool>> iBoolDefines,
+  std::initializer_list<std::pair<const char*, int>> iIntDefines)
+{
+  for (const auto& [name, defaultValue] : iBoolDefines) {
+    registerDefine(boolDefines, name, BoolDefinesSeed, defaultValue);
+  }
+  for (const auto& [name, defaultValue] : iIntDefines) {
+    registerDefine(intDefines, name, IntDefinesSeed, defaultValue);
+  }
+}
+
+MaterialDefinesSchema::~MaterialDefinesSchema() = default;
+
+MaterialDefinesSchema& MaterialDefinesSchema::Default()
+{
+  static MaterialDefinesSchema schema;
+  return schema;
+}
+
+size_t MaterialDefinesSchema::boolIndex(std::string_view name)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return registerDefine(boolDefines, name, BoolDefinesSeed, false);
+}
+
+size_t MaterialDefinesSchema::intIndex(std::string_view name)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return registerDefine(intDefines, name, IntDefinesSeed, 0);
+}
+
+int MaterialDefinesSchema::findBoolIndex(std::string_view name) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return findDefine(boolDefines, name);
+}
+
+int MaterialDefinesSchema::findIntIndex(std::string_view name) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return findDefine(intDefines, name);
+}
+
+uint64_t MaterialDefinesSchema::Key(std::string_view name, uint64_t seed)
+{
+  // FNV-1a, independent of the standard library implementation
+  uint64_t hash = 0xcbf29ce484222325ull ^ seed;
+  for (const auto c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+  }
+  return mix(hash);
+}
+
+//--------------------------------------------------------------------------------------------------
+// MaterialBoolDefines
+//--------------------------------------------------------------------------------------------------
+
+MaterialBoolDefines::MaterialBoolDefines(MaterialDefinesSchema& schema)
+{
+  reset(schema);
+}
+
+bool MaterialBoolDefines::operator==(const MaterialBoolDefines& rhs) const
+{
+  if (_hash != rhs._hash || size() != rhs.size()) {
+    return false;
+  }
+
+  if (_schema == rhs._schema) {
+    const auto words = std::max(_values.size(), rhs._values.size());
+    for (size_t word = 0; word < words; ++word) {
+      const auto present    = word < _present.size() ? _present[word] : 0;
+      const auto rhsPresent = word < rhs._present.size() ? rhs._present[word] : 0;
+      const auto values     = word < _values.size() ? _values[word] : 0;
+      const auto rhsValues  = word < rhs._values.size() ? rhs._values[word] : 0;
+      if (present != rhsPresent || values != rhsValues) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool equal = true;
+  forEach([&rhs, &equal](std::string_view name, bool value) {
+    equal = equal && rhs.contains(name) && rhs.at(name) == value;
+  });
+  return equal;
+}
+
+bool MaterialBoolDefines::operator!=(const MaterialBoolDefines& rhs) const
+{
+  return !(operator==(rhs));
+}
+
+MaterialBoolDefines::Reference MaterialBoolDefines::operator[](std::string_view name)
+{
+  return operator[](_schema->boolIndex(name));
+}
+
+MaterialBoolDefines::Reference MaterialBoolDefines::operator[](size_t index)
+{
+  _reserve(index);
+  _present[index >> 6] |= uint64_t(1) << (index & 63);
+  return Reference{*this, index};
+}
+
+void MaterialBoolDefines::reset(MaterialDefinesSchema& schema)
+{
+  const auto& defines = schema.boolDefines;
+  const auto count    = defines.size();
+  const auto words    = (count + 63) >> 6;
+
+  _schema = &schema;
+  _values.assign(words, 0);
+  _present.assign(words, 0);
+  _hash = 0;
+  for (size_t index = 0; index < count; ++index) {
+    _present[index >> 6] |= uint64_t(1) << (index & 63);
+    set(index, defines[index].defaultValue);
+  }
+}
+
+bool MaterialBoolDefines::contains(std::string_view name) const
+{
+  const auto index = _schema->findBoolIndex(name);
+  return index >= 0 && static_cast<size_t>(index >> 6) < _present.size()
+         && ((_present[static_cast<size_t>(index) >> 6] >> (index & 63)) & 1u);
+}
+
+bool MaterialBoolDefines::at(std::string_view name) const
+{
+  if (!contains(name)) {
+    throw std::out_of_range("Unknown define " + std::string{name});
+  }
+  return get(static_cast<size_t>(_schema->findBoolIndex(name)));
+}
+
+size_t MaterialBoolDefines::erase(std::string_view name)
+{
+  if (!contains(name)) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(_schema->findBoolIndex(name));
+  set(index, false);
+  _present[index >> 6] &= ~(uint64_t(1) << (index & 63));
+  return 1;
+}
+
+size_t MaterialBoolDefines::size() const
+{
+  size_t count = 0;
+  for (auto bits : _present) {
+    for (; bits != 0; bits &= bits - 1) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+void MaterialBoolDefines::set(size_t index, bool value)
+{
+  if (get(index) == value) {
+    return;
+  }
+  _reserve(index);
+  _values[index >> 6] ^= uint64_t(1) << (index & 63);
+  _hash ^= _schema->boolDefines[index].key;
+}
+
+void MaterialBoolDefines::_reserve(size_t index)
+{
+  const auto words = (index >> 6) + 1;
+  if (words > _values.size()) {
+    _values.resize(words, 0);
+    _present.resize(words, 0);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// MaterialIntDefines
+//--------------------------------------------------------------------------------------------------
+
+MaterialIntDefines::MaterialIntDefines(MaterialDefinesSchema& schema)
+{
+  reset(schema);
+}
+
+bool MaterialIntDefines::operator==(const MaterialIntDefines& rhs) const
+{
+  if (_hash != rhs._hash || size() != rhs.size()) {
+    return false;
+  }
+
+  if (_schema == rhs._schema) {
+    const auto count = std::max(_values.size(), rhs._values.size());
+    for (size_t index = 0; index < count; ++index) {
+      const auto present    = index < _present.size() && _present[index];
+      const auto rhsPresent = index < rhs._present.size() && rhs._present[index];
+      if (present != rhsPresent || get(index) != rhs.get(index)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool equal = true;
+  forEach([&rhs, &equal](std::string_view name, int value) {
+    equal = equal && rhs.contains(name) && rhs.at(name) == value;
+  });
+  return equal;
+}
+
+bool MaterialIntDefines::operator!=(const MaterialIntDefines& rhs) const
+{
+  return !(operator==(rhs));
+}
+
+MaterialIntDefines::Reference MaterialIntDefines::operator[](std::string_view name)
+{
+  return operator[](_schema->intIndex(name));
+}
+
+MaterialIntDefines::Reference MaterialIntDefines::operator[](size_t index)
+{
+  _reserve(index);
+  if (!_present[index]) {
+    _present[index] = true;
+    _values[index]  = 0;
+    _hash ^= _contribution(index);
+  }
+  return Reference{*this, index};
+}
+
+void MaterialIntDefines::reset(MaterialDefinesSchema& schema)
+{
+  const auto& defines = schema.intDefines;
+  const auto count    = defines.size();
+
+  _schema = &schema;
+  _values.resize(count);
+  _present = std::vector<bool>(count, true);
+  _hash    = 0;
+  for (size_t index = 0; index < count; ++index) {
+    _values[index] = defines[index].defaultValue;
+    _hash ^= _contribution(index);
+  }
+}
+
+bool MaterialIntDefines::contains(std::string_view name) const
+{
+  const auto index = _schema->findIntIndex(name);
+  return index >= 0 && static_cast<size_t>(index) < _present.size()
+         && _present[static_cast<size_t>(index)];
+}
+
+int MaterialIntDefines::at(std::string_view name) const
+{
+  if (!contains(name)) {
+    throw std::out_of_range("Unknown define " + std::string{name});
+  }
+  return _values[static_cast<size_t>(_schema->findIntIndex(name))];
+}
+
+size_t MaterialIntDefines::erase(std::string_view name)
+{
+  if (!contains(name)) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(_schema->findIntIndex(name));
+  _hash ^= _contribution(index);
+  _present[index] = false;
+  _values[index]  = 0;
+  return 1;
+}
+
+size_t MaterialIntDefines::size() const
+{
+  size_t count = 0;
+  for (const auto present : _present) {
+    count += present ? 1 : 0;
+  }
+  return count;
+}
+
+void MaterialIntDefines::set(size_t index, int value)
+{
+  _reserve(index);
+  if (!_present[index]) {
+    _present[index] = true;
+    _values[index]  = value;
+    _hash ^= _contribution(index);
+  }
+  else if (_values[index] != value) {
+    _hash ^= _contribution(index);
+    _values[index] = value;
+    _hash ^= _contribution(index);
+  }
+}
+
+void MaterialIntDefines::_reserve(size_t index)
+{
+  if (index >= _values.size()) {
+    _values.resize(index + 1, 0);
+    _present.resize(index + 1, false);
+  }
+}
+
+uint64_t MaterialIntDefines::_contribution(size_t index) const
+{
+  const auto value = static_cast<uint64_t>(static_cast<uint32_t>(_values[index]));
+  return mix(_schema->intDefines[index].key + value * 0x9e3779b97f4a7c15ull);
+}
+
+} // end of namespace BABYLON
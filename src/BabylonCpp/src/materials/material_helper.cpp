@@ -1,6 +1,7 @@
 #include <babylon/materials/material_helper.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/bakedvertexanimation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -107,9 +108,13 @@ void MaterialHelper::PrepareDefinesForMergedUV(const BaseTexturePtr& texture,
 void MaterialHelper::BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
                                        const std::string& key)
 {
-  auto matrix = *texture.getTextureMatrix();
+  uniformBuffer.updateMatrix(key + "Matrix", *texture.getTextureMatrix());
+}
 
-  uniformBuffer.updateMatrix(key + "Matrix", matrix);
+void MaterialHelper::BindTextureMatrix(BaseTexture& texture, UniformBuffer& uniformBuffer,
+                                       int uniformHandle)
+{
+  uniformBuffer.updateMatrix(uniformHandle, *texture.getTextureMatrix());
 }
 
 bool MaterialHelper::GetFogState(AbstractMesh* mesh, Scene* scene)
@@ -211,7 +216,7 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   if (mesh->useBones() && mesh->computeBonesUsingShaders() && mesh->skeleton()) {
     defines.intDef["NUM_BONE_INFLUENCERS"] = mesh->numBoneInfluencers();
 
-    const auto materialSupportsBoneTexture = stl_util::contains(defines.boolDef, "BONETEXTURE");
+    const auto materialSupportsBoneTexture = defines.boolDef.contains("BONETEXTURE");
 
     if (mesh->skeleton()->isUsingTextureForMatrices && materialSupportsBoneTexture) {
       defines.boolDef["BONETEXTURE"] = true;
@@ -244,6 +249,20 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   }
 }
 
+void MaterialHelper::PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh,
+                                                           MaterialDefines& defines)
+{
+  if (!defines.boolDef.contains("BAKED_VERTEX_ANIMATION_TEXTURE")) {
+    return;
+  }
+
+  const auto renderingMesh = dynamic_cast<Mesh*>(mesh);
+  const auto& manager = renderingMesh ? renderingMesh->bakedVertexAnimationManager() : nullptr;
+  defines.boolDef["BAKED_VERTEX_ANIMATION_TEXTURE"]
+    = manager && manager->isEnabled() && manager->texture()
+      && defines.intDef["NUM_BONE_INFLUENCERS"] > 0;
+}
+
 void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialDefines& defines)
 {
   const auto& manager = static_cast<Mesh*>(mesh)->morphTargetManager();
@@ -306,6 +325,10 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
     PrepareDefinesForMorphTargets(mesh, defines);
   }
 
+  if (useBones) {
+    PrepareDefinesForBakedVertexAnimation(mesh, defines);
+  }
+
   return true;
 }
 
@@ -411,7 +434,7 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
 
   auto lightIndexStr = std::to_string(lightIndex);
 
-  if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+  if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
     state.needRebuild = true;
   }
 
@@ -524,7 +547,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   auto lightIndexStr = std::to_string(lightIndex);
   for (auto index = lightIndex; index < maxSimultaneousLights; ++index) {
     const auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
+    if (defines.boolDef.contains("LIGHT" + indexStr)) {
       defines.boolDef["LIGHT" + indexStr]                  = false;
       defines.boolDef["HEMILIGHT" + indexStr]              = false;
       defines.boolDef["POINTLIGHT" + indexStr]             = false;
@@ -550,7 +573,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains("SHADOWFLOAT")) {
     state.needRebuild = true;
   }
 
@@ -642,10 +665,17 @@ void MaterialHelper::PrepareUniformsAndSamplersList(std::vector<std::string>& un
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
+
+  if (defines["BAKED_VERTEX_ANIMATION_TEXTURE"]) {
+    uniformsList.emplace_back("bakedVertexAnimationSettings");
+    uniformsList.emplace_back("bakedVertexAnimationTextureSizeInverted");
+    uniformsList.emplace_back("bakedVertexAnimationTime");
+    samplersList.emplace_back("bakedVertexAnimationTexture");
+  }
 }
 
 void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& options)
@@ -667,10 +697,17 @@ void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& opti
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
+
+  if (defines["BAKED_VERTEX_ANIMATION_TEXTURE"]) {
+    uniformsList.emplace_back("bakedVertexAnimationSettings");
+    uniformsList.emplace_back("bakedVertexAnimationTextureSizeInverted");
+    uniformsList.emplace_back("bakedVertexAnimationTime");
+    samplersList.emplace_back("bakedVertexAnimationTexture");
+  }
 }
 
 unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
@@ -682,7 +719,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
   for (unsigned int lightIndex = 0; lightIndex < maxSimultaneousLights; ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -782,6 +819,14 @@ void MaterialHelper::PrepareAttributesForBones(std::vector<std::string>& attribs
   }
 }
 
+void MaterialHelper::PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                              MaterialDefines& defines)
+{
+  if (defines["BAKED_VERTEX_ANIMATION_TEXTURE"] && defines["INSTANCES"]) {
+    attribs.emplace_back(BakedVertexAnimationManager::AnimationSettingsInstancedKind);
+  }
+}
+
 void MaterialHelper::PrepareAttributesForInstances(std::vector<std::string>& attribs,
                                                    MaterialDefines& defines)
 {
@@ -904,6 +949,19 @@ Float32Array& MaterialHelper::_CopyBonesTransformationMatrices(const Float32Arra
   return target;
 }
 
+void MaterialHelper::BindBakedVertexAnimationParameters(AbstractMesh* mesh, Effect* effect,
+                                                        MaterialDefines& defines)
+{
+  if (!defines["BAKED_VERTEX_ANIMATION_TEXTURE"]) {
+    return;
+  }
+
+  const auto renderingMesh = dynamic_cast<Mesh*>(mesh);
+  if (renderingMesh && renderingMesh->bakedVertexAnimationManager()) {
+    renderingMesh->bakedVertexAnimationManager()->bind(effect, defines["INSTANCES"]);
+  }
+}
+
 void MaterialHelper::BindMorphTargetParameters(AbstractMesh* abstractMesh, Effect* effect)
 {
   auto mesh = static_cast<Mesh*>(abstractMesh);
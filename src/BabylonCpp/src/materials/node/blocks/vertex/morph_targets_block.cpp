@@ -165,7 +165,7 @@ void MorphTargetsBlock::replaceRepeatableContent(
   const auto& _tangentOutput  = tangentOutput();
   const auto& _uvOutput       = uvOutput();
   auto& _state                = vertexShaderState;
-  auto repeatCount = static_cast<size_t>(std::max(defines.intDef["NUM_MORPH_INFLUENCERS"], 0));
+  auto repeatCount = static_cast<size_t>(std::max<int>(defines.intDef["NUM_MORPH_INFLUENCERS"], 0));
 
   auto& manager    = static_cast<Mesh*>(mesh)->morphTargetManager();
   auto hasNormals  = manager && manager->supportsNormals() && defines["NORMAL"];
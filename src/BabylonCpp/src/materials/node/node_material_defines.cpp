@@ -6,48 +6,51 @@ namespace BABYLON {
 
 NodeMaterialDefines::NodeMaterialDefines() : MaterialDefines{}
 {
-  boolDef = {
-    {"NORMAL", false},  //
-    {"TANGENT", false}, //
-    {"UV1", false},     //
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"NORMAL", false},  //
+      {"TANGENT", false}, //
+      {"UV1", false},     //
 
-    /** BONES */
-    {"BONETEXTURE", false}, //
+      /** BONES */
+      {"BONETEXTURE", false}, //
 
-    /** MORPH TARGETS */
-    {"MORPHTARGETS", false},         //
-    {"MORPHTARGETS_NORMAL", false},  //
-    {"MORPHTARGETS_TANGENT", false}, //
-    {"MORPHTARGETS_UV", false},      //
+      /** MORPH TARGETS */
+      {"MORPHTARGETS", false},         //
+      {"MORPHTARGETS_NORMAL", false},  //
+      {"MORPHTARGETS_TANGENT", false}, //
+      {"MORPHTARGETS_UV", false},      //
 
-    /** IMAGE PROCESSING */
-    {"IMAGEPROCESSING", false},            //
-    {"VIGNETTE", false},                   //
-    {"VIGNETTEBLENDMODEMULTIPLY", false},  //
-    {"VIGNETTEBLENDMODEOPAQUE", false},    //
-    {"TONEMAPPING", false},                //
-    {"TONEMAPPING_ACES", false},           //
-    {"CONTRAST", false},                   //
-    {"EXPOSURE", false},                   //
-    {"COLORCURVES", false},                //
-    {"COLORGRADING", false},               //
-    {"COLORGRADING3D", false},             //
-    {"SAMPLER3DGREENDEPTH", false},        //
-    {"SAMPLER3DBGRMAP", false},            //
-    {"IMAGEPROCESSINGPOSTPROCESS", false}, //
-  };
+      /** IMAGE PROCESSING */
+      {"IMAGEPROCESSING", false},            //
+      {"VIGNETTE", false},                   //
+      {"VIGNETTEBLENDMODEMULTIPLY", false},  //
+      {"VIGNETTEBLENDMODEOPAQUE", false},    //
+      {"TONEMAPPING", false},                //
+      {"TONEMAPPING_ACES", false},           //
+      {"CONTRAST", false},                   //
+      {"EXPOSURE", false},                   //
+      {"COLORCURVES", false},                //
+      {"COLORGRADING", false},               //
+      {"COLORGRADING3D", false},             //
+      {"SAMPLER3DGREENDEPTH", false},        //
+      {"SAMPLER3DBGRMAP", false},            //
+      {"IMAGEPROCESSINGPOSTPROCESS", false}, //
+    },
+    // Numeric defines
+    {
+      /** BONES */
+      {"NUM_BONE_INFLUENCERS", 0}, //
+      {"BonesPerMesh", 0},         //
 
-  intDef = {
-    /** BONES */
-    {"NUM_BONE_INFLUENCERS", 0}, //
-    {"BonesPerMesh", 0},         //
+      /** MORPH TARGETS */
+      {"NUM_MORPH_INFLUENCERS", 0}, //
 
-    /** MORPH TARGETS */
-    {"NUM_MORPH_INFLUENCERS", 0}, //
-
-    /** MISC. */
-    {"BUMPDIRECTUV", 0}, //
-  };
+      /** MISC. */
+      {"BUMPDIRECTUV", 0}, //
+    });
+  _useSchema(schema);
 }
 
 NodeMaterialDefines::~NodeMaterialDefines() = default;
@@ -55,7 +58,7 @@ NodeMaterialDefines::~NodeMaterialDefines() = default;
 void NodeMaterialDefines::setValue(const std::string& name, bool value,
                                    bool markAsUnprocessedIfDirty)
 {
-  if (markAsUnprocessedIfDirty && (!stl_util::contains(boolDef, name) || boolDef[name] != value)) {
+  if (markAsUnprocessedIfDirty && (!boolDef.contains(name) || boolDef[name] != value)) {
     markAsUnprocessed();
   }
 
@@ -6,12 +6,17 @@ namespace BABYLON {
 
 IMaterialAnisotropicDefines::IMaterialAnisotropicDefines()
 {
-  boolDef = {
-    {"ANISOTROPIC", false},                 //
-    {"ANISOTROPIC_TEXTURE", false},         //
-    {"ANISOTROPIC_TEXTUREDIRECTUV", false}, //
-    {"MAINUV1", false},                     //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"ANISOTROPIC", false},                 //
+      {"ANISOTROPIC_TEXTURE", false},         //
+      {"ANISOTROPIC_TEXTUREDIRECTUV", false}, //
+      {"MAINUV1", false},                     //
+    },
+    // Numeric defines
+    {});
+  _useSchema(schema);
 }
 
 IMaterialAnisotropicDefines::~IMaterialAnisotropicDefines() = default;
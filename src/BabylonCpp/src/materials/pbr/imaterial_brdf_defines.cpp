@@ -6,12 +6,17 @@ namespace BABYLON {
 
 IMaterialBRDFDefines::IMaterialBRDFDefines()
 {
-  boolDef = {
-    {"BRDF_V_HEIGHT_CORRELATED", false},                //
-    {"MS_BRDF_ENERGY_CONSERVATION", false},             //
-    {"SPHERICAL_HARMONICS", false},                     //
-    {"SPECULAR_GLOSSINESS_ENERGY_CONSERVATION", false}, //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"BRDF_V_HEIGHT_CORRELATED", false},                //
+      {"MS_BRDF_ENERGY_CONSERVATION", false},             //
+      {"SPHERICAL_HARMONICS", false},                     //
+      {"SPECULAR_GLOSSINESS_ENERGY_CONSERVATION", false}, //
+    },
+    // Numeric defines
+    {});
+  _useSchema(schema);
 }
 
 IMaterialBRDFDefines::~IMaterialBRDFDefines() = default;
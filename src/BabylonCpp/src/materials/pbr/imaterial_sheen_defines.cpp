@@ -6,21 +6,24 @@ namespace BABYLON {
 
 IMaterialSheenDefines::IMaterialSheenDefines()
 {
-  boolDef = {
-    {"SHEEN", false},                                //
-    {"SHEEN_TEXTURE", false},                        //
-    {"SHEEN_TEXTURE_ROUGHNESS", false},              //
-    {"SHEEN_LINKWITHALBEDO", false},                 //
-    {"SHEEN_ROUGHNESS", false},                      //
-    {"SHEEN_ALBEDOSCALING", false},                  //
-    {"SHEEN_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
-    {"SHEEN_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
-  };
-
-  intDef = {
-    {"SHEEN_TEXTUREDIRECTUV", 0},           //
-    {"SHEEN_TEXTURE_ROUGHNESSDIRECTUV", 0}, //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"SHEEN", false},                                //
+      {"SHEEN_TEXTURE", false},                        //
+      {"SHEEN_TEXTURE_ROUGHNESS", false},              //
+      {"SHEEN_LINKWITHALBEDO", false},                 //
+      {"SHEEN_ROUGHNESS", false},                      //
+      {"SHEEN_ALBEDOSCALING", false},                  //
+      {"SHEEN_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
+      {"SHEEN_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
+    },
+    // Numeric defines
+    {
+      {"SHEEN_TEXTUREDIRECTUV", 0},           //
+      {"SHEEN_TEXTURE_ROUGHNESSDIRECTUV", 0}, //
+    });
+  _useSchema(schema);
 }
 
 IMaterialSheenDefines::~IMaterialSheenDefines() = default;
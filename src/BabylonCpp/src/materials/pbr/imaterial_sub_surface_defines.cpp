@@ -6,28 +6,33 @@ namespace BABYLON {
 
 IMaterialSubSurfaceDefines::IMaterialSubSurfaceDefines()
 {
-  boolDef = {
-    {"SUBSURFACE", false}, //
-
-    {"SS_REFRACTION", false},   //
-    {"SS_TRANSLUCENCY", false}, //
-    {"SS_SCATTERING", false},   //
-
-    {"SS_THICKNESSANDMASK_TEXTURE", false},         //
-    {"SS_THICKNESSANDMASK_TEXTUREDIRECTUV", false}, //
-
-    {"SS_REFRACTIONMAP_3D", false},             //
-    {"SS_REFRACTIONMAP_OPPOSITEZ", false},      //
-    {"SS_LODINREFRACTIONALPHA", false},         //
-    {"SS_GAMMAREFRACTION", false},              //
-    {"SS_RGBDREFRACTION", false},               //
-    {"SS_LINEARSPECULARREFRACTION", false},     //
-    {"SS_LINKREFRACTIONTOTRANSPARENCY", false}, //
-    {"SS_ALBEDOFORREFRACTIONTINT", false},      //
-
-    {"SS_MASK_FROM_THICKNESS_TEXTURE", false},      //
-    {"SS_MASK_FROM_THICKNESS_TEXTURE_GLTF", false}, //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"SUBSURFACE", false}, //
+
+      {"SS_REFRACTION", false},   //
+      {"SS_TRANSLUCENCY", false}, //
+      {"SS_SCATTERING", false},   //
+
+      {"SS_THICKNESSANDMASK_TEXTURE", false},         //
+      {"SS_THICKNESSANDMASK_TEXTUREDIRECTUV", false}, //
+
+      {"SS_REFRACTIONMAP_3D", false},             //
+      {"SS_REFRACTIONMAP_OPPOSITEZ", false},      //
+      {"SS_LODINREFRACTIONALPHA", false},         //
+      {"SS_GAMMAREFRACTION", false},              //
+      {"SS_RGBDREFRACTION", false},               //
+      {"SS_LINEARSPECULARREFRACTION", false},     //
+      {"SS_LINKREFRACTIONTOTRANSPARENCY", false}, //
+      {"SS_ALBEDOFORREFRACTIONTINT", false},      //
+
+      {"SS_MASK_FROM_THICKNESS_TEXTURE", false},      //
+      {"SS_MASK_FROM_THICKNESS_TEXTURE_GLTF", false}, //
+    },
+    // Numeric defines
+    {});
+  _useSchema(schema);
 }
 
 IMaterialSubSurfaceDefines::~IMaterialSubSurfaceDefines() = default;
@@ -43,6 +43,12 @@
 
 namespace BABYLON {
 
+namespace {
+
+using DefineIndex = PBRMaterialDefines::Index;
+
+} // end of anonymous namespace
+
 PBRBaseMaterial::PBRBaseMaterial(const std::string& iName, Scene* scene)
     : PushMaterial{iName, scene}
     , realTimeFiltering{this, &PBRBaseMaterial::get_realTimeFiltering,
@@ -135,6 +141,7 @@ PBRBaseMaterial::PBRBaseMaterial(const std::string& iName, Scene* scene)
     , _debugMode{0}
     , debugLimit{-1.f}
     , debugFactor{1.f}
+    , _effectHandlesId{std::nullopt}
 {
   // Setup the default processing configuration to the scene.
   _attachImageProcessingConfiguration(nullptr);
@@ -501,26 +508,26 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   // Fallbacks
   auto fallbacks    = std::make_unique<EffectFallbacks>();
   auto fallbackRank = 0u;
-  if (defines["USESPHERICALINVERTEX"]) {
+  if (defines[DefineIndex::USESPHERICALINVERTEX]) {
     fallbacks->addFallback(fallbackRank++, "USESPHERICALINVERTEX");
   }
 
-  if (defines["FOG"]) {
+  if (defines[DefineIndex::FOG]) {
     fallbacks->addFallback(fallbackRank, "FOG");
   }
-  if (defines["SPECULARAA"]) {
+  if (defines[DefineIndex::SPECULARAA]) {
     fallbacks->addFallback(fallbackRank, "SPECULARAA");
   }
-  if (defines["POINTSIZE"]) {
+  if (defines[DefineIndex::POINTSIZE]) {
     fallbacks->addFallback(fallbackRank, "POINTSIZE");
   }
-  if (defines["LOGARITHMICDEPTH"]) {
+  if (defines[DefineIndex::LOGARITHMICDEPTH]) {
     fallbacks->addFallback(fallbackRank, "LOGARITHMICDEPTH");
   }
-  if (defines["PARALLAX"]) {
+  if (defines[DefineIndex::PARALLAX]) {
     fallbacks->addFallback(fallbackRank, "PARALLAX");
   }
-  if (defines["PARALLAXOCCLUSION"]) {
+  if (defines[DefineIndex::PARALLAXOCCLUSION]) {
     fallbacks->addFallback(fallbackRank++, "PARALLAXOCCLUSION");
   }
 
@@ -529,86 +536,87 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   fallbackRank = PBRSubSurfaceConfiguration::AddFallbacks(defines, *fallbacks, fallbackRank);
   fallbackRank = PBRSheenConfiguration::AddFallbacks(defines, *fallbacks, fallbackRank);
 
-  if (defines["ENVIRONMENTBRDF"]) {
+  if (defines[DefineIndex::ENVIRONMENTBRDF]) {
     fallbacks->addFallback(fallbackRank++, "ENVIRONMENTBRDF");
   }
 
-  if (defines["TANGENT"]) {
+  if (defines[DefineIndex::TANGENT]) {
     fallbacks->addFallback(fallbackRank++, "TANGENT");
   }
 
-  if (defines["BUMP"]) {
+  if (defines[DefineIndex::BUMP]) {
     fallbacks->addFallback(fallbackRank++, "BUMP");
   }
 
   fallbackRank = MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks,
                                                            _maxSimultaneousLights, fallbackRank++);
 
-  if (defines["SPECULARTERM"]) {
+  if (defines[DefineIndex::SPECULARTERM]) {
     fallbacks->addFallback(fallbackRank++, "SPECULARTERM");
   }
 
-  if (defines["USESPHERICALFROMREFLECTIONMAP"]) {
+  if (defines[DefineIndex::USESPHERICALFROMREFLECTIONMAP]) {
     fallbacks->addFallback(fallbackRank++, "USESPHERICALFROMREFLECTIONMAP");
   }
 
-  if (defines["USEIRRADIANCEMAP"]) {
+  if (defines[DefineIndex::USEIRRADIANCEMAP]) {
     fallbacks->addFallback(fallbackRank++, "USEIRRADIANCEMAP");
   }
 
-  if (defines["LIGHTMAP"]) {
+  if (defines[DefineIndex::LIGHTMAP]) {
     fallbacks->addFallback(fallbackRank++, "LIGHTMAP");
   }
 
-  if (defines["NORMAL"]) {
+  if (defines[DefineIndex::NORMAL]) {
     fallbacks->addFallback(fallbackRank++, "NORMAL");
   }
 
-  if (defines["AMBIENT"]) {
+  if (defines[DefineIndex::AMBIENT]) {
     fallbacks->addFallback(fallbackRank++, "AMBIENT");
   }
 
-  if (defines["EMISSIVE"]) {
+  if (defines[DefineIndex::EMISSIVE]) {
     fallbacks->addFallback(fallbackRank++, "EMISSIVE");
   }
 
-  if (defines["VERTEXCOLOR"]) {
+  if (defines[DefineIndex::VERTEXCOLOR]) {
     fallbacks->addFallback(fallbackRank++, "VERTEXCOLOR");
   }
 
-  if (defines["MORPHTARGETS"]) {
+  if (defines[DefineIndex::MORPHTARGETS]) {
     fallbacks->addFallback(fallbackRank++, "MORPHTARGETS");
   }
 
-  if (defines["MULTIVIEW"]) {
+  if (defines[DefineIndex::MULTIVIEW]) {
     fallbacks->addFallback(0, "MULTIVIEW");
   }
 
   // Attributes
   std::vector<std::string> attribs{VertexBuffer::PositionKind};
 
-  if (defines["NORMAL"]) {
+  if (defines[DefineIndex::NORMAL]) {
     attribs.emplace_back(VertexBuffer::NormalKind);
   }
 
-  if (defines["TANGENT"]) {
+  if (defines[DefineIndex::TANGENT]) {
     attribs.emplace_back(VertexBuffer::TangentKind);
   }
 
-  if (defines["UV1"]) {
+  if (defines[DefineIndex::UV1]) {
     attribs.emplace_back(VertexBuffer::UVKind);
   }
 
-  if (defines["UV2"]) {
+  if (defines[DefineIndex::UV2]) {
     attribs.emplace_back(VertexBuffer::UV2Kind);
   }
 
-  if (defines["VERTEXCOLOR"]) {
+  if (defines[DefineIndex::VERTEXCOLOR]) {
     attribs.emplace_back(VertexBuffer::ColorKind);
   }
 
   MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
   MaterialHelper::PrepareAttributesForInstances(attribs, defines);
+  MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
   MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
 
   std::string shaderName = "pbr";
@@ -719,7 +727,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
 
   std::unordered_map<std::string, unsigned int> indexParameters{
     {"maxSimultaneousLights", _maxSimultaneousLights},
-    {"maxSimultaneousMorphTargets", defines.intDef["NUM_MORPH_INFLUENCERS"]}};
+    {"maxSimultaneousMorphTargets", defines.intDef[DefineIndex::NUM_MORPH_INFLUENCERS]}};
 
   ICustomShaderNameResolveOptions csnrOptions{};
 
@@ -743,7 +751,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   options.indexParameters       = std::move(indexParameters);
   options.processFinalCode      = csnrOptions.processFinalCode;
   options.maxSimultaneousLights = _maxSimultaneousLights;
-  options.multiTarget           = defines["PREPASS"];
+  options.multiTarget           = defines[DefineIndex::PREPASS];
 
   MaterialHelper::PrepareUniformsAndSamplersList(options);
 
@@ -770,186 +778,191 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
   MaterialHelper::PrepareDefinesForPrePass(scene, defines, canRenderToMRT());
 
   // Textures
-  defines.boolDef["METALLICWORKFLOW"] = isMetallicWorkflow();
+  defines.boolDef[DefineIndex::METALLICWORKFLOW] = isMetallicWorkflow();
   if (defines._areTexturesDirty) {
     defines._needUVs = false;
     if (scene->texturesEnabled()) {
       if (scene->getEngine()->getCaps().textureLOD) {
-        defines.boolDef["LODBASEDMICROSFURACE"] = true;
+        defines.boolDef[DefineIndex::LODBASEDMICROSFURACE] = true;
       }
 
       if (_albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_albedoTexture, defines, "ALBEDO");
-        defines.boolDef["GAMMAALBEDO"] = _albedoTexture->gammaSpace();
+        defines.boolDef[DefineIndex::GAMMAALBEDO] = _albedoTexture->gammaSpace();
       }
       else {
-        defines.boolDef["ALBEDO"] = false;
+        defines.boolDef[DefineIndex::ALBEDO] = false;
       }
 
       if (_ambientTexture && MaterialFlags::AmbientTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_ambientTexture, defines, "AMBIENT");
-        defines.boolDef["AMBIENTINGRAYSCALE"] = _useAmbientInGrayScale;
+        defines.boolDef[DefineIndex::AMBIENTINGRAYSCALE] = _useAmbientInGrayScale;
       }
       else {
-        defines.boolDef["AMBIENT"] = false;
+        defines.boolDef[DefineIndex::AMBIENT] = false;
       }
 
       if (_opacityTexture && MaterialFlags::OpacityTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_opacityTexture, defines, "OPACITY");
-        defines.boolDef["OPACITYRGB"] = _opacityTexture->getAlphaFromRGB;
+        defines.boolDef[DefineIndex::OPACITYRGB] = _opacityTexture->getAlphaFromRGB;
       }
       else {
-        defines.boolDef["OPACITY"] = false;
+        defines.boolDef[DefineIndex::OPACITY] = false;
       }
 
       auto reflectionTexture = _getReflectionTexture();
       if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        defines.boolDef["REFLECTION"]              = true;
-        defines.boolDef["GAMMAREFLECTION"]         = reflectionTexture->gammaSpace;
-        defines.boolDef["RGBDREFLECTION"]          = reflectionTexture->isRGBD;
-        defines.boolDef["REFLECTIONMAP_OPPOSITEZ"] = getScene()->useRightHandedSystem() ?
-                                                       !reflectionTexture->invertZ :
-                                                       reflectionTexture->invertZ;
-        defines.boolDef["LODINREFLECTIONALPHA"]     = reflectionTexture->lodLevelInAlpha;
-        defines.boolDef["LINEARSPECULARREFLECTION"] = reflectionTexture->linearSpecularLOD();
+        defines.boolDef[DefineIndex::REFLECTION]      = true;
+        defines.boolDef[DefineIndex::GAMMAREFLECTION] = reflectionTexture->gammaSpace;
+        defines.boolDef[DefineIndex::RGBDREFLECTION]  = reflectionTexture->isRGBD;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_OPPOSITEZ]
+          = getScene()->useRightHandedSystem() ? !reflectionTexture->invertZ :
+                                                 reflectionTexture->invertZ;
+        defines.boolDef[DefineIndex::LODINREFLECTIONALPHA] = reflectionTexture->lodLevelInAlpha;
+        defines.boolDef[DefineIndex::LINEARSPECULARREFLECTION]
+          = reflectionTexture->linearSpecularLOD();
 
         if (realTimeFiltering && realTimeFilteringQuality() > 0) {
-          defines.intDef["NUM_SAMPLES"] = realTimeFilteringQuality;
+          defines.intDef[DefineIndex::NUM_SAMPLES] = realTimeFilteringQuality;
           if (engine->webGLVersion > 1.f) {
-            defines.intDef["NUM_SAMPLES"] = defines.intDef["NUM_SAMPLES"];
+            defines.intDef[DefineIndex::NUM_SAMPLES] = defines.intDef[DefineIndex::NUM_SAMPLES];
           }
-          defines.boolDef["REALTIME_FILTERING"] = true;
+          defines.boolDef[DefineIndex::REALTIME_FILTERING] = true;
         }
         else {
-          defines.boolDef["REALTIME_FILTERING"] = false;
+          defines.boolDef[DefineIndex::REALTIME_FILTERING] = false;
         }
 
         if (reflectionTexture->coordinatesMode() == TextureConstants::INVCUBIC_MODE) {
-          defines.boolDef["INVERTCUBICMAP"] = true;
+          defines.boolDef[DefineIndex::INVERTCUBICMAP] = true;
         }
 
-        defines.boolDef["REFLECTIONMAP_3D"] = reflectionTexture->isCube();
+        defines.boolDef[DefineIndex::REFLECTIONMAP_3D] = reflectionTexture->isCube();
 
-        defines.boolDef["REFLECTIONMAP_CUBIC"]                         = false;
-        defines.boolDef["REFLECTIONMAP_EXPLICIT"]                      = false;
-        defines.boolDef["REFLECTIONMAP_PLANAR"]                        = false;
-        defines.boolDef["REFLECTIONMAP_PROJECTION"]                    = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_SPHERICAL"]                     = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"]               = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"]         = false;
-        defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_CUBIC]                         = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EXPLICIT]                      = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_PLANAR]                        = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_PROJECTION]                    = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_SKYBOX]                        = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_SPHERICAL]                     = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR]               = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR_FIXED]         = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = false;
 
         switch (reflectionTexture->coordinatesMode()) {
           case TextureConstants::EXPLICIT_MODE:
-            defines.boolDef["REFLECTIONMAP_EXPLICIT"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_EXPLICIT] = true;
             break;
           case TextureConstants::PLANAR_MODE:
-            defines.boolDef["REFLECTIONMAP_PLANAR"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_PLANAR] = true;
             break;
           case TextureConstants::PROJECTION_MODE:
-            defines.boolDef["REFLECTIONMAP_PROJECTION"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_PROJECTION] = true;
             break;
           case TextureConstants::SKYBOX_MODE:
-            defines.boolDef["REFLECTIONMAP_SKYBOX"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_SKYBOX] = true;
             break;
           case TextureConstants::SPHERICAL_MODE:
-            defines.boolDef["REFLECTIONMAP_SPHERICAL"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_SPHERICAL] = true;
             break;
           case TextureConstants::EQUIRECTANGULAR_MODE:
-            defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR] = true;
             break;
           case TextureConstants::FIXED_EQUIRECTANGULAR_MODE:
-            defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR_FIXED] = true;
             break;
           case TextureConstants::FIXED_EQUIRECTANGULAR_MIRRORED_MODE:
-            defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = true;
+            defines.boolDef[DefineIndex::REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = true;
             break;
           case TextureConstants::CUBIC_MODE:
           case TextureConstants::INVCUBIC_MODE:
-            defines.boolDef["REFLECTIONMAP_CUBIC"] = true;
-            defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]
+            defines.boolDef[DefineIndex::REFLECTIONMAP_CUBIC] = true;
+            defines.boolDef[DefineIndex::USE_LOCAL_REFLECTIONMAP_CUBIC]
               = static_cast<bool>(reflectionTexture->boundingBoxSize());
             break;
         }
 
         if (reflectionTexture->coordinatesMode() != TextureConstants::SKYBOX_MODE) {
           if (reflectionTexture->irradianceTexture()) {
-            defines.boolDef["USEIRRADIANCEMAP"]              = true;
-            defines.boolDef["USESPHERICALFROMREFLECTIONMAP"] = false;
+            defines.boolDef[DefineIndex::USEIRRADIANCEMAP]              = true;
+            defines.boolDef[DefineIndex::USESPHERICALFROMREFLECTIONMAP] = false;
           }
           // Assume using spherical polynomial if the reflection texture is a cube map
           else if (reflectionTexture->isCube()) {
-            defines.boolDef["USESPHERICALFROMREFLECTIONMAP"] = true;
-            defines.boolDef["USEIRRADIANCEMAP"]              = false;
+            defines.boolDef[DefineIndex::USESPHERICALFROMREFLECTIONMAP] = true;
+            defines.boolDef[DefineIndex::USEIRRADIANCEMAP]              = false;
             if (_forceIrradianceInFragment || realTimeFiltering
                 || scene->getEngine()->getCaps().maxVaryingVectors <= 8) {
-              defines.boolDef["USESPHERICALINVERTEX"] = false;
+              defines.boolDef[DefineIndex::USESPHERICALINVERTEX] = false;
             }
             else {
-              defines.boolDef["USESPHERICALINVERTEX"] = true;
+              defines.boolDef[DefineIndex::USESPHERICALINVERTEX] = true;
             }
           }
         }
       }
       else {
-        defines.boolDef["REFLECTION"]                                  = false;
-        defines.boolDef["REFLECTIONMAP_3D"]                            = false;
-        defines.boolDef["REFLECTIONMAP_SPHERICAL"]                     = false;
-        defines.boolDef["REFLECTIONMAP_PLANAR"]                        = false;
-        defines.boolDef["REFLECTIONMAP_CUBIC"]                         = false;
-        defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]               = false;
-        defines.boolDef["REFLECTIONMAP_PROJECTION"]                    = false;
-        defines.boolDef["REFLECTIONMAP_SKYBOX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_EXPLICIT"]                      = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR"]               = false;
-        defines.boolDef["REFLECTIONMAP_EQUIRECTANGULAR_FIXED"]         = false;
-        defines.boolDef["REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED"] = false;
-        defines.boolDef["INVERTCUBICMAP"]                              = false;
-        defines.boolDef["USESPHERICALFROMREFLECTIONMAP"]               = false;
-        defines.boolDef["USEIRRADIANCEMAP"]                            = false;
-        defines.boolDef["USESPHERICALINVERTEX"]                        = false;
-        defines.boolDef["REFLECTIONMAP_OPPOSITEZ"]                     = false;
-        defines.boolDef["LODINREFLECTIONALPHA"]                        = false;
-        defines.boolDef["GAMMAREFLECTION"]                             = false;
-        defines.boolDef["RGBDREFLECTION"]                              = false;
-        defines.boolDef["LINEARSPECULARREFLECTION"]                    = false;
+        defines.boolDef[DefineIndex::REFLECTION]                                  = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_3D]                            = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_SPHERICAL]                     = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_PLANAR]                        = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_CUBIC]                         = false;
+        defines.boolDef[DefineIndex::USE_LOCAL_REFLECTIONMAP_CUBIC]               = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_PROJECTION]                    = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_SKYBOX]                        = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EXPLICIT]                      = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR]               = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_EQUIRECTANGULAR_FIXED]         = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED] = false;
+        defines.boolDef[DefineIndex::INVERTCUBICMAP]                              = false;
+        defines.boolDef[DefineIndex::USESPHERICALFROMREFLECTIONMAP]               = false;
+        defines.boolDef[DefineIndex::USEIRRADIANCEMAP]                            = false;
+        defines.boolDef[DefineIndex::USESPHERICALINVERTEX]                        = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_OPPOSITEZ]                     = false;
+        defines.boolDef[DefineIndex::LODINREFLECTIONALPHA]                        = false;
+        defines.boolDef[DefineIndex::GAMMAREFLECTION]                             = false;
+        defines.boolDef[DefineIndex::RGBDREFLECTION]                              = false;
+        defines.boolDef[DefineIndex::LINEARSPECULARREFLECTION]                    = false;
       }
 
       if (_lightmapTexture && MaterialFlags::LightmapTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_lightmapTexture, defines, "LIGHTMAP");
-        defines.boolDef["USELIGHTMAPASSHADOWMAP"] = _useLightmapAsShadowmap;
-        defines.boolDef["GAMMALIGHTMAP"]          = _lightmapTexture->gammaSpace;
-        defines.boolDef["RGBDLIGHTMAP"]           = _lightmapTexture->isRGBD();
+        defines.boolDef[DefineIndex::USELIGHTMAPASSHADOWMAP] = _useLightmapAsShadowmap;
+        defines.boolDef[DefineIndex::GAMMALIGHTMAP]          = _lightmapTexture->gammaSpace;
+        defines.boolDef[DefineIndex::RGBDLIGHTMAP]           = _lightmapTexture->isRGBD();
       }
       else {
-        defines.boolDef["LIGHTMAP"] = false;
+        defines.boolDef[DefineIndex::LIGHTMAP] = false;
       }
 
       if (_emissiveTexture && MaterialFlags::EmissiveTextureEnabled()) {
         MaterialHelper::PrepareDefinesForMergedUV(_emissiveTexture, defines, "EMISSIVE");
       }
       else {
-        defines.boolDef["EMISSIVE"] = false;
+        defines.boolDef[DefineIndex::EMISSIVE] = false;
       }
 
       if (MaterialFlags::SpecularTextureEnabled()) {
         if (_metallicTexture) {
           MaterialHelper::PrepareDefinesForMergedUV(_metallicTexture, defines, "REFLECTIVITY");
-          defines.boolDef["ROUGHNESSSTOREINMETALMAPALPHA"] = _useRoughnessFromMetallicTextureAlpha;
-          defines.boolDef["ROUGHNESSSTOREINMETALMAPGREEN"]
+          defines.boolDef[DefineIndex::ROUGHNESSSTOREINMETALMAPALPHA]
+            = _useRoughnessFromMetallicTextureAlpha;
+          defines.boolDef[DefineIndex::ROUGHNESSSTOREINMETALMAPGREEN]
             = !_useRoughnessFromMetallicTextureAlpha && _useRoughnessFromMetallicTextureGreen;
-          defines.boolDef["METALLNESSSTOREINMETALMAPBLUE"] = _useMetallnessFromMetallicTextureBlue;
-          defines.boolDef["AOSTOREINMETALMAPRED"] = _useAmbientOcclusionFromMetallicTextureRed;
+          defines.boolDef[DefineIndex::METALLNESSSTOREINMETALMAPBLUE]
+            = _useMetallnessFromMetallicTextureBlue;
+          defines.boolDef[DefineIndex::AOSTOREINMETALMAPRED]
+            = _useAmbientOcclusionFromMetallicTextureRed;
         }
         else if (_reflectivityTexture) {
           MaterialHelper::PrepareDefinesForMergedUV(_reflectivityTexture, defines, "REFLECTIVITY");
-          defines.boolDef["MICROSURFACEFROMREFLECTIVITYMAP"]
+          defines.boolDef[DefineIndex::MICROSURFACEFROMREFLECTIVITYMAP]
             = _useMicroSurfaceFromReflectivityMapAlpha;
-          defines.boolDef["MICROSURFACEAUTOMATIC"] = _useAutoMicroSurfaceFromReflectivityMap;
+          defines.boolDef[DefineIndex::MICROSURFACEAUTOMATIC]
+            = _useAutoMicroSurfaceFromReflectivityMap;
         }
         else {
-          defines.boolDef["REFLECTIVITY"] = false;
+          defines.boolDef[DefineIndex::REFLECTIVITY] = false;
         }
 
         if (_metallicReflectanceTexture) {
@@ -957,7 +970,7 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
                                                     "METALLIC_REFLECTANCE");
         }
         else {
-          defines.boolDef["METALLIC_REFLECTANCE"] = false;
+          defines.boolDef[DefineIndex::METALLIC_REFLECTANCE] = false;
         }
 
         if (_microSurfaceTexture) {
@@ -965,12 +978,12 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
                                                     "MICROSURFACEMAP");
         }
         else {
-          defines.boolDef["MICROSURFACEMAP"] = false;
+          defines.boolDef[DefineIndex::MICROSURFACEMAP] = false;
         }
       }
       else {
-        defines.boolDef["REFLECTIVITY"]    = false;
-        defines.boolDef["MICROSURFACEMAP"] = false;
+        defines.boolDef[DefineIndex::REFLECTIVITY]    = false;
+        defines.boolDef[DefineIndex::MICROSURFACEMAP] = false;
       }
 
       if (scene->getEngine()->getCaps().standardDerivatives && _bumpTexture
@@ -978,94 +991,94 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
         MaterialHelper::PrepareDefinesForMergedUV(_bumpTexture, defines, "BUMP");
 
         if (_useParallax && _albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
-          defines.boolDef["PARALLAX"]          = true;
-          defines.boolDef["PARALLAXOCCLUSION"] = !!_useParallaxOcclusion;
+          defines.boolDef[DefineIndex::PARALLAX]          = true;
+          defines.boolDef[DefineIndex::PARALLAXOCCLUSION] = !!_useParallaxOcclusion;
         }
         else {
-          defines.boolDef["PARALLAX"] = false;
+          defines.boolDef[DefineIndex::PARALLAX] = false;
         }
-        defines.boolDef["OBJECTSPACE_NORMALMAP"] = _useObjectSpaceNormalMap;
+        defines.boolDef[DefineIndex::OBJECTSPACE_NORMALMAP] = _useObjectSpaceNormalMap;
       }
       else {
-        defines.boolDef["BUMP"] = false;
+        defines.boolDef[DefineIndex::BUMP] = false;
       }
 
       if (_environmentBRDFTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        defines.boolDef["ENVIRONMENTBRDF"] = true;
+        defines.boolDef[DefineIndex::ENVIRONMENTBRDF] = true;
         // Not actual true RGBD, only the B chanel is encoded as RGBD for sheen.
-        defines.boolDef["ENVIRONMENTBRDF_RGBD"] = _environmentBRDFTexture->isRGBD();
+        defines.boolDef[DefineIndex::ENVIRONMENTBRDF_RGBD] = _environmentBRDFTexture->isRGBD();
       }
       else {
-        defines.boolDef["ENVIRONMENTBRDF"]      = false;
-        defines.boolDef["ENVIRONMENTBRDF_RGBD"] = false;
+        defines.boolDef[DefineIndex::ENVIRONMENTBRDF]      = false;
+        defines.boolDef[DefineIndex::ENVIRONMENTBRDF_RGBD] = false;
       }
 
       if (_shouldUseAlphaFromAlbedoTexture()) {
-        defines.boolDef["ALPHAFROMALBEDO"] = true;
+        defines.boolDef[DefineIndex::ALPHAFROMALBEDO] = true;
       }
       else {
-        defines.boolDef["ALPHAFROMALBEDO"] = false;
+        defines.boolDef[DefineIndex::ALPHAFROMALBEDO] = false;
       }
     }
 
-    defines.boolDef["SPECULAROVERALPHA"] = _useSpecularOverAlpha;
+    defines.boolDef[DefineIndex::SPECULAROVERALPHA] = _useSpecularOverAlpha;
 
     if (_lightFalloff == PBRBaseMaterial::LIGHTFALLOFF_STANDARD) {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = false;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = false;
+      defines.boolDef[DefineIndex::USEPHYSICALLIGHTFALLOFF] = false;
+      defines.boolDef[DefineIndex::USEGLTFLIGHTFALLOFF]     = false;
     }
     else if (_lightFalloff == PBRBaseMaterial::LIGHTFALLOFF_GLTF) {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = false;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = true;
+      defines.boolDef[DefineIndex::USEPHYSICALLIGHTFALLOFF] = false;
+      defines.boolDef[DefineIndex::USEGLTFLIGHTFALLOFF]     = true;
     }
     else {
-      defines.boolDef["USEPHYSICALLIGHTFALLOFF"] = true;
-      defines.boolDef["USEGLTFLIGHTFALLOFF"]     = false;
+      defines.boolDef[DefineIndex::USEPHYSICALLIGHTFALLOFF] = true;
+      defines.boolDef[DefineIndex::USEGLTFLIGHTFALLOFF]     = false;
     }
 
-    defines.boolDef["RADIANCEOVERALPHA"] = _useRadianceOverAlpha;
+    defines.boolDef[DefineIndex::RADIANCEOVERALPHA] = _useRadianceOverAlpha;
 
     if (!backFaceCulling() && _twoSidedLighting) {
-      defines.boolDef["TWOSIDEDLIGHTING"] = true;
+      defines.boolDef[DefineIndex::TWOSIDEDLIGHTING] = true;
     }
     else {
-      defines.boolDef["TWOSIDEDLIGHTING"] = false;
+      defines.boolDef[DefineIndex::TWOSIDEDLIGHTING] = false;
     }
 
-    defines.boolDef["SPECULARAA"]
+    defines.boolDef[DefineIndex::SPECULARAA]
       = scene->getEngine()->getCaps().standardDerivatives && _enableSpecularAntiAliasing;
   }
 
   if (defines._areTexturesDirty || defines._areMiscDirty) {
     defines.stringDef["ALPHATESTVALUE"]
       = std::to_string(_alphaCutOff) + (std::fmod(_alphaCutOff, 1.f) == 0.f ? "." : "");
-    defines.boolDef["PREMULTIPLYALPHA"]
+    defines.boolDef[DefineIndex::PREMULTIPLYALPHA]
       = (alphaMode() == Constants::ALPHA_PREMULTIPLIED
          || alphaMode() == Constants::ALPHA_PREMULTIPLIED_PORTERDUFF);
-    defines.boolDef["ALPHABLEND"]         = needAlphaBlendingForMesh(*mesh);
-    defines.boolDef["ALPHAFRESNEL"]       = _useAlphaFresnel || _useLinearAlphaFresnel;
-    defines.boolDef["LINEARALPHAFRESNEL"] = _useLinearAlphaFresnel;
+    defines.boolDef[DefineIndex::ALPHABLEND]         = needAlphaBlendingForMesh(*mesh);
+    defines.boolDef[DefineIndex::ALPHAFRESNEL]       = _useAlphaFresnel || _useLinearAlphaFresnel;
+    defines.boolDef[DefineIndex::LINEARALPHAFRESNEL] = _useLinearAlphaFresnel;
   }
 
   if (defines._areImageProcessingDirty && _imageProcessingConfiguration) {
     _imageProcessingConfiguration->prepareDefines(defines);
   }
 
-  defines.boolDef["FORCENORMALFORWARD"] = _forceNormalForward;
+  defines.boolDef[DefineIndex::FORCENORMALFORWARD] = _forceNormalForward;
 
-  defines.boolDef["RADIANCEOCCLUSION"] = _useRadianceOcclusion;
+  defines.boolDef[DefineIndex::RADIANCEOCCLUSION] = _useRadianceOcclusion;
 
-  defines.boolDef["HORIZONOCCLUSION"] = _useHorizonOcclusion;
+  defines.boolDef[DefineIndex::HORIZONOCCLUSION] = _useHorizonOcclusion;
 
   // Misc.
   if (defines._areMiscDirty) {
     MaterialHelper::PrepareDefinesForMisc(mesh, scene, _useLogarithmicDepth, pointsCloud(),
                                           fogEnabled(),
                                           _shouldTurnAlphaTestOn(mesh) || _forceAlphaTest, defines);
-    defines.boolDef["UNLIT"] = _unlit
+    defines.boolDef[DefineIndex::UNLIT] = _unlit
                                || ((pointsCloud() || wireframe())
                                    && !mesh->isVerticesDataPresent(VertexBuffer::NormalKind));
-    defines.intDef["DEBUGMODE"] = static_cast<unsigned>(_debugMode);
+    defines.intDef[DefineIndex::DEBUGMODE] = static_cast<unsigned>(_debugMode);
   }
 
   // External config
@@ -1117,41 +1130,42 @@ void PBRBaseMaterial::buildUniformLayout()
 {
   // Order is important !
   auto& ubo = *_uniformBuffer;
-  ubo.addUniform("vAlbedoInfos", 2);
-  ubo.addUniform("vAmbientInfos", 4);
-  ubo.addUniform("vOpacityInfos", 2);
-  ubo.addUniform("vEmissiveInfos", 2);
-  ubo.addUniform("vLightmapInfos", 2);
-  ubo.addUniform("vReflectivityInfos", 3);
-  ubo.addUniform("vMicroSurfaceSamplerInfos", 2);
-  ubo.addUniform("vReflectionInfos", 2);
-  ubo.addUniform("vReflectionFilteringInfo", 2);
-  ubo.addUniform("vReflectionPosition", 3);
-  ubo.addUniform("vReflectionSize", 3);
-  ubo.addUniform("vBumpInfos", 3);
-  ubo.addUniform("albedoMatrix", 16);
-  ubo.addUniform("ambientMatrix", 16);
-  ubo.addUniform("opacityMatrix", 16);
-  ubo.addUniform("emissiveMatrix", 16);
-  ubo.addUniform("lightmapMatrix", 16);
-  ubo.addUniform("reflectivityMatrix", 16);
-  ubo.addUniform("microSurfaceSamplerMatrix", 16);
-  ubo.addUniform("bumpMatrix", 16);
-  ubo.addUniform("vTangentSpaceParams", 2);
-  ubo.addUniform("reflectionMatrix", 16);
-
-  ubo.addUniform("vReflectionColor", 3);
-  ubo.addUniform("vAlbedoColor", 4);
-  ubo.addUniform("vLightingIntensity", 4);
-
-  ubo.addUniform("vReflectionMicrosurfaceInfos", 3);
-  ubo.addUniform("pointSize", 1);
-  ubo.addUniform("vReflectivityColor", 4);
-  ubo.addUniform("vEmissiveColor", 3);
-  ubo.addUniform("visibility", 1);
-  ubo.addUniform("vMetallicReflectanceFactors", 4);
-  ubo.addUniform("vMetallicReflectanceInfos", 2);
-  ubo.addUniform("metallicReflectanceMatrix", 16);
+
+  _uboHandles.vAlbedoInfos              = ubo.addUniform("vAlbedoInfos", 2);
+  _uboHandles.vAmbientInfos             = ubo.addUniform("vAmbientInfos", 4);
+  _uboHandles.vOpacityInfos             = ubo.addUniform("vOpacityInfos", 2);
+  _uboHandles.vEmissiveInfos            = ubo.addUniform("vEmissiveInfos", 2);
+  _uboHandles.vLightmapInfos            = ubo.addUniform("vLightmapInfos", 2);
+  _uboHandles.vReflectivityInfos        = ubo.addUniform("vReflectivityInfos", 3);
+  _uboHandles.vMicroSurfaceSamplerInfos = ubo.addUniform("vMicroSurfaceSamplerInfos", 2);
+  _uboHandles.vReflectionInfos          = ubo.addUniform("vReflectionInfos", 2);
+  _uboHandles.vReflectionFilteringInfo  = ubo.addUniform("vReflectionFilteringInfo", 2);
+  _uboHandles.vReflectionPosition       = ubo.addUniform("vReflectionPosition", 3);
+  _uboHandles.vReflectionSize           = ubo.addUniform("vReflectionSize", 3);
+  _uboHandles.vBumpInfos                = ubo.addUniform("vBumpInfos", 3);
+  _uboHandles.albedoMatrix              = ubo.addUniform("albedoMatrix", 16);
+  _uboHandles.ambientMatrix             = ubo.addUniform("ambientMatrix", 16);
+  _uboHandles.opacityMatrix             = ubo.addUniform("opacityMatrix", 16);
+  _uboHandles.emissiveMatrix            = ubo.addUniform("emissiveMatrix", 16);
+  _uboHandles.lightmapMatrix            = ubo.addUniform("lightmapMatrix", 16);
+  _uboHandles.reflectivityMatrix        = ubo.addUniform("reflectivityMatrix", 16);
+  _uboHandles.microSurfaceSamplerMatrix = ubo.addUniform("microSurfaceSamplerMatrix", 16);
+  _uboHandles.bumpMatrix                = ubo.addUniform("bumpMatrix", 16);
+  _uboHandles.vTangentSpaceParams       = ubo.addUniform("vTangentSpaceParams", 2);
+  _uboHandles.reflectionMatrix          = ubo.addUniform("reflectionMatrix", 16);
+
+  _uboHandles.vReflectionColor   = ubo.addUniform("vReflectionColor", 3);
+  _uboHandles.vAlbedoColor       = ubo.addUniform("vAlbedoColor", 4);
+  _uboHandles.vLightingIntensity = ubo.addUniform("vLightingIntensity", 4);
+
+  _uboHandles.vReflectionMicrosurfaceInfos = ubo.addUniform("vReflectionMicrosurfaceInfos", 3);
+  _uboHandles.pointSize                    = ubo.addUniform("pointSize", 1);
+  _uboHandles.vReflectivityColor           = ubo.addUniform("vReflectivityColor", 4);
+  _uboHandles.vEmissiveColor               = ubo.addUniform("vEmissiveColor", 3);
+  _uboHandles.visibility                   = ubo.addUniform("visibility", 1);
+  _uboHandles.vMetallicReflectanceFactors  = ubo.addUniform("vMetallicReflectanceFactors", 4);
+  _uboHandles.vMetallicReflectanceInfos    = ubo.addUniform("vMetallicReflectanceInfos", 2);
+  _uboHandles.metallicReflectanceMatrix    = ubo.addUniform("metallicReflectanceMatrix", 16);
 
   PBRClearCoatConfiguration::PrepareUniformBuffer(ubo);
   PBRAnisotropicConfiguration::PrepareUniformBuffer(ubo);
@@ -1162,6 +1176,36 @@ void PBRBaseMaterial::buildUniformLayout()
   ubo.create();
 }
 
+void PBRBaseMaterial::_resolveEffectUniformHandles()
+{
+  if (_effectHandlesId == _activeEffect->uniqueId) {
+    return;
+  }
+
+  _effectHandlesId               = _activeEffect->uniqueId;
+  _effectHandles.vEyePosition    = _activeEffect->getUniformHandle("vEyePosition");
+  _effectHandles.vAmbientColor   = _activeEffect->getUniformHandle("vAmbientColor");
+  _effectHandles.vDebugMode      = _activeEffect->getUniformHandle("vDebugMode");
+  _effectHandles.vSphericalL00   = _activeEffect->getUniformHandle("vSphericalL00");
+  _effectHandles.vSphericalL1_1  = _activeEffect->getUniformHandle("vSphericalL1_1");
+  _effectHandles.vSphericalL10   = _activeEffect->getUniformHandle("vSphericalL10");
+  _effectHandles.vSphericalL11   = _activeEffect->getUniformHandle("vSphericalL11");
+  _effectHandles.vSphericalL2_2  = _activeEffect->getUniformHandle("vSphericalL2_2");
+  _effectHandles.vSphericalL2_1  = _activeEffect->getUniformHandle("vSphericalL2_1");
+  _effectHandles.vSphericalL20   = _activeEffect->getUniformHandle("vSphericalL20");
+  _effectHandles.vSphericalL21   = _activeEffect->getUniformHandle("vSphericalL21");
+  _effectHandles.vSphericalL22   = _activeEffect->getUniformHandle("vSphericalL22");
+  _effectHandles.vSphericalX     = _activeEffect->getUniformHandle("vSphericalX");
+  _effectHandles.vSphericalY     = _activeEffect->getUniformHandle("vSphericalY");
+  _effectHandles.vSphericalZ     = _activeEffect->getUniformHandle("vSphericalZ");
+  _effectHandles.vSphericalXX_ZZ = _activeEffect->getUniformHandle("vSphericalXX_ZZ");
+  _effectHandles.vSphericalYY_ZZ = _activeEffect->getUniformHandle("vSphericalYY_ZZ");
+  _effectHandles.vSphericalZZ    = _activeEffect->getUniformHandle("vSphericalZZ");
+  _effectHandles.vSphericalXY    = _activeEffect->getUniformHandle("vSphericalXY");
+  _effectHandles.vSphericalYZ    = _activeEffect->getUniformHandle("vSphericalYZ");
+  _effectHandles.vSphericalZX    = _activeEffect->getUniformHandle("vSphericalZX");
+}
+
 void PBRBaseMaterial::unbind()
 {
   if (_activeEffect) {
@@ -1191,7 +1235,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1199,9 +1243,10 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   }
 
   _activeEffect = effect;
+  _resolveEffectUniformHandles();
 
   // Matrices
-  if (!defines["INSTANCES"] || defines["THIN_INSTANCES"]) {
+  if (!defines[DefineIndex::INSTANCES] || defines[DefineIndex::THIN_INSTANCES]) {
     bindOnlyWorldMatrix(world);
   }
 
@@ -1209,7 +1254,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   prePassConfiguration->bindForSubMesh(_activeEffect, scene, mesh, world, isFrozen());
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[DefineIndex::OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1218,6 +1263,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
 
   // Bones
   MaterialHelper::BindBonesParameters(mesh, _activeEffect.get(), prePassConfiguration);
+  MaterialHelper::BindBakedVertexAnimationParameters(mesh, _activeEffect.get(), defines);
 
   BaseTexturePtr reflectionTexture = nullptr;
   auto& ubo                        = *_uniformBuffer;
@@ -1233,156 +1279,169 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       // Texture uniforms
       if (scene->texturesEnabled()) {
         if (_albedoTexture && MaterialFlags::DiffuseTextureEnabled()) {
-          ubo.updateFloat2("vAlbedoInfos", static_cast<float>(_albedoTexture->coordinatesIndex),
-                           _albedoTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_albedoTexture, ubo, "albedo");
+          ubo.updateFloat2(_uboHandles.vAlbedoInfos,
+                           static_cast<float>(_albedoTexture->coordinatesIndex),
+                           _albedoTexture->level);
+          MaterialHelper::BindTextureMatrix(*_albedoTexture, ubo, _uboHandles.albedoMatrix);
         }
 
         if (_ambientTexture && MaterialFlags::AmbientTextureEnabled()) {
-          ubo.updateFloat4("vAmbientInfos", static_cast<float>(_ambientTexture->coordinatesIndex),
+          ubo.updateFloat4(_uboHandles.vAmbientInfos,
+                           static_cast<float>(_ambientTexture->coordinatesIndex),
                            _ambientTexture->level, _ambientTextureStrength,
-                           static_cast<float>(_ambientTextureImpactOnAnalyticalLights), "");
-          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, "ambient");
+                           static_cast<float>(_ambientTextureImpactOnAnalyticalLights));
+          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, _uboHandles.ambientMatrix);
         }
 
         if (_opacityTexture && MaterialFlags::OpacityTextureEnabled()) {
-          ubo.updateFloat2("vOpacityInfos", static_cast<float>(_opacityTexture->coordinatesIndex),
-                           _opacityTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, "opacity");
+          ubo.updateFloat2(_uboHandles.vOpacityInfos,
+                           static_cast<float>(_opacityTexture->coordinatesIndex),
+                           _opacityTexture->level);
+          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, _uboHandles.opacityMatrix);
         }
 
         if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-          ubo.updateMatrix("reflectionMatrix", *reflectionTexture->getReflectionTextureMatrix());
-          ubo.updateFloat2("vReflectionInfos", reflectionTexture->level, 0, "");
+          ubo.updateMatrix(_uboHandles.reflectionMatrix,
+                           *reflectionTexture->getReflectionTextureMatrix());
+          ubo.updateFloat2(_uboHandles.vReflectionInfos, reflectionTexture->level, 0);
 
           if (reflectionTexture->boundingBoxSize()) {
             auto cubeTexture = std::static_pointer_cast<CubeTexture>(reflectionTexture);
             if (cubeTexture) {
-              ubo.updateVector3("vReflectionPosition", cubeTexture->boundingBoxPosition);
-              ubo.updateVector3("vReflectionSize", *cubeTexture->boundingBoxSize());
+              ubo.updateVector3(_uboHandles.vReflectionPosition, cubeTexture->boundingBoxPosition);
+              ubo.updateVector3(_uboHandles.vReflectionSize, *cubeTexture->boundingBoxSize());
             }
           }
 
           if (realTimeFiltering) {
             const auto width = static_cast<float>(reflectionTexture->getSize().width);
-            ubo.updateFloat2("vReflectionFilteringInfo", width, Scalar::Log2(width), "");
+            ubo.updateFloat2(_uboHandles.vReflectionFilteringInfo, width, Scalar::Log2(width));
           }
 
-          if (!defines["USEIRRADIANCEMAP"]) {
+          if (!defines[DefineIndex::USEIRRADIANCEMAP]) {
             auto _polynomials = reflectionTexture->sphericalPolynomial();
-            if (defines["USESPHERICALFROMREFLECTIONMAP"] && _polynomials) {
+            if (defines[DefineIndex::USESPHERICALFROMREFLECTIONMAP] && _polynomials) {
               auto polynomials = *_polynomials;
-              if (defines["SPHERICAL_HARMONICS"]) {
+              if (defines[DefineIndex::SPHERICAL_HARMONICS]) {
                 auto& preScaledHarmonics = polynomials.preScaledHarmonics();
-                _activeEffect->setVector3("vSphericalL00", preScaledHarmonics.l00);
-                _activeEffect->setVector3("vSphericalL1_1", preScaledHarmonics.l1_1);
-                _activeEffect->setVector3("vSphericalL10", preScaledHarmonics.l10);
-                _activeEffect->setVector3("vSphericalL11", preScaledHarmonics.l11);
-                _activeEffect->setVector3("vSphericalL2_2", preScaledHarmonics.l2_2);
-                _activeEffect->setVector3("vSphericalL2_1", preScaledHarmonics.l2_1);
-                _activeEffect->setVector3("vSphericalL20", preScaledHarmonics.l20);
-                _activeEffect->setVector3("vSphericalL21", preScaledHarmonics.l21);
-                _activeEffect->setVector3("vSphericalL22", preScaledHarmonics.l22);
+                _activeEffect->setVector3(_effectHandles.vSphericalL00, preScaledHarmonics.l00);
+                _activeEffect->setVector3(_effectHandles.vSphericalL1_1, preScaledHarmonics.l1_1);
+                _activeEffect->setVector3(_effectHandles.vSphericalL10, preScaledHarmonics.l10);
+                _activeEffect->setVector3(_effectHandles.vSphericalL11, preScaledHarmonics.l11);
+                _activeEffect->setVector3(_effectHandles.vSphericalL2_2, preScaledHarmonics.l2_2);
+                _activeEffect->setVector3(_effectHandles.vSphericalL2_1, preScaledHarmonics.l2_1);
+                _activeEffect->setVector3(_effectHandles.vSphericalL20, preScaledHarmonics.l20);
+                _activeEffect->setVector3(_effectHandles.vSphericalL21, preScaledHarmonics.l21);
+                _activeEffect->setVector3(_effectHandles.vSphericalL22, preScaledHarmonics.l22);
               }
               else {
-                _activeEffect->setFloat3("vSphericalX", polynomials.x.x, polynomials.x.y,
-                                         polynomials.x.z);
-                _activeEffect->setFloat3("vSphericalY", polynomials.y.x, polynomials.y.y,
-                                         polynomials.y.z);
-                _activeEffect->setFloat3("vSphericalZ", polynomials.z.x, polynomials.z.y,
-                                         polynomials.z.z);
-                _activeEffect->setFloat3("vSphericalXX_ZZ", polynomials.xx.x - polynomials.zz.x,
+                _activeEffect->setFloat3(_effectHandles.vSphericalX, polynomials.x.x,
+                                         polynomials.x.y, polynomials.x.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalY, polynomials.y.x,
+                                         polynomials.y.y, polynomials.y.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalZ, polynomials.z.x,
+                                         polynomials.z.y, polynomials.z.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalXX_ZZ,
+                                         polynomials.xx.x - polynomials.zz.x,
                                          polynomials.xx.y - polynomials.zz.y,
                                          polynomials.xx.z - polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalYY_ZZ", polynomials.yy.x - polynomials.zz.x,
+                _activeEffect->setFloat3(_effectHandles.vSphericalYY_ZZ,
+                                         polynomials.yy.x - polynomials.zz.x,
                                          polynomials.yy.y - polynomials.zz.y,
                                          polynomials.yy.z - polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalZZ", polynomials.zz.x, polynomials.zz.y,
-                                         polynomials.zz.z);
-                _activeEffect->setFloat3("vSphericalXY", polynomials.xy.x, polynomials.xy.y,
-                                         polynomials.xy.z);
-                _activeEffect->setFloat3("vSphericalYZ", polynomials.yz.x, polynomials.yz.y,
-                                         polynomials.yz.z);
-                _activeEffect->setFloat3("vSphericalZX", polynomials.zx.x, polynomials.zx.y,
-                                         polynomials.zx.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalZZ, polynomials.zz.x,
+                                         polynomials.zz.y, polynomials.zz.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalXY, polynomials.xy.x,
+                                         polynomials.xy.y, polynomials.xy.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalYZ, polynomials.yz.x,
+                                         polynomials.yz.y, polynomials.yz.z);
+                _activeEffect->setFloat3(_effectHandles.vSphericalZX, polynomials.zx.x,
+                                         polynomials.zx.y, polynomials.zx.z);
               }
             }
           }
 
-          ubo.updateFloat3(
-            "vReflectionMicrosurfaceInfos", static_cast<float>(reflectionTexture->getSize().width),
-            reflectionTexture->lodGenerationScale(), reflectionTexture->lodGenerationOffset(), "");
+          ubo.updateFloat3(_uboHandles.vReflectionMicrosurfaceInfos,
+                           static_cast<float>(reflectionTexture->getSize().width),
+                           reflectionTexture->lodGenerationScale(),
+                           reflectionTexture->lodGenerationOffset());
         }
 
         if (_emissiveTexture && MaterialFlags::EmissiveTextureEnabled()) {
-          ubo.updateFloat2("vEmissiveInfos", static_cast<float>(_emissiveTexture->coordinatesIndex),
-                           _emissiveTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, "emissive");
+          ubo.updateFloat2(_uboHandles.vEmissiveInfos,
+                           static_cast<float>(_emissiveTexture->coordinatesIndex),
+                           _emissiveTexture->level);
+          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, _uboHandles.emissiveMatrix);
         }
 
         if (_lightmapTexture && MaterialFlags::LightmapTextureEnabled()) {
-          ubo.updateFloat2("vLightmapInfos", static_cast<float>(_lightmapTexture->coordinatesIndex),
-                           _lightmapTexture->level, "");
-          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, "lightmap");
+          ubo.updateFloat2(_uboHandles.vLightmapInfos,
+                           static_cast<float>(_lightmapTexture->coordinatesIndex),
+                           _lightmapTexture->level);
+          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, _uboHandles.lightmapMatrix);
         }
 
         if (MaterialFlags::SpecularTextureEnabled()) {
           if (_metallicTexture) {
-            ubo.updateFloat3("vReflectivityInfos",
+            ubo.updateFloat3(_uboHandles.vReflectivityInfos,
                              static_cast<float>(_metallicTexture->coordinatesIndex),
-                             _metallicTexture->level, _ambientTextureStrength, "");
-            MaterialHelper::BindTextureMatrix(*_metallicTexture, ubo, "reflectivity");
+                             _metallicTexture->level, _ambientTextureStrength);
+            MaterialHelper::BindTextureMatrix(*_metallicTexture, ubo,
+                                              _uboHandles.reflectivityMatrix);
           }
           else if (_reflectivityTexture) {
-            ubo.updateFloat3("vReflectivityInfos",
+            ubo.updateFloat3(_uboHandles.vReflectivityInfos,
                              static_cast<float>(_reflectivityTexture->coordinatesIndex),
-                             _reflectivityTexture->level, 1.f, "");
-            MaterialHelper::BindTextureMatrix(*_reflectivityTexture, ubo, "reflectivity");
+                             _reflectivityTexture->level, 1.f);
+            MaterialHelper::BindTextureMatrix(*_reflectivityTexture, ubo,
+                                              _uboHandles.reflectivityMatrix);
           }
 
           if (_metallicReflectanceTexture) {
-            ubo.updateFloat2("vMetallicReflectanceInfos",
+            ubo.updateFloat2(_uboHandles.vMetallicReflectanceInfos,
                              static_cast<float>(_metallicReflectanceTexture->coordinatesIndex),
-                             _metallicReflectanceTexture->level, "");
+                             _metallicReflectanceTexture->level);
             MaterialHelper::BindTextureMatrix(*_metallicReflectanceTexture, ubo,
-                                              "metallicReflectance");
+                                              _uboHandles.metallicReflectanceMatrix);
           }
 
           if (_microSurfaceTexture) {
-            ubo.updateFloat2("vMicroSurfaceSamplerInfos",
+            ubo.updateFloat2(_uboHandles.vMicroSurfaceSamplerInfos,
                              static_cast<float>(_microSurfaceTexture->coordinatesIndex),
-                             _microSurfaceTexture->level, "");
-            MaterialHelper::BindTextureMatrix(*_microSurfaceTexture, ubo, "microSurfaceSampler");
+                             _microSurfaceTexture->level);
+            MaterialHelper::BindTextureMatrix(*_microSurfaceTexture, ubo,
+                                              _uboHandles.microSurfaceSamplerMatrix);
           }
         }
 
         if (_bumpTexture && engine->getCaps().standardDerivatives
             && MaterialFlags::BumpTextureEnabled() && !_disableBumpMap) {
-          ubo.updateFloat3("vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
-                           _bumpTexture->level, _parallaxScaleBias, "");
-          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, "bump");
+          ubo.updateFloat3(_uboHandles.vBumpInfos,
+                           static_cast<float>(_bumpTexture->coordinatesIndex), _bumpTexture->level,
+                           _parallaxScaleBias);
+          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, _uboHandles.bumpMatrix);
 
           if (scene->_mirroredCameraPosition) {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? 1.f : -1.f,
-                             _invertNormalMapY ? 1.f : -1.f, "");
+            ubo.updateFloat2(_uboHandles.vTangentSpaceParams, _invertNormalMapX ? 1.f : -1.f,
+                             _invertNormalMapY ? 1.f : -1.f);
           }
           else {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? -1.f : 1.f,
-                             _invertNormalMapY ? -1.f : 1.f, "");
+            ubo.updateFloat2(_uboHandles.vTangentSpaceParams, _invertNormalMapX ? -1.f : 1.f,
+                             _invertNormalMapY ? -1.f : 1.f);
           }
         }
       }
 
       // Point size
       if (pointsCloud) {
-        ubo.updateFloat("pointSize", pointSize);
+        ubo.updateFloat(_uboHandles.pointSize, pointSize);
       }
 
       // Colors
-      if (defines["METALLICWORKFLOW"]) {
+      if (defines[DefineIndex::METALLICWORKFLOW]) {
         TmpVectors::Color3Array[0].r = !_metallic.has_value() ? 1.f : *_metallic;
         TmpVectors::Color3Array[0].g = !_roughness.has_value() ? 1.f : *_roughness;
-        ubo.updateColor4("vReflectivityColor", TmpVectors::Color3Array[0], 1, "");
+        ubo.updateColor4(_uboHandles.vReflectivityColor, TmpVectors::Color3Array[0], 1);
 
         const auto ior = subSurface->indexOfRefraction();
         const auto outside_ior
@@ -1396,22 +1455,22 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
         _metallicReflectanceColor.scaleToRef(f0 * _metallicF0Factor, TmpVectors::Color3Array[0]);
         const auto metallicF90 = _metallicF0Factor;
 
-        ubo.updateColor4("vMetallicReflectanceFactors", TmpVectors::Color3Array[0], metallicF90,
-                         "");
+        ubo.updateColor4(_uboHandles.vMetallicReflectanceFactors, TmpVectors::Color3Array[0],
+                         metallicF90);
       }
       else {
-        ubo.updateColor4("vReflectivityColor", _reflectivityColor, _microSurface, "");
+        ubo.updateColor4(_uboHandles.vReflectivityColor, _reflectivityColor, _microSurface);
       }
 
       ubo.updateColor3(
-        "vEmissiveColor",
-        MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly(), "");
-      ubo.updateColor3("vReflectionColor", _reflectionColor, "");
-      if (!defines["SS_REFRACTION"] && subSurface->linkRefractionWithTransparency()) {
-        ubo.updateColor4("vAlbedoColor", _albedoColor, 1.f, "");
+        _uboHandles.vEmissiveColor,
+        MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly());
+      ubo.updateColor3(_uboHandles.vReflectionColor, _reflectionColor);
+      if (!defines[DefineIndex::SS_REFRACTION] && subSurface->linkRefractionWithTransparency()) {
+        ubo.updateColor4(_uboHandles.vAlbedoColor, _albedoColor, 1.f);
       }
       else {
-        ubo.updateColor4("vAlbedoColor", _albedoColor, alpha, "");
+        ubo.updateColor4(_uboHandles.vAlbedoColor, _albedoColor, alpha);
       }
 
       // Misc
@@ -1420,11 +1479,11 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       _lightingInfos.z = _environmentIntensity * scene->environmentIntensity();
       _lightingInfos.w = _specularIntensity;
 
-      ubo.updateVector4("vLightingIntensity", _lightingInfos);
+      ubo.updateVector4(_uboHandles.vLightingIntensity, _lightingInfos);
     }
 
     // Visibility
-    ubo.updateFloat("visibility", mesh->visibility());
+    ubo.updateFloat(_uboHandles.visibility, mesh->visibility());
 
     // Textures
     if (scene->texturesEnabled()) {
@@ -1441,7 +1500,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
 
       if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        if (defines["LODBASEDMICROSFURACE"]) {
+        if (defines[DefineIndex::LODBASEDMICROSFURACE]) {
           ubo.setTexture("reflectionSampler", reflectionTexture);
         }
         else {
@@ -1456,12 +1515,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
                                                     reflectionTexture);
         }
 
-        if (defines["USEIRRADIANCEMAP"]) {
+        if (defines[DefineIndex::USEIRRADIANCEMAP]) {
           ubo.setTexture("irradianceSampler", reflectionTexture->irradianceTexture());
         }
       }
 
-      if (defines["ENVIRONMENTBRDF"]) {
+      if (defines[DefineIndex::ENVIRONMENTBRDF]) {
         ubo.setTexture("environmentBrdfSampler", _environmentBRDFTexture);
       }
 
@@ -1497,8 +1556,8 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
     }
 
     detailMap->bindForSubMesh(ubo, scene, isFrozen());
-    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(), defines["LODBASEDMICROSFURACE"],
-                               _realTimeFiltering);
+    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(),
+                               defines[DefineIndex::LODBASEDMICROSFURACE], _realTimeFiltering);
     clearCoat->bindForSubMesh(ubo, scene, engine, _disableBumpMap, isFrozen(), _invertNormalMapX,
                               _invertNormalMapY, subMesh);
     anisotropy->bindForSubMesh(ubo, scene, isFrozen());
@@ -1516,11 +1575,11 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
                                                            scene->activeCamera()->globalPosition());
     auto invertNormal
       = (scene->useRightHandedSystem() == (scene->_mirroredCameraPosition != nullptr));
-    effect->setFloat4("vEyePosition", eyePosition.x, eyePosition.y, eyePosition.z,
+    effect->setFloat4(_effectHandles.vEyePosition, eyePosition.x, eyePosition.y, eyePosition.z,
                       invertNormal ? -1.f : 1.f);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    effect->setColor3(_effectHandles.vAmbientColor, _globalAmbientColor);
 
-    effect->setFloat2("vDebugMode", debugLimit, debugFactor);
+    effect->setFloat2(_effectHandles.vDebugMode, debugLimit, debugFactor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -1540,7 +1599,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
     MaterialHelper::BindFogParameters(scene, mesh, _activeEffect, true);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    if (defines.intDef[DefineIndex::NUM_MORPH_INFLUENCERS]) {
       MaterialHelper::BindMorphTargetParameters(mesh, _activeEffect.get());
     }
 
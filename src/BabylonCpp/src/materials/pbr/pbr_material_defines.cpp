@@ -4,237 +4,363 @@
 
 namespace BABYLON {
 
-PBRMaterialDefines::PBRMaterialDefines()
+namespace {
+
+MaterialDefinesSchema& pbrMaterialDefinesSchema()
 {
-  boolDef = {
-    {"PBR", true}, //
-
-    {"REALTIME_FILTERING", false}, //
-
-    {"MAINUV1", false}, //
-    {"MAINUV2", false}, //
-    {"UV1", false},     //
-    {"UV2", false},     //
-
-    {"ALBEDO", false},      //
-    {"GAMMAALBEDO", false}, //
-    {"VERTEXCOLOR", false}, //
-
-    {"DETAIL", false}, //
-
-    {"AMBIENT", false},            //
-    {"AMBIENTINGRAYSCALE", false}, //
-
-    {"OPACITY", false},            //
-    {"VERTEXALPHA", false},        //
-    {"OPACITYRGB", false},         //
-    {"ALPHATEST", false},          //
-    {"DEPTHPREPASS", false},       //
-    {"ALPHABLEND", false},         //
-    {"ALPHAFROMALBEDO", false},    //
-    {"SPECULAROVERALPHA", false},  //
-    {"RADIANCEOVERALPHA", false},  //
-    {"ALPHAFRESNEL", false},       //
-    {"LINEARALPHAFRESNEL", false}, //
-    {"PREMULTIPLYALPHA", false},   //
-
-    {"EMISSIVE", false}, //
-
-    {"REFLECTIVITY", false}, //
-    {"SPECULARTERM", false}, //
-
-    {"MICROSURFACEFROMREFLECTIVITYMAP", false}, //
-    {"MICROSURFACEAUTOMATIC", false},           //
-    {"LODBASEDMICROSFURACE", false},            //
-    {"MICROSURFACEMAP", false},                 //
-
-    {"METALLICWORKFLOW", false},              //
-    {"ROUGHNESSSTOREINMETALMAPALPHA", false}, //
-    {"ROUGHNESSSTOREINMETALMAPGREEN", false}, //
-    {"METALLNESSSTOREINMETALMAPBLUE", false}, //
-    {"AOSTOREINMETALMAPRED", false},          //
-
-    {"METALLIC_REFLECTANCE", false}, //
-
-    {"ENVIRONMENTBRDF", false},      //
-    {"ENVIRONMENTBRDF_RGBD", false}, //
-
-    {"NORMAL", false},                //
-    {"TANGENT", false},               //
-    {"BUMP", false},                  //
-    {"OBJECTSPACE_NORMALMAP", false}, //
-    {"PARALLAX", false},              //
-    {"PARALLAXOCCLUSION", false},     //
-    {"NORMALXYSCALE", true},          //
-
-    {"LIGHTMAP", false},               //
-    {"USELIGHTMAPASSHADOWMAP", false}, //
-    {"GAMMALIGHTMAP", false},          //
-    {"RGBDLIGHTMAP", false},           //
-
-    {"REFLECTION", false},                                  //
-    {"REFLECTIONMAP_3D", false},                            //
-    {"REFLECTIONMAP_SPHERICAL", false},                     //
-    {"REFLECTIONMAP_PLANAR", false},                        //
-    {"REFLECTIONMAP_CUBIC", false},                         //
-    {"USE_LOCAL_REFLECTIONMAP_CUBIC", false},               //
-    {"REFLECTIONMAP_PROJECTION", false},                    //
-    {"REFLECTIONMAP_SKYBOX", false},                        //
-    {"REFLECTIONMAP_EXPLICIT", false},                      //
-    {"REFLECTIONMAP_EQUIRECTANGULAR", false},               //
-    {"REFLECTIONMAP_EQUIRECTANGULAR_FIXED", false},         //
-    {"REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED", false}, //
-    {"INVERTCUBICMAP", false},                              //
-    {"USESPHERICALFROMREFLECTIONMAP", false},               //
-    {"USEIRRADIANCEMAP", false},                            //
-    {"SPHERICAL_HARMONICS", false},                         //
-    {"USESPHERICALINVERTEX", false},                        //
-    {"REFLECTIONMAP_OPPOSITEZ", false},                     //
-    {"LODINREFLECTIONALPHA", false},                        //
-    {"GAMMAREFLECTION", false},                             //
-    {"RGBDREFLECTION", false},                              //
-    {"LINEARSPECULARREFLECTION", false},                    //
-    {"RADIANCEOCCLUSION", false},                           //
-    {"HORIZONOCCLUSION", false},                            //
-
-    {"INSTANCES", false},      //
-    {"THIN_INSTANCES", false}, //
-
-    {"PREPASS", false},              //
-    {"PREPASS_IRRADIANCE", false},   //
-    {"PREPASS_ALBEDO", false},       //
-    {"PREPASS_DEPTHNORMAL", false},  //
-    {"PREPASS_POSITION", false},     //
-    {"PREPASS_VELOCITY", false},     //
-    {"PREPASS_REFLECTIVITY", false}, //
-
-    {"BONETEXTURE", false},            //
-    {"BONES_VELOCITY_ENABLED", false}, //
-
-    {"NONUNIFORMSCALING", false}, //
-
-    {"MORPHTARGETS", false},         //
-    {"MORPHTARGETS_NORMAL", false},  //
-    {"MORPHTARGETS_TANGENT", false}, //
-    {"MORPHTARGETS_UV", false},      //
-
-    {"IMAGEPROCESSING", false},            //
-    {"VIGNETTE", false},                   //
-    {"VIGNETTEBLENDMODEMULTIPLY", false},  //
-    {"VIGNETTEBLENDMODEOPAQUE", false},    //
-    {"TONEMAPPING", false},                //
-    {"TONEMAPPING_ACES", false},           //
-    {"CONTRAST", false},                   //
-    {"COLORCURVES", false},                //
-    {"COLORGRADING", false},               //
-    {"COLORGRADING3D", false},             //
-    {"SAMPLER3DGREENDEPTH", false},        //
-    {"SAMPLER3DBGRMAP", false},            //
-    {"IMAGEPROCESSINGPOSTPROCESS", false}, //
-    {"EXPOSURE", false},                   //
-    {"MULTIVIEW", false},                  //
-
-    {"USEPHYSICALLIGHTFALLOFF", false}, //
-    {"USEGLTFLIGHTFALLOFF", false},     //
-    {"TWOSIDEDLIGHTING", false},        //
-    {"SHADOWFLOAT", false},             //
-    {"CLIPPLANE", false},               //
-    {"CLIPPLANE2", false},              //
-    {"CLIPPLANE3", false},              //
-    {"CLIPPLANE4", false},              //
-    {"CLIPPLANE5", false},              //
-    {"CLIPPLANE6", false},              //
-    {"POINTSIZE", false},               //
-    {"FOG", false},                     //
-    {"LOGARITHMICDEPTH", false},        //
-
-    {"FORCENORMALFORWARD", false}, //
-
-    {"SPECULARAA", false}, //
-
-    {"CLEARCOAT", false},                                //
-    {"CLEARCOAT_DEFAULTIOR", false},                     //
-    {"CLEARCOAT_TEXTURE", false},                        //
-    {"CLEARCOAT_TEXTURE_ROUGHNESS", false},              //
-    {"CLEARCOAT_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
-    {"CLEARCOAT_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
-    {"CLEARCOAT_BUMP", false},                           //
-    {"CLEARCOAT_REMAP_F0", true},                        //
-    {"CLEARCOAT_TINT", false},                           //
-    {"CLEARCOAT_TINT_TEXTURE", false},                   //
-
-    {"ANISOTROPIC", false},         //
-    {"ANISOTROPIC_TEXTURE", false}, //
-
-    {"BRDF_V_HEIGHT_CORRELATED", false},                //
-    {"MS_BRDF_ENERGY_CONSERVATION", false},             //
-    {"SPECULAR_GLOSSINESS_ENERGY_CONSERVATION", false}, //
-
-    {"SHEEN", false},                                //
-    {"SHEEN_TEXTURE", false},                        //
-    {"SHEEN_TEXTURE_ROUGHNESS", false},              //
-    {"SHEEN_LINKWITHALBEDO", false},                 //
-    {"SHEEN_ROUGHNESS", false},                      //
-    {"SHEEN_ALBEDOSCALING", false},                  //
-    {"SHEEN_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
-    {"SHEEN_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
-
-    {"SUBSURFACE", false}, //
-
-    {"SS_REFRACTION", false},   //
-    {"SS_TRANSLUCENCY", false}, //
-    {"SS_SCATTERING", false},   //
-
-    {"SS_THICKNESSANDMASK_TEXTURE", false}, //
-
-    {"SS_REFRACTIONMAP_3D", false},             //
-    {"SS_REFRACTIONMAP_OPPOSITEZ", false},      //
-    {"SS_LODINREFRACTIONALPHA", false},         //
-    {"SS_GAMMAREFRACTION", false},              //
-    {"SS_RGBDREFRACTION", false},               //
-    {"SS_LINEARSPECULARREFRACTION", false},     //
-    {"SS_LINKREFRACTIONTOTRANSPARENCY", false}, //
-    {"SS_ALBEDOFORREFRACTIONTINT", false},      //
-
-    {"SS_MASK_FROM_THICKNESS_TEXTURE", false},      //
-    {"SS_MASK_FROM_THICKNESS_TEXTURE_GLTF", false}, //
-
-    {"UNLIT", false}, //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"PBR", true}, //
+
+      {"REALTIME_FILTERING", false}, //
+
+      {"MAINUV1", false}, //
+      {"MAINUV2", false}, //
+      {"UV1", false},     //
+      {"UV2", false},     //
+
+      {"ALBEDO", false},      //
+      {"GAMMAALBEDO", false}, //
+      {"VERTEXCOLOR", false}, //
+
+      {"DETAIL", false}, //
+
+      {"AMBIENT", false},            //
+      {"AMBIENTINGRAYSCALE", false}, //
+
+      {"OPACITY", false},            //
+      {"VERTEXALPHA", false},        //
+      {"OPACITYRGB", false},         //
+      {"ALPHATEST", false},          //
+      {"DEPTHPREPASS", false},       //
+      {"ALPHABLEND", false},         //
+      {"ALPHAFROMALBEDO", false},    //
+      {"SPECULAROVERALPHA", false},  //
+      {"RADIANCEOVERALPHA", false},  //
+      {"ALPHAFRESNEL", false},       //
+      {"LINEARALPHAFRESNEL", false}, //
+      {"PREMULTIPLYALPHA", false},   //
+
+      {"EMISSIVE", false}, //
+
+      {"REFLECTIVITY", false}, //
+      {"SPECULARTERM", false}, //
+
+      {"MICROSURFACEFROMREFLECTIVITYMAP", false}, //
+      {"MICROSURFACEAUTOMATIC", false},           //
+      {"LODBASEDMICROSFURACE", false},            //
+      {"MICROSURFACEMAP", false},                 //
+
+      {"METALLICWORKFLOW", false},              //
+      {"ROUGHNESSSTOREINMETALMAPALPHA", false}, //
+      {"ROUGHNESSSTOREINMETALMAPGREEN", false}, //
+      {"METALLNESSSTOREINMETALMAPBLUE", false}, //
+      {"AOSTOREINMETALMAPRED", false},          //
+
+      {"METALLIC_REFLECTANCE", false}, //
+
+      {"ENVIRONMENTBRDF", false},      //
+      {"ENVIRONMENTBRDF_RGBD", false}, //
+
+      {"NORMAL", false},                //
+      {"TANGENT", false},               //
+      {"BUMP", false},                  //
+      {"OBJECTSPACE_NORMALMAP", false}, //
+      {"PARALLAX", false},              //
+      {"PARALLAXOCCLUSION", false},     //
+      {"NORMALXYSCALE", true},          //
+
+      {"LIGHTMAP", false},               //
+      {"USELIGHTMAPASSHADOWMAP", false}, //
+      {"GAMMALIGHTMAP", false},          //
+      {"RGBDLIGHTMAP", false},           //
+
+      {"REFLECTION", false},                                  //
+      {"REFLECTIONMAP_3D", false},                            //
+      {"REFLECTIONMAP_SPHERICAL", false},                     //
+      {"REFLECTIONMAP_PLANAR", false},                        //
+      {"REFLECTIONMAP_CUBIC", false},                         //
+      {"USE_LOCAL_REFLECTIONMAP_CUBIC", false},               //
+      {"REFLECTIONMAP_PROJECTION", false},                    //
+      {"REFLECTIONMAP_SKYBOX", false},                        //
+      {"REFLECTIONMAP_EXPLICIT", false},                      //
+      {"REFLECTIONMAP_EQUIRECTANGULAR", false},               //
+      {"REFLECTIONMAP_EQUIRECTANGULAR_FIXED", false},         //
+      {"REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED", false}, //
+      {"INVERTCUBICMAP", false},                              //
+      {"USESPHERICALFROMREFLECTIONMAP", false},               //
+      {"USEIRRADIANCEMAP", false},                            //
+      {"SPHERICAL_HARMONICS", false},                         //
+      {"USESPHERICALINVERTEX", false},                        //
+      {"REFLECTIONMAP_OPPOSITEZ", false},                     //
+      {"LODINREFLECTIONALPHA", false},                        //
+      {"GAMMAREFLECTION", false},                             //
+      {"RGBDREFLECTION", false},                              //
+      {"LINEARSPECULARREFLECTION", false},                    //
+      {"RADIANCEOCCLUSION", false},                           //
+      {"HORIZONOCCLUSION", false},                            //
+
+      {"INSTANCES", false},      //
+      {"THIN_INSTANCES", false}, //
+
+      {"PREPASS", false},              //
+      {"PREPASS_IRRADIANCE", false},   //
+      {"PREPASS_ALBEDO", false},       //
+      {"PREPASS_DEPTHNORMAL", false},  //
+      {"PREPASS_POSITION", false},     //
+      {"PREPASS_VELOCITY", false},     //
+      {"PREPASS_REFLECTIVITY", false}, //
+
+      {"BONETEXTURE", false},            //
+      {"BONES_VELOCITY_ENABLED", false}, //
+
+      {"BAKED_VERTEX_ANIMATION_TEXTURE", false}, //
+
+      {"NONUNIFORMSCALING", false}, //
+
+      {"MORPHTARGETS", false},         //
+      {"MORPHTARGETS_NORMAL", false},  //
+      {"MORPHTARGETS_TANGENT", false}, //
+      {"MORPHTARGETS_UV", false},      //
+
+      {"IMAGEPROCESSING", false},            //
+      {"VIGNETTE", false},                   //
+      {"VIGNETTEBLENDMODEMULTIPLY", false},  //
+      {"VIGNETTEBLENDMODEOPAQUE", false},    //
+      {"TONEMAPPING", false},                //
+      {"TONEMAPPING_ACES", false},           //
+      {"CONTRAST", false},                   //
+      {"COLORCURVES", false},                //
+      {"COLORGRADING", false},               //
+      {"COLORGRADING3D", false},             //
+      {"SAMPLER3DGREENDEPTH", false},        //
+      {"SAMPLER3DBGRMAP", false},            //
+      {"IMAGEPROCESSINGPOSTPROCESS", false}, //
+      {"EXPOSURE", false},                   //
+      {"MULTIVIEW", false},                  //
+
+      {"USEPHYSICALLIGHTFALLOFF", false}, //
+      {"USEGLTFLIGHTFALLOFF", false},     //
+      {"TWOSIDEDLIGHTING", false},        //
+      {"SHADOWFLOAT", false},             //
+      {"CLIPPLANE", false},               //
+      {"CLIPPLANE2", false},              //
+      {"CLIPPLANE3", false},              //
+      {"CLIPPLANE4", false},              //
+      {"CLIPPLANE5", false},              //
+      {"CLIPPLANE6", false},              //
+      {"POINTSIZE", false},               //
+      {"FOG", false},                     //
+      {"LOGARITHMICDEPTH", false},        //
+
+      {"FORCENORMALFORWARD", false}, //
+
+      {"SPECULARAA", false}, //
+
+      {"CLEARCOAT", false},                                //
+      {"CLEARCOAT_DEFAULTIOR", false},                     //
+      {"CLEARCOAT_TEXTURE", false},                        //
+      {"CLEARCOAT_TEXTURE_ROUGHNESS", false},              //
+      {"CLEARCOAT_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
+      {"CLEARCOAT_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
+      {"CLEARCOAT_BUMP", false},                           //
+      {"CLEARCOAT_REMAP_F0", true},                        //
+      {"CLEARCOAT_TINT", false},                           //
+      {"CLEARCOAT_TINT_TEXTURE", false},                   //
+
+      {"ANISOTROPIC", false},         //
+      {"ANISOTROPIC_TEXTURE", false}, //
+
+      {"BRDF_V_HEIGHT_CORRELATED", false},                //
+      {"MS_BRDF_ENERGY_CONSERVATION", false},             //
+      {"SPECULAR_GLOSSINESS_ENERGY_CONSERVATION", false}, //
+
+      {"SHEEN", false},                                //
+      {"SHEEN_TEXTURE", false},                        //
+      {"SHEEN_TEXTURE_ROUGHNESS", false},              //
+      {"SHEEN_LINKWITHALBEDO", false},                 //
+      {"SHEEN_ROUGHNESS", false},                      //
+      {"SHEEN_ALBEDOSCALING", false},                  //
+      {"SHEEN_USE_ROUGHNESS_FROM_MAINTEXTURE", false}, //
+      {"SHEEN_TEXTURE_ROUGHNESS_IDENTICAL", false},    //
+
+      {"SUBSURFACE", false}, //
+
+      {"SS_REFRACTION", false},   //
+      {"SS_TRANSLUCENCY", false}, //
+      {"SS_SCATTERING", false},   //
+
+      {"SS_THICKNESSANDMASK_TEXTURE", false}, //
+
+      {"SS_REFRACTIONMAP_3D", false},             //
+      {"SS_REFRACTIONMAP_OPPOSITEZ", false},      //
+      {"SS_LODINREFRACTIONALPHA", false},         //
+      {"SS_GAMMAREFRACTION", false},              //
+      {"SS_RGBDREFRACTION", false},               //
+      {"SS_LINEARSPECULARREFRACTION", false},     //
+      {"SS_LINKREFRACTIONTOTRANSPARENCY", false}, //
+      {"SS_ALBEDOFORREFRACTIONTINT", false},      //
+
+      {"SS_MASK_FROM_THICKNESS_TEXTURE", false},      //
+      {"SS_MASK_FROM_THICKNESS_TEXTURE_GLTF", false}, //
+
+      {"UNLIT", false}, //
+    },
+    // Numeric defines
+    {
+      {"NUM_SAMPLES", 0},                         //
+      {"AMBIENTDIRECTUV", 0},                     //
+      {"ALBEDODIRECTUV", 0},                      //
+      {"DETAILDIRECTUV", 0},                      //
+      {"DETAIL_NORMALBLENDMETHOD", 0},            //
+      {"OPACITYDIRECTUV", 0},                     //
+      {"EMISSIVEDIRECTUV", 0},                    //
+      {"REFLECTIVITYDIRECTUV", 0},                //
+      {"MICROSURFACEMAPDIRECTUV", 0},             //
+      {"METALLIC_REFLECTANCEDIRECTUV", 0},        //
+      {"BUMPDIRECTUV", 0},                        //
+      {"LIGHTMAPDIRECTUV", 0},                    //
+      {"NUM_BONE_INFLUENCERS", 0},                //
+      {"BonesPerMesh", 0},                        //
+      {"PREPASS_IRRADIANCE_INDEX", -1},           //
+      {"PREPASS_ALBEDO_INDEX", -1},               //
+      {"PREPASS_DEPTHNORMAL_INDEX", -1},          //
+      {"PREPASS_POSITION_INDEX", -1},             //
+      {"PREPASS_VELOCITY_INDEX", -1},             //
+      {"PREPASS_REFLECTIVITY_INDEX", -1},         //
+      {"SCENE_MRT_COUNT", 0},                     //
+      {"NUM_MORPH_INFLUENCERS", 0},               //
+      {"CLEARCOAT_TEXTUREDIRECTUV", 0},           //
+      {"CLEARCOAT_TEXTURE_ROUGHNESSDIRECTUV", 0}, //
+      {"CLEARCOAT_BUMPDIRECTUV", 0},              //
+      {"CLEARCOAT_TINT_TEXTUREDIRECTUV", 0},      //
+      {"ANISOTROPIC_TEXTUREDIRECTUV", 0},         //
+      {"SHEEN_TEXTUREDIRECTUV", 0},               //
+      {"SHEEN_TEXTURE_ROUGHNESSDIRECTUV", 0},     //
+      {"SS_THICKNESSANDMASK_TEXTUREDIRECTUV", 0}, //
+      {"DEBUGMODE", 0},                           //
+    });
+  return schema;
+}
 
-  intDef = {
-    {"NUM_SAMPLES", 0},                         //
-    {"AMBIENTDIRECTUV", 0},                     //
-    {"ALBEDODIRECTUV", 0},                      //
-    {"DETAILDIRECTUV", 0},                      //
-    {"DETAIL_NORMALBLENDMETHOD", 0},            //
-    {"OPACITYDIRECTUV", 0},                     //
-    {"EMISSIVEDIRECTUV", 0},                    //
-    {"REFLECTIVITYDIRECTUV", 0},                //
-    {"MICROSURFACEMAPDIRECTUV", 0},             //
-    {"METALLIC_REFLECTANCEDIRECTUV", 0},        //
-    {"BUMPDIRECTUV", 0},                        //
-    {"LIGHTMAPDIRECTUV", 0},                    //
-    {"NUM_BONE_INFLUENCERS", 0},                //
-    {"BonesPerMesh", 0},                        //
-    {"PREPASS_IRRADIANCE_INDEX", -1},           //
-    {"PREPASS_ALBEDO_INDEX", -1},               //
-    {"PREPASS_DEPTHNORMAL_INDEX", -1},          //
-    {"PREPASS_POSITION_INDEX", -1},             //
-    {"PREPASS_VELOCITY_INDEX", -1},             //
-    {"PREPASS_REFLECTIVITY_INDEX", -1},         //
-    {"SCENE_MRT_COUNT", 0},                     //
-    {"NUM_MORPH_INFLUENCERS", 0},               //
-    {"CLEARCOAT_TEXTUREDIRECTUV", 0},           //
-    {"CLEARCOAT_TEXTURE_ROUGHNESSDIRECTUV", 0}, //
-    {"CLEARCOAT_BUMPDIRECTUV", 0},              //
-    {"CLEARCOAT_TINT_TEXTUREDIRECTUV", 0},      //
-    {"ANISOTROPIC_TEXTUREDIRECTUV", 0},         //
-    {"SHEEN_TEXTUREDIRECTUV", 0},               //
-    {"SHEEN_TEXTURE_ROUGHNESSDIRECTUV", 0},     //
-    {"SS_THICKNESSANDMASK_TEXTUREDIRECTUV", 0}, //
-    {"DEBUGMODE", 0},                           //
-  };
+size_t boolIndex(const char* name)
+{
+  return pbrMaterialDefinesSchema().boolIndex(name);
+}
+
+size_t intIndex(const char* name)
+{
+  return pbrMaterialDefinesSchema().intIndex(name);
+}
+
+} // end of anonymous namespace
+
+// Boolean defines
+const size_t PBRMaterialDefines::Index::ALBEDO{boolIndex("ALBEDO")};
+const size_t PBRMaterialDefines::Index::ALPHABLEND{boolIndex("ALPHABLEND")};
+const size_t PBRMaterialDefines::Index::ALPHAFRESNEL{boolIndex("ALPHAFRESNEL")};
+const size_t PBRMaterialDefines::Index::ALPHAFROMALBEDO{boolIndex("ALPHAFROMALBEDO")};
+const size_t PBRMaterialDefines::Index::AMBIENT{boolIndex("AMBIENT")};
+const size_t PBRMaterialDefines::Index::AMBIENTINGRAYSCALE{boolIndex("AMBIENTINGRAYSCALE")};
+const size_t PBRMaterialDefines::Index::AOSTOREINMETALMAPRED{boolIndex("AOSTOREINMETALMAPRED")};
+const size_t PBRMaterialDefines::Index::BUMP{boolIndex("BUMP")};
+const size_t PBRMaterialDefines::Index::EMISSIVE{boolIndex("EMISSIVE")};
+const size_t PBRMaterialDefines::Index::ENVIRONMENTBRDF{boolIndex("ENVIRONMENTBRDF")};
+const size_t PBRMaterialDefines::Index::ENVIRONMENTBRDF_RGBD{boolIndex("ENVIRONMENTBRDF_RGBD")};
+const size_t PBRMaterialDefines::Index::FOG{boolIndex("FOG")};
+const size_t PBRMaterialDefines::Index::FORCENORMALFORWARD{boolIndex("FORCENORMALFORWARD")};
+const size_t PBRMaterialDefines::Index::GAMMAALBEDO{boolIndex("GAMMAALBEDO")};
+const size_t PBRMaterialDefines::Index::GAMMALIGHTMAP{boolIndex("GAMMALIGHTMAP")};
+const size_t PBRMaterialDefines::Index::GAMMAREFLECTION{boolIndex("GAMMAREFLECTION")};
+const size_t PBRMaterialDefines::Index::HORIZONOCCLUSION{boolIndex("HORIZONOCCLUSION")};
+const size_t PBRMaterialDefines::Index::INSTANCES{boolIndex("INSTANCES")};
+const size_t PBRMaterialDefines::Index::INVERTCUBICMAP{boolIndex("INVERTCUBICMAP")};
+const size_t PBRMaterialDefines::Index::LIGHTMAP{boolIndex("LIGHTMAP")};
+const size_t PBRMaterialDefines::Index::LINEARALPHAFRESNEL{boolIndex("LINEARALPHAFRESNEL")};
+const size_t PBRMaterialDefines::Index::LINEARSPECULARREFLECTION{
+  boolIndex("LINEARSPECULARREFLECTION")};
+const size_t PBRMaterialDefines::Index::LODBASEDMICROSFURACE{boolIndex("LODBASEDMICROSFURACE")};
+const size_t PBRMaterialDefines::Index::LODINREFLECTIONALPHA{boolIndex("LODINREFLECTIONALPHA")};
+const size_t PBRMaterialDefines::Index::LOGARITHMICDEPTH{boolIndex("LOGARITHMICDEPTH")};
+const size_t PBRMaterialDefines::Index::METALLICWORKFLOW{boolIndex("METALLICWORKFLOW")};
+const size_t PBRMaterialDefines::Index::METALLIC_REFLECTANCE{boolIndex("METALLIC_REFLECTANCE")};
+const size_t PBRMaterialDefines::Index::METALLNESSSTOREINMETALMAPBLUE{
+  boolIndex("METALLNESSSTOREINMETALMAPBLUE")};
+const size_t PBRMaterialDefines::Index::MICROSURFACEAUTOMATIC{boolIndex("MICROSURFACEAUTOMATIC")};
+const size_t PBRMaterialDefines::Index::MICROSURFACEFROMREFLECTIVITYMAP{
+  boolIndex("MICROSURFACEFROMREFLECTIVITYMAP")};
+const size_t PBRMaterialDefines::Index::MICROSURFACEMAP{boolIndex("MICROSURFACEMAP")};
+const size_t PBRMaterialDefines::Index::MORPHTARGETS{boolIndex("MORPHTARGETS")};
+const size_t PBRMaterialDefines::Index::MULTIVIEW{boolIndex("MULTIVIEW")};
+const size_t PBRMaterialDefines::Index::NORMAL{boolIndex("NORMAL")};
+const size_t PBRMaterialDefines::Index::OBJECTSPACE_NORMALMAP{boolIndex("OBJECTSPACE_NORMALMAP")};
+const size_t PBRMaterialDefines::Index::OPACITY{boolIndex("OPACITY")};
+const size_t PBRMaterialDefines::Index::OPACITYRGB{boolIndex("OPACITYRGB")};
+const size_t PBRMaterialDefines::Index::PARALLAX{boolIndex("PARALLAX")};
+const size_t PBRMaterialDefines::Index::PARALLAXOCCLUSION{boolIndex("PARALLAXOCCLUSION")};
+const size_t PBRMaterialDefines::Index::POINTSIZE{boolIndex("POINTSIZE")};
+const size_t PBRMaterialDefines::Index::PREMULTIPLYALPHA{boolIndex("PREMULTIPLYALPHA")};
+const size_t PBRMaterialDefines::Index::PREPASS{boolIndex("PREPASS")};
+const size_t PBRMaterialDefines::Index::RADIANCEOCCLUSION{boolIndex("RADIANCEOCCLUSION")};
+const size_t PBRMaterialDefines::Index::RADIANCEOVERALPHA{boolIndex("RADIANCEOVERALPHA")};
+const size_t PBRMaterialDefines::Index::REALTIME_FILTERING{boolIndex("REALTIME_FILTERING")};
+const size_t PBRMaterialDefines::Index::REFLECTION{boolIndex("REFLECTION")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_3D{boolIndex("REFLECTIONMAP_3D")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_CUBIC{boolIndex("REFLECTIONMAP_CUBIC")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_EQUIRECTANGULAR{
+  boolIndex("REFLECTIONMAP_EQUIRECTANGULAR")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_EQUIRECTANGULAR_FIXED{
+  boolIndex("REFLECTIONMAP_EQUIRECTANGULAR_FIXED")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_EXPLICIT{boolIndex("REFLECTIONMAP_EXPLICIT")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED{
+  boolIndex("REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_OPPOSITEZ{
+  boolIndex("REFLECTIONMAP_OPPOSITEZ")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_PLANAR{boolIndex("REFLECTIONMAP_PLANAR")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_PROJECTION{
+  boolIndex("REFLECTIONMAP_PROJECTION")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_SKYBOX{boolIndex("REFLECTIONMAP_SKYBOX")};
+const size_t PBRMaterialDefines::Index::REFLECTIONMAP_SPHERICAL{
+  boolIndex("REFLECTIONMAP_SPHERICAL")};
+const size_t PBRMaterialDefines::Index::REFLECTIVITY{boolIndex("REFLECTIVITY")};
+const size_t PBRMaterialDefines::Index::RGBDLIGHTMAP{boolIndex("RGBDLIGHTMAP")};
+const size_t PBRMaterialDefines::Index::RGBDREFLECTION{boolIndex("RGBDREFLECTION")};
+const size_t PBRMaterialDefines::Index::ROUGHNESSSTOREINMETALMAPALPHA{
+  boolIndex("ROUGHNESSSTOREINMETALMAPALPHA")};
+const size_t PBRMaterialDefines::Index::ROUGHNESSSTOREINMETALMAPGREEN{
+  boolIndex("ROUGHNESSSTOREINMETALMAPGREEN")};
+const size_t PBRMaterialDefines::Index::SPECULARAA{boolIndex("SPECULARAA")};
+const size_t PBRMaterialDefines::Index::SPECULAROVERALPHA{boolIndex("SPECULAROVERALPHA")};
+const size_t PBRMaterialDefines::Index::SPECULARTERM{boolIndex("SPECULARTERM")};
+const size_t PBRMaterialDefines::Index::SPHERICAL_HARMONICS{boolIndex("SPHERICAL_HARMONICS")};
+const size_t PBRMaterialDefines::Index::SS_REFRACTION{boolIndex("SS_REFRACTION")};
+const size_t PBRMaterialDefines::Index::TANGENT{boolIndex("TANGENT")};
+const size_t PBRMaterialDefines::Index::THIN_INSTANCES{boolIndex("THIN_INSTANCES")};
+const size_t PBRMaterialDefines::Index::TWOSIDEDLIGHTING{boolIndex("TWOSIDEDLIGHTING")};
+const size_t PBRMaterialDefines::Index::UNLIT{boolIndex("UNLIT")};
+const size_t PBRMaterialDefines::Index::USEGLTFLIGHTFALLOFF{boolIndex("USEGLTFLIGHTFALLOFF")};
+const size_t PBRMaterialDefines::Index::USEIRRADIANCEMAP{boolIndex("USEIRRADIANCEMAP")};
+const size_t PBRMaterialDefines::Index::USELIGHTMAPASSHADOWMAP{boolIndex("USELIGHTMAPASSHADOWMAP")};
+const size_t PBRMaterialDefines::Index::USEPHYSICALLIGHTFALLOFF{
+  boolIndex("USEPHYSICALLIGHTFALLOFF")};
+const size_t PBRMaterialDefines::Index::USESPHERICALFROMREFLECTIONMAP{
+  boolIndex("USESPHERICALFROMREFLECTIONMAP")};
+const size_t PBRMaterialDefines::Index::USESPHERICALINVERTEX{boolIndex("USESPHERICALINVERTEX")};
+const size_t PBRMaterialDefines::Index::USE_LOCAL_REFLECTIONMAP_CUBIC{
+  boolIndex("USE_LOCAL_REFLECTIONMAP_CUBIC")};
+const size_t PBRMaterialDefines::Index::UV1{boolIndex("UV1")};
+const size_t PBRMaterialDefines::Index::UV2{boolIndex("UV2")};
+const size_t PBRMaterialDefines::Index::VERTEXCOLOR{boolIndex("VERTEXCOLOR")};
+
+// Numeric defines
+const size_t PBRMaterialDefines::Index::DEBUGMODE{intIndex("DEBUGMODE")};
+const size_t PBRMaterialDefines::Index::NUM_MORPH_INFLUENCERS{intIndex("NUM_MORPH_INFLUENCERS")};
+const size_t PBRMaterialDefines::Index::NUM_SAMPLES{intIndex("NUM_SAMPLES")};
+
+PBRMaterialDefines::PBRMaterialDefines()
+{
+  _useSchema(pbrMaterialDefinesSchema());
 
   stringDef = {
     {"ALPHATESTVALUE", "0.5"}, //
@@ -262,4 +388,9 @@ std::string PBRMaterialDefines::toString() const
   return oss.str();
 }
 
+uint64_t PBRMaterialDefines::hash() const
+{
+  return MaterialDefines::hash() ^ IImageProcessingConfigurationDefines::convertToHash();
+}
+
 } // end of namespace BABYLON
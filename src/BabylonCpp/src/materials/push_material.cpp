@@ -9,7 +9,11 @@
 namespace BABYLON {
 
 PushMaterial::PushMaterial(const std::string& iName, Scene* scene)
-    : Material{iName, scene}, _activeEffect{nullptr}
+    : Material{iName, scene}
+    , _activeEffect{nullptr}
+    , _uniformHandlesEffectId{std::numeric_limits<size_t>::max()}
+    , _worldHandle{-1}
+    , _normalMatrixHandle{-1}
 {
   _storeEffectOnSubMeshes = true;
 }
@@ -58,12 +62,25 @@ bool PushMaterial::_isReadyForSubMesh(SubMesh* subMesh)
 
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world, const EffectPtr& /*effectOverride*/)
 {
-  _activeEffect->setMatrix("world", world);
+  _resolveUniformHandles();
+  _activeEffect->setMatrix(_worldHandle, world);
 }
 
 void PushMaterial::bindOnlyNormalMatrix(Matrix& normalMatrix)
 {
-  _activeEffect->setMatrix("normalMatrix", normalMatrix);
+  _resolveUniformHandles();
+  _activeEffect->setMatrix(_normalMatrixHandle, normalMatrix);
+}
+
+void PushMaterial::_resolveUniformHandles()
+{
+  if (_activeEffect->uniqueId == _uniformHandlesEffectId) {
+    return;
+  }
+
+  _uniformHandlesEffectId = _activeEffect->uniqueId;
+  _worldHandle            = _activeEffect->getUniformHandle("world");
+  _normalMatrixHandle     = _activeEffect->getUniformHandle("normalMatrix");
 }
 
 void PushMaterial::bind(Matrix& world, Mesh* mesh, const EffectPtr& /*effectOverride*/)
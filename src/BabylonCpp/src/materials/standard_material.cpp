@@ -38,6 +38,12 @@
 
 namespace BABYLON {
 
+namespace {
+
+using DefineIndex = StandardMaterialDefines::Index;
+
+} // end of anonymous namespace
+
 bool StandardMaterial::_DiffuseTextureEnabled      = true;
 bool StandardMaterial::_AmbientTextureEnabled      = true;
 bool StandardMaterial::_OpacityTextureEnabled      = true;
@@ -179,6 +185,9 @@ StandardMaterial::StandardMaterial(const std::string& iName, Scene* scene)
     , _invertNormalMapY{false}
     , _twoSidedLighting{false}
     , _imageProcessingObserver{nullptr}
+    , _effectHandlesId{std::nullopt}
+    , _alphaCutOffHandle{-1}
+    , _ambientColorHandle{-1}
 {
   // Setup the default processing configuration to the scene.
   _attachImageProcessingConfiguration(nullptr);
@@ -283,6 +292,9 @@ StandardMaterial::StandardMaterial(const StandardMaterial& other)
                                 &StandardMaterial::set_cameraColorGradingTexture}
     , cameraColorCurves{this, &StandardMaterial::get_cameraColorCurves,
                         &StandardMaterial::set_cameraColorCurves}
+    , _effectHandlesId{std::nullopt}
+    , _alphaCutOffHandle{-1}
+    , _ambientColorHandle{-1}
 {
   // Base material
   other.copyTo(dynamic_cast<PushMaterial*>(this));
@@ -456,9 +468,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
 
   // Textures
   if (defines._areTexturesDirty) {
-    defines._needUVs           = false;
-    defines.boolDef["MAINUV1"] = false;
-    defines.boolDef["MAINUV2"] = false;
+    defines._needUVs                      = false;
+    defines.boolDef[DefineIndex::MAINUV1] = false;
+    defines.boolDef[DefineIndex::MAINUV2] = false;
     if (scene->texturesEnabled()) {
       if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
         if (!_diffuseTexture->isReadyOrNotBlocking()) {
@@ -469,7 +481,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
       }
       else {
-        defines.boolDef["DIFFUSE"] = false;
+        defines.boolDef[DefineIndex::DIFFUSE] = false;
       }
 
       if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
@@ -481,7 +493,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
       }
       else {
-        defines.boolDef["AMBIENT"] = false;
+        defines.boolDef[DefineIndex::AMBIENT] = false;
       }
 
       if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
@@ -490,11 +502,11 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_opacityTexture, defines, "OPACITY");
-          defines.boolDef["OPACITYRGB"] = _opacityTexture->getAlphaFromRGB;
+          defines.boolDef[DefineIndex::OPACITYRGB] = _opacityTexture->getAlphaFromRGB;
         }
       }
       else {
-        defines.boolDef["OPACITY"] = false;
+        defines.boolDef[DefineIndex::OPACITY] = false;
       }
 
       if (_reflectionTexture && StandardMaterial::ReflectionTextureEnabled()) {
@@ -502,18 +514,18 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
           return false;
         }
         else {
-          defines._needNormals          = true;
-          defines.boolDef["REFLECTION"] = true;
+          defines._needNormals                     = true;
+          defines.boolDef[DefineIndex::REFLECTION] = true;
 
-          defines.boolDef["ROUGHNESS"]           = (_roughness > 0);
-          defines.boolDef["REFLECTIONOVERALPHA"] = _useReflectionOverAlpha;
-          defines.boolDef["INVERTCUBICMAP"]
+          defines.boolDef[DefineIndex::ROUGHNESS]           = (_roughness > 0);
+          defines.boolDef[DefineIndex::REFLECTIONOVERALPHA] = _useReflectionOverAlpha;
+          defines.boolDef[DefineIndex::INVERTCUBICMAP]
             = (_reflectionTexture->coordinatesMode() == TextureConstants::INVCUBIC_MODE);
-          defines.boolDef["REFLECTIONMAP_3D"]        = _reflectionTexture->isCube();
-          defines.boolDef["RGBDREFLECTION"]          = _reflectionTexture->isRGBD();
-          defines.boolDef["REFLECTIONMAP_OPPOSITEZ"] = getScene()->useRightHandedSystem() ?
-                                                         !_reflectionTexture->invertZ :
-                                                         _reflectionTexture->invertZ;
+          defines.boolDef[DefineIndex::REFLECTIONMAP_3D] = _reflectionTexture->isCube();
+          defines.boolDef[DefineIndex::RGBDREFLECTION]   = _reflectionTexture->isRGBD();
+          defines.boolDef[DefineIndex::REFLECTIONMAP_OPPOSITEZ]
+            = getScene()->useRightHandedSystem() ? !_reflectionTexture->invertZ :
+                                                   _reflectionTexture->invertZ;
 
           switch (_reflectionTexture->coordinatesMode()) {
             case TextureConstants::EXPLICIT_MODE:
@@ -546,13 +558,13 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
               break;
           }
 
-          defines.boolDef["USE_LOCAL_REFLECTIONMAP_CUBIC"]
+          defines.boolDef[DefineIndex::USE_LOCAL_REFLECTIONMAP_CUBIC]
             = static_cast<bool>(_reflectionTexture->boundingBoxSize());
         }
       }
       else {
-        defines.boolDef["REFLECTION"]              = false;
-        defines.boolDef["REFLECTIONMAP_OPPOSITEZ"] = false;
+        defines.boolDef[DefineIndex::REFLECTION]              = false;
+        defines.boolDef[DefineIndex::REFLECTIONMAP_OPPOSITEZ] = false;
       }
 
       if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
@@ -564,7 +576,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
       }
       else {
-        defines.boolDef["EMISSIVE"] = false;
+        defines.boolDef[DefineIndex::EMISSIVE] = false;
       }
 
       if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
@@ -573,12 +585,12 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_lightmapTexture, defines, "LIGHTMAP");
-          defines.boolDef["USELIGHTMAPASSHADOWMAP"] = _useLightmapAsShadowmap;
-          defines.boolDef["RGBDLIGHTMAP"]           = _lightmapTexture->isRGBD();
+          defines.boolDef[DefineIndex::USELIGHTMAPASSHADOWMAP] = _useLightmapAsShadowmap;
+          defines.boolDef[DefineIndex::RGBDLIGHTMAP]           = _lightmapTexture->isRGBD();
         }
       }
       else {
-        defines.boolDef["LIGHTMAP"] = false;
+        defines.boolDef[DefineIndex::LIGHTMAP] = false;
       }
 
       if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
@@ -587,11 +599,11 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         }
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_specularTexture, defines, "SPECULAR");
-          defines.boolDef["GLOSSINESS"] = _useGlossinessFromSpecularMapAlpha;
+          defines.boolDef[DefineIndex::GLOSSINESS] = _useGlossinessFromSpecularMapAlpha;
         }
       }
       else {
-        defines.boolDef["SPECULAR"] = false;
+        defines.boolDef[DefineIndex::SPECULAR] = false;
       }
 
       if (scene->getEngine()->getCaps().standardDerivatives && _bumpTexture
@@ -603,14 +615,14 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         else {
           MaterialHelper::PrepareDefinesForMergedUV(_bumpTexture, defines, "BUMP");
 
-          defines.boolDef["PARALLAX"]          = _useParallax;
-          defines.boolDef["PARALLAXOCCLUSION"] = _useParallaxOcclusion;
+          defines.boolDef[DefineIndex::PARALLAX]          = _useParallax;
+          defines.boolDef[DefineIndex::PARALLAXOCCLUSION] = _useParallaxOcclusion;
         }
 
-        defines.boolDef["OBJECTSPACE_NORMALMAP"] = _useObjectSpaceNormalMap;
+        defines.boolDef[DefineIndex::OBJECTSPACE_NORMALMAP] = _useObjectSpaceNormalMap;
       }
       else {
-        defines.boolDef["BUMP"] = false;
+        defines.boolDef[DefineIndex::BUMP] = false;
       }
 
       if (_refractionTexture && StandardMaterial::RefractionTextureEnabled()) {
@@ -618,45 +630,46 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
           return false;
         }
         else {
-          defines._needUVs              = true;
-          defines.boolDef["REFRACTION"] = true;
+          defines._needUVs                         = true;
+          defines.boolDef[DefineIndex::REFRACTION] = true;
 
-          defines.boolDef["REFRACTIONMAP_3D"] = _refractionTexture->isCube();
-          defines.boolDef["RGBDREFRACTION"]   = _refractionTexture->isRGBD();
+          defines.boolDef[DefineIndex::REFRACTIONMAP_3D] = _refractionTexture->isCube();
+          defines.boolDef[DefineIndex::RGBDREFRACTION]   = _refractionTexture->isRGBD();
         }
       }
       else {
-        defines.boolDef["REFRACTION"] = false;
+        defines.boolDef[DefineIndex::REFRACTION] = false;
       }
 
-      defines.boolDef["TWOSIDEDLIGHTING"] = !_backFaceCulling && _twoSidedLighting;
+      defines.boolDef[DefineIndex::TWOSIDEDLIGHTING] = !_backFaceCulling && _twoSidedLighting;
     }
     else {
-      defines.boolDef["DIFFUSE"]    = false;
-      defines.boolDef["AMBIENT"]    = false;
-      defines.boolDef["OPACITY"]    = false;
-      defines.boolDef["REFLECTION"] = false;
-      defines.boolDef["EMISSIVE"]   = false;
-      defines.boolDef["LIGHTMAP"]   = false;
-      defines.boolDef["BUMP"]       = false;
-      defines.boolDef["REFRACTION"] = false;
+      defines.boolDef[DefineIndex::DIFFUSE]    = false;
+      defines.boolDef[DefineIndex::AMBIENT]    = false;
+      defines.boolDef[DefineIndex::OPACITY]    = false;
+      defines.boolDef[DefineIndex::REFLECTION] = false;
+      defines.boolDef[DefineIndex::EMISSIVE]   = false;
+      defines.boolDef[DefineIndex::LIGHTMAP]   = false;
+      defines.boolDef[DefineIndex::BUMP]       = false;
+      defines.boolDef[DefineIndex::REFRACTION] = false;
     }
 
-    defines.boolDef["ALPHAFROMDIFFUSE"] = _shouldUseAlphaFromDiffuseTexture();
+    defines.boolDef[DefineIndex::ALPHAFROMDIFFUSE] = _shouldUseAlphaFromDiffuseTexture();
 
-    defines.boolDef["EMISSIVEASILLUMINATION"] = _useEmissiveAsIllumination;
+    defines.boolDef[DefineIndex::EMISSIVEASILLUMINATION] = _useEmissiveAsIllumination;
 
-    defines.boolDef["LINKEMISSIVEWITHDIFFUSE"] = _linkEmissiveWithDiffuse;
+    defines.boolDef[DefineIndex::LINKEMISSIVEWITHDIFFUSE] = _linkEmissiveWithDiffuse;
 
-    defines.boolDef["SPECULAROVERALPHA"] = _useSpecularOverAlpha;
+    defines.boolDef[DefineIndex::SPECULAROVERALPHA] = _useSpecularOverAlpha;
 
-    defines.boolDef["PREMULTIPLYALPHA"]
+    defines.boolDef[DefineIndex::PREMULTIPLYALPHA]
       = (alphaMode() == Constants::ALPHA_PREMULTIPLIED
          || alphaMode() == Constants::ALPHA_PREMULTIPLIED_PORTERDUFF);
 
-    defines.boolDef["ALPHATEST_AFTERALLALPHACOMPUTATIONS"] = transparencyMode().has_value();
+    defines.boolDef[DefineIndex::ALPHATEST_AFTERALLALPHACOMPUTATIONS]
+      = transparencyMode().has_value();
 
-    defines.boolDef["ALPHABLEND"]
+    defines.boolDef[DefineIndex::ALPHABLEND]
       = !transparencyMode().has_value()
         || needAlphaBlendingForMesh(*mesh); // check on null for backward compatibility
   }
@@ -672,9 +685,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
 
     _imageProcessingConfiguration->prepareDefines(defines);
 
-    defines.boolDef["IS_REFLECTION_LINEAR"]
+    defines.boolDef[DefineIndex::IS_REFLECTION_LINEAR]
       = (reflectionTexture() != nullptr && !reflectionTexture()->gammaSpace);
-    defines.boolDef["IS_REFRACTION_LINEAR"]
+    defines.boolDef[DefineIndex::IS_REFRACTION_LINEAR]
       = (refractionTexture() != nullptr && !refractionTexture()->gammaSpace);
   }
 
@@ -684,29 +697,30 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
       if (_diffuseFresnelParameters || _opacityFresnelParameters || _emissiveFresnelParameters
           || _refractionFresnelParameters || _reflectionFresnelParameters) {
 
-        defines.boolDef["DIFFUSEFRESNEL"]
+        defines.boolDef[DefineIndex::DIFFUSEFRESNEL]
           = (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled());
 
-        defines.boolDef["OPACITYFRESNEL"]
+        defines.boolDef[DefineIndex::OPACITYFRESNEL]
           = (_opacityFresnelParameters && _opacityFresnelParameters->isEnabled());
 
-        defines.boolDef["REFLECTIONFRESNEL"]
+        defines.boolDef[DefineIndex::REFLECTIONFRESNEL]
           = (_reflectionFresnelParameters && _reflectionFresnelParameters->isEnabled());
 
-        defines.boolDef["REFLECTIONFRESNELFROMSPECULAR"] = _useReflectionFresnelFromSpecular;
+        defines.boolDef[DefineIndex::REFLECTIONFRESNELFROMSPECULAR]
+          = _useReflectionFresnelFromSpecular;
 
-        defines.boolDef["REFRACTIONFRESNEL"]
+        defines.boolDef[DefineIndex::REFRACTIONFRESNEL]
           = (_refractionFresnelParameters && _refractionFresnelParameters->isEnabled());
 
-        defines.boolDef["EMISSIVEFRESNEL"]
+        defines.boolDef[DefineIndex::EMISSIVEFRESNEL]
           = (_emissiveFresnelParameters && _emissiveFresnelParameters->isEnabled());
 
-        defines._needNormals       = true;
-        defines.boolDef["FRESNEL"] = true;
+        defines._needNormals                  = true;
+        defines.boolDef[DefineIndex::FRESNEL] = true;
       }
     }
     else {
-      defines.boolDef["FRESNEL"] = false;
+      defines.boolDef[DefineIndex::FRESNEL] = false;
     }
   }
 
@@ -726,6 +740,13 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
   // External config
   detailMap->prepareDefines(defines, scene);
 
+  // Keep the current effect when the defines it was created with did not change. The define
+  // string is compared as well, a hash match alone does not rule out a collision.
+  if (defines.isDirty() && subMesh->effect() && !customShaderNameResolve
+      && defines._effectHash == defines.hash() && defines._effectDefines == defines.toString()) {
+    defines.markAsProcessed();
+  }
+
   // Get correct effect
   if (defines.isDirty()) {
     const auto lightDisposed = defines._areLightsDisposed;
@@ -733,93 +754,94 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
 
     // Fallbacks
     auto fallbacks = std::make_unique<EffectFallbacks>();
-    if (defines["REFLECTION"]) {
+    if (defines[DefineIndex::REFLECTION]) {
       fallbacks->addFallback(0, "REFLECTION");
     }
 
-    if (defines["SPECULAR"]) {
+    if (defines[DefineIndex::SPECULAR]) {
       fallbacks->addFallback(0, "SPECULAR");
     }
 
-    if (defines["BUMP"]) {
+    if (defines[DefineIndex::BUMP]) {
       fallbacks->addFallback(0, "BUMP");
     }
 
-    if (defines["PARALLAX"]) {
+    if (defines[DefineIndex::PARALLAX]) {
       fallbacks->addFallback(1, "PARALLAX");
     }
 
-    if (defines["PARALLAXOCCLUSION"]) {
+    if (defines[DefineIndex::PARALLAXOCCLUSION]) {
       fallbacks->addFallback(0, "PARALLAXOCCLUSION");
     }
 
-    if (defines["SPECULAROVERALPHA"]) {
+    if (defines[DefineIndex::SPECULAROVERALPHA]) {
       fallbacks->addFallback(0, "SPECULAROVERALPHA");
     }
 
-    if (defines["FOG"]) {
+    if (defines[DefineIndex::FOG]) {
       fallbacks->addFallback(1, "FOG");
     }
 
-    if (defines["POINTSIZE"]) {
+    if (defines[DefineIndex::POINTSIZE]) {
       fallbacks->addFallback(0, "POINTSIZE");
     }
 
-    if (defines["LOGARITHMICDEPTH"]) {
+    if (defines[DefineIndex::LOGARITHMICDEPTH]) {
       fallbacks->addFallback(0, "LOGARITHMICDEPTH");
     }
 
     MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks, _maxSimultaneousLights);
 
-    if (defines["SPECULARTERM"]) {
+    if (defines[DefineIndex::SPECULARTERM]) {
       fallbacks->addFallback(0, "SPECULARTERM");
     }
 
-    if (defines["DIFFUSEFRESNEL"]) {
+    if (defines[DefineIndex::DIFFUSEFRESNEL]) {
       fallbacks->addFallback(1, "DIFFUSEFRESNEL");
     }
 
-    if (defines["OPACITYFRESNEL"]) {
+    if (defines[DefineIndex::OPACITYFRESNEL]) {
       fallbacks->addFallback(2, "OPACITYFRESNEL");
     }
 
-    if (defines["REFLECTIONFRESNEL"]) {
+    if (defines[DefineIndex::REFLECTIONFRESNEL]) {
       fallbacks->addFallback(3, "REFLECTIONFRESNEL");
     }
 
-    if (defines["EMISSIVEFRESNEL"]) {
+    if (defines[DefineIndex::EMISSIVEFRESNEL]) {
       fallbacks->addFallback(4, "EMISSIVEFRESNEL");
     }
 
-    if (defines["FRESNEL"]) {
+    if (defines[DefineIndex::FRESNEL]) {
       fallbacks->addFallback(4, "FRESNEL");
     }
 
-    if (defines["MULTIVIEW"]) {
+    if (defines[DefineIndex::MULTIVIEW]) {
       fallbacks->addFallback(0, "MULTIVIEW");
     }
 
     // Attributes
     std::vector<std::string> attribs{VertexBuffer::PositionKind};
 
-    if (defines["NORMAL"]) {
+    if (defines[DefineIndex::NORMAL]) {
       attribs.emplace_back(VertexBuffer::NormalKind);
     }
 
-    if (defines["UV1"]) {
+    if (defines[DefineIndex::UV1]) {
       attribs.emplace_back(VertexBuffer::UVKind);
     }
 
-    if (defines["UV2"]) {
+    if (defines[DefineIndex::UV2]) {
       attribs.emplace_back(VertexBuffer::UV2Kind);
     }
 
-    if (defines["VERTEXCOLOR"]) {
+    if (defines[DefineIndex::VERTEXCOLOR]) {
       attribs.emplace_back(VertexBuffer::ColorKind);
     }
 
     MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
     MaterialHelper::PrepareAttributesForInstances(attribs, defines);
+    MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
     MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
 
     std::string shaderName{"default"};
@@ -898,7 +920,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
 
     std::unordered_map<std::string, unsigned int> indexParameters{
       {"maxSimultaneousLights", _maxSimultaneousLights},
-      {"maxSimultaneousMorphTargets", defines.intDef["NUM_MORPH_INFLUENCERS"]}};
+      {"maxSimultaneousMorphTargets", defines.intDef[DefineIndex::NUM_MORPH_INFLUENCERS]}};
 
     IEffectCreationOptions options;
     options.attributes            = attribs;
@@ -912,7 +934,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
     options.onError               = onError;
     options.indexParameters       = std::move(indexParameters);
     options.maxSimultaneousLights = _maxSimultaneousLights;
-    options.multiTarget           = defines["PREPASS"];
+    options.multiTarget           = defines[DefineIndex::PREPASS];
 
     MaterialHelper::PrepareUniformsAndSamplersList(options);
 
@@ -950,6 +972,8 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh, b
         _rebuildInParallel = false;
         scene->resetCachedMaterial();
         subMesh->setEffect(effect, definesPtr);
+        defines._effectHash    = defines.hash();
+        defines._effectDefines = join;
         buildUniformLayout();
       }
     }
@@ -969,48 +993,60 @@ void StandardMaterial::buildUniformLayout()
 {
   // Order is important !
   auto& ubo = *_uniformBuffer;
-  ubo.addUniform("diffuseLeftColor", 4);
-  ubo.addUniform("diffuseRightColor", 4);
-  ubo.addUniform("opacityParts", 4);
-  ubo.addUniform("reflectionLeftColor", 4);
-  ubo.addUniform("reflectionRightColor", 4);
-  ubo.addUniform("refractionLeftColor", 4);
-  ubo.addUniform("refractionRightColor", 4);
-  ubo.addUniform("emissiveLeftColor", 4);
-  ubo.addUniform("emissiveRightColor", 4);
-
-  ubo.addUniform("vDiffuseInfos", 2);
-  ubo.addUniform("vAmbientInfos", 2);
-  ubo.addUniform("vOpacityInfos", 2);
-  ubo.addUniform("vReflectionInfos", 2);
-  ubo.addUniform("vReflectionPosition", 3);
-  ubo.addUniform("vReflectionSize", 3);
-  ubo.addUniform("vEmissiveInfos", 2);
-  ubo.addUniform("vLightmapInfos", 2);
-  ubo.addUniform("vSpecularInfos", 2);
-  ubo.addUniform("vBumpInfos", 3);
-
-  ubo.addUniform("diffuseMatrix", 16);
-  ubo.addUniform("ambientMatrix", 16);
-  ubo.addUniform("opacityMatrix", 16);
-  ubo.addUniform("reflectionMatrix", 16);
-  ubo.addUniform("emissiveMatrix", 16);
-  ubo.addUniform("lightmapMatrix", 16);
-  ubo.addUniform("specularMatrix", 16);
-  ubo.addUniform("bumpMatrix", 16);
-  ubo.addUniform("vTangentSpaceParams", 2);
-  ubo.addUniform("pointSize", 1);
-  ubo.addUniform("refractionMatrix", 16);
-  ubo.addUniform("vRefractionInfos", 4);
-  ubo.addUniform("vSpecularColor", 4);
-  ubo.addUniform("vEmissiveColor", 3);
-  ubo.addUniform("vDiffuseColor", 4);
+
+  _uboHandles.diffuseLeftColor     = ubo.addUniform("diffuseLeftColor", 4);
+  _uboHandles.diffuseRightColor    = ubo.addUniform("diffuseRightColor", 4);
+  _uboHandles.opacityParts         = ubo.addUniform("opacityParts", 4);
+  _uboHandles.reflectionLeftColor  = ubo.addUniform("reflectionLeftColor", 4);
+  _uboHandles.reflectionRightColor = ubo.addUniform("reflectionRightColor", 4);
+  _uboHandles.refractionLeftColor  = ubo.addUniform("refractionLeftColor", 4);
+  _uboHandles.refractionRightColor = ubo.addUniform("refractionRightColor", 4);
+  _uboHandles.emissiveLeftColor    = ubo.addUniform("emissiveLeftColor", 4);
+  _uboHandles.emissiveRightColor   = ubo.addUniform("emissiveRightColor", 4);
+
+  _uboHandles.vDiffuseInfos       = ubo.addUniform("vDiffuseInfos", 2);
+  _uboHandles.vAmbientInfos       = ubo.addUniform("vAmbientInfos", 2);
+  _uboHandles.vOpacityInfos       = ubo.addUniform("vOpacityInfos", 2);
+  _uboHandles.vReflectionInfos    = ubo.addUniform("vReflectionInfos", 2);
+  _uboHandles.vReflectionPosition = ubo.addUniform("vReflectionPosition", 3);
+  _uboHandles.vReflectionSize     = ubo.addUniform("vReflectionSize", 3);
+  _uboHandles.vEmissiveInfos      = ubo.addUniform("vEmissiveInfos", 2);
+  _uboHandles.vLightmapInfos      = ubo.addUniform("vLightmapInfos", 2);
+  _uboHandles.vSpecularInfos      = ubo.addUniform("vSpecularInfos", 2);
+  _uboHandles.vBumpInfos          = ubo.addUniform("vBumpInfos", 3);
+
+  _uboHandles.diffuseMatrix       = ubo.addUniform("diffuseMatrix", 16);
+  _uboHandles.ambientMatrix       = ubo.addUniform("ambientMatrix", 16);
+  _uboHandles.opacityMatrix       = ubo.addUniform("opacityMatrix", 16);
+  _uboHandles.reflectionMatrix    = ubo.addUniform("reflectionMatrix", 16);
+  _uboHandles.emissiveMatrix      = ubo.addUniform("emissiveMatrix", 16);
+  _uboHandles.lightmapMatrix      = ubo.addUniform("lightmapMatrix", 16);
+  _uboHandles.specularMatrix      = ubo.addUniform("specularMatrix", 16);
+  _uboHandles.bumpMatrix          = ubo.addUniform("bumpMatrix", 16);
+  _uboHandles.vTangentSpaceParams = ubo.addUniform("vTangentSpaceParams", 2);
+  _uboHandles.pointSize           = ubo.addUniform("pointSize", 1);
+  _uboHandles.refractionMatrix    = ubo.addUniform("refractionMatrix", 16);
+  _uboHandles.vRefractionInfos    = ubo.addUniform("vRefractionInfos", 4);
+  _uboHandles.vSpecularColor      = ubo.addUniform("vSpecularColor", 4);
+  _uboHandles.vEmissiveColor      = ubo.addUniform("vEmissiveColor", 3);
+  _uboHandles.vDiffuseColor       = ubo.addUniform("vDiffuseColor", 4);
 
   DetailMapConfiguration::PrepareUniformBuffer(ubo);
 
   ubo.create();
 }
 
+void StandardMaterial::_resolveEffectUniformHandles()
+{
+  if (_effectHandlesId == _activeEffect->uniqueId) {
+    return;
+  }
+
+  _effectHandlesId    = _activeEffect->uniqueId;
+  _alphaCutOffHandle  = _activeEffect->getUniformHandle("alphaCutOff");
+  _ambientColorHandle = _activeEffect->getUniformHandle("vAmbientColor");
+}
+
 void StandardMaterial::unbind()
 {
   if (_activeEffect) {
@@ -1041,13 +1077,14 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
     return;
   }
   _activeEffect = effect;
+  _resolveEffectUniformHandles();
 
   // Matrices Mesh.
   mesh->getMeshUniformBuffer()->bindToEffect(effect.get(), "Mesh");
@@ -1057,7 +1094,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   prePassConfiguration->bindForSubMesh(_activeEffect, scene, mesh, world, isFrozen());
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[DefineIndex::OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1066,6 +1103,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
 
   // Bones
   MaterialHelper::BindBonesParameters(mesh, effect.get());
+  MaterialHelper::BindBakedVertexAnimationParameters(mesh, effect.get(), defines);
   auto& ubo = *_uniformBuffer;
   if (mustRebind) {
     ubo.bindToEffect(effect.get(), "Material");
@@ -1073,143 +1111,156 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     bindViewProjection(effect);
     if (!ubo.useUbo() || !isFrozen() || !ubo.isSync()) {
 
-      if (StandardMaterial::FresnelEnabled() && defines["FRESNEL"]) {
+      if (StandardMaterial::FresnelEnabled() && defines[DefineIndex::FRESNEL]) {
         // Fresnel
         if (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled()) {
-          ubo.updateColor4("diffuseLeftColor", _diffuseFresnelParameters->leftColor,
-                           _diffuseFresnelParameters->power, "");
-          ubo.updateColor4("diffuseRightColor", _diffuseFresnelParameters->rightColor,
-                           _diffuseFresnelParameters->bias, "");
+          ubo.updateColor4(_uboHandles.diffuseLeftColor, _diffuseFresnelParameters->leftColor,
+                           _diffuseFresnelParameters->power);
+          ubo.updateColor4(_uboHandles.diffuseRightColor, _diffuseFresnelParameters->rightColor,
+                           _diffuseFresnelParameters->bias);
         }
 
         if (_opacityFresnelParameters && _opacityFresnelParameters->isEnabled()) {
-          ubo.updateColor4("opacityParts",
+          ubo.updateColor4(_uboHandles.opacityParts,
                            Color3(_opacityFresnelParameters->leftColor.toLuminance(),
                                   _opacityFresnelParameters->rightColor.toLuminance(),
                                   _opacityFresnelParameters->bias),
-                           _opacityFresnelParameters->power, "");
+                           _opacityFresnelParameters->power);
         }
 
         if (_reflectionFresnelParameters && _reflectionFresnelParameters->isEnabled()) {
-          ubo.updateColor4("reflectionLeftColor", _reflectionFresnelParameters->leftColor,
-                           _reflectionFresnelParameters->power, "");
-          ubo.updateColor4("reflectionRightColor", _reflectionFresnelParameters->rightColor,
-                           _reflectionFresnelParameters->bias, "");
+          ubo.updateColor4(_uboHandles.reflectionLeftColor,
+                           _reflectionFresnelParameters->leftColor,
+                           _reflectionFresnelParameters->power);
+          ubo.updateColor4(_uboHandles.reflectionRightColor,
+                           _reflectionFresnelParameters->rightColor,
+                           _reflectionFresnelParameters->bias);
         }
 
         if (_refractionFresnelParameters && _refractionFresnelParameters->isEnabled()) {
-          ubo.updateColor4("refractionLeftColor", _refractionFresnelParameters->leftColor,
-                           _refractionFresnelParameters->power, "");
-          ubo.updateColor4("refractionRightColor", _refractionFresnelParameters->rightColor,
-                           _refractionFresnelParameters->bias, "");
+          ubo.updateColor4(_uboHandles.refractionLeftColor,
+                           _refractionFresnelParameters->leftColor,
+                           _refractionFresnelParameters->power);
+          ubo.updateColor4(_uboHandles.refractionRightColor,
+                           _refractionFresnelParameters->rightColor,
+                           _refractionFresnelParameters->bias);
         }
 
         if (_emissiveFresnelParameters && _emissiveFresnelParameters->isEnabled()) {
-          ubo.updateColor4("emissiveLeftColor", _emissiveFresnelParameters->leftColor,
-                           _emissiveFresnelParameters->power, "");
-          ubo.updateColor4("emissiveRightColor", _emissiveFresnelParameters->rightColor,
-                           _emissiveFresnelParameters->bias, "");
+          ubo.updateColor4(_uboHandles.emissiveLeftColor, _emissiveFresnelParameters->leftColor,
+                           _emissiveFresnelParameters->power);
+          ubo.updateColor4(_uboHandles.emissiveRightColor, _emissiveFresnelParameters->rightColor,
+                           _emissiveFresnelParameters->bias);
         }
       }
 
       // Textures
       if (scene->texturesEnabled()) {
         if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
-          ubo.updateFloat2("vDiffuseInfos", static_cast<float>(_diffuseTexture->coordinatesIndex),
-                           static_cast<float>(_diffuseTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, "diffuse");
+          ubo.updateFloat2(_uboHandles.vDiffuseInfos,
+                           static_cast<float>(_diffuseTexture->coordinatesIndex),
+                           static_cast<float>(_diffuseTexture->level));
+          MaterialHelper::BindTextureMatrix(*_diffuseTexture, ubo, _uboHandles.diffuseMatrix);
         }
 
         if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
-          ubo.updateFloat2("vAmbientInfos", static_cast<float>(_ambientTexture->coordinatesIndex),
-                           static_cast<float>(_ambientTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, "ambient");
+          ubo.updateFloat2(_uboHandles.vAmbientInfos,
+                           static_cast<float>(_ambientTexture->coordinatesIndex),
+                           static_cast<float>(_ambientTexture->level));
+          MaterialHelper::BindTextureMatrix(*_ambientTexture, ubo, _uboHandles.ambientMatrix);
         }
 
         if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
-          ubo.updateFloat2("vOpacityInfos", static_cast<float>(_opacityTexture->coordinatesIndex),
-                           static_cast<float>(_opacityTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, "opacity");
+          ubo.updateFloat2(_uboHandles.vOpacityInfos,
+                           static_cast<float>(_opacityTexture->coordinatesIndex),
+                           static_cast<float>(_opacityTexture->level));
+          MaterialHelper::BindTextureMatrix(*_opacityTexture, ubo, _uboHandles.opacityMatrix);
         }
 
         if (_hasAlphaChannel()) {
-          effect->setFloat("alphaCutOff", alphaCutOff);
+          effect->setFloat(_alphaCutOffHandle, alphaCutOff);
         }
 
         if (_reflectionTexture && StandardMaterial::ReflectionTextureEnabled()) {
-          ubo.updateFloat2("vReflectionInfos", _reflectionTexture->level, _roughness, "");
-          ubo.updateMatrix("reflectionMatrix", *_reflectionTexture->getReflectionTextureMatrix());
+          ubo.updateFloat2(_uboHandles.vReflectionInfos, _reflectionTexture->level, _roughness);
+          ubo.updateMatrix(_uboHandles.reflectionMatrix,
+                           *_reflectionTexture->getReflectionTextureMatrix());
 
           if (_reflectionTexture->boundingBoxSize()) {
             if (auto cubeTexture = std::static_pointer_cast<CubeTexture>(_reflectionTexture)) {
-              ubo.updateVector3("vReflectionPosition", cubeTexture->boundingBoxPosition);
-              ubo.updateVector3("vReflectionSize", *cubeTexture->boundingBoxSize());
+              ubo.updateVector3(_uboHandles.vReflectionPosition, cubeTexture->boundingBoxPosition);
+              ubo.updateVector3(_uboHandles.vReflectionSize, *cubeTexture->boundingBoxSize());
             }
           }
         }
 
         if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
-          ubo.updateFloat2("vEmissiveInfos", static_cast<float>(_emissiveTexture->coordinatesIndex),
-                           static_cast<float>(_emissiveTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, "emissive");
+          ubo.updateFloat2(_uboHandles.vEmissiveInfos,
+                           static_cast<float>(_emissiveTexture->coordinatesIndex),
+                           static_cast<float>(_emissiveTexture->level));
+          MaterialHelper::BindTextureMatrix(*_emissiveTexture, ubo, _uboHandles.emissiveMatrix);
         }
 
         if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
-          ubo.updateFloat2("vLightmapInfos", static_cast<float>(_lightmapTexture->coordinatesIndex),
-                           static_cast<float>(_lightmapTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, "lightmap");
+          ubo.updateFloat2(_uboHandles.vLightmapInfos,
+                           static_cast<float>(_lightmapTexture->coordinatesIndex),
+                           static_cast<float>(_lightmapTexture->level));
+          MaterialHelper::BindTextureMatrix(*_lightmapTexture, ubo, _uboHandles.lightmapMatrix);
         }
 
         if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
-          ubo.updateFloat2("vSpecularInfos", static_cast<float>(_specularTexture->coordinatesIndex),
-                           static_cast<float>(_specularTexture->level), "");
-          MaterialHelper::BindTextureMatrix(*_specularTexture, ubo, "specular");
+          ubo.updateFloat2(_uboHandles.vSpecularInfos,
+                           static_cast<float>(_specularTexture->coordinatesIndex),
+                           static_cast<float>(_specularTexture->level));
+          MaterialHelper::BindTextureMatrix(*_specularTexture, ubo, _uboHandles.specularMatrix);
         }
 
         if (_bumpTexture && scene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled()) {
-          ubo.updateFloat3("vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
-                           1.f / _bumpTexture->level, parallaxScaleBias, "");
-          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, "bump");
+          ubo.updateFloat3(_uboHandles.vBumpInfos,
+                           static_cast<float>(_bumpTexture->coordinatesIndex),
+                           1.f / _bumpTexture->level, parallaxScaleBias);
+          MaterialHelper::BindTextureMatrix(*_bumpTexture, ubo, _uboHandles.bumpMatrix);
           if (scene->_mirroredCameraPosition) {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? 1.f : -1.f,
-                             _invertNormalMapY ? 1.f : -1.f, "");
+            ubo.updateFloat2(_uboHandles.vTangentSpaceParams, _invertNormalMapX ? 1.f : -1.f,
+                             _invertNormalMapY ? 1.f : -1.f);
           }
           else {
-            ubo.updateFloat2("vTangentSpaceParams", _invertNormalMapX ? -1.f : 1.f,
-                             _invertNormalMapY ? -1.f : 1.f, "");
+            ubo.updateFloat2(_uboHandles.vTangentSpaceParams, _invertNormalMapX ? -1.f : 1.f,
+                             _invertNormalMapY ? -1.f : 1.f);
           }
         }
 
         if (_refractionTexture && StandardMaterial::RefractionTextureEnabled()) {
           float depth = 1.f;
           if (!_refractionTexture->isCube) {
-            ubo.updateMatrix("refractionMatrix", *_refractionTexture->getReflectionTextureMatrix());
+            ubo.updateMatrix(_uboHandles.refractionMatrix,
+                             *_refractionTexture->getReflectionTextureMatrix());
             auto refractionTextureTmp
               = std::static_pointer_cast<RefractionTexture>(_refractionTexture);
             if (refractionTextureTmp) {
               depth = refractionTextureTmp->depth;
             }
           }
-          ubo.updateFloat4("vRefractionInfos", _refractionTexture->level, indexOfRefraction, depth,
-                           invertRefractionY ? -1.f : 1.f, "");
+          ubo.updateFloat4(_uboHandles.vRefractionInfos, _refractionTexture->level,
+                           indexOfRefraction, depth, invertRefractionY ? -1.f : 1.f);
         }
       }
 
       // Point size
       if (pointsCloud()) {
-        ubo.updateFloat("pointSize", pointSize);
+        ubo.updateFloat(_uboHandles.pointSize, pointSize);
       }
 
-      if (defines["SPECULARTERM"]) {
-        ubo.updateColor4("vSpecularColor", specularColor, specularPower, "");
+      if (defines[DefineIndex::SPECULARTERM]) {
+        ubo.updateColor4(_uboHandles.vSpecularColor, specularColor, specularPower);
       }
       ubo.updateColor3(
-        "vEmissiveColor",
-        StandardMaterial::EmissiveTextureEnabled() ? emissiveColor : Color3::BlackReadOnly(), "");
+        _uboHandles.vEmissiveColor,
+        StandardMaterial::EmissiveTextureEnabled() ? emissiveColor : Color3::BlackReadOnly());
 
       // Diffuse
-      ubo.updateColor4("vDiffuseColor", diffuseColor, alpha(), "");
+      ubo.updateColor4(_uboHandles.vDiffuseColor, diffuseColor, alpha());
     }
 
     // Textures
@@ -1272,7 +1323,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
 
     bindEyePosition(effect.get());
 
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    effect->setColor3(_ambientColorHandle, _globalAmbientColor);
   }
 
   if (mustRebind || !isFrozen()) {
@@ -1292,7 +1343,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     MaterialHelper::BindFogParameters(scene, mesh, effect);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    if (defines.intDef[DefineIndex::NUM_MORPH_INFLUENCERS]) {
       MaterialHelper::BindMorphTargetParameters(mesh, effect.get());
     }
 
@@ -5,148 +5,241 @@
 
 namespace BABYLON {
 
+namespace {
+
+MaterialDefinesSchema& standardMaterialDefinesSchema()
+{
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"MAINUV1", false},                                     //
+      {"MAINUV2", false},                                     //
+      {"DIFFUSE", false},                                     //
+      {"DETAIL", false},                                      //
+      {"AMBIENT", false},                                     //
+      {"OPACITY", false},                                     //
+      {"OPACITYRGB", false},                                  //
+      {"REFLECTION", false},                                  //
+      {"EMISSIVE", false},                                    //
+      {"SPECULAR", false},                                    //
+      {"BUMP", false},                                        //
+      {"PARALLAX", false},                                    //
+      {"PARALLAXOCCLUSION", false},                           //
+      {"SPECULAROVERALPHA", false},                           //
+      {"CLIPPLANE", false},                                   //
+      {"CLIPPLANE2", false},                                  //
+      {"CLIPPLANE3", false},                                  //
+      {"CLIPPLANE4", false},                                  //
+      {"CLIPPLANE5", false},                                  //
+      {"CLIPPLANE6", false},                                  //
+      {"ALPHATEST", false},                                   //
+      {"DEPTHPREPASS", false},                                //
+      {"ALPHAFROMDIFFUSE", false},                            //
+      {"POINTSIZE", false},                                   //
+      {"FOG", false},                                         //
+      {"SPECULARTERM", false},                                //
+      {"DIFFUSEFRESNEL", false},                              //
+      {"OPACITYFRESNEL", false},                              //
+      {"REFLECTIONFRESNEL", false},                           //
+      {"REFRACTIONFRESNEL", false},                           //
+      {"EMISSIVEFRESNEL", false},                             //
+      {"FRESNEL", false},                                     //
+      {"NORMAL", false},                                      //
+      {"UV1", false},                                         //
+      {"UV2", false},                                         //
+      {"VERTEXCOLOR", false},                                 //
+      {"VERTEXALPHA", false},                                 //
+      {"BONETEXTURE", false},                                 //
+      {"BONES_VELOCITY_ENABLED", false},                      //
+      {"BAKED_VERTEX_ANIMATION_TEXTURE", false},              //
+      {"INSTANCES", false},                                   //
+      {"THIN_INSTANCES", false},                              //
+      {"GLOSSINESS", false},                                  //
+      {"ROUGHNESS", false},                                   //
+      {"EMISSIVEASILLUMINATION", false},                      //
+      {"LINKEMISSIVEWITHDIFFUSE", false},                     //
+      {"REFLECTIONFRESNELFROMSPECULAR", false},               //
+      {"LIGHTMAP", false},                                    //
+      {"OBJECTSPACE_NORMALMAP", false},                       //
+      {"USELIGHTMAPASSHADOWMAP", false},                      //
+      {"REFLECTIONMAP_3D", false},                            //
+      {"REFLECTIONMAP_SPHERICAL", false},                     //
+      {"REFLECTIONMAP_PLANAR", false},                        //
+      {"REFLECTIONMAP_CUBIC", false},                         //
+      {"USE_LOCAL_REFLECTIONMAP_CUBIC", false},               //
+      {"REFLECTIONMAP_PROJECTION", false},                    //
+      {"REFLECTIONMAP_SKYBOX", false},                        //
+      {"REFLECTIONMAP_EXPLICIT", false},                      //
+      {"REFLECTIONMAP_EQUIRECTANGULAR", false},               //
+      {"REFLECTIONMAP_EQUIRECTANGULAR_FIXED", false},         //
+      {"REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED", false}, //
+      {"REFLECTIONMAP_OPPOSITEZ", false},                     //
+      {"INVERTCUBICMAP", false},                              //
+      {"LOGARITHMICDEPTH", false},                            //
+      {"REFRACTION", false},                                  //
+      {"REFRACTIONMAP_3D", false},                            //
+      {"REFLECTIONOVERALPHA", false},                         //
+      {"TWOSIDEDLIGHTING", false},                            //
+      {"SHADOWFLOAT", false},                                 //
+      {"MORPHTARGETS", false},                                //
+      {"MORPHTARGETS_NORMAL", false},                         //
+      {"MORPHTARGETS_TANGENT", false},                        //
+      {"MORPHTARGETS_UV", false},                             //
+      {"NONUNIFORMSCALING", false},                   // https://playground.babylonjs.com#V6DWIH
+      {"PREMULTIPLYALPHA", false},                    // https://playground.babylonjs.com#LNVJJ7
+      {"ALPHATEST_AFTERALLALPHACOMPUTATIONS", false}, //
+      {"ALPHABLEND", true},                           //
+
+      {"PREPASS", false},              //
+      {"PREPASS_IRRADIANCE", false},   //
+      {"PREPASS_ALBEDO", false},       //
+      {"PREPASS_DEPTH", false},        //
+      {"PREPASS_NORMAL", false},       //
+      {"PREPASS_POSITION", false},     //
+      {"PREPASS_VELOCITY", false},     //
+      {"PREPASS_REFLECTIVITY", false}, //
+
+      {"RGBDLIGHTMAP", false},   //
+      {"RGBDREFLECTION", false}, //
+      {"RGBDREFRACTION", false}, //
+
+      {"IMAGEPROCESSING", false},            //
+      {"VIGNETTE", false},                   //
+      {"VIGNETTEBLENDMODEMULTIPLY", false},  //
+      {"VIGNETTEBLENDMODEOPAQUE", false},    //
+      {"TONEMAPPING", false},                //
+      {"TONEMAPPING_ACES", false},           //
+      {"CONTRAST", false},                   //
+      {"COLORCURVES", false},                //
+      {"COLORGRADING", false},               //
+      {"COLORGRADING3D", false},             //
+      {"SAMPLER3DGREENDEPTH", false},        //
+      {"SAMPLER3DBGRMAP", false},            //
+      {"IMAGEPROCESSINGPOSTPROCESS", false}, //
+      {"MULTIVIEW", false},                  //
+      /**
+       * If the reflection texture on this material is in linear color space
+       * @hidden
+       */
+      {"IS_REFLECTION_LINEAR", false}, //
+      /**
+       * If the refraction texture on this material is in linear color space
+       * @hidden
+       */
+      {"IS_REFRACTION_LINEAR", false}, //
+      {"EXPOSURE", false},             //
+    },
+    // Numeric defines
+    {
+      {"DIFFUSEDIRECTUV", 0},             //
+      {"DETAILDIRECTUV", 0},              //
+      {"DETAIL_NORMALBLENDMETHOD", 0},    //
+      {"AMBIENTDIRECTUV", 0},             //
+      {"OPACITYDIRECTUV", 0},             //
+      {"EMISSIVEDIRECTUV", 0},            //
+      {"SPECULARDIRECTUV", 0},            //
+      {"BUMPDIRECTUV", 0},                //
+      {"NUM_BONE_INFLUENCERS", 0},        //
+      {"BonesPerMesh", 0},                //
+      {"LIGHTMAPDIRECTUV", 0},            //
+      {"NUM_MORPH_INFLUENCERS", 0},       //
+      {"PREPASS_IRRADIANCE_INDEX", -1},   //
+      {"PREPASS_ALBEDO_INDEX", -1},       //
+      {"PREPASS_DEPTH_INDEX", -1},        //
+      {"PREPASS_NORMAL_INDEX", -1},       //
+      {"PREPASS_POSITION_INDEX", -1},     //
+      {"PREPASS_VELOCITY_INDEX", -1},     //
+      {"PREPASS_REFLECTIVITY_INDEX", -1}, //
+      {"SCENE_MRT_COUNT", 0},             //
+    });
+  return schema;
+}
+
+size_t boolIndex(const char* name)
+{
+  return standardMaterialDefinesSchema().boolIndex(name);
+}
+
+size_t intIndex(const char* name)
+{
+  return standardMaterialDefinesSchema().intIndex(name);
+}
+
+} // end of anonymous namespace
+
+// Boolean defines
+const size_t StandardMaterialDefines::Index::ALPHABLEND{boolIndex("ALPHABLEND")};
+const size_t StandardMaterialDefines::Index::ALPHAFROMDIFFUSE{boolIndex("ALPHAFROMDIFFUSE")};
+const size_t StandardMaterialDefines::Index::ALPHATEST_AFTERALLALPHACOMPUTATIONS{
+  boolIndex("ALPHATEST_AFTERALLALPHACOMPUTATIONS")};
+const size_t StandardMaterialDefines::Index::AMBIENT{boolIndex("AMBIENT")};
+const size_t StandardMaterialDefines::Index::BUMP{boolIndex("BUMP")};
+const size_t StandardMaterialDefines::Index::DIFFUSE{boolIndex("DIFFUSE")};
+const size_t StandardMaterialDefines::Index::DIFFUSEFRESNEL{boolIndex("DIFFUSEFRESNEL")};
+const size_t StandardMaterialDefines::Index::EMISSIVE{boolIndex("EMISSIVE")};
+const size_t StandardMaterialDefines::Index::EMISSIVEASILLUMINATION{
+  boolIndex("EMISSIVEASILLUMINATION")};
+const size_t StandardMaterialDefines::Index::EMISSIVEFRESNEL{boolIndex("EMISSIVEFRESNEL")};
+const size_t StandardMaterialDefines::Index::FOG{boolIndex("FOG")};
+const size_t StandardMaterialDefines::Index::FRESNEL{boolIndex("FRESNEL")};
+const size_t StandardMaterialDefines::Index::GLOSSINESS{boolIndex("GLOSSINESS")};
+const size_t StandardMaterialDefines::Index::INVERTCUBICMAP{boolIndex("INVERTCUBICMAP")};
+const size_t StandardMaterialDefines::Index::IS_REFLECTION_LINEAR{
+  boolIndex("IS_REFLECTION_LINEAR")};
+const size_t StandardMaterialDefines::Index::IS_REFRACTION_LINEAR{
+  boolIndex("IS_REFRACTION_LINEAR")};
+const size_t StandardMaterialDefines::Index::LIGHTMAP{boolIndex("LIGHTMAP")};
+const size_t StandardMaterialDefines::Index::LINKEMISSIVEWITHDIFFUSE{
+  boolIndex("LINKEMISSIVEWITHDIFFUSE")};
+const size_t StandardMaterialDefines::Index::LOGARITHMICDEPTH{boolIndex("LOGARITHMICDEPTH")};
+const size_t StandardMaterialDefines::Index::MAINUV1{boolIndex("MAINUV1")};
+const size_t StandardMaterialDefines::Index::MAINUV2{boolIndex("MAINUV2")};
+const size_t StandardMaterialDefines::Index::MULTIVIEW{boolIndex("MULTIVIEW")};
+const size_t StandardMaterialDefines::Index::NORMAL{boolIndex("NORMAL")};
+const size_t StandardMaterialDefines::Index::OBJECTSPACE_NORMALMAP{
+  boolIndex("OBJECTSPACE_NORMALMAP")};
+const size_t StandardMaterialDefines::Index::OPACITY{boolIndex("OPACITY")};
+const size_t StandardMaterialDefines::Index::OPACITYFRESNEL{boolIndex("OPACITYFRESNEL")};
+const size_t StandardMaterialDefines::Index::OPACITYRGB{boolIndex("OPACITYRGB")};
+const size_t StandardMaterialDefines::Index::PARALLAX{boolIndex("PARALLAX")};
+const size_t StandardMaterialDefines::Index::PARALLAXOCCLUSION{boolIndex("PARALLAXOCCLUSION")};
+const size_t StandardMaterialDefines::Index::POINTSIZE{boolIndex("POINTSIZE")};
+const size_t StandardMaterialDefines::Index::PREMULTIPLYALPHA{boolIndex("PREMULTIPLYALPHA")};
+const size_t StandardMaterialDefines::Index::PREPASS{boolIndex("PREPASS")};
+const size_t StandardMaterialDefines::Index::REFLECTION{boolIndex("REFLECTION")};
+const size_t StandardMaterialDefines::Index::REFLECTIONFRESNEL{boolIndex("REFLECTIONFRESNEL")};
+const size_t StandardMaterialDefines::Index::REFLECTIONFRESNELFROMSPECULAR{
+  boolIndex("REFLECTIONFRESNELFROMSPECULAR")};
+const size_t StandardMaterialDefines::Index::REFLECTIONMAP_3D{boolIndex("REFLECTIONMAP_3D")};
+const size_t StandardMaterialDefines::Index::REFLECTIONMAP_OPPOSITEZ{
+  boolIndex("REFLECTIONMAP_OPPOSITEZ")};
+const size_t StandardMaterialDefines::Index::REFLECTIONOVERALPHA{boolIndex("REFLECTIONOVERALPHA")};
+const size_t StandardMaterialDefines::Index::REFRACTION{boolIndex("REFRACTION")};
+const size_t StandardMaterialDefines::Index::REFRACTIONFRESNEL{boolIndex("REFRACTIONFRESNEL")};
+const size_t StandardMaterialDefines::Index::REFRACTIONMAP_3D{boolIndex("REFRACTIONMAP_3D")};
+const size_t StandardMaterialDefines::Index::RGBDLIGHTMAP{boolIndex("RGBDLIGHTMAP")};
+const size_t StandardMaterialDefines::Index::RGBDREFLECTION{boolIndex("RGBDREFLECTION")};
+const size_t StandardMaterialDefines::Index::RGBDREFRACTION{boolIndex("RGBDREFRACTION")};
+const size_t StandardMaterialDefines::Index::ROUGHNESS{boolIndex("ROUGHNESS")};
+const size_t StandardMaterialDefines::Index::SPECULAR{boolIndex("SPECULAR")};
+const size_t StandardMaterialDefines::Index::SPECULAROVERALPHA{boolIndex("SPECULAROVERALPHA")};
+const size_t StandardMaterialDefines::Index::SPECULARTERM{boolIndex("SPECULARTERM")};
+const size_t StandardMaterialDefines::Index::TWOSIDEDLIGHTING{boolIndex("TWOSIDEDLIGHTING")};
+const size_t StandardMaterialDefines::Index::USELIGHTMAPASSHADOWMAP{
+  boolIndex("USELIGHTMAPASSHADOWMAP")};
+const size_t StandardMaterialDefines::Index::USE_LOCAL_REFLECTIONMAP_CUBIC{
+  boolIndex("USE_LOCAL_REFLECTIONMAP_CUBIC")};
+const size_t StandardMaterialDefines::Index::UV1{boolIndex("UV1")};
+const size_t StandardMaterialDefines::Index::UV2{boolIndex("UV2")};
+const size_t StandardMaterialDefines::Index::VERTEXCOLOR{boolIndex("VERTEXCOLOR")};
+
+// Numeric defines
+const size_t StandardMaterialDefines::Index::NUM_MORPH_INFLUENCERS{
+  intIndex("NUM_MORPH_INFLUENCERS")};
+
 StandardMaterialDefines::StandardMaterialDefines()
 {
-  boolDef = {
-    {"MAINUV1", false},                                     //
-    {"MAINUV2", false},                                     //
-    {"DIFFUSE", false},                                     //
-    {"DETAIL", false},                                      //
-    {"AMBIENT", false},                                     //
-    {"OPACITY", false},                                     //
-    {"OPACITYRGB", false},                                  //
-    {"REFLECTION", false},                                  //
-    {"EMISSIVE", false},                                    //
-    {"SPECULAR", false},                                    //
-    {"BUMP", false},                                        //
-    {"PARALLAX", false},                                    //
-    {"PARALLAXOCCLUSION", false},                           //
-    {"SPECULAROVERALPHA", false},                           //
-    {"CLIPPLANE", false},                                   //
-    {"CLIPPLANE2", false},                                  //
-    {"CLIPPLANE3", false},                                  //
-    {"CLIPPLANE4", false},                                  //
-    {"CLIPPLANE5", false},                                  //
-    {"CLIPPLANE6", false},                                  //
-    {"ALPHATEST", false},                                   //
-    {"DEPTHPREPASS", false},                                //
-    {"ALPHAFROMDIFFUSE", false},                            //
-    {"POINTSIZE", false},                                   //
-    {"FOG", false},                                         //
-    {"SPECULARTERM", false},                                //
-    {"DIFFUSEFRESNEL", false},                              //
-    {"OPACITYFRESNEL", false},                              //
-    {"REFLECTIONFRESNEL", false},                           //
-    {"REFRACTIONFRESNEL", false},                           //
-    {"EMISSIVEFRESNEL", false},                             //
-    {"FRESNEL", false},                                     //
-    {"NORMAL", false},                                      //
-    {"UV1", false},                                         //
-    {"UV2", false},                                         //
-    {"VERTEXCOLOR", false},                                 //
-    {"VERTEXALPHA", false},                                 //
-    {"BONETEXTURE", false},                                 //
-    {"BONES_VELOCITY_ENABLED", false},                      //
-    {"INSTANCES", false},                                   //
-    {"THIN_INSTANCES", false},                              //
-    {"GLOSSINESS", false},                                  //
-    {"ROUGHNESS", false},                                   //
-    {"EMISSIVEASILLUMINATION", false},                      //
-    {"LINKEMISSIVEWITHDIFFUSE", false},                     //
-    {"REFLECTIONFRESNELFROMSPECULAR", false},               //
-    {"LIGHTMAP", false},                                    //
-    {"OBJECTSPACE_NORMALMAP", false},                       //
-    {"USELIGHTMAPASSHADOWMAP", false},                      //
-    {"REFLECTIONMAP_3D", false},                            //
-    {"REFLECTIONMAP_SPHERICAL", false},                     //
-    {"REFLECTIONMAP_PLANAR", false},                        //
-    {"REFLECTIONMAP_CUBIC", false},                         //
-    {"USE_LOCAL_REFLECTIONMAP_CUBIC", false},               //
-    {"REFLECTIONMAP_PROJECTION", false},                    //
-    {"REFLECTIONMAP_SKYBOX", false},                        //
-    {"REFLECTIONMAP_EXPLICIT", false},                      //
-    {"REFLECTIONMAP_EQUIRECTANGULAR", false},               //
-    {"REFLECTIONMAP_EQUIRECTANGULAR_FIXED", false},         //
-    {"REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED", false}, //
-    {"REFLECTIONMAP_OPPOSITEZ", false},                     //
-    {"INVERTCUBICMAP", false},                              //
-    {"LOGARITHMICDEPTH", false},                            //
-    {"REFRACTION", false},                                  //
-    {"REFRACTIONMAP_3D", false},                            //
-    {"REFLECTIONOVERALPHA", false},                         //
-    {"TWOSIDEDLIGHTING", false},                            //
-    {"SHADOWFLOAT", false},                                 //
-    {"MORPHTARGETS", false},                                //
-    {"MORPHTARGETS_NORMAL", false},                         //
-    {"MORPHTARGETS_TANGENT", false},                        //
-    {"MORPHTARGETS_UV", false},                             //
-    {"NONUNIFORMSCALING", false},                   // https://playground.babylonjs.com#V6DWIH
-    {"PREMULTIPLYALPHA", false},                    // https://playground.babylonjs.com#LNVJJ7
-    {"ALPHATEST_AFTERALLALPHACOMPUTATIONS", false}, //
-    {"ALPHABLEND", true},                           //
-
-    {"PREPASS", false},              //
-    {"PREPASS_IRRADIANCE", false},   //
-    {"PREPASS_ALBEDO", false},       //
-    {"PREPASS_DEPTH", false},        //
-    {"PREPASS_NORMAL", false},       //
-    {"PREPASS_POSITION", false},     //
-    {"PREPASS_VELOCITY", false},     //
-    {"PREPASS_REFLECTIVITY", false}, //
-
-    {"RGBDLIGHTMAP", false},   //
-    {"RGBDREFLECTION", false}, //
-    {"RGBDREFRACTION", false}, //
-
-    {"IMAGEPROCESSING", false},            //
-    {"VIGNETTE", false},                   //
-    {"VIGNETTEBLENDMODEMULTIPLY", false},  //
-    {"VIGNETTEBLENDMODEOPAQUE", false},    //
-    {"TONEMAPPING", false},                //
-    {"TONEMAPPING_ACES", false},           //
-    {"CONTRAST", false},                   //
-    {"COLORCURVES", false},                //
-    {"COLORGRADING", false},               //
-    {"COLORGRADING3D", false},             //
-    {"SAMPLER3DGREENDEPTH", false},        //
-    {"SAMPLER3DBGRMAP", false},            //
-    {"IMAGEPROCESSINGPOSTPROCESS", false}, //
-    {"MULTIVIEW", false},                  //
-    /**
-     * If the reflection texture on this material is in linear color space
-     * @hidden
-     */
-    {"IS_REFLECTION_LINEAR", false}, //
-    /**
-     * If the refraction texture on this material is in linear color space
-     * @hidden
-     */
-    {"IS_REFRACTION_LINEAR", false}, //
-    {"EXPOSURE", false},             //
-  };
-
-  intDef = {
-    {"DIFFUSEDIRECTUV", 0},             //
-    {"DETAILDIRECTUV", 0},              //
-    {"DETAIL_NORMALBLENDMETHOD", 0},    //
-    {"AMBIENTDIRECTUV", 0},             //
-    {"OPACITYDIRECTUV", 0},             //
-    {"EMISSIVEDIRECTUV", 0},            //
-    {"SPECULARDIRECTUV", 0},            //
-    {"BUMPDIRECTUV", 0},                //
-    {"NUM_BONE_INFLUENCERS", 0},        //
-    {"BonesPerMesh", 0},                //
-    {"LIGHTMAPDIRECTUV", 0},            //
-    {"NUM_MORPH_INFLUENCERS", 0},       //
-    {"PREPASS_IRRADIANCE_INDEX", -1},   //
-    {"PREPASS_ALBEDO_INDEX", -1},       //
-    {"PREPASS_DEPTH_INDEX", -1},        //
-    {"PREPASS_NORMAL_INDEX", -1},       //
-    {"PREPASS_POSITION_INDEX", -1},     //
-    {"PREPASS_VELOCITY_INDEX", -1},     //
-    {"PREPASS_REFLECTIVITY_INDEX", -1}, //
-    {"SCENE_MRT_COUNT", 0},             //
-  };
+  _useSchema(standardMaterialDefinesSchema());
 }
 
 StandardMaterialDefines::~StandardMaterialDefines() = default;
@@ -173,4 +266,9 @@ std::string StandardMaterialDefines::toString() const
   return oss.str();
 }
 
+uint64_t StandardMaterialDefines::hash() const
+{
+  return MaterialDefines::hash() ^ IImageProcessingConfigurationDefines::convertToHash();
+}
+
 } // end of namespace BABYLON
@@ -7,6 +7,7 @@
 #include <babylon/engines/engine.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/engines/scene.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/materials/textures/texture.h>
@@ -389,28 +390,20 @@ bool BaseTexture::canRescale()
   return false;
 }
 
-InternalTexturePtr BaseTexture::_getFromCache(const std::string& url, bool iNoMipmap,
-                                              unsigned int sampling,
-                                              const std::optional<bool>& invertY)
+InternalTexturePtr BaseTexture::_getFromCache(
+  const std::string& url, bool iNoMipmap, unsigned int sampling,
+  const std::optional<bool>& invertY,
+  const std::optional<std::variant<std::string, ArrayBuffer, ArrayBufferView, Image>>& buffer,
+  const std::optional<unsigned int>& format)
 {
   auto engine = _getEngine();
   if (!engine) {
     return nullptr;
   }
 
-  auto& texturesCache = engine->getLoadedTexturesCache();
-  for (auto& texturesCacheEntry : texturesCache) {
-    if (!invertY.has_value() || *invertY == texturesCacheEntry->invertY) {
-      if ((texturesCacheEntry->url == url) && texturesCacheEntry->generateMipMaps != iNoMipmap) {
-        if (!sampling || sampling == texturesCacheEntry->samplingMode) {
-          texturesCacheEntry->incrementReferences();
-          return texturesCacheEntry;
-        }
-      }
-    }
-  }
-
-  return nullptr;
+  auto& textureCache = engine->getTextureCache();
+  const auto key      = TextureCache::ComputeKey(url, buffer, textureCache.hashEmbeddedBuffers);
+  return textureCache.find(key, iNoMipmap, sampling, invertY, format);
 }
 
 void BaseTexture::_rebuild(bool /*forceFullRebuild*/)
@@ -5,6 +5,7 @@
 #include <babylon/core/logging.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/depth_texture_creation_options.h>
+#include <babylon/engines/texture_cache.h>
 #include <babylon/engines/thin_engine.h>
 #include <babylon/materials/textures/base_texture.h>
 #include <babylon/materials/textures/iinternal_texture_loader.h>
@@ -320,6 +321,8 @@ void InternalTexture::_swapAndDie(const InternalTexturePtr& target)
     target->_irradianceTexture = _irradianceTexture;
   }
 
+  _engine->getTextureCache().replace(this, target);
+
   auto& cache = _engine->getLoadedTexturesCache();
   stl_util::remove_vector_elements_equal_sharedptr(cache, this);
 
@@ -333,6 +336,10 @@ void InternalTexture::dispose()
 {
   --_references;
   if (_references == 0) {
+    // The texture cache can keep the GPU resources alive in case the texture is needed again
+    if (_engine->getTextureCache()._onTextureReleased(shared_from_this())) {
+      return;
+    }
     _engine->_releaseTexture(shared_from_this());
     _hardwareTexture = nullptr;
   }
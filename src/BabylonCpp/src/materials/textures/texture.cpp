@@ -131,7 +131,7 @@ Texture::Texture(
     return;
   }
 
-  _texture = _getFromCache(url, noMipmap, samplingMode, invertY);
+  _texture = _getFromCache(url, noMipmap, samplingMode, invertY, buffer, format);
 
   if (!_texture) {
     if (!scene || !scene->useDelayedTextureLoading) {
@@ -243,7 +243,7 @@ void Texture::delayLoad(const std::string& /*forcedExtension*/)
   }
 
   delayLoadState = Constants::DELAYLOADSTATE_LOADED;
-  _texture       = _getFromCache(url, _noMipmap, samplingMode, _invertY);
+  _texture       = _getFromCache(url, _noMipmap, samplingMode, _invertY, _buffer, _format);
 
   if (!_texture) {
     _texture = scene->getEngine()->createTexture(url, _noMipmap, _invertY, getScene(), samplingMode,
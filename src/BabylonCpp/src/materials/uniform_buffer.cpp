@@ -21,79 +21,11 @@ UniformBuffer::UniformBuffer(Engine* engine, const Float32Array& data,
     , _uniformLocationPointer{0}
     , _needSync{false}
     , _noUBO{!engine->supportsUniformBuffers()}
+    , _currentEffect{nullptr}
     , _name{!name.empty() ? name : "no-name"}
 {
-  if (_noUBO) {
-    updateMatrix3x3 = [this](const std::string& name, const Float32Array& matrix) {
-      _updateMatrix3x3ForEffect(name, matrix);
-    };
-    updateMatrix2x2 = [this](const std::string& name, const Float32Array& matrix) {
-      _updateMatrix2x2ForEffect(name, matrix);
-    };
-    updateFloat  = [this](const std::string& name, float x) { _updateFloatForEffect(name, x); };
-    updateFloat2 = [this](const std::string& name, float x, float y, const std::string& suffix) {
-      _updateFloat2ForEffect(name, x, y, suffix);
-    };
-    updateFloat3
-      = [this](const std::string& name, float x, float y, float z, const std::string& suffix = "") {
-          _updateFloat3ForEffect(name, x, y, z, suffix);
-        };
-    updateFloat4 = [this](const std::string& name, float x, float y, float z, float w,
-                          const std::string& suffix = "") {
-      _updateFloat4ForEffect(name, x, y, z, w, suffix);
-    };
-    updateMatrix
-      = [this](const std::string& name, const Matrix& mat) { _updateMatrixForEffect(name, mat); };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
-      _updateVector3ForEffect(name, vector);
-    };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
-      _updateVector4ForEffect(name, vector);
-    };
-    updateColor3
-      = [this](const std::string& name, const Color3& color, const std::string& suffix = "") {
-          _updateColor3ForEffect(name, color, suffix);
-        };
-    updateColor4 = [this](const std::string& name, const Color3& color, float alpha,
-                          const std::string& suffix = "") {
-      _updateColor4ForEffect(name, color, alpha, suffix);
-    };
-  }
-  else {
+  if (!_noUBO) {
     _engine->_uniformBuffers.emplace_back(this);
-
-    updateMatrix3x3 = [this](const std::string& name, const Float32Array& matrix) {
-      _updateMatrix3x3ForUniform(name, matrix);
-    };
-    updateMatrix2x2 = [this](const std::string& name, const Float32Array& matrix) {
-      _updateMatrix2x2ForUniform(name, matrix);
-    };
-    updateFloat = [this](const std::string& name, float x) { _updateFloatForUniform(name, x); };
-    updateFloat2
-      = [this](const std::string& name, float x, float y, const std::string& /*suffix*/ = "") {
-          _updateFloat2ForUniform(name, x, y);
-        };
-    updateFloat3
-      = [this](const std::string& name, float x, float y, float z,
-               const std::string& /*suffix*/ = "") { _updateFloat3ForUniform(name, x, y, z); };
-    updateFloat4
-      = [this](const std::string& name, float x, float y, float z, float w,
-               const std::string& /*suffix*/ = "") { _updateFloat4ForUniform(name, x, y, z, w); };
-    updateMatrix
-      = [this](const std::string& name, const Matrix& mat) { _updateMatrixForUniform(name, mat); };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
-      _updateVector3ForUniform(name, vector);
-    };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
-      _updateVector4ForUniform(name, vector);
-    };
-    updateColor3
-      = [this](const std::string& name, const Color3& color, const std::string& /*suffix*/ = "") {
-          _updateColor3ForUniform(name, color);
-        };
-    updateColor4
-      = [this](const std::string& name, const Color3& color, float alpha,
-               const std::string& /*suffix*/ = "") { _updateColor4ForUniform(name, color, alpha); };
   }
 }
 
@@ -149,15 +81,20 @@ void UniformBuffer::_fillAlignment(size_t size)
   }
 }
 
-void UniformBuffer::addUniform(const std::string& name, const std::variant<int, Float32Array>& size)
+int UniformBuffer::addUniform(const std::string& name, const std::variant<int, Float32Array>& size)
 {
-  if (_noUBO) {
-    return;
+  const auto it = _uniformHandles.find(name);
+  if (it != _uniformHandles.end()) {
+    // Already existing uniform
+    return it->second;
   }
 
-  if (stl_util::contains(_uniformLocations, name)) {
-    // Already existing uniform
-    return;
+  const auto uniformHandle = static_cast<int>(_uniforms.size());
+  _uniformHandles[name]    = uniformHandle;
+  _uniforms.emplace_back(Uniform{name});
+
+  if (_noUBO) {
+    return uniformHandle;
   }
 
   // This function must be called in the order of the shader layout !
@@ -176,8 +113,9 @@ void UniformBuffer::addUniform(const std::string& name, const std::variant<int,
   }
 
   _fillAlignment(_size);
-  _uniformSizes[name]     = _size;
-  _uniformLocations[name] = _uniformLocationPointer;
+  auto& uniform    = _uniforms.back();
+  uniform.size     = _size;
+  uniform.location = _uniformLocationPointer;
   _uniformLocationPointer += _size;
 
   for (size_t i = 0; i < _size; ++i) {
@@ -185,6 +123,14 @@ void UniformBuffer::addUniform(const std::string& name, const std::variant<int,
   }
 
   _needSync = true;
+
+  return uniformHandle;
+}
+
+int UniformBuffer::getUniformHandle(const std::string& name) const
+{
+  const auto it = _uniformHandles.find(name);
+  return (it != _uniformHandles.end()) ? it->second : -1;
 }
 
 void UniformBuffer::addMatrix(const std::string& name, const Matrix& mat)
@@ -282,23 +228,52 @@ void UniformBuffer::update()
   _needSync = false;
 }
 
+int UniformBuffer::_getOrAddUniform(const std::string& name, size_t size)
+{
+  const auto it = _uniformHandles.find(name);
+  if (it != _uniformHandles.end()) {
+    return it->second;
+  }
+
+  if (_buffer) {
+    // Cannot add an uniform if the buffer is already created
+    BABYLON_LOG_ERROR("UniformBuffer", "Cannot add an uniform after UBO has been created.")
+    return -1;
+  }
+
+  return addUniform(name, static_cast<int>(size));
+}
+
+int UniformBuffer::_getEffectUniformHandle(int uniformHandle)
+{
+  if (uniformHandle < 0 || static_cast<size_t>(uniformHandle) >= _uniforms.size()) {
+    return -1;
+  }
+
+  // The handles of the effect are resolved once per effect
+  auto& uniform = _uniforms[static_cast<size_t>(uniformHandle)];
+  if (uniform.effectId != _currentEffect->uniqueId) {
+    uniform.effectId     = _currentEffect->uniqueId;
+    uniform.effectHandle = _currentEffect->getUniformHandle(uniform.name);
+  }
+
+  return uniform.effectHandle;
+}
+
 void UniformBuffer::updateUniform(const std::string& uniformName, const Float32Array& data,
                                   size_t size)
 {
-  size_t location = 0;
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
-    if (_buffer) {
-      // Cannot add an uniform if the buffer is already created
-      BABYLON_LOG_ERROR("UniformBuffer", "Cannot add an uniform after UBO has been created.")
-      return;
-    }
-    addUniform(uniformName, static_cast<int>(size));
-    location = _uniformLocations[uniformName];
-  }
-  else {
-    location = _uniformLocations[uniformName];
+  updateUniform(_getOrAddUniform(uniformName, size), data, size);
+}
+
+void UniformBuffer::updateUniform(int uniformHandle, const Float32Array& data, size_t size)
+{
+  if (_noUBO || uniformHandle < 0 || static_cast<size_t>(uniformHandle) >= _uniforms.size()) {
+    return;
   }
 
+  const auto location = _uniforms[static_cast<size_t>(uniformHandle)].location;
+
   if (!_buffer) {
     create();
   }
@@ -326,20 +301,25 @@ void UniformBuffer::updateUniform(const std::string& uniformName, const Float32A
   }
 }
 
-bool UniformBuffer::_cacheMatrix(const std::string& name, const Matrix& matrix)
+bool UniformBuffer::_cacheMatrix(int uniformHandle, const Matrix& matrix)
 {
-  const auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, name) && _valueCache[name] == flag) {
+  auto& updateFlag = _uniforms[static_cast<size_t>(uniformHandle)].updateFlag;
+  if (updateFlag == matrix.updateFlag) {
     return false;
   }
 
-  _valueCache[name] = flag;
+  updateFlag = matrix.updateFlag;
 
   return true;
 }
 
-void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name, const Float32Array& matrix)
+void UniformBuffer::updateMatrix3x3(const std::string& name, const Float32Array& matrix)
 {
+  if (_noUBO) {
+    _currentEffect->setMatrix3x3(name, matrix);
+    return;
+  }
+
   // To match std140, matrix must be realigned
   for (unsigned int i = 0; i < 3; ++i) {
     UniformBuffer::_tempBuffer[i * 4]     = matrix[i * 3];
@@ -351,18 +331,13 @@ void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name, const Fl
   updateUniform(name, UniformBuffer::_tempBuffer, 12);
 }
 
-void UniformBuffer::_updateMatrix3x3ForEffect(const std::string& name, const Float32Array& matrix)
-{
-  _currentEffect->setMatrix3x3(name, matrix);
-}
-
-void UniformBuffer::_updateMatrix2x2ForEffect(const std::string& name, const Float32Array& matrix)
+void UniformBuffer::updateMatrix2x2(const std::string& name, const Float32Array& matrix)
 {
-  _currentEffect->setMatrix2x2(name, matrix);
-}
+  if (_noUBO) {
+    _currentEffect->setMatrix2x2(name, matrix);
+    return;
+  }
 
-void UniformBuffer::_updateMatrix2x2ForUniform(const std::string& name, const Float32Array& matrix)
-{
   // To match std140, matrix must be realigned
   for (unsigned int i = 0; i < 2; i++) {
     UniformBuffer::_tempBuffer[i * 4]     = matrix[i * 2];
@@ -374,118 +349,212 @@ void UniformBuffer::_updateMatrix2x2ForUniform(const std::string& name, const Fl
   updateUniform(name, UniformBuffer::_tempBuffer, 8);
 }
 
-void UniformBuffer::_updateFloatForEffect(const std::string& name, float x)
+void UniformBuffer::updateFloat(const std::string& name, float x)
 {
-  _currentEffect->setFloat(name, x);
+  if (_noUBO) {
+    _currentEffect->setFloat(name, x);
+    return;
+  }
+
+  updateFloat(_getOrAddUniform(name, 1), x);
 }
 
-void UniformBuffer::_updateFloatForUniform(const std::string& name, float x)
+void UniformBuffer::updateFloat(int uniformHandle, float x)
 {
+  if (_noUBO) {
+    _currentEffect->setFloat(_getEffectUniformHandle(uniformHandle), x);
+    return;
+  }
+
   UniformBuffer::_tempBuffer[0] = x;
-  updateUniform(name, UniformBuffer::_tempBuffer, 1);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 1);
 }
 
-void UniformBuffer::_updateFloat2ForEffect(const std::string& name, float x, float y,
-                                           const std::string& suffix)
+void UniformBuffer::updateFloat2(const std::string& name, float x, float y,
+                                 const std::string& suffix)
 {
-  _currentEffect->setFloat2(name + suffix, x, y);
+  if (_noUBO) {
+    _currentEffect->setFloat2(name + suffix, x, y);
+    return;
+  }
+
+  updateFloat2(_getOrAddUniform(name, 2), x, y);
 }
 
-void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x, float y)
+void UniformBuffer::updateFloat2(int uniformHandle, float x, float y)
 {
+  if (_noUBO) {
+    _currentEffect->setFloat2(_getEffectUniformHandle(uniformHandle), x, y);
+    return;
+  }
+
   UniformBuffer::_tempBuffer[0] = x;
   UniformBuffer::_tempBuffer[1] = y;
-  updateUniform(name, UniformBuffer::_tempBuffer, 2);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 2);
 }
 
-void UniformBuffer::_updateFloat3ForEffect(const std::string& name, float x, float y, float z,
-                                           const std::string& suffix)
+void UniformBuffer::updateFloat3(const std::string& name, float x, float y, float z,
+                                 const std::string& suffix)
 {
-  _currentEffect->setFloat3(name + suffix, x, y, z);
+  if (_noUBO) {
+    _currentEffect->setFloat3(name + suffix, x, y, z);
+    return;
+  }
+
+  updateFloat3(_getOrAddUniform(name, 3), x, y, z);
 }
 
-void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x, float y, float z)
+void UniformBuffer::updateFloat3(int uniformHandle, float x, float y, float z)
 {
+  if (_noUBO) {
+    _currentEffect->setFloat3(_getEffectUniformHandle(uniformHandle), x, y, z);
+    return;
+  }
+
   UniformBuffer::_tempBuffer[0] = x;
   UniformBuffer::_tempBuffer[1] = y;
   UniformBuffer::_tempBuffer[2] = z;
-  updateUniform(name, UniformBuffer::_tempBuffer, 3);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateFloat4ForEffect(const std::string& name, float x, float y, float z,
-                                           float w, const std::string& suffix)
+void UniformBuffer::updateFloat4(const std::string& name, float x, float y, float z, float w,
+                                 const std::string& suffix)
 {
-  _currentEffect->setFloat4(name + suffix, x, y, z, w);
+  if (_noUBO) {
+    _currentEffect->setFloat4(name + suffix, x, y, z, w);
+    return;
+  }
+
+  updateFloat4(_getOrAddUniform(name, 4), x, y, z, w);
 }
 
-void UniformBuffer::_updateFloat4ForUniform(const std::string& name, float x, float y, float z,
-                                            float w)
+void UniformBuffer::updateFloat4(int uniformHandle, float x, float y, float z, float w)
 {
+  if (_noUBO) {
+    _currentEffect->setFloat4(_getEffectUniformHandle(uniformHandle), x, y, z, w);
+    return;
+  }
+
   UniformBuffer::_tempBuffer[0] = x;
   UniformBuffer::_tempBuffer[1] = y;
   UniformBuffer::_tempBuffer[2] = z;
   UniformBuffer::_tempBuffer[3] = w;
-  updateUniform(name, UniformBuffer::_tempBuffer, 4);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 4);
 }
 
-void UniformBuffer::_updateMatrixForEffect(const std::string& name, const Matrix& mat)
+void UniformBuffer::updateMatrix(const std::string& name, const Matrix& mat)
 {
-  _currentEffect->setMatrix(name, mat);
+  if (_noUBO) {
+    _currentEffect->setMatrix(name, mat);
+    return;
+  }
+
+  updateMatrix(_getOrAddUniform(name, 16), mat);
 }
 
-void UniformBuffer::_updateMatrixForUniform(const std::string& name, const Matrix& mat)
+void UniformBuffer::updateMatrix(int uniformHandle, const Matrix& mat)
 {
-  if (_cacheMatrix(name, mat)) {
-    updateUniform(name, mat.toArray(), 16);
+  if (_noUBO) {
+    _currentEffect->setMatrix(_getEffectUniformHandle(uniformHandle), mat);
+    return;
+  }
+
+  if (uniformHandle < 0 || static_cast<size_t>(uniformHandle) >= _uniforms.size()) {
+    return;
+  }
+
+  if (_cacheMatrix(uniformHandle, mat)) {
+    // Copy through the temporary buffer to avoid allocating an array per update
+    mat.copyToArray(UniformBuffer::_tempBuffer);
+    updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 16);
   }
 }
 
-void UniformBuffer::_updateVector3ForEffect(const std::string& name, const Vector3& vector)
+void UniformBuffer::updateVector3(const std::string& name, const Vector3& vector)
 {
-  _currentEffect->setVector3(name, vector);
+  if (_noUBO) {
+    _currentEffect->setVector3(name, vector);
+    return;
+  }
+
+  updateVector3(_getOrAddUniform(name, 3), vector);
 }
 
-void UniformBuffer::_updateVector3ForUniform(const std::string& name, const Vector3& vector)
+void UniformBuffer::updateVector3(int uniformHandle, const Vector3& vector)
 {
+  if (_noUBO) {
+    _currentEffect->setVector3(_getEffectUniformHandle(uniformHandle), vector);
+    return;
+  }
+
   vector.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name, UniformBuffer::_tempBuffer, 3);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateVector4ForEffect(const std::string& name, const Vector4& vector)
+void UniformBuffer::updateVector4(const std::string& name, const Vector4& vector)
 {
-  _currentEffect->setVector4(name, vector);
+  if (_noUBO) {
+    _currentEffect->setVector4(name, vector);
+    return;
+  }
+
+  updateVector4(_getOrAddUniform(name, 4), vector);
 }
 
-void UniformBuffer::_updateVector4ForUniform(const std::string& name, const Vector4& vector)
+void UniformBuffer::updateVector4(int uniformHandle, const Vector4& vector)
 {
+  if (_noUBO) {
+    _currentEffect->setVector4(_getEffectUniformHandle(uniformHandle), vector);
+    return;
+  }
+
   vector.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name, UniformBuffer::_tempBuffer, 4);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 4);
 }
 
-void UniformBuffer::_updateColor3ForEffect(const std::string& name, const Color3& color,
-                                           const std::string& suffix)
+void UniformBuffer::updateColor3(const std::string& name, const Color3& color,
+                                 const std::string& suffix)
 {
-  _currentEffect->setColor3(name + suffix, color);
+  if (_noUBO) {
+    _currentEffect->setColor3(name + suffix, color);
+    return;
+  }
+
+  updateColor3(_getOrAddUniform(name, 3), color);
 }
 
-void UniformBuffer::_updateColor3ForUniform(const std::string& name, const Color3& color)
+void UniformBuffer::updateColor3(int uniformHandle, const Color3& color)
 {
+  if (_noUBO) {
+    _currentEffect->setColor3(_getEffectUniformHandle(uniformHandle), color);
+    return;
+  }
+
   color.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name, UniformBuffer::_tempBuffer, 3);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 3);
 }
 
-void UniformBuffer::_updateColor4ForEffect(const std::string& name, const Color3& color,
-                                           float alpha, const std::string& suffix)
+void UniformBuffer::updateColor4(const std::string& name, const Color3& color, float alpha,
+                                 const std::string& suffix)
 {
-  _currentEffect->setColor4(name + suffix, color, alpha);
+  if (_noUBO) {
+    _currentEffect->setColor4(name + suffix, color, alpha);
+    return;
+  }
+
+  updateColor4(_getOrAddUniform(name, 4), color, alpha);
 }
 
-void UniformBuffer::_updateColor4ForUniform(const std::string& name, const Color3& color,
-                                            float alpha)
+void UniformBuffer::updateColor4(int uniformHandle, const Color3& color, float alpha)
 {
+  if (_noUBO) {
+    _currentEffect->setColor4(_getEffectUniformHandle(uniformHandle), color, alpha);
+    return;
+  }
+
   color.toArray(UniformBuffer::_tempBuffer);
   UniformBuffer::_tempBuffer[3] = alpha;
-  updateUniform(name, UniformBuffer::_tempBuffer, 4);
+  updateUniform(uniformHandle, UniformBuffer::_tempBuffer, 4);
 }
 
 void UniformBuffer::setTexture(const std::string& name, const BaseTexturePtr& texture)
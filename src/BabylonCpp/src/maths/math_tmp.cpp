@@ -6,12 +6,12 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 6> MathTmp::Vector3Array{
+thread_local std::array<Vector3, 6> MathTmp::Vector3Array{
   {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
    Vector3::Zero(), Vector3::Zero()}};
-std::array<Matrix, 2> MathTmp::MatrixArray{
+thread_local std::array<Matrix, 2> MathTmp::MatrixArray{
   {Matrix::Identity(), Matrix::Identity()}};
-std::array<Quaternion, 3> MathTmp::QuaternionArray{
+thread_local std::array<Quaternion, 3> MathTmp::QuaternionArray{
   {Quaternion::Zero(), Quaternion::Zero(), Quaternion::Zero()}};
 
 } // end of namespace BABYLON
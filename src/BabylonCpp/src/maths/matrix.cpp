@@ -4,6 +4,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/vr/vr_fov.h>
 #include <babylon/maths/math_tmp.h>
+#include <babylon/maths/matrix_kernels.h>
 #include <babylon/maths/plane.h>
 #include <babylon/maths/quaternion.h>
 #include <babylon/maths/scalar.h>
@@ -13,7 +14,7 @@
 
 namespace BABYLON {
 
-int Matrix::_updateFlagSeed      = 0;
+std::atomic<int> Matrix::_updateFlagSeed{0};
 Matrix Matrix::_identityReadOnly = Matrix::Identity();
 
 Matrix::Matrix()
@@ -68,8 +69,8 @@ const std::array<float, 16>& Matrix::m() const
 
 void Matrix::_markAsUpdated()
 {
-  updateFlag
-    = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ? Matrix::_updateFlagSeed++ : 0;
+  // Atomic seed as matrices can be updated from worker threads, wraps around on overflow
+  updateFlag          = Matrix::_updateFlagSeed++ & std::numeric_limits<int>::max();
   _isIdentity         = false;
   _isIdentity3x2      = false;
   _isIdentityDirty    = true;
@@ -79,7 +80,7 @@ void Matrix::_markAsUpdated()
 void Matrix::_updateIdentityStatus(bool isIdentity, bool isIdentityDirty, bool isIdentity3x2,
                                    bool isIdentity3x2Dirty)
 {
-  updateFlag          = Matrix::_updateFlagSeed++;
+  updateFlag          = Matrix::_updateFlagSeed++ & std::numeric_limits<int>::max();
   _isIdentity         = isIdentity;
   _isIdentity3x2      = isIdentity || isIdentity3x2;
   _isIdentityDirty    = _isIdentity ? false : isIdentityDirty;
@@ -244,68 +245,13 @@ const Matrix& Matrix::invertToRef(Matrix& other) const
   }
 
   // the inverse of a Matrix is the transpose of cofactor matrix divided by the determinant
-  const auto& m  = _m;
-  const auto m00 = m[0], m01 = m[1], m02 = m[2], m03 = m[3];
-  const auto m10 = m[4], m11 = m[5], m12 = m[6], m13 = m[7];
-  const auto m20 = m[8], m21 = m[9], m22 = m[10], m23 = m[11];
-  const auto m30 = m[12], m31 = m[13], m32 = m[14], m33 = m[15];
-
-  const auto det_22_33 = m22 * m33 - m32 * m23;
-  const auto det_21_33 = m21 * m33 - m31 * m23;
-  const auto det_21_32 = m21 * m32 - m31 * m22;
-  const auto det_20_33 = m20 * m33 - m30 * m23;
-  const auto det_20_32 = m20 * m32 - m22 * m30;
-  const auto det_20_31 = m20 * m31 - m30 * m21;
-
-  const auto cofact_00 = +(m11 * det_22_33 - m12 * det_21_33 + m13 * det_21_32);
-  const auto cofact_01 = -(m10 * det_22_33 - m12 * det_20_33 + m13 * det_20_32);
-  const auto cofact_02 = +(m10 * det_21_33 - m11 * det_20_33 + m13 * det_20_31);
-  const auto cofact_03 = -(m10 * det_21_32 - m11 * det_20_32 + m12 * det_20_31);
-
-  const auto det = m00 * cofact_00 + m01 * cofact_01 + m02 * cofact_02 + m03 * cofact_03;
-
-  if (det == 0.f) {
+  if (!MatrixKernels::Get().invert(_m.data(), other._m.data())) {
     // not invertible
     other.copyFrom(*this);
     return *this;
   }
 
-  const auto detInv    = 1.f / det;
-  const auto det_12_33 = m12 * m33 - m32 * m13;
-  const auto det_11_33 = m11 * m33 - m31 * m13;
-  const auto det_11_32 = m11 * m32 - m31 * m12;
-  const auto det_10_33 = m10 * m33 - m30 * m13;
-  const auto det_10_32 = m10 * m32 - m30 * m12;
-  const auto det_10_31 = m10 * m31 - m30 * m11;
-  const auto det_12_23 = m12 * m23 - m22 * m13;
-  const auto det_11_23 = m11 * m23 - m21 * m13;
-  const auto det_11_22 = m11 * m22 - m21 * m12;
-  const auto det_10_23 = m10 * m23 - m20 * m13;
-  const auto det_10_22 = m10 * m22 - m20 * m12;
-  const auto det_10_21 = m10 * m21 - m20 * m11;
-
-  const auto cofact_10 = -(m01 * det_22_33 - m02 * det_21_33 + m03 * det_21_32);
-  const auto cofact_11 = +(m00 * det_22_33 - m02 * det_20_33 + m03 * det_20_32);
-  const auto cofact_12 = -(m00 * det_21_33 - m01 * det_20_33 + m03 * det_20_31);
-  const auto cofact_13 = +(m00 * det_21_32 - m01 * det_20_32 + m02 * det_20_31);
-
-  const auto cofact_20 = +(m01 * det_12_33 - m02 * det_11_33 + m03 * det_11_32);
-  const auto cofact_21 = -(m00 * det_12_33 - m02 * det_10_33 + m03 * det_10_32);
-  const auto cofact_22 = +(m00 * det_11_33 - m01 * det_10_33 + m03 * det_10_31);
-  const auto cofact_23 = -(m00 * det_11_32 - m01 * det_10_32 + m02 * det_10_31);
-
-  const auto cofact_30 = -(m01 * det_12_23 - m02 * det_11_23 + m03 * det_11_22);
-  const auto cofact_31 = +(m00 * det_12_23 - m02 * det_10_23 + m03 * det_10_22);
-  const auto cofact_32 = -(m00 * det_11_23 - m01 * det_10_23 + m03 * det_10_21);
-  const auto cofact_33 = +(m00 * det_11_22 - m01 * det_10_22 + m02 * det_10_21);
-
-  Matrix::FromValuesToRef(
-    cofact_00 * detInv, cofact_10 * detInv, cofact_20 * detInv, cofact_30 * detInv, //
-    cofact_01 * detInv, cofact_11 * detInv, cofact_21 * detInv, cofact_31 * detInv, //
-    cofact_02 * detInv, cofact_12 * detInv, cofact_22 * detInv, cofact_32 * detInv, //
-    cofact_03 * detInv, cofact_13 * detInv, cofact_23 * detInv, cofact_33 * detInv, //
-    other);
-
+  other._markAsUpdated();
   return *this;
 }
 
@@ -462,37 +408,7 @@ Matrix& Matrix::multiplyToRef(const Matrix& other, Matrix& result)
 const Matrix& Matrix::multiplyToArray(const Matrix& other, std::array<float, 16>& result,
                                       unsigned int offset) const
 {
-  const auto& m      = _m;
-  const auto& otherM = other.m();
-  const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
-  const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
-  const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
-  const auto tm12 = m[12], tm13 = m[13], tm14 = m[14], tm15 = m[15];
-
-  const auto om0 = otherM[0], om1 = otherM[1], om2 = otherM[2], om3 = otherM[3];
-  const auto om4 = otherM[4], om5 = otherM[5], om6 = otherM[6], om7 = otherM[7];
-  const auto om8 = otherM[8], om9 = otherM[9], om10 = otherM[10], om11 = otherM[11];
-  const auto om12 = otherM[12], om13 = otherM[13], om14 = otherM[14], om15 = otherM[15];
-
-  result[offset]     = tm0 * om0 + tm1 * om4 + tm2 * om8 + tm3 * om12;
-  result[offset + 1] = tm0 * om1 + tm1 * om5 + tm2 * om9 + tm3 * om13;
-  result[offset + 2] = tm0 * om2 + tm1 * om6 + tm2 * om10 + tm3 * om14;
-  result[offset + 3] = tm0 * om3 + tm1 * om7 + tm2 * om11 + tm3 * om15;
-
-  result[offset + 4] = tm4 * om0 + tm5 * om4 + tm6 * om8 + tm7 * om12;
-  result[offset + 5] = tm4 * om1 + tm5 * om5 + tm6 * om9 + tm7 * om13;
-  result[offset + 6] = tm4 * om2 + tm5 * om6 + tm6 * om10 + tm7 * om14;
-  result[offset + 7] = tm4 * om3 + tm5 * om7 + tm6 * om11 + tm7 * om15;
-
-  result[offset + 8]  = tm8 * om0 + tm9 * om4 + tm10 * om8 + tm11 * om12;
-  result[offset + 9]  = tm8 * om1 + tm9 * om5 + tm10 * om9 + tm11 * om13;
-  result[offset + 10] = tm8 * om2 + tm9 * om6 + tm10 * om10 + tm11 * om14;
-  result[offset + 11] = tm8 * om3 + tm9 * om7 + tm10 * om11 + tm11 * om15;
-
-  result[offset + 12] = tm12 * om0 + tm13 * om4 + tm14 * om8 + tm15 * om12;
-  result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
-  result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
-  result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
+  MatrixKernels::Get().multiply(_m.data(), other._m.data(), result.data() + offset);
 
   return *this;
 }
@@ -504,37 +420,7 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
     return *this;
   }
 
-  const auto& m      = _m;
-  const auto& otherM = other.m();
-  const auto tm0 = m[0], tm1 = m[1], tm2 = m[2], tm3 = m[3];
-  const auto tm4 = m[4], tm5 = m[5], tm6 = m[6], tm7 = m[7];
-  const auto tm8 = m[8], tm9 = m[9], tm10 = m[10], tm11 = m[11];
-  const auto tm12 = m[12], tm13 = m[13], tm14 = m[14], tm15 = m[15];
-
-  const auto om0 = otherM[0], om1 = otherM[1], om2 = otherM[2], om3 = otherM[3];
-  const auto om4 = otherM[4], om5 = otherM[5], om6 = otherM[6], om7 = otherM[7];
-  const auto om8 = otherM[8], om9 = otherM[9], om10 = otherM[10], om11 = otherM[11];
-  const auto om12 = otherM[12], om13 = otherM[13], om14 = otherM[14], om15 = otherM[15];
-
-  result[offset]     = tm0 * om0 + tm1 * om4 + tm2 * om8 + tm3 * om12;
-  result[offset + 1] = tm0 * om1 + tm1 * om5 + tm2 * om9 + tm3 * om13;
-  result[offset + 2] = tm0 * om2 + tm1 * om6 + tm2 * om10 + tm3 * om14;
-  result[offset + 3] = tm0 * om3 + tm1 * om7 + tm2 * om11 + tm3 * om15;
-
-  result[offset + 4] = tm4 * om0 + tm5 * om4 + tm6 * om8 + tm7 * om12;
-  result[offset + 5] = tm4 * om1 + tm5 * om5 + tm6 * om9 + tm7 * om13;
-  result[offset + 6] = tm4 * om2 + tm5 * om6 + tm6 * om10 + tm7 * om14;
-  result[offset + 7] = tm4 * om3 + tm5 * om7 + tm6 * om11 + tm7 * om15;
-
-  result[offset + 8]  = tm8 * om0 + tm9 * om4 + tm10 * om8 + tm11 * om12;
-  result[offset + 9]  = tm8 * om1 + tm9 * om5 + tm10 * om9 + tm11 * om13;
-  result[offset + 10] = tm8 * om2 + tm9 * om6 + tm10 * om10 + tm11 * om14;
-  result[offset + 11] = tm8 * om3 + tm9 * om7 + tm10 * om11 + tm11 * om15;
-
-  result[offset + 12] = tm12 * om0 + tm13 * om4 + tm14 * om8 + tm15 * om12;
-  result[offset + 13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
-  result[offset + 14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
-  result[offset + 15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
+  MatrixKernels::Get().multiply(_m.data(), other._m.data(), result.data() + offset);
 
   return *this;
 }
@@ -889,36 +775,23 @@ Matrix Matrix::Compose(const Vector3& scale, const Quaternion& rotation, const V
 void Matrix::ComposeToRef(const Vector3& scale, const Quaternion& rotation,
                           const Vector3& translation, Matrix& result)
 {
-  auto& m      = result._m;
-  const auto x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
-  const auto x2 = x + x, y2 = y + y, z2 = z + z;
-  const auto xx = x * x2, xy = x * y2, xz = x * z2;
-  const auto yy = y * y2, yz = y * z2, zz = z * z2;
-  const auto wx = w * x2, wy = w * y2, wz = w * z2;
+  const std::array<float, 3> s{scale.x, scale.y, scale.z};
+  const std::array<float, 4> r{rotation.x, rotation.y, rotation.z, rotation.w};
+  const std::array<float, 3> t{translation.x, translation.y, translation.z};
+  MatrixKernels::Get().compose(s.data(), r.data(), t.data(), result._m.data());
 
-  const auto sx = scale.x, sy = scale.y, sz = scale.z;
-
-  m[0] = (1 - (yy + zz)) * sx;
-  m[1] = (xy + wz) * sx;
-  m[2] = (xz - wy) * sx;
-  m[3] = 0;
-
-  m[4] = (xy - wz) * sy;
-  m[5] = (1 - (xx + zz)) * sy;
-  m[6] = (yz + wx) * sy;
-  m[7] = 0;
-
-  m[8]  = (xz + wy) * sz;
-  m[9]  = (yz - wx) * sz;
-  m[10] = (1 - (xx + yy)) * sz;
-  m[11] = 0;
+  result._markAsUpdated();
+}
 
-  m[12] = translation.x;
-  m[13] = translation.y;
-  m[14] = translation.z;
-  m[15] = 1;
+void Matrix::MultiplyArrayToRef(const Float32Array& matrices, const Matrix& other,
+                                Float32Array& result, size_t count, size_t offset)
+{
+  if (matrices.size() < offset + count * 16 || result.size() < offset + count * 16) {
+    return;
+  }
 
-  result._markAsUpdated();
+  MatrixKernels::Get().multiplyArray(matrices.data() + offset, other._m.data(),
+                                     result.data() + offset, count);
 }
 
 Matrix Matrix::Identity()
@@ -0,0 +1,582 @@
+#include <babylon/maths/matrix_kernels.h>
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#define BABYLON_MATRIX_KERNELS_X86
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BABYLON_MATRIX_KERNELS_NEON
+#endif
+
+#if defined(BABYLON_MATRIX_KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define BABYLON_TARGET_AVX __attribute__((target("avx")))
+#else
+#define BABYLON_TARGET_AVX
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+/** Scalar kernels **/
+
+void multiplyScalar(const float* a, const float* b, float* result)
+{
+  const auto tm0 = a[0], tm1 = a[1], tm2 = a[2], tm3 = a[3];
+  const auto tm4 = a[4], tm5 = a[5], tm6 = a[6], tm7 = a[7];
+  const auto tm8 = a[8], tm9 = a[9], tm10 = a[10], tm11 = a[11];
+  const auto tm12 = a[12], tm13 = a[13], tm14 = a[14], tm15 = a[15];
+
+  const auto om0 = b[0], om1 = b[1], om2 = b[2], om3 = b[3];
+  const auto om4 = b[4], om5 = b[5], om6 = b[6], om7 = b[7];
+  const auto om8 = b[8], om9 = b[9], om10 = b[10], om11 = b[11];
+  const auto om12 = b[12], om13 = b[13], om14 = b[14], om15 = b[15];
+
+  result[0] = tm0 * om0 + tm1 * om4 + tm2 * om8 + tm3 * om12;
+  result[1] = tm0 * om1 + tm1 * om5 + tm2 * om9 + tm3 * om13;
+  result[2] = tm0 * om2 + tm1 * om6 + tm2 * om10 + tm3 * om14;
+  result[3] = tm0 * om3 + tm1 * om7 + tm2 * om11 + tm3 * om15;
+
+  result[4] = tm4 * om0 + tm5 * om4 + tm6 * om8 + tm7 * om12;
+  result[5] = tm4 * om1 + tm5 * om5 + tm6 * om9 + tm7 * om13;
+  result[6] = tm4 * om2 + tm5 * om6 + tm6 * om10 + tm7 * om14;
+  result[7] = tm4 * om3 + tm5 * om7 + tm6 * om11 + tm7 * om15;
+
+  result[8]  = tm8 * om0 + tm9 * om4 + tm10 * om8 + tm11 * om12;
+  result[9]  = tm8 * om1 + tm9 * om5 + tm10 * om9 + tm11 * om13;
+  result[10] = tm8 * om2 + tm9 * om6 + tm10 * om10 + tm11 * om14;
+  result[11] = tm8 * om3 + tm9 * om7 + tm10 * om11 + tm11 * om15;
+
+  result[12] = tm12 * om0 + tm13 * om4 + tm14 * om8 + tm15 * om12;
+  result[13] = tm12 * om1 + tm13 * om5 + tm14 * om9 + tm15 * om13;
+  result[14] = tm12 * om2 + tm13 * om6 + tm14 * om10 + tm15 * om14;
+  result[15] = tm12 * om3 + tm13 * om7 + tm14 * om11 + tm15 * om15;
+}
+
+void multiplyArrayScalar(const float* matrices, const float* other, float* result, size_t count)
+{
+  float o[16];
+  std::memcpy(o, other, sizeof(o));
+  for (size_t i = 0; i < count; ++i) {
+    multiplyScalar(matrices + i * 16, o, result + i * 16);
+  }
+}
+
+/**
+ * Generic batched kernels, instantiated with the single matrix multiplication of each instruction
+ * set so that it gets inlined in the loops.
+ */
+template <void (*Multiply)(const float*, const float*, float*)>
+void multiplyPairsT(const float* a, const float* b, float* result, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    Multiply(a + i * 16, b + i * 16, result + i * 16);
+  }
+}
+
+template <void (*Multiply)(const float*, const float*, float*)>
+void multiplyHierarchyT(const float* locals, const int32_t* parents, const float* root,
+                        float* worlds, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto parent = parents[i] >= 0 ? worlds + parents[i] * 16 : root;
+    if (parent) {
+      Multiply(locals + i * 16, parent, worlds + i * 16);
+    }
+    else {
+      std::memcpy(worlds + i * 16, locals + i * 16, 16 * sizeof(float));
+    }
+  }
+}
+
+bool invertScalar(const float* m, float* result)
+{
+  // the inverse of a Matrix is the transpose of cofactor matrix divided by the determinant
+  const auto m00 = m[0], m01 = m[1], m02 = m[2], m03 = m[3];
+  const auto m10 = m[4], m11 = m[5], m12 = m[6], m13 = m[7];
+  const auto m20 = m[8], m21 = m[9], m22 = m[10], m23 = m[11];
+  const auto m30 = m[12], m31 = m[13], m32 = m[14], m33 = m[15];
+
+  const auto det_22_33 = m22 * m33 - m32 * m23;
+  const auto det_21_33 = m21 * m33 - m31 * m23;
+  const auto det_21_32 = m21 * m32 - m31 * m22;
+  const auto det_20_33 = m20 * m33 - m30 * m23;
+  const auto det_20_32 = m20 * m32 - m22 * m30;
+  const auto det_20_31 = m20 * m31 - m30 * m21;
+
+  const auto cofact_00 = +(m11 * det_22_33 - m12 * det_21_33 + m13 * det_21_32);
+  const auto cofact_01 = -(m10 * det_22_33 - m12 * det_20_33 + m13 * det_20_32);
+  const auto cofact_02 = +(m10 * det_21_33 - m11 * det_20_33 + m13 * det_20_31);
+  const auto cofact_03 = -(m10 * det_21_32 - m11 * det_20_32 + m12 * det_20_31);
+
+  const auto det = m00 * cofact_00 + m01 * cofact_01 + m02 * cofact_02 + m03 * cofact_03;
+
+  if (det == 0.f) {
+    // not invertible
+    return false;
+  }
+
+  const auto detInv    = 1.f / det;
+  const auto det_12_33 = m12 * m33 - m32 * m13;
+  const auto det_11_33 = m11 * m33 - m31 * m13;
+  const auto det_11_32 = m11 * m32 - m31 * m12;
+  const auto det_10_33 = m10 * m33 - m30 * m13;
+  const auto det_10_32 = m10 * m32 - m30 * m12;
+  const auto det_10_31 = m10 * m31 - m30 * m11;
+  const auto det_12_23 = m12 * m23 - m22 * m13;
+  const auto det_11_23 = m11 * m23 - m21 * m13;
+  const auto det_11_22 = m11 * m22 - m21 * m12;
+  const auto det_10_23 = m10 * m23 - m20 * m13;
+  const auto det_10_22 = m10 * m22 - m20 * m12;
+  const auto det_10_21 = m10 * m21 - m20 * m11;
+
+  const auto cofact_10 = -(m01 * det_22_33 - m02 * det_21_33 + m03 * det_21_32);
+  const auto cofact_11 = +(m00 * det_22_33 - m02 * det_20_33 + m03 * det_20_32);
+  const auto cofact_12 = -(m00 * det_21_33 - m01 * det_20_33 + m03 * det_20_31);
+  const auto cofact_13 = +(m00 * det_21_32 - m01 * det_20_32 + m02 * det_20_31);
+
+  const auto cofact_20 = +(m01 * det_12_33 - m02 * det_11_33 + m03 * det_11_32);
+  const auto cofact_21 = -(m00 * det_12_33 - m02 * det_10_33 + m03 * det_10_32);
+  const auto cofact_22 = +(m00 * det_11_33 - m01 * det_10_33 + m03 * det_10_31);
+  const auto cofact_23 = -(m00 * det_11_32 - m01 * det_10_32 + m02 * det_10_31);
+
+  const auto cofact_30 = -(m01 * det_12_23 - m02 * det_11_23 + m03 * det_11_22);
+  const auto cofact_31 = +(m00 * det_12_23 - m02 * det_10_23 + m03 * det_10_22);
+  const auto cofact_32 = -(m00 * det_11_23 - m01 * det_10_23 + m03 * det_10_21);
+  const auto cofact_33 = +(m00 * det_11_22 - m01 * det_10_22 + m02 * det_10_21);
+
+  result[0]  = cofact_00 * detInv;
+  result[1]  = cofact_10 * detInv;
+  result[2]  = cofact_20 * detInv;
+  result[3]  = cofact_30 * detInv;
+  result[4]  = cofact_01 * detInv;
+  result[5]  = cofact_11 * detInv;
+  result[6]  = cofact_21 * detInv;
+  result[7]  = cofact_31 * detInv;
+  result[8]  = cofact_02 * detInv;
+  result[9]  = cofact_12 * detInv;
+  result[10] = cofact_22 * detInv;
+  result[11] = cofact_32 * detInv;
+  result[12] = cofact_03 * detInv;
+  result[13] = cofact_13 * detInv;
+  result[14] = cofact_23 * detInv;
+  result[15] = cofact_33 * detInv;
+
+  return true;
+}
+
+void composeScalar(const float* scale, const float* rotation, const float* translation,
+                   float* result)
+{
+  auto m       = result;
+  const auto x = rotation[0], y = rotation[1], z = rotation[2], w = rotation[3];
+  const auto x2 = x + x, y2 = y + y, z2 = z + z;
+  const auto xx = x * x2, xy = x * y2, xz = x * z2;
+  const auto yy = y * y2, yz = y * z2, zz = z * z2;
+  const auto wx = w * x2, wy = w * y2, wz = w * z2;
+
+  const auto sx = scale[0], sy = scale[1], sz = scale[2];
+
+  m[0] = (1.f - (yy + zz)) * sx;
+  m[1] = (xy + wz) * sx;
+  m[2] = (xz - wy) * sx;
+  m[3] = 0.f;
+
+  m[4] = (xy - wz) * sy;
+  m[5] = (1.f - (xx + zz)) * sy;
+  m[6] = (yz + wx) * sy;
+  m[7] = 0.f;
+
+  m[8]  = (xz + wy) * sz;
+  m[9]  = (yz - wx) * sz;
+  m[10] = (1.f - (xx + yy)) * sz;
+  m[11] = 0.f;
+
+  m[12] = translation[0];
+  m[13] = translation[1];
+  m[14] = translation[2];
+  m[15] = 1.f;
+}
+
+void transformCoordinatesScalar(const float* positions, const float* m, float* result,
+                                size_t count)
+{
+  for (size_t i = 0; i < count * 3; i += 3) {
+    const auto x = positions[i], y = positions[i + 1], z = positions[i + 2];
+    const auto rx = x * m[0] + y * m[4] + z * m[8] + m[12];
+    const auto ry = x * m[1] + y * m[5] + z * m[9] + m[13];
+    const auto rz = x * m[2] + y * m[6] + z * m[10] + m[14];
+    const auto rw = 1.f / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+
+    result[i]     = rx * rw;
+    result[i + 1] = ry * rw;
+    result[i + 2] = rz * rw;
+  }
+}
+
+constexpr MatrixKernels ScalarKernels{
+  "Scalar",                           //
+  multiplyScalar,                     //
+  multiplyArrayScalar,                //
+  multiplyPairsT<multiplyScalar>,     //
+  multiplyHierarchyT<multiplyScalar>, //
+  invertScalar,                       //
+  composeScalar,                      //
+  transformCoordinatesScalar          //
+};
+
+#if defined(BABYLON_MATRIX_KERNELS_X86)
+
+/** SSE2 kernels **/
+
+inline void multiplySse2Rows(const float* a, __m128 b0, __m128 b1, __m128 b2, __m128 b3,
+                             float* result)
+{
+  __m128 rows[4];
+  for (unsigned int i = 0; i < 4; ++i) {
+    const auto ai = a + i * 4;
+    auto row      = _mm_mul_ps(_mm_set1_ps(ai[0]), b0);
+    row           = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(ai[1]), b1));
+    row           = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(ai[2]), b2));
+    rows[i]       = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(ai[3]), b3));
+  }
+  for (unsigned int i = 0; i < 4; ++i) {
+    _mm_storeu_ps(result + i * 4, rows[i]);
+  }
+}
+
+void multiplySse2(const float* a, const float* b, float* result)
+{
+  multiplySse2Rows(a, _mm_loadu_ps(b), _mm_loadu_ps(b + 4), _mm_loadu_ps(b + 8),
+                   _mm_loadu_ps(b + 12), result);
+}
+
+void multiplyArraySse2(const float* matrices, const float* other, float* result, size_t count)
+{
+  const auto b0 = _mm_loadu_ps(other), b1 = _mm_loadu_ps(other + 4),
+             b2 = _mm_loadu_ps(other + 8), b3 = _mm_loadu_ps(other + 12);
+  for (size_t i = 0; i < count; ++i) {
+    multiplySse2Rows(matrices + i * 16, b0, b1, b2, b3, result + i * 16);
+  }
+}
+
+bool invertSse2(const float* m, float* result)
+{
+  const auto row0 = _mm_loadu_ps(m), row1 = _mm_loadu_ps(m + 4), row2 = _mm_loadu_ps(m + 8),
+             row3 = _mm_loadu_ps(m + 12);
+
+  // u[c] = (m2c, m2c, m1c, m1c), v[c] = (m3c, m3c, m3c, m2c), w[c] = (m1c, m0c, m0c, m0c)
+#define BABYLON_INVERT_COLUMN(c)                                                                   \
+  const auto u##c = _mm_shuffle_ps(row2, row1, _MM_SHUFFLE(c, c, c, c));                           \
+  const auto t##c = _mm_shuffle_ps(row3, row2, _MM_SHUFFLE(c, c, c, c));                           \
+  const auto v##c = _mm_shuffle_ps(t##c, t##c, _MM_SHUFFLE(2, 0, 0, 0));                           \
+  const auto s##c = _mm_shuffle_ps(row1, row0, _MM_SHUFFLE(c, c, c, c));                           \
+  const auto w##c = _mm_shuffle_ps(s##c, s##c, _MM_SHUFFLE(2, 2, 2, 0));
+  BABYLON_INVERT_COLUMN(0)
+  BABYLON_INVERT_COLUMN(1)
+  BABYLON_INVERT_COLUMN(2)
+  BABYLON_INVERT_COLUMN(3)
+#undef BABYLON_INVERT_COLUMN
+
+  // 2x2 determinants, e.g. e23 = (det_22_33, det_22_33, det_12_33, det_12_23)
+  const auto e23 = _mm_sub_ps(_mm_mul_ps(u2, v3), _mm_mul_ps(v2, u3));
+  const auto e13 = _mm_sub_ps(_mm_mul_ps(u1, v3), _mm_mul_ps(v1, u3));
+  const auto e12 = _mm_sub_ps(_mm_mul_ps(u1, v2), _mm_mul_ps(v1, u2));
+  const auto e03 = _mm_sub_ps(_mm_mul_ps(u0, v3), _mm_mul_ps(v0, u3));
+  const auto e02 = _mm_sub_ps(_mm_mul_ps(u0, v2), _mm_mul_ps(v0, u2));
+  const auto e01 = _mm_sub_ps(_mm_mul_ps(u0, v1), _mm_mul_ps(v0, u1));
+
+  // Cofactors, lane j of c[r] is cofact_jr
+  const auto evenSigns = _mm_setr_ps(0.f, -0.f, 0.f, -0.f);
+  const auto oddSigns  = _mm_setr_ps(-0.f, 0.f, -0.f, 0.f);
+#define BABYLON_INVERT_COFACTOR(p, d1, q, d2, r, d3)                                               \
+  _mm_add_ps(_mm_sub_ps(_mm_mul_ps(p, d1), _mm_mul_ps(q, d2)), _mm_mul_ps(r, d3))
+  const auto c0 = _mm_xor_ps(BABYLON_INVERT_COFACTOR(w1, e23, w2, e13, w3, e12), evenSigns);
+  const auto c1 = _mm_xor_ps(BABYLON_INVERT_COFACTOR(w0, e23, w2, e03, w3, e02), oddSigns);
+  const auto c2 = _mm_xor_ps(BABYLON_INVERT_COFACTOR(w0, e13, w1, e03, w3, e01), evenSigns);
+  const auto c3 = _mm_xor_ps(BABYLON_INVERT_COFACTOR(w0, e12, w1, e02, w2, e01), oddSigns);
+#undef BABYLON_INVERT_COFACTOR
+
+  const auto det = m[0] * _mm_cvtss_f32(c0) + m[1] * _mm_cvtss_f32(c1)
+                   + m[2] * _mm_cvtss_f32(c2) + m[3] * _mm_cvtss_f32(c3);
+
+  if (det == 0.f) {
+    // not invertible
+    return false;
+  }
+
+  const auto detInv = _mm_set1_ps(1.f / det);
+  _mm_storeu_ps(result, _mm_mul_ps(c0, detInv));
+  _mm_storeu_ps(result + 4, _mm_mul_ps(c1, detInv));
+  _mm_storeu_ps(result + 8, _mm_mul_ps(c2, detInv));
+  _mm_storeu_ps(result + 12, _mm_mul_ps(c3, detInv));
+
+  return true;
+}
+
+void composeSse2(const float* scale, const float* rotation, const float* translation,
+                 float* result)
+{
+  const auto x = rotation[0], y = rotation[1], z = rotation[2], w = rotation[3];
+  const auto x2 = x + x, y2 = y + y, z2 = z + z;
+  const auto xx = x * x2, xy = x * y2, xz = x * z2;
+  const auto yy = y * y2, yz = y * z2, zz = z * z2;
+  const auto wx = w * x2, wy = w * y2, wz = w * z2;
+
+  // a - b is computed as a + (-b), which is exact, the last lane is masked to +0
+  const auto mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+  const auto row0 = _mm_add_ps(_mm_setr_ps(1.f, xy, xz, 0.f), _mm_setr_ps(-(yy + zz), wz, -wy, 0.f));
+  const auto row1 = _mm_add_ps(_mm_setr_ps(xy, 1.f, yz, 0.f), _mm_setr_ps(-wz, -(xx + zz), wx, 0.f));
+  const auto row2 = _mm_add_ps(_mm_setr_ps(xz, yz, 1.f, 0.f), _mm_setr_ps(wy, -wx, -(xx + yy), 0.f));
+
+  _mm_storeu_ps(result, _mm_and_ps(_mm_mul_ps(row0, _mm_set1_ps(scale[0])), mask));
+  _mm_storeu_ps(result + 4, _mm_and_ps(_mm_mul_ps(row1, _mm_set1_ps(scale[1])), mask));
+  _mm_storeu_ps(result + 8, _mm_and_ps(_mm_mul_ps(row2, _mm_set1_ps(scale[2])), mask));
+  _mm_storeu_ps(result + 12, _mm_setr_ps(translation[0], translation[1], translation[2], 1.f));
+}
+
+void transformCoordinatesSse2(const float* positions, const float* m, float* result,
+                              size_t count)
+{
+  const auto row0 = _mm_loadu_ps(m), row1 = _mm_loadu_ps(m + 4), row2 = _mm_loadu_ps(m + 8),
+             row3 = _mm_loadu_ps(m + 12);
+  const auto one = _mm_set1_ps(1.f);
+  float transformed[4];
+  for (size_t i = 0; i < count * 3; i += 3) {
+    auto r = _mm_mul_ps(_mm_set1_ps(positions[i]), row0);
+    r      = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(positions[i + 1]), row1));
+    r      = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(positions[i + 2]), row2));
+    r      = _mm_add_ps(r, row3);
+    const auto rw = _mm_div_ps(one, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
+    // (x, y, z) triplets are not 16 bytes aligned, the 4th lane must not be written
+    _mm_storeu_ps(transformed, _mm_mul_ps(r, rw));
+    result[i]     = transformed[0];
+    result[i + 1] = transformed[1];
+    result[i + 2] = transformed[2];
+  }
+}
+
+constexpr MatrixKernels Sse2Kernels{
+  "SSE2",                           //
+  multiplySse2,                     //
+  multiplyArraySse2,                //
+  multiplyPairsT<multiplySse2>,     //
+  multiplyHierarchyT<multiplySse2>, //
+  invertSse2,                       //
+  composeSse2,                      //
+  transformCoordinatesSse2          //
+};
+
+/** AVX kernels, two rows (or two positions) at a time **/
+
+BABYLON_TARGET_AVX inline void multiplyAvxRows(const float* a, __m256 b0, __m256 b1, __m256 b2,
+                                               __m256 b3, float* result)
+{
+  // Rows 0 and 1, then rows 2 and 3 of a, each element broadcasted in its 128 bits lane
+  const auto a01 = _mm256_loadu_ps(a), a23 = _mm256_loadu_ps(a + 8);
+  auto r01       = _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+  auto r23       = _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+  r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+  r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+  r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+  r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+  r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+  r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+  _mm256_storeu_ps(result, r01);
+  _mm256_storeu_ps(result + 8, r23);
+}
+
+BABYLON_TARGET_AVX void multiplyAvx(const float* a, const float* b, float* result)
+{
+  multiplyAvxRows(a, _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b)),
+                  _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4)),
+                  _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8)),
+                  _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12)), result);
+}
+
+BABYLON_TARGET_AVX void multiplyArrayAvx(const float* matrices, const float* other, float* result,
+                                         size_t count)
+{
+  const auto b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other)),
+             b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other + 4)),
+             b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other + 8)),
+             b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other + 12));
+  for (size_t i = 0; i < count; ++i) {
+    multiplyAvxRows(matrices + i * 16, b0, b1, b2, b3, result + i * 16);
+  }
+}
+
+BABYLON_TARGET_AVX void multiplyPairsAvx(const float* a, const float* b, float* result,
+                                         size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    multiplyAvx(a + i * 16, b + i * 16, result + i * 16);
+  }
+}
+
+BABYLON_TARGET_AVX void multiplyHierarchyAvx(const float* locals, const int32_t* parents,
+                                             const float* root, float* worlds, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const auto parent = parents[i] >= 0 ? worlds + parents[i] * 16 : root;
+    if (parent) {
+      multiplyAvx(locals + i * 16, parent, worlds + i * 16);
+    }
+    else {
+      std::memcpy(worlds + i * 16, locals + i * 16, 16 * sizeof(float));
+    }
+  }
+}
+
+BABYLON_TARGET_AVX void transformCoordinatesAvx(const float* positions, const float* m,
+                                                float* result, size_t count)
+{
+  const auto row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m)),
+             row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4)),
+             row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8)),
+             row3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+  const auto one = _mm256_set1_ps(1.f);
+  float transformed[8];
+  size_t i = 0;
+  for (; i + 6 <= count * 3; i += 6) {
+    const auto p = positions + i;
+    auto r       = _mm256_mul_ps(_mm256_setr_ps(p[0], p[0], p[0], p[0], p[3], p[3], p[3], p[3]),
+                           row0);
+    r            = _mm256_add_ps(
+      r, _mm256_mul_ps(_mm256_setr_ps(p[1], p[1], p[1], p[1], p[4], p[4], p[4], p[4]), row1));
+    r = _mm256_add_ps(
+      r, _mm256_mul_ps(_mm256_setr_ps(p[2], p[2], p[2], p[2], p[5], p[5], p[5], p[5]), row2));
+    r             = _mm256_add_ps(r, row3);
+    const auto rw = _mm256_div_ps(one, _mm256_permute_ps(r, _MM_SHUFFLE(3, 3, 3, 3)));
+    _mm256_storeu_ps(transformed, _mm256_mul_ps(r, rw));
+    result[i]     = transformed[0];
+    result[i + 1] = transformed[1];
+    result[i + 2] = transformed[2];
+    result[i + 3] = transformed[4];
+    result[i + 4] = transformed[5];
+    result[i + 5] = transformed[6];
+  }
+  if (i < count * 3) {
+    transformCoordinatesSse2(positions + i, m, result + i, 1);
+  }
+}
+
+constexpr MatrixKernels AvxKernels{
+  "AVX",                  //
+  multiplyAvx,            //
+  multiplyArrayAvx,       //
+  multiplyPairsAvx,       //
+  multiplyHierarchyAvx,   //
+  invertSse2,             //
+  composeSse2,            //
+  transformCoordinatesAvx //
+};
+
+bool cpuSupportsAvx()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  const auto osUsesXSave = (info[2] & (1 << 27)) != 0;
+  const auto cpuHasAvx   = (info[2] & (1 << 28)) != 0;
+  // The OS must also save the YMM registers on context switches
+  return osUsesXSave && cpuHasAvx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx");
+#endif
+}
+
+#elif defined(BABYLON_MATRIX_KERNELS_NEON)
+
+/** NEON kernels **/
+
+inline void multiplyNeonRows(const float* a, float32x4_t b0, float32x4_t b1, float32x4_t b2,
+                             float32x4_t b3, float* result)
+{
+  float32x4_t rows[4];
+  for (unsigned int i = 0; i < 4; ++i) {
+    const auto ai = a + i * 4;
+    // Separate multiply and add (no vmlaq / vfmaq) to stay bit identical with the scalar kernels
+    auto row = vmulq_n_f32(b0, ai[0]);
+    row      = vaddq_f32(row, vmulq_n_f32(b1, ai[1]));
+    row      = vaddq_f32(row, vmulq_n_f32(b2, ai[2]));
+    rows[i]  = vaddq_f32(row, vmulq_n_f32(b3, ai[3]));
+  }
+  for (unsigned int i = 0; i < 4; ++i) {
+    vst1q_f32(result + i * 4, rows[i]);
+  }
+}
+
+void multiplyNeon(const float* a, const float* b, float* result)
+{
+  multiplyNeonRows(a, vld1q_f32(b), vld1q_f32(b + 4), vld1q_f32(b + 8), vld1q_f32(b + 12),
+                   result);
+}
+
+void multiplyArrayNeon(const float* matrices, const float* other, float* result, size_t count)
+{
+  const auto b0 = vld1q_f32(other), b1 = vld1q_f32(other + 4), b2 = vld1q_f32(other + 8),
+             b3 = vld1q_f32(other + 12);
+  for (size_t i = 0; i < count; ++i) {
+    multiplyNeonRows(matrices + i * 16, b0, b1, b2, b3, result + i * 16);
+  }
+}
+
+constexpr MatrixKernels NeonKernels{
+  "NEON",                           //
+  multiplyNeon,                     //
+  multiplyArrayNeon,                //
+  multiplyPairsT<multiplyNeon>,     //
+  multiplyHierarchyT<multiplyNeon>, //
+  invertScalar,                     //
+  composeScalar,                    //
+  transformCoordinatesScalar        //
+};
+
+#endif
+
+const MatrixKernels& selectKernels()
+{
+#if defined(BABYLON_MATRIX_KERNELS_X86)
+  return cpuSupportsAvx() ? AvxKernels : Sse2Kernels;
+#elif defined(BABYLON_MATRIX_KERNELS_NEON)
+  return NeonKernels;
+#else
+  return ScalarKernels;
+#endif
+}
+
+} // end of anonymous namespace
+
+const MatrixKernels& MatrixKernels::Get()
+{
+  static const MatrixKernels& kernels = selectKernels();
+  return kernels;
+}
+
+const MatrixKernels& MatrixKernels::Scalar()
+{
+  return ScalarKernels;
+}
+
+std::vector<const MatrixKernels*> MatrixKernels::Supported()
+{
+  std::vector<const MatrixKernels*> kernels{&ScalarKernels};
+#if defined(BABYLON_MATRIX_KERNELS_X86)
+  kernels.emplace_back(&Sse2Kernels);
+  if (cpuSupportsAvx()) {
+    kernels.emplace_back(&AvxKernels);
+  }
+#elif defined(BABYLON_MATRIX_KERNELS_NEON)
+  kernels.emplace_back(&NeonKernels);
+#endif
+  return kernels;
+}
+
+} // end of namespace BABYLON
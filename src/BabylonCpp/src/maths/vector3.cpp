@@ -4,6 +4,7 @@
 #include <babylon/maths/axis.h>
 #include <babylon/maths/math_tmp.h>
 #include <babylon/maths/matrix.h>
+#include <babylon/maths/matrix_kernels.h>
 #include <babylon/maths/plane.h>
 #include <babylon/maths/quaternion.h>
 #include <babylon/maths/scalar.h>
@@ -720,15 +721,24 @@ void Vector3::TransformCoordinatesToRef(const Vector3& vector, const Matrix& tra
 void Vector3::TransformCoordinatesFromFloatsToRef(float x, float y, float z,
                                                   const Matrix& transformation, Vector3& result)
 {
-  const auto& m = transformation.m();
-  const auto rx = x * m[0] + y * m[4] + z * m[8] + m[12];
-  const auto ry = x * m[1] + y * m[5] + z * m[9] + m[13];
-  const auto rz = x * m[2] + y * m[6] + z * m[10] + m[14];
-  const auto rw = 1 / (x * m[3] + y * m[7] + z * m[11] + m[15]);
-
-  result.x = rx * rw;
-  result.y = ry * rw;
-  result.z = rz * rw;
+  std::array<float, 3> coordinates{x, y, z};
+  MatrixKernels::Get().transformCoordinates(coordinates.data(), transformation.m().data(),
+                                            coordinates.data(), 1);
+
+  result.x = coordinates[0];
+  result.y = coordinates[1];
+  result.z = coordinates[2];
+}
+
+void Vector3::TransformCoordinatesArrayToRef(const Float32Array& positions,
+                                             const Matrix& transformation, Float32Array& result)
+{
+  if (result.size() < positions.size()) {
+    result.resize(positions.size());
+  }
+
+  MatrixKernels::Get().transformCoordinates(positions.data(), transformation.m().data(),
+                                            result.data(), positions.size() / 3);
 }
 
 Vector3 Vector3::TransformNormal(const Vector3& vector, const Matrix& transformation)
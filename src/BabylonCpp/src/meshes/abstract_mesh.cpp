@@ -5,6 +5,7 @@
 #include <babylon/bones/bone.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/collisions/collider.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/collisions/picking_info.h>
@@ -12,6 +13,7 @@
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/extensions/occlusion_query_extension.h>
 #include <babylon/engines/scene.h>
@@ -786,7 +788,7 @@ void AbstractMesh::set_scaling(const Vector3& newScaling)
 
 AbstractMesh* AbstractMesh::getParent()
 {
-  if (parent()->type() == Type::ABSTRACTMESH) {
+  if (parent() && parent()->type() == Type::ABSTRACTMESH) {
     return dynamic_cast<AbstractMesh*>(parent());
   }
 
@@ -1103,6 +1105,9 @@ Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
           _positions()[index / 3].copyFrom(tempVector);
         }
       }
+
+      // The picking hierarchies were built from the positions before skinning
+      _resetTriangleBVHs();
     }
   }
 
@@ -1386,34 +1391,65 @@ Octree<SubMesh*>* AbstractMesh::createOrUpdateSubmeshesOctree(size_t maxCapacity
 }
 
 AbstractMesh& AbstractMesh::_collideForSubMesh(SubMesh* subMesh, const Matrix& transformMatrix,
-                                               Collider& /*iCollider*/)
+                                               const Vector3& localMinimum,
+                                               const Vector3& localMaximum, Collider& iCollider)
 {
   _generatePointsArray();
 
-  if (_positions().empty()) {
+  const auto& positions = _positions();
+  if (positions.empty()) {
+    return *this;
+  }
+
+  const auto hostMesh    = shared_from_base<AbstractMesh>();
+  const auto hasMaterial = subMesh->getMaterial() != nullptr;
+  const auto vertexCount = positions.size();
+  Vector3 p1, p2, p3;
+
+  // Triangles are culled in the local space of the mesh, only the remaining ones are transformed
+  // in the ellipsoid space
+  const auto collideTriangle = [&](size_t indexA, size_t indexB, size_t indexC) {
+    if (indexA >= vertexCount || indexB >= vertexCount || indexC >= vertexCount) {
+      return;
+    }
+    const auto& a = positions[indexA];
+    const auto& b = positions[indexB];
+    const auto& c = positions[indexC];
+    if (std::max({a.x, b.x, c.x}) < localMinimum.x || std::min({a.x, b.x, c.x}) > localMaximum.x
+        || std::max({a.y, b.y, c.y}) < localMinimum.y || std::min({a.y, b.y, c.y}) > localMaximum.y
+        || std::max({a.z, b.z, c.z}) < localMinimum.z
+        || std::min({a.z, b.z, c.z}) > localMaximum.z) {
+      return;
+    }
+    Vector3::TransformCoordinatesToRef(a, transformMatrix, p1);
+    Vector3::TransformCoordinatesToRef(b, transformMatrix, p2);
+    Vector3::TransformCoordinatesToRef(c, transformMatrix, p3);
+    iCollider._testTriangle(p3, p2, p1, hasMaterial, hostMesh);
+  };
+
+  // Large triangle lists select the triangles near the collider with the hierarchy of the geometry
+  const auto& indices = _getPickingIndices();
+  if (const auto triangleBVH = subMesh->_getTriangleBVH(positions, indices)) {
+    static thread_local std::vector<TriangleBVH::Triangle> triangles;
+    triangleBVH->collectTriangles(localMinimum, localMaximum, triangles);
+    for (const auto& triangle : triangles) {
+      collideTriangle(triangle.indexA, triangle.indexB, triangle.indexC);
+    }
     return *this;
   }
 
-  // Transformation
-  if (subMesh->_lastColliderWorldVertices.empty()
-      || !subMesh->_lastColliderTransformMatrix->equals(transformMatrix)) {
-    subMesh->_lastColliderTransformMatrix = std::make_unique<Matrix>(transformMatrix);
-    subMesh->_lastColliderWorldVertices   = {};
-    subMesh->_trianglePlanes              = {};
-    auto start                            = subMesh->verticesStart;
-    auto end                              = (subMesh->verticesStart + subMesh->verticesCount);
-    for (unsigned int i = start; i < end; i++) {
-      subMesh->_lastColliderWorldVertices.emplace_back(
-        Vector3::TransformCoordinates(_positions()[i], transformMatrix));
+  if (indices.empty()) {
+    const auto end = std::min<size_t>(subMesh->verticesStart + subMesh->verticesCount, vertexCount);
+    for (size_t index = subMesh->verticesStart; index + 2 < end; index += 3) {
+      collideTriangle(index, index + 1, index + 2);
+    }
+  }
+  else {
+    const auto end = std::min<size_t>(subMesh->indexStart + subMesh->indexCount, indices.size());
+    for (size_t index = subMesh->indexStart; index + 2 < end; index += 3) {
+      collideTriangle(indices[index], indices[index + 1], indices[index + 2]);
     }
   }
-  // Collide
-#if 0
-  iCollider._collide(
-    subMesh->_trianglePlanes, subMesh->_lastColliderWorldVertices, getIndices(),
-    subMesh->indexStart, subMesh->indexStart + subMesh->indexCount,
-    subMesh->verticesStart, subMesh->getMaterial() != nullptr);
-#endif
   return *this;
 }
 
@@ -1423,6 +1459,28 @@ AbstractMesh& AbstractMesh::_processCollisionsForSubMeshes(Collider& iCollider,
   auto iSubMeshes = _scene->getCollidingSubMeshCandidates(this, iCollider);
   auto len        = iSubMeshes.size();
 
+  // Bounds of the volume swept by the collider in the local space of the mesh (everything when the
+  // transformation is not invertible)
+  const auto maxValue = std::numeric_limits<float>::max();
+  Vector3 localMinimum(-maxValue, -maxValue, -maxValue);
+  Vector3 localMaximum(maxValue, maxValue, maxValue);
+  if (transformMatrix.determinant() != 0.f) {
+    Vector3 sweptMinimum, sweptMaximum, corner;
+    iCollider._getSweptBoundsToRef(sweptMinimum, sweptMaximum);
+    auto& inverseTransformMatrix = TmpVectors::MatrixArray[2];
+    transformMatrix.invertToRef(inverseTransformMatrix);
+    localMinimum.setAll(maxValue);
+    localMaximum.setAll(-maxValue);
+    for (unsigned int i = 0; i < 8; ++i) {
+      Vector3::TransformCoordinatesFromFloatsToRef((i & 1) ? sweptMaximum.x : sweptMinimum.x,
+                                                   (i & 2) ? sweptMaximum.y : sweptMinimum.y,
+                                                   (i & 4) ? sweptMaximum.z : sweptMinimum.z,
+                                                   inverseTransformMatrix, corner);
+      localMinimum.minimizeInPlace(corner);
+      localMaximum.maximizeInPlace(corner);
+    }
+  }
+
   for (size_t index = 0; index < len; ++index) {
     auto& subMesh = iSubMeshes[index];
 
@@ -1431,7 +1489,7 @@ AbstractMesh& AbstractMesh::_processCollisionsForSubMeshes(Collider& iCollider,
       continue;
     }
 
-    _collideForSubMesh(subMesh, transformMatrix, iCollider);
+    _collideForSubMesh(subMesh, transformMatrix, localMinimum, localMaximum, iCollider);
   }
   return *this;
 }
@@ -1458,6 +1516,16 @@ bool AbstractMesh::_generatePointsArray()
   return false;
 }
 
+const IndicesArray& AbstractMesh::_getPickingIndices()
+{
+  static const IndicesArray emptyIndices;
+  return emptyIndices;
+}
+
+void AbstractMesh::_resetTriangleBVHs()
+{
+}
+
 PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastCheck,
                                      const TrianglePickingPredicate& trianglePredicate,
                                      const std::optional<bool>& onlyBoundingInfo,
@@ -1526,6 +1594,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastC
   }
 
   // at least 1 submesh supports intersection, keep going
+  const auto& indices = _getPickingIndices();
   for (size_t index = 0; index < len; ++index) {
     const auto& subMesh = _subMeshes[index];
 
@@ -1535,7 +1604,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastC
     }
 
     auto currentIntersectInfo
-      = subMesh->intersects(ray, _positions(), getIndices(), fastCheck, trianglePredicate);
+      = subMesh->intersects(ray, _positions(), indices, fastCheck, trianglePredicate);
 
     if (currentIntersectInfo) {
       if (fastCheck || !intersectInfo || currentIntersectInfo->distance < intersectInfo->distance) {
@@ -158,6 +158,33 @@ WebGLDataBufferPtr Buffer::updateDirectly(const Float32Array& data, size_t offse
   return _buffer;
 }
 
+bool Buffer::reserve(size_t byteLength)
+{
+  if (!_buffer || !_updatable || _buffer->capacity >= byteLength) {
+    return false;
+  }
+
+  _engine->resizeDynamicVertexBuffer(_buffer, byteLength);
+  _data.clear();
+
+  return true;
+}
+
+WebGLDataBufferPtr Buffer::updateRange(const float* data, size_t byteOffset, size_t byteLength,
+                                       bool discard)
+{
+  if (!_buffer) {
+    return nullptr;
+  }
+
+  if (_updatable) { // update buffer
+    _engine->updateDynamicVertexBufferRange(_buffer, data, byteOffset, byteLength, discard);
+    _data.clear();
+  }
+
+  return _buffer;
+}
+
 void Buffer::_increaseReferences()
 {
   if (!_buffer) {
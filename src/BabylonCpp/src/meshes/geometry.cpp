@@ -5,6 +5,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -216,7 +217,8 @@ void Geometry::setVerticesBuffer(const VertexBufferPtr& buffer,
       }
     }
 
-    _updateExtend(data);
+    // The buffer can be interleaved or hold integer (quantized) positions
+    _updateExtend(buffer->getFloatData(_totalVertices, false));
     _resetPointsArrayCache();
 
     for (const auto& mesh : _meshes) {
@@ -293,14 +295,13 @@ void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
 void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
 {
   std::unordered_map<std::string, VertexBufferPtr> overrideVertexBuffers{};
-  std::unordered_map<std::string, WebGLVertexArrayObjectPtr> overrideVertexArrayObjects{};
-  _bind(effect, indexToBind, overrideVertexBuffers, overrideVertexArrayObjects);
+  _bind(effect, indexToBind, overrideVertexBuffers, nullptr);
 }
 
 void Geometry::_bind(
   const EffectPtr& effect, WebGLDataBufferPtr indexToBind,
   const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers,
-  std::unordered_map<std::string, WebGLVertexArrayObjectPtr>& overrideVertexArrayObjects)
+  std::unordered_map<std::string, WebGLVertexArrayObjectPtr>* overrideVertexArrayObjects)
 {
   if (!effect) {
     return;
@@ -316,14 +317,12 @@ void Geometry::_bind(
     return;
   }
 
-  if (indexToBind != _indexBuffer
-      || (_vertexArrayObjects.empty() && overrideVertexArrayObjects.empty())) {
+  if (indexToBind != _indexBuffer || (_vertexArrayObjects.empty() && !overrideVertexArrayObjects)) {
     _engine->bindBuffers(vbs, indexToBind, effect, overrideVertexBuffers);
     return;
   }
 
-  auto& vaos
-    = !overrideVertexArrayObjects.empty() ? overrideVertexArrayObjects : _vertexArrayObjects;
+  auto& vaos = overrideVertexArrayObjects ? *overrideVertexArrayObjects : _vertexArrayObjects;
 
   // Using VAO
   if (!stl_util::contains(vaos, effect->key()) || !vaos[effect->key()]) {
@@ -423,6 +422,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset, bool gpuMe
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _resetTriangleBVHs();
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -442,6 +442,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVert
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _resetTriangleBVHs();
   if (!_meshes.empty()) {
     _indexBuffer = _engine->createIndexBuffer(_indices, updatable);
   }
@@ -683,6 +684,7 @@ void Geometry::toLeftHanded()
 void Geometry::_resetPointsArrayCache()
 {
   _positions.clear();
+  _resetTriangleBVHs();
 }
 
 bool Geometry::_generatePointsArray()
@@ -720,6 +722,24 @@ bool Geometry::_generatePointsArray()
   return true;
 }
 
+TriangleBVHPtr Geometry::_getTriangleBVH(size_t indexStart, size_t indexCount)
+{
+  std::lock_guard<std::mutex> lock(_triangleBVHsMutex);
+
+  auto& triangleBVH = _triangleBVHs[{indexStart, indexCount}];
+  if (!triangleBVH) {
+    triangleBVH = std::make_shared<TriangleBVH>(_positions, _indices, indexStart, indexCount);
+  }
+
+  return triangleBVH;
+}
+
+void Geometry::_resetTriangleBVHs()
+{
+  std::lock_guard<std::mutex> lock(_triangleBVHsMutex);
+  _triangleBVHs.clear();
+}
+
 bool Geometry::isDisposed() const
 {
   return _isDisposed;
@@ -761,6 +781,7 @@ void Geometry::dispose()
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _resetTriangleBVHs();
 
   delayLoadState = Constants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
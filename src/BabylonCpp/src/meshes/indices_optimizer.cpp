@@ -0,0 +1,412 @@
+#include <babylon/meshes/indices_optimizer.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Vertex ids of a range of indices, relative to the smallest referenced vertex.
+ */
+struct LocalRange {
+  uint32_t minVertex   = 0;
+  size_t verticesCount = 0;
+};
+
+LocalRange localRange(const IndicesArray& indices, size_t indexStart, size_t indexCount)
+{
+  LocalRange range;
+  if (indexCount == 0) {
+    return range;
+  }
+  const auto begin  = indices.begin() + static_cast<std::ptrdiff_t>(indexStart);
+  const auto end    = begin + static_cast<std::ptrdiff_t>(indexCount);
+  const auto minMax = std::minmax_element(begin, end);
+  range.minVertex     = *minMax.first;
+  range.verticesCount = static_cast<size_t>(*minMax.second - *minMax.first) + 1;
+  return range;
+}
+
+/**
+ * @brief Vertex scores of the Forsyth algorithm, tabulated by cache position and by number of
+ * remaining triangles.
+ */
+struct VertexScores {
+  static constexpr size_t MaxValence = 32;
+
+  explicit VertexScores(size_t cacheSize)
+  {
+    static constexpr float CacheDecayPower   = 1.5f;
+    static constexpr float LastTriangleScore = 0.75f;
+    static constexpr float ValenceBoostScale = 2.f;
+    static constexpr float ValenceBoostPower = 0.5f;
+
+    cache.resize(cacheSize + 1);
+    // The vertices of the last triangle have a fixed score, so that the next triangle does not
+    // favor the order in which they were added
+    for (size_t position = 0; position < cacheSize; ++position) {
+      cache[position]
+        = position < 3 ?
+            LastTriangleScore :
+            std::pow(1.f
+                       - static_cast<float>(position - 3)
+                           / static_cast<float>(std::max<size_t>(cacheSize - 3, 1)),
+                     CacheDecayPower);
+    }
+    cache[cacheSize] = 0.f;
+    // Vertices with few remaining triangles are boosted, to avoid leaving lone triangles
+    valence[0] = 0.f;
+    for (size_t count = 1; count <= MaxValence; ++count) {
+      valence[count]
+        = ValenceBoostScale * std::pow(static_cast<float>(count), -ValenceBoostPower);
+    }
+  }
+
+  float score(size_t cachePosition, size_t remainingTriangles) const
+  {
+    if (remainingTriangles == 0) {
+      return -1.f;
+    }
+    return cache[std::min(cachePosition, cache.size() - 1)]
+           + valence[std::min(remainingTriangles, MaxValence)];
+  }
+
+  std::vector<float> cache;
+  std::array<float, MaxValence + 1> valence{};
+}; // end of struct VertexScores
+
+/**
+ * @brief Adds the vertices of a triangle to a FIFO cache.
+ * @returns the number of cache misses
+ */
+size_t updateCache(const uint32_t* triangle, size_t cacheSize, std::vector<uint32_t>& timestamps,
+                   uint32_t& timestamp)
+{
+  size_t misses = 0;
+  for (size_t k = 0; k < 3; ++k) {
+    if (timestamp - timestamps[triangle[k]] > cacheSize) {
+      timestamps[triangle[k]] = timestamp++;
+      ++misses;
+    }
+  }
+  return misses;
+}
+
+} // end of anonymous namespace
+
+void IndicesOptimizer::OptimizeVertexCache(IndicesArray& indices, size_t indexStart,
+                                           size_t indexCount, size_t cacheSize)
+{
+  indexCount = std::min(indexCount, indices.size() - std::min(indexStart, indices.size()));
+  const auto trianglesCount = indexCount / 3;
+  if (trianglesCount < 2 || cacheSize < 4) {
+    return;
+  }
+
+  const auto range = localRange(indices, indexStart, trianglesCount * 3);
+  std::vector<uint32_t> triangles(trianglesCount * 3);
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    triangles[i] = indices[indexStart + i] - range.minVertex;
+  }
+
+  // Triangles of each vertex (compressed rows), the remaining ones first
+  std::vector<uint32_t> offsets(range.verticesCount + 1, 0);
+  for (const auto vertex : triangles) {
+    ++offsets[vertex + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<uint32_t> remaining(range.verticesCount, 0);
+  std::vector<uint32_t> adjacency(triangles.size());
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    const auto vertex                                = triangles[i];
+    adjacency[offsets[vertex] + remaining[vertex]++] = static_cast<uint32_t>(i / 3);
+  }
+
+  const VertexScores scores(cacheSize);
+  std::vector<uint32_t> cachePositions(range.verticesCount, static_cast<uint32_t>(cacheSize));
+  std::vector<float> vertexScores(range.verticesCount);
+  for (size_t vertex = 0; vertex < range.verticesCount; ++vertex) {
+    vertexScores[vertex] = scores.score(cacheSize, remaining[vertex]);
+  }
+  std::vector<float> triangleScores(trianglesCount);
+  for (size_t triangle = 0; triangle < trianglesCount; ++triangle) {
+    triangleScores[triangle] = vertexScores[triangles[triangle * 3]]
+                               + vertexScores[triangles[triangle * 3 + 1]]
+                               + vertexScores[triangles[triangle * 3 + 2]];
+  }
+
+  // The simulated cache is 3 entries larger, to receive the vertices of the emitted triangle
+  std::vector<uint32_t> cache, newCache;
+  cache.reserve(cacheSize + 3);
+  newCache.reserve(cacheSize + 3);
+  std::vector<uint8_t> emitted(trianglesCount, 0);
+  size_t emittedCount = 0, nextTriangle = 0;
+  size_t bestTriangle = 0;
+
+  while (true) {
+    const auto* triangle = &triangles[bestTriangle * 3];
+    for (size_t k = 0; k < 3; ++k) {
+      indices[indexStart + emittedCount * 3 + k] = triangle[k] + range.minVertex;
+    }
+    emitted[bestTriangle] = 1;
+    if (++emittedCount == trianglesCount) {
+      break;
+    }
+
+    // Removes the triangle from the remaining triangles of its vertices
+    for (size_t k = 0; k < 3; ++k) {
+      const auto vertex = triangle[k];
+      const auto begin  = offsets[vertex];
+      const auto end    = begin + remaining[vertex];
+      for (auto i = begin; i < end; ++i) {
+        if (adjacency[i] == bestTriangle) {
+          std::swap(adjacency[i], adjacency[end - 1]);
+          --remaining[vertex];
+          break;
+        }
+      }
+    }
+
+    // Moves the vertices of the triangle to the front of the cache
+    newCache.clear();
+    for (size_t k = 0; k < 3; ++k) {
+      if (std::find(newCache.begin(), newCache.end(), triangle[k]) == newCache.end()) {
+        newCache.emplace_back(triangle[k]);
+      }
+    }
+    for (const auto vertex : cache) {
+      if (std::find(triangle, triangle + 3, vertex) == triangle + 3) {
+        newCache.emplace_back(vertex);
+      }
+    }
+    // Vertices evicted from the cache (in the 3 extra entries) lose their cache score
+    for (size_t position = cacheSize; position < newCache.size(); ++position) {
+      cachePositions[newCache[position]] = static_cast<uint32_t>(cacheSize);
+    }
+    std::swap(cache, newCache);
+
+    // Updates the scores of the vertices of the cache and of their triangles, and picks the best
+    // remaining triangle among them
+    auto bestScore = -1.f;
+    bestTriangle   = trianglesCount;
+    for (size_t position = 0; position < cache.size(); ++position) {
+      const auto vertex = cache[position];
+      if (position < cacheSize) {
+        cachePositions[vertex] = static_cast<uint32_t>(position);
+      }
+      const auto score     = scores.score(cachePositions[vertex], remaining[vertex]);
+      const auto delta     = score - vertexScores[vertex];
+      vertexScores[vertex] = score;
+      const auto begin     = offsets[vertex];
+      const auto end       = begin + remaining[vertex];
+      for (auto i = begin; i < end; ++i) {
+        triangleScores[adjacency[i]] += delta;
+      }
+    }
+    for (size_t position = 0; position < std::min(cache.size(), cacheSize); ++position) {
+      const auto vertex = cache[position];
+      const auto begin  = offsets[vertex];
+      const auto end    = begin + remaining[vertex];
+      for (auto i = begin; i < end; ++i) {
+        if (triangleScores[adjacency[i]] > bestScore) {
+          bestScore    = triangleScores[adjacency[i]];
+          bestTriangle = adjacency[i];
+        }
+      }
+    }
+    if (cache.size() > cacheSize) {
+      cache.resize(cacheSize);
+    }
+
+    // Dead end: continues with the next triangle in the original order
+    if (bestTriangle == trianglesCount) {
+      while (emitted[nextTriangle]) {
+        ++nextTriangle;
+      }
+      bestTriangle = nextTriangle;
+    }
+  }
+}
+
+void IndicesOptimizer::OptimizeOverdraw(IndicesArray& indices, size_t indexStart,
+                                        size_t indexCount, const Float32Array& positions,
+                                        size_t cacheSize, float threshold)
+{
+  indexCount = std::min(indexCount, indices.size() - std::min(indexStart, indices.size()));
+  const auto trianglesCount = indexCount / 3;
+  if (trianglesCount < 2) {
+    return;
+  }
+  const auto range = localRange(indices, indexStart, trianglesCount * 3);
+  if ((range.minVertex + range.verticesCount) * 3 > positions.size()) {
+    return;
+  }
+
+  std::vector<uint32_t> triangles(trianglesCount * 3);
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    triangles[i] = indices[indexStart + i] - range.minVertex;
+  }
+
+  // Hard boundaries: triangles whose 3 vertices miss the cache start a new patch of the mesh
+  std::vector<uint32_t> timestamps(range.verticesCount, 0);
+  auto timestamp = static_cast<uint32_t>(cacheSize + 1);
+  std::vector<size_t> hardBoundaries;
+  for (size_t triangle = 0; triangle < trianglesCount; ++triangle) {
+    const auto misses = updateCache(&triangles[triangle * 3], cacheSize, timestamps, timestamp);
+    if (triangle == 0 || misses == 3) {
+      hardBoundaries.emplace_back(triangle);
+    }
+  }
+
+  // Soft boundaries: each patch is split into clusters as soon as their cache miss ratio is
+  // within the threshold of the one of the patch
+  std::vector<size_t> clusters;
+  std::fill(timestamps.begin(), timestamps.end(), 0);
+  timestamp = 0;
+  for (size_t it = 0; it < hardBoundaries.size(); ++it) {
+    const auto start = hardBoundaries[it];
+    const auto end
+      = it + 1 < hardBoundaries.size() ? hardBoundaries[it + 1] : trianglesCount;
+
+    timestamp += static_cast<uint32_t>(cacheSize + 1);
+    size_t patchMisses = 0;
+    for (auto triangle = start; triangle < end; ++triangle) {
+      patchMisses += updateCache(&triangles[triangle * 3], cacheSize, timestamps, timestamp);
+    }
+    const auto clusterThreshold
+      = threshold * static_cast<float>(patchMisses) / static_cast<float>(end - start);
+
+    clusters.emplace_back(start);
+    timestamp += static_cast<uint32_t>(cacheSize + 1);
+    size_t misses = 0, count = 0;
+    for (auto triangle = start; triangle < end; ++triangle) {
+      misses += updateCache(&triangles[triangle * 3], cacheSize, timestamps, timestamp);
+      ++count;
+      if (static_cast<float>(misses) / static_cast<float>(count) <= clusterThreshold) {
+        clusters.emplace_back(triangle + 1);
+        timestamp += static_cast<uint32_t>(cacheSize + 1);
+        misses = count = 0;
+      }
+    }
+    // The last cluster is merged with the previous one, as it is usually too small to be
+    // efficient
+    if (clusters.back() != start) {
+      clusters.pop_back();
+    }
+  }
+
+  // Mesh centroid
+  std::array<double, 3> meshCentroid{};
+  for (const auto vertex : triangles) {
+    for (size_t k = 0; k < 3; ++k) {
+      meshCentroid[k] += positions[(range.minVertex + vertex) * 3 + k];
+    }
+  }
+  for (auto& value : meshCentroid) {
+    value /= static_cast<double>(triangles.size());
+  }
+
+  // Clusters facing outwards, i.e. away from the center of the mesh, are drawn first as they
+  // are more likely to occlude the other ones
+  std::vector<float> sortKeys(clusters.size());
+  for (size_t it = 0; it < clusters.size(); ++it) {
+    const auto start = clusters[it];
+    const auto end   = it + 1 < clusters.size() ? clusters[it + 1] : trianglesCount;
+
+    double area = 0.0;
+    std::array<double, 3> centroid{}, normal{};
+    for (auto triangle = start; triangle < end; ++triangle) {
+      std::array<std::array<double, 3>, 3> p{};
+      for (size_t v = 0; v < 3; ++v) {
+        for (size_t k = 0; k < 3; ++k) {
+          p[v][k] = positions[(range.minVertex + triangles[triangle * 3 + v]) * 3 + k];
+        }
+      }
+      const std::array<double, 3> p10{p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+      const std::array<double, 3> p20{p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+      const std::array<double, 3> n{p10[1] * p20[2] - p10[2] * p20[1],
+                                    p10[2] * p20[0] - p10[0] * p20[2],
+                                    p10[0] * p20[1] - p10[1] * p20[0]};
+      const auto triangleArea = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+      for (size_t k = 0; k < 3; ++k) {
+        centroid[k] += (p[0][k] + p[1][k] + p[2][k]) * (triangleArea / 3.0);
+        normal[k] += n[k];
+      }
+      area += triangleArea;
+    }
+
+    const auto invArea      = area == 0.0 ? 0.0 : 1.0 / area;
+    const auto normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1]
+                                        + normal[2] * normal[2]);
+    const auto invLength    = normalLength == 0.0 ? 0.0 : 1.0 / normalLength;
+    double key              = 0.0;
+    for (size_t k = 0; k < 3; ++k) {
+      key += (centroid[k] * invArea - meshCentroid[k]) * normal[k] * invLength;
+    }
+    sortKeys[it] = static_cast<float>(key);
+  }
+
+  std::vector<size_t> order(clusters.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+  auto index = indexStart;
+  for (const auto it : order) {
+    const auto start = clusters[it];
+    const auto end   = it + 1 < clusters.size() ? clusters[it + 1] : trianglesCount;
+    for (auto i = start * 3; i < end * 3; ++i) {
+      indices[index++] = triangles[i] + range.minVertex;
+    }
+  }
+}
+
+Uint32Array IndicesOptimizer::OptimizeVertexFetch(const IndicesArray& indices, size_t indexStart,
+                                                  size_t indexCount, size_t verticesStart,
+                                                  size_t verticesCount)
+{
+  indexCount = std::min(indexCount, indices.size() - std::min(indexStart, indices.size()));
+  Uint32Array order;
+  order.reserve(verticesCount);
+  std::vector<uint8_t> used(verticesCount, 0);
+  for (size_t i = indexStart; i < indexStart + indexCount; ++i) {
+    const auto vertex = static_cast<size_t>(indices[i]);
+    if (vertex >= verticesStart && vertex < verticesStart + verticesCount
+        && !used[vertex - verticesStart]) {
+      used[vertex - verticesStart] = 1;
+      order.emplace_back(static_cast<uint32_t>(vertex));
+    }
+  }
+  for (size_t vertex = 0; vertex < verticesCount; ++vertex) {
+    if (!used[vertex]) {
+      order.emplace_back(static_cast<uint32_t>(verticesStart + vertex));
+    }
+  }
+  return order;
+}
+
+float IndicesOptimizer::AverageCacheMissRatio(const IndicesArray& indices, size_t cacheSize)
+{
+  const auto trianglesCount = indices.size() / 3;
+  if (trianglesCount == 0) {
+    return 0.f;
+  }
+  const auto range = localRange(indices, 0, trianglesCount * 3);
+  std::array<uint32_t, 3> triangle{};
+  std::vector<uint32_t> timestamps(range.verticesCount, 0);
+  auto timestamp = static_cast<uint32_t>(cacheSize + 1);
+  size_t misses  = 0;
+  for (size_t i = 0; i < trianglesCount; ++i) {
+    for (size_t k = 0; k < 3; ++k) {
+      triangle[k] = indices[i * 3 + k] - range.minVertex;
+    }
+    misses += updateCache(triangle.data(), cacheSize, timestamps, timestamp);
+  }
+  return static_cast<float>(misses) / static_cast<float>(trianglesCount);
+}
+
+} // end of namespace BABYLON
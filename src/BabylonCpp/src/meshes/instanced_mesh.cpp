@@ -40,6 +40,9 @@ InstancedMesh::InstancedMesh(const std::string& iName, const MeshPtr& source)
 
   infiniteDistance = source->infiniteDistance();
 
+  // Instanced buffers start with the values of the source mesh
+  instancedBuffers = source->instancedBuffers;
+
   setPivotMatrix(source->getPivotMatrix());
 
   refreshBoundingInfo();
@@ -189,7 +192,7 @@ IndicesArray InstancedMesh::getIndices(bool /*copyWhenShared*/, bool /*forceCopy
   return _sourceMesh->getIndices();
 }
 
-std::vector<Vector3>& InstancedMesh::_positions()
+std::vector<Vector3>& InstancedMesh::get__positions()
 {
   return _sourceMesh->_positions();
 }
@@ -326,6 +329,16 @@ bool InstancedMesh::_generatePointsArray()
   return _sourceMesh->_generatePointsArray();
 }
 
+const IndicesArray& InstancedMesh::_getPickingIndices()
+{
+  return _sourceMesh->_getPickingIndices();
+}
+
+void InstancedMesh::_resetTriangleBVHs()
+{
+  _sourceMesh->_resetTriangleBVHs();
+}
+
 AbstractMesh& InstancedMesh::_updateBoundingInfo()
 {
   const auto effectiveMesh = static_cast<AbstractMesh*>(this);
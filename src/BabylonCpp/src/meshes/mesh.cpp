@@ -1,5 +1,8 @@
 ﻿#include <babylon/meshes/sub_mesh.h>
 
+#include <algorithm>
+#include <numeric>
+
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
@@ -22,6 +25,7 @@
 #include <babylon/materials/multi_material.h>
 #include <babylon/materials/textures/render_target_texture.h>
 #include <babylon/maths/matrix.h>
+#include <babylon/maths/matrix_kernels.h>
 #include <babylon/maths/scalar.h>
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/maths/vector2.h>
@@ -54,10 +58,13 @@
 #include <babylon/meshes/builders/tube_builder.h>
 #include <babylon/meshes/geometry.h>
 #include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/indices_optimizer.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
+#include <babylon/meshes/vertex_welder.h>
 #include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/morph/morph_target.h>
@@ -87,6 +94,8 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , edgesShareWithInstances{false}
     , onLODLevelSelection{nullptr}
     , morphTargetManager{this, &Mesh::get_morphTargetManager, &Mesh::set_morphTargetManager}
+    , bakedVertexAnimationManager{this, &Mesh::get_bakedVertexAnimationManager,
+                                  &Mesh::set_bakedVertexAnimationManager}
     , _creationDataStorage{std::make_shared<_CreationDataStorage>()}
     , _geometry{nullptr}
     , _shouldGenerateFlatShading{false}
@@ -236,6 +245,20 @@ void Mesh::set_morphTargetManager(const MorphTargetManagerPtr& value)
   _syncGeometryWithMorphTargetManager();
 }
 
+BakedVertexAnimationManagerPtr& Mesh::get_bakedVertexAnimationManager()
+{
+  return _internalMeshDataInfo->_bakedVertexAnimationManager;
+}
+
+void Mesh::set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value)
+{
+  if (_internalMeshDataInfo->_bakedVertexAnimationManager == value) {
+    return;
+  }
+  _internalMeshDataInfo->_bakedVertexAnimationManager = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
 Mesh*& Mesh::get_source()
 {
   return _internalMeshDataInfo->_source;
@@ -1105,7 +1128,14 @@ void Mesh::_bind(SubMesh* subMesh, const EffectPtr& effect, unsigned int fillMod
   }
 
   // VBOs
-  _geometry->_bind(effect, indexToBind);
+  if (!_userInstancedBuffersStorage || hasThinInstances()) {
+    _geometry->_bind(effect, indexToBind);
+  }
+  else {
+    auto& vertexArrayObjects = _userInstancedBuffersStorage->vertexArrayObjects;
+    _geometry->_bind(effect, indexToBind, _userInstancedBuffersStorage->vertexBuffers,
+                     vertexArrayObjects ? &(*vertexArrayObjects) : nullptr);
+  }
 }
 
 void Mesh::_draw(SubMesh* subMesh, int fillMode, size_t instancesCount, bool /*alternate*/)
@@ -1233,7 +1263,7 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
 
   if (instanceStorage->instancesData.empty()
       || currentInstancesBufferSize != instanceStorage->instancesBufferSize) {
-    instanceStorage->instancesData = Float32Array(instanceStorage->instancesBufferSize / 4);
+    instanceStorage->instancesData.resize(instanceStorage->instancesBufferSize / 4);
   }
 
   auto offset         = 0u;
@@ -1264,11 +1294,7 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
     instancesCount = (renderSelf ? 1 : 0) + static_cast<unsigned int>(visibleInstances.size());
   }
 
-  if (needUpdateBuffer) {
-    if (instancesBuffer) {
-      instancesBuffer->dispose();
-    }
-
+  if (!instancesBuffer) {
     instancesBuffer
       = std::make_shared<Buffer>(engine, instanceStorage->instancesData, true, 16, false, true);
 
@@ -1277,10 +1303,12 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
     setVerticesBuffer(instancesBuffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
     setVerticesBuffer(instancesBuffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
   }
-  else {
-    if (!_instanceDataStorage->isFrozen) {
-      instancesBuffer->updateDirectly(instanceStorage->instancesData, 0, instancesCount);
-    }
+  else if (needUpdateBuffer || !_instanceDataStorage->isFrozen) {
+    // The data store grows in place and is orphaned on each upload, so the World0..3 vertex
+    // buffers are never recreated and the upload does not wait for the draws of previous batches
+    instancesBuffer->reserve(instanceStorage->instancesBufferSize);
+    instancesBuffer->updateRange(instanceStorage->instancesData.data(), 0,
+                                 instancesCount * 16 * sizeof(float), true);
   }
 
   _processInstancedBuffers(visibleInstances, renderSelf);
@@ -1339,7 +1367,7 @@ void Mesh::thinInstanceRegisterAttribute(const std::string& kind, unsigned int s
     = stride
       * std::max(32, static_cast<int>(_thinInstanceDataStorage->instancesCount)); // Initial size
   _userThinInstanceBuffersStorage->data[kind]
-    = {static_cast<float>(_userThinInstanceBuffersStorage->sizes[kind])};
+    = Float32Array(_userThinInstanceBuffersStorage->sizes[kind]);
   _userThinInstanceBuffersStorage->vertexBuffers[kind] = std::make_shared<VertexBuffer>(
     getEngine(), _userThinInstanceBuffersStorage->data[kind], kind, true, false, stride, true);
 
@@ -1356,6 +1384,7 @@ bool Mesh::thinInstanceSetMatrixAt(size_t index, Matrix& iMatrix, bool refresh)
   auto& matrixData = _thinInstanceDataStorage->matrixData;
 
   iMatrix.copyToArray(matrixData, static_cast<unsigned>(index) * 16);
+  _thinInstanceDataStorage->matrixDirtyRange.add(index * 16, 16);
 
   if (_thinInstanceDataStorage->worldMatrices) {
     if (index >= _thinInstanceDataStorage->worldMatrices->size()) {
@@ -1387,6 +1416,7 @@ bool Mesh::thinInstanceSetAttributeAt(const std::string& kind, size_t index,
   _thinInstanceUpdateBufferSize(kind, 0);
 
   auto offset = index * _userThinInstanceBuffersStorage->strides[kind];
+  _userThinInstanceBuffersStorage->dirtyRanges[kind].add(offset, value.size());
   for (const auto v : value) {
     _userThinInstanceBuffersStorage->data[kind][offset++] = v;
   }
@@ -1411,6 +1441,7 @@ void Mesh::thinInstanceSetBuffer(const std::string& kind, const Float32Array& bu
     _thinInstanceDataStorage->matrixBufferSize = !buffer.empty() ? buffer.size() : 32 * stride;
     _thinInstanceDataStorage->matrixData       = buffer;
     _thinInstanceDataStorage->worldMatrices    = std::nullopt;
+    _thinInstanceDataStorage->matrixDirtyRange = {};
 
     if (!buffer.empty()) {
       _thinInstanceDataStorage->instancesCount = buffer.size() / stride;
@@ -1446,6 +1477,7 @@ void Mesh::thinInstanceSetBuffer(const std::string& kind, const Float32Array& bu
         _userThinInstanceBuffersStorage->strides.erase(kind);
         _userThinInstanceBuffersStorage->sizes.erase(kind);
         _userThinInstanceBuffersStorage->vertexBuffers.erase(kind);
+        _userThinInstanceBuffersStorage->dirtyRanges.erase(kind);
       }
     }
     else {
@@ -1454,6 +1486,7 @@ void Mesh::thinInstanceSetBuffer(const std::string& kind, const Float32Array& bu
       _userThinInstanceBuffersStorage->data[kind]          = buffer;
       _userThinInstanceBuffersStorage->strides[kind]       = stride;
       _userThinInstanceBuffersStorage->sizes[kind]         = buffer.size();
+      _userThinInstanceBuffersStorage->dirtyRanges[kind]   = {};
       _userThinInstanceBuffersStorage->vertexBuffers[kind] = std::make_shared<VertexBuffer>(
         getEngine(), buffer, kind, !staticBuffer, false, stride, true);
 
@@ -1466,18 +1499,43 @@ void Mesh::thinInstanceBufferUpdated(const std::string& kind)
 {
   if (kind == "matrix") {
     if (_thinInstanceDataStorage->matrixBuffer) {
-      _thinInstanceDataStorage->matrixBuffer->updateDirectly(
-        _thinInstanceDataStorage->matrixData, 0, _thinInstanceDataStorage->instancesCount);
+      _thinInstanceUploadBuffer(_thinInstanceDataStorage->matrixBuffer.get(),
+                                _thinInstanceDataStorage->matrixData,
+                                _thinInstanceDataStorage->instancesCount * 16,
+                                _thinInstanceDataStorage->matrixDirtyRange);
     }
   }
   else if (_userThinInstanceBuffersStorage
            && stl_util::contains(_userThinInstanceBuffersStorage->vertexBuffers, kind)
            && _userThinInstanceBuffersStorage->vertexBuffers[kind]) {
-    _userThinInstanceBuffersStorage->vertexBuffers[kind]->updateDirectly(
-      _userThinInstanceBuffersStorage->data[kind], 0);
+    const auto& data = _userThinInstanceBuffersStorage->data[kind];
+    _thinInstanceUploadBuffer(_userThinInstanceBuffersStorage->vertexBuffers[kind]->_getBuffer(),
+                              data, data.size(), _userThinInstanceBuffersStorage->dirtyRanges[kind]);
   }
 }
 
+void Mesh::_thinInstanceUploadBuffer(Buffer* buffer, const Float32Array& data, size_t usedSize,
+                                     _ThinInstanceDirtyRange& dirtyRange)
+{
+  // Only upload the modified range, or the used part of the buffer when nothing was tracked
+  auto start = size_t{0};
+  auto end   = std::min(usedSize, data.size());
+  if (dirtyRange.start < dirtyRange.end) {
+    start = dirtyRange.start;
+    end   = std::min(dirtyRange.end, end);
+  }
+  dirtyRange = {};
+
+  if (start >= end) {
+    return;
+  }
+
+  // The data store can be orphaned when the whole used part of the buffer is rewritten
+  const auto discard = (start == 0 && end == std::min(usedSize, data.size()));
+  buffer->updateRange(data.data() + start, start * sizeof(float), (end - start) * sizeof(float),
+                      discard);
+}
+
 void Mesh::thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
                                            size_t offset)
 {
@@ -1525,7 +1583,7 @@ void Mesh::thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo)
   }
 
   const auto boundingInfo = getBoundingInfo();
-  const auto matrixData   = _thinInstanceDataStorage->matrixData;
+  const auto& matrixData  = _thinInstanceDataStorage->matrixData;
 
   if (vectors.empty()) {
     for (size_t v = 0; v < boundingInfo->boundingBox.vectors.size(); ++v) {
@@ -1536,12 +1594,20 @@ void Mesh::thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo)
   TmpVectors::Vector3Array[0].setAll(std::numeric_limits<float>::max());    // min
   TmpVectors::Vector3Array[1].setAll(std::numeric_limits<float>::lowest()); // max
 
+  // The bounding vectors are transformed by each instance matrix in one call
+  Float32Array sourceVectors(vectors.size() * 3), transformedVectors(vectors.size() * 3);
+  for (size_t v = 0; v < vectors.size(); ++v) {
+    vectors[v].toArray(sourceVectors, static_cast<unsigned int>(v * 3));
+  }
+  const auto& kernels = MatrixKernels::Get();
+
   for (unsigned int i = 0; i < _thinInstanceDataStorage->instancesCount; ++i) {
-    Matrix::FromArrayToRef(matrixData, i * 16, TmpVectors::MatrixArray[0]);
+    kernels.transformCoordinates(sourceVectors.data(), matrixData.data() + i * 16,
+                                 transformedVectors.data(), vectors.size());
 
     for (size_t v = 0; v < vectors.size(); ++v) {
-      Vector3::TransformCoordinatesToRef(vectors[v], TmpVectors::MatrixArray[0],
-                                         TmpVectors::Vector3Array[2]);
+      TmpVectors::Vector3Array[2].copyFromFloats(
+        transformedVectors[v * 3], transformedVectors[v * 3 + 1], transformedVectors[v * 3 + 2]);
       TmpVectors::Vector3Array[0].minimizeInPlace(TmpVectors::Vector3Array[2]);
       TmpVectors::Vector3Array[1].maximizeInPlace(TmpVectors::Vector3Array[2]);
     }
@@ -1589,8 +1655,27 @@ void Mesh::_thinInstanceUpdateBufferSize(const std::string& kind, size_t numInst
       data = newData;
     }
 
-    if (kindIsMatrix) {
-      _thinInstanceDataStorage->matrixBuffer->dispose();
+    // Grow the data store of the existing buffer in place, which keeps the vertex buffers (and the
+    // vertex array objects using them) valid
+    auto buffer = kindIsMatrix ?
+                    _thinInstanceDataStorage->matrixBuffer.get() :
+                    _userThinInstanceBuffersStorage->vertexBuffers[kind]->_getBuffer();
+    if (buffer && buffer->isUpdatable() && buffer->getBuffer()) {
+      buffer->reserve(newSize * sizeof(float));
+      buffer->updateRange(data.data(), 0, data.size() * sizeof(float), true);
+      if (kindIsMatrix) {
+        _thinInstanceDataStorage->matrixData       = data;
+        _thinInstanceDataStorage->matrixBufferSize = newSize;
+      }
+      else {
+        _userThinInstanceBuffersStorage->data[kind]  = data;
+        _userThinInstanceBuffersStorage->sizes[kind] = newSize;
+      }
+    }
+    else if (kindIsMatrix) {
+      if (_thinInstanceDataStorage->matrixBuffer) {
+        _thinInstanceDataStorage->matrixBuffer->dispose();
+      }
 
       const auto matrixBuffer
         = std::make_shared<Buffer>(getEngine(), data, true, stride, false, true);
@@ -1662,7 +1747,7 @@ void Mesh::registerInstancedBuffer(const std::string& kind, size_t stride)
   }
 
   // Creates an empty property for this kind
-  instancedBuffers[kind] = {0};
+  instancedBuffers[kind] = Float32Array(stride, 0.f);
 
   _userInstancedBuffersStorage->strides[kind] = stride;
   _userInstancedBuffersStorage->sizes[kind]   = stride * 32; // Initial size
@@ -1672,15 +1757,74 @@ void Mesh::registerInstancedBuffer(const std::string& kind, size_t stride)
     getEngine(), _userInstancedBuffersStorage->data[kind], kind, true, false, stride, true);
 
   for (const auto& instance : instances) {
-    instance->instancedBuffers[kind] = nullptr;
+    instance->instancedBuffers[kind] = Float32Array(stride, 0.f);
   }
 
   _invalidateInstanceVertexArrayObject();
 }
 
-void Mesh::_processInstancedBuffers(const std::vector<InstancedMesh*>& /*visibleInstances*/,
-                                    bool /*renderSelf*/)
+void Mesh::_processInstancedBuffers(const std::vector<InstancedMesh*>& visibleInstances,
+                                    bool renderSelf)
 {
+  if (!_userInstancedBuffersStorage) {
+    return;
+  }
+
+  auto& storage             = *_userInstancedBuffersStorage;
+  const auto instancesCount = visibleInstances.size();
+
+  for (const auto& [kind, value] : instancedBuffers) {
+    // Not registered with registerInstancedBuffer
+    if (!stl_util::contains(storage.strides, kind) || storage.strides[kind] == 0) {
+      continue;
+    }
+
+    auto size         = storage.sizes[kind];
+    const auto stride = storage.strides[kind];
+
+    // Resize if required
+    const auto expectedSize = (instancesCount + 1) * stride;
+    while (size < expectedSize) {
+      size *= 2;
+    }
+
+    if (storage.data[kind].size() != size) {
+      storage.data[kind]  = Float32Array(size);
+      storage.sizes[kind] = size;
+      if (storage.vertexBuffers[kind]) {
+        storage.vertexBuffers[kind]->dispose();
+        storage.vertexBuffers[kind] = nullptr;
+      }
+    }
+
+    // Update data buffer
+    auto& data        = storage.data[kind];
+    const auto copyTo = [&data, stride](const Float32Array& source, size_t offset) {
+      std::copy_n(source.begin(), std::min(stride, source.size()), data.begin() + offset);
+    };
+    size_t offset = 0;
+    if (renderSelf) {
+      copyTo(value, offset);
+      offset += stride;
+    }
+    for (const auto& instance : visibleInstances) {
+      const auto it = instance->instancedBuffers.find(kind);
+      if (it != instance->instancedBuffers.end()) {
+        copyTo(it->second, offset);
+      }
+      offset += stride;
+    }
+
+    // Update vertex buffer
+    if (!storage.vertexBuffers[kind]) {
+      storage.vertexBuffers[kind]
+        = std::make_shared<VertexBuffer>(getEngine(), data, kind, true, false, stride, true);
+      _invalidateInstanceVertexArrayObject();
+    }
+    else {
+      storage.vertexBuffers[kind]->updateDirectly(data, 0);
+    }
+  }
 }
 
 void Mesh::_invalidateInstanceVertexArrayObject()
@@ -1694,7 +1838,7 @@ void Mesh::_invalidateInstanceVertexArrayObject()
     getEngine()->releaseVertexArrayObject(vaos);
   }
 
-  _userInstancedBuffersStorage->vertexArrayObjects = {};
+  _userInstancedBuffersStorage->vertexArrayObjects->clear();
 }
 
 Mesh& Mesh::_processRendering(
@@ -2288,10 +2432,7 @@ Mesh& Mesh::bakeTransformIntoVertices(const Matrix& transform)
 
   auto data = getVerticesData(VertexBuffer::PositionKind);
   Float32Array temp;
-  unsigned int index;
-  for (index = 0; index < data.size(); index += 3) {
-    Vector3::TransformCoordinates(Vector3::FromArray(data, index), transform).toArray(temp, index);
-  }
+  Vector3::TransformCoordinatesArrayToRef(data, transform, temp);
 
   setVerticesData(VertexBuffer::PositionKind, temp,
                   getVertexBuffer(VertexBuffer::PositionKind)->isUpdatable());
@@ -2300,7 +2441,7 @@ Mesh& Mesh::bakeTransformIntoVertices(const Matrix& transform)
   if (isVerticesDataPresent(VertexBuffer::NormalKind)) {
     data = getVerticesData(VertexBuffer::NormalKind);
     temp.clear();
-    for (index = 0; index < data.size(); index += 3) {
+    for (unsigned int index = 0; index < data.size(); index += 3) {
       Vector3::TransformNormal(Vector3::FromArray(data, index), transform)
         .normalize()
         .toArray(temp, index);
@@ -2356,6 +2497,22 @@ bool Mesh::_generatePointsArray()
   return false;
 }
 
+const IndicesArray& Mesh::_getPickingIndices()
+{
+  if (_geometry && _geometry->isReady()) {
+    return _geometry->_indices;
+  }
+
+  return AbstractMesh::_getPickingIndices();
+}
+
+void Mesh::_resetTriangleBVHs()
+{
+  if (_geometry) {
+    _geometry->_resetTriangleBVHs();
+  }
+}
+
 MeshPtr Mesh::clone(const std::string& iName, Node* newParent, bool doNotCloneChildren,
                     bool clonePhysicsImpostor)
 {
@@ -2871,57 +3028,44 @@ void Mesh::forceSharedVertices()
     Uint32Array indices;
     Float32Array uvs;
     Float32Array colors;
-    // lists facet vertex positions (a,b,c) as string "a|b|c"
-    std::vector<std::string> pstring;
-
-    auto indexPtr = 0ull;                                 // pointer to next available index value
-    std::unordered_map<std::string, int> uniquePositions; // unique vertex positions
-    auto ptr = 0;                                         // pointer to element in uniquePositions
-    IndicesArray facet;
 
-    for (size_t i = 0; i < currentIndices.size(); i += 3) {
-      facet
-        = {currentIndices[i], currentIndices[i + 1], currentIndices[i + 2]}; // facet vertex indices
-      pstring.clear();
-      for (unsigned int j = 0; j < 3; j++) {
-        pstring[j] = "";
-        for (unsigned int k = 0; k < 3; k++) {
-          // small values make 0
-          if (std::abs(currentPositions[3 * facet[j] + k]) < 0.00000001f) {
-            currentPositions[3 * facet[j] + k] = 0;
-          }
-          pstring[j] += std::to_string(currentPositions[3 * facet[j] + k]) + "|";
-        }
-      }
-      // check facet vertices to see that none are repeated
+    // Weld the vertices sharing the same position
+    VertexWelderOptions options;
+    options.epsilon    = 1e-6f;
+    const auto remap   = VertexWelder::Weld(currentPositions, options);
+    const auto noIndex = std::numeric_limits<uint32_t>::max();
+    Uint32Array newIndices(remap.size(), noIndex);
+    auto indexPtr = 0u; // pointer to next available index value
+    std::array<uint32_t, 3> facet;
+
+    for (size_t i = 0; i + 2 < currentIndices.size(); i += 3) {
+      // facet vertex indices
+      facet = {remap[currentIndices[i]], remap[currentIndices[i + 1]],
+               remap[currentIndices[i + 2]]};
       // do not process any facet that has a repeated vertex, ie is a line
-      if (!(pstring[0] == pstring[1] || pstring[0] == pstring[2] || pstring[1] == pstring[2])) {
-        // for each facet position check if already listed in uniquePositions
-        // if not listed add to uniquePositions and set index pointer
-        // if listed use its index in uniquePositions and new index pointer
-        for (size_t j = 0; j < 3; j++) {
-          ptr = stl_util::contains(uniquePositions, pstring[j]) ? uniquePositions[pstring[j]] : -1;
-          if (ptr == -1) {
-            uniquePositions[pstring[j]] = static_cast<int>(indexPtr);
-            ptr                         = static_cast<int>(indexPtr++);
-            // not listed so add individual x, y, z coordinates to positions
-            for (unsigned k = 0; k < 3; k++) {
-              positions.emplace_back(currentPositions[3 * facet[j] + k]);
-            }
-            if (!currentColors.empty()) {
-              for (unsigned k = 0; k < 4; k++) {
-                colors.emplace_back(currentColors[4 * facet[j] + k]);
-              }
+      if (facet[0] == facet[1] || facet[0] == facet[2] || facet[1] == facet[2]) {
+        continue;
+      }
+      for (const auto vertex : facet) {
+        if (newIndices[vertex] == noIndex) {
+          newIndices[vertex] = indexPtr++;
+          // not listed so add individual x, y, z coordinates to positions
+          for (unsigned k = 0; k < 3; k++) {
+            positions.emplace_back(currentPositions[3 * vertex + k]);
+          }
+          if (!currentColors.empty()) {
+            for (unsigned k = 0; k < 4; k++) {
+              colors.emplace_back(currentColors[4 * vertex + k]);
             }
-            if (!currentUVs.empty()) {
-              for (unsigned k = 0; k < 2; k++) {
-                uvs.emplace_back(currentUVs[2 * facet[j] + k]);
-              }
+          }
+          if (!currentUVs.empty()) {
+            for (unsigned k = 0; k < 2; k++) {
+              uvs.emplace_back(currentUVs[2 * vertex + k]);
             }
           }
-          // add new index pointer to indices array
-          indices.emplace_back(ptr);
         }
+        // add new index pointer to indices array
+        indices.emplace_back(newIndices[vertex]);
       }
     }
 
@@ -2971,59 +3115,157 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
-void Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback)
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings, bool parallelProcessing,
+                     SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
 {
-  successCallback(nullptr);
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.parallelProcessing = parallelProcessing;
+  task.mesh               = shared_from_base<Mesh>();
+  task.simplificationType = simplificationType;
+  task.successCallback    = successCallback;
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
+}
+
+void Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback,
+                           const IndicesOptimizerOptions& options)
+{
+  auto indices = getIndices();
+  if (!_geometry || indices.empty() || indices.size() % 3 != 0) {
+    if (successCallback) {
+      successCallback(this);
+    }
+    return;
+  }
+
+  for (const auto& subMesh : subMeshes) {
+    const auto material = subMesh->getMaterial();
+    if (material && material->fillMode() != Material::TriangleFillMode) {
+      if (successCallback) {
+        successCallback(this);
+      }
+      return;
+    }
+  }
+
+  // Triangles order
+  const auto positions = getVerticesData(VertexBuffer::PositionKind);
+  for (const auto& subMesh : subMeshes) {
+    IndicesOptimizer::OptimizeVertexCache(indices, subMesh->indexStart, subMesh->indexCount,
+                                          options.cacheSize);
+    if (options.optimizeOverdraw) {
+      IndicesOptimizer::OptimizeOverdraw(indices, subMesh->indexStart, subMesh->indexCount,
+                                         positions, options.cacheSize,
+                                         options.overdrawThreshold);
+    }
+  }
+
+  // Vertices order, only when each vertex belongs to a single submesh
+  const auto totalVertices = getTotalVertices();
+  auto optimizeVertexFetch = options.optimizeVertexFetch && !morphTargetManager();
+  std::vector<uint8_t> owned(totalVertices, 0);
+  for (const auto& subMesh : subMeshes) {
+    const auto verticesEnd = subMesh->verticesStart + subMesh->verticesCount;
+    const auto indexEnd    = std::min(subMesh->indexStart + subMesh->indexCount, indices.size());
+    optimizeVertexFetch    = optimizeVertexFetch && verticesEnd <= totalVertices;
+    for (auto vertex = subMesh->verticesStart; optimizeVertexFetch && vertex < verticesEnd;
+         ++vertex) {
+      optimizeVertexFetch = !owned[vertex];
+      owned[vertex]       = 1;
+    }
+    for (auto index = subMesh->indexStart; optimizeVertexFetch && index < indexEnd; ++index) {
+      optimizeVertexFetch
+        = indices[index] >= subMesh->verticesStart && indices[index] < verticesEnd;
+    }
+  }
+
+  if (optimizeVertexFetch) {
+    // order[newVertex] = oldVertex, the vertices outside of the submeshes are unchanged
+    Uint32Array order(totalVertices);
+    std::iota(order.begin(), order.end(), 0u);
+    for (const auto& subMesh : subMeshes) {
+      const auto subMeshOrder = IndicesOptimizer::OptimizeVertexFetch(
+        indices, subMesh->indexStart, subMesh->indexCount, subMesh->verticesStart,
+        subMesh->verticesCount);
+      std::copy(subMeshOrder.begin(), subMeshOrder.end(),
+                order.begin() + static_cast<std::ptrdiff_t>(subMesh->verticesStart));
+    }
+    Uint32Array newVertices(totalVertices);
+    for (size_t vertex = 0; vertex < totalVertices; ++vertex) {
+      newVertices[order[vertex]] = static_cast<uint32_t>(vertex);
+    }
+    for (auto& index : indices) {
+      index = newVertices[index];
+    }
+
+    for (const auto& kind : getVerticesDataKinds()) {
+      const auto vertexBuffer = getVertexBuffer(kind);
+      const auto data         = getVerticesData(kind);
+      const auto size         = vertexBuffer ? vertexBuffer->getSize() : 0;
+      if (size == 0 || data.size() < totalVertices * size) {
+        continue;
+      }
+      Float32Array newData(data.size());
+      for (size_t vertex = 0; vertex < totalVertices; ++vertex) {
+        std::copy_n(data.begin() + static_cast<std::ptrdiff_t>(order[vertex] * size), size,
+                    newData.begin() + static_cast<std::ptrdiff_t>(vertex * size));
+      }
+      setVerticesData(kind, newData, isVertexBufferUpdatable(kind), size);
+    }
+  }
+
+  // The submeshes of the meshes sharing the geometry are recreated when the indices change
+  std::vector<std::pair<Mesh*, std::vector<SubMeshPtr>>> meshesSubMeshes;
+  for (auto* mesh : _geometry->meshes()) {
+    meshesSubMeshes.emplace_back(mesh, mesh->subMeshes);
+  }
+  updateIndices(indices);
+  for (auto& [mesh, meshSubMeshes] : meshesSubMeshes) {
+    mesh->subMeshes = std::move(meshSubMeshes);
+    mesh->synchronizeInstances();
+  }
+
+  if (successCallback) {
+    successCallback(this);
+  }
 }
 
 void Mesh::minimizeVertices()
 {
-  auto _pdata = getVerticesData(VertexBuffer::PositionKind);
-  auto _ndata = getVerticesData(VertexBuffer::NormalKind);
-  auto _idata = getIndices();
+  const auto _pdata = getVerticesData(VertexBuffer::PositionKind);
+  const auto _idata = getIndices();
 
   Float32Array _newPdata; // new positions array
   IndicesArray _newIdata; // new indices array
 
-  auto _mapPtr = 0;                          // new index;
-  std::vector<std::string> _uniquePositions; // unique vertex positions
-  for (size_t _i = 0; _i < _idata.size(); _i += 3) {
+  // Weld the vertices sharing the same position
+  VertexWelderOptions _options;
+  _options.epsilon    = 1e-6f;
+  const auto _remap   = VertexWelder::Weld(_pdata, _options);
+  const auto _noIndex = std::numeric_limits<uint32_t>::max();
+  Uint32Array _newIndices(_remap.size(), _noIndex);
+  auto _mapPtr = 0u; // new index
+  for (size_t _i = 0; _i + 2 < _idata.size(); _i += 3) {
     // facet vertex indices
-    IndicesArray _facet{_idata[_i], _idata[_i + 1], _idata[_i + 2]};
-    // lists facet vertex positions (x,y,z) as string "xyz""
-    std::vector<std::string> _pstring(3);
-    for (unsigned int _j = 0; _j < 3; ++_j) { //
-      _pstring[_j] = "";
-      for (size_t _k = 0; _k < 3; ++_k) {
-        // small values make 0
-        if (std::abs(_pdata[3 * _facet[_j] + _k]) < 0.0001f) {
-          _pdata[3 * _facet[_j] + _k] = 0;
-        }
-        _pstring[_j] += std::to_string(_pdata[3 * _facet[_j] + _k]) + "|";
-      }
-      _pstring[_j] = _pstring[_j].substr(0, _pstring[_j].size() - 1);
-    }
-    // check facet vertices to see that none are repeated
+    const std::array<uint32_t, 3> _facet{_remap[_idata[_i]], _remap[_idata[_i + 1]],
+                                         _remap[_idata[_i + 2]]};
     // do not process any facet that has a repeated vertex, ie is a line
-    if (!(_pstring[0] == _pstring[1] || _pstring[0] == _pstring[2] || _pstring[1] == _pstring[2])) {
-      // for each facet position check if already listed in uniquePositions
-      // if not listed add to uniquePositions and set index pointer
-      // if listed use its index in uniquePositions and new index pointer
-      for (unsigned int _j = 0; _j < 3; ++_j) {
-        int _ptr = stl_util::index_of(_uniquePositions, _pstring[_j]);
-        if (_ptr < 0) {
-          _uniquePositions.emplace_back(_pstring[_j]);
-          _ptr = _mapPtr++;
-          // not listed so add individual x, y, z coordinates to new positions
-          // array newPdata and add matching normal data to new normals array
-          // newNdata
-          for (unsigned int _k = 0; _k < 3; ++_k) {
-            _newPdata.emplace_back(_pdata[3 * _facet[_j] + _k]);
-          }
+    if (_facet[0] == _facet[1] || _facet[0] == _facet[2] || _facet[1] == _facet[2]) {
+      continue;
+    }
+    for (const auto _vertex : _facet) {
+      if (_newIndices[_vertex] == _noIndex) {
+        _newIndices[_vertex] = _mapPtr++;
+        // not listed so add individual x, y, z coordinates to new positions
+        // array newPdata
+        for (unsigned int _k = 0; _k < 3; ++_k) {
+          _newPdata.emplace_back(_pdata[3 * _vertex + _k]);
         }
-        // add new index pointer to new indices array newIdata
-        _newIdata.emplace_back(_ptr);
       }
+      // add new index pointer to new indices array newIdata
+      _newIdata.emplace_back(_newIndices[_vertex]);
     }
   }
 
@@ -32,8 +32,15 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
-    scene->simplificationQueue()->executeNext();
+  const auto& simplificationQueue = scene->simplificationQueue();
+  if (!simplificationQueue) {
+    return;
+  }
+  if (simplificationQueue->running) {
+    simplificationQueue->publishSimplifiedMeshes();
+  }
+  else {
+    simplificationQueue->executeNext();
   }
 }
 
@@ -2,13 +2,15 @@
 
 namespace BABYLON {
 
-DecimationTriangle::DecimationTriangle(const std::vector<DecimationVertex>& iVertices)
+DecimationTriangle::DecimationTriangle(const std::array<DecimationVertex*, 3>& iVertices)
     : vertices{iVertices}
 {
-  deleted       = false;
-  isDirty       = false;
-  deletePending = false;
-  borderFactor  = 0;
+  deleted        = false;
+  isDirty        = false;
+  deletePending  = false;
+  borderFactor   = 0;
+  originalOffset = 0;
+  error.fill(0.0);
 }
 
 DecimationTriangle::~DecimationTriangle() = default;
@@ -0,0 +1,502 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
+#include <babylon/meshes/simplification/reference.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/meshes/vertex_welder.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Decimation of a submesh: the vertices (the vertices of the submesh sharing the same
+ * position when the mesh is optimized), the triangles and the references from the vertices to
+ * their triangles.
+ */
+struct Decimation {
+
+  using SubMeshRange = QuadraticErrorSimplification::SubMeshRange;
+
+  void initWithMesh(const Float32Array& positions, const IndicesArray& indices,
+                    const SubMeshRange& subMesh, bool optimizeMesh, float weldingEpsilon)
+  {
+    // Vertices
+    const auto verticesStart = std::min(static_cast<size_t>(subMesh.verticesStart),
+                                        positions.size() / 3);
+    const auto verticesCount
+      = std::min(subMesh.verticesCount, positions.size() / 3 - verticesStart);
+    const Float32Array subMeshPositions(
+      positions.begin() + static_cast<std::ptrdiff_t>(verticesStart * 3),
+      positions.begin() + static_cast<std::ptrdiff_t>((verticesStart + verticesCount) * 3));
+    Uint32Array remap;
+    if (optimizeMesh) {
+      VertexWelderOptions options;
+      options.epsilon  = weldingEpsilon;
+      options.parallel = false;
+      remap            = VertexWelder::Weld(subMeshPositions, options);
+    }
+
+    std::vector<size_t> vertexReferences(verticesCount);
+    vertices.reserve(verticesCount);
+    for (size_t i = 0; i < verticesCount; ++i) {
+      if (remap.empty() || remap[i] == i) {
+        vertexReferences[i] = vertices.size();
+        const auto offset = static_cast<unsigned int>(i * 3);
+        vertices.emplace_back(Vector3::FromArray(subMeshPositions, offset),
+                              static_cast<int>(vertices.size()));
+      }
+      else {
+        vertexReferences[i] = vertexReferences[remap[i]];
+      }
+      vertices[vertexReferences[i]].originalOffsets.emplace_back(
+        static_cast<uint32_t>(verticesStart + i));
+    }
+
+    // Triangles, the ones degenerated by the welding are dropped
+    const auto indexEnd = std::min(static_cast<size_t>(subMesh.indexStart) + subMesh.indexCount,
+                                   indices.size());
+    for (size_t pos = subMesh.indexStart; pos + 2 < indexEnd; pos += 3) {
+      std::array<DecimationVertex*, 3> triangleVertices{};
+      for (size_t k = 0; k < 3; ++k) {
+        const auto index = static_cast<size_t>(indices[pos + k]);
+        if (index < verticesStart || index >= verticesStart + verticesCount) {
+          triangleVertices[k] = nullptr;
+          break;
+        }
+        triangleVertices[k] = &vertices[vertexReferences[index - verticesStart]];
+      }
+      if (!triangleVertices[0] || !triangleVertices[1] || !triangleVertices[2]
+          || triangleVertices[0] == triangleVertices[1]
+          || triangleVertices[0] == triangleVertices[2]
+          || triangleVertices[1] == triangleVertices[2]) {
+        continue;
+      }
+      DecimationTriangle triangle(triangleVertices);
+      triangle.originalOffset = pos;
+      triangles.emplace_back(triangle);
+    }
+  }
+
+  void init()
+  {
+    for (auto& t : triangles) {
+      t.normal = Vector3::Cross(t.vertices[1]->position.subtract(t.vertices[0]->position),
+                                t.vertices[2]->position.subtract(t.vertices[0]->position));
+      t.normal.normalize();
+      const auto data = QuadraticMatrix::DataFromNumbers(
+        t.normal.x, t.normal.y, t.normal.z,
+        -static_cast<double>(Vector3::Dot(t.normal, t.vertices[0]->position)));
+      for (auto* vertex : t.vertices) {
+        vertex->q.addArrayInPlace(data);
+      }
+    }
+
+    // The borders are identified before the errors, so that the edges of the borders get their
+    // actual error
+    updateMesh(true);
+    for (auto& t : triangles) {
+      for (size_t j = 0; j < 3; ++j) {
+        t.error[j] = calculateError(*t.vertices[j], *t.vertices[(j + 1) % 3]);
+      }
+      t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+    }
+  }
+
+  void run(float quality, size_t decimationIterations, float aggressiveness)
+  {
+    const auto triangleCount = triangles.size();
+    const auto targetCount
+      = static_cast<size_t>(static_cast<float>(triangleCount) * std::clamp(quality, 0.f, 1.f));
+    size_t deletedTriangles = 0;
+
+    std::vector<bool> deleted0, deleted1;
+    std::vector<size_t> delTr;
+    for (size_t iteration = 0; iteration < decimationIterations; ++iteration) {
+      if (triangleCount - deletedTriangles <= targetCount) {
+        break;
+      }
+      if (iteration > 0 && iteration % 5 == 0) {
+        updateMesh(false);
+      }
+      for (auto& t : triangles) {
+        t.isDirty = false;
+      }
+
+      // All the triangles whose error is below the threshold are collapsed
+      const auto threshold
+        = 0.000000001 * std::pow(static_cast<double>(iteration + 3), aggressiveness);
+      const auto count = triangles.size();
+      for (size_t i = 0; i < count && triangleCount - deletedTriangles > targetCount; ++i) {
+        auto& t = triangles[(count / 2 + i) % count];
+        if (t.error[3] > threshold || t.deleted || t.isDirty) {
+          continue;
+        }
+        for (size_t j = 0; j < 3; ++j) {
+          if (t.error[j] >= threshold) {
+            continue;
+          }
+          auto* v0 = t.vertices[j];
+          auto* v1 = t.vertices[(j + 1) % 3];
+          if (v0->isBorder || v1->isBorder) {
+            continue;
+          }
+
+          Vector3 p;
+          calculateError(*v0, *v1, &p);
+
+          deleted0.assign(static_cast<size_t>(v0->triangleCount), false);
+          deleted1.assign(static_cast<size_t>(v1->triangleCount), false);
+          delTr.clear();
+          if (isFlipped(*v0, *v1, p, deleted0, delTr) || isFlipped(*v1, *v0, p, deleted1, delTr)) {
+            continue;
+          }
+          if (std::find(deleted0.begin(), deleted0.end(), true) == deleted0.end()
+              || std::find(deleted1.begin(), deleted1.end(), true) == deleted1.end()) {
+            continue;
+          }
+          std::sort(delTr.begin(), delTr.end());
+          delTr.erase(std::unique(delTr.begin(), delTr.end()), delTr.end());
+          if (delTr.size() % 2 != 0) {
+            continue;
+          }
+          for (const auto deletedTriangle : delTr) {
+            triangles[deletedTriangle].deletePending = true;
+          }
+
+          // Collapses v1 into v0
+          v0->q = v1->q.add(v0->q);
+          v0->updatePosition(p);
+          const auto tStart = references.size();
+          deletedTriangles  = updateTriangles(*v0, *v0, deleted0, deletedTriangles);
+          deletedTriangles  = updateTriangles(*v0, *v1, deleted1, deletedTriangles);
+          const auto tCount = references.size() - tStart;
+          if (tCount <= static_cast<size_t>(v0->triangleCount)) {
+            std::copy(references.begin() + static_cast<std::ptrdiff_t>(tStart), references.end(),
+                      references.begin() + v0->triangleStart);
+            references.resize(tStart, Reference(0, 0));
+          }
+          else {
+            v0->triangleStart = static_cast<int>(tStart);
+          }
+          v0->triangleCount = static_cast<int>(tCount);
+          break;
+        }
+      }
+    }
+  }
+
+  void reconstruct(const Float32Array& normals, const Float32Array& uvs,
+                   const Float32Array& colors, const IndicesArray& originalIndices,
+                   VertexData& vertexData, SubMeshRange& subMesh)
+  {
+    subMesh.verticesStart = static_cast<unsigned int>(vertexData.positions.size() / 3);
+    subMesh.indexStart    = static_cast<unsigned int>(vertexData.indices.size());
+
+    for (auto& vertex : vertices) {
+      vertex.triangleCount = 0;
+    }
+    for (const auto& t : triangles) {
+      if (!t.deleted) {
+        for (auto* vertex : t.vertices) {
+          vertex->triangleCount = 1;
+        }
+      }
+    }
+
+    // Each vertex is duplicated for the original vertices sharing its position, to keep their
+    // attributes
+    const auto copyAttribute = [](const Float32Array& source, size_t stride, size_t offset,
+                                  Float32Array& destination) {
+      if (source.size() >= (offset + 1) * stride) {
+        destination.insert(destination.end(),
+                           source.begin() + static_cast<std::ptrdiff_t>(offset * stride),
+                           source.begin() + static_cast<std::ptrdiff_t>((offset + 1) * stride));
+      }
+    };
+    size_t vertexCount = 0;
+    for (auto& vertex : vertices) {
+      if (!vertex.triangleCount) {
+        continue;
+      }
+      vertex.id = static_cast<int>(subMesh.verticesStart + vertexCount);
+      for (const auto originalOffset : vertex.originalOffsets) {
+        vertexData.positions.insert(vertexData.positions.end(),
+                                    {vertex.position.x, vertex.position.y, vertex.position.z});
+        copyAttribute(normals, 3, originalOffset, vertexData.normals);
+        copyAttribute(uvs, 2, originalOffset, vertexData.uvs);
+        copyAttribute(colors, 4, originalOffset, vertexData.colors);
+        ++vertexCount;
+      }
+    }
+
+    for (const auto& t : triangles) {
+      if (t.deleted) {
+        continue;
+      }
+      for (size_t k = 0; k < 3; ++k) {
+        const auto& originalOffsets = t.vertices[k]->originalOffsets;
+        const auto it = std::find(originalOffsets.begin(), originalOffsets.end(),
+                                  originalIndices[t.originalOffset + k]);
+        const auto offset = it != originalOffsets.end() ? it - originalOffsets.begin() : 0;
+        vertexData.indices.emplace_back(static_cast<uint32_t>(t.vertices[k]->id + offset));
+      }
+    }
+
+    subMesh.verticesCount = vertexCount;
+    subMesh.indexCount    = vertexData.indices.size() - subMesh.indexStart;
+  }
+
+  static double vertexError(const QuadraticMatrix& q, const Vector3& point)
+  {
+    const auto x = static_cast<double>(point.x), y = static_cast<double>(point.y),
+               z = static_cast<double>(point.z);
+    return q.data[0] * x * x + 2 * q.data[1] * x * y + 2 * q.data[2] * x * z + 2 * q.data[3] * x
+           + q.data[4] * y * y + 2 * q.data[5] * y * z + 2 * q.data[6] * y + q.data[7] * z * z
+           + 2 * q.data[8] * z + q.data[9];
+  }
+
+  static double calculateError(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                               Vector3* pointResult = nullptr)
+  {
+    const auto q      = vertex1.q.add(vertex2.q);
+    const auto border = vertex1.isBorder && vertex2.isBorder;
+    const auto qDet   = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+    if (qDet != 0.0 && !border) {
+      const Vector3 point(static_cast<float>(-1.0 / qDet * q.det(1, 2, 3, 4, 5, 6, 5, 7, 8)),
+                          static_cast<float>(1.0 / qDet * q.det(0, 2, 3, 1, 5, 6, 2, 7, 8)),
+                          static_cast<float>(-1.0 / qDet * q.det(0, 1, 3, 1, 4, 6, 2, 5, 8)));
+      if (pointResult) {
+        pointResult->copyFrom(point);
+      }
+      return vertexError(q, point);
+    }
+
+    const auto p3     = vertex1.position.add(vertex2.position).scaleInPlace(0.5f);
+    const auto error1 = vertexError(q, vertex1.position);
+    const auto error2 = vertexError(q, vertex2.position);
+    const auto error3 = vertexError(q, p3);
+    const auto error  = std::min({error1, error2, error3});
+    if (pointResult) {
+      pointResult->copyFrom(error == error1 ? vertex1.position :
+                            error == error2 ? vertex2.position :
+                                              p3);
+    }
+    return error;
+  }
+
+  bool isFlipped(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                 const Vector3& point, std::vector<bool>& deletedArray, std::vector<size_t>& delTr)
+  {
+    for (size_t i = 0; i < static_cast<size_t>(vertex1.triangleCount); ++i) {
+      const auto& reference = references[static_cast<size_t>(vertex1.triangleStart) + i];
+      const auto& t         = triangles[static_cast<size_t>(reference.triangleId)];
+      if (t.deleted) {
+        continue;
+      }
+
+      const auto s   = static_cast<size_t>(reference.vertexId);
+      const auto* v1 = t.vertices[(s + 1) % 3];
+      const auto* v2 = t.vertices[(s + 2) % 3];
+      if (v1 == &vertex2 || v2 == &vertex2) {
+        deletedArray[i] = true;
+        delTr.emplace_back(static_cast<size_t>(reference.triangleId));
+        continue;
+      }
+
+      auto d1 = v1->position.subtract(point);
+      d1.normalize();
+      auto d2 = v2->position.subtract(point);
+      d2.normalize();
+      if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+        return true;
+      }
+      auto normal = Vector3::Cross(d1, d2);
+      normal.normalize();
+      deletedArray[i] = false;
+      if (Vector3::Dot(normal, t.normal) < 0.2f) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t updateTriangles(DecimationVertex& origVertex, const DecimationVertex& vertex,
+                         const std::vector<bool>& deletedArray, size_t deletedTriangles)
+  {
+    auto newDeleted = deletedTriangles;
+    for (size_t i = 0; i < static_cast<size_t>(vertex.triangleCount); ++i) {
+      // Copied, as the references may be reallocated
+      const auto reference = references[static_cast<size_t>(vertex.triangleStart) + i];
+      auto& t              = triangles[static_cast<size_t>(reference.triangleId)];
+      if (t.deleted) {
+        continue;
+      }
+      if (deletedArray[i] && t.deletePending) {
+        t.deleted = true;
+        ++newDeleted;
+        continue;
+      }
+      t.vertices[static_cast<size_t>(reference.vertexId)] = &origVertex;
+      t.isDirty                                         = true;
+      for (size_t j = 0; j < 3; ++j) {
+        t.error[j] = calculateError(*t.vertices[j], *t.vertices[(j + 1) % 3])
+                     + static_cast<double>(t.borderFactor) / 2.0;
+      }
+      t.error[3] = std::min({t.error[0], t.error[1], t.error[2]});
+      references.emplace_back(reference);
+    }
+    return newDeleted;
+  }
+
+  void identifyBorder()
+  {
+    // A vertex is a border if one of the edges it belongs to is used by a single triangle, i.e. if
+    // one of its neighbours is found only once in its triangles
+    std::vector<int> vCount, vId;
+    for (const auto& v : vertices) {
+      vCount.clear();
+      vId.clear();
+      for (size_t j = 0; j < static_cast<size_t>(v.triangleCount); ++j) {
+        const auto& triangle
+          = triangles[static_cast<size_t>(references[static_cast<size_t>(v.triangleStart) + j]
+                                            .triangleId)];
+        for (const auto* vv : triangle.vertices) {
+          const auto it = std::find(vId.begin(), vId.end(), vv->id);
+          if (it == vId.end()) {
+            vCount.emplace_back(1);
+            vId.emplace_back(vv->id);
+          }
+          else {
+            ++vCount[static_cast<size_t>(it - vId.begin())];
+          }
+        }
+      }
+      for (size_t j = 0; j < vCount.size(); ++j) {
+        vertices[static_cast<size_t>(vId[j])].isBorder = vCount[j] == 1;
+      }
+    }
+  }
+
+  void updateMesh(bool identifyBorders)
+  {
+    if (!identifyBorders) {
+      triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                     [](const DecimationTriangle& t) { return t.deleted; }),
+                      triangles.end());
+    }
+
+    for (auto& vertex : vertices) {
+      vertex.triangleCount = 0;
+      vertex.triangleStart = 0;
+    }
+    for (const auto& t : triangles) {
+      for (auto* vertex : t.vertices) {
+        ++vertex->triangleCount;
+      }
+    }
+    int tStart = 0;
+    for (auto& vertex : vertices) {
+      vertex.triangleStart = tStart;
+      tStart += vertex.triangleCount;
+      vertex.triangleCount = 0;
+    }
+    references.assign(triangles.size() * 3, Reference(0, 0));
+    for (size_t i = 0; i < triangles.size(); ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        auto* vertex = triangles[i].vertices[j];
+        references[static_cast<size_t>(vertex->triangleStart + vertex->triangleCount)]
+          = Reference(static_cast<int>(j), static_cast<int>(i));
+        ++vertex->triangleCount;
+      }
+    }
+
+    if (identifyBorders) {
+      identifyBorder();
+    }
+  }
+
+  std::vector<DecimationVertex> vertices;
+  std::vector<DecimationTriangle> triangles;
+  std::vector<Reference> references;
+
+}; // end of struct Decimation
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : decimationIterations{100}, aggressiveness{7.f}, weldingEpsilon{0.0001f}, _mesh{mesh}
+{
+  _positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  _normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
+  _uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
+  _colors    = mesh->getVerticesData(VertexBuffer::ColorKind);
+  _indices   = mesh->getIndices();
+  for (const auto& subMesh : mesh->subMeshes) {
+    _subMeshes.emplace_back(SubMeshRange{subMesh->materialIndex, subMesh->verticesStart,
+                                         subMesh->verticesCount, subMesh->indexStart,
+                                         subMesh->indexCount});
+  }
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+std::function<MeshPtr()>
+QuadraticErrorSimplification::simplify(const ISimplificationSettings& settings)
+{
+  auto subMeshes  = std::make_shared<std::vector<SubMeshRange>>();
+  auto vertexData = std::shared_ptr<VertexData>(decimate(settings, *subMeshes));
+
+  return [mesh = _mesh, vertexData, subMeshes]() -> MeshPtr {
+    auto reconstructedMesh = Mesh::New(mesh->name + "Decimated", mesh->getScene(), mesh->parent());
+    reconstructedMesh->material         = mesh->material();
+    reconstructedMesh->isVisible        = false;
+    reconstructedMesh->renderingGroupId = mesh->renderingGroupId();
+    vertexData->applyToMesh(*reconstructedMesh);
+    if (subMeshes->size() > 1) {
+      reconstructedMesh->subMeshes.clear();
+      for (const auto& subMesh : *subMeshes) {
+        SubMesh::AddToMesh(subMesh.materialIndex, subMesh.verticesStart, subMesh.verticesCount,
+                           subMesh.indexStart, subMesh.indexCount, reconstructedMesh);
+      }
+    }
+    return reconstructedMesh;
+  };
+}
+
+std::unique_ptr<VertexData>
+QuadraticErrorSimplification::decimate(const ISimplificationSettings& settings,
+                                       std::vector<SubMeshRange>& subMeshes) const
+{
+  auto vertexData = std::make_unique<VertexData>();
+  subMeshes.clear();
+
+  // Iterating through the submeshes array, one after the other
+  for (const auto& subMesh : _subMeshes) {
+    Decimation decimation;
+    decimation.initWithMesh(_positions, _indices, subMesh, settings.optimizeMesh, weldingEpsilon);
+    decimation.init();
+    decimation.run(settings.quality, decimationIterations, aggressiveness);
+
+    auto range = subMesh;
+    decimation.reconstruct(_normals, _uvs, _colors, _indices, *vertexData, range);
+    subMeshes.emplace_back(range);
+  }
+
+  if (_normals.empty()) {
+    VertexData::ComputeNormals(vertexData->positions, vertexData->indices, vertexData->normals);
+  }
+
+  return vertexData;
+}
+
+} // end of namespace BABYLON
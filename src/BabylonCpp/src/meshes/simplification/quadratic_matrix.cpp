@@ -5,11 +5,11 @@ namespace BABYLON {
 QuadraticMatrix::QuadraticMatrix()
 {
   for (unsigned int i = 0; i < 10; ++i) {
-    data[i] = 0.f;
+    data[i] = 0.0;
   }
 }
 
-QuadraticMatrix::QuadraticMatrix(const std::array<float, 10>& _data)
+QuadraticMatrix::QuadraticMatrix(const std::array<double, 10>& _data)
 {
   for (unsigned int i = 0; i < 10; ++i) {
     data[i] = _data[i];
@@ -23,9 +23,9 @@ QuadraticMatrix& QuadraticMatrix::operator=(QuadraticMatrix&& other) = default;
 
 QuadraticMatrix::~QuadraticMatrix() = default;
 
-float QuadraticMatrix::det(unsigned int a11, unsigned int a12, int unsigned a13, unsigned int a21,
-                           unsigned int a22, unsigned int a23, unsigned int a31, unsigned int a32,
-                           unsigned int a33)
+double QuadraticMatrix::det(unsigned int a11, unsigned int a12, unsigned int a13,
+                            unsigned int a21, unsigned int a22, unsigned int a23,
+                            unsigned int a31, unsigned int a32, unsigned int a33) const
 {
   return data[a11] * data[a22] * data[a33]   //
          + data[a13] * data[a21] * data[a32] //
@@ -42,14 +42,14 @@ void QuadraticMatrix::addInPlace(const QuadraticMatrix& matrix)
   }
 }
 
-void QuadraticMatrix::addArrayInPlace(const std::array<float, 10>& _data)
+void QuadraticMatrix::addArrayInPlace(const std::array<double, 10>& _data)
 {
   for (unsigned int i = 0; i < 10; ++i) {
     data[i] += _data[i];
   }
 }
 
-QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
+QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix) const
 {
   QuadraticMatrix m;
   for (unsigned int i = 0; i < 10; ++i) {
@@ -58,12 +58,12 @@ QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
   return m;
 }
 
-QuadraticMatrix QuadraticMatrix::FromData(float a, float b, float c, float d)
+QuadraticMatrix QuadraticMatrix::FromData(double a, double b, double c, double d)
 {
   return QuadraticMatrix(QuadraticMatrix::DataFromNumbers(a, b, c, d));
 }
 
-std::array<float, 10> QuadraticMatrix::DataFromNumbers(float a, float b, float c, float d)
+std::array<double, 10> QuadraticMatrix::DataFromNumbers(double a, double b, double c, double d)
 {
   return {{a * a, a * b, a * c, a * d, //
            b * b, b * c, b * d,        //
@@ -1,10 +1,15 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
 
-SimplificationQueue::SimplificationQueue() : running{false}
+SimplificationQueue::SimplificationQueue()
+    : running{false}, _publishedSettings{0}, _runningTaskFailed{false}
 {
 }
 
@@ -18,8 +23,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running         = true;
+    const auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +33,95 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  _runningTask       = task;
+  _publishedSettings = 0;
+  _runningTaskFailed = false;
+  _simplifications.clear();
+  const auto mesh = task.mesh.lock();
+  if (!mesh || mesh->isDisposed() || task.settings.empty()) {
+    publishSimplifiedMeshes();
+    return;
+  }
+
+  // The simplifier copies the data of the mesh on the render thread, the simplifications only use
+  // this copy
+  auto simplifier  = getSimplifier(task, mesh.get());
+  auto& threadPool = ThreadPool::Default();
+  if (task.parallelProcessing) {
+    for (const auto& setting : task.settings) {
+      _simplifications.emplace_back(threadPool.enqueue([simplifier, setting]() {
+        return std::vector<std::function<MeshPtr()>>{simplifier->simplify(setting)};
+      }));
+    }
+  }
+  else {
+    _simplifications.emplace_back(threadPool.enqueue([simplifier, settings = task.settings]() {
+      std::vector<std::function<MeshPtr()>> createMeshes;
+      for (const auto& setting : settings) {
+        createMeshes.emplace_back(simplifier->simplify(setting));
+      }
+      return createMeshes;
+    }));
+  }
+}
+
+void SimplificationQueue::publishSimplifiedMeshes()
+{
+  if (!_runningTask) {
+    return;
+  }
+
+  // The meshes are added in the order of the settings, unless the mesh was disposed in the
+  // meantime
+  const auto& task = *_runningTask;
+  while (!_simplifications.empty()) {
+    auto& simplification = _simplifications.front();
+    if (simplification.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      return;
+    }
+    std::vector<std::function<MeshPtr()>> createMeshes;
+    try {
+      createMeshes = simplification.get();
+    }
+    catch (const std::exception& e) {
+      BABYLON_LOG_ERROR("SimplificationQueue", "Simplification failed: %s", e.what())
+      _runningTaskFailed = true;
+    }
+    _simplifications.pop_front();
+
+    const auto mesh = task.mesh.lock();
+    if (!mesh || mesh->isDisposed()) {
+      _runningTaskFailed = true;
+    }
+    if (_runningTaskFailed) {
+      continue;
+    }
+    for (const auto& createMesh : createMeshes) {
+      const auto& setting = task.settings[_publishedSettings++];
+      auto newMesh        = createMesh();
+      mesh->addLODLevel(setting.distance, newMesh);
+      newMesh->isVisible = true;
+    }
+  }
+
+  const auto mesh            = task.mesh.lock();
+  const auto successCallback = task.successCallback;
+  _runningTask.reset();
+  if (!_runningTaskFailed && mesh && !mesh->isDisposed() && successCallback) {
+    successCallback();
+  }
+  executeNext();
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::shared_ptr<ISimplifier> SimplificationQueue::getSimplifier(const ISimplificationTask& task,
+                                                               Mesh* mesh)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_shared<QuadraticErrorSimplification>(mesh);
   }
 }
 
@@ -4,6 +4,7 @@
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -37,7 +38,6 @@ SubMesh::SubMesh(unsigned int iMaterialIndex, unsigned int iVerticesStart, size_
     , indexCount{iIndexCount}
     , createBoundingBox{iCreateBoundingBox}
     , _linesIndexCount{0}
-    , _lastColliderTransformMatrix{nullptr}
     , _renderId{0}
     , _alphaIndex{0}
     , _distanceToCamera{0.f}
@@ -191,8 +191,6 @@ bool SubMesh::_IsMultiMaterial(const Material& material) const
 // Methods
 SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
 {
-  _lastColliderWorldVertices.clear();
-
   if (isGlobal() || !_renderingMesh || !_renderingMesh->geometry()) {
     return *this;
   }
@@ -345,6 +343,13 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint3
     return _intersectLines(ray, positions, indices, intersectionThreshold, fastCheck);
   }
   else {
+    // Large triangle lists are tested through the picking hierarchy of the geometry
+    if (step == 3 && _mesh->getScene()->bvhAcceleratedPicking) {
+      if (const auto triangleBVH = _getTriangleBVH(positions, indices)) {
+        return triangleBVH->intersects(ray, positions, fastCheck, trianglePredicate);
+      }
+    }
+
     // Check if mesh is unindexed
     if (indices.empty() && _mesh->_unIndexed) {
       return _intersectUnIndexedTriangles(ray, positions, indices, fastCheck, trianglePredicate);
@@ -355,6 +360,29 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint3
   }
 }
 
+TriangleBVHPtr SubMesh::_getTriangleBVH(const std::vector<Vector3>& positions,
+                                        const IndicesArray& indices)
+{
+  if (indexCount / 3 < TriangleBVH::MinTriangleCount || !_renderingMesh) {
+    return nullptr;
+  }
+
+  // The hierarchy is built from the points array and the indices of the geometry, other data are
+  // tested linearly
+  const auto& geometry = _renderingMesh->geometry();
+  if (!geometry || &positions != &geometry->_positions) {
+    return nullptr;
+  }
+
+  const auto unIndexed = indices.empty() && _mesh->_unIndexed;
+  if (unIndexed ? !geometry->_indices.empty() :
+                  (indices.empty() || &indices != &geometry->_indices)) {
+    return nullptr;
+  }
+
+  return geometry->_getTriangleBVH(indexStart, indexCount);
+}
+
 std::optional<IntersectionInfo>
 SubMesh::_intersectLines(Ray& ray, const std::vector<Vector3>& positions,
                          const IndicesArray& indices, float intersectionThreshold, bool fastCheck)
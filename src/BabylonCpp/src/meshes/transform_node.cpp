@@ -1126,6 +1126,11 @@ TransformNode& TransformNode::unregisterAfterWorldMatrixUpdate(
   return *this;
 }
 
+bool TransformNode::_hasAfterWorldMatrixUpdateObservers() const
+{
+  return onAfterWorldMatrixUpdateObservable.hasObservers();
+}
+
 Vector3 TransformNode::getPositionInCameraSpace(const CameraPtr& camera)
 {
   if (!camera) {
@@ -1,5 +1,7 @@
 ﻿#include <babylon/meshes/vertex_buffer.h>
 
+#include <cstring>
+
 #include <babylon/core/data_view.h>
 #include <babylon/engines/thin_engine.h>
 #include <babylon/meshes/buffer.h>
@@ -7,6 +9,48 @@
 
 namespace BABYLON {
 
+namespace {
+
+template <typename T>
+float ReadComponent(const uint8_t* bytes, size_t byteOffset)
+{
+  T value;
+  std::memcpy(&value, bytes + byteOffset, sizeof(T));
+  return static_cast<float>(value);
+}
+
+float ReadFloatValue(const uint8_t* bytes, unsigned int type, size_t byteOffset, bool normalized)
+{
+  switch (type) {
+    case VertexBuffer::BYTE: {
+      const auto value = ReadComponent<int8_t>(bytes, byteOffset);
+      return normalized ? std::max(value / 127.f, -1.f) : value;
+    }
+    case VertexBuffer::UNSIGNED_BYTE: {
+      const auto value = ReadComponent<uint8_t>(bytes, byteOffset);
+      return normalized ? value / 255.f : value;
+    }
+    case VertexBuffer::SHORT: {
+      const auto value = ReadComponent<int16_t>(bytes, byteOffset);
+      return normalized ? std::max(value / 32767.f, -1.f) : value;
+    }
+    case VertexBuffer::UNSIGNED_SHORT: {
+      const auto value = ReadComponent<uint16_t>(bytes, byteOffset);
+      return normalized ? value / 65535.f : value;
+    }
+    case VertexBuffer::INT:
+      return ReadComponent<int32_t>(bytes, byteOffset);
+    case VertexBuffer::UNSIGNED_INT:
+      return ReadComponent<uint32_t>(bytes, byteOffset);
+    case VertexBuffer::FLOAT:
+      return ReadComponent<float>(bytes, byteOffset);
+    default:
+      throw std::runtime_error("Invalid component type " + std::to_string(type));
+  }
+}
+
+} // end of anonymous namespace
+
 size_t VertexBuffer::_Counter = 0;
 
 VertexBuffer::VertexBuffer(ThinEngine* engine, const std::variant<Float32Array, BufferPtr>& data,
@@ -129,7 +173,7 @@ Float32Array VertexBuffer::getFloatData(size_t totalVertices, const std::optiona
   const auto tightlyPackedByteStride = getSize() * VertexBuffer::GetTypeByteLength(type);
   const auto count                   = totalVertices * getSize();
 
-  if (type != VertexBuffer::FLOAT || byteStride != tightlyPackedByteStride) {
+  if (type != VertexBuffer::FLOAT || byteStride != tightlyPackedByteStride || byteOffset != 0) {
     Float32Array copy(count);
     forEach(count, [&](float value, size_t index) { copy[index] = value; });
     return copy;
@@ -250,17 +294,33 @@ unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
 }
 
 void VertexBuffer::ForEach(const Float32Array& data, size_t byteOffset, size_t byteStride,
-                           size_t componentCount, unsigned int /*componentType*/, size_t count,
-                           bool /*normalized*/,
+                           size_t componentCount, unsigned int componentType, size_t count,
+                           bool normalized,
                            const std::function<void(float value, size_t index)>& callback)
 {
-  auto offset       = byteOffset / 4;
-  const auto stride = byteStride / 4;
+  if (componentType == VertexBuffer::FLOAT && byteOffset % 4 == 0 && byteStride % 4 == 0) {
+    auto offset       = byteOffset / 4;
+    const auto stride = byteStride / 4;
+    for (size_t index = 0; index < count; index += componentCount) {
+      for (size_t componentIndex = 0; componentIndex < componentCount; componentIndex++) {
+        callback(data[offset + componentIndex], index + componentIndex);
+      }
+      offset += stride;
+    }
+    return;
+  }
+
+  // Integer (e.g. quantized) or unaligned components, read from the bytes stored in the buffer
+  const auto bytes               = reinterpret_cast<const uint8_t*>(data.data());
+  const auto componentByteLength = VertexBuffer::GetTypeByteLength(componentType);
   for (size_t index = 0; index < count; index += componentCount) {
+    auto componentByteOffset = byteOffset;
     for (size_t componentIndex = 0; componentIndex < componentCount; componentIndex++) {
-      callback(data[offset + componentIndex], index + componentIndex);
+      const auto value = ReadFloatValue(bytes, componentType, componentByteOffset, normalized);
+      callback(value, index + componentIndex);
+      componentByteOffset += componentByteLength;
     }
-    offset += stride;
+    byteOffset += byteStride;
   }
 }
 
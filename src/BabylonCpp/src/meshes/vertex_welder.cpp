@@ -0,0 +1,175 @@
+#include <babylon/meshes/vertex_welder.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t NoVertex = static_cast<uint32_t>(-1);
+
+uint64_t hashCell(int64_t x, int64_t y, int64_t z)
+{
+  auto hash = static_cast<uint64_t>(x) * 0x9e3779b97f4a7c15ull;
+  hash      = (hash ^ static_cast<uint64_t>(y)) * 0xbf58476d1ce4e5b9ull;
+  hash      = (hash ^ static_cast<uint64_t>(z)) * 0x94d049bb133111ebull;
+  return hash ^ (hash >> 31);
+}
+
+bool isEqual(const Float32Array* values, size_t stride, float epsilon, size_t a, size_t b)
+{
+  if (!values || values->size() < (std::max(a, b) + 1) * stride) {
+    return true;
+  }
+  for (size_t k = 0; k < stride; ++k) {
+    if (!(std::abs((*values)[a * stride + k] - (*values)[b * stride + k]) <= epsilon)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
+Uint32Array VertexWelder::Weld(const Float32Array& positions, const VertexWelderOptions& options)
+{
+  const auto count   = positions.size() / 3;
+  const auto epsilon = std::max(options.epsilon, 0.f);
+  Uint32Array remap(count);
+
+  // Cell of each vertex: cells 4 epsilon wide, so that most of the vertices are at more than
+  // epsilon of the cell borders, or the exact coordinates when epsilon is 0
+  const auto invCellSize = epsilon > 0.f ? 0.25 / static_cast<double>(epsilon) : 0.0;
+  const auto cellOf      = [&](double value, int64_t& cell) {
+    if (epsilon > 0.f) {
+      const auto scaled = std::floor(value * invCellSize);
+      if (!(std::abs(scaled) < 4e18)) {
+        return false;
+      }
+      cell = static_cast<int64_t>(scaled);
+      return true;
+    }
+    if (!std::isfinite(value)) {
+      return false;
+    }
+    // -0 and +0 are the same position
+    int32_t bits          = 0;
+    const auto normalized = value == 0.0 ? 0.f : static_cast<float>(value);
+    std::memcpy(&bits, &normalized, sizeof(bits));
+    cell = bits;
+    return true;
+  };
+
+  std::vector<int64_t> cells(count * 3);
+  std::vector<uint8_t> valid(count);
+  const auto computeCells = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      valid[i] = cellOf(positions[i * 3 + 0], cells[i * 3 + 0])
+                 && cellOf(positions[i * 3 + 1], cells[i * 3 + 1])
+                 && cellOf(positions[i * 3 + 2], cells[i * 3 + 2]);
+    }
+  };
+
+  // Per cell lists of vertices, in increasing order
+  std::unordered_map<uint64_t, uint32_t> heads;
+  std::vector<uint32_t> next(count, NoVertex);
+  const auto buildGrid = [&]() {
+    heads.reserve(count);
+    for (size_t i = count; i-- > 0;) {
+      if (valid[i]) {
+        auto& head = heads.try_emplace(hashCell(cells[i * 3], cells[i * 3 + 1], cells[i * 3 + 2]),
+                                       NoVertex)
+                       .first->second;
+        next[i] = head;
+        head    = static_cast<uint32_t>(i);
+      }
+    }
+  };
+
+  // Vertices are equal if their positions and the compared attributes are equal
+  const auto isSameVertex = [&](size_t a, size_t b) {
+    return isEqual(&positions, 3, epsilon, a, b)
+           && isEqual(options.normals, 3, options.normalEpsilon, a, b)
+           && isEqual(options.uvs, 2, options.uvEpsilon, a, b)
+           && isEqual(options.colors, 4, options.colorEpsilon, a, b);
+  };
+  const auto findInCell = [&](size_t i, int64_t x, int64_t y, int64_t z) {
+    const auto it = heads.find(hashCell(x, y, z));
+    if (it != heads.end()) {
+      for (auto j = it->second; j != NoVertex && j < i; j = next[j]) {
+        if (isSameVertex(i, j)) {
+          return j;
+        }
+      }
+    }
+    return NoVertex;
+  };
+  // A vertex before each vertex which is equal to it: the first one of its cell, otherwise the
+  // first one of the neighbouring cells
+  const auto findVertices = [&](size_t begin, size_t end) {
+    std::array<int64_t, 3> lower{}, upper{};
+    for (size_t i = begin; i < end; ++i) {
+      const auto cell = &cells[i * 3];
+      auto found      = valid[i] ? findInCell(i, cell[0], cell[1], cell[2]) : NoVertex;
+      if (found != NoVertex || !valid[i] || epsilon == 0.f) {
+        remap[i] = found;
+        continue;
+      }
+      // Neighbouring cells at less than epsilon
+      for (size_t k = 0; k < 3; ++k) {
+        const auto value = static_cast<double>(positions[i * 3 + k]);
+        lower[k]         = cellOf(value - epsilon, lower[k]) ? lower[k] : cell[k];
+        upper[k]         = cellOf(value + epsilon, upper[k]) ? upper[k] : cell[k];
+      }
+      for (auto x = lower[0]; x <= upper[0]; ++x) {
+        for (auto y = lower[1]; y <= upper[1]; ++y) {
+          for (auto z = lower[2]; z <= upper[2]; ++z) {
+            if (x != cell[0] || y != cell[1] || z != cell[2]) {
+              found = std::min(found, findInCell(i, x, y, z));
+            }
+          }
+        }
+      }
+      remap[i] = found;
+    }
+  };
+
+  static constexpr size_t GrainSize = 4096;
+  if (options.parallel) {
+    auto& threadPool = ThreadPool::Default();
+    threadPool.parallelFor(count, GrainSize, computeCells);
+    buildGrid();
+    threadPool.parallelFor(count, GrainSize, findVertices);
+  }
+  else {
+    computeCells(0, count);
+    buildGrid();
+    findVertices(0, count);
+  }
+
+  // Resolve the chains, remap[j] is final for all j < i
+  for (size_t i = 0; i < count; ++i) {
+    remap[i] = remap[i] == NoVertex ? static_cast<uint32_t>(i) : remap[remap[i]];
+  }
+
+  return remap;
+}
+
+Uint32Array VertexWelder::UniqueVertices(const Uint32Array& remap)
+{
+  Uint32Array uniqueVertices;
+  for (size_t i = 0; i < remap.size(); ++i) {
+    if (remap[i] == i) {
+      uniqueVertices.emplace_back(static_cast<uint32_t>(i));
+    }
+  }
+  return uniqueVertices;
+}
+
+} // end of namespace BABYLON
@@ -38,6 +38,7 @@
 #include <babylon/misc/string_tools.h>
 #include <babylon/utils/base64.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace BABYLON {
@@ -250,17 +251,21 @@ void FileTools::LoadImageFromBuffer(
 
 Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertically)
 {
-  if (buffer.empty()) {
+  return ArrayBufferToImage(buffer.data(), buffer.size(), flipVertically);
+}
+
+Image FileTools::ArrayBufferToImage(const uint8_t* buffer, size_t byteLength, bool flipVertically)
+{
+  if (!buffer || byteLength == 0) {
     return Image();
   }
-  auto bufferSize = static_cast<int>(buffer.size());
+  auto bufferSize = static_cast<int>(byteLength);
   int w = -1, h = -1, n = -1;
   int req_comp = STBI_rgb_alpha;
 
-  stbi_set_flip_vertically_on_load(flipVertically);
-  unsigned char* ucharBuffer
-    = stbi_load_from_memory(buffer.data(), bufferSize, &w, &h, &n, req_comp);
-  stbi_set_flip_vertically_on_load(false);
+  // The rows are flipped after decoding rather than with stbi_set_flip_vertically_on_load, which
+  // is process wide and would race with the decoding of other images on worker threads
+  unsigned char* ucharBuffer = stbi_load_from_memory(buffer, bufferSize, &w, &h, &n, req_comp);
 
   if (!ucharBuffer)
     return Image();
@@ -268,6 +273,16 @@ Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertical
   n = STBI_rgb_alpha;
   Image image(ucharBuffer, w * h * n, w, h, n, (n == 3) ? GL::RGB : GL::RGBA);
   stbi_image_free(ucharBuffer);
+
+  if (flipVertically) {
+    const auto rowLength = static_cast<size_t>(w * n);
+    for (int top = 0, bottom = h - 1; top < bottom; ++top, --bottom) {
+      std::swap_ranges(image.data.begin() + static_cast<std::ptrdiff_t>(top * rowLength),
+                       image.data.begin() + static_cast<std::ptrdiff_t>((top + 1) * rowLength),
+                       image.data.begin() + static_cast<std::ptrdiff_t>(bottom * rowLength));
+    }
+  }
+
   return image;
 }
 
@@ -29,6 +29,8 @@ BaseParticleSystem::BaseParticleSystem(const std::string& iName)
                                    &BaseParticleSystem::set_direction1}
     , _isSubEmitter{false}
     , _isBillboardBased{true}
+    , _scene{nullptr}
+    , _engine{nullptr}
     , _imageProcessingConfigurationDefines{std::make_shared<ImageProcessingConfigurationDefines>()}
     , _noiseTexture{nullptr}
     , _zeroVector3{Vector3::Zero()}
@@ -8,6 +8,7 @@
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/particle.h>
 
 namespace BABYLON {
 
@@ -50,11 +51,12 @@ void MeshParticleEmitter::set_mesh(const AbstractMeshPtr& value)
 }
 
 void MeshParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
-                                                 Vector3& directionToUpdate, Particle* /*particle*/,
+                                                 Vector3& directionToUpdate, Particle* particle,
                                                  bool isLocal)
 {
   if (useMeshNormalsForDirection && !_normals.empty()) {
-    Vector3::TransformNormalToRef(_storedNormal, worldMatrix, directionToUpdate);
+    const auto& storedNormal = particle ? particle->_emitterNormal : _storedNormal;
+    Vector3::TransformNormalToRef(storedNormal, worldMatrix, directionToUpdate);
     return;
   }
 
@@ -71,17 +73,18 @@ void MeshParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 }
 
 void MeshParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
-                                                Vector3& positionToUpdate, Particle* /*particle*/,
+                                                Vector3& positionToUpdate, Particle* particle,
                                                 bool isLocal)
 {
   if (_indices.empty() || _positions.empty()) {
     return;
   }
 
-  const auto randomFaceIndex = static_cast<size_t>(3 * Math::random() * (_indices.size() / 3));
-  const auto bu              = Math::random();
-  const auto bv              = Math::random() * (1.f - bu);
-  const auto bw              = 1.f - bu - bv;
+  const auto randomFaceIndex
+    = 3 * static_cast<size_t>(Math::random() * static_cast<float>(_indices.size() / 3));
+  const auto bu = Math::random();
+  const auto bv = Math::random() * (1.f - bu);
+  const auto bw = 1.f - bu - bv;
 
   const auto faceIndexA = _indices[randomFaceIndex];
   const auto faceIndexB = _indices[randomFaceIndex + 1];
@@ -112,9 +115,10 @@ void MeshParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
     Vector3::FromArrayToRef(_normals, faceIndexB * 3, vertexB);
     Vector3::FromArrayToRef(_normals, faceIndexC * 3, vertexC);
 
-    _storedNormal.x = bu * vertexA.x + bv * vertexB.x + bw * vertexC.x;
-    _storedNormal.y = bu * vertexA.y + bv * vertexB.y + bw * vertexC.y;
-    _storedNormal.z = bu * vertexA.z + bv * vertexB.z + bw * vertexC.z;
+    auto& storedNormal = particle ? particle->_emitterNormal : _storedNormal;
+    storedNormal.x     = bu * vertexA.x + bv * vertexB.x + bw * vertexC.x;
+    storedNormal.y     = bu * vertexA.y + bv * vertexB.y + bw * vertexC.y;
+    storedNormal.z     = bu * vertexA.z + bv * vertexB.z + bw * vertexC.z;
   }
 }
 
@@ -8,7 +8,7 @@
 
 namespace BABYLON {
 
-size_t Particle::_Count = 0;
+std::atomic<size_t> Particle::_Count{0};
 
 Particle::Particle(ParticleSystem* iParticleSystem)
     : id{Particle::_Count++}
@@ -48,6 +48,7 @@ Particle::Particle(ParticleSystem* iParticleSystem)
     , _currentDrag2{0.f}
     , _randomNoiseCoordinates1{std::nullopt}
     , _localPosition{std::nullopt}
+    , _emitterNormal{Vector3::Zero()}
     , particleSystem{iParticleSystem}
     , _currentFrameCounter{0u}
 {
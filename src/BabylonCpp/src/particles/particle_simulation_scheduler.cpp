@@ -0,0 +1,42 @@
+#include <babylon/particles/particle_simulation_scheduler.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/particles/particle_system.h>
+
+namespace BABYLON {
+
+ParticleSimulationScheduler::ParticleSimulationScheduler(ThreadPool& threadPool)
+    : _threadPool{threadPool}
+{
+}
+
+ParticleSimulationScheduler::~ParticleSimulationScheduler() = default;
+
+void ParticleSimulationScheduler::animate(const std::vector<IParticleSystem*>& particleSystems)
+{
+  _simulatedSystems.clear();
+  for (const auto& particleSystem : particleSystems) {
+    auto cpuParticleSystem = dynamic_cast<ParticleSystem*>(particleSystem);
+    if (!cpuParticleSystem || !cpuParticleSystem->_canSimulateOnWorkerThread()) {
+      particleSystem->animate();
+    }
+    else if (cpuParticleSystem->_beginAnimate()) {
+      _simulatedSystems.emplace_back(cpuParticleSystem);
+    }
+  }
+
+  // One system per chunk, the large systems split their own passes in chunks as well
+  _threadPool.parallelFor(_simulatedSystems.size(), 1, [this](size_t begin, size_t end) {
+    for (auto index = begin; index < end; ++index) {
+      _simulatedSystems[index]->_simulateAnimate(&_threadPool);
+    }
+  });
+
+  // Sync point
+  for (const auto& particleSystem : _simulatedSystems) {
+    particleSystem->_endAnimate();
+  }
+  _simulatedSystems.clear();
+}
+
+} // end of namespace BABYLON
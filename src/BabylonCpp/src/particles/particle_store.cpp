@@ -0,0 +1,711 @@
+#include <babylon/particles/particle_store.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include <babylon/maths/scalar.h>
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/misc/gradient_helper.h>
+#include <babylon/particles/particle.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BABYLON_PARTICLES_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BABYLON_PARTICLES_NEON
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Number of particles processed by each pass of the update kernel
+constexpr size_t BlockSize = 256;
+
+/**
+ * One particle at a time, used for the remaining particles of a range and when no vector
+ * instruction set is available.
+ */
+struct ScalarLanes {
+  using Type                   = float;
+  using Mask                   = bool;
+  static constexpr size_t Size = 1;
+
+  static Type Load(const float* p)
+  {
+    return *p;
+  }
+  static void Store(float* p, Type v)
+  {
+    *p = v;
+  }
+  static Type Set(float v)
+  {
+    return v;
+  }
+  static Type Add(Type a, Type b)
+  {
+    return a + b;
+  }
+  static Type Sub(Type a, Type b)
+  {
+    return a - b;
+  }
+  static Type Mul(Type a, Type b)
+  {
+    return a * b;
+  }
+  static Type Div(Type a, Type b)
+  {
+    return a / b;
+  }
+  static Type Min(Type a, Type b)
+  {
+    return b < a ? b : a;
+  }
+  static Type Max(Type a, Type b)
+  {
+    return a < b ? b : a;
+  }
+  static Mask Greater(Type a, Type b)
+  {
+    return a > b;
+  }
+  static Type Select(Mask mask, Type a, Type b)
+  {
+    return mask ? a : b;
+  }
+};
+
+#if defined(BABYLON_PARTICLES_SSE2)
+
+struct VectorLanes {
+  using Type                   = __m128;
+  using Mask                   = __m128;
+  static constexpr size_t Size = 4;
+
+  static Type Load(const float* p)
+  {
+    return _mm_loadu_ps(p);
+  }
+  static void Store(float* p, Type v)
+  {
+    _mm_storeu_ps(p, v);
+  }
+  static Type Set(float v)
+  {
+    return _mm_set1_ps(v);
+  }
+  static Type Add(Type a, Type b)
+  {
+    return _mm_add_ps(a, b);
+  }
+  static Type Sub(Type a, Type b)
+  {
+    return _mm_sub_ps(a, b);
+  }
+  static Type Mul(Type a, Type b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+  static Type Div(Type a, Type b)
+  {
+    return _mm_div_ps(a, b);
+  }
+  static Type Min(Type a, Type b)
+  {
+    return _mm_min_ps(a, b);
+  }
+  static Type Max(Type a, Type b)
+  {
+    return _mm_max_ps(a, b);
+  }
+  static Mask Greater(Type a, Type b)
+  {
+    return _mm_cmpgt_ps(a, b);
+  }
+  static Type Select(Mask mask, Type a, Type b)
+  {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+};
+
+#elif defined(BABYLON_PARTICLES_NEON)
+
+struct VectorLanes {
+  using Type                   = float32x4_t;
+  using Mask                   = uint32x4_t;
+  static constexpr size_t Size = 4;
+
+  static Type Load(const float* p)
+  {
+    return vld1q_f32(p);
+  }
+  static void Store(float* p, Type v)
+  {
+    vst1q_f32(p, v);
+  }
+  static Type Set(float v)
+  {
+    return vdupq_n_f32(v);
+  }
+  static Type Add(Type a, Type b)
+  {
+    return vaddq_f32(a, b);
+  }
+  static Type Sub(Type a, Type b)
+  {
+    return vsubq_f32(a, b);
+  }
+  static Type Mul(Type a, Type b)
+  {
+    return vmulq_f32(a, b);
+  }
+  static Type Div(Type a, Type b)
+  {
+    // Two Newton-Raphson steps, vdivq_f32 is only available on AArch64
+    auto reciprocal = vrecpeq_f32(b);
+    reciprocal      = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    reciprocal      = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    return vmulq_f32(a, reciprocal);
+  }
+  static Type Min(Type a, Type b)
+  {
+    return vminq_f32(a, b);
+  }
+  static Type Max(Type a, Type b)
+  {
+    return vmaxq_f32(a, b);
+  }
+  static Mask Greater(Type a, Type b)
+  {
+    return vcgtq_f32(a, b);
+  }
+  static Type Select(Mask mask, Type a, Type b)
+  {
+    return vbslq_f32(mask, a, b);
+  }
+};
+
+#endif
+
+/**
+ * Calls kernel(lanes, index) for the particles in [begin, end), several particles at a time when
+ * possible.
+ */
+template <typename Kernel>
+void ForEachLanes(size_t begin, size_t end, const Kernel& kernel)
+{
+  auto i = begin;
+#if defined(BABYLON_PARTICLES_SSE2) || defined(BABYLON_PARTICLES_NEON)
+  for (; i + VectorLanes::Size <= end; i += VectorLanes::Size) {
+    kernel(VectorLanes{}, i);
+  }
+#endif
+  for (; i < end; ++i) {
+    kernel(ScalarLanes{}, i);
+  }
+}
+
+/**
+ * Samples a gradient table at the given ratio of the life time.
+ */
+inline float Sample(const float* values, float ratio)
+{
+  // Also maps NaN to 0
+  const auto clamped = ratio > 0.f ? (ratio < 1.f ? ratio : 1.f) : 0.f;
+  const auto x       = clamped * static_cast<float>(ParticleStore::GradientTableSize - 1);
+  const auto index   = static_cast<size_t>(x);
+  const auto t       = x - static_cast<float>(index);
+  return values[index] + (values[index + 1] - values[index]) * t;
+}
+
+/**
+ * Fills result with the gradient values of the particles of a block.
+ */
+inline void SampleBlock(const float* values1, const float* values2, const float* ratios,
+                        const float* randoms, float* result, size_t count)
+{
+  if (!values2) {
+    for (size_t j = 0; j < count; ++j) {
+      result[j] = Sample(values1, ratios[j]);
+    }
+    return;
+  }
+
+  for (size_t j = 0; j < count; ++j) {
+    const auto value1 = Sample(values1, ratios[j]);
+    const auto value2 = Sample(values2, ratios[j]);
+    result[j]         = value1 + (value2 - value1) * randoms[j];
+  }
+}
+
+} // end of anonymous namespace
+
+ParticleStore::ParticleStore() : _count{0}, _capacity{0}, _limitVelocityDamping{0.4f}
+{
+}
+
+ParticleStore::ParticleStore(const ParticleStore& other) = default;
+
+ParticleStore::ParticleStore(ParticleStore&& other) = default;
+
+ParticleStore& ParticleStore::operator=(const ParticleStore& other) = default;
+
+ParticleStore& ParticleStore::operator=(ParticleStore&& other) = default;
+
+ParticleStore::~ParticleStore() = default;
+
+size_t ParticleStore::size() const
+{
+  return _count;
+}
+
+size_t ParticleStore::capacity() const
+{
+  return _capacity;
+}
+
+void ParticleStore::setCapacity(size_t capacity)
+{
+  for (auto array :
+       {&_positionX, &_positionY, &_positionZ, &_directionX, &_directionY, &_directionZ,
+        &_initialDirectionX, &_initialDirectionY, &_initialDirectionZ, &_colorR, &_colorG,
+        &_colorB, &_colorA, &_colorStepR, &_colorStepG, &_colorStepB, &_colorStepA, &_age,
+        &_lifeTime, &_sizes, &_scaleX, &_scaleY, &_angle, &_angularSpeed, &_random}) {
+    array->resize(capacity);
+  }
+  _hasInitialDirection.resize(capacity);
+
+  _capacity = capacity;
+  _count    = std::min(_count, capacity);
+}
+
+void ParticleStore::clear()
+{
+  _count = 0;
+}
+
+size_t ParticleStore::add(const Particle& particle, float random)
+{
+  if (_count >= _capacity) {
+    return _capacity;
+  }
+
+  const auto index = _count;
+  grow(1);
+  set(index, particle, random);
+  return index;
+}
+
+size_t ParticleStore::grow(size_t count)
+{
+  count = std::min(count, _capacity - _count);
+  _count += count;
+  return count;
+}
+
+void ParticleStore::set(size_t index, const Particle& particle, float random)
+{
+  _positionX[index]  = particle.position.x;
+  _positionY[index]  = particle.position.y;
+  _positionZ[index]  = particle.position.z;
+  _directionX[index] = particle.direction.x;
+  _directionY[index] = particle.direction.y;
+  _directionZ[index] = particle.direction.z;
+
+  _hasInitialDirection[index] = particle._initialDirection.has_value() ? 1 : 0;
+  if (particle._initialDirection) {
+    _initialDirectionX[index] = particle._initialDirection->x;
+    _initialDirectionY[index] = particle._initialDirection->y;
+    _initialDirectionZ[index] = particle._initialDirection->z;
+  }
+
+  _colorR[index]     = particle.color.r;
+  _colorG[index]     = particle.color.g;
+  _colorB[index]     = particle.color.b;
+  _colorA[index]     = particle.color.a;
+  _colorStepR[index] = particle.colorStep.r;
+  _colorStepG[index] = particle.colorStep.g;
+  _colorStepB[index] = particle.colorStep.b;
+  _colorStepA[index] = particle.colorStep.a;
+
+  // A null life time would make the ratio of the gradients undefined
+  _age[index]      = particle.age;
+  _lifeTime[index] = std::max(particle.lifeTime, std::numeric_limits<float>::min());
+
+  _sizes[index]        = particle.size;
+  _scaleX[index]       = particle.scale.x;
+  _scaleY[index]       = particle.scale.y;
+  _angle[index]        = particle.angle;
+  _angularSpeed[index] = particle.angularSpeed;
+  _random[index]       = random;
+}
+
+void ParticleStore::_BuildFactorTable(const std::vector<FactorGradient>& gradients,
+                                      GradientTable& table)
+{
+  table.enabled = !gradients.empty();
+  table.range   = std::any_of(gradients.begin(), gradients.end(), [](const FactorGradient& g) {
+    return g.factor2.has_value() && *g.factor2 != g.factor1;
+  });
+  if (!table.enabled) {
+    return;
+  }
+
+  table.values1.resize(GradientTableSize + 1);
+  table.values2.resize(table.range ? GradientTableSize + 1 : 0);
+  for (size_t k = 0; k < GradientTableSize; ++k) {
+    const auto ratio = static_cast<float>(k) / static_cast<float>(GradientTableSize - 1);
+    GradientHelper::GetCurrentGradient<FactorGradient>(
+      ratio, gradients,
+      [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+          float scale) {
+        table.values1[k] = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
+        if (table.range) {
+          table.values2[k]
+            = Scalar::Lerp(currentGradient.factor2.value_or(currentGradient.factor1),
+                           nextGradient.factor2.value_or(nextGradient.factor1), scale);
+        }
+      });
+  }
+  table.values1[GradientTableSize] = table.values1[GradientTableSize - 1];
+  if (table.range) {
+    table.values2[GradientTableSize] = table.values2[GradientTableSize - 1];
+  }
+}
+
+void ParticleStore::setColorGradients(const std::vector<ColorGradient>& gradients)
+{
+  const auto range
+    = std::any_of(gradients.begin(), gradients.end(),
+                  [](const ColorGradient& g) { return g.color2.has_value(); });
+
+  std::array<GradientTable*, 4> tables{&_colorGradientsR, &_colorGradientsG, &_colorGradientsB,
+                                       &_colorGradientsA};
+  for (auto table : tables) {
+    table->enabled = !gradients.empty();
+    table->range   = range;
+    table->values1.resize(table->enabled ? GradientTableSize + 1 : 0);
+    table->values2.resize(table->enabled && range ? GradientTableSize + 1 : 0);
+  }
+  if (gradients.empty()) {
+    return;
+  }
+
+  for (size_t k = 0; k <= GradientTableSize; ++k) {
+    const auto ratio = static_cast<float>(std::min(k, GradientTableSize - 1))
+                       / static_cast<float>(GradientTableSize - 1);
+    GradientHelper::GetCurrentGradient<ColorGradient>(
+      ratio, gradients,
+      [&](const ColorGradient& currentGradient, const ColorGradient& nextGradient, float scale) {
+        const auto color1 = Color4::Lerp(currentGradient.color1, nextGradient.color1, scale);
+        _colorGradientsR.values1[k] = color1.r;
+        _colorGradientsG.values1[k] = color1.g;
+        _colorGradientsB.values1[k] = color1.b;
+        _colorGradientsA.values1[k] = color1.a;
+        if (range) {
+          const auto color2
+            = Color4::Lerp(currentGradient.color2.value_or(currentGradient.color1),
+                           nextGradient.color2.value_or(nextGradient.color1), scale);
+          _colorGradientsR.values2[k] = color2.r;
+          _colorGradientsG.values2[k] = color2.g;
+          _colorGradientsB.values2[k] = color2.b;
+          _colorGradientsA.values2[k] = color2.a;
+        }
+      });
+  }
+}
+
+void ParticleStore::setSizeGradients(const std::vector<FactorGradient>& gradients)
+{
+  _BuildFactorTable(gradients, _sizeGradients);
+}
+
+void ParticleStore::setAngularSpeedGradients(const std::vector<FactorGradient>& gradients)
+{
+  _BuildFactorTable(gradients, _angularSpeedGradients);
+}
+
+void ParticleStore::setVelocityGradients(const std::vector<FactorGradient>& gradients)
+{
+  _BuildFactorTable(gradients, _velocityGradients);
+}
+
+void ParticleStore::setLimitVelocityGradients(const std::vector<FactorGradient>& gradients,
+                                              float damping)
+{
+  _BuildFactorTable(gradients, _limitVelocityGradients);
+  _limitVelocityDamping = damping;
+}
+
+void ParticleStore::setDragGradients(const std::vector<FactorGradient>& gradients)
+{
+  _BuildFactorTable(gradients, _dragGradients);
+}
+
+void ParticleStore::update(const ParticleStoreUpdate& update, size_t begin, size_t end)
+{
+  end = std::min(end, _count);
+
+  const auto values2 = [](const GradientTable& table) -> const float* {
+    return table.range ? table.values2.data() : nullptr;
+  };
+
+  const auto colorGradients = _colorGradientsR.enabled;
+  const auto velocity       = _velocityGradients.enabled;
+  const auto limitVelocity  = _limitVelocityGradients.enabled;
+  const auto drag           = _dragGradients.enabled;
+
+  float steps[BlockSize], ratios[BlockSize], velocities[BlockSize], limits[BlockSize],
+    drags[BlockSize];
+
+  for (auto blockBegin = begin; blockBegin < end; blockBegin += BlockSize) {
+    const auto blockEnd = std::min(blockBegin + BlockSize, end);
+    const auto count    = blockEnd - blockBegin;
+
+    // Age, the last step of a particle is shortened to end exactly at its life time
+    ForEachLanes(blockBegin, blockEnd, [&](auto lanes, size_t i) {
+      using L             = decltype(lanes);
+      const auto j        = i - blockBegin;
+      const auto age      = L::Load(&_age[i]);
+      const auto lifeTime = L::Load(&_lifeTime[i]);
+      const auto speed    = L::Set(update.updateSpeed);
+      const auto step     = L::Max(L::Min(speed, L::Sub(lifeTime, age)), L::Set(0.f));
+      const auto newAge   = L::Min(L::Add(age, speed), lifeTime);
+      L::Store(&_age[i], newAge);
+      L::Store(&steps[j], step);
+      L::Store(&ratios[j], L::Div(newAge, lifeTime));
+    });
+
+    // Gradients
+    const auto randoms = &_random[blockBegin];
+    if (colorGradients) {
+      SampleBlock(_colorGradientsR.values1.data(), values2(_colorGradientsR), ratios, randoms,
+                  &_colorR[blockBegin], count);
+      SampleBlock(_colorGradientsG.values1.data(), values2(_colorGradientsG), ratios, randoms,
+                  &_colorG[blockBegin], count);
+      SampleBlock(_colorGradientsB.values1.data(), values2(_colorGradientsB), ratios, randoms,
+                  &_colorB[blockBegin], count);
+      SampleBlock(_colorGradientsA.values1.data(), values2(_colorGradientsA), ratios, randoms,
+                  &_colorA[blockBegin], count);
+    }
+    if (_angularSpeedGradients.enabled) {
+      SampleBlock(_angularSpeedGradients.values1.data(), values2(_angularSpeedGradients), ratios,
+                  randoms, &_angularSpeed[blockBegin], count);
+    }
+    if (_sizeGradients.enabled) {
+      SampleBlock(_sizeGradients.values1.data(), values2(_sizeGradients), ratios, randoms,
+                  &_sizes[blockBegin], count);
+    }
+    if (velocity) {
+      SampleBlock(_velocityGradients.values1.data(), values2(_velocityGradients), ratios, randoms,
+                  velocities, count);
+    }
+    if (limitVelocity) {
+      SampleBlock(_limitVelocityGradients.values1.data(), values2(_limitVelocityGradients),
+                  ratios, randoms, limits, count);
+    }
+    if (drag) {
+      SampleBlock(_dragGradients.values1.data(), values2(_dragGradients), ratios, randoms, drags,
+                  count);
+    }
+
+    // Color, angle, motion and gravity
+    ForEachLanes(blockBegin, blockEnd, [&](auto lanes, size_t i) {
+      using L         = decltype(lanes);
+      const auto j    = i - blockBegin;
+      const auto step = L::Load(&steps[j]);
+
+      if (!colorGradients) {
+        L::Store(&_colorR[i], L::Add(L::Load(&_colorR[i]), L::Mul(L::Load(&_colorStepR[i]), step)));
+        L::Store(&_colorG[i], L::Add(L::Load(&_colorG[i]), L::Mul(L::Load(&_colorStepG[i]), step)));
+        L::Store(&_colorB[i], L::Add(L::Load(&_colorB[i]), L::Mul(L::Load(&_colorStepB[i]), step)));
+        L::Store(&_colorA[i],
+                 L::Max(L::Add(L::Load(&_colorA[i]), L::Mul(L::Load(&_colorStepA[i]), step)),
+                        L::Set(0.f)));
+      }
+
+      L::Store(&_angle[i], L::Add(L::Load(&_angle[i]), L::Mul(L::Load(&_angularSpeed[i]), step)));
+
+      auto directionX = L::Load(&_directionX[i]);
+      auto directionY = L::Load(&_directionY[i]);
+      auto directionZ = L::Load(&_directionZ[i]);
+
+      auto directionScale = step;
+      if (velocity) {
+        directionScale = L::Mul(directionScale, L::Load(&velocities[j]));
+      }
+      if (drag) {
+        directionScale = L::Mul(directionScale, L::Sub(L::Set(1.f), L::Load(&drags[j])));
+      }
+      L::Store(&_positionX[i], L::Add(L::Load(&_positionX[i]), L::Mul(directionX, directionScale)));
+      L::Store(&_positionY[i], L::Add(L::Load(&_positionY[i]), L::Mul(directionY, directionScale)));
+      L::Store(&_positionZ[i], L::Add(L::Load(&_positionZ[i]), L::Mul(directionZ, directionScale)));
+
+      if (limitVelocity) {
+        // Compared squared, a negative limit damps every moving particle
+        const auto limit   = L::Max(L::Load(&limits[j]), L::Set(0.f));
+        const auto length2 = L::Add(L::Add(L::Mul(directionX, directionX),
+                                           L::Mul(directionY, directionY)),
+                                    L::Mul(directionZ, directionZ));
+        const auto damping = L::Select(L::Greater(length2, L::Mul(limit, limit)),
+                                       L::Set(_limitVelocityDamping), L::Set(1.f));
+        directionX         = L::Mul(directionX, damping);
+        directionY         = L::Mul(directionY, damping);
+        directionZ         = L::Mul(directionZ, damping);
+      }
+
+      L::Store(&_directionX[i], L::Add(directionX, L::Mul(L::Set(update.gravity.x), step)));
+      L::Store(&_directionY[i], L::Add(directionY, L::Mul(L::Set(update.gravity.y), step)));
+      L::Store(&_directionZ[i], L::Add(directionZ, L::Mul(L::Set(update.gravity.z), step)));
+    });
+  }
+}
+
+void ParticleStore::update(const ParticleStoreUpdate& iUpdate)
+{
+  update(iUpdate, 0, _count);
+}
+
+void ParticleStore::_move(size_t from, size_t to)
+{
+  for (auto array :
+       {&_positionX, &_positionY, &_positionZ, &_directionX, &_directionY, &_directionZ,
+        &_initialDirectionX, &_initialDirectionY, &_initialDirectionZ, &_colorR, &_colorG,
+        &_colorB, &_colorA, &_colorStepR, &_colorStepG, &_colorStepB, &_colorStepA, &_age,
+        &_lifeTime, &_sizes, &_scaleX, &_scaleY, &_angle, &_angularSpeed, &_random}) {
+    (*array)[to] = (*array)[from];
+  }
+  _hasInitialDirection[to] = _hasInitialDirection[from];
+}
+
+size_t ParticleStore::removeDeadParticles()
+{
+  const auto previousSize = _count;
+  for (size_t i = 0; i < _count;) {
+    if (_age[i] >= _lifeTime[i]) {
+      --_count;
+      if (i != _count) {
+        _move(_count, i);
+      }
+    }
+    else {
+      ++i;
+    }
+  }
+  return previousSize - _count;
+}
+
+void ParticleStore::fillVertexData(float* vertexData, const ParticleStoreVertexLayout& layout,
+                                   size_t begin, size_t end) const
+{
+  end = std::min(end, _count);
+
+  static constexpr float OffsetsX[4] = {0.f, 1.f, 1.f, 0.f};
+  static constexpr float OffsetsY[4] = {0.f, 0.f, 1.f, 1.f};
+
+  const auto vertexSize   = layout.vertexSize;
+  const auto vertexCount  = layout.useInstancing ? size_t(1) : size_t(4);
+  const auto particleSize = vertexSize * vertexCount;
+  const auto& worldOffset = layout.worldOffset;
+
+  for (auto i = begin; i < end; ++i) {
+    auto out = vertexData + i * particleSize;
+    size_t o = 0;
+    out[o++] = _positionX[i] + worldOffset.x;
+    out[o++] = _positionY[i] + worldOffset.y;
+    out[o++] = _positionZ[i] + worldOffset.z;
+    out[o++] = _colorR[i];
+    out[o++] = _colorG[i];
+    out[o++] = _colorB[i];
+    out[o++] = _colorA[i];
+    out[o++] = _angle[i];
+    out[o++] = _scaleX[i] * _sizes[i];
+    out[o++] = _scaleY[i] * _sizes[i];
+
+    if (layout.direction) {
+      auto x = _directionX[i], y = _directionY[i], z = _directionZ[i];
+      if (layout.initialDirection) {
+        if (_hasInitialDirection[i]) {
+          x = _initialDirectionX[i];
+          y = _initialDirectionY[i];
+          z = _initialDirectionZ[i];
+        }
+        if (x == 0.f && z == 0.f) {
+          x = 0.001f;
+        }
+      }
+      out[o++] = x;
+      out[o++] = y;
+      out[o++] = z;
+    }
+
+    if (vertexCount > 1) {
+      for (size_t v = 1; v < vertexCount; ++v) {
+        std::memcpy(out + v * vertexSize, out, o * sizeof(float));
+      }
+      for (size_t v = 0; v < vertexCount; ++v) {
+        out[v * vertexSize + o]     = OffsetsX[v];
+        out[v * vertexSize + o + 1] = OffsetsY[v];
+      }
+    }
+  }
+}
+
+void ParticleStore::fillVertexData(float* vertexData, const ParticleStoreVertexLayout& layout) const
+{
+  fillVertexData(vertexData, layout, 0, _count);
+}
+
+Vector3 ParticleStore::position(size_t index) const
+{
+  return Vector3(_positionX[index], _positionY[index], _positionZ[index]);
+}
+
+Vector3 ParticleStore::direction(size_t index) const
+{
+  return Vector3(_directionX[index], _directionY[index], _directionZ[index]);
+}
+
+Color4 ParticleStore::color(size_t index) const
+{
+  return Color4(_colorR[index], _colorG[index], _colorB[index], _colorA[index]);
+}
+
+float ParticleStore::age(size_t index) const
+{
+  return _age[index];
+}
+
+float ParticleStore::lifeTime(size_t index) const
+{
+  return _lifeTime[index];
+}
+
+float ParticleStore::particleSize(size_t index) const
+{
+  return _sizes[index];
+}
+
+float ParticleStore::angle(size_t index) const
+{
+  return _angle[index];
+}
+
+const char* ParticleStore::KernelName()
+{
+#if defined(BABYLON_PARTICLES_SSE2)
+  return "SSE2";
+#elif defined(BABYLON_PARTICLES_NEON)
+  return "NEON";
+#else
+  return "Scalar";
+#endif
+}
+
+} // end of namespace BABYLON
@@ -5,6 +5,7 @@
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/engines/scene.h>
@@ -34,15 +35,48 @@
 #include <babylon/particles/emittertypes/sphere_directed_particle_emitter.h>
 #include <babylon/particles/emittertypes/sphere_particle_emitter.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_store.h>
 #include <babylon/particles/sub_emitter.h>
 
 namespace BABYLON {
 
+namespace {
+
+// Number of particles per chunk of the update and vertex fill passes
+constexpr size_t SimulationChunkSize = 16384;
+// Number of new particles per chunk (and per random stream) of the emission
+constexpr size_t EmissionChunkSize = 1024;
+
+/**
+ * Splits the range [0, count) in chunks of chunkSize elements, processed by the thread pool when
+ * given. The chunk boundaries do not depend on the thread pool.
+ */
+void ForEachChunk(ThreadPool* threadPool, size_t count, size_t chunkSize,
+                  const std::function<void(size_t chunk, size_t begin, size_t end)>& func)
+{
+  if (threadPool && count > chunkSize) {
+    threadPool->parallelFor(count, chunkSize, func);
+    return;
+  }
+  for (size_t chunk = 0, begin = 0; begin < count; ++chunk, begin += chunkSize) {
+    func(chunk, begin, std::min(begin + chunkSize, count));
+  }
+}
+
+uint64_t EmissionSeed(uint32_t randomSeed, uint64_t emissionCounter)
+{
+  return (static_cast<uint64_t>(randomSeed) << 32) ^ emissionCounter;
+}
+
+} // end of anonymous namespace
+
 ParticleSystem::ParticleSystem(
   const std::string& iName, size_t capacity,
   const std::optional<std::variant<Scene*, ThinEngine*>>& sceneOrEngine,
   const EffectPtr& customEffect, bool iIsAnimationSheetEnabled, float epsilon)
     : BaseParticleSystem{iName}
+    , useParticleStore{false}
+    , randomSeed{0}
     , onDispose{this, &ParticleSystem::set_onDispose}
     , _currentEmitRateGradient{std::nullopt}
     , _currentEmitRate1{0.f}
@@ -52,9 +86,8 @@ ParticleSystem::ParticleSystem(
     , _currentStartSize2{0.f}
     , defaultViewMatrix{std::nullopt}
     , _disposeEmitterOnDispose{false}
-    , _newPartsExcess{0}
+    , _newPartsExcess{0.f}
     , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _colorDiff{Color4(0.f, 0.f, 0.f, 0.f)}
     , _scaledDirection{Vector3::Zero()}
     , _scaledGravity{Vector3::Zero()}
     , _currentRenderId{-1}
@@ -62,7 +95,7 @@ ParticleSystem::ParticleSystem(
     , _vertexArrayObject{nullptr}
     , _started{false}
     , _stopped{false}
-    , _actualFrame{0}
+    , _actualFrame{0.f}
     , _vertexBufferSize{11u}
     , _rawTextureWidth{256}
     , _rampGradientsTexture{nullptr}
@@ -70,6 +103,10 @@ ParticleSystem::ParticleSystem(
     , _appendParticleVertexes{nullptr}
     , _rootParticleSystem{nullptr}
     , _zeroVector3{Vector3::Zero()}
+    , _usingParticleStore{false}
+    , _animatePreWarmOnly{false}
+    , _animateNewParticles{0}
+    , _emissionCounter{0}
 {
   isLocal   = false;
   _capacity = capacity;
@@ -88,6 +125,7 @@ ParticleSystem::ParticleSystem(
     _engine                 = std::get<ThinEngine*>(*sceneOrEngine);
     defaultProjectionMatrix = Matrix::PerspectiveFovLH(0.8f, 1.f, 0.1f, 100.f);
   }
+  randomSeed = static_cast<uint32_t>(uniqueId);
 
   if (_engine->getCaps().vertexArrayObject) {
     _vertexArrayObject = nullptr;
@@ -118,7 +156,7 @@ ParticleSystem::ParticleSystem(
 
     for (unsigned int index = 0; index < _particles.size(); ++index) {
       auto particle          = particles[index];
-      auto scaledUpdateSpeed = static_cast<float>(_scaledUpdateSpeed);
+      auto scaledUpdateSpeed = _scaledUpdateSpeed;
       auto previousAge       = particle->age;
       particle->age += scaledUpdateSpeed;
 
@@ -328,12 +366,10 @@ ParticleSystem::ParticleSystem(
 
       // Recycle by swapping with last particle
       if (particle->age >= particle->lifeTime) {
-        _emitFromParticle(particle);
-        if (!particle->_attachedSubEmitters.empty()) {
-          for (auto& subEmitter : particle->_attachedSubEmitters) {
-            subEmitter->particleSystem->disposeOnStop = true;
-            subEmitter->particleSystem->stop();
-          }
+        // The sub-emitters are other systems, they are started and stopped on the render thread
+        // (see _endAnimate)
+        if (!_subEmitters.empty() || !particle->_attachedSubEmitters.empty()) {
+          _deadParticlesWithSubEmitters.emplace_back(*particle);
           particle->_attachedSubEmitters.clear();
         }
         recycleParticle(particle);
@@ -353,7 +389,12 @@ Type ParticleSystem::type() const
 
 size_t ParticleSystem::getActiveCount() const
 {
-  return _particles.size();
+  return _particles.size() + (_particleStore ? _particleStore->size() : 0);
+}
+
+std::vector<Particle*>& ParticleSystem::particles()
+{
+  return _particles;
 }
 
 std::string ParticleSystem::getClassName() const
@@ -762,7 +803,7 @@ void ParticleSystem::_createVertexBuffers()
 
   auto engine   = _engine;
   _vertexData   = Float32Array(_capacity * _vertexBufferSize * (_useInstancing ? 1 : 4));
-  _vertexBuffer = std::make_unique<Buffer>(engine, _vertexData, true, _vertexBufferSize);
+  _vertexBuffer = std::make_shared<Buffer>(engine, _vertexData, true, _vertexBufferSize);
 
   size_t dataOffset = 0;
   auto positions    = _vertexBuffer->createVertexBuffer(VertexBuffer::PositionKind, dataOffset, 3,
@@ -809,7 +850,7 @@ void ParticleSystem::_createVertexBuffers()
   std::unique_ptr<VertexBuffer> offsets = nullptr;
   if (_useInstancing) {
     Float32Array spriteData{0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 1.f};
-    _spriteBuffer = std::make_unique<Buffer>(engine, spriteData, false, 2);
+    _spriteBuffer = std::make_shared<Buffer>(engine, spriteData, false, 2);
     offsets       = _spriteBuffer->createVertexBuffer(VertexBuffer::OffsetKind, 0, 2);
   }
   else {
@@ -940,6 +981,9 @@ void ParticleSystem::reset()
 {
   _stockParticles.clear();
   _particles.clear();
+  if (_particleStore) {
+    _particleStore->clear();
+  }
 }
 
 void ParticleSystem::_appendParticleVertex(unsigned int index, Particle* particle, int offsetX,
@@ -1104,11 +1148,8 @@ void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
 #endif
 }
 
-void ParticleSystem::_update(int newParticles)
+void ParticleSystem::_updateEmitterWorldMatrix()
 {
-  // Update current
-  _alive = !_particles.empty();
-
   if (std::holds_alternative<AbstractMeshPtr>(emitter)) {
     auto emitterMesh    = std::get<AbstractMeshPtr>(emitter);
     _emitterWorldMatrix = emitterMesh->getWorldMatrix();
@@ -1118,238 +1159,323 @@ void ParticleSystem::_update(int newParticles)
     _emitterWorldMatrix
       = Matrix::Translation(emitterPosition.x, emitterPosition.y, emitterPosition.z);
   }
+}
+
+void ParticleSystem::_update(int newParticles, ThreadPool* threadPool)
+{
+  // Switching between the Particle objects and the store drops the active particles
+  const auto useStore = _canUseParticleStore();
+  if (useStore != _usingParticleStore) {
+    reset();
+    _usingParticleStore = useStore;
+  }
+
+  // Update current
+  _alive = getActiveCount() > 0;
+
+  ++_emissionCounter;
+
+  if (_usingParticleStore) {
+    _updateParticleStore(newParticles, threadPool);
+    return;
+  }
 
   updateFunction(_particles);
 
-  // Add new ones
-  Particle* particle = nullptr;
-  for (int index = 0; index < newParticles; ++index) {
-    if (_particles.size() == _capacity) {
-      break;
+  // Add new ones, the chunks are processed in order as they share the stock of particles
+  const auto count = std::min(static_cast<size_t>(std::max(newParticles, 0)),
+                              _capacity - std::min(_particles.size(), _capacity));
+  const auto seed  = EmissionSeed(randomSeed, _emissionCounter);
+  ForEachChunk(nullptr, count, EmissionChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+    Math::RandomStream stream(seed, chunk);
+    Math::RandomStreamScope scope(stream);
+    for (auto index = begin; index < end; ++index) {
+      auto particle = _createParticle();
+
+      _particles.emplace_back(particle);
+
+      _initializeParticle(particle);
     }
+  });
+}
 
-    particle = _createParticle();
+bool ParticleSystem::_canUseParticleStore()
+{
+  return useParticleStore && !noiseTexture() && !_isLocal && !_isAnimationSheetEnabled
+         && !_useRampGradients;
+}
+
+bool ParticleSystem::_canEmitInParallel() const
+{
+  // User callbacks and the start size gradients (whose state is shared by the new particles) keep
+  // the emission on a single thread, the built-in emitters keep their per particle state in the
+  // particle
+  const auto customEmitter
+    = particleEmitterType && particleEmitterType->getClassName() == "CustomParticleEmitter";
+  return !startPositionFunction && !startDirectionFunction && !customEmitter
+         && (_startSizeGradients.empty() || !targetStopDuration);
+}
+
+void ParticleSystem::_updateParticleStore(int newParticles, ThreadPool* threadPool)
+{
+  if (!_particleStore) {
+    _particleStore = std::make_unique<ParticleStore>();
+  }
+  auto& store = *_particleStore;
+  if (store.capacity() != _capacity) {
+    store.setCapacity(_capacity);
+  }
+
+  // The lookup tables are cheap to rebuild compared to the update of the particles
+  store.setColorGradients(_colorGradients);
+  store.setSizeGradients(_sizeGradients);
+  store.setAngularSpeedGradients(_angularSpeedGradients);
+  store.setVelocityGradients(_velocityGradients);
+  store.setLimitVelocityGradients(_limitVelocityGradients, limitVelocityDamping);
+  store.setDragGradients(_dragGradients);
+
+  ParticleStoreUpdate update;
+  update.updateSpeed = _scaledUpdateSpeed;
+  update.gravity     = gravity;
+  ForEachChunk(threadPool, store.size(), SimulationChunkSize,
+               [&](size_t /*chunk*/, size_t begin, size_t end) {
+                 store.update(update, begin, end);
+               });
+  store.removeDeadParticles();
+
+  // Add new ones, initialized by the emitters like the Particle objects
+  const auto first = store.size();
+  const auto count = store.grow(static_cast<size_t>(std::max(newParticles, 0)));
+  const auto seed  = EmissionSeed(randomSeed, _emissionCounter);
+  ForEachChunk(_canEmitInParallel() ? threadPool : nullptr, count, EmissionChunkSize,
+               [&](size_t chunk, size_t begin, size_t end) {
+                 Math::RandomStream stream(seed, chunk);
+                 Math::RandomStreamScope scope(stream);
+                 Particle particle(this);
+                 for (auto index = begin; index < end; ++index) {
+                   particle._reset();
+                   _initializeParticle(&particle);
+                   store.set(first + index, particle, Math::random());
+                 }
+               });
+}
+
+void ParticleSystem::_initializeParticle(Particle* particle)
+{
+  // Life time
+  if (targetStopDuration && !_lifeTimeGradients.empty()) {
+    auto ratio = static_cast<float>(Scalar::Clamp(_actualFrame / targetStopDuration));
+    GradientHelper::GetCurrentGradient<FactorGradient>(
+      ratio, _lifeTimeGradients,
+      [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+          float /*scale*/) {
+        auto& factorGradient1 = currentGradient;
+        auto& factorGradient2 = nextGradient;
+        auto lifeTime1        = factorGradient1.getFactor();
+        auto lifeTime2        = factorGradient2.getFactor();
+        auto gradient         = (ratio - factorGradient1.gradient)
+                        / (factorGradient2.gradient - factorGradient1.gradient);
+        particle->lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
+      });
+  }
+  else {
+    particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+  }
 
-    _particles.emplace_back(particle);
+  // Emitter
+  auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
 
-    // Life time
-    if (targetStopDuration && !_lifeTimeGradients.empty()) {
-      auto ratio = static_cast<float>(Scalar::Clamp(_actualFrame / targetStopDuration));
-      GradientHelper::GetCurrentGradient<FactorGradient>(
-        ratio, _lifeTimeGradients,
-        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-            float /*scale*/) {
-          auto& factorGradient1 = currentGradient;
-          auto& factorGradient2 = nextGradient;
-          auto lifeTime1        = factorGradient1.getFactor();
-          auto lifeTime2        = factorGradient2.getFactor();
-          auto gradient         = (ratio - factorGradient1.gradient)
-                          / (factorGradient2.gradient - factorGradient1.gradient);
-          particle->lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
-        });
+  if (startPositionFunction) {
+    startPositionFunction(_emitterWorldMatrix, particle->position, particle, isLocal);
+  }
+  else {
+    particleEmitterType->startPositionFunction(_emitterWorldMatrix, particle->position, particle,
+                                               isLocal);
+  }
+
+  if (isLocal) {
+    if (!particle->_localPosition) {
+      particle->_localPosition = particle->position;
     }
     else {
-      particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+      particle->_localPosition->copyFrom(particle->position);
+    }
+    if (particle->_localPosition) {
+      Vector3::TransformCoordinatesToRef(*particle->_localPosition, _emitterWorldMatrix,
+                                         particle->position);
     }
+  }
 
-    // Emitter
-    auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
+  if (startDirectionFunction) {
+    startDirectionFunction(_emitterWorldMatrix, particle->direction, particle, isLocal);
+  }
+  else {
+    particleEmitterType->startDirectionFunction(_emitterWorldMatrix, particle->direction,
+                                                particle, isLocal);
+  }
 
-    if (startPositionFunction) {
-      startPositionFunction(_emitterWorldMatrix, particle->position, particle, isLocal);
+  if (emitPower == 0.f) {
+    if (!particle->_initialDirection) {
+      particle->_initialDirection = particle->direction;
     }
     else {
-      particleEmitterType->startPositionFunction(_emitterWorldMatrix, particle->position, particle,
-                                                 isLocal);
+      particle->_initialDirection = particle->direction;
     }
+  }
+  else {
+    particle->_initialDirection = std::nullopt;
+  }
 
-    if (isLocal) {
-      if (!particle->_localPosition) {
-        particle->_localPosition = particle->position;
-      }
-      else {
-        particle->_localPosition->copyFrom(particle->position);
-      }
-      if (particle->_localPosition) {
-        Vector3::TransformCoordinatesToRef(*particle->_localPosition, _emitterWorldMatrix,
-                                           particle->position);
-      }
-    }
+  particle->direction.scaleInPlace(emitPower);
+
+  // Size
+  if (_sizeGradients.empty()) {
+    particle->size = Scalar::RandomRange(minSize, maxSize);
+  }
+  else {
+    particle->_currentSizeGradient = _sizeGradients[0];
+    particle->_currentSize1        = (*particle->_currentSizeGradient).getFactor();
+    particle->size                 = particle->_currentSize1;
 
-    if (startDirectionFunction) {
-      startDirectionFunction(_emitterWorldMatrix, particle->direction, particle, isLocal);
+    if (_sizeGradients.size() > 1) {
+      particle->_currentSize2 = _sizeGradients[1].getFactor();
     }
     else {
-      particleEmitterType->startDirectionFunction(_emitterWorldMatrix, particle->direction,
-                                                  particle, isLocal);
+      particle->_currentSize2 = particle->_currentSize1;
     }
+  }
+  // Size and scale
+  particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
+                                 Scalar::RandomRange(minScaleY, maxScaleY));
+
+  // Adjust scale by start size
+  if (!_startSizeGradients.empty() && targetStopDuration) {
+    auto ratio = _actualFrame / static_cast<float>(targetStopDuration);
+    GradientHelper::GetCurrentGradient<FactorGradient>(
+      ratio, _startSizeGradients,
+      [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient, float scale) {
+        if (currentGradient != _currentStartSizeGradient) {
+          _currentStartSize1        = _currentStartSize2;
+          _currentStartSize2        = nextGradient.getFactor();
+          _currentStartSizeGradient = currentGradient;
+        }
 
-    if (emitPower == 0.f) {
-      if (!particle->_initialDirection) {
-        particle->_initialDirection = particle->direction;
-      }
-      else {
-        particle->_initialDirection = particle->direction;
-      }
+        auto value = Scalar::Lerp(_currentStartSize1, _currentStartSize2, scale);
+        particle->scale.scaleInPlace(value);
+      });
+  }
+
+  // Angle
+  if (_angularSpeedGradients.empty()) {
+    particle->angularSpeed = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+  }
+  else {
+    particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
+    particle->angularSpeed          = (*particle->_currentAngularSpeedGradient).getFactor();
+    particle->_currentAngularSpeed1 = particle->angularSpeed;
+
+    if (_angularSpeedGradients.size() > 1) {
+      particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
     }
     else {
-      particle->_initialDirection = std::nullopt;
+      particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
     }
+  }
+  particle->angle = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
 
-    particle->direction.scaleInPlace(emitPower);
+  // Velocity
+  if (!_velocityGradients.empty()) {
+    particle->_currentVelocityGradient = _velocityGradients[0];
+    particle->_currentVelocity1        = (*particle->_currentVelocityGradient).getFactor();
 
-    // Size
-    if (!_sizeGradients.empty()) {
-      particle->size = Scalar::RandomRange(minSize, maxSize);
+    if (_velocityGradients.size() > 1) {
+      particle->_currentVelocity2 = _velocityGradients[1].getFactor();
     }
     else {
-      particle->_currentSizeGradient = _sizeGradients[0];
-      particle->_currentSize1        = (*particle->_currentSizeGradient).getFactor();
-      particle->size                 = particle->_currentSize1;
-
-      if (_sizeGradients.size() > 1) {
-        particle->_currentSize2 = _sizeGradients[1].getFactor();
-      }
-      else {
-        particle->_currentSize2 = particle->_currentSize1;
-      }
+      particle->_currentVelocity2 = particle->_currentVelocity1;
     }
-    // Size and scale
-    particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
-                                   Scalar::RandomRange(minScaleY, maxScaleY));
-
-    // Adjust scale by start size
-    if (!_startSizeGradients.empty() && targetStopDuration) {
-      auto ratio = static_cast<float>(_actualFrame) / static_cast<float>(targetStopDuration);
-      GradientHelper::GetCurrentGradient<FactorGradient>(
-        ratio, _startSizeGradients,
-        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-            float scale) {
-          if (currentGradient != _currentStartSizeGradient) {
-            _currentStartSize1        = _currentStartSize2;
-            _currentStartSize2        = nextGradient.getFactor();
-            _currentStartSizeGradient = currentGradient;
-          }
+  }
 
-          auto value = Scalar::Lerp(_currentStartSize1, _currentStartSize2, scale);
-          particle->scale.scaleInPlace(value);
-        });
-    }
+  // Limit velocity
+  if (!_limitVelocityGradients.empty()) {
+    particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
+    particle->_currentLimitVelocity1 = particle->_currentLimitVelocityGradient->getFactor();
 
-    // Angle
-    if (!_angularSpeedGradients.empty()) {
-      particle->angularSpeed = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+    if (_limitVelocityGradients.size() > 1) {
+      particle->_currentLimitVelocity2 = _limitVelocityGradients[1].getFactor();
     }
     else {
-      particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
-      particle->angularSpeed          = (*particle->_currentAngularSpeedGradient).getFactor();
-      particle->_currentAngularSpeed1 = particle->angularSpeed;
-
-      if (_angularSpeedGradients.size() > 1) {
-        particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
-      }
-      else {
-        particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
-      }
+      particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
     }
-    particle->angle = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
+  }
 
-    // Velocity
-    if (!_velocityGradients.empty()) {
-      particle->_currentVelocityGradient = _velocityGradients[0];
-      particle->_currentVelocity1        = (*particle->_currentVelocityGradient).getFactor();
+  // Drag
+  if (!_dragGradients.empty()) {
+    particle->_currentDragGradient = _dragGradients[0];
+    particle->_currentDrag1        = particle->_currentDragGradient->getFactor();
 
-      if (_velocityGradients.size() > 1) {
-        particle->_currentVelocity2 = _velocityGradients[1].getFactor();
-      }
-      else {
-        particle->_currentVelocity2 = particle->_currentVelocity1;
-      }
+    if (_dragGradients.size() > 1) {
+      particle->_currentDrag2 = _dragGradients[1].getFactor();
     }
-
-    // Limit velocity
-    if (!_limitVelocityGradients.empty()) {
-      particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
-      particle->_currentLimitVelocity1 = particle->_currentLimitVelocityGradient->getFactor();
-
-      if (_limitVelocityGradients.size() > 1) {
-        particle->_currentLimitVelocity2 = _limitVelocityGradients[1].getFactor();
-      }
-      else {
-        particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
-      }
+    else {
+      particle->_currentDrag2 = particle->_currentDrag1;
     }
+  }
 
-    // Drag
-    if (_dragGradients.empty()) {
-      particle->_currentDragGradient = _dragGradients[0];
-      particle->_currentDrag1        = particle->_currentDragGradient->getFactor();
-
-      if (_dragGradients.size() > 1) {
-        particle->_currentDrag2 = _dragGradients[1].getFactor();
-      }
-      else {
-        particle->_currentDrag2 = particle->_currentDrag1;
-      }
-    }
+  // Color
+  if (_colorGradients.empty()) {
+    auto step = Scalar::RandomRange(0.f, 1.f);
 
-    // Color
-    if (_colorGradients.empty()) {
-      auto step = Scalar::RandomRange(0.f, 1.f);
+    Color4::LerpToRef(color1, color2, step, particle->color);
 
-      Color4::LerpToRef(color1, color2, step, particle->color);
+    Color4 colorDiff;
+    colorDead.subtractToRef(particle->color, colorDiff);
+    colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+  }
+  else {
+    auto currentColorGradient = _colorGradients[0];
+    currentColorGradient.getColorToRef(particle->color);
+    particle->_currentColorGradient = currentColorGradient;
+    particle->_currentColor1.copyFrom(particle->color);
 
-      colorDead.subtractToRef(particle->color, _colorDiff);
-      _colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+    if (_colorGradients.size() > 1) {
+      _colorGradients[1].getColorToRef(particle->_currentColor2);
     }
     else {
-      auto currentColorGradient = _colorGradients[0];
-      currentColorGradient.getColorToRef(particle->color);
-      particle->_currentColorGradient = currentColorGradient;
-      particle->_currentColor1.copyFrom(particle->color);
-
-      if (_colorGradients.size() > 1) {
-        _colorGradients[1].getColorToRef(particle->_currentColor2);
-      }
-      else {
-        particle->_currentColor2.copyFrom(particle->color);
-      }
+      particle->_currentColor2.copyFrom(particle->color);
     }
+  }
 
-    // Sheet
-    if (_isAnimationSheetEnabled) {
-      particle->_initialStartSpriteCellID = startSpriteCellID;
-      particle->_initialEndSpriteCellID   = endSpriteCellID;
-    }
+  // Sheet
+  if (_isAnimationSheetEnabled) {
+    particle->_initialStartSpriteCellID = startSpriteCellID;
+    particle->_initialEndSpriteCellID   = endSpriteCellID;
+  }
 
-    // Inherited Velocity
-    particle->direction.addInPlace(_inheritedVelocityOffset);
+  // Inherited Velocity
+  particle->direction.addInPlace(_inheritedVelocityOffset);
 
-    // Ramp
-    if (_useRampGradients) {
-      particle->remapData = Vector4(0.f, 1.f, 0.f, 1.f);
-    }
+  // Ramp
+  if (_useRampGradients) {
+    particle->remapData = Vector4(0.f, 1.f, 0.f, 1.f);
+  }
 
-    // Noise texture coordinates
-    if (noiseTexture()) {
-      if (particle->_randomNoiseCoordinates1.has_value()) {
-        particle->_randomNoiseCoordinates1->copyFromFloats(Math::random(), Math::random(),
-                                                           Math::random());
-        particle->_randomNoiseCoordinates2.copyFromFloats(Math::random(), Math::random(),
-                                                          Math::random());
-      }
-      else {
-        particle->_randomNoiseCoordinates1
-          = Vector3(Math::random(), Math::random(), Math::random());
-        particle->_randomNoiseCoordinates2
-          = Vector3(Math::random(), Math::random(), Math::random());
-      }
+  // Noise texture coordinates
+  if (noiseTexture()) {
+    if (particle->_randomNoiseCoordinates1.has_value()) {
+      particle->_randomNoiseCoordinates1->copyFromFloats(Math::random(), Math::random(),
+                                                         Math::random());
+      particle->_randomNoiseCoordinates2.copyFromFloats(Math::random(), Math::random(),
+                                                        Math::random());
+    }
+    else {
+      particle->_randomNoiseCoordinates1 = Vector3(Math::random(), Math::random(), Math::random());
+      particle->_randomNoiseCoordinates2 = Vector3(Math::random(), Math::random(), Math::random());
     }
-
-    // Update the position of the attached sub-emitters to match their attached
-    // particle
-    particle->_inheritParticleInfoToSubEmitters();
   }
+
+  // Update the position of the attached sub-emitters to match their attached particle
+  particle->_inheritParticleInfoToSubEmitters();
 }
 
 std::vector<std::string> ParticleSystem::_GetAttributeNamesOrOptions(bool iIsAnimationSheetEnabled,
@@ -1507,39 +1633,48 @@ EffectPtr ParticleSystem::_getEffect(unsigned int iBlendMode)
 }
 
 void ParticleSystem::animate(bool preWarmOnly)
+{
+  if (_beginAnimate(preWarmOnly)) {
+    _simulateAnimate();
+    _endAnimate();
+  }
+}
+
+bool ParticleSystem::_beginAnimate(bool preWarmOnly)
 {
   if (!_started) {
-    return;
+    return false;
   }
 
   if (!preWarmOnly && _scene) {
     // Check
     if (!isReady()) {
-      return;
+      return false;
     }
 
     if (_currentRenderId == _scene->getFrameId()) {
-      return;
+      return false;
     }
     _currentRenderId = _scene->getFrameId();
   }
 
-  _scaledUpdateSpeed = static_cast<int>(
-    updateSpeed * (preWarmOnly ? preWarmStepOffset : (_scene ? _scene->getAnimationRatio() : 1.f)));
+  const auto stepRatio = preWarmOnly ? static_cast<float>(preWarmStepOffset) :
+                                       (_scene ? _scene->getAnimationRatio() : 1.f);
+  _scaledUpdateSpeed   = updateSpeed * stepRatio;
 
   // Determine the number of particles we need to create
   auto newParticles = 0;
 
   if (manualEmitCount > -1) {
     newParticles    = manualEmitCount;
-    _newPartsExcess = 0;
+    _newPartsExcess = 0.f;
     manualEmitCount = 0;
   }
   else {
     auto rate = static_cast<float>(emitRate);
 
     if (!_emitRateGradients.empty() && targetStopDuration) {
-      auto ratio = static_cast<float>(_actualFrame) / static_cast<float>(targetStopDuration);
+      auto ratio = _actualFrame / static_cast<float>(targetStopDuration);
       GradientHelper::GetCurrentGradient<FactorGradient>(
         ratio, _emitRateGradients,
         [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
@@ -1555,12 +1690,12 @@ void ParticleSystem::animate(bool preWarmOnly)
     }
 
     newParticles = static_cast<int>(rate * _scaledUpdateSpeed);
-    _newPartsExcess += static_cast<int>(rate * _scaledUpdateSpeed - newParticles);
+    _newPartsExcess += rate * _scaledUpdateSpeed - static_cast<float>(newParticles);
   }
 
-  if (_newPartsExcess > 1) {
-    newParticles += _newPartsExcess >> 0;
-    _newPartsExcess -= _newPartsExcess >> 0;
+  if (_newPartsExcess > 1.f) {
+    newParticles += static_cast<int>(_newPartsExcess);
+    _newPartsExcess -= std::floor(_newPartsExcess);
   }
 
   _alive = false;
@@ -1568,14 +1703,66 @@ void ParticleSystem::animate(bool preWarmOnly)
   if (!_stopped) {
     _actualFrame += _scaledUpdateSpeed;
 
-    if (targetStopDuration && _actualFrame >= targetStopDuration) {
+    if (targetStopDuration && _actualFrame >= static_cast<float>(targetStopDuration)) {
       stop();
     }
   }
   else {
     newParticles = 0;
   }
-  _update(newParticles);
+
+  // The emitter mesh may be shared with other systems simulated concurrently
+  _updateEmitterWorldMatrix();
+
+  _animatePreWarmOnly  = preWarmOnly;
+  _animateNewParticles = newParticles;
+  return true;
+}
+
+void ParticleSystem::_simulateAnimate(ThreadPool* threadPool)
+{
+  _update(_animateNewParticles, threadPool);
+
+  if (_animatePreWarmOnly) {
+    return;
+  }
+
+  // Update VBO
+  if (_usingParticleStore && _particleStore) {
+    ParticleStoreVertexLayout layout;
+    layout.vertexSize       = _vertexBufferSize;
+    layout.useInstancing    = _useInstancing;
+    layout.direction        = !_isBillboardBased || billboardMode == BILLBOARDMODE_STRETCHED;
+    layout.initialDirection = !_isBillboardBased;
+    layout.worldOffset      = worldOffset;
+    ForEachChunk(threadPool, _particleStore->size(), SimulationChunkSize,
+                 [&](size_t /*chunk*/, size_t begin, size_t end) {
+                   _particleStore->fillVertexData(_vertexData.data(), layout, begin, end);
+                 });
+  }
+  else {
+    const auto verticesPerParticle = _useInstancing ? 1u : 4u;
+    ForEachChunk(threadPool, _particles.size(), SimulationChunkSize,
+                 [&](size_t /*chunk*/, size_t begin, size_t end) {
+                   for (auto index = begin; index < end; ++index) {
+                     _appendParticleVertices(static_cast<unsigned int>(index) * verticesPerParticle,
+                                             _particles[index]);
+                   }
+                 });
+  }
+}
+
+void ParticleSystem::_endAnimate()
+{
+  // Sub-emitters of the particles which died during the update
+  for (auto& particle : _deadParticlesWithSubEmitters) {
+    _emitFromParticle(&particle);
+    for (auto& subEmitter : particle._attachedSubEmitters) {
+      subEmitter->particleSystem->disposeOnStop = true;
+      subEmitter->particleSystem->stop();
+    }
+  }
+  _deadParticlesWithSubEmitters.clear();
 
   // Stopped?
   if (_stopped) {
@@ -1590,14 +1777,7 @@ void ParticleSystem::animate(bool preWarmOnly)
     }
   }
 
-  if (!preWarmOnly) {
-    // Update VBO
-    unsigned int offset = 0;
-    for (auto& particle : _particles) {
-      _appendParticleVertices(offset, particle);
-      offset += _useInstancing ? 1 : 4;
-    }
-
+  if (!_animatePreWarmOnly) {
     if (_vertexBuffer) {
       _vertexBuffer->update(_vertexData);
     }
@@ -1608,6 +1788,21 @@ void ParticleSystem::animate(bool preWarmOnly)
   }
 }
 
+bool ParticleSystem::_canSimulateOnWorkerThread()
+{
+  return !noiseTexture();
+}
+
+const Float32Array& ParticleSystem::_getVertexData() const
+{
+  return _vertexData;
+}
+
+const ParticleStore* ParticleSystem::_getParticleStore() const
+{
+  return _usingParticleStore ? _particleStore.get() : nullptr;
+}
+
 void ParticleSystem::_appendParticleVertices(unsigned int offset, Particle* particle)
 {
   _appendParticleVertex(offset++, particle, 0, 0);
@@ -1633,7 +1828,7 @@ void ParticleSystem::rebuild()
 
 bool ParticleSystem::isReady()
 {
-  if (!std::holds_alternative<AbstractMeshPtr>(emitter) || !std::holds_alternative<Vector3>(emitter)
+  if ((std::holds_alternative<AbstractMeshPtr>(emitter) && !std::get<AbstractMeshPtr>(emitter))
       || (_imageProcessingConfiguration && !_imageProcessingConfiguration->isReady())
       || !particleTexture || !particleTexture->isReady()) {
     return false;
@@ -1746,22 +1941,23 @@ size_t ParticleSystem::_render(unsigned int iBlendMode)
     _onBeforeDrawParticlesObservable.notifyObservers(effect.get());
   }
 
+  const auto activeCount = getActiveCount();
   if (_useInstancing) {
     engine->drawArraysType(Constants::MATERIAL_TriangleStripDrawMode, 0, 4,
-                           static_cast<int>(_particles.size()));
+                           static_cast<int>(activeCount));
   }
   else {
     engine->drawElementsType(Constants::MATERIAL_TriangleFillMode, 0,
-                             static_cast<int>(_particles.size() * 6));
+                             static_cast<int>(activeCount * 6));
   }
 
-  return _particles.size();
+  return activeCount;
 }
 
 size_t ParticleSystem::render(bool /*preWarm*/)
 {
   // Check
-  if (!isReady() || !_particles.empty()) {
+  if (!isReady() || getActiveCount() == 0) {
     return 0;
   }
 
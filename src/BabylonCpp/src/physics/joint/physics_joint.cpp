@@ -9,6 +9,8 @@ PhysicsJoint::PhysicsJoint(unsigned int iJointType, const PhysicsJointData& iJoi
     , jointData{iJointData}
     , physicsJoint{this, &PhysicsJoint::get_physicsJoint, &PhysicsJoint::set_physicsJoint}
     , physicsPlugin{this, &PhysicsJoint::set_physicsPlugin}
+    , _physicsPlugin{nullptr}
+    , _physicsJoint{nullptr}
 {
 }
 
@@ -59,7 +59,9 @@ float PhysicsEngine::getSubTimeStep() const
 
 void PhysicsEngine::dispose()
 {
-  for (const auto& impostor : _impostors) {
+  // Disposed impostors remove themselves from the engine
+  const auto impostors = _impostors;
+  for (const auto& impostor : impostors) {
     impostor->dispose();
   }
   _physicsPlugin->dispose();
@@ -72,7 +74,8 @@ std::string PhysicsEngine::getPhysicsPluginName() const
 
 void PhysicsEngine::addImpostor(PhysicsImpostor* impostor)
 {
-  _impostors.emplace_back(impostor);
+  // The impostors are owned by their objects
+  _impostors.emplace_back(PhysicsImpostorPtr(impostor, [](PhysicsImpostor*) {}));
   impostor->uniqueId = _impostors.size();
   // if no parent, generate the body
   if (!impostor->parent()) {
@@ -125,7 +128,7 @@ void PhysicsEngine::removeJoint(PhysicsImpostor* mainImpostor, PhysicsImpostor*
   }
 }
 
-void PhysicsEngine::_step(float /*delta*/)
+void PhysicsEngine::_step(float delta)
 {
   // check if any mesh has no body / requires an update
   for (const auto& impostor : _impostors) {
@@ -134,7 +137,6 @@ void PhysicsEngine::_step(float /*delta*/)
     }
   }
 
-#if 0
   if (delta > 0.1f) {
     delta = 0.1f;
   }
@@ -143,7 +145,6 @@ void PhysicsEngine::_step(float /*delta*/)
   }
 
   _physicsPlugin->executeStep(delta, _impostors);
-#endif
 }
 
 IPhysicsEnginePlugin* PhysicsEngine::getPhysicsPlugin()
@@ -44,8 +44,10 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
     , parent{this, &PhysicsImpostor::get_parent, &PhysicsImpostor::set_parent}
     , _options{options}
     , _scene{scene}
+    , _physicsBody{nullptr}
     , _bodyUpdateRequired{false}
     , _deltaPosition{Vector3::Zero()}
+    , _parent{nullptr}
     , _isDisposed{false}
     , nullPhysicsImpostor{nullptr}
 {
@@ -116,7 +118,12 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
   }
 }
 
-PhysicsImpostor::~PhysicsImpostor() = default;
+PhysicsImpostor::~PhysicsImpostor()
+{
+  if (_physicsEngine && !_isDisposed) {
+    _physicsEngine->removeImpostor(this);
+  }
+}
 
 void PhysicsImpostor::_init()
 {
@@ -134,7 +141,7 @@ void PhysicsImpostor::_init()
 
 PhysicsImpostorPtr PhysicsImpostor::_getPhysicsParent()
 {
-  if (object->parent()->type() == Type::ABSTRACTMESH) {
+  if (object->parent() && object->parent()->type() == Type::ABSTRACTMESH) {
     auto parentMesh = static_cast<AbstractMesh*>(object->parent());
     return parentMesh->physicsImpostor();
   }
@@ -363,7 +370,7 @@ void PhysicsImpostor::set_positionIterations(size_t value)
 
 void PhysicsImpostor::setMass(float iMass)
 {
-  if (stl_util::almost_equal(getParam("mass"), iMass)) {
+  if (!stl_util::almost_equal(getParam("mass"), iMass)) {
     setParam("mass", iMass);
   }
   if (_physicsEngine) {
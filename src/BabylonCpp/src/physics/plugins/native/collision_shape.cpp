@@ -0,0 +1,645 @@
+#include <babylon/physics/plugins/native/collision_shape.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct HullTriangle {
+  std::array<uint32_t, 3> vertices;
+  Vector3 normal;
+  float offset;
+};
+
+HullTriangle MakeHullTriangle(const std::vector<Vector3>& points, uint32_t a, uint32_t b,
+                              uint32_t c)
+{
+  auto normal = Vector3::Cross(points[b].subtract(points[a]), points[c].subtract(points[a]));
+  normal.normalize();
+  return HullTriangle{{{a, b, c}}, normal, Vector3::Dot(normal, points[a])};
+}
+
+float MaxAbsCoordinate(const std::vector<Vector3>& points)
+{
+  auto maxAbs = 0.f;
+  for (const auto& point : points) {
+    maxAbs = std::max({maxAbs, std::abs(point.x), std::abs(point.y), std::abs(point.z)});
+  }
+  return maxAbs;
+}
+
+/**
+ * @brief Incremental 3D convex hull, returns the outward oriented triangles of the hull (empty
+ * when the points are coplanar).
+ */
+std::vector<HullTriangle> ComputeHullTriangles(const std::vector<Vector3>& points, float epsilon)
+{
+  std::vector<HullTriangle> triangles;
+  const auto count = static_cast<uint32_t>(points.size());
+  if (count < 4) {
+    return triangles;
+  }
+
+  // Initial tetrahedron: the farthest pair of extreme points, the farthest point from their line
+  // and the farthest point from their plane
+  std::array<uint32_t, 6> extremes{};
+  for (uint32_t i = 0; i < count; ++i) {
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      if (points[i][axis] < points[extremes[axis * 2]][axis]) {
+        extremes[axis * 2] = i;
+      }
+      if (points[i][axis] > points[extremes[axis * 2 + 1]][axis]) {
+        extremes[axis * 2 + 1] = i;
+      }
+    }
+  }
+  uint32_t i0 = 0, i1 = 0;
+  auto maxDistance = -1.f;
+  for (const auto a : extremes) {
+    for (const auto b : extremes) {
+      const auto distance = Vector3::DistanceSquared(points[a], points[b]);
+      if (distance > maxDistance) {
+        maxDistance = distance;
+        i0          = a;
+        i1          = b;
+      }
+    }
+  }
+  if (maxDistance <= epsilon * epsilon) {
+    return triangles;
+  }
+
+  const auto lineDirection = points[i1].subtract(points[i0]).normalize();
+  uint32_t i2              = i0;
+  maxDistance              = 0.f;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto distance
+      = Vector3::Cross(points[i].subtract(points[i0]), lineDirection).lengthSquared();
+    if (distance > maxDistance) {
+      maxDistance = distance;
+      i2          = i;
+    }
+  }
+  if (maxDistance <= epsilon * epsilon) {
+    return triangles;
+  }
+
+  const auto base = MakeHullTriangle(points, i0, i1, i2);
+  uint32_t i3     = i0;
+  maxDistance     = 0.f;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto distance = std::abs(Vector3::Dot(base.normal, points[i]) - base.offset);
+    if (distance > maxDistance) {
+      maxDistance = distance;
+      i3          = i;
+    }
+  }
+  if (maxDistance <= epsilon) {
+    return triangles;
+  }
+
+  // Outward orientation: the fourth point is below the base
+  if (Vector3::Dot(base.normal, points[i3]) - base.offset > 0.f) {
+    std::swap(i1, i2);
+  }
+  triangles = {MakeHullTriangle(points, i0, i1, i2), MakeHullTriangle(points, i0, i3, i1),
+               MakeHullTriangle(points, i1, i3, i2), MakeHullTriangle(points, i2, i3, i0)};
+
+  std::vector<uint64_t> visibleEdges;
+  std::vector<std::pair<uint32_t, uint32_t>> horizon;
+  std::vector<HullTriangle> keptTriangles;
+  for (uint32_t i = 0; i < count; ++i) {
+    if (i == i0 || i == i1 || i == i2 || i == i3) {
+      continue;
+    }
+    const auto& point = points[i];
+
+    // Directed edges of the triangles seeing the point
+    visibleEdges.clear();
+    keptTriangles.clear();
+    for (const auto& triangle : triangles) {
+      if (Vector3::Dot(triangle.normal, point) - triangle.offset > epsilon) {
+        for (size_t j = 0; j < 3; ++j) {
+          const uint64_t a = triangle.vertices[j], b = triangle.vertices[(j + 1) % 3];
+          visibleEdges.emplace_back((a << 32) | b);
+        }
+      }
+      else {
+        keptTriangles.emplace_back(triangle);
+      }
+    }
+    if (visibleEdges.empty()) {
+      continue;
+    }
+
+    // The horizon is made of the visible edges whose twin is not visible
+    std::sort(visibleEdges.begin(), visibleEdges.end());
+    horizon.clear();
+    for (const auto edge : visibleEdges) {
+      const auto a    = static_cast<uint32_t>(edge >> 32);
+      const auto b    = static_cast<uint32_t>(edge & 0xffffffff);
+      const auto twin = (static_cast<uint64_t>(b) << 32) | a;
+      if (!std::binary_search(visibleEdges.begin(), visibleEdges.end(), twin)) {
+        horizon.emplace_back(a, b);
+      }
+    }
+
+    triangles.swap(keptTriangles);
+    for (const auto& [a, b] : horizon) {
+      triangles.emplace_back(MakeHullTriangle(points, a, b, i));
+    }
+  }
+
+  return triangles;
+}
+
+/**
+ * @brief Orders the points of a face counter clockwise around its normal, dropping the points
+ * which are not corners (Andrew's monotone chain in the plane of the face).
+ */
+std::vector<uint32_t> OrderFaceVertices(const std::vector<Vector3>& points,
+                                        std::vector<uint32_t> face, const Vector3& normal)
+{
+  const auto reference = std::abs(normal.x) < 0.57f ? Vector3(1.f, 0.f, 0.f) :
+                                                      Vector3(0.f, 1.f, 0.f);
+  const auto u = Vector3::Cross(reference, normal).normalize();
+  const auto v = Vector3::Cross(normal, u);
+  const auto project = [&](uint32_t index) {
+    return std::make_pair(Vector3::Dot(points[index], u), Vector3::Dot(points[index], v));
+  };
+
+  std::sort(face.begin(), face.end(),
+            [&](uint32_t a, uint32_t b) { return project(a) < project(b); });
+  face.erase(std::unique(face.begin(), face.end()), face.end());
+  if (face.size() < 3) {
+    return face;
+  }
+
+  const auto cross = [&](uint32_t o, uint32_t a, uint32_t b) {
+    const auto po = project(o), pa = project(a), pb = project(b);
+    return (pa.first - po.first) * (pb.second - po.second)
+           - (pa.second - po.second) * (pb.first - po.first);
+  };
+  std::vector<uint32_t> hull(2 * face.size());
+  size_t k = 0;
+  for (size_t i = 0; i < face.size(); ++i) {
+    while (k >= 2 && cross(hull[k - 2], hull[k - 1], face[i]) <= 0.f) {
+      --k;
+    }
+    hull[k++] = face[i];
+  }
+  for (size_t i = face.size() - 1, t = k + 1; i > 0; --i) {
+    while (k >= t && cross(hull[k - 2], hull[k - 1], face[i - 1]) <= 0.f) {
+      --k;
+    }
+    hull[k++] = face[i - 1];
+  }
+  hull.resize(k - 1);
+  return hull;
+}
+
+} // end of anonymous namespace
+
+CollisionShape::CollisionShape(Type iType, float iRadius) : type{iType}, radius{iRadius}
+{
+}
+
+CollisionShape::~CollisionShape() = default;
+
+CollisionShapePtr CollisionShape::CreateSphere(float radius)
+{
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::Sphere, radius));
+  shape->vertices.emplace_back(Vector3::Zero());
+  return shape;
+}
+
+CollisionShapePtr CollisionShape::CreateCapsule(float radius, float halfHeight)
+{
+  if (halfHeight <= 0.f) {
+    return CreateSphere(radius);
+  }
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::Capsule, radius));
+  shape->vertices       = {Vector3(0.f, -halfHeight, 0.f), Vector3(0.f, halfHeight, 0.f)};
+  shape->edges          = {Edge{0, 1, 0}};
+  shape->edgeDirections = {Vector3(0.f, 1.f, 0.f)};
+  return shape;
+}
+
+CollisionShapePtr CollisionShape::CreateBox(const Vector3& halfExtents)
+{
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::Polyhedron, 0.f));
+  for (unsigned int i = 0; i < 8; ++i) {
+    shape->vertices.emplace_back(Vector3((i & 1) ? halfExtents.x : -halfExtents.x,
+                                         (i & 2) ? halfExtents.y : -halfExtents.y,
+                                         (i & 4) ? halfExtents.z : -halfExtents.z));
+  }
+  for (const auto& face : {std::vector<uint32_t>{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4},
+                           {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 5, 7, 6}}) {
+    shape->faces.emplace_back(Face{face, Vector3::Zero(), 0.f});
+  }
+  shape->_finalizeCore();
+  return shape;
+}
+
+CollisionShapePtr CollisionShape::CreateCylinder(float radius, float halfHeight, size_t segments)
+{
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::Polyhedron, 0.f));
+  segments   = std::max<size_t>(segments, 3);
+  const auto count = static_cast<uint32_t>(segments);
+  for (const auto y : {-halfHeight, halfHeight}) {
+    for (uint32_t i = 0; i < count; ++i) {
+      const auto angle = Math::PI2 * static_cast<float>(i) / static_cast<float>(count);
+      shape->vertices.emplace_back(Vector3(radius * std::cos(angle), y, radius * std::sin(angle)));
+    }
+  }
+  Face bottom{{}, Vector3::Zero(), 0.f}, top{{}, Vector3::Zero(), 0.f};
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto next = (i + 1) % count;
+    shape->faces.emplace_back(Face{{i, next, count + next, count + i}, Vector3::Zero(), 0.f});
+    bottom.vertices.emplace_back(i);
+    top.vertices.emplace_back(count + i);
+  }
+  shape->faces.emplace_back(bottom);
+  shape->faces.emplace_back(top);
+  shape->_finalizeCore();
+  return shape;
+}
+
+CollisionShapePtr CollisionShape::CreateConvexHull(const std::vector<Vector3>& points)
+{
+  const auto epsilon = 1e-5f * (1.f + MaxAbsCoordinate(points));
+  auto triangles     = ComputeHullTriangles(points, epsilon);
+  if (triangles.empty()) {
+    return nullptr;
+  }
+
+  // Large hulls are simplified to the support points of a set of directions spread on the sphere
+  std::vector<uint32_t> used;
+  for (const auto& triangle : triangles) {
+    used.insert(used.end(), triangle.vertices.begin(), triangle.vertices.end());
+  }
+  std::sort(used.begin(), used.end());
+  used.erase(std::unique(used.begin(), used.end()), used.end());
+  if (used.size() > MaxHullVertices) {
+    std::vector<Vector3> supportPoints;
+    const auto goldenAngle = Math::PI * (3.f - std::sqrt(5.f));
+    for (size_t i = 0; i < MaxHullVertices; ++i) {
+      const auto y      = 1.f - 2.f * (static_cast<float>(i) + 0.5f) / MaxHullVertices;
+      const auto r      = std::sqrt(std::max(0.f, 1.f - y * y));
+      const auto theta  = goldenAngle * static_cast<float>(i);
+      const Vector3 direction(r * std::cos(theta), y, r * std::sin(theta));
+      auto best         = used.front();
+      for (const auto index : used) {
+        if (Vector3::Dot(points[index], direction) > Vector3::Dot(points[best], direction)) {
+          best = index;
+        }
+      }
+      supportPoints.emplace_back(points[best]);
+    }
+    std::sort(supportPoints.begin(), supportPoints.end(), [](const Vector3& a, const Vector3& b) {
+      return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+    });
+    supportPoints.erase(std::unique(supportPoints.begin(), supportPoints.end()),
+                        supportPoints.end());
+    return CreateConvexHull(supportPoints);
+  }
+
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::Polyhedron, 0.f));
+  std::vector<uint32_t> remap(points.size(), 0);
+  for (const auto index : used) {
+    remap[index] = static_cast<uint32_t>(shape->vertices.size());
+    shape->vertices.emplace_back(points[index]);
+  }
+
+  // Coplanar triangles are merged into polygonal faces
+  std::vector<bool> merged(triangles.size(), false);
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    if (merged[i]) {
+      continue;
+    }
+    std::vector<uint32_t> face;
+    for (size_t j = i; j < triangles.size(); ++j) {
+      if (!merged[j] && Vector3::Dot(triangles[i].normal, triangles[j].normal) > 0.9999f
+          && std::abs(triangles[i].offset - triangles[j].offset) <= epsilon) {
+        merged[j] = true;
+        for (const auto vertex : triangles[j].vertices) {
+          face.emplace_back(remap[vertex]);
+        }
+      }
+    }
+    face = OrderFaceVertices(shape->vertices, face, triangles[i].normal);
+    if (face.size() >= 3) {
+      shape->faces.emplace_back(Face{face, Vector3::Zero(), 0.f});
+    }
+  }
+
+  shape->_finalizeCore();
+  return shape;
+}
+
+CollisionShapePtr CollisionShape::CreateTriangleMesh(std::vector<Vector3> positions,
+                                                     IndicesArray indices)
+{
+  auto shape = std::shared_ptr<CollisionShape>(new CollisionShape(Type::TriangleMesh, 0.f));
+  shape->vertices = std::move(positions);
+  shape->indices  = std::move(indices);
+  shape->triangleBVH = std::make_unique<TriangleBVH>(
+    shape->vertices, shape->indices, 0,
+    shape->indices.empty() ? shape->vertices.size() : shape->indices.size());
+  return shape;
+}
+
+void CollisionShape::_finalizeCore()
+{
+  auto centroid = Vector3::Zero();
+  for (const auto& vertex : vertices) {
+    centroid.addInPlace(vertex);
+  }
+  centroid.scaleInPlace(1.f / static_cast<float>(vertices.size()));
+
+  // Plane of the faces (Newell's method), oriented outward
+  for (auto& face : faces) {
+    auto normal = Vector3::Zero();
+    auto center = Vector3::Zero();
+    for (size_t i = 0; i < face.vertices.size(); ++i) {
+      const auto& current = vertices[face.vertices[i]];
+      const auto& next    = vertices[face.vertices[(i + 1) % face.vertices.size()]];
+      normal.addInPlaceFromFloats((current.y - next.y) * (current.z + next.z),
+                                  (current.z - next.z) * (current.x + next.x),
+                                  (current.x - next.x) * (current.y + next.y));
+      center.addInPlace(current);
+    }
+    center.scaleInPlace(1.f / static_cast<float>(face.vertices.size()));
+    normal.normalize();
+    if (Vector3::Dot(normal, center.subtract(centroid)) < 0.f) {
+      std::reverse(face.vertices.begin(), face.vertices.end());
+      normal.scaleInPlace(-1.f);
+    }
+    face.normal = normal;
+    face.offset = Vector3::Dot(normal, center);
+  }
+
+  // Unique edges and edge directions
+  edges.clear();
+  edgeDirections.clear();
+  std::vector<uint64_t> edgeKeys;
+  for (const auto& face : faces) {
+    for (size_t i = 0; i < face.vertices.size(); ++i) {
+      const uint64_t a = face.vertices[i];
+      const uint64_t b = face.vertices[(i + 1) % face.vertices.size()];
+      edgeKeys.emplace_back(a < b ? ((a << 32) | b) : ((b << 32) | a));
+    }
+  }
+  std::sort(edgeKeys.begin(), edgeKeys.end());
+  edgeKeys.erase(std::unique(edgeKeys.begin(), edgeKeys.end()), edgeKeys.end());
+  for (const auto key : edgeKeys) {
+    const auto a         = static_cast<uint32_t>(key >> 32);
+    const auto b         = static_cast<uint32_t>(key & 0xffffffff);
+    const auto direction = vertices[b].subtract(vertices[a]).normalize();
+    uint32_t directionIndex = 0;
+    while (directionIndex < edgeDirections.size()
+           && std::abs(Vector3::Dot(edgeDirections[directionIndex], direction)) < 0.9999f) {
+      ++directionIndex;
+    }
+    if (directionIndex == edgeDirections.size()) {
+      edgeDirections.emplace_back(direction);
+    }
+    edges.emplace_back(Edge{a, b, directionIndex});
+  }
+}
+
+CollisionShape::MassProperties CollisionShape::computeMassProperties() const
+{
+  MassProperties properties{0.f, Vector3::Zero(), Matrix3x3::Zero()};
+
+  switch (type) {
+    case Type::Sphere: {
+      properties.volume = 4.f / 3.f * Math::PI * radius * radius * radius;
+      const auto i      = 0.4f * properties.volume * radius * radius;
+      properties.inertia = Matrix3x3::Diagonal(i, i, i);
+    } break;
+    case Type::Capsule: {
+      // Cylinder and two hemispheres along the Y axis
+      const auto halfHeight     = vertices[1].y;
+      const auto r2             = radius * radius;
+      const auto cylinderVolume = Math::PI * r2 * 2.f * halfHeight;
+      const auto spheresVolume  = 4.f / 3.f * Math::PI * r2 * radius;
+      const auto iy             = cylinderVolume * r2 / 2.f + spheresVolume * 0.4f * r2;
+      const auto ix
+        = cylinderVolume * (r2 / 4.f + halfHeight * halfHeight / 3.f)
+          + spheresVolume * (0.4f * r2 + halfHeight * halfHeight + 0.75f * halfHeight * radius);
+      properties.volume  = cylinderVolume + spheresVolume;
+      properties.inertia = Matrix3x3::Diagonal(ix, iy, ix);
+    } break;
+    case Type::Polyhedron: {
+      // Sum of the signed tetrahedra joining a reference point to the triangles of the faces
+      auto reference = Vector3::Zero();
+      for (const auto& vertex : vertices) {
+        reference.addInPlace(vertex);
+      }
+      reference.scaleInPlace(1.f / static_cast<float>(vertices.size()));
+
+      auto covariance = Matrix3x3::Zero();
+      auto moment     = Vector3::Zero();
+      const auto outer = [](const Vector3& a, const Vector3& b) {
+        Matrix3x3 result;
+        result.m = {{a.x * b.x, a.x * b.y, a.x * b.z, a.y * b.x, a.y * b.y, a.y * b.z, a.z * b.x,
+                     a.z * b.y, a.z * b.z}};
+        return result;
+      };
+      for (const auto& face : faces) {
+        const auto a = vertices[face.vertices[0]].subtract(reference);
+        for (size_t i = 1; i + 1 < face.vertices.size(); ++i) {
+          const auto b   = vertices[face.vertices[i]].subtract(reference);
+          const auto c   = vertices[face.vertices[i + 1]].subtract(reference);
+          const auto det = Vector3::Dot(a, Vector3::Cross(b, c));
+          const auto sum = a.add(b).add(c);
+          properties.volume += det / 6.f;
+          moment.addInPlace(sum.scale(det / 24.f));
+          covariance = covariance.add(outer(sum, sum)
+                                        .add(outer(a, a))
+                                        .add(outer(b, b))
+                                        .add(outer(c, c))
+                                        .scale(det / 120.f));
+        }
+      }
+      if (properties.volume <= 0.f) {
+        break;
+      }
+      const auto center = moment.scale(1.f / properties.volume);
+      covariance        = covariance.add(outer(center, center).scale(-properties.volume));
+      const auto trace  = covariance.m[0] + covariance.m[4] + covariance.m[8];
+      properties.inertia
+        = Matrix3x3::Diagonal(trace, trace, trace).add(covariance.scale(-1.f));
+      properties.centerOfMass = reference.add(center);
+    } break;
+    case Type::TriangleMesh:
+      break;
+  }
+
+  return properties;
+}
+
+void CollisionShape::computeBounds(Vector3& minimum, Vector3& maximum) const
+{
+  minimum = Vector3(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max());
+  maximum = minimum.scale(-1.f);
+  for (const auto& vertex : vertices) {
+    minimum.minimizeInPlace(vertex);
+    maximum.maximizeInPlace(vertex);
+  }
+  minimum.addInPlaceFromFloats(-radius, -radius, -radius);
+  maximum.addInPlaceFromFloats(radius, radius, radius);
+}
+
+float CollisionShape::boundingRadius() const
+{
+  auto maxLength = 0.f;
+  for (const auto& vertex : vertices) {
+    maxLength = std::max(maxLength, vertex.lengthSquared());
+  }
+  return std::sqrt(maxLength) + radius;
+}
+
+std::optional<float> CollisionShape::intersectsRay(const Vector3& origin, const Vector3& direction,
+                                                   float maxDistance, Vector3& normal) const
+{
+  std::optional<float> distance = std::nullopt;
+
+  const auto intersectsSphere = [&](const Vector3& center) -> std::optional<float> {
+    const auto offset = origin.subtract(center);
+    const auto b      = Vector3::Dot(offset, direction);
+    const auto c      = offset.lengthSquared() - radius * radius;
+    const auto h      = b * b - c;
+    if (c <= 0.f || b > 0.f || h < 0.f) {
+      return std::nullopt;
+    }
+    return -b - std::sqrt(h);
+  };
+
+  switch (type) {
+    case Type::Sphere:
+      distance = intersectsSphere(vertices[0]);
+      break;
+    case Type::Capsule: {
+      // Cylinder body, then the hemisphere on the side of the hit
+      const auto& a       = vertices[0];
+      const auto& b       = vertices[1];
+      const auto ba       = b.subtract(a);
+      const auto oa       = origin.subtract(a);
+      const auto baba     = ba.lengthSquared();
+      const auto bard     = Vector3::Dot(ba, direction);
+      const auto baoa     = Vector3::Dot(ba, oa);
+      const auto axial    = std::clamp(baoa / baba, 0.f, 1.f);
+      const auto inside
+        = origin.subtract(a.add(ba.scale(axial))).lengthSquared() <= radius * radius;
+      if (inside) {
+        break;
+      }
+      const auto k2 = baba - bard * bard;
+      const auto k1 = baba * Vector3::Dot(oa, direction) - baoa * bard;
+      const auto k0 = baba * oa.lengthSquared() - baoa * baoa - radius * radius * baba;
+      const auto h  = k1 * k1 - k2 * k0;
+      if (k2 > 1e-8f && h >= 0.f) {
+        const auto t = (-k1 - std::sqrt(h)) / k2;
+        const auto y = baoa + t * bard;
+        if (t >= 0.f && y > 0.f && y < baba) {
+          distance = t;
+          break;
+        }
+      }
+      const auto hitA = intersectsSphere(a);
+      const auto hitB = intersectsSphere(b);
+      if (hitA && (!hitB || *hitA < *hitB)) {
+        distance = hitA;
+      }
+      else {
+        distance = hitB;
+      }
+    } break;
+    case Type::Polyhedron: {
+      // Clipping of the ray by the planes of the faces
+      auto enter = 0.f;
+      auto exit  = maxDistance;
+      const Face* enterFace = nullptr;
+      for (const auto& face : faces) {
+        const auto denominator = Vector3::Dot(face.normal, direction);
+        const auto numerator   = face.offset - Vector3::Dot(face.normal, origin);
+        if (std::abs(denominator) < 1e-12f) {
+          if (numerator < 0.f) {
+            return std::nullopt;
+          }
+          continue;
+        }
+        const auto t = numerator / denominator;
+        if (denominator < 0.f) {
+          if (t > enter || !enterFace) {
+            enter     = std::max(enter, t);
+            enterFace = &face;
+          }
+        }
+        else {
+          exit = std::min(exit, t);
+        }
+        if (enter > exit) {
+          return std::nullopt;
+        }
+      }
+      if (enterFace && Vector3::Dot(enterFace->normal, origin) > enterFace->offset) {
+        distance = enter;
+        normal   = enterFace->normal;
+      }
+    } break;
+    case Type::TriangleMesh: {
+      if (!triangleBVH) {
+        break;
+      }
+      Ray ray(origin, direction, maxDistance);
+      const auto hit = triangleBVH->intersects(ray, vertices, false);
+      if (!hit) {
+        break;
+      }
+      const auto base  = static_cast<size_t>(hit->faceId) * 3;
+      const auto index = [this](size_t i) { return indices.empty() ? i : indices[i]; };
+      normal = Vector3::Cross(vertices[index(base + 1)].subtract(vertices[index(base)]),
+                              vertices[index(base + 2)].subtract(vertices[index(base)]))
+                 .normalize();
+      if (Vector3::Dot(normal, direction) > 0.f) {
+        normal.scaleInPlace(-1.f);
+      }
+      distance = hit->distance;
+    } break;
+  }
+
+  if (!distance || *distance > maxDistance) {
+    return std::nullopt;
+  }
+
+  if (type == Type::Sphere || type == Type::Capsule) {
+    // Normal from the closest point of the core
+    const auto hitPoint = origin.add(direction.scale(*distance));
+    auto center         = vertices[0];
+    if (type == Type::Capsule) {
+      const auto axis = vertices[1].subtract(vertices[0]);
+      const auto t    = std::clamp(Vector3::Dot(hitPoint.subtract(vertices[0]), axis)
+                                  / axis.lengthSquared(),
+                                0.f, 1.f);
+      center          = vertices[0].add(axis.scale(t));
+    }
+    normal = hitPoint.subtract(center).normalize();
+  }
+
+  return distance;
+}
+
+} // end of namespace BABYLON
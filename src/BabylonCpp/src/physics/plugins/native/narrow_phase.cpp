@@ -0,0 +1,690 @@
+#include <babylon/physics/plugins/native/narrow_phase.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace BABYLON {
+
+namespace {
+
+// Maximum number of GJK iterations
+constexpr size_t MaxGjkIterations = 32;
+// Distance under which two cores are considered overlapping
+constexpr float CoreTolerance = 1e-4f;
+// Distance under which two contacts of the same pair are considered identical
+constexpr float ContactMergeDistance = 1e-2f;
+// Tolerances favoring the faces of the first shape, then faces, over edges in the SAT
+constexpr float RelativeAxisTolerance = 0.98f;
+constexpr float AbsoluteAxisTolerance = 0.001f;
+
+struct SimplexVertex {
+  Vector3 w;
+  Vector3 a;
+  Vector3 b;
+};
+
+struct Simplex {
+  std::array<SimplexVertex, 4> vertices;
+  std::array<float, 4> weights;
+  size_t count = 0;
+
+  void keep(std::initializer_list<std::pair<size_t, float>> kept)
+  {
+    std::array<SimplexVertex, 4> keptVertices;
+    size_t keptCount = 0;
+    for (const auto& [index, weight] : kept) {
+      keptVertices[keptCount] = vertices[index];
+      weights[keptCount]      = weight;
+      ++keptCount;
+    }
+    vertices = keptVertices;
+    count    = keptCount;
+  }
+};
+
+/**
+ * @brief Closest point to the origin of the triangle (a, b, c) of a simplex (Ericson, Real-Time
+ * Collision Detection, 5.1.5), as the kept vertices and their weights.
+ */
+void ClosestOnTriangle(const std::array<SimplexVertex, 4>& vertices, size_t ia, size_t ib,
+                       size_t ic, std::vector<std::pair<size_t, float>>& kept)
+{
+  kept.clear();
+  const auto& a = vertices[ia].w;
+  const auto& b = vertices[ib].w;
+  const auto& c = vertices[ic].w;
+  const auto ab = b.subtract(a);
+  const auto ac = c.subtract(a);
+
+  const auto d1 = -Vector3::Dot(ab, a);
+  const auto d2 = -Vector3::Dot(ac, a);
+  if (d1 <= 0.f && d2 <= 0.f) {
+    kept = {{ia, 1.f}};
+    return;
+  }
+  const auto d3 = -Vector3::Dot(ab, b);
+  const auto d4 = -Vector3::Dot(ac, b);
+  if (d3 >= 0.f && d4 <= d3) {
+    kept = {{ib, 1.f}};
+    return;
+  }
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+    const auto v = d1 / (d1 - d3);
+    kept         = {{ia, 1.f - v}, {ib, v}};
+    return;
+  }
+  const auto d5 = -Vector3::Dot(ab, c);
+  const auto d6 = -Vector3::Dot(ac, c);
+  if (d6 >= 0.f && d5 <= d6) {
+    kept = {{ic, 1.f}};
+    return;
+  }
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+    const auto w = d2 / (d2 - d6);
+    kept         = {{ia, 1.f - w}, {ic, w}};
+    return;
+  }
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+    const auto w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    kept         = {{ib, 1.f - w}, {ic, w}};
+    return;
+  }
+  const auto denominator = 1.f / (va + vb + vc);
+  const auto v           = vb * denominator;
+  const auto w           = vc * denominator;
+  kept                   = {{ia, 1.f - v - w}, {ib, v}, {ic, w}};
+}
+
+Vector3 WeightedPoint(const Simplex& simplex, Vector3 SimplexVertex::*member)
+{
+  auto point = Vector3::Zero();
+  for (size_t i = 0; i < simplex.count; ++i) {
+    point.addInPlace((simplex.vertices[i].*member).scale(simplex.weights[i]));
+  }
+  return point;
+}
+
+/**
+ * @brief Reduces the simplex to the vertices supporting its closest point to the origin. Returns
+ * false when the origin is inside the tetrahedron.
+ */
+bool ReduceSimplex(Simplex& simplex)
+{
+  thread_local std::vector<std::pair<size_t, float>> kept, bestKept;
+  const auto& v = simplex.vertices;
+
+  switch (simplex.count) {
+    case 1:
+      simplex.weights[0] = 1.f;
+      return true;
+    case 2: {
+      const auto ab = v[1].w.subtract(v[0].w);
+      const auto t  = -Vector3::Dot(v[0].w, ab) / std::max(ab.lengthSquared(), 1e-30f);
+      if (t <= 0.f) {
+        simplex.keep({{0, 1.f}});
+      }
+      else if (t >= 1.f) {
+        simplex.keep({{1, 1.f}});
+      }
+      else {
+        simplex.keep({{0, 1.f - t}, {1, t}});
+      }
+      return true;
+    }
+    case 3:
+      ClosestOnTriangle(v, 0, 1, 2, kept);
+      break;
+    default: {
+      // Closest point of the faces seeing the origin
+      static constexpr std::array<std::array<size_t, 4>, 4> faces{
+        {{{0, 1, 2, 3}}, {{0, 2, 3, 1}}, {{0, 3, 1, 2}}, {{1, 3, 2, 0}}}};
+      auto bestDistance = std::numeric_limits<float>::max();
+      auto outside      = false;
+      bestKept.clear();
+      for (const auto& face : faces) {
+        const auto& a     = v[face[0]].w;
+        const auto normal = Vector3::Cross(v[face[1]].w.subtract(a), v[face[2]].w.subtract(a));
+        const auto signOrigin   = -Vector3::Dot(a, normal);
+        const auto signOpposite = Vector3::Dot(v[face[3]].w.subtract(a), normal);
+        // Degenerate tetrahedra are handled as if the origin was outside of all the faces
+        if (signOrigin * signOpposite >= 0.f && signOpposite * signOpposite > 1e-20f) {
+          continue;
+        }
+        outside = true;
+        ClosestOnTriangle(v, face[0], face[1], face[2], kept);
+        auto point = Vector3::Zero();
+        for (const auto& [index, weight] : kept) {
+          point.addInPlace(v[index].w.scale(weight));
+        }
+        const auto distance = point.lengthSquared();
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestKept     = kept;
+        }
+      }
+      if (!outside) {
+        return false;
+      }
+      kept = bestKept;
+    } break;
+  }
+
+  if (kept.size() == 1) {
+    simplex.keep({kept[0]});
+  }
+  else if (kept.size() == 2) {
+    simplex.keep({kept[0], kept[1]});
+  }
+  else {
+    simplex.keep({kept[0], kept[1], kept[2]});
+  }
+  return true;
+}
+
+/**
+ * @brief Closest points of two segments (Ericson, Real-Time Collision Detection, 5.1.9).
+ */
+void ClosestPointsOfSegments(const Vector3& p1, const Vector3& q1, const Vector3& p2,
+                             const Vector3& q2, Vector3& c1, Vector3& c2)
+{
+  const auto d1 = q1.subtract(p1);
+  const auto d2 = q2.subtract(p2);
+  const auto r  = p1.subtract(p2);
+  const auto a  = d1.lengthSquared();
+  const auto e  = d2.lengthSquared();
+  const auto f  = Vector3::Dot(d2, r);
+  auto s = 0.f, t = 0.f;
+  if (a <= 1e-12f && e <= 1e-12f) {
+    c1 = p1;
+    c2 = p2;
+    return;
+  }
+  if (a <= 1e-12f) {
+    t = std::clamp(f / e, 0.f, 1.f);
+  }
+  else {
+    const auto c = Vector3::Dot(d1, r);
+    if (e <= 1e-12f) {
+      s = std::clamp(-c / a, 0.f, 1.f);
+    }
+    else {
+      const auto b           = Vector3::Dot(d1, d2);
+      const auto denominator = a * e - b * b;
+      s = denominator > 1e-12f ? std::clamp((b * f - c * e) / denominator, 0.f, 1.f) : 0.f;
+      t = (b * s + f) / e;
+      if (t < 0.f) {
+        t = 0.f;
+        s = std::clamp(-c / a, 0.f, 1.f);
+      }
+      else if (t > 1.f) {
+        t = 1.f;
+        s = std::clamp((b - c) / a, 0.f, 1.f);
+      }
+    }
+  }
+  c1 = p1.add(d1.scale(s));
+  c2 = p2.add(d2.scale(t));
+}
+
+/**
+ * @brief Keeps the part of a polygon (or of a segment, or a point) on the inner side of a plane
+ * (dot(normal, p) <= offset).
+ */
+void ClipPolygon(std::vector<Vector3>& polygon, const Vector3& normal, float offset,
+                 std::vector<Vector3>& scratch)
+{
+  scratch.clear();
+  const auto count = polygon.size();
+  if (count == 1) {
+    if (Vector3::Dot(normal, polygon[0]) <= offset) {
+      scratch.emplace_back(polygon[0]);
+    }
+  }
+  else {
+    // A segment is handled as an open polyline
+    const auto edgeCount = count == 2 ? 1 : count;
+    for (size_t i = 0; i < edgeCount; ++i) {
+      const auto& start    = polygon[i];
+      const auto& end      = polygon[(i + 1) % count];
+      const auto distStart = Vector3::Dot(normal, start) - offset;
+      const auto distEnd   = Vector3::Dot(normal, end) - offset;
+      if (count == 2 && distStart <= 0.f) {
+        scratch.emplace_back(start);
+      }
+      if ((distStart < 0.f && distEnd > 0.f) || (distStart > 0.f && distEnd < 0.f)) {
+        const auto t = distStart / (distStart - distEnd);
+        scratch.emplace_back(start.add(end.subtract(start).scale(t)));
+      }
+      if (distEnd <= 0.f) {
+        scratch.emplace_back(end);
+      }
+    }
+  }
+  polygon.swap(scratch);
+}
+
+void AddContact(std::vector<NarrowPhase::Contact>& contacts, const NarrowPhase::Contact& contact)
+{
+  for (const auto& existing : contacts) {
+    if (Vector3::DistanceSquared(existing.pointA, contact.pointA)
+          < ContactMergeDistance * ContactMergeDistance
+        && Vector3::Dot(existing.normal, contact.normal) > 0.99f) {
+      return;
+    }
+  }
+  contacts.emplace_back(contact);
+}
+
+/**
+ * @brief Contacts of the incident feature of a shape clipped by a face of a reference shape.
+ * @param flip defines if the reference shape is the shape B of the pair
+ */
+void FaceContacts(const ConvexPolytope& reference, size_t referenceFace,
+                  const ConvexPolytope& incident, bool flip, float margin,
+                  std::vector<NarrowPhase::Contact>& contacts)
+{
+  thread_local std::vector<Vector3> polygon, scratch;
+  const auto& normal = reference.faceNormals[referenceFace];
+  const auto offset  = reference.faceOffsets[referenceFace];
+  const auto radii   = reference.radius + incident.radius;
+
+  // Incident face: the face of the incident shape the most opposed to the reference face, or its
+  // whole core (point or segment)
+  polygon.clear();
+  if (incident.faceCount > 0) {
+    size_t incidentFace = 0;
+    auto minDot         = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < incident.faceCount; ++i) {
+      const auto dot = Vector3::Dot(incident.faceNormals[i], normal);
+      if (dot < minDot) {
+        minDot       = dot;
+        incidentFace = i;
+      }
+    }
+    for (const auto index : incident.faces[incidentFace].vertices) {
+      polygon.emplace_back(incident.vertices[index]);
+    }
+  }
+  else {
+    polygon.assign(incident.vertices, incident.vertices + incident.vertexCount);
+  }
+
+  // Side planes of the reference face
+  const auto& loop = reference.faces[referenceFace].vertices;
+  for (size_t i = 0; i < loop.size() && !polygon.empty(); ++i) {
+    const auto& start     = reference.vertices[loop[i]];
+    const auto& end       = reference.vertices[loop[(i + 1) % loop.size()]];
+    const auto sideNormal = Vector3::Cross(end.subtract(start), normal);
+    ClipPolygon(polygon, sideNormal, Vector3::Dot(sideNormal, start), scratch);
+  }
+
+  // Deep cores may not project on the reference face, their deepest point is used
+  if (polygon.empty()) {
+    const auto deepest = incident.support(normal.scale(-1.f));
+    polygon.emplace_back(incident.vertices[deepest]);
+  }
+
+  for (const auto& point : polygon) {
+    const auto separation = Vector3::Dot(normal, point) - offset;
+    if (separation > radii + margin) {
+      continue;
+    }
+    const auto referencePoint
+      = point.subtract(normal.scale(separation)).add(normal.scale(reference.radius));
+    const auto incidentPoint = point.subtract(normal.scale(incident.radius));
+    if (flip) {
+      AddContact(contacts, {incidentPoint, referencePoint, normal.scale(-1.f), radii - separation});
+    }
+    else {
+      AddContact(contacts, {referencePoint, incidentPoint, normal, radii - separation});
+    }
+  }
+}
+
+/**
+ * @brief Edge of a core along a direction, the farthest along an axis (or the nearest).
+ */
+void SupportEdge(const ConvexPolytope& polytope, size_t direction, const Vector3& axis,
+                 bool farthest, Vector3& start, Vector3& end)
+{
+  auto best = -std::numeric_limits<float>::max();
+  for (size_t i = 0; i < polytope.edgeCount; ++i) {
+    const auto& edge = polytope.edges[i];
+    if (edge.direction != direction) {
+      continue;
+    }
+    const auto& a = polytope.vertices[edge.a];
+    const auto& b = polytope.vertices[edge.b];
+    auto value    = Vector3::Dot(axis, a) + Vector3::Dot(axis, b);
+    value         = farthest ? value : -value;
+    if (value > best) {
+      best  = value;
+      start = a;
+      end   = b;
+    }
+  }
+}
+
+/**
+ * @brief Contacts of two shapes whose cores overlap (or polyhedra), separating axis theorem.
+ */
+void SatContacts(const ConvexPolytope& a, const ConvexPolytope& b, float margin,
+                 std::vector<NarrowPhase::Contact>& contacts)
+{
+  const auto radii = a.radius + b.radius;
+  const auto limit = radii + margin;
+
+  auto separationA = -std::numeric_limits<float>::max();
+  auto faceA       = a.faceCount;
+  for (size_t i = 0; i < a.faceCount; ++i) {
+    const auto& normal    = a.faceNormals[i];
+    const auto separation = Vector3::Dot(normal, b.vertices[b.support(normal.scale(-1.f))])
+                            - a.faceOffsets[i];
+    if (separation > limit) {
+      return;
+    }
+    if (separation > separationA) {
+      separationA = separation;
+      faceA       = i;
+    }
+  }
+
+  auto separationB = -std::numeric_limits<float>::max();
+  auto faceB       = b.faceCount;
+  for (size_t i = 0; i < b.faceCount; ++i) {
+    const auto& normal    = b.faceNormals[i];
+    const auto separation = Vector3::Dot(normal, a.vertices[a.support(normal.scale(-1.f))])
+                            - b.faceOffsets[i];
+    if (separation > limit) {
+      return;
+    }
+    if (separation > separationB) {
+      separationB = separation;
+      faceB       = i;
+    }
+  }
+
+  const auto centers  = b.center.subtract(a.center);
+  auto separationEdge = -std::numeric_limits<float>::max();
+  auto edgeAxis       = Vector3::Zero();
+  size_t edgeA = 0, edgeB = 0;
+  auto hasEdge = false;
+  for (size_t i = 0; i < a.edgeDirectionCount; ++i) {
+    for (size_t j = 0; j < b.edgeDirectionCount; ++j) {
+      auto axis          = Vector3::Cross(a.edgeDirections[i], b.edgeDirections[j]);
+      const auto length2 = axis.lengthSquared();
+      if (length2 < 1e-6f) {
+        continue;
+      }
+      axis.scaleInPlace((Vector3::Dot(axis, centers) < 0.f ? -1.f : 1.f) / std::sqrt(length2));
+      const auto separation = Vector3::Dot(axis, b.vertices[b.support(axis.scale(-1.f))])
+                              - Vector3::Dot(axis, a.vertices[a.support(axis)]);
+      if (separation > limit) {
+        return;
+      }
+      if (separation > separationEdge) {
+        separationEdge = separation;
+        edgeAxis       = axis;
+        edgeA          = i;
+        edgeB          = j;
+        hasEdge        = true;
+      }
+    }
+  }
+
+  enum class Axis { None, FaceA, FaceB, Edge };
+  auto best           = Axis::None;
+  auto bestSeparation = -std::numeric_limits<float>::max();
+  if (faceA < a.faceCount) {
+    best           = Axis::FaceA;
+    bestSeparation = separationA;
+  }
+  if (faceB < b.faceCount
+      && (best == Axis::None
+          || separationB > RelativeAxisTolerance * bestSeparation + AbsoluteAxisTolerance)) {
+    best           = Axis::FaceB;
+    bestSeparation = separationB;
+  }
+  if (hasEdge
+      && (best == Axis::None
+          || separationEdge > RelativeAxisTolerance * bestSeparation + AbsoluteAxisTolerance)) {
+    best = Axis::Edge;
+  }
+
+  switch (best) {
+    case Axis::FaceA:
+      FaceContacts(a, faceA, b, false, margin, contacts);
+      break;
+    case Axis::FaceB:
+      FaceContacts(b, faceB, a, true, margin, contacts);
+      break;
+    case Axis::Edge: {
+      Vector3 startA, endA, startB, endB, pointA, pointB;
+      SupportEdge(a, edgeA, edgeAxis, true, startA, endA);
+      SupportEdge(b, edgeB, edgeAxis, false, startB, endB);
+      ClosestPointsOfSegments(startA, endA, startB, endB, pointA, pointB);
+      AddContact(contacts, {pointA.add(edgeAxis.scale(a.radius)),
+                            pointB.subtract(edgeAxis.scale(b.radius)), edgeAxis,
+                            radii - separationEdge});
+    } break;
+    case Axis::None: {
+      // Points and parallel segments: axis between the centers
+      auto axis = centers.lengthSquared() > 1e-12f ? centers.normalizeToNew() :
+                                                     Vector3(0.f, 1.f, 0.f);
+      const auto& pointA    = a.vertices[a.support(axis)];
+      const auto& pointB    = b.vertices[b.support(axis.scale(-1.f))];
+      const auto separation = Vector3::Dot(axis, pointB.subtract(pointA));
+      if (separation <= limit) {
+        AddContact(contacts, {pointA.add(axis.scale(a.radius)),
+                              pointB.subtract(axis.scale(b.radius)), axis, radii - separation});
+      }
+    } break;
+  }
+}
+
+} // end of anonymous namespace
+
+size_t ConvexPolytope::support(const Vector3& direction) const
+{
+  size_t best    = 0;
+  auto bestValue = Vector3::Dot(vertices[0], direction);
+  for (size_t i = 1; i < vertexCount; ++i) {
+    const auto value = Vector3::Dot(vertices[i], direction);
+    if (value > bestValue) {
+      bestValue = value;
+      best      = i;
+    }
+  }
+  return best;
+}
+
+float NarrowPhase::ClosestPoints(const ConvexPolytope& a, const ConvexPolytope& b,
+                                 Vector3& pointA, Vector3& pointB)
+{
+  Simplex simplex;
+  auto v = a.center.subtract(b.center);
+  if (v.lengthSquared() < 1e-12f) {
+    v = Vector3(1.f, 0.f, 0.f);
+  }
+
+  for (size_t iteration = 0; iteration < MaxGjkIterations; ++iteration) {
+    const auto direction = v.scale(-1.f);
+    const auto& supportA = a.vertices[a.support(direction)];
+    const auto& supportB = b.vertices[b.support(v)];
+    const auto w         = supportA.subtract(supportB);
+
+    // No progress toward the origin
+    const auto vv = v.lengthSquared();
+    if (simplex.count > 0 && vv - Vector3::Dot(v, w) <= 1e-6f * vv) {
+      break;
+    }
+    auto duplicate = false;
+    for (size_t i = 0; i < simplex.count; ++i) {
+      duplicate = duplicate || simplex.vertices[i].w == w;
+    }
+    if (duplicate) {
+      break;
+    }
+
+    simplex.vertices[simplex.count++] = SimplexVertex{w, supportA, supportB};
+    if (!ReduceSimplex(simplex)) {
+      return 0.f;
+    }
+    v = WeightedPoint(simplex, &SimplexVertex::w);
+    if (v.lengthSquared() <= 1e-12f) {
+      return 0.f;
+    }
+  }
+
+  pointA = WeightedPoint(simplex, &SimplexVertex::a);
+  pointB = WeightedPoint(simplex, &SimplexVertex::b);
+  return v.length();
+}
+
+void NarrowPhase::Collide(const ConvexPolytope& a, const ConvexPolytope& b, float margin,
+                          std::vector<Contact>& contacts)
+{
+  const auto radii = a.radius + b.radius;
+  if (radii > 0.f) {
+    Vector3 pointA, pointB;
+    const auto distance = ClosestPoints(a, b, pointA, pointB);
+    if (distance > radii + margin) {
+      return;
+    }
+    if (distance > CoreTolerance) {
+      const auto normal = pointB.subtract(pointA).scale(1.f / distance);
+      AddContact(contacts, {pointA.add(normal.scale(a.radius)),
+                            pointB.subtract(normal.scale(b.radius)), normal, radii - distance});
+
+      // The end points of the segments give the second contact of the capsules lying on a shape
+      for (const auto* segment : {&a, &b}) {
+        if (segment->vertexCount != 2) {
+          continue;
+        }
+        for (size_t i = 0; i < 2; ++i) {
+          ConvexPolytope endPoint;
+          endPoint.vertices    = segment->vertices + i;
+          endPoint.vertexCount = 1;
+          endPoint.radius      = segment->radius;
+          endPoint.center      = segment->vertices[i];
+          const auto isA       = segment == &a;
+          const auto endDistance
+            = isA ? ClosestPoints(endPoint, b, pointA, pointB) :
+                    ClosestPoints(a, endPoint, pointA, pointB);
+          if (endDistance > CoreTolerance && endDistance <= radii + margin) {
+            const auto endNormal = pointB.subtract(pointA).scale(1.f / endDistance);
+            AddContact(contacts, {pointA.add(endNormal.scale(a.radius)),
+                                  pointB.subtract(endNormal.scale(b.radius)), endNormal,
+                                  radii - endDistance});
+          }
+        }
+      }
+      return;
+    }
+  }
+
+  SatContacts(a, b, margin, contacts);
+}
+
+void NarrowPhase::CollideTriangle(const ConvexPolytope& a, const std::array<Vector3, 3>& triangle,
+                                  float margin, std::vector<Contact>& contacts)
+{
+  static const std::array<CollisionShape::Face, 1> faces{
+    {CollisionShape::Face{{0, 1, 2}, Vector3::Zero(), 0.f}}};
+  static const std::array<CollisionShape::Face, 1> reversedFaces{
+    {CollisionShape::Face{{0, 2, 1}, Vector3::Zero(), 0.f}}};
+  static constexpr std::array<CollisionShape::Edge, 3> edges{
+    {CollisionShape::Edge{0, 1, 0}, CollisionShape::Edge{1, 2, 1}, CollisionShape::Edge{2, 0, 2}}};
+
+  auto normal
+    = Vector3::Cross(triangle[1].subtract(triangle[0]), triangle[2].subtract(triangle[0]));
+  const auto length = normal.length();
+  if (length < 1e-12f) {
+    return;
+  }
+  normal.scaleInPlace(1.f / length);
+
+  // The face of the triangle is the side of the center of the convex shape
+  auto reversed = false;
+  if (Vector3::Dot(normal, a.center.subtract(triangle[0])) < 0.f) {
+    normal.scaleInPlace(-1.f);
+    reversed = true;
+  }
+  const auto offset = Vector3::Dot(normal, triangle[0]);
+  const std::array<Vector3, 3> directions{{triangle[1].subtract(triangle[0]).normalize(),
+                                           triangle[2].subtract(triangle[1]).normalize(),
+                                           triangle[0].subtract(triangle[2]).normalize()}};
+
+  ConvexPolytope b;
+  b.vertices           = triangle.data();
+  b.vertexCount        = 3;
+  b.faces              = reversed ? reversedFaces.data() : faces.data();
+  b.faceNormals        = &normal;
+  b.faceOffsets        = &offset;
+  b.faceCount          = 1;
+  b.edges              = edges.data();
+  b.edgeCount          = edges.size();
+  b.edgeDirections     = directions.data();
+  b.edgeDirectionCount = directions.size();
+  b.center = triangle[0].add(triangle[1]).add(triangle[2]).scale(1.f / 3.f);
+
+  Collide(a, b, margin, contacts);
+}
+
+void NarrowPhase::ReduceContacts(std::vector<Contact>& contacts, size_t maxCount)
+{
+  if (contacts.size() <= maxCount || maxCount == 0) {
+    return;
+  }
+
+  std::vector<Contact> reduced;
+  std::vector<bool> used(contacts.size(), false);
+  const auto select = [&](size_t index) {
+    used[index] = true;
+    reduced.emplace_back(contacts[index]);
+  };
+  const auto selectBest = [&](const auto& score) {
+    size_t best    = contacts.size();
+    auto bestScore = -std::numeric_limits<float>::max();
+    for (size_t i = 0; i < contacts.size(); ++i) {
+      const auto value = used[i] ? -std::numeric_limits<float>::max() : score(contacts[i]);
+      if (!used[i] && value > bestScore) {
+        bestScore = value;
+        best      = i;
+      }
+    }
+    select(best);
+  };
+
+  // Deepest contact, the farthest one from it, the one maximizing the triangle area, and then the
+  // ones the farthest from the selected ones
+  selectBest([](const Contact& contact) { return contact.depth; });
+  selectBest([&](const Contact& contact) {
+    return Vector3::DistanceSquared(contact.pointA, reduced[0].pointA);
+  });
+  if (maxCount > 2) {
+    selectBest([&](const Contact& contact) {
+      return Vector3::Cross(reduced[1].pointA.subtract(reduced[0].pointA),
+                            contact.pointA.subtract(reduced[0].pointA))
+        .lengthSquared();
+    });
+  }
+  while (reduced.size() < maxCount) {
+    selectBest([&](const Contact& contact) {
+      auto minDistance = std::numeric_limits<float>::max();
+      for (const auto& selected : reduced) {
+        minDistance
+          = std::min(minDistance, Vector3::DistanceSquared(contact.pointA, selected.pointA));
+      }
+      return minDistance;
+    });
+  }
+
+  contacts.swap(reduced);
+}
+
+} // end of namespace BABYLON
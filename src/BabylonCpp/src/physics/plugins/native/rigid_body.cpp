@@ -0,0 +1,354 @@
+#include <babylon/physics/plugins/native/rigid_body.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Returns the inertia tensor of a box of density 1 around its center.
+ */
+Matrix3x3 BoxInertia(const Vector3& size, float& volume)
+{
+  volume       = size.x * size.y * size.z;
+  const auto k = volume / 12.f;
+  return Matrix3x3::Diagonal(k * (size.y * size.y + size.z * size.z),
+                             k * (size.x * size.x + size.z * size.z),
+                             k * (size.x * size.x + size.y * size.y));
+}
+
+} // end of anonymous namespace
+
+ConvexPolytope RigidBody::Shape::polytope() const
+{
+  ConvexPolytope result;
+  result.vertices           = worldVertices.data();
+  result.vertexCount        = worldVertices.size();
+  result.faces              = shape->faces.data();
+  result.faceNormals        = worldFaceNormals.data();
+  result.faceOffsets        = worldFaceOffsets.data();
+  result.faceCount          = worldFaceNormals.size();
+  result.edges              = shape->edges.data();
+  result.edgeCount          = shape->edges.size();
+  result.edgeDirections     = worldEdgeDirections.data();
+  result.edgeDirectionCount = worldEdgeDirections.size();
+  result.radius             = shape->radius;
+  result.center             = worldPosition;
+  return result;
+}
+
+RigidBody::RigidBody(size_t iId)
+    : id{iId}
+    , index{0}
+    , impostor{nullptr}
+    , position{Vector3::Zero()}
+    , orientation{Quaternion::Identity()}
+    , rotation{Matrix3x3::Identity()}
+    , linearVel{Vector3::Zero()}
+    , angularVel{Vector3::Zero()}
+    , force{Vector3::Zero()}
+    , torque{Vector3::Zero()}
+    , massValue{0.f}
+    , invMass{0.f}
+    , friction{0.2f}
+    , restitution{0.2f}
+    , linearDamping{0.01f}
+    , angularDamping{0.05f}
+    , originOffset{Vector3::Zero()}
+    , isSleeping{false}
+    , sleepTime{0.f}
+    , minimum{Vector3::Zero()}
+    , maximum{Vector3::Zero()}
+{
+}
+
+RigidBody::~RigidBody() = default;
+
+void RigidBody::addShape(const CollisionShapePtr& shape, const Vector3& iPosition,
+                         const Quaternion& iRotation)
+{
+  Shape bodyShape;
+  bodyShape.shape = shape;
+  // Shapes are stored relative to the center of mass
+  bodyShape.localPosition = iPosition.add(originOffset);
+  bodyShape.localRotation = iRotation;
+  shape->computeBounds(bodyShape.localMinimum, bodyShape.localMaximum);
+  shapes.emplace_back(std::move(bodyShape));
+}
+
+void RigidBody::setMass(float iMass)
+{
+  // Center of mass and inertia of the shapes, in the space of the origin
+  auto volume        = 0.f;
+  auto centerOfMass  = Vector3::Zero();
+  auto boundsMinimum = Vector3(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::max());
+  auto boundsMaximum = boundsMinimum.scale(-1.f);
+  std::vector<CollisionShape::MassProperties> properties;
+  properties.reserve(shapes.size());
+  for (const auto& shape : shapes) {
+    auto shapeProperties   = shape.shape->computeMassProperties();
+    const auto shapeCenter = shape.localPosition.subtract(originOffset)
+                               .add(Matrix3x3::FromQuaternion(shape.localRotation)
+                                      .transform(shapeProperties.centerOfMass));
+    volume += shapeProperties.volume;
+    centerOfMass.addInPlace(shapeCenter.scale(shapeProperties.volume));
+    shapeProperties.centerOfMass = shapeCenter;
+    properties.emplace_back(shapeProperties);
+
+    const auto shapeRadius = shape.shape->boundingRadius();
+    const auto origin      = shape.localPosition.subtract(originOffset);
+    boundsMinimum.minimizeInPlace(origin.subtract(Vector3(shapeRadius, shapeRadius, shapeRadius)));
+    boundsMaximum.maximizeInPlace(origin.add(Vector3(shapeRadius, shapeRadius, shapeRadius)));
+  }
+
+  const auto dynamic = iMass > 0.f && !shapes.empty();
+  if (dynamic && volume > 0.f) {
+    centerOfMass.scaleInPlace(1.f / volume);
+  }
+  else {
+    centerOfMass = Vector3::Zero();
+  }
+
+  // Move the center of mass, keeping the origin in place
+  const auto newOriginOffset = centerOfMass.scale(-1.f);
+  const auto shift           = newOriginOffset.subtract(originOffset);
+  for (auto& shape : shapes) {
+    shape.localPosition.addInPlace(shift);
+  }
+  position.subtractInPlace(rotation.transform(shift));
+  originOffset = newOriginOffset;
+
+  if (!dynamic) {
+    massValue       = 0.f;
+    invMass         = 0.f;
+    invInertiaLocal = Matrix3x3::Zero();
+    linearVel       = Vector3::Zero();
+    angularVel      = Vector3::Zero();
+    updateWorldData();
+    return;
+  }
+
+  auto inertia = Matrix3x3::Zero();
+  if (volume > 0.f) {
+    for (size_t i = 0; i < shapes.size(); ++i) {
+      const auto& shapeProperties = properties[i];
+      const auto shapeRotation    = Matrix3x3::FromQuaternion(shapes[i].localRotation);
+      const auto d                = shapeProperties.centerOfMass.subtract(centerOfMass);
+      const auto dd               = Vector3::Dot(d, d);
+      auto shapeInertia
+        = shapeRotation.multiply(shapeProperties.inertia).multiply(shapeRotation.transpose());
+      // Parallel axis theorem
+      Matrix3x3 translation;
+      translation.m = {{dd - d.x * d.x, -d.x * d.y, -d.x * d.z, //
+                        -d.y * d.x, dd - d.y * d.y, -d.y * d.z, //
+                        -d.z * d.x, -d.z * d.y, dd - d.z * d.z}};
+      inertia = inertia.add(shapeInertia).add(translation.scale(shapeProperties.volume));
+    }
+    inertia = inertia.scale(iMass / volume);
+  }
+  else {
+    // Shapes without volume: inertia of their bounds
+    auto boxVolume = 0.f;
+    inertia        = BoxInertia(boundsMaximum.subtract(boundsMinimum), boxVolume);
+    inertia        = inertia.scale(boxVolume > 0.f ? iMass / boxVolume : 0.f);
+  }
+
+  massValue = iMass;
+  invMass   = 1.f / iMass;
+  if (!inertia.invert(invInertiaLocal)) {
+    invInertiaLocal = Matrix3x3::Zero();
+  }
+  updateWorldData();
+}
+
+void RigidBody::setOriginTransformation(const Vector3& iOriginPosition,
+                                        const Quaternion& iOriginRotation)
+{
+  orientation = iOriginRotation;
+  orientation.normalize();
+  rotation = Matrix3x3::FromQuaternion(orientation);
+  position = iOriginPosition.subtract(rotation.transform(originOffset));
+  updateWorldData();
+}
+
+Vector3 RigidBody::originPosition() const
+{
+  return position.add(rotation.transform(originOffset));
+}
+
+void RigidBody::updateWorldData()
+{
+  rotation        = Matrix3x3::FromQuaternion(orientation);
+  invInertiaWorld = rotation.multiply(invInertiaLocal).multiply(rotation.transpose());
+
+  const auto maxFloat = std::numeric_limits<float>::max();
+  minimum.copyFromFloats(maxFloat, maxFloat, maxFloat);
+  maximum.copyFromFloats(-maxFloat, -maxFloat, -maxFloat);
+
+  for (auto& shape : shapes) {
+    shape.worldRotation        = orientation.multiply(shape.localRotation);
+    shape.worldRotationMatrix  = Matrix3x3::FromQuaternion(shape.worldRotation);
+    shape.worldPosition        = position.add(rotation.transform(shape.localPosition));
+    const auto& matrix         = shape.worldRotationMatrix;
+    const auto& collisionShape = *shape.shape;
+
+    shape.minimum.copyFromFloats(maxFloat, maxFloat, maxFloat);
+    shape.maximum.copyFromFloats(-maxFloat, -maxFloat, -maxFloat);
+
+    if (collisionShape.type == CollisionShape::Type::TriangleMesh) {
+      // Bounds of the transformed local bounds
+      for (unsigned int corner = 0; corner < 8; ++corner) {
+        const Vector3 localCorner((corner & 1) ? shape.localMaximum.x : shape.localMinimum.x,
+                                  (corner & 2) ? shape.localMaximum.y : shape.localMinimum.y,
+                                  (corner & 4) ? shape.localMaximum.z : shape.localMinimum.z);
+        const auto worldCorner = shape.worldPosition.add(matrix.transform(localCorner));
+        shape.minimum.minimizeInPlace(worldCorner);
+        shape.maximum.maximizeInPlace(worldCorner);
+      }
+    }
+    else {
+      const auto vertexCount = collisionShape.vertices.size();
+      shape.worldVertices.resize(vertexCount);
+      for (size_t i = 0; i < vertexCount; ++i) {
+        shape.worldVertices[i]
+          = shape.worldPosition.add(matrix.transform(collisionShape.vertices[i]));
+        shape.minimum.minimizeInPlace(shape.worldVertices[i]);
+        shape.maximum.maximizeInPlace(shape.worldVertices[i]);
+      }
+      const auto r = collisionShape.radius;
+      shape.minimum.addInPlaceFromFloats(-r, -r, -r);
+      shape.maximum.addInPlaceFromFloats(r, r, r);
+
+      const auto faceCount = collisionShape.faces.size();
+      shape.worldFaceNormals.resize(faceCount);
+      shape.worldFaceOffsets.resize(faceCount);
+      for (size_t i = 0; i < faceCount; ++i) {
+        const auto& face          = collisionShape.faces[i];
+        shape.worldFaceNormals[i] = matrix.transform(face.normal);
+        shape.worldFaceOffsets[i] = face.offset + Vector3::Dot(shape.worldFaceNormals[i],
+                                                               shape.worldPosition);
+      }
+
+      const auto directionCount = collisionShape.edgeDirections.size();
+      shape.worldEdgeDirections.resize(directionCount);
+      for (size_t i = 0; i < directionCount; ++i) {
+        shape.worldEdgeDirections[i] = matrix.transform(collisionShape.edgeDirections[i]);
+      }
+    }
+
+    minimum.minimizeInPlace(shape.minimum);
+    maximum.maximizeInPlace(shape.maximum);
+  }
+
+  if (shapes.empty()) {
+    minimum = position;
+    maximum = position;
+  }
+}
+
+void RigidBody::applyImpulseAt(const Vector3& impulse, const Vector3& point)
+{
+  if (isStatic()) {
+    return;
+  }
+  linearVel.addInPlace(impulse.scale(invMass));
+  angularVel.addInPlace(
+    invInertiaWorld.transform(Vector3::Cross(point.subtract(position), impulse)));
+}
+
+Vector3 RigidBody::velocityAt(const Vector3& point) const
+{
+  return linearVel.add(Vector3::Cross(angularVel, point.subtract(position)));
+}
+
+void RigidBody::setPosition(const Vector3& newPosition)
+{
+  setOriginTransformation(newPosition, orientation);
+}
+
+void RigidBody::setOrientation(const Quaternion& newRotation)
+{
+  setOriginTransformation(originPosition(), newRotation);
+}
+
+void RigidBody::setShapesDensity(float density)
+{
+  auto volume = 0.f;
+  for (const auto& shape : shapes) {
+    volume += shape.shape->computeMassProperties().volume;
+  }
+  setMass(density * volume);
+}
+
+void RigidBody::setupMass(int iMass)
+{
+  setMass(static_cast<float>(iMass));
+}
+
+float RigidBody::mass()
+{
+  return massValue;
+}
+
+void RigidBody::applyImpulse(const Vector3& iPosition, const Vector3& iForce)
+{
+  awake();
+  applyImpulseAt(iForce, iPosition);
+}
+
+Vector3 RigidBody::angularVelocity()
+{
+  return angularVel;
+}
+
+void RigidBody::setAngularVelocity(const Vector3& velocity)
+{
+  if (!isStatic()) {
+    angularVel = velocity;
+    awake();
+  }
+}
+
+Vector3 RigidBody::linearVelocity()
+{
+  return linearVel;
+}
+
+void RigidBody::setLinearVelocity(const Vector3& velocity)
+{
+  if (!isStatic()) {
+    linearVel = velocity;
+    awake();
+  }
+}
+
+void RigidBody::sleep()
+{
+  if (isStatic()) {
+    return;
+  }
+  isSleeping = true;
+  linearVel  = Vector3::Zero();
+  angularVel = Vector3::Zero();
+}
+
+bool RigidBody::sleeping()
+{
+  return isSleeping;
+}
+
+void RigidBody::awake()
+{
+  isSleeping = false;
+  sleepTime  = 0.f;
+}
+
+void RigidBody::syncShapes()
+{
+  updateWorldData();
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,362 @@
+#include <babylon/physics/plugins/native/rigid_body_joint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/physics/plugins/native/rigid_body.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Fraction of the position error corrected at each step
+constexpr float Baumgarte = 0.2f;
+constexpr float Infinity  = std::numeric_limits<float>::infinity();
+
+/**
+ * @brief Returns a unit vector perpendicular to a unit vector.
+ */
+Vector3 Perpendicular(const Vector3& v)
+{
+  const auto ax = std::abs(v.x), ay = std::abs(v.y), az = std::abs(v.z);
+  const auto other = (ax <= ay && ax <= az) ? Vector3(1.f, 0.f, 0.f) :
+                     (ay <= az)             ? Vector3(0.f, 1.f, 0.f) :
+                                              Vector3(0.f, 0.f, 1.f);
+  return Vector3::Cross(v, other).normalize();
+}
+
+Vector3 SafeNormalize(const Vector3& v, const Vector3& fallback)
+{
+  const auto length = v.length();
+  return length > 1e-6f ? v.scale(1.f / length) : fallback;
+}
+
+} // end of anonymous namespace
+
+RigidBodyJoint::RigidBodyJoint(Type iType, RigidBody* iBodyA, RigidBody* iBodyB,
+                               const Vector3& pivotA, const Vector3& pivotB, const Vector3& axisA,
+                               const Vector3& axisB, bool collision)
+    : type{iType}
+    , bodyA{iBodyA}
+    , bodyB{iBodyB}
+    , collisionEnabled{collision}
+    , _pivotA{pivotA}
+    , _pivotB{pivotB}
+    , _axisA{SafeNormalize(axisA, Vector3(1.f, 0.f, 0.f))}
+    , _axisB{SafeNormalize(axisB, Vector3(1.f, 0.f, 0.f))}
+    , _axesDot{0.f}
+    , _maxDistance{0.f}
+    , _minDistance{0.f}
+    , _stiffness{100.f}
+    , _damping{1.f}
+    , _rowCount{0}
+{
+  _impulses.fill(0.f);
+  _activeSlots.fill(false);
+
+  // Reference vectors measuring the angle around the axes, equal in the initial configuration
+  _referenceA = Perpendicular(_axisA);
+  _referenceB = bodyB->rotation.transposeTransform(bodyA->rotation.transform(_referenceA));
+  _axesDot    = Vector3::Dot(bodyA->rotation.transform(_axisA), bodyB->rotation.transform(_axisB));
+  _relativeRotation = bodyA->orientation.conjugate().multiply(bodyB->orientation);
+  _relativePosition
+    = bodyA->rotation.transposeTransform(bodyB->position.subtract(bodyA->position));
+
+  _maxDistance = pivotDistance();
+}
+
+RigidBodyJoint::~RigidBodyJoint() = default;
+
+void RigidBodyJoint::setMotor(float speed, float maxForce, unsigned int motorIndex)
+{
+  if (motorIndex < _motors.size()) {
+    _motors[motorIndex].enabled  = true;
+    _motors[motorIndex].speed    = speed;
+    _motors[motorIndex].maxForce = maxForce;
+  }
+}
+
+void RigidBodyJoint::setLimit(float upperLimit, float lowerLimit, unsigned int motorIndex)
+{
+  if (motorIndex < _motors.size()) {
+    _motors[motorIndex].limited = true;
+    _motors[motorIndex].upper   = upperLimit;
+    _motors[motorIndex].lower   = lowerLimit;
+  }
+}
+
+void RigidBodyJoint::setDistanceLimits(float maxDistance, float minDistance)
+{
+  _maxDistance = maxDistance;
+  _minDistance = minDistance;
+}
+
+void RigidBodyJoint::setSpring(float stiffness, float damping)
+{
+  _stiffness = stiffness;
+  _damping   = damping;
+}
+
+float RigidBodyJoint::pivotDistance() const
+{
+  const auto pivotA
+    = bodyA->position.add(bodyA->rotation.transform(_pivotA.add(bodyA->originOffset)));
+  const auto pivotB
+    = bodyB->position.add(bodyB->rotation.transform(_pivotB.add(bodyB->originOffset)));
+  return Vector3::Distance(pivotA, pivotB);
+}
+
+void RigidBodyJoint::_addRow(unsigned int slot, const Vector3& linearA, const Vector3& angularA,
+                             const Vector3& linearB, const Vector3& angularB, float bias,
+                             float lowerImpulse, float upperImpulse)
+{
+  auto& row           = _rows[_rowCount];
+  row.slot            = slot;
+  row.linearA         = linearA;
+  row.angularA        = angularA;
+  row.linearB         = linearB;
+  row.angularB        = angularB;
+  row.inertiaAngularA = bodyA->invInertiaWorld.transform(angularA);
+  row.inertiaAngularB = bodyB->invInertiaWorld.transform(angularB);
+  row.bias            = bias;
+  row.lowerImpulse    = lowerImpulse;
+  row.upperImpulse    = upperImpulse;
+
+  const auto k = bodyA->invMass * linearA.lengthSquared()
+                 + Vector3::Dot(angularA, row.inertiaAngularA)
+                 + bodyB->invMass * linearB.lengthSquared()
+                 + Vector3::Dot(angularB, row.inertiaAngularB);
+  row.effectiveMass = k > 1e-12f ? 1.f / k : 0.f;
+
+  _activeSlots[slot] = true;
+  ++_rowCount;
+}
+
+void RigidBodyJoint::_addLimitRows(unsigned int slot, float value, const Vector3& linearA,
+                                   const Vector3& angularA, const Vector3& linearB,
+                                   const Vector3& angularB, float lower, float upper, float dt)
+{
+  // Speculative limits: the slack to the limit is allowed in one step, a violation is corrected
+  const auto lowerError = value - lower;
+  _addRow(slot, linearA, angularA, linearB, angularB,
+          lowerError < 0.f ? Baumgarte * lowerError / dt : lowerError / dt, 0.f, Infinity);
+  const auto upperError = value - upper;
+  _addRow(slot + 1, linearA, angularA, linearB, angularB,
+          upperError > 0.f ? Baumgarte * upperError / dt : upperError / dt, -Infinity, 0.f);
+}
+
+void RigidBodyJoint::prepare(float dt)
+{
+  _rowCount                = 0;
+  const auto previousSlots = _activeSlots;
+  _activeSlots.fill(false);
+
+  const auto invDt  = 1.f / dt;
+  const auto rA     = bodyA->rotation.transform(_pivotA.add(bodyA->originOffset));
+  const auto rB     = bodyB->rotation.transform(_pivotB.add(bodyB->originOffset));
+  const auto d      = bodyB->position.add(rB).subtract(bodyA->position.add(rA));
+  const auto axisA  = bodyA->rotation.transform(_axisA);
+  const auto axisB  = bodyB->rotation.transform(_axisB);
+  const auto motor0 = _motors[0];
+  const auto motor1 = _motors[1];
+
+  // Levers of the linear rows, from the centers of mass to the pivot of B. When the relative
+  // rotation is locked, the rows act on the center of mass of B instead, which decouples them from
+  // the angular rows
+  const auto lockedRotation = type == Type::Prismatic;
+  const auto leverA
+    = lockedRotation ? bodyB->position.subtract(bodyA->position) : rA.add(d);
+  const auto leverB = lockedRotation ? Vector3::Zero() : rB;
+
+  const auto maxImpulse = [dt](const Motor& motor) {
+    return motor.maxForce > 0.f ? motor.maxForce * dt : Infinity;
+  };
+  // Translation of the pivot of B along a direction fixed in A
+  const auto addLinearRow = [&](unsigned int slot, const Vector3& direction) {
+    _addRow(slot, direction.scale(-1.f), Vector3::Cross(leverA, direction).scale(-1.f), direction,
+            Vector3::Cross(leverB, direction), Baumgarte * invDt * Vector3::Dot(d, direction),
+            -Infinity, Infinity);
+  };
+  // Common point, of relative position pointA (resp. pointB) to the center of mass of A (resp. B)
+  const auto addPointRows = [&](const Vector3& pointA, const Vector3& pointB) {
+    static const std::array<Vector3, 3> axes{
+      {Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f)}};
+    const auto error = bodyB->position.add(pointB).subtract(bodyA->position.add(pointA));
+    for (unsigned int i = 0; i < 3; ++i) {
+      const auto& e = axes[i];
+      _addRow(i, e.scale(-1.f), Vector3::Cross(pointA, e).scale(-1.f), e,
+              Vector3::Cross(pointB, e), Baumgarte * invDt * Vector3::Dot(error, e), -Infinity,
+              Infinity);
+    }
+  };
+  // Rotation around a world axis (dot(u, v) = target for u in A and v in B)
+  const auto addAngularRow = [&](unsigned int slot, const Vector3& u, const Vector3& v,
+                                 float target) {
+    const auto n = Vector3::Cross(v, u);
+    _addRow(slot, Vector3::Zero(), n.scale(-1.f), Vector3::Zero(), n,
+            Baumgarte * invDt * (Vector3::Dot(u, v) - target), -Infinity, Infinity);
+  };
+  // Common axis
+  const auto addAlignmentRows = [&]() {
+    const auto perpendicular0 = Perpendicular(axisB);
+    const auto perpendicular1 = Vector3::Cross(axisB, perpendicular0);
+    addAngularRow(3, axisA, perpendicular0, 0.f);
+    addAngularRow(4, axisA, perpendicular1, 0.f);
+  };
+  // No relative rotation
+  const auto addLockRows = [&]() {
+    auto error = bodyB->orientation.multiply(
+      bodyA->orientation.multiply(_relativeRotation).conjugate());
+    if (error.w < 0.f) {
+      error.scaleInPlace(-1.f);
+    }
+    const std::array<Vector3, 3> axes{
+      {Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f)}};
+    const std::array<float, 3> errors{{2.f * error.x, 2.f * error.y, 2.f * error.z}};
+    for (unsigned int i = 0; i < 3; ++i) {
+      _addRow(3 + i, Vector3::Zero(), axes[i].scale(-1.f), Vector3::Zero(), axes[i],
+              Baumgarte * invDt * errors[i], -Infinity, Infinity);
+    }
+  };
+  const auto addAngularMotor = [&](unsigned int slot, const Motor& motor, const Vector3& axis) {
+    if (motor.enabled) {
+      _addRow(slot, Vector3::Zero(), axis.scale(-1.f), Vector3::Zero(), axis, -motor.speed,
+              -maxImpulse(motor), maxImpulse(motor));
+    }
+  };
+  const auto addLinearMotor = [&](unsigned int slot, const Motor& motor, const Vector3& axis) {
+    if (motor.enabled) {
+      _addRow(slot, axis.scale(-1.f), Vector3::Cross(leverA, axis).scale(-1.f), axis,
+              Vector3::Cross(leverB, axis), -motor.speed, -maxImpulse(motor), maxImpulse(motor));
+    }
+  };
+  const auto addLinearLimit = [&](const Vector3& axis) {
+    if (motor0.limited) {
+      _addLimitRows(8, Vector3::Dot(d, axis), axis.scale(-1.f),
+                    Vector3::Cross(leverA, axis).scale(-1.f), axis, Vector3::Cross(leverB, axis),
+                    motor0.lower, motor0.upper, dt);
+    }
+  };
+
+  switch (type) {
+    case Type::Distance: {
+      const auto distance = d.length();
+      const auto n        = SafeNormalize(d, Vector3(0.f, 1.f, 0.f));
+      const auto angularA = Vector3::Cross(rA, n).scale(-1.f);
+      const auto angularB = Vector3::Cross(rB, n);
+      const auto maxError = distance - _maxDistance;
+      _addRow(0, n.scale(-1.f), angularA, n, angularB,
+              maxError > 0.f ? Baumgarte * maxError * invDt : maxError * invDt, -Infinity, 0.f);
+      if (_minDistance > 0.f) {
+        const auto minError = distance - _minDistance;
+        _addRow(1, n.scale(-1.f), angularA, n, angularB,
+                minError < 0.f ? Baumgarte * minError * invDt : minError * invDt, 0.f, Infinity);
+      }
+    } break;
+    case Type::Spring: {
+      // Damped spring force applied as an impulse
+      const auto distance = d.length();
+      const auto n        = SafeNormalize(d, Vector3(0.f, 1.f, 0.f));
+      const auto pointA   = bodyA->position.add(rA);
+      const auto pointB   = bodyB->position.add(rB);
+      const auto speed
+        = Vector3::Dot(bodyB->velocityAt(pointB).subtract(bodyA->velocityAt(pointA)), n);
+      const auto impulse = (-_stiffness * (distance - _maxDistance) - _damping * speed) * dt;
+      bodyA->applyImpulseAt(n.scale(-impulse), pointA);
+      bodyB->applyImpulseAt(n.scale(impulse), pointB);
+    } break;
+    case Type::BallAndSocket:
+      addPointRows(rA, rB);
+      break;
+    case Type::Hinge: {
+      addPointRows(rA, rB);
+      addAlignmentRows();
+      addAngularMotor(6, motor0, axisA);
+      if (motor0.limited) {
+        const auto referenceA = bodyA->rotation.transform(_referenceA);
+        const auto referenceB = bodyB->rotation.transform(_referenceB);
+        const auto angle
+          = std::atan2(Vector3::Dot(Vector3::Cross(referenceA, referenceB), axisA),
+                       Vector3::Dot(referenceA, referenceB));
+        _addLimitRows(8, angle, Vector3::Zero(), axisA.scale(-1.f), Vector3::Zero(), axisA,
+                      motor0.lower, motor0.upper, dt);
+      }
+    } break;
+    case Type::Hinge2:
+      addPointRows(rA, rB);
+      addAngularRow(3, axisA, axisB, _axesDot);
+      addAngularMotor(6, motor0, axisA);
+      addAngularMotor(7, motor1, axisB);
+      break;
+    case Type::Universal:
+      addPointRows(rA, rB);
+      addAngularRow(3, axisA, axisB, _axesDot);
+      break;
+    case Type::Slider: {
+      const auto perpendicular0 = Perpendicular(axisA);
+      addLinearRow(0, perpendicular0);
+      addLinearRow(1, Vector3::Cross(axisA, perpendicular0));
+      addAlignmentRows();
+      addLinearMotor(6, motor0, axisA);
+      addLinearLimit(axisA);
+    } break;
+    case Type::Prismatic: {
+      const auto perpendicular0 = Perpendicular(axisA);
+      addLinearRow(0, perpendicular0);
+      addLinearRow(1, Vector3::Cross(axisA, perpendicular0));
+      addLockRows();
+      addLinearMotor(6, motor0, axisA);
+      addLinearLimit(axisA);
+    } break;
+    case Type::Lock:
+      // The center of mass of B is locked rather than the pivot, which decouples the linear rows
+      // from the angular ones
+      addPointRows(bodyA->rotation.transform(_relativePosition), Vector3::Zero());
+      addLockRows();
+      break;
+  }
+
+  // Warm starting, the impulses of the slots unused by the previous step are reset
+  for (unsigned int slot = 0; slot < MaxSlots; ++slot) {
+    if (!_activeSlots[slot] || !previousSlots[slot]) {
+      _impulses[slot] = 0.f;
+    }
+  }
+  for (size_t i = 0; i < _rowCount; ++i) {
+    const auto& row = _rows[i];
+    auto& impulse   = _impulses[row.slot];
+    impulse         = std::clamp(impulse, row.lowerImpulse, row.upperImpulse);
+    _applyImpulse(row, impulse);
+  }
+}
+
+void RigidBodyJoint::_applyImpulse(const Row& row, float impulse)
+{
+  if (!bodyA->isStatic()) {
+    bodyA->linearVel.addInPlace(row.linearA.scale(bodyA->invMass * impulse));
+    bodyA->angularVel.addInPlace(row.inertiaAngularA.scale(impulse));
+  }
+  if (!bodyB->isStatic()) {
+    bodyB->linearVel.addInPlace(row.linearB.scale(bodyB->invMass * impulse));
+    bodyB->angularVel.addInPlace(row.inertiaAngularB.scale(impulse));
+  }
+}
+
+void RigidBodyJoint::solve()
+{
+  for (size_t i = 0; i < _rowCount; ++i) {
+    const auto& row = _rows[i];
+    const auto velocity
+      = Vector3::Dot(row.linearA, bodyA->linearVel) + Vector3::Dot(row.angularA, bodyA->angularVel)
+        + Vector3::Dot(row.linearB, bodyB->linearVel)
+        + Vector3::Dot(row.angularB, bodyB->angularVel);
+    auto& accumulated   = _impulses[row.slot];
+    const auto previous = accumulated;
+    accumulated         = std::clamp(previous - row.effectiveMass * (velocity + row.bias),
+                                     row.lowerImpulse, row.upperImpulse);
+    _applyImpulse(row, accumulated - previous);
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,666 @@
+#include <babylon/physics/plugins/native/rigid_body_world.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/physics/plugins/native/narrow_phase.h>
+#include <babylon/physics/plugins/native/rigid_body.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Fraction of the penetration corrected at each step, and penetration allowed without correction
+constexpr float Baumgarte       = 0.2f;
+constexpr float PenetrationSlop = 0.005f;
+
+// Approach speed above which the restitution is applied
+constexpr float RestitutionSpeed = 1.f;
+
+// Squared linear and angular speeds under which a body is at rest, and time before sleeping
+constexpr float SleepSpeedSquared = 0.01f;
+constexpr float TimeToSleep       = 0.5f;
+
+// Distance under which the contacts of consecutive steps are matched for warm starting
+constexpr float ContactMatchDistance = 0.05f;
+
+// Maximum speculative distance of the fast moving bodies
+constexpr float MaxSpeculativeDistance = 1.f;
+
+// Number of collision pairs per parallel narrow phase job
+constexpr size_t PairGrainSize = 16;
+
+void ApplyImpulse(RigidBody* body, const Vector3& impulse, const Vector3& r)
+{
+  if (body->isStatic()) {
+    return;
+  }
+  body->linearVel.addInPlace(impulse.scale(body->invMass));
+  body->angularVel.addInPlace(body->invInertiaWorld.transform(Vector3::Cross(r, impulse)));
+}
+
+float EffectiveMass(const RigidBody* bodyA, const RigidBody* bodyB, const Vector3& rA,
+                    const Vector3& rB, const Vector3& direction)
+{
+  const auto rnA = Vector3::Cross(rA, direction);
+  const auto rnB = Vector3::Cross(rB, direction);
+  const auto k   = bodyA->invMass + bodyB->invMass
+                 + Vector3::Dot(rnA, bodyA->invInertiaWorld.transform(rnA))
+                 + Vector3::Dot(rnB, bodyB->invInertiaWorld.transform(rnB));
+  return k > 1e-12f ? 1.f / k : 0.f;
+}
+
+bool BoundsOverlap(const Vector3& minimumA, const Vector3& maximumA, const Vector3& minimumB,
+                   const Vector3& maximumB, float margin)
+{
+  return minimumA.x <= maximumB.x + margin && minimumB.x <= maximumA.x + margin
+         && minimumA.y <= maximumB.y + margin && minimumB.y <= maximumA.y + margin
+         && minimumA.z <= maximumB.z + margin && minimumB.z <= maximumA.z + margin;
+}
+
+/**
+ * @brief Generates the contacts of a convex shape with the triangles of a triangle mesh shape
+ * overlapping its bounds.
+ */
+void CollideMesh(const RigidBody::Shape& convex, const RigidBody::Shape& mesh, float margin,
+                 std::vector<NarrowPhase::Contact>& contacts)
+{
+  thread_local std::vector<TriangleBVH::Triangle> triangles;
+  const auto& meshShape = *mesh.shape;
+  if (!meshShape.triangleBVH) {
+    return;
+  }
+
+  // Bounds of the convex shape in the space of the mesh
+  const auto& matrix  = mesh.worldRotationMatrix;
+  const auto maxFloat = std::numeric_limits<float>::max();
+  Vector3 minimum(maxFloat, maxFloat, maxFloat);
+  Vector3 maximum(-maxFloat, -maxFloat, -maxFloat);
+  for (unsigned int corner = 0; corner < 8; ++corner) {
+    const Vector3 worldCorner((corner & 1) ? convex.maximum.x + margin : convex.minimum.x - margin,
+                              (corner & 2) ? convex.maximum.y + margin : convex.minimum.y - margin,
+                              (corner & 4) ? convex.maximum.z + margin : convex.minimum.z - margin);
+    const auto localCorner = matrix.transposeTransform(worldCorner.subtract(mesh.worldPosition));
+    minimum.minimizeInPlace(localCorner);
+    maximum.maximizeInPlace(localCorner);
+  }
+
+  triangles.clear();
+  meshShape.triangleBVH->collectTriangles(minimum, maximum, triangles);
+  if (triangles.empty()) {
+    return;
+  }
+
+  const auto polytope = convex.polytope();
+  const auto toWorld  = [&](uint32_t index) {
+    return mesh.worldPosition.add(matrix.transform(meshShape.vertices[index]));
+  };
+  for (const auto& triangle : triangles) {
+    const std::array<Vector3, 3> vertices{
+      {toWorld(triangle.indexA), toWorld(triangle.indexB), toWorld(triangle.indexC)}};
+    NarrowPhase::CollideTriangle(polytope, vertices, margin, contacts);
+  }
+}
+
+} // end of anonymous namespace
+
+RigidBodyWorld::RigidBodyWorld()
+    : _gravity{Vector3(0.f, -9.807f, 0.f)}, _solverIterations{10}, _nextBodyId{0}, _islandCount{0}
+{
+}
+
+RigidBodyWorld::~RigidBodyWorld() = default;
+
+void RigidBodyWorld::setGravity(const Vector3& gravity)
+{
+  _gravity = gravity;
+  for (auto& body : _bodies) {
+    body->awake();
+  }
+}
+
+const Vector3& RigidBodyWorld::gravity() const
+{
+  return _gravity;
+}
+
+void RigidBodyWorld::setSolverIterations(size_t iterations)
+{
+  _solverIterations = std::max<size_t>(iterations, 1);
+}
+
+size_t RigidBodyWorld::solverIterations() const
+{
+  return _solverIterations;
+}
+
+RigidBody* RigidBodyWorld::createBody()
+{
+  auto body   = std::make_unique<RigidBody>(_nextBodyId++);
+  body->index = _bodies.size();
+  _bodies.emplace_back(std::move(body));
+  _broadphase.addBody(_bodies.back().get());
+  return _bodies.back().get();
+}
+
+void RigidBodyWorld::removeBody(RigidBody* body)
+{
+  _joints.erase(std::remove_if(_joints.begin(), _joints.end(),
+                               [body](const std::unique_ptr<RigidBodyJoint>& joint) {
+                                 if (joint->bodyA != body && joint->bodyB != body) {
+                                   return false;
+                                 }
+                                 joint->bodyA->awake();
+                                 joint->bodyB->awake();
+                                 return true;
+                               }),
+                _joints.end());
+
+  for (auto it = _manifolds.begin(); it != _manifolds.end();) {
+    auto& manifold = it->second;
+    if (manifold.bodyA == body || manifold.bodyB == body) {
+      (manifold.bodyA == body ? manifold.bodyB : manifold.bodyA)->awake();
+      it = _manifolds.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  _broadphase.removeBody(body);
+  _bodies.erase(std::remove_if(_bodies.begin(), _bodies.end(),
+                               [body](const std::unique_ptr<RigidBody>& other) {
+                                 return other.get() == body;
+                               }),
+                _bodies.end());
+  for (size_t i = 0; i < _bodies.size(); ++i) {
+    _bodies[i]->index = i;
+  }
+}
+
+RigidBodyJoint* RigidBodyWorld::createJoint(RigidBodyJoint::Type type, RigidBody* bodyA,
+                                            RigidBody* bodyB, const Vector3& pivotA,
+                                            const Vector3& pivotB, const Vector3& axisA,
+                                            const Vector3& axisB, bool collision)
+{
+  bodyA->awake();
+  bodyB->awake();
+  _joints.emplace_back(std::make_unique<RigidBodyJoint>(type, bodyA, bodyB, pivotA, pivotB,
+                                                        axisA, axisB, collision));
+  return _joints.back().get();
+}
+
+void RigidBodyWorld::removeJoint(RigidBodyJoint* joint)
+{
+  joint->bodyA->awake();
+  joint->bodyB->awake();
+  _joints.erase(std::remove_if(_joints.begin(), _joints.end(),
+                               [joint](const std::unique_ptr<RigidBodyJoint>& other) {
+                                 return other.get() == joint;
+                               }),
+                _joints.end());
+}
+
+void RigidBodyWorld::wakeUpBody(RigidBody* body)
+{
+  body->awake();
+  for (auto& [key, manifold] : _manifolds) {
+    if (manifold.bodyA == body) {
+      manifold.bodyB->awake();
+    }
+    else if (manifold.bodyB == body) {
+      manifold.bodyA->awake();
+    }
+  }
+}
+
+const std::vector<std::unique_ptr<RigidBody>>& RigidBodyWorld::bodies() const
+{
+  return _bodies;
+}
+
+uint64_t RigidBodyWorld::_PairKey(const RigidBody* bodyA, const RigidBody* bodyB)
+{
+  return (static_cast<uint64_t>(bodyA->id) << 32) | static_cast<uint64_t>(bodyB->id);
+}
+
+void RigidBodyWorld::step(float dt)
+{
+  if (dt <= 0.f) {
+    return;
+  }
+
+  // Broadphase on the bounds swept by the bodies during the step
+  for (auto& body : _bodies) {
+    if (body->isActive()) {
+      const auto displacement = body->linearVel.scale(dt);
+      body->minimum.addInPlaceFromFloats(std::min(displacement.x, 0.f),
+                                         std::min(displacement.y, 0.f),
+                                         std::min(displacement.z, 0.f));
+      body->maximum.addInPlaceFromFloats(std::max(displacement.x, 0.f),
+                                         std::max(displacement.y, 0.f),
+                                         std::max(displacement.z, 0.f));
+    }
+  }
+  _broadphase.computePairs(ContactMargin, _pairs);
+
+  // Bodies connected by joints do not collide, unless requested
+  std::unordered_set<uint64_t> jointPairs;
+  for (const auto& joint : _joints) {
+    if (!joint->collisionEnabled) {
+      jointPairs.insert(joint->bodyA->id < joint->bodyB->id ?
+                          _PairKey(joint->bodyA, joint->bodyB) :
+                          _PairKey(joint->bodyB, joint->bodyA));
+    }
+  }
+  if (!jointPairs.empty()) {
+    _pairs.erase(std::remove_if(_pairs.begin(), _pairs.end(),
+                                [&jointPairs](const SweepAndPrune::Pair& pair) {
+                                  return jointPairs.count(_PairKey(pair.first, pair.second)) > 0;
+                                }),
+                 _pairs.end());
+  }
+
+  // Narrow phase, the contacts of the pairs at rest are kept
+  std::vector<Manifold> manifolds(_pairs.size());
+  ThreadPool::Default().parallelFor(_pairs.size(), PairGrainSize, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      auto [bodyA, bodyB] = _pairs[i];
+      if (!bodyA->isActive() && !bodyB->isActive()) {
+        const auto it = _manifolds.find(_PairKey(bodyA, bodyB));
+        if (it != _manifolds.end()) {
+          manifolds[i] = it->second;
+        }
+        continue;
+      }
+      _collide(bodyA, bodyB, dt, manifolds[i]);
+    }
+  });
+  _manifolds.clear();
+  for (size_t i = 0; i < _pairs.size(); ++i) {
+    if (manifolds[i].pointCount > 0) {
+      _manifolds.emplace(_PairKey(_pairs[i].first, _pairs[i].second), manifolds[i]);
+    }
+  }
+
+  // Islands, solved in parallel
+  _buildIslands();
+  ThreadPool::Default().parallelFor(_islandCount, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      _solveIsland(_islands[i], dt);
+    }
+  });
+
+  for (auto& body : _bodies) {
+    body->force  = Vector3::Zero();
+    body->torque = Vector3::Zero();
+  }
+}
+
+void RigidBodyWorld::_collide(RigidBody* bodyA, RigidBody* bodyB, float dt,
+                              Manifold& manifold) const
+{
+  thread_local std::vector<NarrowPhase::Contact> contacts;
+  contacts.clear();
+
+  manifold.bodyA      = bodyA;
+  manifold.bodyB      = bodyB;
+  manifold.pointCount = 0;
+
+  // Speculative margin covering the relative motion of the step
+  const auto relativeSpeed = bodyA->linearVel.subtract(bodyB->linearVel).length();
+  const auto margin = ContactMargin + std::min(relativeSpeed * dt, MaxSpeculativeDistance);
+
+  for (const auto& shapeA : bodyA->shapes) {
+    for (const auto& shapeB : bodyB->shapes) {
+      if (!BoundsOverlap(shapeA.minimum, shapeA.maximum, shapeB.minimum, shapeB.maximum,
+                         margin)) {
+        continue;
+      }
+      const auto meshA = shapeA.shape->type == CollisionShape::Type::TriangleMesh;
+      const auto meshB = shapeB.shape->type == CollisionShape::Type::TriangleMesh;
+      if (meshA && meshB) {
+        continue;
+      }
+      if (!meshA && !meshB) {
+        NarrowPhase::Collide(shapeA.polytope(), shapeB.polytope(), margin, contacts);
+      }
+      else if (meshB) {
+        CollideMesh(shapeA, shapeB, margin, contacts);
+      }
+      else {
+        // Contacts generated from the convex shape B, swapped
+        const auto first = contacts.size();
+        CollideMesh(shapeB, shapeA, margin, contacts);
+        for (size_t i = first; i < contacts.size(); ++i) {
+          std::swap(contacts[i].pointA, contacts[i].pointB);
+          contacts[i].normal.scaleInPlace(-1.f);
+        }
+      }
+    }
+  }
+
+  if (contacts.empty()) {
+    return;
+  }
+  NarrowPhase::ReduceContacts(contacts, MaxManifoldPoints);
+
+  manifold.friction    = std::sqrt(bodyA->friction * bodyB->friction);
+  manifold.restitution = std::max(bodyA->restitution, bodyB->restitution);
+
+  const auto previous = _manifolds.find(_PairKey(bodyA, bodyB));
+  for (const auto& contact : contacts) {
+    auto& point = manifold.points[manifold.pointCount++];
+    const auto middle = contact.pointA.add(contact.pointB).scale(0.5f);
+    point.localPointA
+      = bodyA->rotation.transposeTransform(contact.pointA.subtract(bodyA->position));
+    point.rA              = middle.subtract(bodyA->position);
+    point.rB              = middle.subtract(bodyB->position);
+    point.normal          = contact.normal;
+    point.depth           = contact.depth;
+    point.normalImpulse   = 0.f;
+    point.tangentImpulse0 = 0.f;
+    point.tangentImpulse1 = 0.f;
+
+    // Warm starting from the matching contact of the previous step
+    if (previous != _manifolds.end()) {
+      const auto& previousManifold = previous->second;
+      for (size_t i = 0; i < previousManifold.pointCount; ++i) {
+        const auto& previousPoint = previousManifold.points[i];
+        if (Vector3::DistanceSquared(previousPoint.localPointA, point.localPointA)
+            < ContactMatchDistance * ContactMatchDistance) {
+          point.normalImpulse   = previousPoint.normalImpulse;
+          point.tangentImpulse0 = previousPoint.tangentImpulse0;
+          point.tangentImpulse1 = previousPoint.tangentImpulse1;
+          break;
+        }
+      }
+    }
+  }
+}
+
+void RigidBodyWorld::_buildIslands()
+{
+  // Union find of the dynamic bodies connected by contacts or joints
+  const auto bodyCount = _bodies.size();
+  std::vector<size_t> parents(bodyCount);
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find = [&parents](size_t index) {
+    while (parents[index] != index) {
+      parents[index] = parents[parents[index]];
+      index          = parents[index];
+    }
+    return index;
+  };
+  const auto unite = [&](const RigidBody* bodyA, const RigidBody* bodyB) {
+    if (!bodyA->isStatic() && !bodyB->isStatic()) {
+      const auto rootA = find(bodyA->index);
+      const auto rootB = find(bodyB->index);
+      parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+  };
+  for (const auto& [key, manifold] : _manifolds) {
+    unite(manifold.bodyA, manifold.bodyB);
+  }
+  for (const auto& joint : _joints) {
+    unite(joint->bodyA, joint->bodyB);
+  }
+
+  constexpr auto NoIsland = std::numeric_limits<size_t>::max();
+  std::vector<size_t> islandOfRoot(bodyCount, NoIsland);
+  for (auto& island : _islands) {
+    island.bodies.clear();
+    island.manifolds.clear();
+    island.joints.clear();
+  }
+  _islandCount = 0;
+  const auto islandOf = [&](const RigidBody* body) -> Island& {
+    auto& islandIndex = islandOfRoot[find(body->index)];
+    if (islandIndex == NoIsland) {
+      islandIndex = _islandCount++;
+      if (_islands.size() < _islandCount) {
+        _islands.resize(_islandCount);
+      }
+    }
+    return _islands[islandIndex];
+  };
+  for (const auto& body : _bodies) {
+    if (!body->isStatic()) {
+      islandOf(body.get()).bodies.emplace_back(body.get());
+    }
+  }
+  // Manifolds are sorted to keep the solver deterministic
+  std::vector<Manifold*> manifolds;
+  manifolds.reserve(_manifolds.size());
+  for (auto& [key, manifold] : _manifolds) {
+    manifolds.emplace_back(&manifold);
+  }
+  std::sort(manifolds.begin(), manifolds.end(), [](const Manifold* a, const Manifold* b) {
+    return _PairKey(a->bodyA, a->bodyB) < _PairKey(b->bodyA, b->bodyB);
+  });
+  for (auto* manifold : manifolds) {
+    islandOf(manifold->bodyA->isStatic() ? manifold->bodyB : manifold->bodyA)
+      .manifolds.emplace_back(manifold);
+  }
+  for (const auto& joint : _joints) {
+    if (!joint->bodyA->isStatic() || !joint->bodyB->isStatic()) {
+      islandOf(joint->bodyA->isStatic() ? joint->bodyB : joint->bodyA)
+        .joints.emplace_back(joint.get());
+    }
+  }
+
+  // Islands with an awake body are woken up, the sleeping ones are skipped
+  size_t activeCount = 0;
+  for (size_t i = 0; i < _islandCount; ++i) {
+    auto& island     = _islands[i];
+    const auto awake = std::any_of(island.bodies.begin(), island.bodies.end(),
+                                   [](const RigidBody* body) { return !body->isSleeping; });
+    if (!awake) {
+      continue;
+    }
+    for (auto* body : island.bodies) {
+      if (body->isSleeping) {
+        body->awake();
+      }
+    }
+    std::swap(_islands[activeCount++], island);
+  }
+  _islandCount = activeCount;
+}
+
+void RigidBodyWorld::_solveIsland(Island& island, float dt) const
+{
+  const auto invDt = 1.f / dt;
+
+  // Velocities
+  for (auto* body : island.bodies) {
+    body->linearVel.addInPlace(_gravity.add(body->force.scale(body->invMass)).scale(dt));
+    body->angularVel.addInPlace(body->invInertiaWorld.transform(body->torque).scale(dt));
+    body->linearVel.scaleInPlace(1.f / (1.f + dt * body->linearDamping));
+    body->angularVel.scaleInPlace(1.f / (1.f + dt * body->angularDamping));
+  }
+
+  // Contacts
+  for (auto* manifold : island.manifolds) {
+    auto* bodyA = manifold->bodyA;
+    auto* bodyB = manifold->bodyB;
+    for (size_t i = 0; i < manifold->pointCount; ++i) {
+      auto& point        = manifold->points[i];
+      const auto& normal = point.normal;
+      const auto t       = std::abs(normal.x) < 0.57f ? Vector3(1.f, 0.f, 0.f) :
+                                                        Vector3(0.f, 1.f, 0.f);
+      point.tangent0     = Vector3::Cross(normal, t).normalize();
+      point.tangent1     = Vector3::Cross(normal, point.tangent0);
+      point.normalMass   = EffectiveMass(bodyA, bodyB, point.rA, point.rB, normal);
+      point.tangentMass0 = EffectiveMass(bodyA, bodyB, point.rA, point.rB, point.tangent0);
+      point.tangentMass1 = EffectiveMass(bodyA, bodyB, point.rA, point.rB, point.tangent1);
+
+      // Penetration recovery, or speculative approach of separated shapes
+      if (point.depth > PenetrationSlop) {
+        point.bias = -Baumgarte * invDt * (point.depth - PenetrationSlop);
+      }
+      else if (point.depth < 0.f) {
+        point.bias = -point.depth * invDt;
+      }
+      else {
+        point.bias = 0.f;
+      }
+      const auto approachSpeed
+        = Vector3::Dot(bodyB->linearVel.add(Vector3::Cross(bodyB->angularVel, point.rB))
+                         .subtract(bodyA->linearVel)
+                         .subtract(Vector3::Cross(bodyA->angularVel, point.rA)),
+                       normal);
+      if (approachSpeed < -RestitutionSpeed && point.depth - approachSpeed * dt > 0.f) {
+        point.bias = std::min(point.bias, manifold->restitution * approachSpeed);
+      }
+    }
+  }
+
+  // Warm starting, once the approach speeds of all the contacts are known
+  for (auto* manifold : island.manifolds) {
+    for (size_t i = 0; i < manifold->pointCount; ++i) {
+      const auto& point  = manifold->points[i];
+      const auto impulse = point.normal.scale(point.normalImpulse)
+                             .add(point.tangent0.scale(point.tangentImpulse0))
+                             .add(point.tangent1.scale(point.tangentImpulse1));
+      ApplyImpulse(manifold->bodyA, impulse.scale(-1.f), point.rA);
+      ApplyImpulse(manifold->bodyB, impulse, point.rB);
+    }
+  }
+
+  // Joints
+  for (auto* joint : island.joints) {
+    joint->prepare(dt);
+  }
+
+  // Sequential impulses
+  for (size_t iteration = 0; iteration < _solverIterations; ++iteration) {
+    for (auto* joint : island.joints) {
+      joint->solve();
+    }
+    for (auto* manifold : island.manifolds) {
+      auto* bodyA = manifold->bodyA;
+      auto* bodyB = manifold->bodyB;
+      for (size_t i = 0; i < manifold->pointCount; ++i) {
+        auto& point                 = manifold->points[i];
+        const auto relativeVelocity = [&]() {
+          return bodyB->linearVel.add(Vector3::Cross(bodyB->angularVel, point.rB))
+            .subtract(bodyA->linearVel)
+            .subtract(Vector3::Cross(bodyA->angularVel, point.rA));
+        };
+        const auto applyImpulse = [&](const Vector3& direction, float impulse) {
+          ApplyImpulse(bodyA, direction.scale(-impulse), point.rA);
+          ApplyImpulse(bodyB, direction.scale(impulse), point.rB);
+        };
+
+        // Friction
+        const auto maxFriction = manifold->friction * point.normalImpulse;
+        auto velocity          = relativeVelocity();
+        auto previous          = point.tangentImpulse0;
+        point.tangentImpulse0
+          = std::clamp(previous - point.tangentMass0 * Vector3::Dot(velocity, point.tangent0),
+                       -maxFriction, maxFriction);
+        applyImpulse(point.tangent0, point.tangentImpulse0 - previous);
+        velocity = relativeVelocity();
+        previous = point.tangentImpulse1;
+        point.tangentImpulse1
+          = std::clamp(previous - point.tangentMass1 * Vector3::Dot(velocity, point.tangent1),
+                       -maxFriction, maxFriction);
+        applyImpulse(point.tangent1, point.tangentImpulse1 - previous);
+
+        // Non penetration
+        velocity            = relativeVelocity();
+        previous            = point.normalImpulse;
+        point.normalImpulse = std::max(
+          previous - point.normalMass * (Vector3::Dot(velocity, point.normal) + point.bias), 0.f);
+        applyImpulse(point.normal, point.normalImpulse - previous);
+      }
+    }
+  }
+
+  // Positions and sleep
+  auto minSleepTime = std::numeric_limits<float>::max();
+  for (auto* body : island.bodies) {
+    body->position.addInPlace(body->linearVel.scale(dt));
+    const auto& w = body->angularVel;
+    const auto spin
+      = Quaternion(w.x, w.y, w.z, 0.f).multiply(body->orientation).scale(0.5f * dt);
+    body->orientation = body->orientation.add(spin);
+    body->orientation.normalize();
+    body->updateWorldData();
+
+    if (body->linearVel.lengthSquared() < SleepSpeedSquared
+        && body->angularVel.lengthSquared() < SleepSpeedSquared) {
+      body->sleepTime += dt;
+    }
+    else {
+      body->sleepTime = 0.f;
+    }
+    minSleepTime = std::min(minSleepTime, body->sleepTime);
+  }
+  if (minSleepTime >= TimeToSleep) {
+    for (auto* body : island.bodies) {
+      body->sleep();
+    }
+  }
+}
+
+bool RigidBodyWorld::raycast(const Vector3& from, const Vector3& to, RaycastHit& hit) const
+{
+  const auto segment = to.subtract(from);
+  const auto length  = segment.length();
+  if (length <= 0.f) {
+    return false;
+  }
+  const auto direction = segment.scale(1.f / length);
+
+  auto closest = length;
+  hit.body     = nullptr;
+  for (const auto& body : _bodies) {
+    // Slab test with the bounds of the body
+    auto tMin = 0.f, tMax = closest;
+    for (unsigned int axis = 0; axis < 3 && tMin <= tMax; ++axis) {
+      const auto origin = from[axis], d = direction[axis];
+      if (std::abs(d) < 1e-12f) {
+        if (origin < body->minimum[axis] || origin > body->maximum[axis]) {
+          tMin = tMax + 1.f;
+        }
+        continue;
+      }
+      auto t0 = (body->minimum[axis] - origin) / d;
+      auto t1 = (body->maximum[axis] - origin) / d;
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+    }
+    if (tMin > tMax) {
+      continue;
+    }
+
+    for (const auto& shape : body->shapes) {
+      const auto& matrix   = shape.worldRotationMatrix;
+      const auto localFrom = matrix.transposeTransform(from.subtract(shape.worldPosition));
+      const auto localDir  = matrix.transposeTransform(direction);
+      Vector3 localNormal;
+      const auto distance = shape.shape->intersectsRay(localFrom, localDir, closest, localNormal);
+      if (distance && *distance < closest) {
+        closest      = *distance;
+        hit.body     = body.get();
+        hit.distance = *distance;
+        hit.point    = from.add(direction.scale(*distance));
+        hit.normal   = matrix.transform(localNormal);
+      }
+    }
+  }
+
+  return hit.body != nullptr;
+}
+
+} // end of namespace BABYLON
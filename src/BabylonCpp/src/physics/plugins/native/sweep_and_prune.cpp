@@ -0,0 +1,104 @@
+#include <babylon/physics/plugins/native/sweep_and_prune.h>
+
+#include <algorithm>
+
+#include <babylon/physics/plugins/native/rigid_body.h>
+
+namespace BABYLON {
+
+SweepAndPrune::SweepAndPrune() : _axis{0}
+{
+}
+
+SweepAndPrune::~SweepAndPrune() = default;
+
+void SweepAndPrune::addBody(RigidBody* body)
+{
+  _bodies.emplace_back(body);
+}
+
+void SweepAndPrune::removeBody(RigidBody* body)
+{
+  _bodies.erase(std::remove(_bodies.begin(), _bodies.end(), body), _bodies.end());
+}
+
+void SweepAndPrune::_updateAxis()
+{
+  if (_bodies.size() < 2) {
+    return;
+  }
+
+  // Axis of largest variance of the centers
+  auto sum        = Vector3::Zero();
+  auto sumSquared = Vector3::Zero();
+  for (const auto* body : _bodies) {
+    const auto center = body->minimum.add(body->maximum).scale(0.5f);
+    sum.addInPlace(center);
+    sumSquared.addInPlace(center.multiply(center));
+  }
+  const auto count    = static_cast<float>(_bodies.size());
+  const auto variance = sumSquared.subtract(sum.multiply(sum).scale(1.f / count));
+  auto axis           = 0u;
+  if (variance.y > variance.x) {
+    axis = 1u;
+  }
+  if (variance.z > variance[axis]) {
+    axis = 2u;
+  }
+
+  // Hysteresis to avoid resorting from scratch every step
+  if (axis != _axis && variance[axis] > 1.5f * variance[_axis]) {
+    _axis = axis;
+    std::sort(_bodies.begin(), _bodies.end(), [this](const RigidBody* a, const RigidBody* b) {
+      return a->minimum[_axis] < b->minimum[_axis];
+    });
+  }
+}
+
+void SweepAndPrune::computePairs(float margin, std::vector<Pair>& pairs)
+{
+  pairs.clear();
+  _updateAxis();
+
+  // Insertion sort of the nearly sorted bodies
+  const auto axis = _axis;
+  for (size_t i = 1; i < _bodies.size(); ++i) {
+    auto* body     = _bodies[i];
+    const auto key = body->minimum[axis];
+    auto j         = i;
+    for (; j > 0 && _bodies[j - 1]->minimum[axis] > key; --j) {
+      _bodies[j] = _bodies[j - 1];
+    }
+    _bodies[j] = body;
+  }
+
+  const auto otherAxis0 = (axis + 1) % 3;
+  const auto otherAxis1 = (axis + 2) % 3;
+  for (size_t i = 0; i < _bodies.size(); ++i) {
+    auto* a          = _bodies[i];
+    const auto limit = a->maximum[axis] + 2.f * margin;
+    for (size_t j = i + 1; j < _bodies.size(); ++j) {
+      auto* b = _bodies[j];
+      if (b->minimum[axis] > limit) {
+        break;
+      }
+      if (a->isStatic() && b->isStatic()) {
+        continue;
+      }
+      if (a->minimum[otherAxis0] > b->maximum[otherAxis0] + 2.f * margin
+          || b->minimum[otherAxis0] > a->maximum[otherAxis0] + 2.f * margin
+          || a->minimum[otherAxis1] > b->maximum[otherAxis1] + 2.f * margin
+          || b->minimum[otherAxis1] > a->maximum[otherAxis1] + 2.f * margin) {
+        continue;
+      }
+      if (a->id < b->id) {
+        pairs.emplace_back(a, b);
+      }
+      else {
+        pairs.emplace_back(b, a);
+      }
+    }
+  }
+}
+
+} // end of namespace BABYLON
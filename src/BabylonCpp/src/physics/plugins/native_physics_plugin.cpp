@@ -0,0 +1,608 @@
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/core/logging.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/physics/iphysics_enabled_object.h>
+#include <babylon/physics/joint/distance_joint.h>
+#include <babylon/physics/joint/imotor_enabled_joint.h>
+#include <babylon/physics/joint/physics_joint.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_joint.h>
+#include <babylon/physics/physics_raycast_result.h>
+#include <babylon/physics/plugins/native/collision_shape.h>
+#include <babylon/physics/plugins/native/matrix3x3.h>
+#include <babylon/physics/plugins/native/rigid_body.h>
+#include <babylon/physics/plugins/native/rigid_body_joint.h>
+#include <babylon/physics/plugins/native/rigid_body_world.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Differences under which the transformation of a body is left untouched, to let it sleep
+constexpr float PositionTolerance = 1e-4f;
+constexpr float RotationTolerance = 1e-5f;
+
+// Half thickness of the plane impostors
+constexpr float PlaneHalfThickness = 0.005f;
+
+Quaternion WorldRotation(const Matrix& worldMatrix)
+{
+  std::optional<Vector3> scale       = Vector3::One();
+  std::optional<Quaternion> rotation = Quaternion::Identity();
+  std::optional<Vector3> translation = std::nullopt;
+  worldMatrix.decompose(scale, rotation, translation);
+  return *rotation;
+}
+
+} // end of anonymous namespace
+
+NativePhysicsPlugin::NativePhysicsPlugin(size_t solverIterations)
+    : _world{std::make_unique<RigidBodyWorld>()}, _timeStep{1.f / 60.f}
+{
+  world = nullptr;
+  name  = "NativePhysicsPlugin";
+  _world->setSolverIterations(solverIterations);
+}
+
+NativePhysicsPlugin::~NativePhysicsPlugin() = default;
+
+void NativePhysicsPlugin::setGravity(const Vector3& gravity)
+{
+  _world->setGravity(gravity);
+}
+
+void NativePhysicsPlugin::setTimeStep(float timeStep)
+{
+  _timeStep = timeStep;
+}
+
+float NativePhysicsPlugin::getTimeStep() const
+{
+  return _timeStep;
+}
+
+void NativePhysicsPlugin::executeStep(float delta,
+                                      const std::vector<PhysicsImpostorPtr>& impostors)
+{
+  for (const auto& impostor : impostors) {
+    impostor->beforeStep();
+  }
+
+  // Sub-steps of equal durations, no longer than the time step
+  const auto steps = std::max(1, static_cast<int>(std::ceil(delta / _timeStep - 0.01f)));
+  const auto dt    = delta / static_cast<float>(steps);
+  for (int i = 0; i < steps; ++i) {
+    _world->step(dt);
+  }
+
+  for (const auto& impostor : impostors) {
+    impostor->afterStep();
+  }
+}
+
+void NativePhysicsPlugin::applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                                       const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    _world->wakeUpBody(body);
+    body->applyImpulseAt(force, contactPoint);
+  }
+}
+
+void NativePhysicsPlugin::applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                                     const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    _world->wakeUpBody(body);
+    body->force.addInPlace(force);
+    body->torque.addInPlace(Vector3::Cross(contactPoint.subtract(body->position), force));
+  }
+}
+
+void NativePhysicsPlugin::generatePhysicsBody(const PhysicsImpostor& iImpostor)
+{
+  auto& impostor = const_cast<PhysicsImpostor&>(iImpostor);
+
+  // The shapes of the children are part of the body of their parent
+  if (impostor.parent()) {
+    if (_getBody(impostor)) {
+      removePhysicsBody(impostor);
+      impostor.forceUpdate();
+    }
+    return;
+  }
+
+  if (impostor.soft) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft body impostors are not supported")
+    return;
+  }
+
+  if (!impostor.isBodyInitRequired()) {
+    return;
+  }
+
+  auto* object              = impostor.object;
+  const auto& worldMatrix   = object->computeWorldMatrix(true);
+  const auto originPosition = object->getAbsolutePosition();
+  const auto originRotation = WorldRotation(worldMatrix);
+
+  auto body      = _world->createBody();
+  body->impostor = &impostor;
+  auto mass      = 0.f;
+  _addShapes(impostor, body, originPosition, Quaternion::Inverse(originRotation), mass);
+  body->friction    = impostor.getParam("friction");
+  body->restitution = impostor.getParam("restitution");
+  body->setMass(mass);
+  body->setOriginTransformation(originPosition, originRotation);
+
+  // Setting the body removes the previous one
+  impostor.physicsBody = body;
+  _bodies[&impostor]   = body;
+}
+
+void NativePhysicsPlugin::_addShapes(PhysicsImpostor& impostor, RigidBody* body,
+                                     const Vector3& originPosition,
+                                     const Quaternion& inverseOriginRotation, float& mass)
+{
+  auto* object            = impostor.object;
+  const auto& worldMatrix = object->computeWorldMatrix(true);
+  const auto toOrigin     = Matrix3x3::FromQuaternion(inverseOriginRotation);
+  const auto toLocal      = [&](const Vector3& worldPoint) {
+    return toOrigin.transform(worldPoint.subtract(originPosition));
+  };
+
+  const auto extendSize = impostor.getObjectExtendSize();
+  const auto type       = impostor.physicsImposterType;
+  mass += impostor.getParam("mass");
+
+  CollisionShapePtr shape = nullptr;
+  auto shapePosition      = toLocal(impostor.getObjectCenter());
+  auto shapeRotation      = inverseOriginRotation.multiply(WorldRotation(worldMatrix));
+  switch (type) {
+    case PhysicsImpostor::SphereImpostor:
+    case PhysicsImpostor::ParticleImpostor:
+      shape = CollisionShape::CreateSphere(
+        std::max({extendSize.x, extendSize.y, extendSize.z}) / 2.f);
+      break;
+    case PhysicsImpostor::BoxImpostor:
+      shape = CollisionShape::CreateBox(extendSize.scale(0.5f));
+      break;
+    case PhysicsImpostor::PlaneImpostor:
+      shape = CollisionShape::CreateBox(Vector3(
+        extendSize.x / 2.f, extendSize.y / 2.f, std::max(extendSize.z / 2.f, PlaneHalfThickness)));
+      break;
+    case PhysicsImpostor::CapsuleImpostor: {
+      const auto radius = std::max(extendSize.x, extendSize.z) / 2.f;
+      shape = CollisionShape::CreateCapsule(radius, std::max(extendSize.y / 2.f - radius, 0.f));
+    } break;
+    case PhysicsImpostor::CylinderImpostor:
+      shape = CollisionShape::CreateCylinder(std::max(extendSize.x, extendSize.z) / 2.f,
+                                             extendSize.y / 2.f);
+      break;
+    case PhysicsImpostor::MeshImpostor:
+    case PhysicsImpostor::HeightmapImpostor:
+    case PhysicsImpostor::ConvexHullImpostor: {
+      // The vertices are baked in the space of the origin of the body
+      const auto data = object->getVerticesData(VertexBuffer::PositionKind);
+      std::vector<Vector3> positions;
+      positions.reserve(data.size() / 3);
+      for (size_t i = 0; i + 2 < data.size(); i += 3) {
+        positions.emplace_back(toLocal(Vector3::TransformCoordinates(
+          Vector3(data[i], data[i + 1], data[i + 2]), worldMatrix)));
+      }
+      // Concave shapes are only supported by static bodies
+      if (type != PhysicsImpostor::ConvexHullImpostor && mass == 0.f) {
+        shape = CollisionShape::CreateTriangleMesh(std::move(positions), object->getIndices());
+      }
+      else {
+        shape = CollisionShape::CreateConvexHull(positions);
+      }
+      if (shape) {
+        shapePosition = Vector3::Zero();
+        shapeRotation = Quaternion::Identity();
+      }
+      else {
+        BABYLON_LOG_WARN("NativePhysicsPlugin",
+                         "Degenerate mesh impostor, a box impostor is used instead")
+        shape = CollisionShape::CreateBox(extendSize.scale(0.5f));
+      }
+    } break;
+    default:
+      // Compound impostors (NoImpostor) only have the shapes of their children
+      break;
+  }
+  if (shape) {
+    body->addShape(shape, shapePosition, shapeRotation);
+  }
+
+  for (const auto& child : object->getChildMeshes(true)) {
+    if (const auto& childImpostor = child->physicsImpostor()) {
+      _addShapes(*childImpostor, body, originPosition, inverseOriginRotation, mass);
+    }
+  }
+}
+
+void NativePhysicsPlugin::removePhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto it = _bodies.find(&impostor);
+  if (it == _bodies.end()) {
+    return;
+  }
+  auto body = it->second;
+  _bodies.erase(it);
+
+  // The joints of the body are removed by the world
+  for (auto jointIt = _joints.begin(); jointIt != _joints.end();) {
+    if (jointIt->second->bodyA == body || jointIt->second->bodyB == body) {
+      jointIt = _joints.erase(jointIt);
+    }
+    else {
+      ++jointIt;
+    }
+  }
+  _world->removeBody(body);
+}
+
+void NativePhysicsPlugin::generateJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  if (!impostorJoint || !impostorJoint->joint) {
+    return;
+  }
+  auto bodyA = _getBody(*impostorJoint->mainImpostor);
+  auto bodyB = _getBody(*impostorJoint->connectedImpostor);
+  if (!bodyA || !bodyB) {
+    return;
+  }
+
+  const auto& joint     = *impostorJoint->joint;
+  const auto& jointData = joint.jointData;
+  RigidBodyJoint::Type type;
+  switch (joint.jointType) {
+    case PhysicsJoint::DistanceJoint:
+      type = RigidBodyJoint::Type::Distance;
+      break;
+    case PhysicsJoint::HingeJoint:
+      type = RigidBodyJoint::Type::Hinge;
+      break;
+    case PhysicsJoint::BallAndSocketJoint:
+    case PhysicsJoint::PointToPointJoint:
+      type = RigidBodyJoint::Type::BallAndSocket;
+      break;
+    case PhysicsJoint::WheelJoint:
+      type = RigidBodyJoint::Type::Hinge2;
+      break;
+    case PhysicsJoint::SliderJoint:
+      type = RigidBodyJoint::Type::Slider;
+      break;
+    case PhysicsJoint::PrismaticJoint:
+      type = RigidBodyJoint::Type::Prismatic;
+      break;
+    case PhysicsJoint::UniversalJoint:
+      type = RigidBodyJoint::Type::Universal;
+      break;
+    case PhysicsJoint::SpringJoint:
+      type = RigidBodyJoint::Type::Spring;
+      break;
+    case PhysicsJoint::LockJoint:
+      type = RigidBodyJoint::Type::Lock;
+      break;
+    default:
+      BABYLON_LOGF_WARN("NativePhysicsPlugin", "Unsupported joint type %u", joint.jointType)
+      return;
+  }
+
+  // The distance and spring joints keep the initial distance between the pivots
+  _joints[&joint] = _world->createJoint(
+    type, bodyA, bodyB, jointData.mainPivot.value_or(Vector3::Zero()),
+    jointData.connectedPivot.value_or(Vector3::Zero()),
+    jointData.mainAxis.value_or(Vector3(1.f, 0.f, 0.f)),
+    jointData.connectedAxis.value_or(Vector3(1.f, 0.f, 0.f)), jointData.collision.value_or(false));
+}
+
+void NativePhysicsPlugin::removeJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  if (!impostorJoint || !impostorJoint->joint) {
+    return;
+  }
+  auto it = _joints.find(impostorJoint->joint.get());
+  if (it != _joints.end()) {
+    _world->removeJoint(it->second);
+    _joints.erase(it);
+  }
+}
+
+bool NativePhysicsPlugin::isSupported()
+{
+  return true;
+}
+
+void NativePhysicsPlugin::setTransformationFromPhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    return;
+  }
+  impostor.object->position = body->originPosition();
+  if (impostor.object->rotationQuaternion()) {
+    impostor.object->rotationQuaternion()->copyFrom(body->orientation);
+  }
+}
+
+void NativePhysicsPlugin::setPhysicsBodyTransformation(const PhysicsImpostor& impostor,
+                                                       const Vector3& newPosition,
+                                                       const Quaternion& newRotation)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    return;
+  }
+  // Only the transformations changed outside of the simulation wake the bodies up
+  const auto& rotation = body->orientation;
+  const auto rotationDot
+    = std::abs(rotation.x * newRotation.x + rotation.y * newRotation.y
+               + rotation.z * newRotation.z + rotation.w * newRotation.w);
+  if (Vector3::DistanceSquared(body->originPosition(), newPosition)
+        <= PositionTolerance * PositionTolerance
+      && rotationDot >= 1.f - RotationTolerance) {
+    return;
+  }
+  body->setOriginTransformation(newPosition, newRotation);
+  _world->wakeUpBody(body);
+}
+
+void NativePhysicsPlugin::setLinearVelocity(const PhysicsImpostor& impostor,
+                                            const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    _world->wakeUpBody(body);
+    body->setLinearVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+void NativePhysicsPlugin::setAngularVelocity(const PhysicsImpostor& impostor,
+                                             const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    _world->wakeUpBody(body);
+    body->setAngularVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+Vector3 NativePhysicsPlugin::getLinearVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->linearVelocity() : Vector3::Zero();
+}
+
+Vector3 NativePhysicsPlugin::getAngularVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->angularVelocity() : Vector3::Zero();
+}
+
+void NativePhysicsPlugin::setBodyMass(const PhysicsImpostor& impostor, float mass)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setMass(mass);
+    _world->wakeUpBody(body);
+  }
+}
+
+float NativePhysicsPlugin::getBodyMass(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->massValue : 0.f;
+}
+
+float NativePhysicsPlugin::getBodyFriction(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->friction : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyFriction(const PhysicsImpostor& impostor, float friction)
+{
+  if (auto body = _getBody(impostor)) {
+    body->friction = friction;
+  }
+}
+
+float NativePhysicsPlugin::getBodyRestitution(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->restitution : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyRestitution(const PhysicsImpostor& impostor, float restitution)
+{
+  if (auto body = _getBody(impostor)) {
+    body->restitution = restitution;
+  }
+}
+
+float NativePhysicsPlugin::getBodyPressure(const PhysicsImpostor& /*impostor*/)
+{
+  // Soft bodies only
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyPressure(const PhysicsImpostor& /*impostor*/,
+                                          float /*pressure*/)
+{
+  // Soft bodies only
+}
+
+float NativePhysicsPlugin::getBodyStiffness(const PhysicsImpostor& /*impostor*/)
+{
+  // Soft bodies only
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyStiffness(const PhysicsImpostor& /*impostor*/,
+                                           float /*stiffness*/)
+{
+  // Soft bodies only
+}
+
+size_t NativePhysicsPlugin::getBodyVelocityIterations(const PhysicsImpostor& /*impostor*/)
+{
+  return _world->solverIterations();
+}
+
+void NativePhysicsPlugin::setBodyVelocityIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*velocityIterations*/)
+{
+  // The iterations are shared by all the bodies, see the constructor
+}
+
+size_t NativePhysicsPlugin::getBodyPositionIterations(const PhysicsImpostor& /*impostor*/)
+{
+  // The positions are corrected by the velocity iterations
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyPositionIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*positionIterations*/)
+{
+  // The positions are corrected by the velocity iterations
+}
+
+void NativePhysicsPlugin::appendAnchor(const PhysicsImpostor& /*impostor*/,
+                                       const PhysicsImpostorPtr& /*otherImpostor*/,
+                                       int /*width*/, int /*height*/, float /*influence*/,
+                                       bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Anchors are only supported by soft bodies")
+}
+
+void NativePhysicsPlugin::appendHook(const PhysicsImpostor& /*impostor*/,
+                                     const PhysicsImpostorPtr& /*otherImpostor*/,
+                                     float /*length*/, float /*influence*/,
+                                     bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Hooks are only supported by soft bodies")
+}
+
+void NativePhysicsPlugin::sleepBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    body->sleep();
+  }
+}
+
+void NativePhysicsPlugin::wakeUpBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    _world->wakeUpBody(body);
+  }
+}
+
+PhysicsRaycastResult NativePhysicsPlugin::raycast(const Vector3& from, const Vector3& to)
+{
+  PhysicsRaycastResult result;
+  result.reset(from, to);
+
+  RigidBodyWorld::RaycastHit hit;
+  if (_world->raycast(from, to, hit)) {
+    result.setHitData({hit.normal.x, hit.normal.y, hit.normal.z},
+                      {hit.point.x, hit.point.y, hit.point.z});
+    result.setHitDistance(hit.distance);
+  }
+
+  return result;
+}
+
+void NativePhysicsPlugin::updateDistanceJoint(DistanceJoint* joint, float maxDistance,
+                                              float minDistance)
+{
+  if (auto nativeJoint = _getJoint(static_cast<PhysicsJoint*>(joint))) {
+    nativeJoint->setDistanceLimits(maxDistance, minDistance);
+    _world->wakeUpBody(nativeJoint->bodyA);
+    _world->wakeUpBody(nativeJoint->bodyB);
+  }
+}
+
+void NativePhysicsPlugin::setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                                   unsigned int motorIndex)
+{
+  if (auto nativeJoint = _getJoint(dynamic_cast<PhysicsJoint*>(joint))) {
+    nativeJoint->setMotor(speed, maxForce, motorIndex);
+    _world->wakeUpBody(nativeJoint->bodyA);
+    _world->wakeUpBody(nativeJoint->bodyB);
+  }
+}
+
+void NativePhysicsPlugin::setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                                   unsigned int motorIndex)
+{
+  if (auto nativeJoint = _getJoint(dynamic_cast<PhysicsJoint*>(joint))) {
+    nativeJoint->setLimit(upperLimit, lowerLimit, motorIndex);
+    _world->wakeUpBody(nativeJoint->bodyA);
+    _world->wakeUpBody(nativeJoint->bodyB);
+  }
+}
+
+float NativePhysicsPlugin::getRadius(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!body || body->shapes.empty()) {
+    return 0.f;
+  }
+  const auto& shape = body->shapes.front();
+  return (shape.localMaximum.x - shape.localMinimum.x) / 2.f;
+}
+
+void NativePhysicsPlugin::getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result)
+{
+  auto body = _getBody(impostor);
+  if (!body || body->shapes.empty()) {
+    result.setAll(0.f);
+    return;
+  }
+  const auto& shape = body->shapes.front();
+  result.copyFrom(shape.localMaximum.subtract(shape.localMinimum));
+}
+
+void NativePhysicsPlugin::syncMeshWithImpostor(AbstractMesh* mesh,
+                                               const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!mesh || !body) {
+    return;
+  }
+  mesh->position = body->originPosition();
+  if (mesh->rotationQuaternion()) {
+    mesh->rotationQuaternion()->copyFrom(body->orientation);
+  }
+}
+
+void NativePhysicsPlugin::dispose()
+{
+  _joints.clear();
+  _bodies.clear();
+  const auto gravity    = _world->gravity();
+  const auto iterations = _world->solverIterations();
+  _world                = std::make_unique<RigidBodyWorld>();
+  _world->setGravity(gravity);
+  _world->setSolverIterations(iterations);
+}
+
+RigidBody* NativePhysicsPlugin::_getBody(const PhysicsImpostor& impostor) const
+{
+  auto it = _bodies.find(&impostor);
+  return it == _bodies.end() ? nullptr : it->second;
+}
+
+RigidBodyJoint* NativePhysicsPlugin::_getJoint(const PhysicsJoint* joint) const
+{
+  auto it = _joints.find(joint);
+  return it == _joints.end() ? nullptr : it->second;
+}
+
+} // end of namespace BABYLON
@@ -54,6 +54,7 @@ PostProcess::PostProcess(const std::string& iName, const std::string& fragmentUr
     , _engine{nullptr}
     , _renderRatio{1.f}
     , _reusable{false}
+    , _scaleHandle{-1}
     , _parameters{parameters}
     , _scaleRatio{Vector2(1.f, 1.f)}
     , _shareOutputWithPostProcess{nullptr}
@@ -272,7 +273,8 @@ void PostProcess::updateEffect(
   options.onError         = onError;
   options.indexParameters = !indexParameters.empty() ? indexParameters : _indexParameters;
 
-  _effect = _engine->createEffect(baseName, options, _scene ? _scene->getEngine() : _engine);
+  _effect      = _engine->createEffect(baseName, options, _scene ? _scene->getEngine() : _engine);
+  _scaleHandle = _effect->getUniformHandle("scale");
 }
 
 bool PostProcess::isReusable() const
@@ -480,7 +482,7 @@ EffectPtr PostProcess::apply()
   _effect->_bindTexture("textureSampler", source);
 
   // Parameters
-  _effect->setVector2("scale", _scaleRatio);
+  _effect->setVector2(_scaleHandle, _scaleRatio);
   onApplyObservable.notifyObservers(_effect.get());
 
   return _effect;
@@ -12,6 +12,7 @@
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_welder.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/rendering/face_adjacencies.h>
 
@@ -231,7 +232,7 @@ void EdgesRenderer::createLine(const Vector3& p0, const Vector3& p1, uint32_t of
 }
 
 void EdgesRenderer::_tessellateTriangle(
-  const std::vector<std::vector<std::array<uint32_t, 2>>>& edgePoints, size_t indexTriangle,
+  std::vector<std::vector<std::array<uint32_t, 2>>>& edgePoints, size_t indexTriangle,
   IndicesArray& indices, const IndicesArray& remapVertexIndices)
 {
   const auto makePointList = [](const std::vector<std::array<uint32_t, 2>>& edgePoints,
@@ -357,61 +358,12 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
    * Find all vertices that are at the same location (with an epsilon) and remapp them on the same
    * vertex
    */
-  const auto useFastVertexMerger = _options ? _options->useFastVertexMerger.value_or(true) : true;
-  const auto epsilonVertexMerge  = _options ? _options->epsilonVertexMerge.value_or(1e-6f) : 1e-6f;
-  const auto epsVertexMerge      = useFastVertexMerger ?
-                                     std::round(-std::log(epsilonVertexMerge) / std::log(10.f)) :
-                                     epsilonVertexMerge;
-  IndicesArray remapVertexIndices;
-  IndicesArray uniquePositions; // list of unique index of vertices - needed for tessellation
-
-  const auto toFixed = [](float var, float epsilon) -> float {
-    const auto epsilonI = static_cast<int>(std::min(std::max(0.f, epsilon), 20.f));
-    float value         = static_cast<float>(static_cast<int>(var * epsilonI + .5));
-    return value / epsilonI;
-  };
-
-  if (useFastVertexMerger) {
-    std::unordered_map<std::string, uint32_t> mapVertices;
-    for (auto v1 = 0u; v1 < positions.size(); v1 += 3) {
-      const auto x1 = positions[v1 + 0], y1 = positions[v1 + 1], z1 = positions[v1 + 2];
-
-      const auto key
-        = StringTools::printf("%f|%f|%f", toFixed(x1, epsVertexMerge), toFixed(y1, epsVertexMerge),
-                              toFixed(z1, epsVertexMerge));
-
-      if (stl_util::contains(mapVertices, key)) {
-        remapVertexIndices.emplace_back(mapVertices[key]);
-      }
-      else {
-        const auto idx   = v1 / 3u;
-        mapVertices[key] = idx;
-        remapVertexIndices.emplace_back(idx);
-        uniquePositions.emplace_back(idx);
-      }
-    }
-  }
-  else {
-    for (auto v1 = 0u; v1 < positions.size(); v1 += 3) {
-      const auto x1 = positions[v1 + 0], y1 = positions[v1 + 1], z1 = positions[v1 + 2];
-      auto found = false;
-      for (auto v2 = 0u; v2 < v1 && !found; v2 += 3) {
-        const auto x2 = positions[v2 + 0], y2 = positions[v2 + 1], z2 = positions[v2 + 2];
-
-        if (std::abs(x1 - x2) < epsVertexMerge && std::abs(y1 - y2) < epsVertexMerge
-            && std::abs(z1 - z2) < epsVertexMerge) {
-          remapVertexIndices.emplace_back(v2 / 3u);
-          found = true;
-          break;
-        }
-      }
-
-      if (!found) {
-        remapVertexIndices.emplace_back(v1 / 3u);
-        uniquePositions.emplace_back(v1 / 3u);
-      }
-    }
-  }
+  VertexWelderOptions welderOptions;
+  welderOptions.epsilon  = _options ? _options->epsilonVertexMerge.value_or(1e-6f) : 1e-6f;
+  welderOptions.parallel = _options ? _options->useFastVertexMerger.value_or(true) : true;
+  const auto remapVertexIndices = VertexWelder::Weld(positions, welderOptions);
+  // list of unique index of vertices - needed for tessellation
+  const auto uniquePositions = VertexWelder::UniqueVertices(remapVertexIndices);
 
   if (_options ? _options->applyTessellation.value_or(false) : false) {
     /**
@@ -499,7 +451,7 @@ void EdgesRenderer::_generateEdgesLinesAlternate()
     }
 
     // Second step: tesselate the triangles
-    for (const auto& triangle : mustTesselate) {
+    for (auto& triangle : mustTesselate) {
       _tessellateTriangle(triangle.edgesPoints, triangle.index, indices, remapVertexIndices);
     }
 
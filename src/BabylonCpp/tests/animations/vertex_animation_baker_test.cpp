@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/bakedvertexanimation/vertex_animation_baker.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+using namespace BABYLON;
+
+/**
+ * @brief Gets the local matrix of the animated bone at the given frame of its animation.
+ */
+Matrix AnimatedMatrix(float frame)
+{
+  return Matrix::Compose(Vector3(1.f, 1.f + frame / 10.f, 1.f),
+                         Quaternion::RotationYawPitchRoll(frame / 4.f, 0.f, frame / 8.f),
+                         Vector3(frame, 0.f, -frame / 2.f));
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for the vertex animation baker.
+ */
+
+/**
+ * @brief each range stores one texture row per frame, from its first to its last frame included
+ */
+TEST(TestVertexAnimationBaker, FrameCount)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(VertexAnimationBaker::FrameCount({}), 0ull);
+  EXPECT_EQ(VertexAnimationBaker::FrameCount({AnimationRange("walk", 0.f, 10.f)}), 11ull);
+  EXPECT_EQ(VertexAnimationBaker::FrameCount(
+              {AnimationRange("walk", 0.f, 10.f), AnimationRange("run", 12.f, 14.5f)}),
+            14ull);
+  EXPECT_THROW(VertexAnimationBaker::FrameCount({AnimationRange("invalid", 5.f, 1.f)}),
+               std::runtime_error);
+}
+
+/**
+ * @brief each baked row holds the skin matrices of the skeleton at its frame and the texture
+ * stores (bones + 1) matrices per row and one row per frame
+ */
+TEST(TestVertexAnimationBaker, BakeVertexData)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto mesh = BoxBuilder::CreateBox("box", options, scene.get());
+
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto root     = Bone::New("root", skeleton.get(), nullptr, Matrix::Identity());
+  auto arm      = Bone::New("arm", skeleton.get(), root.get(), Matrix::Translation(0.f, 2.f, 0.f));
+  Bone::New("hand", skeleton.get(), arm.get(), Matrix::Translation(0.f, 1.f, 0.f));
+  mesh->skeleton = skeleton;
+
+  auto animation = Animation::New("anim", "_matrix", 30, Animation::ANIMATIONTYPE_MATRIX);
+  std::vector<IAnimationKey> keys;
+  for (float frame = 0.f; frame <= 20.f; frame += 1.f) {
+    keys.emplace_back(IAnimationKey(frame, AnimationValue(AnimatedMatrix(frame))));
+  }
+  animation->setKeys(keys);
+  arm->animations.emplace_back(animation);
+
+  const std::vector<AnimationRange> ranges{AnimationRange("walk", 0.f, 5.f),
+                                           AnimationRange("run", 12.f, 20.f)};
+  VertexAnimationBaker baker(scene.get(), mesh.get());
+  const auto vertexData = baker.bakeVertexData(ranges);
+
+  const auto frameCount   = VertexAnimationBaker::FrameCount(ranges);
+  const auto boneCount    = skeleton->bones.size();
+  const auto matricesSize = (boneCount + 1) * 16;
+  ASSERT_EQ(frameCount, 15ull);
+  ASSERT_EQ(vertexData.size(), matricesSize * frameCount);
+
+  // Reference: the skin matrices of the skeleton posed at each frame of the ranges
+  size_t row = 0;
+  for (const auto& range : ranges) {
+    auto animatable = scene->beginAnimation(skeleton, range.from, range.to, false, 1.f);
+    ASSERT_NE(animatable, nullptr);
+    for (auto frame = range.from; frame <= range.to; frame += 1.f, ++row) {
+      animatable->goToFrame(frame);
+      skeleton->_markAsDirty();
+      skeleton->prepare();
+      const auto& expected = skeleton->getTransformMatrices(mesh.get());
+      ASSERT_GE(expected.size(), matricesSize);
+      for (size_t index = 0; index < matricesSize; ++index) {
+        EXPECT_NEAR(vertexData[row * matricesSize + index], expected[index], 1e-5f)
+          << "frame " << frame << ", value " << index;
+      }
+    }
+    scene->stopAnimation(skeleton);
+  }
+  EXPECT_EQ(row, frameCount);
+
+  // The rows follow the animation: the first and the last frame of a range differ
+  const auto rowDiffers = [&](size_t rowA, size_t rowB) {
+    for (size_t index = 0; index < matricesSize; ++index) {
+      if (std::abs(vertexData[rowA * matricesSize + index]
+                   - vertexData[rowB * matricesSize + index])
+          > 1e-3f) {
+        return true;
+      }
+    }
+    return false;
+  };
+  EXPECT_TRUE(rowDiffers(0, 5));
+  EXPECT_TRUE(rowDiffers(6, 14));
+
+  // The NullEngine has no GL context to upload the texture, so only its size is checked
+  const auto size = VertexAnimationBaker::TextureSize(boneCount, vertexData.size());
+  EXPECT_EQ(size.width, static_cast<int>((boneCount + 1) * 4));
+  EXPECT_EQ(size.height, static_cast<int>(frameCount));
+}
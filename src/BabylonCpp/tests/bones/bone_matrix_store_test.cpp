@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/bone_matrix_store.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+using namespace BABYLON;
+
+/**
+ * @brief Creates a skeleton made of a root with two children, the first one having a child,
+ * with a different transformation for each bone.
+ */
+SkeletonPtr CreateSkeleton(Scene* scene)
+{
+  const auto localMatrix = [](float value) {
+    return Matrix::Compose(Vector3(1.f + value, 1.f, 1.f - value / 2.f),
+                           Quaternion::RotationYawPitchRoll(value, 2.f * value, -value),
+                           Vector3(value, 2.f * value, -3.f * value));
+  };
+
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene);
+  auto root = Bone::New("root", skeleton.get(), nullptr, localMatrix(0.1f));
+  auto a    = Bone::New("a", skeleton.get(), root.get(), localMatrix(0.2f));
+  Bone::New("b", skeleton.get(), a.get(), localMatrix(0.3f));
+  Bone::New("c", skeleton.get(), root.get(), localMatrix(0.4f));
+  return skeleton;
+}
+
+/**
+ * @brief Computes the skin matrices bone by bone with Matrix::multiplyToRef, the parents first,
+ * as Skeleton::prepare did before the bone matrix store.
+ */
+Float32Array ComputeReference(const std::vector<BonePtr>& bones,
+                              const std::optional<Matrix>& initialSkinMatrix,
+                              std::unordered_map<const Bone*, Matrix>& worldMatrices)
+{
+  std::function<const Matrix&(Bone*)> worldMatrix = [&](Bone* bone) -> const Matrix& {
+    auto it = worldMatrices.find(bone);
+    if (it != worldMatrices.end()) {
+      return it->second;
+    }
+    Matrix result;
+    if (auto parent = bone->getParent()) {
+      bone->getLocalMatrix().multiplyToRef(worldMatrix(parent), result);
+    }
+    else if (initialSkinMatrix) {
+      bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, result);
+    }
+    else {
+      result.copyFrom(bone->getLocalMatrix());
+    }
+    return worldMatrices[bone] = result;
+  };
+
+  Float32Array targetMatrix(16 * (bones.size() + 1), 0.f);
+  for (size_t index = 0; index < bones.size(); ++index) {
+    const auto& bone = bones[index];
+    if (!bone->_index.has_value() || *bone->_index != -1) {
+      const auto mappedIndex
+        = !bone->_index.has_value() ? index : static_cast<size_t>(*bone->_index);
+      bone->getInvertedAbsoluteTransform().multiplyToArray(
+        worldMatrix(bone.get()), targetMatrix, static_cast<unsigned int>(mappedIndex * 16));
+    }
+  }
+  return targetMatrix;
+}
+
+void ExpectSameMatrices(const Float32Array& actual, const Float32Array& expected, size_t count)
+{
+  ASSERT_GE(actual.size(), count);
+  ASSERT_GE(expected.size(), count);
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_FLOAT_EQ(actual[i], expected[i]) << "matrix " << i / 16 << ", element " << i % 16;
+  }
+}
+
+void ExpectSameWorldMatrices(const std::vector<BonePtr>& bones,
+                             const std::unordered_map<const Bone*, Matrix>& worldMatrices)
+{
+  for (const auto& bone : bones) {
+    const auto& actual   = bone->getWorldMatrix().m();
+    const auto& expected = worldMatrices.at(bone.get()).m();
+    for (size_t i = 0; i < 16; ++i) {
+      EXPECT_FLOAT_EQ(actual[i], expected[i]) << bone->name << ", element " << i;
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for BoneMatrixStore.
+ */
+
+/**
+ * @brief the bones sorted in the skeleton are kept in order and written straight into the target
+ * array, with and without initial skin matrix
+ */
+TEST(TestBoneMatrixStore, SortedBones)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = CreateSkeleton(scene.get());
+  auto& bones   = skeleton->bones;
+
+  BoneMatrixStore store;
+  for (const auto& initialSkinMatrix :
+       {std::optional<Matrix>{}, std::optional<Matrix>{Matrix::Translation(1.f, 2.f, 3.f)}}) {
+    Float32Array targetMatrix(16 * (bones.size() + 1), 0.f);
+    store.computeTransformMatrices(bones, targetMatrix, initialSkinMatrix);
+    EXPECT_EQ(store.parentIndices(), (std::vector<int32_t>{-1, 0, 1, 0}));
+    EXPECT_EQ(store.boneIndices(), (std::vector<size_t>{0, 1, 2, 3}));
+
+    std::unordered_map<const Bone*, Matrix> worldMatrices;
+    const auto expected = ComputeReference(bones, initialSkinMatrix, worldMatrices);
+    ExpectSameMatrices(targetMatrix, expected, 16 * bones.size());
+    ExpectSameWorldMatrices(bones, worldMatrices);
+  }
+}
+
+/**
+ * @brief the bones listed before their parents are sorted parents first, and the skin matrices of
+ * the remapped bones are written at their index, or skipped for -1
+ */
+TEST(TestBoneMatrixStore, UnsortedAndRemappedBones)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = CreateSkeleton(scene.get());
+  auto& bones   = skeleton->bones;
+
+  // b, c, a, root
+  bones = {bones[2], bones[3], bones[1], bones[0]};
+  bones[0]->_index = 0;  // b
+  bones[1]->_index = 2;  // c
+  bones[2]->_index = -1; // a
+  bones[3]->_index = 1;  // root
+
+  BoneMatrixStore store;
+  Float32Array targetMatrix(16 * (bones.size() + 1), 0.f);
+  store.computeTransformMatrices(bones, targetMatrix, std::nullopt);
+  EXPECT_EQ(store.size(), 4ull);
+  EXPECT_EQ(store.parentIndices(), (std::vector<int32_t>{-1, 0, 1, 0}));
+  EXPECT_EQ(store.boneIndices(), (std::vector<size_t>{3, 2, 0, 1}));
+
+  std::unordered_map<const Bone*, Matrix> worldMatrices;
+  const auto expected = ComputeReference(bones, std::nullopt, worldMatrices);
+  ExpectSameMatrices(targetMatrix, expected, 16 * bones.size());
+  ExpectSameWorldMatrices(bones, worldMatrices);
+  // Nothing written for the skipped bone
+  for (size_t i = 16 * 3; i < 16 * 4; ++i) {
+    EXPECT_EQ(targetMatrix[i], 0.f);
+  }
+
+  // Same layout when the bones do not change
+  store.computeTransformMatrices(bones, targetMatrix, std::nullopt);
+  EXPECT_EQ(store.boneIndices(), (std::vector<size_t>{3, 2, 0, 1}));
+}
+
+/**
+ * @brief Skeleton::prepare gives the skin matrices of the per bone computation, followed by the
+ * identity matrix, for sorted bones (identity mapping) and for unsorted remapped bones
+ */
+TEST(TestBoneMatrixStore, SkeletonPrepare)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = CreateSkeleton(scene.get());
+  auto& bones   = skeleton->bones;
+
+  const auto expectPrepared = [&]() {
+    skeleton->_markAsDirty();
+    skeleton->prepare();
+    const auto& transformMatrices = skeleton->getTransformMatrices(nullptr);
+    ASSERT_EQ(transformMatrices.size(), 16 * (bones.size() + 1));
+
+    std::unordered_map<const Bone*, Matrix> worldMatrices;
+    auto expected = ComputeReference(bones, std::nullopt, worldMatrices);
+    Matrix::IdentityReadOnly().copyToArray(expected, static_cast<unsigned int>(bones.size()) * 16);
+    // The matrices of the indices without bone are left untouched
+    std::vector<bool> written(bones.size(), false);
+    for (size_t i = 0; i < bones.size(); ++i) {
+      const auto index = bones[i]->_index.value_or(static_cast<int>(i));
+      if (index >= 0) {
+        written[static_cast<size_t>(index)] = true;
+      }
+    }
+    for (size_t i = 0; i < bones.size(); ++i) {
+      if (!written[i]) {
+        std::copy_n(transformMatrices.begin() + static_cast<std::ptrdiff_t>(i * 16), 16,
+                    expected.begin() + static_cast<std::ptrdiff_t>(i * 16));
+      }
+    }
+    ExpectSameMatrices(transformMatrices, expected, expected.size());
+    ExpectSameWorldMatrices(bones, worldMatrices);
+  };
+
+  expectPrepared();
+
+  // Animated bone
+  bones[1]->getLocalMatrix().copyFrom(Matrix::RotationX(0.5f));
+  bones[1]->markAsDirty();
+  expectPrepared();
+
+  // Unsorted and remapped
+  bones            = {bones[2], bones[3], bones[1], bones[0]};
+  bones[0]->_index = 3;
+  bones[1]->_index = 2;
+  bones[2]->_index = -1;
+  bones[3]->_index = 0;
+  expectPrepared();
+}
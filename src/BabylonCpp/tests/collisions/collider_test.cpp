@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/collisions/collider.h>
+#include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+using namespace BABYLON;
+
+struct CollisionResult {
+  bool collisionFound = false;
+  Vector3 intersectionPoint;
+  AbstractMeshPtr collidedMesh;
+  Vector3 position;
+  Vector3 velocity;
+};
+
+void InitializeCollider(Collider& collider, const Vector3& position, const Vector3& displacement)
+{
+  auto scaledPosition = position.divide(collider._radius);
+  auto scaledVelocity = displacement.divide(collider._radius);
+  collider.collidedMesh = nullptr;
+  collider._retry       = 0;
+  collider._initialize(scaledPosition, scaledVelocity, Engine::CollisionsEpsilon * 10.f);
+}
+
+CollisionResult GetResult(Collider& collider, const Vector3& position, const Vector3& displacement)
+{
+  CollisionResult result;
+  result.collisionFound    = collider.collisionFound;
+  result.intersectionPoint = collider.intersectionPoint;
+  result.collidedMesh      = collider.collidedMesh;
+  result.position          = position.divide(collider._radius);
+  result.velocity          = displacement.divide(collider._radius);
+  if (collider.collisionFound) {
+    collider._getResponse(result.position, result.velocity);
+  }
+  return result;
+}
+
+/**
+ * @brief Collides the collider with every triangle of the mesh, transformed in the ellipsoid space
+ * without any culling (back faces are only skipped when the sub-mesh has no material, as in
+ * AbstractMesh::_collideForSubMesh).
+ */
+CollisionResult CollideLinearly(Collider& collider, const MeshPtr& mesh, const Vector3& position,
+                                const Vector3& displacement)
+{
+  InitializeCollider(collider, position, displacement);
+
+  auto scalingMatrix = Matrix::Scaling(1.f / collider._radius.x, 1.f / collider._radius.y,
+                                       1.f / collider._radius.z);
+  const auto transformMatrix = mesh->getWorldMatrix().multiply(scalingMatrix);
+  const auto positions       = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto indices         = mesh->getIndices();
+  const auto hasMaterial     = mesh->subMeshes.front()->getMaterial() != nullptr;
+  const auto vertex          = [&](size_t index) {
+    return Vector3::TransformCoordinates(Vector3::FromArray(positions, indices[index] * 3),
+                                         transformMatrix);
+  };
+  for (size_t index = 0; index + 2 < indices.size(); index += 3) {
+    collider._testTriangle(vertex(index + 2), vertex(index + 1), vertex(index), hasMaterial, mesh);
+  }
+
+  return GetResult(collider, position, displacement);
+}
+
+CollisionResult CollideWithMesh(Collider& collider, const MeshPtr& mesh, const Vector3& position,
+                                const Vector3& displacement)
+{
+  InitializeCollider(collider, position, displacement);
+  mesh->_checkCollision(collider);
+  return GetResult(collider, position, displacement);
+}
+
+void ExpectSameCollisions(const MeshPtr& mesh)
+{
+  // Scaled and rotated mesh
+  mesh->scaling  = Vector3(2.f, 0.5f, 1.5f);
+  mesh->rotation = Vector3(0.3f, 0.7f, -0.2f);
+  mesh->position = Vector3(1.f, -2.f, 0.5f);
+  mesh->computeWorldMatrix(true);
+
+  Collider collider;
+  collider._radius = Vector3(0.5f, 1.f, 0.5f);
+
+  size_t numCollisions = 0;
+  for (int i = -4; i <= 4; ++i) {
+    for (int j = -4; j <= 4; ++j) {
+      const Vector3 position(-6.f, -2.f + 0.5f * static_cast<float>(i),
+                             0.5f + 0.5f * static_cast<float>(j));
+      const Vector3 displacement(8.f, 0.25f * static_cast<float>(j), 0.1f);
+      const auto expected = CollideLinearly(collider, mesh, position, displacement);
+      const auto actual   = CollideWithMesh(collider, mesh, position, displacement);
+      ASSERT_EQ(expected.collisionFound, actual.collisionFound) << i << ", " << j;
+      if (expected.collisionFound) {
+        EXPECT_EQ(expected.intersectionPoint, actual.intersectionPoint) << i << ", " << j;
+        EXPECT_EQ(expected.collidedMesh, actual.collidedMesh) << i << ", " << j;
+        EXPECT_EQ(expected.position, actual.position) << i << ", " << j;
+        EXPECT_EQ(expected.velocity, actual.velocity) << i << ", " << j;
+        ++numCollisions;
+      }
+    }
+  }
+  EXPECT_GT(numCollisions, 0ull);
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for Collider and DefaultCollisionCoordinator.
+ */
+
+/**
+ * @brief the triangles culled in the local space of a scaled and rotated mesh do not change the
+ * collisions found by the linear scan of the triangles (linear path)
+ */
+TEST(TestCollider, LocalSpaceCullingMatchesUnculledCollisions)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box = BoxBuilder::CreateBox("box", options, scene.get());
+  ASSERT_LT(box->getIndices().size() / 3, TriangleBVH::MinTriangleCount);
+
+  ExpectSameCollisions(box);
+}
+
+/**
+ * @brief the triangles selected with the triangle hierarchy of a scaled and rotated mesh give the
+ * same collisions as the linear scan of the triangles
+ */
+TEST(TestCollider, TriangleBVHMatchesLinearCollisions)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions options;
+  options.segments = 16;
+  options.diameter = 2.f;
+  auto sphere      = SphereBuilder::CreateSphere("sphere", options, scene.get());
+  ASSERT_GE(sphere->getIndices().size() / 3, TriangleBVH::MinTriangleCount);
+
+  ExpectSameCollisions(sphere);
+}
+
+/**
+ * @brief an empty surrounding meshes list collides with the scene meshes, the excluded mesh and
+ * the collision mask filter the meshes of the broadphase
+ */
+TEST(TestCollider, SurroundingMeshesAndCollisionMask)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto wall             = BoxBuilder::CreateBox("wall", options, scene.get());
+  wall->position        = Vector3(3.f, 0.f, 0.f);
+  wall->scaling         = Vector3(1.f, 4.f, 4.f);
+  wall->checkCollisions = true;
+  wall->computeWorldMatrix(true);
+  auto other             = BoxBuilder::CreateBox("other", options, scene.get());
+  other->position        = Vector3(0.f, 10.f, 0.f);
+  other->checkCollisions = true;
+  other->computeWorldMatrix(true);
+  auto mover             = BoxBuilder::CreateBox("mover", options, scene.get());
+  mover->checkCollisions = true;
+  mover->computeWorldMatrix(true);
+
+  auto& coordinator = scene->collisionCoordinator();
+  auto collider     = coordinator->createCollider();
+  collider->_radius = Vector3(0.5f, 0.5f, 0.5f);
+
+  const auto move = [&]() {
+    Vector3 position(0.f, 0.f, 0.f);
+    Vector3 displacement(5.f, 0.f, 0.f);
+    AbstractMeshPtr collidedMesh = nullptr;
+    coordinator->getNewPosition(position, displacement, collider, 3, mover,
+                                [&collidedMesh](size_t /*collisionIndex*/, Vector3& /*newPosition*/,
+                                                const AbstractMeshPtr& mesh) {
+                                  collidedMesh = mesh;
+                                },
+                                0);
+    return collidedMesh;
+  };
+
+  // Empty list: the scene meshes, but not the excluded mesh itself
+  EXPECT_TRUE(mover->surroundingMeshes().empty());
+  EXPECT_EQ(move(), wall);
+
+  // Only the specified meshes
+  mover->surroundingMeshes = std::vector<AbstractMeshPtr>{other};
+  EXPECT_EQ(move(), nullptr);
+  mover->surroundingMeshes = std::vector<AbstractMeshPtr>{};
+  EXPECT_EQ(move(), wall);
+
+  // The collision mask of the excluded mesh filters the broadphase candidates
+  wall->collisionGroup = 2;
+  mover->collisionMask = 1;
+  EXPECT_EQ(move(), nullptr);
+  mover->collisionMask = 3;
+  EXPECT_EQ(move(), wall);
+
+  // The broadphase follows the moving meshes
+  wall->position = Vector3(-3.f, 0.f, 0.f);
+  wall->computeWorldMatrix(true);
+  EXPECT_EQ(move(), nullptr);
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/loading/plugins/gltf/binary_reader.h>
+
+TEST(TestMemoryMappedFile, Open)
+{
+  using namespace BABYLON;
+
+  const auto path = ::testing::TempDir() + "memory_mapped_file_test.bin";
+  {
+    std::ofstream stream(path, std::ios::binary);
+    const char bytes[] = {'g', 'l', 'T', 'F', 2, 0, 0, 0, 42};
+    stream.write(bytes, sizeof(bytes));
+  }
+
+  {
+    const auto file = MemoryMappedFile::Open(path);
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(file->size(), 9u);
+    EXPECT_EQ(file->data()[0], 'g');
+    EXPECT_EQ(file->data()[8], 42);
+
+    // The chunks share the ownership of the mapping
+    GLTF2::BinaryChunk chunk{std::shared_ptr<const uint8_t>(file, file->data()), file->size()};
+    GLTF2::BinaryReader binaryReader(chunk.slice(4, 5));
+    EXPECT_EQ(binaryReader.readUint32(), 2u);
+    const auto body = binaryReader.readChunk(1);
+    EXPECT_EQ(body.data.get(), file->data() + 8);
+    EXPECT_THROW(binaryReader.readUint32(), std::runtime_error);
+    EXPECT_THROW(chunk.slice(8, 2), std::runtime_error);
+  }
+
+  std::remove(path.c_str());
+  EXPECT_EQ(MemoryMappedFile::Open(path), nullptr);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
+
+/**
+ * @brief Test Suite for the random streams.
+ */
+
+/**
+ * @brief streams are reproducible and independent for different sequences
+ */
+TEST(TestRandomStream, Deterministic)
+{
+  using namespace BABYLON;
+
+  Math::RandomStream stream0(42, 0), stream1(42, 0), stream2(42, 1);
+  size_t sameValues = 0;
+  for (size_t i = 0; i < 1000; ++i) {
+    const auto value = stream0.nextFloat();
+    EXPECT_GE(value, 0.f);
+    EXPECT_LT(value, 1.f);
+    EXPECT_EQ(value, stream1.nextFloat());
+    sameValues += (value == stream2.nextFloat()) ? 1 : 0;
+  }
+  EXPECT_LT(sameValues, 10ull);
+}
+
+/**
+ * @brief Math::random() draws from the current stream of the thread, per chunk streams give the
+ * same results with or without worker threads
+ */
+TEST(TestRandomStream, ChunkStreams)
+{
+  using namespace BABYLON;
+
+  const auto draw = [](ThreadPool& pool) {
+    std::vector<float> values(10000);
+    pool.parallelFor(values.size(), 256, [&values](size_t chunk, size_t begin, size_t end) {
+      Math::RandomStream stream(7, chunk);
+      Math::RandomStreamScope scope(stream);
+      for (auto i = begin; i < end; ++i) {
+        values[i] = Math::random();
+      }
+    });
+    return values;
+  };
+
+  ThreadPool inlinePool(0), pool(3);
+  EXPECT_EQ(draw(inlinePool), draw(pool));
+  EXPECT_EQ(Math::RandomStream::Current(), nullptr);
+}
@@ -0,0 +1,66 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, parallelForVisitsEachElementOnce)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(3);
+  std::vector<int> visits(10007, 0);
+  pool.parallelFor(visits.size(), 64, [&visits](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+  EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 10007);
+  EXPECT_EQ(*std::min_element(visits.begin(), visits.end()), 1);
+}
+
+TEST(TestThreadPool, parallelForChunksAreDeterministic)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::vector<size_t> chunkBegins(5, 0);
+  pool.parallelFor(100, 20, [&chunkBegins](size_t chunkIndex, size_t begin, size_t end) {
+    EXPECT_EQ(end - begin, 20ull);
+    chunkBegins[chunkIndex] = begin;
+  });
+  EXPECT_THAT(chunkBegins, ::testing::ElementsAre(0, 20, 40, 60, 80));
+}
+
+TEST(TestThreadPool, nestedParallelForAndInlinePool)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<size_t> total{0};
+  pool.parallelFor(8, 1, [&pool, &total](size_t, size_t) {
+    pool.parallelFor(100, 10, [&total](size_t begin, size_t end) { total += end - begin; });
+  });
+  EXPECT_EQ(total, 800ull);
+
+  ThreadPool inlinePool(0);
+  EXPECT_EQ(inlinePool.concurrency(), 1ull);
+  EXPECT_EQ(inlinePool.enqueue([]() { return 42; }).get(), 42);
+}
+
+TEST(TestThreadPool, parallelForRethrowsExceptions)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  EXPECT_THROW(pool.parallelFor(16, 1,
+                                [](size_t begin, size_t) {
+                                  if (begin == 7) {
+                                    throw std::runtime_error("chunk failure");
+                                  }
+                                }),
+               std::runtime_error);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/culling_store.h>
+#include <babylon/engines/constants.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/plane.h>
+
+TEST(TestCullingStore, matchesBoundingInfo)
+{
+  using namespace BABYLON;
+
+  auto target     = Vector3::Zero();
+  auto view       = Matrix::LookAtLH(Vector3(0.f, 5.f, -20.f), target, Vector3::Up());
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.5f, 1.f, 100.f);
+  auto planes     = Frustum::GetPlanes(view.multiply(projection));
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(-60.f, 60.f);
+  std::uniform_real_distribution<float> extent(0.1f, 4.f);
+  std::uniform_real_distribution<float> angle(0.f, 3.14f);
+
+  const size_t count = 1003;
+  std::vector<BoundingInfo> boundingInfos;
+  std::vector<unsigned int> strategies;
+  boundingInfos.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const Vector3 halfSize(extent(generator), extent(generator), extent(generator));
+    BoundingInfo boundingInfo(halfSize.negate(), halfSize);
+    auto world = Matrix::RotationYawPitchRoll(angle(generator), angle(generator), angle(generator))
+                   .multiply(Matrix::Translation(position(generator), position(generator),
+                                                 position(generator) + 40.f));
+    boundingInfo.update(world);
+    boundingInfos.emplace_back(boundingInfo);
+    strategies.emplace_back(static_cast<unsigned int>(i % 4));
+  }
+
+  CullingStore store;
+  store.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    store.set(i, boundingInfos[i], strategies[i]);
+  }
+
+  std::vector<uint8_t> results(count);
+  store.isInFrustum(planes, results.data());
+  size_t visibleCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(results[i] != 0, boundingInfos[i].isInFrustum(planes, strategies[i])) << i;
+    visibleCount += results[i];
+  }
+  EXPECT_GT(visibleCount, 0ull);
+  EXPECT_LT(visibleCount, count);
+
+  // Sub ranges are written from the start of the output buffer
+  std::vector<uint8_t> rangeResults(10);
+  store.isInFrustum(planes, rangeResults.data(), 501, 511);
+  for (size_t i = 0; i < rangeResults.size(); ++i) {
+    EXPECT_EQ(rangeResults[i], results[501 + i]);
+  }
+}
+
+TEST(TestCullingStore, setBox)
+{
+  using namespace BABYLON;
+
+  auto target     = Vector3::Zero();
+  auto view       = Matrix::LookAtLH(Vector3(0.f, 0.f, -10.f), target, Vector3::Up());
+  auto projection = Matrix::PerspectiveFovLH(0.8f, 1.f, 1.f, 50.f);
+  auto planes     = Frustum::GetPlanes(view.multiply(projection));
+
+  CullingStore store;
+  store.resize(3);
+  store.setBox(0, Vector3(-1.f, -1.f, -1.f), Vector3(1.f, 1.f, 1.f));
+  store.setBox(1, Vector3(100.f, 100.f, 100.f), Vector3(101.f, 101.f, 101.f));
+  store.setBox(2, Vector3(-1.f, -1.f, -30.f), Vector3(1.f, 1.f, -20.f));
+
+  std::array<uint8_t, 3> results{};
+  store.isInFrustum(planes, results.data());
+  EXPECT_EQ(results[0], 1);
+  EXPECT_EQ(results[1], 0);
+  EXPECT_EQ(results[2], 0);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/octrees/loose_octree.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/plane.h>
+
+namespace {
+
+using namespace BABYLON;
+
+// The entries are opaque keys, their bounds are read from a map
+struct Boxes {
+  std::unordered_map<AbstractMesh*, std::pair<Vector3, Vector3>> bounds;
+  std::vector<AbstractMesh*> entries;
+
+  static AbstractMesh* Key(size_t index)
+  {
+    return reinterpret_cast<AbstractMesh*>(static_cast<uintptr_t>(index + 1) * 16);
+  }
+
+  LooseOctree<AbstractMesh*>::BoundsFunc boundsFunc()
+  {
+    return [this](AbstractMesh* const& entry, Vector3& minimum, Vector3& maximum) {
+      const auto& box = bounds.at(entry);
+      minimum         = box.first;
+      maximum         = box.second;
+      return true;
+    };
+  }
+
+  template <typename Test>
+  std::vector<AbstractMesh*> bruteForce(const Test& test) const
+  {
+    std::vector<AbstractMesh*> result;
+    for (const auto& entry : entries) {
+      const auto& box = bounds.at(entry);
+      if (test(box.first, box.second)) {
+        result.emplace_back(entry);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+}; // end of struct Boxes
+
+std::vector<AbstractMesh*> Sorted(std::vector<AbstractMesh*> selection)
+{
+  std::sort(selection.begin(), selection.end());
+  return selection;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Tests that the queries return the same entries as the brute force tests while the entries
+ * move.
+ */
+TEST(TestLooseOctree, matchesBruteForceWhileMoving)
+{
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> position(-100.f, 100.f);
+  std::uniform_real_distribution<float> extent(0.05f, 3.f);
+  std::uniform_real_distribution<float> step(-4.f, 4.f);
+
+  Boxes boxes;
+  const size_t count = 2000;
+  for (size_t i = 0; i < count; ++i) {
+    const Vector3 center(position(generator), position(generator), position(generator));
+    const auto e = (i % 100 == 0) ? 60.f : extent(generator);
+    boxes.entries.emplace_back(Boxes::Key(i));
+    const Vector3 halfSize(e, e, e);
+    boxes.bounds[Boxes::Key(i)] = {center.subtract(halfSize), center.add(halfSize)};
+  }
+
+  LooseOctree<AbstractMesh*> octree(boxes.boundsFunc(), 16, 6);
+  octree.update(Vector3(-100.f, -100.f, -100.f), Vector3(100.f, 100.f, 100.f), boxes.entries);
+  EXPECT_EQ(octree.size(), count);
+
+  auto target     = Vector3::Zero();
+  auto view       = Matrix::LookAtLH(Vector3(0.f, 20.f, -150.f), target, Vector3::Up());
+  auto projection = Matrix::PerspectiveFovLH(0.6f, 1.5f, 1.f, 200.f);
+  auto planes     = Frustum::GetPlanes(view.multiply(projection));
+  Ray ray(Vector3(-150.f, 3.f, -2.f), Vector3(1.f, 0.02f, 0.01f).normalize(), 400.f);
+
+  for (size_t round = 0; round < 5; ++round) {
+    // 10% of the entries move, some of them outside of the world
+    for (size_t i = round; i < count; i += 10) {
+      auto& box = boxes.bounds[Boxes::Key(i)];
+      const Vector3 offset(step(generator) * (round + 1), step(generator), step(generator) * 8.f);
+      box.first.addInPlace(offset);
+      box.second.addInPlace(offset);
+    }
+    EXPECT_GT(octree.refresh(), 0ull);
+
+    const auto frustumTest = [&planes](const Vector3& minimum, const Vector3& maximum) {
+      const auto center = minimum.add(maximum).scale(0.5f);
+      const auto extent = maximum.subtract(minimum).scale(0.5f);
+      for (const auto& plane : planes) {
+        const auto radius = std::abs(plane.normal.x) * extent.x
+                            + std::abs(plane.normal.y) * extent.y
+                            + std::abs(plane.normal.z) * extent.z;
+        if (plane.dotCoordinate(center) < -radius) {
+          return false;
+        }
+      }
+      return true;
+    };
+    const auto frustumSelection = Sorted(octree.select(planes));
+    EXPECT_EQ(frustumSelection, boxes.bruteForce(frustumTest));
+    EXPECT_LT(frustumSelection.size(), count);
+
+    const Vector3 sphereCenter(10.f, -5.f, 20.f);
+    const auto sphereSelection = Sorted(octree.intersects(sphereCenter, 30.f));
+    EXPECT_EQ(sphereSelection,
+              boxes.bruteForce([&sphereCenter](const Vector3& minimum, const Vector3& maximum) {
+                return BoundingBox::IntersectsSphere(minimum, maximum, sphereCenter, 30.f);
+              }));
+
+    const auto raySelection = Sorted(octree.intersectsRay(ray));
+    EXPECT_EQ(raySelection,
+              boxes.bruteForce([&ray](const Vector3& minimum, const Vector3& maximum) {
+                return ray.intersectsBoxMinMax(minimum, maximum);
+              }));
+  }
+
+  // Removing the entries releases the cells
+  for (size_t i = 0; i < count; i += 2) {
+    octree.removeEntry(Boxes::Key(i));
+  }
+  boxes.entries.clear();
+  for (size_t i = 1; i < count; i += 2) {
+    boxes.entries.emplace_back(Boxes::Key(i));
+  }
+  EXPECT_EQ(octree.size(), count / 2);
+  const auto all = [](const Vector3& /*minimum*/, const Vector3& /*maximum*/) { return true; };
+  EXPECT_EQ(Sorted(octree.intersects(Vector3::Zero(), 500.f)), boxes.bruteForce(all));
+
+  for (const auto& entry : boxes.entries) {
+    octree.removeEntry(entry);
+  }
+  EXPECT_EQ(octree.size(), 0ull);
+  EXPECT_EQ(octree.nodeCount(), 1ull);
+}
+
+/**
+ * @brief Tests that the dynamic content is merged without duplicates.
+ */
+TEST(TestLooseOctree, dynamicContentWithoutDuplicates)
+{
+  using namespace BABYLON;
+
+  Boxes boxes;
+  for (size_t i = 0; i < 4; ++i) {
+    const auto x = static_cast<float>(i) * 10.f;
+    boxes.entries.emplace_back(Boxes::Key(i));
+    boxes.bounds[Boxes::Key(i)] = {Vector3(x, 0.f, 0.f), Vector3(x + 1.f, 1.f, 1.f)};
+  }
+
+  LooseOctree<AbstractMesh*> octree(boxes.boundsFunc());
+  octree.update(Vector3::Zero(), Vector3(40.f, 1.f, 1.f), boxes.entries);
+  octree.dynamicContent = {Boxes::Key(0), Boxes::Key(3), Boxes::Key(3), Boxes::Key(9)};
+
+  // Entry 0 is selected by the query, entries 3 and 9 come from the dynamic content only
+  const auto& selection = octree.intersects(Vector3::Zero(), 2.f);
+  EXPECT_EQ(selection, (std::vector<AbstractMesh*>{Boxes::Key(0), Boxes::Key(3), Boxes::Key(9)}));
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/bvh.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+/**
+ * @brief Linear scan of SubMesh::_intersectTriangles for a triangle list.
+ */
+std::optional<BABYLON::IntersectionInfo>
+IntersectLinear(BABYLON::Ray& ray, const std::vector<BABYLON::Vector3>& positions,
+                const BABYLON::IndicesArray& indices, bool fastCheck,
+                const BABYLON::TriangleBVH::TrianglePickingPredicate& trianglePredicate)
+{
+  std::optional<BABYLON::IntersectionInfo> intersectInfo = std::nullopt;
+  for (size_t index = 0, faceId = 0; index < indices.size(); index += 3, ++faceId) {
+    const auto& p0 = positions[indices[index]];
+    const auto& p1 = positions[indices[index + 1]];
+    const auto& p2 = positions[indices[index + 2]];
+    if (trianglePredicate && !trianglePredicate(p0, p1, p2, ray)) {
+      continue;
+    }
+    const auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+    if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+      continue;
+    }
+    if (fastCheck || !intersectInfo || currentIntersectInfo->distance < intersectInfo->distance) {
+      intersectInfo         = currentIntersectInfo;
+      intersectInfo->faceId = faceId;
+      if (fastCheck) {
+        break;
+      }
+    }
+  }
+  return intersectInfo;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for the picking bounding volume hierarchies.
+ */
+
+/**
+ * @brief the hierarchy returns the same hits as the linear scan, closest hit and fast check
+ */
+TEST(TestTriangleBVH, MatchesLinearScan)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> position(-20.f, 20.f);
+  std::uniform_real_distribution<float> offset(-1.5f, 1.5f);
+
+  const size_t triangleCount = 2000;
+  std::vector<Vector3> positions;
+  IndicesArray indices;
+  for (size_t i = 0; i < triangleCount; ++i) {
+    const Vector3 center(position(generator), position(generator), position(generator));
+    for (size_t vertex = 0; vertex < 3; ++vertex) {
+      indices.emplace_back(static_cast<uint32_t>(positions.size()));
+      positions.emplace_back(center.add(Vector3(offset(generator), offset(generator),
+                                                offset(generator))));
+    }
+  }
+
+  const TriangleBVH triangleBVH(positions, indices, 0, indices.size());
+  EXPECT_EQ(triangleBVH.triangleCount(), triangleCount);
+
+  const TriangleBVH::TrianglePickingPredicate predicate
+    = [](const Vector3& p0, const Vector3& /*p1*/, const Vector3& /*p2*/, const Ray& /*ray*/) {
+        return p0.y < 10.f;
+      };
+
+  size_t hitCount = 0;
+  for (size_t i = 0; i < 500; ++i) {
+    const Vector3 origin(position(generator), position(generator), -40.f);
+    const auto target = Vector3(position(generator), position(generator), 40.f);
+    Ray ray(origin, target.subtract(origin).normalize(), 100.f);
+    for (const auto fastCheck : {false, true}) {
+      for (const auto& trianglePredicate :
+           {TriangleBVH::TrianglePickingPredicate(nullptr), predicate}) {
+        const auto expected
+          = IntersectLinear(ray, positions, indices, fastCheck, trianglePredicate);
+        const auto result = triangleBVH.intersects(ray, positions, fastCheck, trianglePredicate);
+        ASSERT_EQ(result.has_value(), expected.has_value());
+        if (expected) {
+          EXPECT_EQ(result->faceId, expected->faceId);
+          EXPECT_FLOAT_EQ(result->distance, expected->distance);
+          ++hitCount;
+        }
+      }
+    }
+  }
+  EXPECT_GT(hitCount, 0ull);
+}
+
+/**
+ * @brief the refitted nodes enclose their moved primitives
+ */
+TEST(TestTriangleBVH, Refit)
+{
+  using namespace BABYLON;
+
+  std::vector<BVH::Bounds> bounds;
+  for (size_t i = 0; i < 100; ++i) {
+    const auto x = static_cast<float>(i);
+    bounds.emplace_back(BVH::Bounds{{x, 0.f, 0.f}, {x + 1.f, 1.f, 1.f}});
+  }
+
+  BVH bvh;
+  bvh.build(bounds, 2);
+  ASSERT_FALSE(bvh.empty());
+
+  for (auto& primitive : bounds) {
+    primitive.minimum[1] += 5.f;
+    primitive.maximum[1] += 5.f;
+  }
+  bvh.refit(bounds);
+
+  for (const auto& node : bvh.nodes) {
+    if (!node.isLeaf()) {
+      continue;
+    }
+    for (auto i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+      const auto& primitive = bounds[bvh.primitiveIndices[i]];
+      for (size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_LE(node.minimum[axis], primitive.minimum[axis]);
+        EXPECT_GE(node.maximum[axis], primitive.maximum[axis]);
+      }
+    }
+  }
+  EXPECT_FLOAT_EQ(bvh.nodes[0].minimum[1], 5.f);
+  EXPECT_FLOAT_EQ(bvh.nodes[0].maximum[1], 6.f);
+}
+
+/**
+ * @brief the box query returns every triangle overlapping the box, in face order
+ */
+TEST(TestTriangleBVH, CollectTriangles)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(-20.f, 20.f);
+  std::uniform_real_distribution<float> offset(-1.f, 1.f);
+
+  std::vector<Vector3> positions;
+  for (size_t i = 0; i < 1000; ++i) {
+    const Vector3 center(position(generator), position(generator), position(generator));
+    for (size_t vertex = 0; vertex < 3; ++vertex) {
+      positions.emplace_back(center.add(Vector3(offset(generator), offset(generator),
+                                                offset(generator))));
+    }
+  }
+
+  // Unindexed geometry
+  const TriangleBVH triangleBVH(positions, {}, 0, positions.size());
+  std::vector<TriangleBVH::Triangle> triangles;
+  for (size_t i = 0; i < 50; ++i) {
+    const Vector3 center(position(generator), position(generator), position(generator));
+    const auto minimum = center.subtract(Vector3(3.f, 3.f, 3.f));
+    const auto maximum = center.add(Vector3(3.f, 3.f, 3.f));
+    triangleBVH.collectTriangles(minimum, maximum, triangles);
+
+    for (size_t j = 1; j < triangles.size(); ++j) {
+      EXPECT_LT(triangles[j - 1].faceId, triangles[j].faceId);
+    }
+    for (size_t faceId = 0; faceId < positions.size() / 3; ++faceId) {
+      const auto& p0 = positions[faceId * 3];
+      const auto& p1 = positions[faceId * 3 + 1];
+      const auto& p2 = positions[faceId * 3 + 2];
+      const auto overlaps = std::max({p0.x, p1.x, p2.x}) >= minimum.x
+                            && std::min({p0.x, p1.x, p2.x}) <= maximum.x
+                            && std::max({p0.y, p1.y, p2.y}) >= minimum.y
+                            && std::min({p0.y, p1.y, p2.y}) <= maximum.y
+                            && std::max({p0.z, p1.z, p2.z}) >= minimum.z
+                            && std::min({p0.z, p1.z, p2.z}) <= maximum.z;
+      if (overlaps) {
+        EXPECT_TRUE(std::any_of(
+          triangles.begin(), triangles.end(),
+          [faceId](const TriangleBVH::Triangle& triangle) { return triangle.faceId == faceId; }));
+      }
+    }
+  }
+}
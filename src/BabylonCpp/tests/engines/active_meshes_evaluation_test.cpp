@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/push_material.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+using namespace BABYLON;
+
+struct ActiveMeshesEvaluation {
+  bool parallelActiveMeshesEvaluation = false;
+  bool batchedFrustumCulling          = false;
+};
+
+/**
+ * @brief Renders a scene with boxes around and out of the frustum, instances of boxes with LOD
+ * levels (which share the LOD meshes of their source box) and empty LOD levels, and returns the
+ * names of the active meshes of each frame. The meshes use a material which is never ready, so
+ * that only the active meshes are evaluated and nothing is drawn.
+ */
+std::vector<std::vector<std::string>> RenderFrames(const ActiveMeshesEvaluation& evaluation)
+{
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->parallelActiveMeshesEvaluation = evaluation.parallelActiveMeshesEvaluation;
+  scene->batchedFrustumCulling          = evaluation.batchedFrustumCulling;
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 5.f, -60.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  auto material = PushMaterial::New("material", scene.get());
+  BoxOptions options;
+  const auto callingThread = std::this_thread::get_id();
+  size_t lodSelections     = 0;
+  for (int x = -20; x < 20; ++x) {
+    for (int z = -10; z < 10; ++z) {
+      const auto name = "box" + std::to_string(x) + "_" + std::to_string(z);
+      auto box        = BoxBuilder::CreateBox(name, options, scene.get());
+      box->material   = material;
+      box->position   = Vector3(static_cast<float>(x) * 4.f, 0.f, static_cast<float>(z) * 4.f);
+      if ((x + z) % 3 == 0) {
+        auto instance      = box->createInstance(name + "_instance");
+        instance->position = box->position().add(Vector3(0.f, 3.f, 0.f));
+      }
+      if ((x + z) % 5 == 0) {
+        MeshPtr lod = nullptr;
+        if ((x + z) % 2 == 0) {
+          lod = BoxBuilder::CreateBox(name + "_lod", options, scene.get());
+          lod->material = material;
+          lod->setEnabled(false);
+        }
+        box->addLODLevel(40.f, lod);
+        box->onLODLevelSelection = [&](float /*distance*/, Mesh* /*mesh*/, Mesh* /*level*/) {
+          EXPECT_EQ(std::this_thread::get_id(), callingThread);
+          ++lodSelections;
+        };
+      }
+    }
+  }
+
+  std::vector<std::vector<std::string>> frames;
+  for (const auto& position : {Vector3(0.f, 5.f, -60.f), Vector3(30.f, 10.f, 0.f),
+                               Vector3(-70.f, 20.f, 30.f)}) {
+    camera->position = position;
+    camera->setTarget(Vector3::Zero());
+    scene->render();
+    std::vector<std::string> activeMeshes;
+    for (const auto& mesh : scene->getActiveMeshes()) {
+      activeMeshes.emplace_back(mesh->name);
+    }
+    frames.emplace_back(activeMeshes);
+  }
+  EXPECT_GT(lodSelections, 0ull);
+
+  return frames;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for the evaluation of the active meshes.
+ */
+
+/**
+ * @brief the active meshes are the same, in the same order, with the serial, the parallel and the
+ * batched evaluations, and the LOD levels are selected on the calling thread
+ */
+TEST(TestActiveMeshesEvaluation, SameActiveMeshes)
+{
+  using namespace BABYLON;
+
+  const auto expected = RenderFrames({false, false});
+  ASSERT_EQ(expected.size(), 3ull);
+  for (const auto& activeMeshes : expected) {
+    EXPECT_FALSE(activeMeshes.empty());
+  }
+  EXPECT_EQ(RenderFrames({true, false}), expected);
+  EXPECT_EQ(RenderFrames({false, true}), expected);
+  EXPECT_EQ(RenderFrames({true, true}), expected);
+}
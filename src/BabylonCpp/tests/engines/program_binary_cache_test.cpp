@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/engines/program_binary_cache.h>
+
+/**
+ * @brief Test Suite for ProgramBinaryCache.
+ */
+
+/**
+ * @brief program binaries are stored on disk and only loaded for the same driver
+ */
+TEST(TestProgramBinaryCache, SaveLoadAndInvalidate)
+{
+  using namespace BABYLON;
+
+  const auto directory = ::testing::TempDir() + "program_binary_cache_test";
+  const Uint8Array program{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  std::string key;
+  {
+    ProgramBinaryCache cache(directory, "Vendor | Renderer | 4.6 driver 1.0");
+    cache.clear();
+
+    key = cache.computeKey("vertex", "fragment");
+    EXPECT_NE(key, cache.computeKey("fragment", "vertex"));
+
+    unsigned int binaryFormat = 0;
+    Uint8Array binary;
+    EXPECT_FALSE(cache.load(key, binaryFormat, binary));
+    EXPECT_TRUE(cache.save(key, 0x8E21, program));
+  }
+
+  {
+    // Next run, same driver
+    ProgramBinaryCache cache(directory, "Vendor | Renderer | 4.6 driver 1.0");
+    EXPECT_EQ(cache.computeKey("vertex", "fragment"), key);
+
+    unsigned int binaryFormat = 0;
+    Uint8Array binary;
+    EXPECT_TRUE(cache.load(key, binaryFormat, binary));
+    EXPECT_EQ(binaryFormat, 0x8E21u);
+    EXPECT_EQ(binary, program);
+
+    // Rejected by the driver
+    cache.remove(key);
+    EXPECT_FALSE(cache.load(key, binaryFormat, binary));
+    EXPECT_TRUE(cache.save(key, 0x8E21, program));
+  }
+
+  {
+    // Driver update
+    ProgramBinaryCache cache(directory, "Vendor | Renderer | 4.6 driver 2.0");
+    EXPECT_NE(cache.computeKey("vertex", "fragment"), key);
+    EXPECT_FALSE(Filesystem::exists(Filesystem::joinPath(directory, key + ".bin")));
+    cache.clear();
+  }
+
+  Filesystem::removeFile(Filesystem::joinPath(directory, std::string("driver.txt")));
+  Filesystem::removeFile(Filesystem::joinPath(directory, std::string("index.txt")));
+  Filesystem::removeFile(directory);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/processors/ishader_processor.h>
+#include <babylon/engines/processors/shader_processing_options.h>
+#include <babylon/engines/processors/shader_processor.h>
+
+namespace {
+
+std::string ProcessShader(const std::string& sourceCode, BABYLON::ProcessingOptions& options)
+{
+  std::string processedCode;
+  BABYLON::ShaderProcessor::Process(
+    sourceCode, options, [&processedCode](const std::string& code) { processedCode = code; },
+    nullptr);
+  return processedCode;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for ShaderProcessor.
+ */
+
+/**
+ * @brief includes are expanded with their parameters and indexes
+ */
+TEST(TestShaderProcessor, ProcessIncludes)
+{
+  using namespace BABYLON;
+
+  ProcessingOptions options;
+  options.defines                       = {"#define LIGHT0"};
+  options.indexParameters               = {{"maxSimultaneousLights", 2}};
+  options.includesShadersStore["light"] = "uniform vec4 vLightData{X};";
+  options.includesShadersStore["color"] = "vec4 color = COLOR;";
+
+  const auto code = ProcessShader("#include<light>[0..maxSimultaneousLights]\n"
+                                  "#ifdef LIGHT0\n"
+                                  "#include<color>(COLOR,vec4(1.))\n"
+                                  "#endif\n",
+                                  options);
+
+  EXPECT_NE(code.find("uniform vec4 vLightData0;"), std::string::npos);
+  EXPECT_NE(code.find("uniform vec4 vLightData1;"), std::string::npos);
+  EXPECT_EQ(code.find("vLightData2"), std::string::npos);
+  EXPECT_NE(code.find("vec4 color = vec4(1.);"), std::string::npos);
+  EXPECT_EQ(code.find("#include"), std::string::npos);
+  EXPECT_EQ(options.includedFiles.size(), 2ull);
+}
+
+/**
+ * @brief processed codes are reused until one of their includes changes
+ */
+TEST(TestShaderProcessor, ProcessedCodeCache)
+{
+  using namespace BABYLON;
+
+  ShaderProcessor::ClearProcessedCodeCache();
+
+  const std::string sourceCode = "#include<color>\n#ifdef ALPHA\nfloat alpha;\n#endif\n";
+
+  ProcessingOptions options;
+  options.processor                     = std::make_shared<IShaderProcessor>();
+  options.includesShadersStore["color"] = "vec4 color = vec4(1.);";
+  const auto code = ProcessShader(sourceCode, options);
+  EXPECT_EQ(ProcessShader(sourceCode, options), code);
+
+  options.includesShadersStore["color"] = "vec4 color = vec4(0.);";
+  EXPECT_NE(ProcessShader(sourceCode, options).find("vec4(0.)"), std::string::npos);
+  EXPECT_EQ(code.find("alpha"), std::string::npos);
+
+  options.defines = {"#define ALPHA"};
+  EXPECT_NE(ProcessShader(sourceCode, options).find("float alpha;"), std::string::npos);
+
+  ShaderProcessor::ClearProcessedCodeCache();
+}
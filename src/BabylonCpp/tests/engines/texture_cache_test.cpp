@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/constants.h>
+#include <babylon/engines/texture_cache.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/materials/textures/internal_texture_source.h>
+
+/**
+ * @brief Test Suite for TextureCache.
+ */
+
+/**
+ * @brief urls are normalized and embedded buffers are keyed by content
+ */
+TEST(TestTextureCache, ComputeKey)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(TextureCache::NormalizeUrl("textures/./wood.png"), "textures/wood.png");
+  EXPECT_EQ(TextureCache::NormalizeUrl("models\\..\\textures//wood.png"), "textures/wood.png");
+  EXPECT_EQ(TextureCache::NormalizeUrl("/assets/a/../wood.png?v=1"), "/assets/wood.png?v=1");
+  EXPECT_EQ(TextureCache::ComputeKey("textures/./wood.png"),
+            TextureCache::ComputeKey("textures/wood.png"));
+  EXPECT_EQ(TextureCache::ComputeKey(""), "");
+
+  // The same image embedded in two files shares the same key
+  const ArrayBuffer image{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const ArrayBuffer otherImage{1, 2, 3, 4, 5, 6, 7, 8, 0};
+  EXPECT_EQ(TextureCache::ComputeKey("data:scene1.glb#image0", image),
+            TextureCache::ComputeKey("data:scene2.glb#image3", image));
+  EXPECT_NE(TextureCache::ComputeKey("data:scene1.glb#image0", image),
+            TextureCache::ComputeKey("data:scene1.glb#image0", otherImage));
+
+  // Unless content hashing is disabled
+  EXPECT_NE(TextureCache::ComputeKey("data:scene1.glb#image0", image, false),
+            TextureCache::ComputeKey("data:scene2.glb#image3", image, false));
+}
+
+/**
+ * @brief textures are found by key and matched on their sampling parameters
+ */
+TEST(TestTextureCache, FindAndRemove)
+{
+  using namespace BABYLON;
+
+  TextureCache cache(nullptr);
+
+  auto texture             = InternalTexture::New(nullptr, InternalTextureSource::Url, true);
+  texture->generateMipMaps = true;
+  texture->samplingMode    = Constants::TEXTURE_TRILINEAR_SAMPLINGMODE;
+  texture->invertY         = true;
+
+  const auto key = TextureCache::ComputeKey("textures/wood.png");
+  cache.add(key, texture);
+
+  EXPECT_EQ(cache.find(key, false), texture);
+  EXPECT_EQ(cache.find(TextureCache::ComputeKey("textures/../textures/wood.png"), false,
+                       Constants::TEXTURE_TRILINEAR_SAMPLINGMODE, true),
+            texture);
+  EXPECT_EQ(cache.find(key, true), nullptr);
+  EXPECT_EQ(cache.find(key, false, Constants::TEXTURE_NEAREST_SAMPLINGMODE), nullptr);
+  EXPECT_EQ(cache.find(key, false, 0, false), nullptr);
+  EXPECT_EQ(cache.statistics().hits, 2ull);
+  EXPECT_EQ(cache.statistics().misses, 3ull);
+
+  // Released textures without GPU resources are not kept alive
+  EXPECT_FALSE(cache._onTextureReleased(texture));
+
+  cache.remove(texture.get());
+  EXPECT_EQ(cache.find(key, false), nullptr);
+}
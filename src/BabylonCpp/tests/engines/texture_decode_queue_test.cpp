@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <babylon/core/structs.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/texture_decode_queue.h>
+
+/**
+ * @brief Test Suite for TextureDecodeQueue.
+ */
+
+/**
+ * @brief callbacks are only invoked when processing the uploads
+ */
+TEST(TestTextureDecodeQueue, CallbacksAreDeferredToProcessUploads)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(0);
+  TextureDecodeQueue queue(threadPool);
+
+  size_t numErrors = 0;
+  queue.loadFile(
+    "textures/does_not_exist.dds", [](const ArrayBuffer& /*data*/) {},
+    [&numErrors](const std::string& /*message*/, const std::string& /*exception*/) {
+      ++numErrors;
+    });
+
+  // The job ran inline but its callback waits for the render thread
+  EXPECT_EQ(numErrors, 0ull);
+  EXPECT_EQ(queue.pendingCount(), 1ull);
+
+  EXPECT_EQ(queue.processUploads(0.f), 1ull);
+  EXPECT_EQ(numErrors, 1ull);
+  EXPECT_EQ(queue.pendingCount(), 0ull);
+}
+
+/**
+ * @brief jobs exceeding the number of pending jobs wait for a free slot
+ */
+TEST(TestTextureDecodeQueue, BoundedPendingJobs)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(2);
+  TextureDecodeQueue queue(threadPool, 2);
+
+  std::vector<std::string> loaded;
+  size_t maxInFlight = 0;
+  for (const auto& url : {"a.png", "b.png", "c.png", "d.png", "e.png"}) {
+    queue.loadImage(
+      url, false, [](const Image& /*img*/) {},
+      [&queue, &loaded, &maxInFlight, url](const std::string& /*message*/,
+                                           const std::string& /*exception*/) {
+        maxInFlight = std::max(maxInFlight, queue.inFlightCount());
+        loaded.emplace_back(url);
+      });
+    maxInFlight = std::max(maxInFlight, queue.inFlightCount());
+  }
+  EXPECT_EQ(queue.pendingCount(), 5ull);
+  EXPECT_EQ(queue.inFlightCount(), 2ull);
+
+  while (loaded.size() < 3) {
+    queue.processUploads(0.f);
+    maxInFlight = std::max(maxInFlight, queue.inFlightCount());
+    std::this_thread::yield();
+  }
+
+  queue.flush();
+  EXPECT_EQ(queue.pendingCount(), 0ull);
+  EXPECT_EQ(queue.inFlightCount(), 0ull);
+  EXPECT_LE(maxInFlight, 2ull);
+  std::sort(loaded.begin(), loaded.end());
+  EXPECT_EQ(loaded, (std::vector<std::string>{"a.png", "b.png", "c.png", "d.png", "e.png"}));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+#include <babylon/engines/webgl/webgl_pipeline_context.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/maths/matrix.h>
+
+/**
+ * @brief Test Suite for WebGLPipelineContext.
+ */
+
+/**
+ * @brief uniforms are cached by handle
+ */
+TEST(TestWebGLPipelineContext, UniformValueCacheByHandle)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  WebGLPipelineContext pipelineContext;
+  pipelineContext.engine            = engine.get();
+  pipelineContext._uniformLocations = {std::make_shared<GL::IGLUniformLocation>(0),
+                                       std::make_shared<GL::IGLUniformLocation>(1)};
+  pipelineContext._valueCache.resize(2);
+  pipelineContext._uniformHandles = {{"world", 0}, {"scale", 1}};
+
+  // Handles
+  EXPECT_EQ(pipelineContext.getUniformHandle("world"), 0);
+  EXPECT_EQ(pipelineContext.getUniformHandle("scale"), 1);
+  EXPECT_EQ(pipelineContext.getUniformHandle("unknown"), -1);
+
+  // Float2 cache
+  EXPECT_TRUE(pipelineContext._cacheFloat2(1, 1.f, 2.f));
+  EXPECT_FALSE(pipelineContext._cacheFloat2(1, 1.f, 2.f));
+  EXPECT_TRUE(pipelineContext._cacheFloat2(1, 1.f, 3.f));
+  EXPECT_TRUE(pipelineContext._cacheFloat3(1, 1.f, 3.f, 4.f));
+  EXPECT_FALSE(pipelineContext._cacheFloat2(-1, 1.f, 2.f));
+  EXPECT_FALSE(pipelineContext._cacheFloat2(2, 1.f, 2.f));
+
+  // Matrix cache
+  auto matrix = Matrix::Identity();
+  EXPECT_TRUE(pipelineContext._cacheMatrix(0, matrix));
+  EXPECT_FALSE(pipelineContext._cacheMatrix(0, matrix));
+  matrix.setTranslationFromFloats(1.f, 2.f, 3.f);
+  EXPECT_TRUE(pipelineContext._cacheMatrix(0, matrix));
+
+  // Setters go through the cache
+  pipelineContext.setFloat2("scale", 5.f, 6.f);
+  EXPECT_EQ(pipelineContext._valueCache[1].size, 2u);
+  EXPECT_EQ(pipelineContext._valueCache[1].values[0], 5.f);
+  EXPECT_EQ(pipelineContext._valueCache[1].values[1], 6.f);
+  pipelineContext.setArray("scale", {1.f, 2.f});
+  EXPECT_EQ(pipelineContext._valueCache[1].size, 0u);
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/loading/iscene_loader_async_result.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/misc/string_tools.h>
+
+namespace {
+
+using namespace BABYLON;
+
+/**
+ * @brief Appends values to a binary buffer, padded to the given alignment.
+ */
+template <typename T>
+size_t Append(std::vector<uint8_t>& bytes, const std::vector<T>& values, size_t alignment = 4)
+{
+  const auto byteOffset = bytes.size();
+  bytes.resize(byteOffset + values.size() * sizeof(T));
+  std::memcpy(bytes.data() + byteOffset, values.data(), values.size() * sizeof(T));
+  while (bytes.size() % alignment != 0) {
+    bytes.emplace_back(0);
+  }
+  return byteOffset;
+}
+
+void AppendUint32(std::vector<uint8_t>& bytes, uint32_t value)
+{
+  Append(bytes, std::vector<uint32_t>{value});
+}
+
+/**
+ * @brief Writes a binary glTF file made of a JSON chunk and a BIN chunk.
+ */
+void WriteGLB(const std::string& path, std::string json, const std::vector<uint8_t>& bin)
+{
+  while (json.size() % 4 != 0) {
+    json.push_back(' ');
+  }
+
+  std::vector<uint8_t> bytes;
+  AppendUint32(bytes, 0x46546C67); // magic "glTF"
+  AppendUint32(bytes, 2);          // version
+  AppendUint32(bytes, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+  AppendUint32(bytes, static_cast<uint32_t>(json.size()));
+  AppendUint32(bytes, 0x4E4F534A); // JSON
+  bytes.insert(bytes.end(), json.begin(), json.end());
+  AppendUint32(bytes, static_cast<uint32_t>(bin.size()));
+  AppendUint32(bytes, 0x004E4942); // BIN
+  bytes.insert(bytes.end(), bin.begin(), bin.end());
+
+  std::ofstream stream(path, std::ios::binary);
+  stream.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+}
+
+AbstractMeshPtr FindMeshWithGeometry(const ISceneLoaderAsyncResult& result)
+{
+  for (const auto& mesh : result.meshes) {
+    if (mesh->getTotalVertices() > 0) {
+      return mesh;
+    }
+  }
+  return nullptr;
+}
+
+void ExpectFloatArrayNear(const Float32Array& actual, const Float32Array& expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-6f) << "index " << i;
+  }
+}
+
+/**
+ * @brief Writes a binary glTF file with a triangle instanced twice with EXT_mesh_gpu_instancing.
+ */
+void WriteInstancingGLB(const std::string& path, const std::vector<float>& translations,
+                        const std::vector<float>& rotations, const std::vector<float>& scales)
+{
+  std::vector<uint8_t> bin;
+  const auto indicesOffset = Append(bin, std::vector<uint16_t>{0, 1, 2});
+  const auto positionsOffset
+    = Append(bin, std::vector<float>{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f});
+  const auto translationsOffset = Append(bin, translations);
+  const auto rotationsOffset    = Append(bin, rotations);
+  const auto scalesOffset       = Append(bin, scales);
+
+  const auto json = StringTools::printf(
+    R"({
+  "asset": {"version": "2.0"},
+  "extensionsUsed": ["EXT_mesh_gpu_instancing"],
+  "scene": 0,
+  "scenes": [{"nodes": [0]}],
+  "nodes": [{"name": "node", "mesh": 0, "extensions": {"EXT_mesh_gpu_instancing": {
+    "attributes": {"TRANSLATION": 2, "ROTATION": 3, "SCALE": 4}
+  }}}],
+  "meshes": [{"primitives": [{"attributes": {"POSITION": 1}, "indices": 0}]}],
+  "buffers": [{"byteLength": %zu}],
+  "bufferViews": [
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 6},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 36},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": %zu},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": %zu},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": %zu}
+  ],
+  "accessors": [
+    {"bufferView": 0, "componentType": 5123, "count": 3, "type": "SCALAR"},
+    {"bufferView": 1, "componentType": 5126, "count": 3, "type": "VEC3",
+     "min": [0, 0, 0], "max": [1, 1, 0]},
+    {"bufferView": 2, "componentType": 5126, "count": %zu, "type": "VEC3"},
+    {"bufferView": 3, "componentType": 5126, "count": %zu, "type": "VEC4"},
+    {"bufferView": 4, "componentType": 5126, "count": %zu, "type": "VEC3"}
+  ]
+})",
+    bin.size(), indicesOffset, positionsOffset, translationsOffset,
+    translations.size() * sizeof(float), rotationsOffset, rotations.size() * sizeof(float),
+    scalesOffset, scales.size() * sizeof(float), translations.size() / 3, rotations.size() / 4,
+    scales.size() / 3);
+
+  WriteGLB(path, json, bin);
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for GLTFLoader.
+ */
+
+/**
+ * @brief the accessors of a binary glTF file are decoded from its BIN chunk: indices, sparse
+ * accessors, normalized signed components (SHORT and BYTE) and misaligned accessors
+ */
+TEST(TestGLTFLoader, DecodeAccessors)
+{
+  using namespace BABYLON;
+
+  std::vector<uint8_t> bin;
+  // Indices
+  const auto indicesOffset = Append(bin, std::vector<uint16_t>{0, 1, 2});
+  // Positions, the last one replaced by the sparse values
+  const auto positionsOffset
+    = Append(bin, std::vector<float>{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f});
+  // Normalized SHORT texture coordinates, after a byte so that the accessor is misaligned
+  const auto uvsOffset = Append(bin, std::vector<int8_t>{0}, 1);
+  Append(bin, std::vector<int16_t>{32767, -32767, -32768, 16384, 0, -16384});
+  const auto positionsSparseIndicesOffset = Append(bin, std::vector<uint8_t>{2});
+  const auto positionsSparseValuesOffset  = Append(bin, std::vector<float>{5.f, 6.f, 7.f});
+  // Normalized BYTE normals, only defined by sparse values
+  const auto normalsSparseIndicesOffset = Append(bin, std::vector<uint8_t>{1});
+  const auto normalsSparseValuesOffset  = Append(bin, std::vector<int8_t>{-128, 0, 127});
+
+  const auto json = StringTools::printf(
+    R"({
+  "asset": {"version": "2.0"},
+  "extensionsUsed": ["KHR_mesh_quantization"],
+  "extensionsRequired": ["KHR_mesh_quantization"],
+  "scene": 0,
+  "scenes": [{"nodes": [0]}],
+  "nodes": [{"name": "node", "mesh": 0}],
+  "meshes": [{"primitives": [{
+    "attributes": {"POSITION": 1, "TEXCOORD_0": 2, "NORMAL": 3},
+    "indices": 0
+  }]}],
+  "buffers": [{"byteLength": %zu}],
+  "bufferViews": [
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 6},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 36},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 13},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 1},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 12},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 1},
+    {"buffer": 0, "byteOffset": %zu, "byteLength": 3}
+  ],
+  "accessors": [
+    {"bufferView": 0, "componentType": 5123, "count": 3, "type": "SCALAR"},
+    {"bufferView": 1, "componentType": 5126, "count": 3, "type": "VEC3",
+     "min": [0, 0, 0], "max": [5, 6, 7],
+     "sparse": {"count": 1, "indices": {"bufferView": 3, "componentType": 5121},
+                "values": {"bufferView": 4}}},
+    {"bufferView": 2, "byteOffset": 1, "componentType": 5122, "normalized": true, "count": 3,
+     "type": "VEC2"},
+    {"componentType": 5120, "normalized": true, "count": 3, "type": "VEC3",
+     "sparse": {"count": 1, "indices": {"bufferView": 5, "componentType": 5121},
+                "values": {"bufferView": 6}}}
+  ]
+})",
+    bin.size(), indicesOffset, positionsOffset, uvsOffset, positionsSparseIndicesOffset,
+    positionsSparseValuesOffset, normalsSparseIndicesOffset, normalsSparseValuesOffset);
+
+  const auto path = ::testing::TempDir() + "gltf_loader_decode_accessors_test.glb";
+  WriteGLB(path, json, bin);
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GLTF2::GLTFFileLoader loader;
+  const auto result = loader.importMeshFromFileAsync({}, scene.get(), path);
+  std::remove(path.c_str());
+
+  const auto mesh = FindMeshWithGeometry(result);
+  ASSERT_NE(mesh, nullptr);
+  EXPECT_EQ(mesh->getIndices(), (IndicesArray{0, 1, 2}));
+  ExpectFloatArrayNear(mesh->getVerticesData(VertexBuffer::PositionKind),
+                       {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 5.f, 6.f, 7.f});
+  // Signed normalized values are clamped to -1
+  ExpectFloatArrayNear(mesh->getVerticesData(VertexBuffer::UVKind),
+                       {1.f, -1.f, -1.f, 16384.f / 32767.f, 0.f, -16384.f / 32767.f});
+  ExpectFloatArrayNear(mesh->getVerticesData(VertexBuffer::NormalKind),
+                       {0.f, 0.f, 0.f, -1.f, 0.f, 1.f, 0.f, 0.f, 0.f});
+}
+
+/**
+ * @brief the TRANSLATION, ROTATION and SCALE attributes of EXT_mesh_gpu_instancing give the thin
+ * instance matrices of the meshes of the node
+ */
+TEST(TestGLTFLoader, MeshGpuInstancing)
+{
+  using namespace BABYLON;
+
+  const std::vector<float> translations{1.f, 2.f, 3.f, -1.f, 0.f, 0.f};
+  const std::vector<float> rotations{0.f, 0.f, 0.f, 1.f, 0.f, 0.70710678f, 0.f, 0.70710678f};
+  const std::vector<float> scales{1.f, 1.f, 1.f, 2.f, 3.f, 4.f};
+  const auto path = ::testing::TempDir() + "gltf_loader_mesh_gpu_instancing_test.glb";
+  WriteInstancingGLB(path, translations, rotations, scales);
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GLTF2::GLTFFileLoader loader;
+  const auto result = loader.importMeshFromFileAsync({}, scene.get(), path);
+  std::remove(path.c_str());
+
+  const auto mesh = std::dynamic_pointer_cast<Mesh>(FindMeshWithGeometry(result));
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->thinInstanceCount(), 2ull);
+  const auto matrices = mesh->thinInstanceGetWorldMatrices();
+  ASSERT_EQ(matrices.size(), 2ull);
+  for (unsigned int i = 0; i < 2; ++i) {
+    const auto expected = Matrix::Compose(Vector3::FromArray(scales, i * 3),
+                                          Quaternion::FromArray(rotations, i * 4),
+                                          Vector3::FromArray(translations, i * 3));
+    for (size_t j = 0; j < 16; ++j) {
+      EXPECT_NEAR(matrices[i].m()[j], expected.m()[j], 1e-6f) << "instance " << i << ", " << j;
+    }
+  }
+}
+
+/**
+ * @brief the instancing attributes must have the same count, the error names the attribute
+ */
+TEST(TestGLTFLoader, MeshGpuInstancingCountMismatch)
+{
+  using namespace BABYLON;
+
+  const auto path = ::testing::TempDir() + "gltf_loader_mesh_gpu_instancing_mismatch_test.glb";
+  WriteInstancingGLB(path, {1.f, 2.f, 3.f, -1.f, 0.f, 0.f},
+                     {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f}, {1.f, 1.f, 1.f});
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  GLTF2::GLTFFileLoader loader;
+  std::string error;
+  try {
+    loader.importMeshFromFileAsync({}, scene.get(), path);
+  }
+  catch (const std::exception& e) {
+    error = e.what();
+  }
+  std::remove(path.c_str());
+
+  EXPECT_NE(error.find("/extensions/EXT_mesh_gpu_instancing/attributes/SCALE"), std::string::npos)
+    << error;
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <babylon/materials/material_defines.h>
+#include <babylon/materials/pbr/pbr_material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+
+/**
+ * @brief Test Suite for MaterialDefines.
+ */
+
+/**
+ * @brief the declared defines have their default values
+ */
+TEST(TestMaterialDefines, DeclaredDefines)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  EXPECT_TRUE(defines.boolDef.contains("DIFFUSE"));
+  EXPECT_FALSE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines["ALPHABLEND"]);
+  EXPECT_TRUE(defines.intDef.contains("NUM_BONE_INFLUENCERS"));
+  EXPECT_EQ(defines.intDef["NUM_BONE_INFLUENCERS"], 0);
+  EXPECT_FALSE(defines.boolDef.contains("LIGHT0"));
+}
+
+/**
+ * @brief the undeclared defines are added on first use
+ */
+TEST(TestMaterialDefines, UndeclaredDefines)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  const auto size = defines.boolDef.size();
+  EXPECT_FALSE(defines["LIGHT0"]);
+  EXPECT_FALSE(defines.boolDef.contains("LIGHT0"));
+
+  defines.boolDef["LIGHT0"] = true;
+  EXPECT_TRUE(defines.boolDef.contains("LIGHT0"));
+  EXPECT_TRUE(defines["LIGHT0"]);
+  EXPECT_EQ(defines.boolDef.size(), size + 1);
+  EXPECT_NE(defines.toString().find("#define LIGHT0\n"), std::string::npos);
+
+  EXPECT_EQ(defines.boolDef.erase("LIGHT0"), 1u);
+  EXPECT_FALSE(defines.boolDef.contains("LIGHT0"));
+  EXPECT_EQ(defines.boolDef.size(), size);
+}
+
+/**
+ * @brief the hash follows the values of the defines
+ */
+TEST(TestMaterialDefines, Hash)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines, other;
+  EXPECT_EQ(defines.hash(), other.hash());
+  EXPECT_EQ(defines, other);
+
+  // Boolean defines
+  const auto hash            = defines.hash();
+  defines.boolDef["DIFFUSE"] = true;
+  EXPECT_NE(defines.hash(), hash);
+  EXPECT_NE(defines, other);
+  defines.boolDef["DIFFUSE"] = false;
+  EXPECT_EQ(defines.hash(), hash);
+
+  // Numeric defines
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  EXPECT_NE(defines.hash(), hash);
+  other.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  EXPECT_EQ(defines.hash(), other.hash());
+  EXPECT_EQ(defines.toString(), other.toString());
+
+  // Image processing defines
+  defines.TONEMAPPING = true;
+  EXPECT_NE(defines.hash(), other.hash());
+
+  // The order of the changes does not matter
+  MaterialDefines first, second;
+  first.boolDef["A"]  = true;
+  first.boolDef["B"]  = true;
+  second.boolDef["B"] = true;
+  second.boolDef["A"] = true;
+  EXPECT_EQ(first.hash(), second.hash());
+  EXPECT_EQ(first.toString().size(), second.toString().size());
+}
+
+/**
+ * @brief the define indices address the same defines as their names
+ */
+TEST(TestMaterialDefines, DefineIndices)
+{
+  using namespace BABYLON;
+
+  StandardMaterialDefines defines;
+  const auto& schema = defines.boolDef.schema();
+  EXPECT_EQ(schema.findBoolIndex("DIFFUSE"),
+            static_cast<int>(StandardMaterialDefines::Index::DIFFUSE));
+  EXPECT_EQ(schema.findIntIndex("NUM_MORPH_INFLUENCERS"),
+            static_cast<int>(StandardMaterialDefines::Index::NUM_MORPH_INFLUENCERS));
+
+  defines.boolDef[StandardMaterialDefines::Index::DIFFUSE] = true;
+  EXPECT_TRUE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines[StandardMaterialDefines::Index::DIFFUSE]);
+  defines.intDef[StandardMaterialDefines::Index::NUM_MORPH_INFLUENCERS] = 2;
+  EXPECT_EQ(defines.intDef.at("NUM_MORPH_INFLUENCERS"), 2);
+
+  StandardMaterialDefines other;
+  other.boolDef["DIFFUSE"]              = true;
+  other.intDef["NUM_MORPH_INFLUENCERS"] = 2;
+  EXPECT_EQ(defines.hash(), other.hash());
+  EXPECT_EQ(defines, other);
+
+  PBRMaterialDefines pbrDefines;
+  EXPECT_EQ(pbrDefines.boolDef.schema().findBoolIndex("ALBEDO"),
+            static_cast<int>(PBRMaterialDefines::Index::ALBEDO));
+}
+
+/**
+ * @brief the defines registered concurrently get distinct indices and stay readable by index
+ */
+TEST(TestMaterialDefines, ConcurrentRegistration)
+{
+  using namespace BABYLON;
+
+  MaterialDefinesSchema schema({{"DIFFUSE", false}});
+  const size_t threadCount = 4, defineCount = 200;
+  std::vector<std::vector<size_t>> indices(threadCount);
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < threadCount; ++thread) {
+    threads.emplace_back([&schema, &indices, thread] {
+      for (size_t define = 0; define < defineCount; ++define) {
+        // Every thread registers the shared defines and its own ones
+        schema.boolIndex("SHARED" + std::to_string(define));
+        const auto name  = "THREAD" + std::to_string(thread) + "_" + std::to_string(define);
+        const auto index = schema.boolIndex(name);
+        EXPECT_EQ(schema.boolDefines[index].name, name);
+        indices[thread].emplace_back(index);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(schema.boolDefines.size(), 1 + (threadCount + 1) * defineCount);
+  for (size_t thread = 0; thread < threadCount; ++thread) {
+    for (size_t define = 0; define < defineCount; ++define) {
+      const auto name = "THREAD" + std::to_string(thread) + "_" + std::to_string(define);
+      EXPECT_EQ(schema.findBoolIndex(name), static_cast<int>(indices[thread][define]));
+    }
+  }
+}
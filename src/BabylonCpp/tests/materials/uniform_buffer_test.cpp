@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+#include <babylon/materials/uniform_buffer.h>
+#include <babylon/maths/matrix.h>
+
+/**
+ * @brief Test Suite for UniformBuffer.
+ */
+
+/**
+ * @brief the uniforms get a handle when they are added, which is resolved again by name
+ */
+TEST(TestUniformBuffer, UniformHandles)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  UniformBuffer ubo(engine.get());
+
+  const auto diffuseInfos  = ubo.addUniform("vDiffuseInfos", 2);
+  const auto diffuseMatrix = ubo.addUniform("diffuseMatrix", 16);
+  ubo.addMatrix("reflectionMatrix", Matrix::Identity());
+  ubo.addFloat3("vReflectionSize", 1.f, 2.f, 3.f);
+
+  EXPECT_EQ(diffuseInfos, 0);
+  EXPECT_EQ(diffuseMatrix, 1);
+  EXPECT_EQ(ubo.getUniformHandle("vDiffuseInfos"), diffuseInfos);
+  EXPECT_EQ(ubo.getUniformHandle("diffuseMatrix"), diffuseMatrix);
+  EXPECT_EQ(ubo.getUniformHandle("reflectionMatrix"), 2);
+  EXPECT_EQ(ubo.getUniformHandle("vReflectionSize"), 3);
+  EXPECT_EQ(ubo.getUniformHandle("vEmissiveInfos"), -1);
+
+  // Adding an uniform again keeps its handle
+  EXPECT_EQ(ubo.addUniform("vDiffuseInfos", 2), diffuseInfos);
+  EXPECT_EQ(ubo.addUniform("vEmissiveInfos", 2), 4);
+}
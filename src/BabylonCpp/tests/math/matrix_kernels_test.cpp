@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <babylon/maths/matrix_kernels.h>
+
+namespace TestMatrixKernels {
+
+std::vector<float> RandomFloats(size_t count, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+  std::vector<float> values(count);
+  for (auto& value : values) {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+bool BitwiseEqual(const float* a, const float* b, size_t count)
+{
+  return std::memcmp(a, b, count * sizeof(float)) == 0;
+}
+
+} // end of namespace TestMatrixKernels
+
+TEST(TestMatrixKernels, BitIdenticalToScalar)
+{
+  using namespace BABYLON;
+  using namespace TestMatrixKernels;
+
+  const size_t count    = 67;
+  const auto matrices   = RandomFloats(count * 16, 1);
+  const auto others     = RandomFloats(count * 16, 2);
+  const auto positions  = RandomFloats(count * 3, 3);
+  const auto components = RandomFloats(count * 10, 4);
+  const auto& scalar    = MatrixKernels::Scalar();
+
+  for (const auto kernels : MatrixKernels::Supported()) {
+    SCOPED_TRACE(kernels->name);
+    std::vector<float> expected(count * 16), actual(count * 16);
+
+    for (size_t i = 0; i < count; ++i) {
+      scalar.multiply(&matrices[i * 16], &others[i * 16], &expected[i * 16]);
+      kernels->multiply(&matrices[i * 16], &others[i * 16], &actual[i * 16]);
+    }
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+
+    scalar.multiplyArray(matrices.data(), others.data(), expected.data(), count);
+    kernels->multiplyArray(matrices.data(), others.data(), actual.data(), count);
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+
+    scalar.multiplyPairs(matrices.data(), others.data(), expected.data(), count);
+    kernels->multiplyPairs(matrices.data(), others.data(), actual.data(), count);
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(scalar.invert(&matrices[i * 16], &expected[i * 16]),
+                kernels->invert(&matrices[i * 16], &actual[i * 16]));
+    }
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+
+    for (size_t i = 0; i < count; ++i) {
+      const auto c = &components[i * 10];
+      scalar.compose(c, c + 3, c + 7, &expected[i * 16]);
+      kernels->compose(c, c + 3, c + 7, &actual[i * 16]);
+    }
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+
+    std::vector<float> expectedPositions(count * 3), actualPositions(count * 3);
+    scalar.transformCoordinates(positions.data(), matrices.data(), expectedPositions.data(),
+                                count);
+    kernels->transformCoordinates(positions.data(), matrices.data(), actualPositions.data(), count);
+    EXPECT_TRUE(
+      BitwiseEqual(expectedPositions.data(), actualPositions.data(), expectedPositions.size()));
+  }
+}
+
+TEST(TestMatrixKernels, InPlace)
+{
+  using namespace BABYLON;
+  using namespace TestMatrixKernels;
+
+  const auto matrix    = RandomFloats(16, 5);
+  const auto positions = RandomFloats(9, 6);
+
+  for (const auto kernels : MatrixKernels::Supported()) {
+    SCOPED_TRACE(kernels->name);
+    std::vector<float> expected(16), actual(matrix);
+
+    kernels->multiply(matrix.data(), matrix.data(), expected.data());
+    kernels->multiply(actual.data(), actual.data(), actual.data());
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), 16));
+
+    actual = matrix;
+    kernels->invert(matrix.data(), expected.data());
+    kernels->invert(actual.data(), actual.data());
+    EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), 16));
+
+    std::vector<float> expectedPositions(9), actualPositions(positions);
+    kernels->transformCoordinates(positions.data(), matrix.data(), expectedPositions.data(), 3);
+    kernels->transformCoordinates(actualPositions.data(), matrix.data(), actualPositions.data(), 3);
+    EXPECT_TRUE(BitwiseEqual(expectedPositions.data(), actualPositions.data(), 9));
+  }
+
+  // Singular matrices are reported and leave the result untouched
+  std::vector<float> singular(16, 1.f), result(16, 7.f);
+  EXPECT_FALSE(MatrixKernels::Get().invert(singular.data(), result.data()));
+  EXPECT_EQ(result, std::vector<float>(16, 7.f));
+}
+
+TEST(TestMatrixKernels, Hierarchy)
+{
+  using namespace BABYLON;
+  using namespace TestMatrixKernels;
+
+  // Two roots, each bone parented to a previous one
+  const size_t count = 41;
+  const auto locals  = RandomFloats(count * 16, 7);
+  const auto root    = RandomFloats(16, 8);
+  const auto& scalar = MatrixKernels::Scalar();
+  std::vector<int32_t> parents(count);
+  for (size_t i = 0; i < count; ++i) {
+    parents[i] = (i == 0 || i == 20) ? -1 : static_cast<int32_t>((i * 7) % i);
+  }
+
+  for (const auto rootMatrix : {root.data(), static_cast<const float*>(nullptr)}) {
+    std::vector<float> expected(count * 16);
+    for (size_t i = 0; i < count; ++i) {
+      if (parents[i] >= 0) {
+        scalar.multiply(&locals[i * 16], &expected[parents[i] * 16], &expected[i * 16]);
+      }
+      else if (rootMatrix) {
+        scalar.multiply(&locals[i * 16], rootMatrix, &expected[i * 16]);
+      }
+      else {
+        std::copy(&locals[i * 16], &locals[i * 16] + 16, &expected[i * 16]);
+      }
+    }
+
+    for (const auto kernels : MatrixKernels::Supported()) {
+      SCOPED_TRACE(kernels->name);
+      std::vector<float> actual(count * 16);
+      kernels->multiplyHierarchy(locals.data(), parents.data(), rootMatrix, actual.data(), count);
+      EXPECT_TRUE(BitwiseEqual(expected.data(), actual.data(), expected.size()));
+    }
+  }
+}
@@ -1,6 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include "../test_utils.h"
 
 #include <babylon/babylon_stl_util.h>
@@ -29,3 +31,28 @@ TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
   auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
   EXPECT_THAT(result, ::testing::ContainerEq(data));
 }
+
+TEST(TestGeometry, TestGetVerticesData_Vec3NormalizedShortPosition)
+{
+  using namespace BABYLON;
+  // vec3 normalized short positions (quantized), padded to a 8 bytes stride
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  const std::vector<int16_t> shorts{0, 32767, -32767, 0, 16384, 0, -16384, 0, 32767, 0, 0, 0};
+  Float32Array data(shorts.size() * sizeof(int16_t) / sizeof(float));
+  std::memcpy(data.data(), shorts.data(), shorts.size() * sizeof(int16_t));
+  auto buffer       = std::make_shared<Buffer>(subject.get(), data, false);
+  auto vertexBuffer = std::make_shared<VertexBuffer>(
+    subject.get(), buffer, VertexBuffer::PositionKind, false, std::nullopt, 8, std::nullopt, 0, 3,
+    VertexBuffer::SHORT, true, true);
+
+  auto geometry = Geometry::New("geometry1", scene.get());
+  geometry->setVerticesBuffer(vertexBuffer, 3);
+
+  auto result = geometry->getVerticesData(VertexBuffer::PositionKind);
+  EXPECT_THAT(result, ::testing::Pointwise(::testing::FloatNear(1e-4f),
+                                           Float32Array{0.f, 1.f, -1.f, 0.5f, 0.f, -0.5f, 1.f, 0.f,
+                                                        0.f}));
+  EXPECT_NEAR(geometry->extend().min.z, -1.f, 1e-4f);
+  EXPECT_NEAR(geometry->extend().max.x, 1.f, 1e-4f);
+}
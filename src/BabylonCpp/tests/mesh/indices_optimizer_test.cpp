@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <babylon/meshes/indices_optimizer.h>
+
+namespace {
+
+/**
+ * @brief Returns the triangles of the indices, each one rotated so that its smallest vertex is
+ * first (the winding is kept), in increasing order.
+ */
+std::vector<std::array<uint32_t, 3>> sortedTriangles(const BABYLON::IndicesArray& indices)
+{
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    std::array<uint32_t, 3> triangle{indices[i], indices[i + 1], indices[i + 2]};
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()),
+                triangle.end());
+    triangles.emplace_back(triangle);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief The triangles of a shuffled grid are kept, and the cache is used better.
+ */
+TEST(TestIndicesOptimizer, OptimizeVertexCache)
+{
+  using namespace BABYLON;
+
+  // Grid of 100x100 quads
+  const size_t size = 101;
+  Float32Array positions;
+  IndicesArray indices;
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x), 0.f, static_cast<float>(y)});
+      if (x + 1 < size && y + 1 < size) {
+        const auto v = static_cast<uint32_t>(y * size + x);
+        const auto w = static_cast<uint32_t>(size);
+        indices.insert(indices.end(), {v, v + w, v + 1, v + 1, v + w, v + w + 1});
+      }
+    }
+  }
+
+  // Shuffled triangles
+  std::vector<size_t> order(indices.size() / 3);
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(7));
+  IndicesArray shuffled;
+  for (const auto triangle : order) {
+    shuffled.insert(shuffled.end(), indices.begin() + static_cast<std::ptrdiff_t>(triangle * 3),
+                    indices.begin() + static_cast<std::ptrdiff_t>(triangle * 3 + 3));
+  }
+  const auto shuffledRatio = IndicesOptimizer::AverageCacheMissRatio(shuffled);
+  EXPECT_GT(shuffledRatio, 2.f);
+
+  auto optimized = shuffled;
+  IndicesOptimizer::OptimizeVertexCache(optimized, 0, optimized.size());
+  EXPECT_EQ(sortedTriangles(optimized), sortedTriangles(indices));
+  EXPECT_LT(IndicesOptimizer::AverageCacheMissRatio(optimized), 0.8f);
+
+  // The overdraw optimization keeps the triangles, and most of the cache efficiency
+  const auto optimizedRatio = IndicesOptimizer::AverageCacheMissRatio(optimized);
+  IndicesOptimizer::OptimizeOverdraw(optimized, 0, optimized.size(), positions);
+  EXPECT_EQ(sortedTriangles(optimized), sortedTriangles(indices));
+  EXPECT_LT(IndicesOptimizer::AverageCacheMissRatio(optimized), optimizedRatio * 1.1f);
+
+  // Ranges are optimized independently
+  auto ranges = shuffled;
+  IndicesOptimizer::OptimizeVertexCache(ranges, 3000, 6000);
+  EXPECT_TRUE(std::equal(shuffled.begin(), shuffled.begin() + 3000, ranges.begin()));
+  EXPECT_TRUE(std::equal(shuffled.begin() + 9000, shuffled.end(), ranges.begin() + 9000));
+}
+
+/**
+ * @brief The vertices are sorted by first use.
+ */
+TEST(TestIndicesOptimizer, OptimizeVertexFetch)
+{
+  using namespace BABYLON;
+
+  const IndicesArray indices{9, 4, 5, 5, 4, 7, 0, 1, 2};
+  EXPECT_EQ(IndicesOptimizer::OptimizeVertexFetch(indices, 0, 6, 4, 6),
+            Uint32Array({9, 4, 5, 7, 6, 8}));
+  EXPECT_EQ(IndicesOptimizer::OptimizeVertexFetch(indices, 6, 3, 0, 4),
+            Uint32Array({0, 1, 2, 3}));
+}
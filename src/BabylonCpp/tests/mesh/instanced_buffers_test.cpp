@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/bakedvertexanimation/baked_vertex_animation_manager.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+
+namespace {
+
+using namespace BABYLON;
+
+/**
+ * @brief Null engine keeping the content of the dynamic vertex buffers.
+ */
+class RecordingEngine : public NullEngine {
+
+public:
+  static std::unique_ptr<RecordingEngine> New()
+  {
+    NullEngineOptions options;
+    options.renderHeight          = 256;
+    options.renderWidth           = 256;
+    options.textureSize           = 256;
+    options.deterministicLockstep = false;
+    options.lockstepMaxSteps      = 1;
+    return std::unique_ptr<RecordingEngine>(new RecordingEngine(options));
+  }
+
+  WebGLDataBufferPtr createDynamicVertexBuffer(const Float32Array& vertices) override
+  {
+    lastCreatedBuffer                 = NullEngine::createDynamicVertexBuffer(vertices);
+    contents[lastCreatedBuffer.get()] = vertices;
+    return lastCreatedBuffer;
+  }
+
+  void updateDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer, const Float32Array& data,
+                                 int byteOffset, int byteLength) override
+  {
+    const auto offset = byteOffset < 0 ? 0 : static_cast<size_t>(byteOffset) / sizeof(float);
+    const auto length
+      = byteLength < 0 ? data.size() : static_cast<size_t>(byteLength) / sizeof(float);
+    write(vertexBuffer, data.data(), offset, length);
+  }
+
+  void updateDynamicVertexBufferRange(const WebGLDataBufferPtr& vertexBuffer, const float* data,
+                                      size_t byteOffset, size_t byteLength,
+                                      bool /*discard*/) override
+  {
+    write(vertexBuffer, data, byteOffset / sizeof(float), byteLength / sizeof(float));
+  }
+
+  /**
+   * @brief Returns floats of the content of a dynamic vertex buffer.
+   */
+  Float32Array content(const WebGLDataBufferPtr& vertexBuffer, size_t offset, size_t length)
+  {
+    const auto& content = contents[vertexBuffer.get()];
+    return Float32Array(content.begin() + static_cast<std::ptrdiff_t>(offset),
+                        content.begin() + static_cast<std::ptrdiff_t>(offset + length));
+  }
+
+public:
+  std::unordered_map<const WebGLDataBuffer*, Float32Array> contents;
+  WebGLDataBufferPtr lastCreatedBuffer;
+
+protected:
+  RecordingEngine(const NullEngineOptions& options) : NullEngine{options}
+  {
+  }
+
+private:
+  void write(const WebGLDataBufferPtr& vertexBuffer, const float* data, size_t offset,
+             size_t length)
+  {
+    auto& content = contents[vertexBuffer.get()];
+    if (content.size() < offset + length) {
+      content.resize(offset + length);
+    }
+    std::copy_n(data, length, content.begin() + static_cast<std::ptrdiff_t>(offset));
+  }
+
+}; // end of class RecordingEngine
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for the instanced buffers of the meshes.
+ */
+
+/**
+ * @brief the values of the mesh (when rendered) and of its visible instances are packed in the
+ * instanced buffers, which grow with the number of instances
+ */
+TEST(TestInstancedBuffers, ProcessInstancedBuffers)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box = BoxBuilder::CreateBox("box", options, scene.get());
+  engine->lastCreatedBuffer = nullptr;
+  box->registerInstancedBuffer("color", 4);
+  box->instancedBuffers["color"] = {1.f, 0.f, 0.f, 1.f};
+  const auto buffer              = engine->lastCreatedBuffer;
+  ASSERT_NE(buffer, nullptr);
+
+  std::vector<InstancedMeshPtr> instances;
+  std::vector<InstancedMesh*> visibleInstances;
+  for (size_t i = 0; i < 40; ++i) {
+    auto instance = box->createInstance("instance" + std::to_string(i));
+    EXPECT_EQ(instance->instancedBuffers["color"], (Float32Array{1.f, 0.f, 0.f, 1.f}));
+    instance->instancedBuffers["color"] = {0.f, static_cast<float>(i), 0.f, 1.f};
+    instances.emplace_back(instance);
+    visibleInstances.emplace_back(instance.get());
+  }
+
+  // The mesh itself and two instances, in the initial 32 slots
+  box->_processInstancedBuffers({visibleInstances[0], visibleInstances[5]}, true);
+  EXPECT_EQ(engine->lastCreatedBuffer, buffer);
+  EXPECT_EQ(engine->contents[buffer.get()].size(), 4ull * 32);
+  EXPECT_EQ(engine->content(buffer, 0, 12),
+            (Float32Array{1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 5.f, 0.f, 1.f}));
+
+  // Only the instances, in the same buffer
+  box->_processInstancedBuffers({visibleInstances[7]}, false);
+  EXPECT_EQ(engine->lastCreatedBuffer, buffer);
+  EXPECT_EQ(engine->content(buffer, 0, 4), (Float32Array{0.f, 7.f, 0.f, 1.f}));
+
+  // Growth: the mesh and 40 instances do not fit in the initial 32 slots
+  box->_processInstancedBuffers(visibleInstances, true);
+  const auto grownBuffer = engine->lastCreatedBuffer;
+  ASSERT_NE(grownBuffer, buffer);
+  ASSERT_EQ(engine->contents[grownBuffer.get()].size(), 4ull * 64);
+  EXPECT_EQ(engine->content(grownBuffer, 0, 4), (Float32Array{1.f, 0.f, 0.f, 1.f}));
+  for (size_t i = 0; i < visibleInstances.size(); ++i) {
+    EXPECT_EQ(engine->content(grownBuffer, (i + 1) * 4, 4),
+              (Float32Array{0.f, static_cast<float>(i), 0.f, 1.f}))
+      << "instance " << i;
+  }
+}
+
+/**
+ * @brief the thin instance attributes are registered with a buffer of their initial size, which
+ * then receives the values of the thin instances
+ */
+TEST(TestInstancedBuffers, ThinInstanceRegisterAttribute)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box                   = BoxBuilder::CreateBox("box", options, scene.get());
+  box->doNotSyncBoundingInfo = true;
+
+  Float32Array matrices(40 * 16);
+  for (size_t i = 0; i < 40; ++i) {
+    Matrix::IdentityReadOnly().copyToArray(matrices, static_cast<unsigned>(i) * 16);
+  }
+  box->thinInstanceSetBuffer("matrix", matrices, 16, false);
+
+  box->thinInstanceRegisterAttribute("color", 4);
+  auto vertexBuffer = box->getVertexBuffer("color");
+  ASSERT_NE(vertexBuffer, nullptr);
+  const auto buffer = vertexBuffer->getBuffer();
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(engine->contents[buffer.get()], Float32Array(4 * 40, 0.f));
+
+  EXPECT_TRUE(box->thinInstanceSetAttributeAt("color", 39, {1.f, 2.f, 3.f, 4.f}));
+  EXPECT_EQ(engine->content(buffer, 39 * 4, 4), (Float32Array{1.f, 2.f, 3.f, 4.f}));
+  EXPECT_FALSE(box->thinInstanceSetAttributeAt("color", 40, {1.f, 2.f, 3.f, 4.f}));
+}
+
+/**
+ * @brief the animation settings of the baked vertex animations are set on the manager for the
+ * mesh, and in the instanced attribute for the instances and the thin instances
+ */
+TEST(TestInstancedBuffers, BakedVertexAnimationSettings)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box                   = BoxBuilder::CreateBox("box", options, scene.get());
+  box->doNotSyncBoundingInfo = true;
+
+  auto manager = BakedVertexAnimationManager::New(scene.get());
+  manager->setAnimationParameters(10.f, 20.f, 2.f, 60.f);
+  EXPECT_EQ(manager->animationParameters, Vector4(10.f, 20.f, 2.f, 60.f));
+  EXPECT_EQ(manager->clone()->animationParameters, manager->animationParameters);
+  box->bakedVertexAnimationManager = manager;
+
+  const std::string kind = BakedVertexAnimationManager::AnimationSettingsInstancedKind;
+
+  // Instances
+  engine->lastCreatedBuffer = nullptr;
+  BakedVertexAnimationManager::RegisterInstancedAttributes(*box);
+  const auto instancedBuffer = engine->lastCreatedBuffer;
+  ASSERT_NE(instancedBuffer, nullptr);
+  auto instance = box->createInstance("instance");
+  BakedVertexAnimationManager::SetInstanceAnimationParameters(*instance, 30.f, 40.f, 1.f, 24.f);
+  box->_processInstancedBuffers({instance.get()}, false);
+  EXPECT_EQ(engine->content(instancedBuffer, 0, 4),
+            (Float32Array{30.f, 40.f, 1.f, 24.f}));
+
+  // Thin instances
+  Float32Array matrices(2 * 16);
+  Matrix::IdentityReadOnly().copyToArray(matrices, 0);
+  Matrix::IdentityReadOnly().copyToArray(matrices, 16);
+  box->thinInstanceSetBuffer("matrix", matrices, 16, false);
+  BakedVertexAnimationManager::RegisterInstancedAttributes(*box);
+  EXPECT_TRUE(BakedVertexAnimationManager::SetThinInstanceAnimationParameters(*box, 1, 50.f, 60.f,
+                                                                              0.f, 30.f));
+  const auto buffer = box->getVertexBuffer(kind)->getBuffer();
+  EXPECT_EQ(engine->content(buffer, 4, 4), (Float32Array{50.f, 60.f, 0.f, 30.f}));
+}
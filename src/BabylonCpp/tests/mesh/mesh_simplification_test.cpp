@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+
+/**
+ * @brief The simplified meshes are added as LOD levels once the workers are done.
+ */
+TEST(TestMeshSimplification, Simplify)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions sphereOptions;
+  sphereOptions.segments  = 32;
+  auto sphere             = MeshBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+  const auto totalIndices = sphere->getTotalIndices();
+
+  bool done = false;
+  sphere->simplify({SimplificationSettings(0.8f, 10.f, true), //
+                    SimplificationSettings(0.4f, 50.f, true)},
+                   true, SimplificationType::QUADRATIC, [&done]() { done = true; });
+
+  // Done by the scene component before each camera update
+  auto& simplificationQueue = scene->simplificationQueue();
+  simplificationQueue->executeNext();
+  for (size_t i = 0; i < 10000 && !done; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    simplificationQueue->publishSimplifiedMeshes();
+  }
+  ASSERT_TRUE(done);
+  EXPECT_FALSE(simplificationQueue->running);
+
+  // Sorted by decreasing distance
+  const auto& lodLevels = sphere->getLODLevels();
+  ASSERT_EQ(lodLevels.size(), 2u);
+  EXPECT_FLOAT_EQ(lodLevels[0]->distance, 50.f);
+  EXPECT_FLOAT_EQ(lodLevels[1]->distance, 10.f);
+  EXPECT_LT(lodLevels[0]->mesh->getTotalIndices(), lodLevels[1]->mesh->getTotalIndices());
+  EXPECT_LT(lodLevels[1]->mesh->getTotalIndices(), totalIndices);
+  EXPECT_TRUE(lodLevels[0]->mesh->isVisible);
+}
+
+/**
+ * @brief The simplified meshes of a mesh disposed while it is simplified are dropped.
+ */
+TEST(TestMeshSimplification, DisposedMesh)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions sphereOptions;
+  sphereOptions.segments = 32;
+  auto sphere            = MeshBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+  std::weak_ptr<Mesh> weakSphere = sphere;
+
+  bool done = false;
+  sphere->simplify({SimplificationSettings(0.5f, 10.f, true)}, true, SimplificationType::QUADRATIC,
+                   [&done]() { done = true; });
+  auto& simplificationQueue = scene->simplificationQueue();
+  simplificationQueue->executeNext();
+  EXPECT_TRUE(simplificationQueue->running);
+
+  const auto meshCount = scene->meshes.size();
+  sphere->dispose();
+  sphere = nullptr;
+  for (size_t i = 0; i < 10000 && simplificationQueue->running; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    simplificationQueue->publishSimplifiedMeshes();
+  }
+  EXPECT_FALSE(simplificationQueue->running);
+  EXPECT_FALSE(done);
+  EXPECT_TRUE(weakSphere.expired());
+  EXPECT_EQ(scene->meshes.size(), meshCount - 1);
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/webgl/webgl_data_buffer.h>
+
+namespace {
+
+using namespace BABYLON;
+
+struct BufferUpload {
+  size_t byteOffset;
+  size_t byteLength;
+  bool discard;
+  std::vector<float> data;
+};
+
+/**
+ * @brief Null engine recording the dynamic vertex buffer resizes and range updates.
+ */
+class RecordingEngine : public NullEngine {
+
+public:
+  static std::unique_ptr<RecordingEngine> New()
+  {
+    NullEngineOptions options;
+    options.renderHeight          = 256;
+    options.renderWidth           = 256;
+    options.textureSize           = 256;
+    options.deterministicLockstep = false;
+    options.lockstepMaxSteps      = 1;
+    return std::unique_ptr<RecordingEngine>(new RecordingEngine(options));
+  }
+
+  void resizeDynamicVertexBuffer(const WebGLDataBufferPtr& vertexBuffer,
+                                 size_t byteLength) override
+  {
+    NullEngine::resizeDynamicVertexBuffer(vertexBuffer, byteLength);
+    resizes.emplace_back(byteLength);
+  }
+
+  void updateDynamicVertexBufferRange(const WebGLDataBufferPtr& /*vertexBuffer*/, const float* data,
+                                      size_t byteOffset, size_t byteLength, bool discard) override
+  {
+    uploads.push_back({byteOffset, byteLength, discard,
+                       std::vector<float>(data, data + byteLength / sizeof(float))});
+  }
+
+  void clear()
+  {
+    resizes.clear();
+    uploads.clear();
+  }
+
+public:
+  std::vector<size_t> resizes;
+  std::vector<BufferUpload> uploads;
+
+protected:
+  RecordingEngine(const NullEngineOptions& options) : NullEngine{options}
+  {
+  }
+
+}; // end of class RecordingEngine
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for the thin instance buffer uploads.
+ */
+
+/**
+ * @brief the dirty range is the smallest range covering all the modified floats
+ */
+TEST(TestThinInstanceBuffer, DirtyRangeMerging)
+{
+  using namespace BABYLON;
+
+  _ThinInstanceDirtyRange dirtyRange;
+  EXPECT_GE(dirtyRange.start, dirtyRange.end);
+
+  dirtyRange.add(32, 16);
+  EXPECT_EQ(dirtyRange.start, 32ull);
+  EXPECT_EQ(dirtyRange.end, 48ull);
+
+  // Overlapping and disjoint ranges, before and after
+  dirtyRange.add(40, 4);
+  EXPECT_EQ(dirtyRange.start, 32ull);
+  EXPECT_EQ(dirtyRange.end, 48ull);
+  dirtyRange.add(0, 16);
+  EXPECT_EQ(dirtyRange.start, 0ull);
+  EXPECT_EQ(dirtyRange.end, 48ull);
+  dirtyRange.add(100, 4);
+  EXPECT_EQ(dirtyRange.start, 0ull);
+  EXPECT_EQ(dirtyRange.end, 104ull);
+}
+
+/**
+ * @brief reserve only grows the data store of updatable buffers, in place, and updateRange
+ * forwards the range to the engine
+ */
+TEST(TestThinInstanceBuffer, BufferReserveAndUpdateRange)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  Buffer buffer(engine.get(), Float32Array(16, 1.f), true, 16, false, true);
+  const auto dataBuffer = buffer.getBuffer();
+  ASSERT_NE(dataBuffer, nullptr);
+  EXPECT_EQ(dataBuffer->capacity, 64ull);
+
+  EXPECT_FALSE(buffer.reserve(64));
+  EXPECT_TRUE(buffer.reserve(256));
+  EXPECT_FALSE(buffer.reserve(128));
+  EXPECT_EQ(engine->resizes, std::vector<size_t>{256});
+  EXPECT_EQ(buffer.getBuffer(), dataBuffer);
+  EXPECT_EQ(dataBuffer->capacity, 256ull);
+
+  const std::vector<float> data{1.f, 2.f, 3.f, 4.f};
+  EXPECT_EQ(buffer.updateRange(data.data(), 32, 16, true), dataBuffer);
+  ASSERT_EQ(engine->uploads.size(), 1ull);
+  EXPECT_EQ(engine->uploads[0].byteOffset, 32ull);
+  EXPECT_EQ(engine->uploads[0].byteLength, 16ull);
+  EXPECT_TRUE(engine->uploads[0].discard);
+  EXPECT_EQ(engine->uploads[0].data, data);
+
+  // Static buffers are never resized nor updated
+  engine->clear();
+  Buffer staticBuffer(engine.get(), Float32Array(16, 1.f), false, 16, false, true);
+  EXPECT_FALSE(staticBuffer.reserve(256));
+  staticBuffer.updateRange(data.data(), 0, 16);
+  EXPECT_TRUE(engine->resizes.empty());
+  EXPECT_TRUE(engine->uploads.empty());
+}
+
+/**
+ * @brief only the modified range of the thin instance buffers is uploaded, the whole used part of
+ * the buffer (orphaning the data store) when nothing was tracked or when the buffer grows
+ */
+TEST(TestThinInstanceBuffer, UploadDirtyRange)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box                   = BoxBuilder::CreateBox("box", options, scene.get());
+  box->doNotSyncBoundingInfo = true;
+
+  Float32Array matrices(4 * 16);
+  for (size_t i = 0; i < 4; ++i) {
+    Matrix::IdentityReadOnly().copyToArray(matrices, static_cast<unsigned>(i) * 16);
+  }
+  box->thinInstanceSetBuffer("matrix", matrices, 16, false);
+  engine->clear();
+
+  // Modified matrices
+  auto matrix = Matrix::Translation(1.f, 2.f, 3.f);
+  box->thinInstanceSetMatrixAt(2, matrix, false);
+  box->thinInstanceSetMatrixAt(1, matrix, true);
+  ASSERT_EQ(engine->uploads.size(), 1ull);
+  EXPECT_EQ(engine->uploads[0].byteOffset, 16 * sizeof(float));
+  EXPECT_EQ(engine->uploads[0].byteLength, 2 * 16 * sizeof(float));
+  EXPECT_FALSE(engine->uploads[0].discard);
+  EXPECT_EQ(engine->uploads[0].data[12], 1.f);
+
+  // Nothing tracked: the used part of the buffer
+  engine->clear();
+  box->thinInstanceBufferUpdated("matrix");
+  ASSERT_EQ(engine->uploads.size(), 1ull);
+  EXPECT_EQ(engine->uploads[0].byteOffset, 0ull);
+  EXPECT_EQ(engine->uploads[0].byteLength, 4 * 16 * sizeof(float));
+  EXPECT_TRUE(engine->uploads[0].discard);
+
+  // Growth: the data store is resized in place and entirely uploaded, then the new matrix
+  engine->clear();
+  const auto matrixBuffer = box->getVertexBuffer("world0")->getBuffer();
+  box->thinInstanceAdd(matrix, true);
+  EXPECT_EQ(box->getVertexBuffer("world0")->getBuffer(), matrixBuffer);
+  EXPECT_EQ(engine->resizes, std::vector<size_t>{8 * 16 * sizeof(float)});
+  ASSERT_EQ(engine->uploads.size(), 2ull);
+  EXPECT_EQ(engine->uploads[0].byteOffset, 0ull);
+  EXPECT_EQ(engine->uploads[0].byteLength, 8 * 16 * sizeof(float));
+  EXPECT_TRUE(engine->uploads[0].discard);
+  EXPECT_EQ(engine->uploads[1].byteOffset, 4 * 16 * sizeof(float));
+  EXPECT_EQ(engine->uploads[1].byteLength, 16 * sizeof(float));
+
+  // Custom attributes
+  box->thinInstanceRegisterAttribute("color", 4);
+  engine->clear();
+  box->thinInstanceSetAttributeAt("color", 3, {1.f, 0.f, 0.f, 1.f}, true);
+  ASSERT_EQ(engine->uploads.size(), 1ull);
+  EXPECT_EQ(engine->uploads[0].byteOffset, 3 * 4 * sizeof(float));
+  EXPECT_EQ(engine->uploads[0].byteLength, 4 * sizeof(float));
+  EXPECT_EQ(engine->uploads[0].data, (std::vector<float>{1.f, 0.f, 0.f, 1.f}));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/meshes/vertex_welder.h>
+
+/**
+ * @brief Welds the vertices within epsilon.
+ */
+TEST(TestVertexWelder, Weld)
+{
+  using namespace BABYLON;
+
+  const Float32Array positions{
+    0.f,    0.f, 0.f, //
+    1.f,    0.f, 0.f, //
+    0.f,    0.f, 0.f, //
+    1e-7f,  0.f, 0.f, //
+    -1e-7f, 0.f, 0.f, //
+    1.f,    1.f, 0.f, //
+    1.f,    0.f, 0.f, //
+  };
+  const Uint32Array expected{0, 1, 0, 0, 0, 5, 1};
+  EXPECT_EQ(VertexWelder::Weld(positions), expected);
+  EXPECT_EQ(VertexWelder::UniqueVertices(expected), Uint32Array({0, 1, 5}));
+
+  // Exact comparison
+  VertexWelderOptions options;
+  options.epsilon = 0.f;
+  EXPECT_EQ(VertexWelder::Weld(positions, options), Uint32Array({0, 1, 0, 3, 4, 5, 1}));
+
+  // Attributes comparison
+  const Float32Array uvs{0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+  options.epsilon = 1e-6f;
+  options.uvs     = &uvs;
+  EXPECT_EQ(VertexWelder::Weld(positions, options), Uint32Array({0, 1, 2, 0, 0, 5, 1}));
+}
+
+/**
+ * @brief The result does not depend on the threads.
+ */
+TEST(TestVertexWelder, Parallel)
+{
+  using namespace BABYLON;
+
+  // Grid of 100000 vertices, each one duplicated with a small offset
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> offset(-1e-5f, 1e-5f);
+  Float32Array positions;
+  for (size_t i = 0; i < 100000; ++i) {
+    const auto x = static_cast<float>(i % 100), y = static_cast<float>((i / 100) % 100),
+               z = static_cast<float>(i / 10000);
+    positions.insert(positions.end(), {x, y, z, x + offset(generator), y, z});
+  }
+
+  VertexWelderOptions options;
+  options.epsilon  = 1e-4f;
+  options.parallel = false;
+  const auto sequential = VertexWelder::Weld(positions, options);
+  options.parallel      = true;
+  EXPECT_EQ(VertexWelder::Weld(positions, options), sequential);
+  EXPECT_EQ(VertexWelder::UniqueVertices(sequential).size(), 100000u);
+}
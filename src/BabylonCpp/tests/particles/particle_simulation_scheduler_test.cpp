@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/particles/emittertypes/mesh_particle_emitter.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_simulation_scheduler.h>
+#include <babylon/particles/particle_store.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+using namespace BABYLON;
+
+// More particles than a simulation chunk (16k) and than an emission chunk (1024)
+constexpr size_t Capacity = 40000;
+
+std::unique_ptr<ParticleSystem> CreateParticleSystem(ThinEngine* engine, const MeshPtr& mesh,
+                                                     bool useParticleStore)
+{
+  auto particleSystem = std::make_unique<ParticleSystem>("particles", Capacity, engine);
+  particleSystem->useParticleStore    = useParticleStore;
+  particleSystem->randomSeed          = 1234;
+  particleSystem->emitter             = Vector3(1.f, 2.f, 3.f);
+  particleSystem->particleEmitterType = std::make_shared<MeshParticleEmitter>(mesh);
+  particleSystem->minLifeTime         = 1.f;
+  particleSystem->maxLifeTime         = 3.f;
+  particleSystem->emitRate            = 3000;
+  particleSystem->updateSpeed         = 0.05f;
+  particleSystem->manualEmitCount     = 20000;
+  particleSystem->start();
+  return particleSystem;
+}
+
+void ExpectSameParticles(const ParticleSystem& expected, const ParticleSystem& actual)
+{
+  ASSERT_EQ(expected.getActiveCount(), actual.getActiveCount());
+
+  const auto expectedStore = expected._getParticleStore();
+  const auto actualStore   = actual._getParticleStore();
+  ASSERT_EQ(expectedStore == nullptr, actualStore == nullptr);
+  if (expectedStore) {
+    for (size_t i = 0; i < expectedStore->size(); ++i) {
+      ASSERT_EQ(expectedStore->position(i), actualStore->position(i)) << "particle " << i;
+      ASSERT_EQ(expectedStore->direction(i), actualStore->direction(i)) << "particle " << i;
+      ASSERT_EQ(expectedStore->age(i), actualStore->age(i)) << "particle " << i;
+      ASSERT_EQ(expectedStore->particleSize(i), actualStore->particleSize(i)) << "particle " << i;
+    }
+  }
+  else {
+    auto& expectedParticles = const_cast<ParticleSystem&>(expected).particles();
+    auto& actualParticles   = const_cast<ParticleSystem&>(actual).particles();
+    for (size_t i = 0; i < expectedParticles.size(); ++i) {
+      const auto& expectedParticle = *expectedParticles[i];
+      const auto& actualParticle   = *actualParticles[i];
+      ASSERT_EQ(expectedParticle.position, actualParticle.position) << "particle " << i;
+      ASSERT_EQ(expectedParticle.direction, actualParticle.direction) << "particle " << i;
+      ASSERT_EQ(expectedParticle.age, actualParticle.age) << "particle " << i;
+    }
+  }
+
+  const auto& expectedVertexData = expected._getVertexData();
+  const auto& actualVertexData   = actual._getVertexData();
+  ASSERT_EQ(expectedVertexData.size(), actualVertexData.size());
+  for (size_t i = 0; i < expectedVertexData.size(); ++i) {
+    ASSERT_EQ(expectedVertexData[i], actualVertexData[i]) << "vertex data " << i;
+  }
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for ParticleSimulationScheduler.
+ */
+
+/**
+ * @brief the particles are the same whether the systems are animated on one thread or several,
+ * with the particle objects and with the particle store (chunked emission from a mesh emitter)
+ */
+TEST(TestParticleSimulationScheduler, SameParticlesSerialAndParallel)
+{
+  using namespace BABYLON;
+
+  auto engine     = createSubject();
+  auto thinEngine = static_cast<ThinEngine*>(engine.get());
+  auto scene      = Scene::New(engine.get());
+  BoxOptions options;
+  auto box = BoxBuilder::CreateBox("box", options, scene.get());
+
+  ThreadPool serialPool(0);
+  ThreadPool parallelPool(4);
+  ParticleSimulationScheduler serialScheduler(serialPool);
+  ParticleSimulationScheduler parallelScheduler(parallelPool);
+
+  for (const auto useParticleStore : {false, true}) {
+    auto serialSystem   = CreateParticleSystem(thinEngine, box, useParticleStore);
+    auto parallelSystem = CreateParticleSystem(thinEngine, box, useParticleStore);
+
+    for (size_t frame = 0; frame < 4; ++frame) {
+      serialScheduler.animate({serialSystem.get()});
+      parallelScheduler.animate({parallelSystem.get()});
+      ExpectSameParticles(*serialSystem, *parallelSystem);
+    }
+    EXPECT_EQ(parallelSystem->getActiveCount(), 20000ull);
+  }
+}
+
+/**
+ * @brief fractional update speeds move and emit the particles (the scaled update speed used to be
+ * truncated to an integer)
+ */
+TEST(TestParticleSimulationScheduler, FractionalUpdateSpeed)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  ParticleSystem particleSystem("particles", 100, static_cast<ThinEngine*>(engine.get()));
+  particleSystem.useParticleStore = true;
+  particleSystem.emitter          = Vector3::Zero();
+  particleSystem.minLifeTime      = 10.f;
+  particleSystem.maxLifeTime      = 10.f;
+  particleSystem.emitRate         = 1000;
+  particleSystem.updateSpeed      = 0.01f;
+  particleSystem.start();
+
+  ThreadPool threadPool(2);
+  ParticleSimulationScheduler scheduler(threadPool);
+  scheduler.animate({&particleSystem});
+  EXPECT_EQ(particleSystem.getActiveCount(), 10ull);
+
+  scheduler.animate({&particleSystem});
+  EXPECT_EQ(particleSystem.getActiveCount(), 20ull);
+  const auto store = particleSystem._getParticleStore();
+  ASSERT_NE(store, nullptr);
+  EXPECT_FLOAT_EQ(store->age(0), 0.01f);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_store.h>
+#include <babylon/particles/particle_system.h>
+
+/**
+ * @brief Test Suite for ParticleStore.
+ */
+
+/**
+ * @brief particles age, move and die like with the default update function
+ */
+TEST(TestParticleStore, Update)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  ParticleSystem particleSystem("particles", 16, static_cast<ThinEngine*>(engine.get()));
+
+  // 7 particles so that both the vectorized and the scalar paths are used
+  ParticleStore store;
+  store.setCapacity(7);
+  Particle particle(&particleSystem);
+  particle.direction = Vector3(1.f, 0.f, 0.f);
+  particle.color     = Color4(1.f, 1.f, 1.f, 1.f);
+  particle.colorStep = Color4(0.f, 0.f, 0.f, -1.f);
+  particle.lifeTime  = 1.f;
+  particle.size      = 2.f;
+  for (size_t i = 0; i < 7; ++i) {
+    particle.age = i == 6 ? 0.5f : 0.f;
+    EXPECT_EQ(store.add(particle, 0.5f), i);
+  }
+  EXPECT_EQ(store.add(particle, 0.5f), store.capacity());
+
+  ParticleStoreUpdate update;
+  update.updateSpeed = 0.25f;
+  update.gravity     = Vector3(0.f, -4.f, 0.f);
+  store.update(update);
+
+  for (size_t i = 0; i < 6; ++i) {
+    EXPECT_FLOAT_EQ(store.age(i), 0.25f);
+    EXPECT_FLOAT_EQ(store.position(i).x, 0.25f);
+    EXPECT_FLOAT_EQ(store.direction(i).y, -1.f);
+    EXPECT_FLOAT_EQ(store.color(i).a, 0.75f);
+    EXPECT_FLOAT_EQ(store.particleSize(i), 2.f);
+  }
+
+  // The last step is shortened to the remaining life time
+  update.updateSpeed = 1.f;
+  store.update(update);
+  EXPECT_FLOAT_EQ(store.age(0), 1.f);
+  EXPECT_FLOAT_EQ(store.position(0).x, 1.f);
+  EXPECT_FLOAT_EQ(store.color(0).a, 0.f);
+  EXPECT_EQ(store.removeDeadParticles(), 7ull);
+  EXPECT_EQ(store.size(), 0ull);
+}
+
+/**
+ * @brief gradients are sampled over the life time of the particles
+ */
+TEST(TestParticleStore, Gradients)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  ParticleSystem particleSystem("particles", 16, static_cast<ThinEngine*>(engine.get()));
+
+  ParticleStore store;
+  store.setCapacity(5);
+  store.setSizeGradients({FactorGradient(0.f, 1.f), FactorGradient(1.f, 3.f)});
+  store.setDragGradients({FactorGradient(0.f, 0.5f)});
+  store.setAngularSpeedGradients({FactorGradient(0.f, 1.f, 3.f)});
+
+  Particle particle(&particleSystem);
+  particle.direction = Vector3(0.f, 0.f, 2.f);
+  particle.lifeTime  = 2.f;
+  for (size_t i = 0; i < 5; ++i) {
+    store.add(particle, static_cast<float>(i) / 4.f);
+  }
+
+  ParticleStoreUpdate update;
+  update.updateSpeed = 1.f;
+  store.update(update);
+
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_NEAR(store.particleSize(i), 2.f, 1e-5f);
+    EXPECT_NEAR(store.position(i).z, 1.f, 1e-5f);
+    // Ranges are evaluated with the random value of each particle
+    EXPECT_NEAR(store.angle(i), 1.f + 2.f * static_cast<float>(i) / 4.f, 1e-5f);
+  }
+  EXPECT_EQ(store.removeDeadParticles(), 0ull);
+}
+
+/**
+ * @brief vertices are written with the layout of the particle system vertex buffer
+ */
+TEST(TestParticleStore, FillVertexData)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  ParticleSystem particleSystem("particles", 16, static_cast<ThinEngine*>(engine.get()));
+
+  ParticleStore store;
+  store.setCapacity(2);
+  Particle particle(&particleSystem);
+  particle.position = Vector3(1.f, 2.f, 3.f);
+  particle.color    = Color4(0.1f, 0.2f, 0.3f, 0.4f);
+  particle.angle    = 0.5f;
+  particle.size     = 2.f;
+  particle.scale    = Vector2(1.f, 0.5f);
+  store.add(particle, 0.f);
+  particle.position = Vector3(4.f, 5.f, 6.f);
+  store.add(particle, 0.f);
+
+  ParticleStoreVertexLayout layout;
+  layout.vertexSize       = 15;
+  layout.useInstancing    = false;
+  layout.direction        = true;
+  layout.initialDirection = true;
+  layout.worldOffset      = Vector3(10.f, 0.f, 0.f);
+
+  Float32Array vertexData(2 * 4 * layout.vertexSize, -1.f);
+  store.fillVertexData(vertexData.data(), layout);
+
+  // Position, color, angle, size, initial direction and offset
+  const Float32Array firstVertex{11.f, 2.f, 3.f, 0.1f,   0.2f, 0.3f, 0.4f, 0.5f,
+                                 2.f,  1.f, 0.001f, 0.f, 0.f,  0.f,  0.f};
+  for (size_t i = 0; i < firstVertex.size(); ++i) {
+    EXPECT_FLOAT_EQ(vertexData[i], firstVertex[i]);
+  }
+
+  // The other corners only differ by their offset
+  EXPECT_FLOAT_EQ(vertexData[2 * layout.vertexSize + 7], 0.5f);
+  EXPECT_FLOAT_EQ(vertexData[2 * layout.vertexSize + 13], 1.f);
+  EXPECT_FLOAT_EQ(vertexData[2 * layout.vertexSize + 14], 1.f);
+  EXPECT_FLOAT_EQ(vertexData[3 * layout.vertexSize + 13], 0.f);
+  EXPECT_FLOAT_EQ(vertexData[3 * layout.vertexSize + 14], 1.f);
+
+  // Second particle
+  EXPECT_FLOAT_EQ(vertexData[4 * layout.vertexSize], 14.f);
+  EXPECT_FLOAT_EQ(vertexData[8 * layout.vertexSize - 1], 1.f);
+}
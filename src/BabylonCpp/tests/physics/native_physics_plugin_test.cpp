@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/physics/iphysics_enabled_object.h>
+#include <babylon/physics/iphysics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_parameters.h>
+#include <babylon/physics/physics_raycast_result.h>
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+namespace {
+
+using namespace BABYLON;
+
+/**
+ * @brief Physics enabled object with the bounds of a box.
+ */
+class PhysicsObject : public IPhysicsEnabledObject {
+
+public:
+  static std::shared_ptr<PhysicsObject> New(const std::string& name, Scene* scene,
+                                            const Vector3& size)
+  {
+    auto object = std::shared_ptr<PhysicsObject>(new PhysicsObject(name, scene, size));
+    object->addToScene(object);
+    return object;
+  }
+
+  AbstractMesh* getParent() override
+  {
+    return AbstractMesh::getParent();
+  }
+
+  Scene* getScene() const override
+  {
+    return AbstractMesh::getScene();
+  }
+
+  bool hasBoundingInfo() override
+  {
+    return true;
+  }
+
+  std::string getClassName() const override
+  {
+    return "PhysicsObject";
+  }
+
+protected:
+  PhysicsObject(const std::string& name, Scene* scene, const Vector3& size)
+      : IPhysicsEnabledObject{name, scene}
+  {
+    setBoundingInfo(BoundingInfo(size.scale(-0.5f), size.scale(0.5f)));
+  }
+
+}; // end of class PhysicsObject
+
+PhysicsImpostorPtr CreateImpostor(const std::shared_ptr<PhysicsObject>& object, unsigned int type,
+                                  float mass)
+{
+  PhysicsImpostorParameters options;
+  options.mass = mass;
+  auto impostor
+    = std::make_shared<PhysicsImpostor>(object.get(), type, options, object->getScene());
+  object->physicsImpostor = impostor;
+  return impostor;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Test Suite for NativePhysicsPlugin.
+ */
+
+/**
+ * @brief the impostors are simulated by the plugin through the physics engine of the scene, and
+ * a destroyed impostor is removed from the engine and from the simulation
+ */
+TEST(TestNativePhysicsPlugin, ImpostorRoundTrip)
+{
+  using namespace BABYLON;
+
+  // The plugin outlives the scene
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  ASSERT_TRUE(scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin));
+  auto& physicsEngine = scene->getPhysicsEngine();
+
+  auto ground      = PhysicsObject::New("ground", scene.get(), Vector3(20.f, 1.f, 20.f));
+  ground->position = Vector3(0.f, -0.5f, 0.f);
+  CreateImpostor(ground, PhysicsImpostor::BoxImpostor, 0.f);
+  auto sphere      = PhysicsObject::New("sphere", scene.get(), Vector3(1.f, 1.f, 1.f));
+  sphere->position = Vector3(0.f, 3.f, 0.f);
+  CreateImpostor(sphere, PhysicsImpostor::SphereImpostor, 1.f);
+  ASSERT_EQ(physicsEngine->getImpostors().size(), 2ull);
+  ASSERT_NE(sphere->physicsImpostor()->physicsBody(), nullptr);
+
+  // The sphere falls on the ground
+  for (size_t i = 0; i < 180; ++i) {
+    physicsEngine->_step(1.f / 60.f);
+  }
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.02f);
+  EXPECT_NEAR(sphere->position().x, 0.f, 0.01f);
+  auto hit = plugin.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, -10.f, 0.f));
+  ASSERT_TRUE(hit.hasHit());
+  EXPECT_NEAR(hit.hitPointWorld().y, 1.f, 0.02f);
+
+  // The engine does not own the impostors: the object destroys its impostor, which removes
+  // itself from the engine and its body from the plugin
+  sphere->physicsImpostor = nullptr;
+  ASSERT_EQ(physicsEngine->getImpostors().size(), 1ull);
+  EXPECT_EQ(physicsEngine->getImpostors()[0], ground->physicsImpostor());
+  hit = plugin.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, -10.f, 0.f));
+  ASSERT_TRUE(hit.hasHit());
+  EXPECT_NEAR(hit.hitPointWorld().y, 0.f, 1e-4f);
+  physicsEngine->_step(1.f / 60.f);
+
+  // Disposing the engine disposes the remaining impostors
+  scene->disablePhysicsEngine();
+  EXPECT_TRUE(ground->physicsImpostor()->isDisposed());
+}
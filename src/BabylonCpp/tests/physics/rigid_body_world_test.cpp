@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/plugins/native/collision_shape.h>
+#include <babylon/physics/plugins/native/rigid_body.h>
+#include <babylon/physics/plugins/native/rigid_body_joint.h>
+#include <babylon/physics/plugins/native/rigid_body_world.h>
+
+namespace {
+
+BABYLON::RigidBody* CreateGround(BABYLON::RigidBodyWorld& world)
+{
+  using namespace BABYLON;
+  auto ground = world.createBody();
+  ground->addShape(CollisionShape::CreateBox(Vector3(10.f, 0.5f, 10.f)), Vector3::Zero(),
+                   Quaternion::Identity());
+  ground->setMass(0.f);
+  ground->setOriginTransformation(Vector3(0.f, -0.5f, 0.f), Quaternion::Identity());
+  return ground;
+}
+
+} // end of anonymous namespace
+
+/**
+ * @brief Tests that a box dropped on the ground comes to rest on it and falls asleep.
+ */
+TEST(TestRigidBodyWorld, BoxRestsOnGround)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  CreateGround(world);
+  auto box = world.createBody();
+  box->addShape(CollisionShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), Vector3::Zero(),
+                Quaternion::Identity());
+  box->setMass(1.f);
+  box->setOriginTransformation(Vector3(0.f, 2.f, 0.f), Quaternion::Identity());
+
+  for (size_t i = 0; i < 300; ++i) {
+    world.step(1.f / 60.f);
+  }
+
+  EXPECT_NEAR(box->originPosition().y, 0.5f, 0.02f);
+  EXPECT_NEAR(box->originPosition().x, 0.f, 0.01f);
+  EXPECT_TRUE(box->sleeping());
+}
+
+/**
+ * @brief Tests that a stack of boxes stays upright, and that a sphere and a capsule rest on the
+ * ground.
+ */
+TEST(TestRigidBodyWorld, StackIsStable)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  CreateGround(world);
+  std::vector<RigidBody*> bodies;
+  for (size_t i = 0; i < 5; ++i) {
+    auto body = world.createBody();
+    body->addShape(CollisionShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), Vector3::Zero(),
+                   Quaternion::Identity());
+    body->setMass(1.f);
+    body->setOriginTransformation(Vector3(0.f, 0.5f + static_cast<float>(i), 0.f),
+                                  Quaternion::Identity());
+    bodies.emplace_back(body);
+  }
+  auto sphere = world.createBody();
+  sphere->addShape(CollisionShape::CreateSphere(0.5f), Vector3::Zero(), Quaternion::Identity());
+  sphere->setMass(1.f);
+  sphere->setOriginTransformation(Vector3(3.f, 3.f, 0.f), Quaternion::Identity());
+  auto capsule = world.createBody();
+  capsule->addShape(CollisionShape::CreateCapsule(0.25f, 0.5f), Vector3::Zero(),
+                    Quaternion(0.f, 0.f, 0.70710678f, 0.70710678f));
+  capsule->setMass(1.f);
+  capsule->setOriginTransformation(Vector3(-3.f, 1.f, 0.f), Quaternion::Identity());
+
+  for (size_t i = 0; i < 240; ++i) {
+    world.step(1.f / 60.f);
+  }
+
+  for (size_t i = 0; i < bodies.size(); ++i) {
+    const auto position = bodies[i]->originPosition();
+    EXPECT_NEAR(position.y, 0.5f + static_cast<float>(i), 0.05f);
+    EXPECT_NEAR(position.x, 0.f, 0.05f);
+  }
+  EXPECT_NEAR(sphere->originPosition().y, 0.5f, 0.02f);
+  EXPECT_NEAR(capsule->originPosition().y, 0.25f, 0.02f);
+}
+
+/**
+ * @brief Tests the closest hit of a raycast.
+ */
+TEST(TestRigidBodyWorld, Raycast)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  auto ground = CreateGround(world);
+  auto sphere = world.createBody();
+  sphere->addShape(CollisionShape::CreateSphere(1.f), Vector3::Zero(), Quaternion::Identity());
+  sphere->setOriginTransformation(Vector3(0.f, 3.f, 0.f), Quaternion::Identity());
+
+  RigidBodyWorld::RaycastHit hit;
+  ASSERT_TRUE(world.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, -10.f, 0.f), hit));
+  EXPECT_EQ(hit.body, sphere);
+  EXPECT_NEAR(hit.distance, 6.f, 1e-4f);
+  EXPECT_NEAR(hit.normal.y, 1.f, 1e-4f);
+
+  ASSERT_TRUE(world.raycast(Vector3(2.f, 10.f, 0.f), Vector3(2.f, -10.f, 0.f), hit));
+  EXPECT_EQ(hit.body, ground);
+  EXPECT_NEAR(hit.point.y, 0.f, 1e-4f);
+
+  EXPECT_FALSE(world.raycast(Vector3(20.f, 10.f, 0.f), Vector3(20.f, -10.f, 0.f), hit));
+}
+
+/**
+ * @brief Tests that a pendulum hanging from a hinge keeps its distance to the pivot and only
+ * rotates around the axis of the hinge.
+ */
+TEST(TestRigidBodyWorld, HingePendulum)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  auto anchor = world.createBody();
+  anchor->addShape(CollisionShape::CreateSphere(0.1f), Vector3::Zero(), Quaternion::Identity());
+  anchor->setMass(0.f);
+  anchor->setOriginTransformation(Vector3(0.f, 5.f, 0.f), Quaternion::Identity());
+  auto bob = world.createBody();
+  bob->addShape(CollisionShape::CreateBox(Vector3(0.25f, 0.25f, 0.25f)), Vector3::Zero(),
+                Quaternion::Identity());
+  bob->setMass(1.f);
+  bob->setOriginTransformation(Vector3(2.f, 5.f, 0.f), Quaternion::Identity());
+  world.createJoint(RigidBodyJoint::Type::Hinge, anchor, bob, Vector3::Zero(),
+                    Vector3(-2.f, 0.f, 0.f), Vector3(0.f, 0.f, 1.f), Vector3(0.f, 0.f, 1.f),
+                    false);
+
+  for (size_t i = 0; i < 120; ++i) {
+    world.step(1.f / 60.f);
+    const auto position = bob->originPosition();
+    ASSERT_NEAR(Vector3::Distance(position, Vector3(0.f, 5.f, 0.f)), 2.f, 0.02f) << "step " << i;
+    ASSERT_NEAR(position.z, 0.f, 1e-3f) << "step " << i;
+    ASSERT_NEAR(bob->orientation.x, 0.f, 1e-3f) << "step " << i;
+    ASSERT_NEAR(bob->orientation.y, 0.f, 1e-3f) << "step " << i;
+  }
+  EXPECT_LT(bob->originPosition().y, 4.5f);
+}
+
+/**
+ * @brief Tests that the motor of a hinge drives the connected body at its target speed.
+ */
+TEST(TestRigidBodyWorld, HingeMotor)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  world.setGravity(Vector3::Zero());
+  auto anchor = world.createBody();
+  anchor->addShape(CollisionShape::CreateSphere(0.1f), Vector3::Zero(), Quaternion::Identity());
+  anchor->setMass(0.f);
+  auto wheel = world.createBody();
+  wheel->addShape(CollisionShape::CreateCylinder(1.f, 0.1f), Vector3::Zero(),
+                  Quaternion::Identity());
+  wheel->setMass(1.f);
+  auto hinge = world.createJoint(RigidBodyJoint::Type::Hinge, anchor, wheel, Vector3::Zero(),
+                                 Vector3::Zero(), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 1.f, 0.f),
+                                 false);
+  hinge->setMotor(2.f, 0.f, 0);
+
+  for (size_t i = 0; i < 60; ++i) {
+    world.step(1.f / 60.f);
+  }
+
+  const auto angularVelocity = wheel->angularVelocity();
+  EXPECT_NEAR(angularVelocity.y, 2.f, 0.05f);
+  EXPECT_NEAR(angularVelocity.x, 0.f, 1e-3f);
+  EXPECT_NEAR(angularVelocity.z, 0.f, 1e-3f);
+  EXPECT_NEAR(wheel->originPosition().length(), 0.f, 1e-3f);
+}
+
+/**
+ * @brief Tests that a distance joint keeps the bodies within its maximum distance, the distance
+ * being the initial one until the limits are updated.
+ */
+TEST(TestRigidBodyWorld, DistanceJoint)
+{
+  using namespace BABYLON;
+
+  RigidBodyWorld world;
+  auto anchor = world.createBody();
+  anchor->addShape(CollisionShape::CreateSphere(0.1f), Vector3::Zero(), Quaternion::Identity());
+  anchor->setMass(0.f);
+  anchor->setOriginTransformation(Vector3(0.f, 5.f, 0.f), Quaternion::Identity());
+  auto ball = world.createBody();
+  ball->addShape(CollisionShape::CreateSphere(0.25f), Vector3::Zero(), Quaternion::Identity());
+  ball->setMass(1.f);
+  ball->setOriginTransformation(Vector3(2.f, 5.f, 0.f), Quaternion::Identity());
+  auto joint = world.createJoint(RigidBodyJoint::Type::Distance, anchor, ball, Vector3::Zero(),
+                                 Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), false);
+  EXPECT_NEAR(joint->pivotDistance(), 2.f, 1e-5f);
+
+  // The ball swings down to the vertical of the anchor
+  auto minimumY = ball->originPosition().y;
+  for (size_t i = 0; i < 120; ++i) {
+    world.step(1.f / 60.f);
+    ASSERT_LE(joint->pivotDistance(), 2.02f) << "step " << i;
+    minimumY = std::min(minimumY, ball->originPosition().y);
+  }
+  EXPECT_LT(minimumY, 3.1f);
+
+  // Longer rope: the ball hangs lower
+  joint->setDistanceLimits(3.f, 0.f);
+  for (size_t i = 0; i < 600; ++i) {
+    world.step(1.f / 60.f);
+    ASSERT_LE(joint->pivotDistance(), 3.02f) << "step " << i;
+  }
+  EXPECT_GT(joint->pivotDistance(), 2.5f);
+}
+
+/**
+ * @brief Tests that the islands, solved in parallel, move as if each was alone in its world.
+ */
+TEST(TestRigidBodyWorld, IndependentIslands)
+{
+  using namespace BABYLON;
+
+  constexpr size_t IslandCount = 8;
+  const auto createStack       = [](RigidBodyWorld& world, size_t island) {
+    const auto x = 4.f * static_cast<float>(island);
+    std::vector<RigidBody*> stack;
+    for (size_t i = 0; i < 2; ++i) {
+      auto body = world.createBody();
+      body->addShape(CollisionShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), Vector3::Zero(),
+                     Quaternion::Identity());
+      body->setMass(1.f);
+      body->setOriginTransformation(Vector3(x, 0.5f + static_cast<float>(i), 0.f),
+                                    Quaternion::Identity());
+      body->setLinearVelocity(Vector3(0.f, 0.f, 0.25f * static_cast<float>(island)));
+      stack.emplace_back(body);
+    }
+    return stack;
+  };
+
+  RigidBodyWorld world;
+  CreateGround(world);
+  std::vector<std::vector<RigidBody*>> stacks;
+  for (size_t island = 0; island < IslandCount; ++island) {
+    stacks.emplace_back(createStack(world, island));
+  }
+  for (size_t i = 0; i < 120; ++i) {
+    world.step(1.f / 60.f);
+  }
+
+  for (size_t island = 0; island < IslandCount; ++island) {
+    RigidBodyWorld islandWorld;
+    CreateGround(islandWorld);
+    const auto expected = createStack(islandWorld, island);
+    for (size_t i = 0; i < 120; ++i) {
+      islandWorld.step(1.f / 60.f);
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+      const auto expectedPosition = expected[i]->originPosition();
+      const auto actualPosition   = stacks[island][i]->originPosition();
+      EXPECT_NEAR(actualPosition.x, expectedPosition.x, 1e-3f) << "island " << island;
+      EXPECT_NEAR(actualPosition.y, expectedPosition.y, 1e-3f) << "island " << island;
+      EXPECT_NEAR(actualPosition.z, expectedPosition.z, 1e-3f) << "island " << island;
+    }
+  }
+  // The stacks slid on the ground
+  EXPECT_GT(stacks.back()[0]->originPosition().z, 0.1f);
+}
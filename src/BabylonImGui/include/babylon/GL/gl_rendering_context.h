@@ -42,6 +42,7 @@ public:
   void bufferSubData(GLenum target, GLintptr offset, const Uint8Array& data) override;
   void bufferSubData(GLenum target, GLintptr offset, const Float32Array& data) override;
   void bufferSubData(GLenum target, GLintptr offset, Int32Array& data) override;
+  void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) override;
   void bindVertexArray(GL::IGLVertexArrayObject* vao) override;
   GLenum checkFramebufferStatus(GLenum target) override;
   void clear(GLbitfield mask) override;
@@ -128,6 +129,7 @@ public:
   GLenum getError() override;
   const char* getErrorString(GLenum err) override;
   GLint getProgramParameter(IGLProgram* program, GLenum pname) override;
+  Uint8Array getProgramBinary(IGLProgram* program, GLenum& binaryFormat) override;
   std::string getProgramInfoLog(IGLProgram* program) override;
   GLint getRenderbufferParameter(GLenum target, GLenum pname) override;
   std::string getShaderInfoLog(IGLShader* shader) override;
@@ -150,6 +152,8 @@ public:
   bool linkProgram(IGLProgram* program) override;
   void pixelStorei(GLenum pname, GLint param) override;
   void polygonOffset(GLfloat factor, GLfloat units) override;
+  void programBinary(IGLProgram* program, GLenum binaryFormat, const Uint8Array& binary) override;
+  void programParameteri(IGLProgram* program, GLenum pname, GLint value) override;
   void readBuffer(GLenum src) override;
   void readPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type,
                   Float32Array& pixels) override;
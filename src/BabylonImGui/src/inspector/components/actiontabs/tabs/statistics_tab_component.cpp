@@ -85,8 +85,9 @@ void StatisticsTabComponent::render()
     TextLineComponent::render("Active faces", std::to_string((scene->getActiveIndices() / 3)));
     TextLineComponent::render("Active bones", std::to_string(scene->getActiveBones()));
     TextLineComponent::render("Active particles", std::to_string(scene->getActiveParticles()));
-    TextLineComponent::render("Draw calls",
-                              std::to_string(sceneInstrumentation->drawCallsCounter().current()));
+    TextLineComponent::render(
+      "Draw calls",
+      std::to_string(static_cast<size_t>(sceneInstrumentation->drawCallsCounter().current())));
     TextLineComponent::render("Total lights", std::to_string(scene->lights.size()));
     TextLineComponent::render("Total vertices", std::to_string(scene->getTotalVertices()));
     TextLineComponent::render("Total materials", std::to_string(scene->materials.size()));
@@ -5,34 +5,37 @@ namespace MaterialsLibrary {
 
 CellMaterialDefines::CellMaterialDefines()
 {
-  boolDef = {
-    {"DIFFUSE", false},                   //
-    {"CLIPPLANE", false},                 //
-    {"CLIPPLANE2", false},                //
-    {"CLIPPLANE3", false},                //
-    {"CLIPPLANE4", false},                //
-    {"CLIPPLANE5", false},                //
-    {"CLIPPLANE6", false},                //
-    {"ALPHATEST", false},                 //
-    {"POINTSIZE", false},                 //
-    {"FOG", false},                       //
-    {"NORMAL", false},                    //
-    {"UV1", false},                       //
-    {"UV2", false},                       //
-    {"VERTEXCOLOR", false},               //
-    {"VERTEXALPHA", false},               //
-    {"INSTANCES", false},                 //
-    {"NDOTL", true},                      //
-    {"CUSTOMUSERLIGHTING", true},         //
-    {"CELLBASIC", true},                  //
-    {"DEPTHPREPASS", false},              //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
-
-  intDef = {
-    {"NUM_BONE_INFLUENCERS", 0}, //
-    {"BonesPerMesh", 0}          //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"DIFFUSE", false},                   //
+      {"CLIPPLANE", false},                 //
+      {"CLIPPLANE2", false},                //
+      {"CLIPPLANE3", false},                //
+      {"CLIPPLANE4", false},                //
+      {"CLIPPLANE5", false},                //
+      {"CLIPPLANE6", false},                //
+      {"ALPHATEST", false},                 //
+      {"POINTSIZE", false},                 //
+      {"FOG", false},                       //
+      {"NORMAL", false},                    //
+      {"UV1", false},                       //
+      {"UV2", false},                       //
+      {"VERTEXCOLOR", false},               //
+      {"VERTEXALPHA", false},               //
+      {"INSTANCES", false},                 //
+      {"NDOTL", true},                      //
+      {"CUSTOMUSERLIGHTING", true},         //
+      {"CELLBASIC", true},                  //
+      {"DEPTHPREPASS", false},              //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {
+      {"NUM_BONE_INFLUENCERS", 0}, //
+      {"BonesPerMesh", 0}          //
+    });
+  _useSchema(schema);
 }
 
 CellMaterialDefines::~CellMaterialDefines() = default;
@@ -5,33 +5,36 @@ namespace MaterialsLibrary {
 
 FurMaterialDefines::FurMaterialDefines()
 {
-  boolDef = {
-    {"DIFFUSE", false},                   //
-    {"HEIGHTMAP", false},                 //
-    {"CLIPPLANE", false},                 //
-    {"CLIPPLANE2", false},                //
-    {"CLIPPLANE3", false},                //
-    {"CLIPPLANE4", false},                //
-    {"CLIPPLANE5", false},                //
-    {"CLIPPLANE6", false},                //
-    {"ALPHATEST", false},                 //
-    {"DEPTHPREPASS", false},              //
-    {"POINTSIZE", false},                 //
-    {"FOG", false},                       //
-    {"NORMAL", false},                    //
-    {"UV1", false},                       //
-    {"UV2", false},                       //
-    {"VERTEXCOLOR", false},               //
-    {"VERTEXALPHA", false},               //
-    {"INSTANCES", false},                 //
-    {"HIGHLEVEL", false},                 //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
-
-  intDef = {
-    {"NUM_BONE_INFLUENCERS", 0}, //
-    {"BonesPerMesh", 0}          //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"DIFFUSE", false},                   //
+      {"HEIGHTMAP", false},                 //
+      {"CLIPPLANE", false},                 //
+      {"CLIPPLANE2", false},                //
+      {"CLIPPLANE3", false},                //
+      {"CLIPPLANE4", false},                //
+      {"CLIPPLANE5", false},                //
+      {"CLIPPLANE6", false},                //
+      {"ALPHATEST", false},                 //
+      {"DEPTHPREPASS", false},              //
+      {"POINTSIZE", false},                 //
+      {"FOG", false},                       //
+      {"NORMAL", false},                    //
+      {"UV1", false},                       //
+      {"UV2", false},                       //
+      {"VERTEXCOLOR", false},               //
+      {"VERTEXALPHA", false},               //
+      {"INSTANCES", false},                 //
+      {"HIGHLEVEL", false},                 //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {
+      {"NUM_BONE_INFLUENCERS", 0}, //
+      {"BonesPerMesh", 0}          //
+    });
+  _useSchema(schema);
 }
 
 FurMaterialDefines::~FurMaterialDefines() = default;
@@ -5,31 +5,34 @@ namespace MaterialsLibrary {
 
 GradientMaterialDefines::GradientMaterialDefines()
 {
-  boolDef = {
-    {"EMISSIVE", false},                  //
-    {"CLIPPLANE", false},                 //
-    {"CLIPPLANE2", false},                //
-    {"CLIPPLANE3", false},                //
-    {"CLIPPLANE4", false},                //
-    {"CLIPPLANE5", false},                //
-    {"CLIPPLANE6", false},                //
-    {"ALPHATEST", false},                 //
-    {"DEPTHPREPASS", false},              //
-    {"POINTSIZE", false},                 //
-    {"FOG", false},                       //
-    {"NORMAL", false},                    //
-    {"UV1", false},                       //
-    {"UV2", false},                       //
-    {"VERTEXCOLOR", false},               //
-    {"VERTEXALPHA", false},               //
-    {"INSTANCES", false},                 //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
-
-  intDef = {
-    {"NUM_BONE_INFLUENCERS", 0}, //
-    {"BonesPerMesh", 0}          //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"EMISSIVE", false},                  //
+      {"CLIPPLANE", false},                 //
+      {"CLIPPLANE2", false},                //
+      {"CLIPPLANE3", false},                //
+      {"CLIPPLANE4", false},                //
+      {"CLIPPLANE5", false},                //
+      {"CLIPPLANE6", false},                //
+      {"ALPHATEST", false},                 //
+      {"DEPTHPREPASS", false},              //
+      {"POINTSIZE", false},                 //
+      {"FOG", false},                       //
+      {"NORMAL", false},                    //
+      {"UV1", false},                       //
+      {"UV2", false},                       //
+      {"VERTEXCOLOR", false},               //
+      {"VERTEXALPHA", false},               //
+      {"INSTANCES", false},                 //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {
+      {"NUM_BONE_INFLUENCERS", 0}, //
+      {"BonesPerMesh", 0}          //
+    });
+  _useSchema(schema);
 }
 
 GradientMaterialDefines::~GradientMaterialDefines() = default;
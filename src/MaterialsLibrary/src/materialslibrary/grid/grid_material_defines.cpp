@@ -5,17 +5,22 @@ namespace MaterialsLibrary {
 
 GridMaterialDefines::GridMaterialDefines()
 {
-  boolDef = {
-    {"OPACITY", false},                   //
-    {"TRANSPARENT", false},               //
-    {"FOG", false},                       //
-    {"PREMULTIPLYALPHA", false},          //
-    {"UV1", false},                       //
-    {"UV2", false},                       //
-    {"INSTANCES", false},                 //
-    {"THIN_INSTANCES", false},            //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"OPACITY", false},                   //
+      {"TRANSPARENT", false},               //
+      {"FOG", false},                       //
+      {"PREMULTIPLYALPHA", false},          //
+      {"UV1", false},                       //
+      {"UV2", false},                       //
+      {"INSTANCES", false},                 //
+      {"THIN_INSTANCES", false},            //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {});
+  _useSchema(schema);
 }
 
 GridMaterialDefines::~GridMaterialDefines() = default;
@@ -5,24 +5,27 @@ namespace MaterialsLibrary {
 
 ShadowOnlyMaterialDefines::ShadowOnlyMaterialDefines()
 {
-  boolDef = {
-    {"CLIPPLANE", false},                 //
-    {"CLIPPLANE2", false},                //
-    {"CLIPPLANE3", false},                //
-    {"CLIPPLANE4", false},                //
-    {"CLIPPLANE5", false},                //
-    {"CLIPPLANE6", false},                //
-    {"POINTSIZE", false},                 //
-    {"FOG", false},                       //
-    {"NORMAL", false},                    //
-    {"INSTANCES", false},                 //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
-
-  intDef = {
-    {"NUM_BONE_INFLUENCERS", 0}, //
-    {"BonesPerMesh", 0}          //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"CLIPPLANE", false},                 //
+      {"CLIPPLANE2", false},                //
+      {"CLIPPLANE3", false},                //
+      {"CLIPPLANE4", false},                //
+      {"CLIPPLANE5", false},                //
+      {"CLIPPLANE6", false},                //
+      {"POINTSIZE", false},                 //
+      {"FOG", false},                       //
+      {"NORMAL", false},                    //
+      {"INSTANCES", false},                 //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {
+      {"NUM_BONE_INFLUENCERS", 0}, //
+      {"BonesPerMesh", 0}          //
+    });
+  _useSchema(schema);
 }
 
 ShadowOnlyMaterialDefines::~ShadowOnlyMaterialDefines() = default;
@@ -5,19 +5,24 @@ namespace MaterialsLibrary {
 
 SkyMaterialDefines::SkyMaterialDefines()
 {
-  boolDef = {
-    {"CLIPPLANE", false},                 //
-    {"CLIPPLANE2", false},                //
-    {"CLIPPLANE3", false},                //
-    {"CLIPPLANE4", false},                //
-    {"CLIPPLANE5", false},                //
-    {"CLIPPLANE6", false},                //
-    {"POINTSIZE", false},                 //
-    {"FOG", false},                       //
-    {"VERTEXCOLOR", false},               //
-    {"VERTEXALPHA", false},               //
-    {"IMAGEPROCESSINGPOSTPROCESS", false} //
-  };
+  static MaterialDefinesSchema schema(
+    // Boolean defines
+    {
+      {"CLIPPLANE", false},                 //
+      {"CLIPPLANE2", false},                //
+      {"CLIPPLANE3", false},                //
+      {"CLIPPLANE4", false},                //
+      {"CLIPPLANE5", false},                //
+      {"CLIPPLANE6", false},                //
+      {"POINTSIZE", false},                 //
+      {"FOG", false},                       //
+      {"VERTEXCOLOR", false},               //
+      {"VERTEXALPHA", false},               //
+      {"IMAGEPROCESSINGPOSTPROCESS", false} //
+    },
+    // Numeric defines
+    {});
+  _useSchema(schema);
 }
 
 SkyMaterialDefines::~SkyMaterialDefines() = default;
@@ -239,7 +239,8 @@ void GLRenderingContext::blitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1,
 
 void GLRenderingContext::bufferData(GLenum target, GLsizeiptr sizeiptr, GLenum usage)
 {
-  glBufferData(target, sizeiptr >> 32, reinterpret_cast<any>(sizeiptr & 0x0000ffff), usage);
+  // Allocates (or orphans) the data store without initializing it
+  glBufferData(target, sizeiptr, nullptr, usage);
 }
 
 void GLRenderingContext::bufferData(GLenum target, const Float32Array& data, GLenum usage)
@@ -277,6 +278,12 @@ void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset, Int32Arra
   glBufferSubData(target, offset, static_cast<GLint>(data.size() * sizeof(int32_t)), data.data());
 }
 
+void GLRenderingContext::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
+                                       const void* data)
+{
+  glBufferSubData(target, offset, size, data);
+}
+
 void GLRenderingContext::bindVertexArray(GL::IGLVertexArrayObject* vao)
 {
   glBindVertexArray(vao ? vao->value : 0);
@@ -707,6 +714,22 @@ GLint GLRenderingContext::getProgramParameter(IGLProgram* program, GLenum pname)
   return parameter;
 }
 
+Uint8Array GLRenderingContext::getProgramBinary(IGLProgram* program, GLenum& binaryFormat)
+{
+  Uint8Array binary;
+  GLint length = 0;
+  glGetProgramiv(program->value, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) {
+    return binary;
+  }
+
+  binary.resize(static_cast<size_t>(length));
+  GLsizei written = 0;
+  glGetProgramBinary(program->value, length, &written, &binaryFormat, binary.data());
+  binary.resize(written > 0 ? static_cast<size_t>(written) : 0);
+  return binary;
+}
+
 std::string GLRenderingContext::getProgramInfoLog(IGLProgram* program)
 {
   GLint k = -1;
@@ -850,6 +873,17 @@ void GLRenderingContext::polygonOffset(GLfloat factor, GLfloat units)
   glPolygonOffset(factor, units);
 }
 
+void GLRenderingContext::programBinary(IGLProgram* program, GLenum binaryFormat,
+                                       const Uint8Array& binary)
+{
+  glProgramBinary(program->value, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+}
+
+void GLRenderingContext::programParameteri(IGLProgram* program, GLenum pname, GLint value)
+{
+  glProgramParameteri(program->value, pname, value);
+}
+
 void GLRenderingContext::readBuffer(GLenum src)
 {
   glReadBuffer(src);